@@ -4745,7 +4745,12 @@ void C3DEngine::OnObjectModified(IRenderNode* pRenderNode, uint dwFlags)
 {
     if ((dwFlags & (ERF_CASTSHADOWMAPS | ERF_HAS_CASTSHADOWMAPS)) != 0)
     {
-        SetRecomputeCachedShadows(ShadowMapFrustum::ShadowCacheData::eFullUpdate);
+        // Only invalidate the cached cascades the caster touches. Fall back to a full recompute
+        // when no cached frustum exists yet to track the change.
+        if (!m_pSun || !pRenderNode || !m_pSun->OnCasterModified(pRenderNode, pRenderNode->GetBBox()))
+        {
+            SetRecomputeCachedShadows(ShadowMapFrustum::ShadowCacheData::eFullUpdate);
+        }
     }
 }
 
@@ -353,6 +353,56 @@ namespace NAsyncCull
             return CULL && (SignMask(Visible) & (BitX | BitY | BitZ | BitW)) != (BitX | BitY | BitZ | BitW);
         }
 
+        //conservative early out for boxes completely in front of the near plane: if every zexel of the
+        //projected bounding rectangle is closer than the nearest box corner, the box is occluded and the
+        //per face triangle tests can be skipped. Returns false whenever the exact test is still needed.
+        CULLINLINE  bool            Rect2DOccluded(const NVMath::vec4* pVB)
+        {
+            using namespace NVMath;
+
+            vec4 VMin   =   Vec4Zero();
+            vec4 VMax   =   Vec4Zero();
+            vec4 VMinZ  =   pVB[0];
+            for (uint32 a = 0; a < 8; a++)
+            {
+                const vec4  V   =   Mul(pVB[a], Rcp(Splat<3>(pVB[a])));
+                VMin    =   a ? Min(VMin, V) : V;
+                VMax    =   a ? Max(VMax, V) : V;
+                VMinZ   =   Min(VMinZ, pVB[a]);
+            }
+            VMinZ   =   Splat<2>(VMinZ);
+
+            //one zexel of slack on both sides covers the approximate reciprocal
+            VMin            =   Sub(VMin, Vec4One());
+            VMax            =   Add(VMax, NVMath::Vec4(2.f));
+            vec4 VMinMax    =   Shuffle<xyxy>(VMin, VMax);
+            VMinMax         =   Max(VMinMax, Vec4Zero());
+            VMinMax         =   Min(VMinMax, m_VMaxXY);
+            VMinMax         =   floatToint32(VMinMax);
+            const uint32* pMM       =   reinterpret_cast<uint32*>(&VMinMax);
+            const uint32 MinX       =   pMM[0] & ~3;
+            const uint32 MinY       =   pMM[1];
+            const uint32 MaxX       =   pMM[2];
+            const uint32 MaxY       =   pMM[3];
+            if (MinX >= MaxX || MinY >= MaxY)
+            {
+                return false;
+            }
+
+            for (uint32 y = MinY; y < MaxY; y++)
+            {
+                const vec4* pSrcZ   =   reinterpret_cast<const vec4*>(&m_ZBuffer[MinX + y * SIZEX]);
+                for (uint32 x = MinX; x < MaxX; x += 4, pSrcZ++)
+                {
+                    if (SignMask(CmpLE(*pSrcZ, VMinZ)) != (BitX | BitY | BitZ | BitW))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
 
         CULLINLINE  bool            Quad2D(const NVMath::vec4& rV0, const NVMath::vec4& rV1, const NVMath::vec4& rV3, const NVMath::vec4& rV2)
         {
@@ -1121,6 +1171,12 @@ namespace NAsyncCull
             }
             else
             {
+                const vec4 VB[8] = { VB0, VB1, VB2, VB3, VB4, VB5, VB6, VB7 };
+                if (Rect2DOccluded(VB))
+                {
+                    return false;
+                }
+
                 if (Max.x < ViewPos.x)
                 {
                     //if(Quad2D(VB3,VB2,VB6,VB7))return true;
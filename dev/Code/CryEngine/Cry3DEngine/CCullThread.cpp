@@ -18,6 +18,8 @@
 #include <CryProfileMarker.h>
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/LegacyJobExecutor.h>
+#include <AzCore/std/parallel/atomic.h>
 
 typedef NAsyncCull::CCullRenderer<CULL_SIZEX, CULL_SIZEY>    tdCullRasterizer;
 
@@ -702,10 +704,67 @@ namespace NAsyncCull
         bool bEnabled = m_Enabled;
 
         // Debugging stats in green to screen here with how many octree nodes pass/fail and how many terrain nodes pass/fail
-        unsigned int octreeNodesCulled = 0;
-        unsigned int octreeNodesVisible = 0;
+        AZStd::atomic_uint octreeNodesCulled(0);
+        AZStd::atomic_uint octreeNodesVisible(0);
         unsigned int terrainNodesCulled = 0;
         unsigned int terrainNodesVisible = 0;
+
+        // octree nodes are tested against the coverage buffer and filled in batches on worker jobs, the buffer is read only at this point
+        const size_t nOctreeNodesPerJob = static_cast<size_t>(max(GetCVars()->e_CheckOcclusionOctreeNodesPerJob, 0));
+        AZ::LegacyJobExecutor octreeNodesJobExecutor;
+        AZStd::vector<SCheckOcclusionJobData> octreeNodesBatch;
+        octreeNodesBatch.reserve(nOctreeNodesPerJob);
+
+        auto testOctreeNodes = [this, &octreeNodesCulled, &octreeNodesVisible](const SCheckOcclusionJobData* pJobData, size_t nCount, const SRenderingPassInfo& rPassInfo, bool bOnWorkerJob)
+        {
+            for (size_t i = 0; i < nCount; ++i)
+            {
+                const SCheckOcclusionJobData& jobData = pJobData[i];
+                AABB    rAABB;
+                COctreeNode* pOctTreeNode = jobData.octTreeData.pOctTreeNode;
+
+                memcpy(&rAABB, &pOctTreeNode->GetObjectsBBox(), sizeof(AABB));
+                float fDistance = sqrtf(Distance::Point_AABBSq(rPassInfo.GetCamera().GetPosition(), rAABB));
+
+                // Test OctTree BoundingBox
+                if (TestAABB(rAABB, fDistance))
+                {
+                    if (bOnWorkerJob)
+                    {
+                        // already off the check occlusion job, so fill the node content here instead of spawning another job
+                        if (GetCVars()->e_StatObjBufferRenderTasks == 1 && rPassInfo.IsGeneralPass())
+                        {
+                            GetObjManager()->AddCullJobProducer();
+                        }
+                        pOctTreeNode->RenderContentJobEntry(jobData.octTreeData.nRenderMask, rPassInfo, jobData.rendItemSorter, jobData.pCam);
+                    }
+                    else
+                    {
+                        pOctTreeNode->COctreeNode::RenderContent(jobData.octTreeData.nRenderMask, rPassInfo, jobData.rendItemSorter, jobData.pCam);
+                    }
+                    octreeNodesVisible++;
+                }
+                else
+                {
+                    octreeNodesCulled++;
+                }
+            }
+        };
+
+        auto flushOctreeNodes = [&]()
+        {
+            if (octreeNodesBatch.empty())
+            {
+                return;
+            }
+            octreeNodesJobExecutor.StartJob([testOctreeNodes, batch = AZStd::move(octreeNodesBatch), passInfo]()
+            {
+                testOctreeNodes(batch.data(), batch.size(), passInfo, true);
+            });
+            octreeNodesBatch = AZStd::vector<SCheckOcclusionJobData>();
+            octreeNodesBatch.reserve(nOctreeNodesPerJob);
+        };
+
         while (1)
         {
             SCheckOcclusionJobData jobData;
@@ -714,26 +773,23 @@ namespace NAsyncCull
             // stop processing when beeing told so
             if (jobData.type == SCheckOcclusionJobData::QUIT)
             {
+                flushOctreeNodes();
                 break;
             }
 
             if (jobData.type == SCheckOcclusionJobData::OCTREE_NODE)
             {
-                AABB    rAABB;
-                COctreeNode* pOctTreeNode = jobData.octTreeData.pOctTreeNode;
-
-                memcpy(&rAABB, &pOctTreeNode->GetObjectsBBox(), sizeof(AABB));
-                float fDistance = sqrtf(Distance::Point_AABBSq(passInfo.GetCamera().GetPosition(), rAABB));
-
-                // Test OctTree BoundingBox
-                if (TestAABB(rAABB, fDistance))
+                if (nOctreeNodesPerJob > 1)
                 {
-                    pOctTreeNode->COctreeNode::RenderContent(jobData.octTreeData.nRenderMask, passInfo, jobData.rendItemSorter, jobData.pCam);
-                    octreeNodesVisible++;
+                    octreeNodesBatch.push_back(jobData);
+                    if (octreeNodesBatch.size() >= nOctreeNodesPerJob)
+                    {
+                        flushOctreeNodes();
+                    }
                 }
                 else
                 {
-                    octreeNodesCulled++;
+                    testOctreeNodes(&jobData, 1, passInfo, false);
                 }
             }
             else if (jobData.type == SCheckOcclusionJobData::TERRAIN_NODE)
@@ -761,10 +817,13 @@ namespace NAsyncCull
             }
         }
 
+        // the batches have to finish before this producer is removed, otherwise the output queue could be drained early
+        octreeNodesJobExecutor.WaitForCompletion();
+
         if (GetCVars()->e_CoverageBufferDebug)
         {
             float fGreen[4] = {0, 1, 0, 1};
-            gEnv->pRenderer->Draw2dLabel(16.0f, 32.0f, 1.6f, fGreen, false, AZStd::string::format("Octree Nodes Culled %i, Octree Nodes Visible %i",octreeNodesCulled, octreeNodesVisible).c_str());
+            gEnv->pRenderer->Draw2dLabel(16.0f, 32.0f, 1.6f, fGreen, false, AZStd::string::format("Octree Nodes Culled %u, Octree Nodes Visible %u", octreeNodesCulled.load(), octreeNodesVisible.load()).c_str());
             gEnv->pRenderer->Draw2dLabel(16.0f, 64.0f, 1.6f, fGreen, false, AZStd::string::format("Terrain Nodes Culled %i, Terrain Nodes Visible %i",terrainNodesCulled, terrainNodesVisible).c_str());
         }
 
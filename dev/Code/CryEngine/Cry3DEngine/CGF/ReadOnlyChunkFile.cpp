@@ -200,8 +200,12 @@ bool CReadOnlyChunkFile::Read(const char* filename)
         if (gEnv->pCryPak->FReadRawAll(m_pFileBuffer, nFileSize, m_fileHandle) != nFileSize)
         {
             m_LastError.Format("Failed to read %u bytes from file '%s'", (uint)nFileSize, filename);
+            CloseFile();
             return false;
         }
+        // The whole file is in our own buffer now, don't hold the file open for as long as the chunks are in use.
+        // (FGetCachedFileData below is different, the cached data belongs to the open file.)
+        CloseFile();
     }
     else
     {
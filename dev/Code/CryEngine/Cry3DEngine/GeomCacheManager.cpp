@@ -326,7 +326,9 @@ void CGeomCacheManager::StreamingUpdate()
         // Update wanted playback frame
         CGeomCacheRenderNode* pRenderNode = streamInfo.m_pRenderNode;
         const CGeomCache* pGeomCache = streamInfo.m_pGeomCache;
+        const float lastWantedPlaybackTime = streamInfo.m_wantedPlaybackTime;
         streamInfo.m_wantedPlaybackTime = pRenderNode->GetPlaybackTime();
+        UpdatePlaybackSpeed(streamInfo, streamInfo.m_wantedPlaybackTime - lastWantedPlaybackTime);
         streamInfo.m_wantedFloorFrame = pGeomCache->GetFloorFrameIndex(streamInfo.m_wantedPlaybackTime);
         streamInfo.m_wantedCeilFrame = pGeomCache->GetCeilFrameIndex(streamInfo.m_wantedPlaybackTime);
         streamInfo.m_bLooping = streamInfo.m_pRenderNode->IsLooping();
@@ -372,7 +374,7 @@ void CGeomCacheManager::StreamingUpdate()
         {
             const uint requestStream = (nextRequestStream + i) % numStreams;
 
-            SGeomCacheStreamInfo& streamInfo = *m_streamInfos[i];
+            SGeomCacheStreamInfo& streamInfo = *m_streamInfos[requestStream];
             const CGeomCacheRenderNode* pRenderNode = streamInfo.m_pRenderNode;
             const bool bIsStreaming = pRenderNode->IsStreaming();
             const CGeomCache* pGeomCache = streamInfo.m_pGeomCache;
@@ -403,6 +405,28 @@ void CGeomCacheManager::StreamingUpdate()
 #endif
 }
 
+void CGeomCacheManager::UpdatePlaybackSpeed(SGeomCacheStreamInfo& streamInfo, const float playbackTimeDelta)
+{
+    const float frameTime = GetTimer()->GetFrameTime();
+    if (playbackTimeDelta < 0.0f || frameTime <= 0.0f)
+    {
+        // Seeking backwards restarts the stream, so forget the previous speed
+        streamInfo.m_playbackSpeed = 1.0f;
+        return;
+    }
+
+    // Smooth over a few frames so that a single scrub does not blow up the read ahead window
+    const float playbackSpeed = playbackTimeDelta / frameTime;
+    streamInfo.m_playbackSpeed += (playbackSpeed - streamInfo.m_playbackSpeed) * 0.1f;
+}
+
+float CGeomCacheManager::GetAheadTimeScale(const SGeomCacheStreamInfo& streamInfo)
+{
+    // Never shrink the windows below the real time settings, and cap growth so a fast scrub cannot monopolize the buffer
+    const float kMaxAheadTimeScale = 4.0f;
+    return clamp_tpl(streamInfo.m_playbackSpeed, 1.0f, kMaxAheadTimeScale);
+}
+
 void CGeomCacheManager::LaunchStreamingJobs(const uint numStreams, const CTimeValue currentFrameTime)
 {
     FUNCTION_PROFILER_3DENGINE;
@@ -706,8 +730,9 @@ bool CGeomCacheManager::IssueDiskReadRequest(SGeomCacheStreamInfo& streamInfo)
     const float currentCacheStreamingTime = streamInfo.m_pRenderNode->GetStreamingTime();
     const uint wantedFloorFrame = pGeomCache->GetFloorFrameIndex(currentCacheStreamingTime);
     const uint wantedCeilFrame = pGeomCache->GetCeilFrameIndex(currentCacheStreamingTime);
-    const float minBufferAheadTime = std::max(0.1f, GetCVars()->e_GeomCacheMinBufferAheadTime);
-    const float maxBufferAheadTime = std::max(1.0f, GetCVars()->e_GeomCacheMaxBufferAheadTime);
+    const float aheadTimeScale = GetAheadTimeScale(streamInfo);
+    const float minBufferAheadTime = std::max(0.1f, GetCVars()->e_GeomCacheMinBufferAheadTime) * aheadTimeScale;
+    const float maxBufferAheadTime = std::max(1.0f, GetCVars()->e_GeomCacheMaxBufferAheadTime) * aheadTimeScale;
     const float cacheMinBufferAhead = currentCacheStreamingTime + minBufferAheadTime;
     const float cacheMaxBufferAhead = currentCacheStreamingTime + maxBufferAheadTime;
 
@@ -817,7 +842,8 @@ bool CGeomCacheManager::IssueDiskReadRequest(SGeomCacheStreamInfo& streamInfo)
             streamInfo.m_pNewestReadRequestHandle = pRequestHandle;
         }
 
-        const float timeLeft = std::max(pGeomCache->GetFrameTime(frameRangeBegin) - currentCacheStreamingTime
+        // Deadline in real time, so cached frames are consumed faster than real time when playing back fast
+        const float timeLeft = std::max((pGeomCache->GetFrameTime(frameRangeBegin) - currentCacheStreamingTime) / aheadTimeScale
                 - static_cast<float>(GetCVars()->e_GeomCacheDecodeAheadTime), 0.0f);
 
         // Fill read request params
@@ -903,7 +929,7 @@ void CGeomCacheManager::LaunchDecompressJobs(SGeomCacheStreamInfo* pStreamInfo,
 
         // Stop decoding after e_GeomCacheDecodeAheadTime
         const float blockDeltaFromPlaybackTime = (pGeomCache->GetFrameTime(pReadRequestHandle->m_startFrame) - currentCacheStreamingTime);
-        const float decodeAheadTime = GetCVars()->e_GeomCacheDecodeAheadTime;
+        const float decodeAheadTime = GetCVars()->e_GeomCacheDecodeAheadTime * GetAheadTimeScale(*pStreamInfo);
         if (blockDeltaFromPlaybackTime > decodeAheadTime)
         {
             return;
@@ -104,6 +104,7 @@ struct SGeomCacheStreamInfo
         , m_numFrames(numFrames)
         , m_displayedFrameTime(-1.0f)
         , m_wantedPlaybackTime(0.0f)
+        , m_playbackSpeed(1.0f)
         , m_wantedFloorFrame(0)
         , m_wantedCeilFrame(0)
         , m_sameFrameFillCount(0)
@@ -125,6 +126,8 @@ struct SGeomCacheStreamInfo
 
     volatile float m_displayedFrameTime;
     volatile float m_wantedPlaybackTime;
+    // Smoothed cache seconds played per real second, used to scale the read and decode ahead windows
+    float m_playbackSpeed;
     volatile uint m_wantedFloorFrame;
     volatile uint m_wantedCeilFrame;
     volatile int m_sameFrameFillCount;
@@ -231,6 +234,8 @@ private:
     bool IssueDiskReadRequest(SGeomCacheStreamInfo& pStreamInfo);
 
     void LaunchStreamingJobs(const uint numStreams, const CTimeValue currentFrameTime);
+    void UpdatePlaybackSpeed(SGeomCacheStreamInfo& streamInfo, const float playbackTimeDelta);
+    static float GetAheadTimeScale(const SGeomCacheStreamInfo& streamInfo);
     void LaunchDecompressJobs(SGeomCacheStreamInfo* pStreamInfo, const CTimeValue currentFrameTime);
     void LaunchDecodeJob(SDecodeFrameJobData jobState);
 
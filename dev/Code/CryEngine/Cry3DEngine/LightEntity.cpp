@@ -1571,6 +1571,35 @@ void CLightEntity::OnCasterDeleted(IShadowCaster* pCaster)
     }
 }
 
+// Flags the cached frustums affected by a modified caster for a full update.
+// A frustum is affected if the caster was rendered into it (old position) or its new bounds overlap the frustum.
+// Returns false if no cached frustum exists yet.
+bool CLightEntity::OnCasterModified(IShadowCaster* pCaster, const AABB& casterBox)
+{
+    if (!m_pShadowMapInfo)
+    {
+        return false;
+    }
+
+    bool bHasCachedFrustums = false;
+    for (int nGsmId = 0; nGsmId < MAX_GSM_LODS_NUM; nGsmId++)
+    {
+        ShadowMapFrustum* pFr = m_pShadowMapInfo->pGSM[nGsmId];
+        if (pFr && pFr->IsCached() && pFr->pShadowCacheData)
+        {
+            bHasCachedFrustums = true;
+
+            ShadowMapFrustum::ShadowCacheData* pCacheData = pFr->pShadowCacheData;
+            if (pCacheData->mProcessedCasters.find(pCaster) != pCacheData->mProcessedCasters.end() || pFr->aabbCasters.IsIntersectBox(casterBox))
+            {
+                pCacheData->mFullUpdateRequested = true;
+            }
+        }
+    }
+
+    return bHasCachedFrustums;
+}
+
 void CLightEntity::GetMemoryUsage(ICrySizer* pSizer) const
 {
     SIZER_COMPONENT_NAME(pSizer, "LightEntity");
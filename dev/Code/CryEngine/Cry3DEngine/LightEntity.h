@@ -71,6 +71,7 @@ public:
     bool GetGsmFrustumBounds(const CCamera& viewFrustum, ShadowMapFrustum* pShadowFrustum);
     void DetectCastersListChanges(ShadowMapFrustum* pFr, const SRenderingPassInfo& passInfo);
     void OnCasterDeleted(IShadowCaster* pCaster);
+    bool OnCasterModified(IShadowCaster* pCaster, const AABB& casterBox);
     int MakeShadowCastersHullSun(PodArray<SPlaneObject>& lstCastersHull, const SRenderingPassInfo& passInfo);
     static Vec3 GSM_GetNextScreenEdge(float fPrevRadius, float fPrevDistanceFromView, const SRenderingPassInfo& passInfo);
     static float GSM_GetLODProjectionCenter(const Vec3& vEdgeScreen, float fRadius);
@@ -645,6 +645,7 @@ struct SMMRMGroupHeader
     bool specMismatch : 1; // True if this group's spec (low / med / high / etc) is too high for the min spec.
     bool splitGroup : 1;
     bool is_dynamic : 1;
+    bool needsPrepare : 1; // Instances changed after the node was streamed in, see CMergedMeshRenderNode::PrepareDirtyGroups
 # if MMRM_USE_BOUNDS_CHECK
     volatile int debugLock;
 # endif
@@ -667,6 +668,7 @@ struct SMMRMGroupHeader
         , specMismatch()
         , splitGroup()
         , is_dynamic(false)
+        , needsPrepare(false)
 #   if MMRM_USE_BOUNDS_CHECK
         , debugLock()
 #   endif
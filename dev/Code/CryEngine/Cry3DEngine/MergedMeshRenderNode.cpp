@@ -2281,6 +2281,7 @@ CMergedMeshRenderNode::CMergedMeshRenderNode()
     , m_needsPostRenderDynamic(0)
     , m_ownsGroups(1)
     , m_hasDynamicInstances(0)
+    , m_hasDirtyGroups(0)
 {
     memset(m_surface_types, 0x0, sizeof(m_surface_types));
     SetViewDistUnlimited();
@@ -2358,13 +2359,11 @@ bool CMergedMeshRenderNode::PrepareRenderMesh(RENDERMESH_UPDATE_TYPE type, int n
 {
     // Make sure that all preparation jobs have completed until then.    
     std::vector<size_t> groups(m_nGroups);
-    std::vector<SMMRM>& meshes = m_renderMeshes[type];
     std::iota(groups.begin(), groups.end(), 0);
     Vec3 extents = (m_visibleAABB.max - m_visibleAABB.min) * 0.5f;
     Vec3 origin  = m_pos - extents;
     bool allDone = true;
     Quat q;
-    int updateTypeValue = static_cast<int>(type);
 
     m_SpinesInitialized = false;
     // NOTE: This will get set to true inside of InitializeSpineAndDeformationData if any data is found to exist.
@@ -2407,65 +2406,139 @@ bool CMergedMeshRenderNode::PrepareRenderMesh(RENDERMESH_UPDATE_TYPE type, int n
                 break;
             }
         }
-        if (header && header->numSamples)
+        if (header)
         {
-            const SMMRMGeometry* procGeom = header->procGeom;
+            PrepareGroupRenderMesh(header, type);
+            header->needsPrepare = false;
+        }
+    }
+    m_SpinesInitialized = true;
+    return allDone;
+}
 
-            // Skip this group if not the correct type
-            header->is_dynamic = procGeom->numSpines > 0u;
-            if (static_cast<int>(header->is_dynamic) != updateTypeValue)
-            {
-                continue;
-            }
+void CMergedMeshRenderNode::PrepareGroupRenderMesh(SMMRMGroupHeader* header, RENDERMESH_UPDATE_TYPE type)
+{
+    std::vector<SMMRM>& meshes = m_renderMeshes[type];
+    const int updateTypeValue = static_cast<int>(type);
 
-            // Find the correct material for this group
-            _smart_ptr<IMaterial> material = procGeom->srcMaterial;
+    if (header->numSamples)
+    {
+        const SMMRMGeometry* procGeom = header->procGeom;
 
-            // See if there's a mesh that already uses this material. If not, create a new mesh for this material.
-            SMMRM* mesh = NULL;
-            for (std::size_t j = 0; j < meshes.size(); ++j)
-            {
-                if (meshes[j].mat == material)
-                {
-                    mesh = &meshes[j];
-                    break;
-                }
-            }
-            if (!mesh)
-            {
-                meshes.push_back(SMMRM());
-                mesh = &meshes.back();
-                mesh->mat = material;
-                mesh->chunks = procGeom->numChunks[0];
-            }
+        // Skip this group if not the correct type
+        header->is_dynamic = procGeom->numSpines > 0u;
+        if (static_cast<int>(header->is_dynamic) != updateTypeValue)
+        {
+            return;
+        }
 
-            resize_list(header->visibleChunks, header->numVisbleChunks = procGeom->numChunks[0], 16);
-            for (size_t j = 0; j < procGeom->numChunks[0]; ++j)
+        // Find the correct material for this group
+        _smart_ptr<IMaterial> material = procGeom->srcMaterial;
+
+        // See if there's a mesh that already uses this material. If not, create a new mesh for this material.
+        SMMRM* mesh = NULL;
+        for (std::size_t j = 0; j < meshes.size(); ++j)
+        {
+            if (meshes[j].mat == material)
             {
-                const SMMRMChunk& chunk = procGeom->pChunks[0][j];
-                mesh->hasTangents |= chunk.qtangents != nullptr;
-                mesh->hasNormals |= chunk.normals != nullptr;
+                mesh = &meshes[j];
+                break;
             }
         }
+        if (!mesh)
+        {
+            meshes.push_back(SMMRM());
+            mesh = &meshes.back();
+            mesh->mat = material;
+            mesh->chunks = procGeom->numChunks[0];
+        }
 
-        // If this node doesn't support streaming (in-Editor, or dynamic veg), we create spines and/or deformation data on demand here
-        if (!SupportsStreaming() && header && header->instances)
+        resize_list(header->visibleChunks, header->numVisbleChunks = procGeom->numChunks[0], 16);
+        for (size_t j = 0; j < procGeom->numChunks[0]; ++j)
         {
-            if (header->procGeom->numSpines)
-            {
-                resize_list(header->spines, header->numSamples * header->procGeom->numSpineVtx, 128);
-            }
+            const SMMRMChunk& chunk = procGeom->pChunks[0][j];
+            mesh->hasTangents |= chunk.qtangents != nullptr;
+            mesh->hasNormals |= chunk.normals != nullptr;
+        }
+    }
 
-            if (header->procGeom->deform)
-            {
-                resize_list(header->deform_vertices, header->numSamples * header->procGeom->deform->nvertices, 16);
-            }
+    // If this node doesn't support streaming (in-Editor, or dynamic veg), we create spines and/or deformation data on demand here
+    if (!SupportsStreaming() && header->instances)
+    {
+        if (header->procGeom->numSpines)
+        {
+            resize_list(header->spines, header->numSamples * header->procGeom->numSpineVtx, 128);
+        }
 
-            InitializeSpineAndDeformationData(header);
+        if (header->procGeom->deform)
+        {
+            resize_list(header->deform_vertices, header->numSamples * header->procGeom->deform->nvertices, 16);
         }
+
+        InitializeSpineAndDeformationData(header);
     }
-    m_SpinesInitialized = true;
-    return allDone;
+}
+
+void CMergedMeshRenderNode::InvalidateGroup(size_t headerIndex)
+{
+    // A node that owns its instance data (editor or dynamic vegetation) can re-prepare just the touched group
+    // once it is streamed in. Anything else goes through the full DIRTY rebuild.
+    if (m_State == STREAMED_IN && !SupportsStreaming() && GetCVars()->e_MergedMeshesIncrementalUpdate)
+    {
+        m_groups[headerIndex].needsPrepare = true;
+        m_hasDirtyGroups = true;
+    }
+    else
+    {
+        m_State = DIRTY;
+    }
+}
+
+bool CMergedMeshRenderNode::PrepareDirtyGroups()
+{
+    if (!SyncAllJobs())
+    {
+        return false;
+    }
+
+    bool passDirty[RUT_NUM_UPDATE_TYPES] = { false, false };
+    for (size_t i = 0; i < m_nGroups; ++i)
+    {
+        SMMRMGroupHeader* header = &m_groups[i];
+        if (!header->needsPrepare)
+        {
+            continue;
+        }
+
+        // The group's geometry must be ready, otherwise fall back to the full preparation path.
+        if (header->procGeom->geomPrepareJobExecutor.IsRunning() || header->procGeom->state != SMMRMGeometry::PREPARED)
+        {
+            m_State = DIRTY;
+            break;
+        }
+
+        // The pass is rebuilt even if the group is now empty, so its last instances drop out of the merged mesh.
+        const RENDERMESH_UPDATE_TYPE type = header->procGeom->numSpines > 0u ? RUT_DYNAMIC : RUT_STATIC;
+        PrepareGroupRenderMesh(header, type);
+        passDirty[type] = true;
+        header->needsPrepare = false;
+    }
+
+    if (m_State == DIRTY)
+    {
+        return false;
+    }
+
+    // Only the passes owning a touched group are re-culled and rebuilt.
+    for (int pass = 0; pass < RUT_NUM_UPDATE_TYPES; ++pass)
+    {
+        if (passDirty[pass])
+        {
+            m_nLod[pass] = s_lodNotSet;
+        }
+    }
+    m_hasDirtyGroups = false;
+    return true;
 }
 
 bool CMergedMeshRenderNode::Setup(const AABB& aabb, const AABB& visAbb, const PodArray<SProcVegSample>* samples)
@@ -2620,7 +2693,7 @@ IRenderNode* CMergedMeshRenderNode::AddInstance(const SProcVegSample& sample, bo
     assert (m_internalAABB.IsContainPoint(sample.pos));
 
     ++m_Instances;
-    m_State = DIRTY;
+    InvalidateGroup(headerIndex);
 
     if (gEnv->IsDynamicMergedMeshGenerationEnabled())
     {
@@ -2690,7 +2763,7 @@ size_t CMergedMeshRenderNode::RemoveInstance(size_t headerIndex, size_t instance
         header->deform_vertices = NULL;
     }
 
-    m_State = DIRTY;
+    InvalidateGroup(headerIndex);
     return --m_Instances;
 }
 
@@ -3213,6 +3286,7 @@ void CMergedMeshRenderNode::Render(const struct SRendParams& EntDrawParams, cons
         DeleteRenderMesh(RUT_STATIC);
         m_renderMeshes[RUT_STATIC].clear();
         m_nLod[RUT_STATIC] = m_nLod[RUT_DYNAMIC] = s_lodNotSet;
+        m_hasDirtyGroups = false;
         m_State = PREPARING;
     case PREPARING:
         // We can't do anything if the prepping stage is still running
@@ -3223,6 +3297,11 @@ void CMergedMeshRenderNode::Render(const struct SRendParams& EntDrawParams, cons
         m_State = PREPARED;
         break;
     case STREAMED_IN:
+        // Instances were added or removed since streaming in; wait for running jobs before touching the groups
+        if (m_hasDirtyGroups && !PrepareDirtyGroups())
+        {
+            break;
+        }
         for (signed pass = 0; pass < 2; ++pass)
         {
             switch (m_RenderMode)
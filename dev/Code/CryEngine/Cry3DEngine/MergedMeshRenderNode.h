@@ -310,6 +310,9 @@ class CMergedMeshRenderNode
     // If the node owns an instance that is controlled by the Dynamic Vegetation system
     unsigned int m_hasDynamicInstances : 1;
 
+    // If groups were changed in place since streaming in and need PrepareDirtyGroups before the next cull
+    unsigned int m_hasDirtyGroups : 1;
+
     // The render state
     enum RenderMode
     {
@@ -496,6 +499,11 @@ public:
     // because DECLARE_CLASS_JOB macros only work on public methods.
     bool PrepareRenderMesh(RENDERMESH_UPDATE_TYPE, int nLod = 0);
 
+    // Incremental counterpart of PrepareRenderMesh for groups touched by AddInstance / RemoveInstance
+    void PrepareGroupRenderMesh(SMMRMGroupHeader* header, RENDERMESH_UPDATE_TYPE type);
+    void InvalidateGroup(size_t headerIndex);
+    bool PrepareDirtyGroups();
+
     // Compile the instance data into a streamable chunk
     bool Compile(byte* pData, int& nSize, string* pName, std::vector<struct IStatInstGroup*>* pVegGroupTable);
 
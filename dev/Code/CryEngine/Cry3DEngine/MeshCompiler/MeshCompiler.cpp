@@ -941,7 +941,7 @@ namespace mesh_compiler
 
         if (flags & MESH_COMPILE_OPTIMIZE)
         {
-            const bool bOk = StripifyMesh_Forsyth(outMesh);
+            const bool bOk = StripifyMesh_Forsyth(outMesh, (flags & MESH_COMPILE_OPTIMIZE_OVERDRAW) != 0);
             if (!bOk)
             {
                 m_LastError.Format("Mesh compilation failed - stripifier failed. Contact an RC programmer.");
@@ -983,7 +983,104 @@ namespace mesh_compiler
     }
 
 
-    bool CMeshCompiler::StripifyMesh_Forsyth(CMesh& mesh)
+    // Splits cache-optimized triangle list into clusters (a new cluster starts where the simulated
+    // FIFO vertex cache gets flushed, i.e. a triangle misses all its vertices) and sorts clusters
+    // so the ones facing away from the mesh center are drawn first (see "Tipsify", Sander et al.).
+    // Triangle order within a cluster is kept, so vertex cache efficiency is mostly unaffected.
+    static void OrderFaceClustersForOverdraw(const Vec3* pPositions, int indexCount, uint32* pIndices, size_t cacheSize, std::vector<uint32>& tmpIndices)
+    {
+        enum
+        {
+            kMinFacesInCluster = 64
+        };
+
+        const int faceCount = indexCount / 3;
+        if (!pPositions || faceCount < 2 * kMinFacesInCluster)
+        {
+            return;
+        }
+
+        uint32 vertexCount = 0;
+        for (int i = 0; i < indexCount; ++i)
+        {
+            vertexCount = max(vertexCount, pIndices[i] + 1);
+        }
+
+        // Find cluster boundaries
+        std::vector<int> clusterFirstFace;
+        clusterFirstFace.push_back(0);
+        {
+            // cacheTime[v] is the value of cacheInsertions when v was placed into FIFO cache
+            std::vector<int> cacheTime(vertexCount, INT_MIN / 2);
+            int cacheInsertions = 0;
+
+            for (int f = 0; f < faceCount; ++f)
+            {
+                int misses = 0;
+                for (int k = 0; k < 3; ++k)
+                {
+                    const uint32 v = pIndices[f * 3 + k];
+                    if (cacheInsertions - cacheTime[v] >= (int)cacheSize)
+                    {
+                        cacheTime[v] = cacheInsertions++;
+                        ++misses;
+                    }
+                }
+                if (misses == 3 && f - clusterFirstFace.back() >= kMinFacesInCluster)
+                {
+                    clusterFirstFace.push_back(f);
+                }
+            }
+        }
+
+        const int clusterCount = (int)clusterFirstFace.size();
+        if (clusterCount < 2)
+        {
+            return;
+        }
+        clusterFirstFace.push_back(faceCount);
+
+        // Compute per-cluster centroids and (area-weighted) normals
+        std::vector<Vec3> clusterCenter(clusterCount, Vec3(ZERO));
+        std::vector<Vec3> clusterNormal(clusterCount, Vec3(ZERO));
+        Vec3 meshCenter(ZERO);
+
+        for (int c = 0; c < clusterCount; ++c)
+        {
+            for (int f = clusterFirstFace[c]; f < clusterFirstFace[c + 1]; ++f)
+            {
+                const Vec3& p0 = pPositions[pIndices[f * 3 + 0]];
+                const Vec3& p1 = pPositions[pIndices[f * 3 + 1]];
+                const Vec3& p2 = pPositions[pIndices[f * 3 + 2]];
+                clusterCenter[c] += p0 + p1 + p2;
+                clusterNormal[c] += (p1 - p0).Cross(p2 - p0);
+            }
+            meshCenter += clusterCenter[c];
+            clusterCenter[c] /= (float)(3 * (clusterFirstFace[c + 1] - clusterFirstFace[c]));
+        }
+        meshCenter /= (float)(3 * faceCount);
+
+        std::vector<std::pair<float, int> > order(clusterCount);
+        for (int c = 0; c < clusterCount; ++c)
+        {
+            order[c].first = -(clusterCenter[c] - meshCenter).Dot(clusterNormal[c].GetNormalizedSafe(Vec3(ZERO)));
+            order[c].second = c;
+        }
+        std::stable_sort(order.begin(), order.end());
+
+        tmpIndices.assign(pIndices, pIndices + faceCount * 3);
+        uint32* pDst = pIndices;
+        for (int i = 0; i < clusterCount; ++i)
+        {
+            const int c = order[i].second;
+            const int first = clusterFirstFace[c] * 3;
+            const int count = (clusterFirstFace[c + 1] - clusterFirstFace[c]) * 3;
+            memcpy(pDst, &tmpIndices[first], sizeof(pDst[0]) * count);
+            pDst += count;
+        }
+    }
+
+    bool CMeshCompiler::StripifyMesh_Forsyth(CMesh& mesh, bool bOptimizeOverdraw)
     {
         if (mesh.GetFaceCount() > 0)
         {
@@ -1025,6 +1122,7 @@ namespace mesh_compiler
         ForsythFaceReorderer ffr;
         std::vector<uint32> buffer0;
         std::vector<uint32> buffer1;
+        std::vector<uint32> clusterBuffer;
 
         // Reserve space
         //
@@ -1136,6 +1234,13 @@ namespace mesh_compiler
                 return false;
             }
 
+            // Index map stores per-index original vertices in the original face order,
+            // so we keep the face order produced by the reorderer when it's requested
+            if (bOptimizeOverdraw && !m_pIndexMap)
+            {
+                OrderFaceClustersForOverdraw(mesh.m_pPositions + subsetMinIndex, subset.nNumIndices, &buffer1[0], cacheSize, clusterBuffer);
+            }
+
             // Reorder vertices
 
             SMeshSubset& newSubset = newMesh.m_subsets[i];
@@ -1218,6 +1323,7 @@ namespace mesh_compiler
         // TODO: make those variables members of CMeshCompiler so we don't need to allocate memory every time
         std::vector<uint32> buffer0;
         std::vector<uint32> buffer1;
+        std::vector<uint32> clusterBuffer;
 
         // Reserve space
         //
@@ -31,6 +31,11 @@ namespace mesh_compiler
         MESH_COMPILE_PVR_STRIPIFY = BIT(5),
 
         MESH_COMPILE_VALIDATE_FAIL_ON_DEGENERATE_FACES = BIT(6),
+
+        // Together with MESH_COMPILE_OPTIMIZE: after the vertex cache optimization, orders clusters of
+        // triangles so that outward facing ones are drawn first, to reduce overdraw.
+        // Costs an extra pass over the mesh, so it's meant for offline (RC) compilation.
+        MESH_COMPILE_OPTIMIZE_OVERDRAW = BIT(7),
     };
 
     //////////////////////////////////////////////////////////////////////////
@@ -208,7 +213,7 @@ namespace mesh_compiler
 
     private:
         bool CreateIndicesAndDeleteDuplicateVertices(CMesh& mesh);
-        bool StripifyMesh_Forsyth(CMesh& mesh);
+        bool StripifyMesh_Forsyth(CMesh& mesh, bool bOptimizeOverdraw);
         bool StripifyMesh_PVRTriStripList(CMesh& mesh);
 
     public:
@@ -16,6 +16,7 @@
 #include "ParticleContainerGPU.h"
 #include "ParticleEmitter.h"
 #include "Particle.h"
+#include <AzCore/Jobs/LegacyJobExecutor.h>
 
 #define fMAX_STATIC_BB_RADIUS                   4096.f  // Static bounding box above this size forces dynamic BB
 #define fMAX_RELATIVE_TAIL_DEVIATION    0.1f
@@ -758,6 +759,14 @@ void CParticleContainer::UpdateParticleStates(SParticleUpdateContext& context)
         context.aParticleSort.set(aParticleSort, nMaxParticles);
     }
 
+    // Large containers of independent particles are moved in job-sized chunks first; the loop below then only culls and sorts.
+    const int nParticlesPerJob = GetCVars()->e_ParticlesUpdateJobSize;
+    const bool bUpdatedInJobs = nParticlesPerJob > 0 && (int)m_Particles.size() > nParticlesPerJob && CanUpdateParticlesInJobs(context);
+    if (bUpdatedInJobs)
+    {
+        UpdateParticleStatesInJobs(context, nParticlesPerJob);
+    }
+
     SParticleUpdateContext::SSortElem* pElem = context.aParticleSort.begin();
 #define ERASE_PARTICLE(pPart) if (pPart->NumRefs() == 0) \
     {                                                    \
@@ -772,7 +781,10 @@ void CParticleContainer::UpdateParticleStates(SParticleUpdateContext& context)
     for (ParticleList<CParticle>::iterator pPart(m_Particles); pPart; )
     {
         // Update the particle before the IsAlive check so it can be removed immediately if it is killed by the update
-        pPart->Update(context, context.fUpdateTime);
+        if (!bUpdatedInJobs)
+        {
+            pPart->Update(context, context.fUpdateTime);
+        }
 
         if (!pPart->IsAlive(fLifetimeCheck))
         {
@@ -809,6 +821,73 @@ void CParticleContainer::UpdateParticleStates(SParticleUpdateContext& context)
     UpdateEmitters(&context);
 }
 
+bool CParticleContainer::CanUpdateParticlesInJobs(const SParticleUpdateContext& context) const
+{
+    // Particles can be moved concurrently only if their update touches nothing but their own state:
+    // no physical entities or collision queries, no writes back to the emitter, and no stats gathering.
+    const ResourceParticleParams& params = GetParams();
+    return params.ePhysicsType == params.ePhysicsType.None
+           && !(context.nEnvFlags & ENV_COLLIDE_ANY)
+           && params.eMoveRelEmitter == ParticleParams::EMoveRelative::E::No
+           && !GetCVars()->e_ParticlesDebug;
+}
+
+void CParticleContainer::UpdateParticleStatesInJobs(const SParticleUpdateContext& context, int nParticlesPerJob)
+{
+    FUNCTION_PROFILER_CONTAINER(this);
+
+    const int nChunks = ((int)m_Particles.size() + nParticlesPerJob - 1) / nParticlesPerJob;
+    STACK_ARRAY(CParticle*, aChunkStart, nChunks);
+    STACK_ARRAY(AABB, aChunkBounds, nChunks);
+
+    int nChunk = 0, nInChunk = 0;
+    for (CParticle* pPart = m_Particles.begin(); pPart; pPart = m_Particles.next(pPart))
+    {
+        if (nInChunk == 0)
+        {
+            aChunkStart[nChunk] = pPart;
+            aChunkBounds[nChunk].Reset();
+        }
+        if (++nInChunk == nParticlesPerJob)
+        {
+            nChunk++;
+            nInChunk = 0;
+        }
+    }
+
+    // Each chunk accumulates its own dynamic bounds, merged once all jobs are done.
+    AZ::LegacyJobExecutor jobExecutor;
+    for (int c = 0; c < nChunks; c++)
+    {
+        jobExecutor.StartJob([&context, &aChunkStart, &aChunkBounds, c, nParticlesPerJob]()
+        {
+            SParticleUpdateContext chunkContext = context;
+            if (context.pbbDynamicBounds)
+            {
+                chunkContext.pbbDynamicBounds = &aChunkBounds[c];
+            }
+
+            CParticle* pPart = aChunkStart[c];
+            for (int i = 0; i < nParticlesPerJob && pPart; i++, pPart = ParticleList<CParticle>::next(pPart))
+            {
+                pPart->Update(chunkContext, chunkContext.fUpdateTime);
+            }
+        });
+    }
+    jobExecutor.WaitForCompletion();
+
+    if (context.pbbDynamicBounds)
+    {
+        for (int c = 0; c < nChunks; c++)
+        {
+            if (!aChunkBounds[c].IsReset())
+            {
+                context.pbbDynamicBounds->Add(aChunkBounds[c]);
+            }
+        }
+    }
+}
+
 void CParticleContainer::UpdateEmitters(SParticleUpdateContext* pUpdateContext)
 {
     for_all_ptrs(CParticleSubEmitter, e, m_Emitters)
@@ -333,6 +333,8 @@ private:
     float GetEmitterLife() const;
     int GetMaxParticleCount(const SParticleUpdateContext& context) const;
     void UpdateParticleStates(SParticleUpdateContext& context);
+    bool CanUpdateParticlesInJobs(const SParticleUpdateContext& context) const;
+    void UpdateParticleStatesInJobs(const SParticleUpdateContext& context, int nParticlesPerJob);
     void SetScreenBounds(const CCamera& cam, uint8 aScreenBounds[4]);
 };
 
@@ -23,9 +23,17 @@ void ShadowCache::InitShadowFrustum(ShadowMapFrustum*& pFr, int nLod, int nFirst
     FUNCTION_PROFILER_3DENGINE;
     assert(nLod >= 0);
 
+    ShadowMapFrustum::ShadowCacheData::eUpdateStrategy nUpdateStrategy = m_nUpdateStrategy;
+
+    // A modified caster invalidated this cascade only (see CLightEntity::OnCasterModified)
+    if (pFr && pFr->pShadowCacheData && pFr->pShadowCacheData->mFullUpdateRequested)
+    {
+        nUpdateStrategy = ShadowMapFrustum::ShadowCacheData::eFullUpdate;
+    }
+
     // If we only allow updates via script, then early out here.
     // When script triggers an update, m_nUpdateStrategy will be set to ShadowMapFrustum::ShadowCacheData::eFullUpdate for a single frame to process a full cached shadow update
-    if ( m_nUpdateStrategy == ShadowMapFrustum::ShadowCacheData::eManualUpdate )
+    if ( nUpdateStrategy == ShadowMapFrustum::ShadowCacheData::eManualUpdate )
     {
         return;
     }
@@ -50,7 +58,6 @@ void ShadowCache::InitShadowFrustum(ShadowMapFrustum*& pFr, int nLod, int nFirst
     }
     
     // Check if we both allow updates if the user moves too close to the border of the shadow map and if we have come too close to said border
-    ShadowMapFrustum::ShadowCacheData::eUpdateStrategy nUpdateStrategy = m_nUpdateStrategy;
     bool allowDistanceBasedUpdates = nUpdateStrategy == ShadowMapFrustum::ShadowCacheData::eManualOrDistanceUpdate || nUpdateStrategy == ShadowMapFrustum::ShadowCacheData::eIncrementalUpdate;
     if (allowDistanceBasedUpdates && Get3DEngine()->m_CachedShadowsBounds.IsReset())
     {
@@ -212,6 +219,10 @@ void ShadowCache::InitHeightMapAOFrustum(ShadowMapFrustum*& pFr, int nLod, const
     static ICVar* pHeightMapAORange = gEnv->pConsole->GetCVar("r_HeightMapAORange");
 
     ShadowMapFrustum::ShadowCacheData::eUpdateStrategy nUpdateStrategy = m_nUpdateStrategy;
+    if (pFr->pShadowCacheData->mFullUpdateRequested)
+    {
+        nUpdateStrategy = ShadowMapFrustum::ShadowCacheData::eFullUpdate;
+    }
 
     // check if we have come too close to the border of the map
     const float fDistFromCenter = (passInfo.GetCamera().GetPosition() - pFr->aabbCasters.GetCenter()).GetLength() + pHeightMapAORange->GetFVal() * 0.25f;
@@ -197,6 +197,7 @@ CTimeOfDay::CTimeOfDay()
     SetTimer(gEnv->pTimer);
     m_fTime = 12;
     m_fEditorTime = 12;
+    m_fLastUpdateTime = -1.0f;
     m_bEditMode = false;
 
     m_advancedInfo.fAnimSpeed = 0;
@@ -409,6 +410,7 @@ void CTimeOfDay::Update(bool bInterpolate, bool bForceUpdate, bool bEnvUpdate)
 
         // normalized time for interpolation
         float t = m_fTime / s_maxTime;
+        m_fLastUpdateTime = m_fTime;
 
         // interpolate all values
         for (uint32 i = 0; i < static_cast<uint32>(GetVariableCount()); i++)
@@ -1190,6 +1192,15 @@ void CTimeOfDay::Tick()
                 }
             }
 
+            // With a slowly running day cycle the parameters don't change visibly from one frame to the next, so
+            // they are only interpolated and pushed to the environment once the time moved by e_TimeOfDayUpdateStep
+            if (fabs(fTime - m_fLastUpdateTime) < Cry3DEngineBase::GetCVars()->e_TimeOfDayUpdateStep)
+            {
+                m_fTime = fTime;
+                Cry3DEngineBase::GetCVars()->e_TimeOfDay = m_fTime;
+                return;
+            }
+
             SetTime(fTime);
         }
     }
@@ -112,6 +112,7 @@ private:
     std::map<const char*, int, stl::less_strcmp<const char*> >  m_varsMap;
     float                                                     m_fTime;
     float                                                     m_fEditorTime;
+    float                                                     m_fLastUpdateTime;
     float                                                     m_sunRotationLatitude;
     float                                                     m_sunRotationLongitude;
 
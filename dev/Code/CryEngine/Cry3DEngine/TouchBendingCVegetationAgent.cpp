@@ -308,7 +308,8 @@ namespace AZ
         const AABB &bbox = pStatObjFoliage->m_worldAabb;
         int clipDist = GetCVars()->e_CullVegActivation;
         bool bVisible = rCamera.IsAABBVisible_E(bbox);
-        bool bEnable = bVisible && isneg(((rCamera.GetPosition() - bbox.GetCenter()).len2() - sqr(clipDist)) * clipDist - 0.0001f);
+        const float distToCameraSq = (rCamera.GetPosition() - bbox.GetCenter()).len2();
+        bool bEnable = bVisible && isneg((distToCameraSq - sqr(clipDist)) * clipDist - 0.0001f);
         if (!bEnable)
         {
             if (inrange(pStatObjFoliage->m_timeInvisible += dt, 6.0f, 8.0f))
@@ -321,6 +322,17 @@ namespace AZ
             pStatObjFoliage->m_timeInvisible = 0.0f;
         }
 
+        //Simulation LOD: far away skeletons that nothing touched for a while are taken out of the PhysX scene
+        //and keep their last pose, so only the bendables close to the camera or being walked through are simulated.
+        //m_timeIdle is reset below as soon as the trigger reports a touch again, which brings the skeleton back.
+        const float simDist = GetCVars()->e_FoliageTouchBendingSimDist;
+        const bool bFrozen = bEnable && simDist > 0.0f && distToCameraSq > sqr(simDist) &&
+            pStatObjFoliage->m_timeIdle > GetCVars()->e_FoliageTouchBendingSettleTime;
+        if (bFrozen)
+        {
+            bEnable = false;
+        }
+
         pStatObjFoliage->m_bEnabled = bEnable;
         AZ::u32 boneCount = 0;
         AZ::u32 touchCount = 0;
@@ -335,6 +347,12 @@ namespace AZ
             *pStatObjFoliage->m_ppThis = nullptr;
             pStatObjFoliage->m_bDelete = 2;
         }
+        if (bFrozen && pStatObjFoliage->m_pSkinningTransformations[0])
+        {
+            //The pose from the last simulated frame is still in the skinning buffers.
+            return;
+        }
+
         threadID nThreadID = 0;
         gEnv->pRenderer->EF_Query(EFQ_MainThreadList, nThreadID);
 
@@ -408,6 +408,19 @@ void CVegetation::Render(const SRenderingPassInfo& passInfo, const CLodValue& lo
     }
     pStatObj->RenderInternal(pRenderObject, 0, lodValue, passInfo, rendItemSorter, false);
 
+    if (m_pInstancingInfo)
+    {
+        // The other vegetations of the static instancing group are not culled on their own (ERF_STATIC_INSTANCING).
+        // They share this object's visibility, lod and render state and only differ by their transform, so their render
+        // items end up next to each other with the same render element and the renderer draws them with geometry instancing.
+        for (int i = 1; i < m_pInstancingInfo->Count(); ++i)
+        {
+            CRenderObject* pInstanceObject = GetRenderer()->EF_DuplicateRO(pRenderObject, passInfo);
+            pInstanceObject->m_II.m_Matrix = (*m_pInstancingInfo)[i].m_MatInst;
+            pStatObj->RenderInternal(pInstanceObject, 0, lodValue, passInfo, rendItemSorter, false);
+        }
+    }
+
     if (m_pDeformable)
     {
         m_pDeformable->RenderInternalDeform(pRenderObject, lodValue.LodA(), GetBBox(), passInfo, rendItemSorter);
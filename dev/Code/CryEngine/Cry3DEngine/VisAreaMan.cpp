@@ -1066,6 +1066,7 @@ void CVisAreaManager::UpdateConnections()
     for (int p = 0; p < m_lstPortals.Count(); p++)
     {
         m_lstPortals[p]->m_lstConnections.Clear();
+        m_lstPortals[p]->ResetPortalVertsCache();
     }
 
     for (int v = 0; v < m_lstVisAreas.Count(); v++)
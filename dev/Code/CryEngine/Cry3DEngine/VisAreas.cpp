@@ -77,6 +77,8 @@ void CVisArea::Update(const Vec3* pPoints, int nCount, const char* szName, const
         m_boxArea.min.CheckMin(pPoints[i] + Vec3(0, 0, m_fHeight));
     }
 
+    ResetPortalVertsCache();
+
     UpdateGeometryBBox();
     UpdateClipVolume();
 }
@@ -122,6 +124,7 @@ void CVisArea::Init()
     m_nVisGUID = 0;
     m_fPortalBlending = 0.5f;
     m_nStencilRef = 0;
+    ResetPortalVertsCache();
 }
 
 CVisArea::CVisArea()
@@ -382,6 +385,94 @@ void CVisArea::UpdatePortalCameraPlanes(CCamera& cam, Vec3* pVerts, bool NotForc
 
 int __cdecl CVisAreaManager__CmpDistToPortal(const void* v1, const void* v2);
 
+CVisArea::SPortalVertsCache* CVisArea::GetPortalVertsCache(CVisArea* pParent)
+{
+    if (!pParent)
+    {
+        return &m_arrPortalVertsCache[0];
+    }
+    for (int i = 0; i < m_lstConnections.Count() && i < 2; i++)
+    {
+        if (m_lstConnections[i] == pParent)
+        {
+            return &m_arrPortalVertsCache[i + 1];
+        }
+    }
+    return NULL;
+}
+
+void CVisArea::ResetPortalVertsCache()
+{
+    for (uint32 i = 0; i < sizeof(m_arrPortalVertsCache) / sizeof(m_arrPortalVertsCache[0]); i++)
+    {
+        m_arrPortalVertsCache[i].bComputed = false;
+    }
+}
+
+// finds the quad of a basic (upright) portal on the side of pParent (or outdoors) and on the other side
+bool CVisArea::CalcBasicPortalVerts(CVisArea* pParent, Vec3* arrPortVerts, Vec3* arrPortVertsOtherSide)
+{
+    Vec3 arrInAreaPoint[2] = {Vec3(0, 0, 0), Vec3(0, 0, 0)};
+    int arrInAreaPointId[2] = {-1, -1};
+    int nInAreaPointCounter = 0;
+
+    Vec3 arrOutAreaPoint[2] = {Vec3(0, 0, 0), Vec3(0, 0, 0)};
+    int nOutAreaPointCounter = 0;
+
+    // find 2 points of portal in this area (or in this outdoors)
+    for (int i = 0; i < m_lstShapePoints.Count() && nInAreaPointCounter < 2; i++)
+    {
+        Vec3 vTestPoint = m_lstShapePoints[i] + Vec3(0, 0, m_fHeight * 0.5f);
+        CVisArea* pAnotherArea = m_lstConnections[0];
+        if ((pParent && (pParent->IsPointInsideVisArea(vTestPoint))) ||
+            (!pParent && (!pAnotherArea->IsPointInsideVisArea(vTestPoint))))
+        {
+            arrInAreaPointId[nInAreaPointCounter] = i;
+            arrInAreaPoint[nInAreaPointCounter++] = m_lstShapePoints[i];
+        }
+    }
+
+    // find 2 points of portal not in this area (or not in this outdoors)
+    for (int i = 0; i < m_lstShapePoints.Count() && nOutAreaPointCounter < 2; i++)
+    {
+        Vec3 vTestPoint = m_lstShapePoints[i] + Vec3(0, 0, m_fHeight * 0.5f);
+        CVisArea* pAnotherArea = m_lstConnections[0];
+        if ((pParent && (pParent->IsPointInsideVisArea(vTestPoint))) ||
+            (!pParent && (!pAnotherArea->IsPointInsideVisArea(vTestPoint))))
+        {
+        }
+        else
+        {
+            arrOutAreaPoint[nOutAreaPointCounter++] = m_lstShapePoints[i];
+        }
+    }
+
+    if (nInAreaPointCounter == 2)
+    { // success, take into account volume and portal shape versts order
+        int nEven = IsShapeClockwise();
+        if (arrInAreaPointId[1] - arrInAreaPointId[0] != 1)
+        {
+            nEven = !nEven;
+        }
+
+        arrPortVerts[0] = arrInAreaPoint[nEven];
+        arrPortVerts[1] = arrInAreaPoint[nEven] + Vec3(0, 0, m_fHeight);
+        arrPortVerts[2] = arrInAreaPoint[!nEven] + Vec3(0, 0, m_fHeight);
+        arrPortVerts[3] = arrInAreaPoint[!nEven];
+
+        nEven = !nEven;
+
+        arrPortVertsOtherSide[0] = arrOutAreaPoint[nEven];
+        arrPortVertsOtherSide[1] = arrOutAreaPoint[nEven] + Vec3(0, 0, m_fHeight);
+        arrPortVertsOtherSide[2] = arrOutAreaPoint[!nEven] + Vec3(0, 0, m_fHeight);
+        arrPortVertsOtherSide[3] = arrOutAreaPoint[!nEven];
+        return true;
+    }
+
+    return false;
+}
+
+
 void CVisArea::PreRender(int nReqursionLevel,
     CCamera CurCamera, CVisArea* pParent, CVisArea* pCurPortal,
     bool* pbOutdoorVisible, PodArray<CCamera>* plstOutPortCameras, bool* pbSkyVisible, bool* pbOceanVisible,
@@ -500,67 +591,30 @@ void CVisArea::PreRender(int nReqursionLevel,
         }
         else if (!vPortNorm.IsEquivalent(Vec3(0, 0, 0), VEC_EPSILON)    && vPortNorm.z == 0)
         { // basic portal
-            Vec3 arrInAreaPoint[2] = {Vec3(0, 0, 0), Vec3(0, 0, 0)};
-            int arrInAreaPointId[2] = {-1, -1};
-            int nInAreaPointCounter = 0;
-
-            Vec3 arrOutAreaPoint[2] = {Vec3(0, 0, 0), Vec3(0, 0, 0)};
-            int nOutAreaPointCounter = 0;
-
-            // find 2 points of portal in this area (or in this outdoors)
-            for (int i = 0; i < m_lstShapePoints.Count() && nInAreaPointCounter < 2; i++)
+            // the portal quad only depends on the shapes and on the area we come from, not on the camera
+            SPortalVertsCache* pCache = GetPortalVertsCache(pParent);
+            if (!pCache || !pCache->bComputed)
             {
-                Vec3 vTestPoint = m_lstShapePoints[i] + Vec3(0, 0, m_fHeight * 0.5f);
-                CVisArea* pAnotherArea = m_lstConnections[0];
-                if ((pParent && (pParent->IsPointInsideVisArea(vTestPoint))) ||
-                    (!pParent && (!pAnotherArea->IsPointInsideVisArea(vTestPoint))))
-                {
-                    arrInAreaPointId[nInAreaPointCounter] = i;
-                    arrInAreaPoint[nInAreaPointCounter++] = m_lstShapePoints[i];
+                SPortalVertsCache tmpCache;
+                SPortalVertsCache& cache = pCache ? *pCache : tmpCache;
+                cache.bValid = CalcBasicPortalVerts(pParent, cache.arrPortVerts, cache.arrPortVertsOtherSide);
+                cache.bComputed = true;
+                pCache = &cache;
+
+                if (!pCache->bValid)
+                { // something wrong
+                    Warning("CVisArea::PreRender: Invalid portal: %s", m_pVisAreaColdData->m_sName);
                 }
             }
 
-            // find 2 points of portal not in this area (or not in this outdoors)
-            for (int i = 0; i < m_lstShapePoints.Count() && nOutAreaPointCounter < 2; i++)
+            if (!pCache->bValid)
             {
-                Vec3 vTestPoint = m_lstShapePoints[i] + Vec3(0, 0, m_fHeight * 0.5f);
-                CVisArea* pAnotherArea = m_lstConnections[0];
-                if ((pParent && (pParent->IsPointInsideVisArea(vTestPoint))) ||
-                    (!pParent && (!pAnotherArea->IsPointInsideVisArea(vTestPoint))))
-                {
-                }
-                else
-                {
-                    arrOutAreaPoint[nOutAreaPointCounter++] = m_lstShapePoints[i];
-                }
-            }
-
-            if (nInAreaPointCounter == 2)
-            { // success, take into account volume and portal shape versts order
-                int nEven = IsShapeClockwise();
-                if (arrInAreaPointId[1] - arrInAreaPointId[0] != 1)
-                {
-                    nEven = !nEven;
-                }
-
-                arrPortVerts[0] = arrInAreaPoint[nEven];
-                arrPortVerts[1] = arrInAreaPoint[nEven] + Vec3(0, 0, m_fHeight);
-                arrPortVerts[2] = arrInAreaPoint[!nEven] + Vec3(0, 0, m_fHeight);
-                arrPortVerts[3] = arrInAreaPoint[!nEven];
-
-                nEven = !nEven;
-
-                arrPortVertsOtherSide[0] = arrOutAreaPoint[nEven];
-                arrPortVertsOtherSide[1] = arrOutAreaPoint[nEven] + Vec3(0, 0, m_fHeight);
-                arrPortVertsOtherSide[2] = arrOutAreaPoint[!nEven] + Vec3(0, 0, m_fHeight);
-                arrPortVertsOtherSide[3] = arrOutAreaPoint[!nEven];
-                barrPortVertsOtherSideValid = true;
-            }
-            else
-            { // something wrong
-                Warning("CVisArea::PreRender: Invalid portal: %s", m_pVisAreaColdData->m_sName);
                 return;
             }
+
+            memcpy(arrPortVerts, pCache->arrPortVerts, sizeof(arrPortVerts));
+            memcpy(arrPortVertsOtherSide, pCache->arrPortVertsOtherSide, sizeof(arrPortVertsOtherSide));
+            barrPortVertsOtherSideValid = true;
         }
         else if (!pParent && vPortNorm.z == 0 && m_lstConnections.Count() == 1)
         { // basic entrance portal
@@ -1167,6 +1221,7 @@ void CVisArea::OffsetPosition(const Vec3& delta)
     {
         m_lstShapePoints[i] += delta;
     }
+    ResetPortalVertsCache();
     if (m_pObjectsTree)
     {
         m_pObjectsTree->OffsetObjects(delta);
@@ -99,6 +99,8 @@ struct CVisArea
     Vec3 GetConnectionNormal(CVisArea* pPortal);
     void PreRender(int nReqursionLevel, CCamera CurCamera, CVisArea* pParent, CVisArea* pCurPortal, bool* pbOutdoorVisible, PodArray<CCamera>* plstOutPortCameras, bool* pbSkyVisible, bool* pbOceanVisible, PodArray<CVisArea*>& lstVisibleAreas, const SRenderingPassInfo& passInfo);
     void UpdatePortalCameraPlanes(CCamera& cam, Vec3* pVerts, bool bMergeFrustums, const SRenderingPassInfo& passInfo);
+    bool CalcBasicPortalVerts(CVisArea* pParent, Vec3* arrPortVerts, Vec3* arrPortVertsOtherSide);
+    void ResetPortalVertsCache();
     int GetVisAreaConnections(IVisArea** pAreas, int nMaxConnNum, bool bSkipDisabledPortals = false);
     int GetRealConnections(IVisArea** pAreas, int nMaxConnNum, bool bSkipDisabledPortals = false);
     bool IsPortalValid();
@@ -161,6 +163,17 @@ struct CVisArea
     static PodArray<CCamera> s_tmpCameras;
     static int s_nGetDistanceThruVisAreasCallCounter;
 
+    // Portal quads computed by PreRender, they don't depend on the camera so they are kept until the shape or the
+    // connections change. One per area the portal is entered from: none (outdoors), first and second connection.
+    struct SPortalVertsCache
+    {
+        Vec3 arrPortVerts[4];
+        Vec3 arrPortVertsOtherSide[4];
+        bool bComputed;
+        bool bValid;
+    };
+    SPortalVertsCache* GetPortalVertsCache(CVisArea* pParent);
+
     VisAreaGUID m_nVisGUID;
     PodArray<CVisArea*> m_lstConnections;
     Vec3 m_vConnNormals[2];
@@ -178,6 +191,7 @@ struct CVisArea
     float m_fDistance;
     float m_fViewDistRatio;
     CCamera* m_arrOcclCamera[MAX_RECURSION_LEVELS];
+    SPortalVertsCache m_arrPortalVertsCache[3];
     int m_lstCurCamerasLen;
     int m_lstCurCamerasCap;
     int m_lstCurCamerasIdx;
@@ -219,6 +219,9 @@ void CVars::Init()
         " z = freeze particle system");
     REGISTER_CVAR(e_ParticlesThread, 1, VF_BITFIELD,
         "Enable particle threading");
+    REGISTER_CVAR(e_ParticlesUpdateJobSize, 256, VF_NULL,
+        "Particles per job when moving a large container of non-colliding particles in parallel\n"
+        "  0 = update every container serially");
 #if !defined(_RELEASE)
     REGISTER_CVAR(e_ParticlesShowMainThreadUpdates, 0, VF_NULL,
         "Render a list of Containers not updated by a job and why");
@@ -504,6 +507,9 @@ void CVars::Init()
         "Controls density of rays depending on distance to the object");
     REGISTER_CVAR(e_TerrainLodRatio, 1.f, VF_NULL,
         "Set heightmap LOD, this value is combined with sector error metrics and distance to camera");
+    REGISTER_CVAR(e_TerrainLodHysteresis, 0.2f, VF_NULL,
+        "Fraction by which a terrain sector's LOD error must improve before it switches to a coarser mesh than the one it has built.\n"
+        "Avoids rebuilding sector meshes back and forth as the camera moves around a LOD boundary. 0 = off");
     REGISTER_CVAR(e_TerrainLodDistRatio, 1.f, VF_NULL,
         "Set heightmap LOD, this value is combined only with sector distance to camera and ignores sector error metrics");
     DefineConstFloatCVar(e_TerrainLodRatioHolesMin, VF_NULL,
@@ -783,6 +789,8 @@ void CVars::Init()
         "Size of queue for data send to check occlusion job");
     REGISTER_CVAR(e_CheckOcclusionOutputQueueSize, DEFAULT_CHECK_OCCLUSION_OUTPUT_QUEUE_SIZE, VF_NULL,
         "Size of queue for data send from check occlusion job");
+    REGISTER_CVAR(e_CheckOcclusionOctreeNodesPerJob, 16, VF_NULL,
+        "Number of octree nodes the check occlusion job tests per worker job, 0 or 1 tests them all on the check occlusion job");
     REGISTER_CVAR(e_SkipParticleOcclusion, 1, VF_NULL, "Skips occlusion testing for particles in the occlusion buffer, these may be too small to get reliable results.");
     REGISTER_CVAR(e_StatObjTessellationMaxEdgeLenght, 1.75f, VF_CHEAT,
         "Split edges longer than X meters");
@@ -911,6 +919,11 @@ void CVars::Init()
         "Maximum lifetime of branch ropes (if there are no collisions)");
     REGISTER_CVAR(e_FoliageWindActivationDist,  0,  VF_NULL,
         "If the wind is sufficiently strong, visible foliage in this view dist will be forcefully activated");
+    REGISTER_CVAR(e_FoliageTouchBendingSimDist, 30.f, VF_NULL,
+        "Touch bending skeletons further than this from the camera are only simulated while something touches them,\n"
+        "otherwise they keep their last pose once they had e_FoliageTouchBendingSettleTime seconds to settle; 0 = always simulate");
+    REGISTER_CVAR(e_FoliageTouchBendingSettleTime, 2.f, VF_NULL,
+        "Seconds an untouched touch bending skeleton beyond e_FoliageTouchBendingSimDist keeps simulating before it is frozen");
 
     DefineConstIntCVar(e_DeformableObjects, e_DeformableObjectsDefault, VF_NULL,
         "Enable / Disable morph based deformable objects");
@@ -1107,6 +1120,9 @@ void CVars::Init()
 
     REGISTER_CVAR_CB(e_TimeOfDay, 0.0f, VF_CHEAT | VF_CHEAT_NOCHECK, "Current Time of Day", OnTimeOfDayVarChange);
     REGISTER_CVAR_CB(e_TimeOfDaySpeed, 0.0f, VF_CHEAT | VF_CHEAT_NOCHECK, "Time of Day change speed", OnTimeOfDaySpeedVarChange);
+    REGISTER_CVAR(e_TimeOfDayUpdateStep, 0.001f, VF_NULL,
+        "Minimum change of the running Time of Day (in hours) before its parameters are interpolated and applied again\n"
+        "0 = update every frame");
     DefineConstIntCVar(e_TimeOfDayDebug, 0, VF_NULL,
         "Display time of day current values on screen");
 
@@ -1176,6 +1192,7 @@ void CVars::Init()
     REGISTER_CVAR(e_MergedMeshesInstanceDistShadows, 4.5, VF_NULL, "Distance fudge factor at which merged meshes turn off shadows");
     REGISTER_CVAR(e_MergedMeshesActiveDist, 250.f, VF_NULL, "Active distance up until merged mesh patches will be streamed in");
     REGISTER_CVAR(e_MergedMeshesUseSpines, 1, VF_NULL, "MergedMeshes use touchbending");
+    REGISTER_CVAR(e_MergedMeshesIncrementalUpdate, 1, VF_NULL, "Re-prepare only the touched group when instances are added to or removed from a streamed in merged mesh");
     REGISTER_CVAR(e_MergedMeshesBulletSpeedFactor, 0.05f, VF_NULL, "MergedMesh Bullet approximations speed factor");
     REGISTER_CVAR(e_MergedMeshesBulletScale, 35.f, VF_NULL, "MergedMesh Bullet approximations size scale");
     REGISTER_CVAR(e_MergedMeshesBulletLifetime, 0.15f, VF_NULL, "MergedMesh Bullet approximations lifetime");
@@ -270,6 +270,7 @@ struct CVars
     int e_Dissolve;
     int e_GsmCastFromTerrain;
     float e_TerrainLodRatio;
+    float e_TerrainLodHysteresis;
     float e_TerrainLodDistRatio;
     int e_StatObjBufferRenderTasks;
     DeclareConstIntCVar(e_StreamCgfUpdatePerNodeDistance, 1);
@@ -290,6 +291,7 @@ struct CVars
     int e_CheckOcclusion;
     int e_CheckOcclusionQueueSize;
     int e_CheckOcclusionOutputQueueSize;
+    int e_CheckOcclusionOctreeNodesPerJob;
     int e_SkipParticleOcclusion;
     DeclareConstIntCVar(e_WaterVolumes, e_WaterVolumesDefault);
     DeclareConstIntCVar(e_RenderTransparentUnderWater, e_RenderTransparentUnderWaterDefault);
@@ -361,6 +363,8 @@ struct CVars
     int e_ParticlesAudio;
     int e_ParticleShadowsNumGSMs;
     float e_FoliageBranchesTimeout;
+    float e_FoliageTouchBendingSimDist;
+    float e_FoliageTouchBendingSettleTime;
     DeclareConstFloatCVar(e_TerrainOcclusionCullingStepSizeDelta);
     float e_LodRatio;
     float e_LodFaceAreaTargetSize;
@@ -407,6 +411,7 @@ struct CVars
     DeclareConstIntCVar(e_BBoxes, 0);
     int e_Vegetation;
     float e_TimeOfDaySpeed;
+    float e_TimeOfDayUpdateStep;
     int e_LodMax;
     int e_LodForceUpdate;
     DeclareConstFloatCVar(e_ViewDistCompMaxSize);
@@ -520,6 +525,7 @@ struct CVars
     DeclareConstFloatCVar(e_StreamPredictionDistanceFar);
     DeclareConstIntCVar(e_CoverageBufferTerrain, 0);
     int e_ParticlesThread;
+    int e_ParticlesUpdateJobSize;
     int e_SQTestExitOnFinish;
     DeclareConstIntCVar(e_TerrainOcclusionCullingMaxSteps, 50);
     int e_ParticlesUseLevelSpecificLibs;
@@ -557,6 +563,7 @@ struct CVars
     float e_MergedMeshesActiveDist;
     float e_MergedMeshesDeformViewDistMod;
     int e_MergedMeshesUseSpines;
+    int e_MergedMeshesIncrementalUpdate;
     float e_MergedMeshesBulletSpeedFactor;
     float e_MergedMeshesBulletScale;
     float e_MergedMeshesBulletLifetime;
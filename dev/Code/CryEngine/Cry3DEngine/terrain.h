@@ -327,6 +327,7 @@ public:
 
     // LegacyTerrain::CryTerrainRequestBus
     void RequestTerrainUpdate() override;
+    void GetHeightsAndNormals(float minX, float minY, float step, AZ::u32 numX, AZ::u32 numY, float* heights, AZ::Vector3* normals) const override;
 
 private:
     template <class T>
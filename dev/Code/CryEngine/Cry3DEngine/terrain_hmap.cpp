@@ -327,6 +327,51 @@ ITerrain::SurfaceWeight CTerrain::GetSurfaceWeight(Meter x, Meter y) const
     return SurfaceWeight();
 }
 
+void CTerrain::GetHeightsAndNormals(float minX, float minY, float step, AZ::u32 numX, AZ::u32 numY, float* heights, AZ::Vector3* normals) const
+{
+    if (!numX || !numY || (!heights && !normals))
+    {
+        return;
+    }
+
+    // Sample a grid padded by one sample on each side, so every normal can use central differences
+    const AZ::u32 paddedX = numX + 2;
+    const AZ::u32 paddedY = numY + 2;
+    std::vector<float> paddedHeights(paddedX * paddedY);
+
+    for (AZ::u32 y = 0; y < paddedY; ++y)
+    {
+        const float yWS = minY + (static_cast<float>(y) - 1.0f) * step;
+        float* pRow = &paddedHeights[y * paddedX];
+        for (AZ::u32 x = 0; x < paddedX; ++x)
+        {
+            pRow[x] = GetBilinearZ(minX + (static_cast<float>(x) - 1.0f) * step, yWS);
+        }
+    }
+
+    const float invTwoStep = step > 0.0f ? 0.5f / step : 0.0f;
+    for (AZ::u32 y = 0; y < numY; ++y)
+    {
+        const float* pRowDown = &paddedHeights[y * paddedX];
+        const float* pRow = pRowDown + paddedX;
+        const float* pRowUp = pRow + paddedX;
+        for (AZ::u32 x = 0; x < numX; ++x)
+        {
+            const AZ::u32 index = y * numX + x;
+            if (heights)
+            {
+                heights[index] = pRow[x + 1];
+            }
+            if (normals)
+            {
+                const float dzdx = (pRow[x + 2] - pRow[x]) * invTwoStep;
+                const float dzdy = (pRowUp[x + 1] - pRowDown[x + 1]) * invTwoStep;
+                normals[index] = AZ::Vector3(-dzdx, -dzdy, 1.0f).GetNormalized();
+            }
+        }
+    }
+}
+
 float CTerrain::GetZ(Meter x, Meter y) const
 {
     if (!m_RootNode)
@@ -41,17 +41,28 @@ void CTerrainNode::SetLOD(const SRenderingPassInfo& passInfo)
         const int maxLOD = GetTerrain()->m_UnitToSectorBitShift - 1;
         const int minLOD = 0;
 
+        // Coarsening past the LOD the mesh was last built at must clear a stricter threshold, so that small camera
+        // moves around a LOD boundary don't make the sector mesh rebuild back and forth.
+        const float coarsenScale = 1.f - clamp_tpl(GetCVars()->e_TerrainLodHysteresis, 0.f, 0.9f);
+
         int lod = maxLOD;
         while (lod > minLOD)
         {
-            bool bErrorIsAcceptable = m_ZErrorFromBaseLOD[lod] < allowedError;
+            const float lodAllowedError = (lod > m_CurrentLOD) ? allowedError * coarsenScale : allowedError;
+            bool bErrorIsAcceptable = m_ZErrorFromBaseLOD[lod] < lodAllowedError;
             if (bErrorIsAcceptable)
             {
                 break;
             }
             --lod;
         }
-        m_QueuedLOD = min(lod, int(distanceToCamera / 32)); // This seems like a completely ad-hoc clamp.
+
+        int distanceLOD = int(distanceToCamera / 32); // This seems like a completely ad-hoc clamp.
+        if (distanceLOD > m_CurrentLOD)
+        {
+            distanceLOD = max(int(m_CurrentLOD), int(distanceToCamera * coarsenScale / 32));
+        }
+        m_QueuedLOD = min(lod, distanceLOD);
     }
 
     if (passInfo.IsGeneralPass())
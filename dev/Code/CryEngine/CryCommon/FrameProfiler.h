@@ -358,6 +358,17 @@ public:
     std::vector<uint16> m_count;
 };
 
+//////////////////////////////////////////////////////////////////////////
+//! Hardware performance counter values collected when profile_hw_counters is enabled.
+//! Values are inclusive of child sections.
+struct SFrameProfilerHWCounters
+{
+    int64 m_cycles;
+    int64 m_instructions;
+    int64 m_cacheMisses;
+    int64 m_branchMisses;
+};
+
 //////////////////////////////////////////////////////////////////////////
 //! CFrameProfiler is a single profiler counter with unique name and data.
 //! Multiple Sections can be executed for this profiler, they all will be merged in this class.
@@ -383,6 +394,10 @@ public:
     float m_variance;
     //! peak from this frame (useful if count is >1).
     int64 m_peak;
+    //! Hardware counters accumulated in current frame (only with profile_hw_counters).
+    SFrameProfilerHWCounters m_hwCounters;
+    //! Hardware counters of the last completed frame, used for display.
+    SFrameProfilerHWCounters m_hwCountersLastFrame;
 
     //! Current parent profiler in last frame.
     CFrameProfiler* m_pParent;
@@ -423,6 +438,8 @@ public:
         ,   m_count(0)
         ,   m_variance(0.0f)
         ,   m_peak(0)
+        ,   m_hwCounters()
+        ,   m_hwCountersLastFrame()
         ,   m_pParent(NULL)
         ,   m_bExpended(0)
         ,   m_bHaveChildren(0)
@@ -475,6 +492,8 @@ public:
     int64 m_excludeTime;
     CFrameProfiler* m_pFrameProfiler;
     CFrameProfilerSection* m_pParent;
+    //! Counter snapshot at section start; m_cycles < 0 if not sampled.
+    SFrameProfilerHWCounters m_hwStart;
 
     ILINE CFrameProfilerSection(CFrameProfiler* profiler)
     {
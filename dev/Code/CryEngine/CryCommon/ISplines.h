@@ -672,15 +672,42 @@ namespace spline
         inline int seek_key(float t)
         {
             assert(num_keys() < (1 << 15));
+            int first = m_curr;
             if ((m_curr >= num_keys()) || (time(m_curr) > t))
             {
-                // Search from begining.
-                m_curr = 0;
+                // Time went backwards (loop, scrub), search from begining.
+                first = 0;
             }
-            while ((m_curr < num_keys() - 1) && (time(m_curr + 1) <= t))
+            else
+            {
+                // Sequential playback advances at most a key or two per update, check those before searching.
+                for (int step = 0; step < 2; ++step)
+                {
+                    if ((m_curr >= num_keys() - 1) || (time(m_curr + 1) > t))
+                    {
+                        return m_curr;
+                    }
+                    ++m_curr;
+                }
+                first = m_curr;
+            }
+
+            // Binary search for the last key at or before t, keys are sorted by time.
+            int lo = first + 1;
+            int hi = num_keys();
+            while (lo < hi)
             {
-                ++m_curr;
+                const int mid = (lo + hi) / 2;
+                if (time(mid) <= t)
+                {
+                    lo = mid + 1;
+                }
+                else
+                {
+                    hi = mid;
+                }
             }
+            m_curr = static_cast<int16>(lo - 1);
             return m_curr;
         }
 
@@ -75,6 +75,13 @@ namespace LyShine
         //! Set flag that we are rendering into a mask. Used to avoid masks on child mask elements.
         virtual void SetIsRenderingToMask(bool isRenderingToMask) = 0;
 
+        //---- Functions for supporting render targets (used during creation of the graph, not rendering ) ----
+
+        //! Get flag that indicates primitives are currently being added to a render target node.
+        //! Render targets are only re-rendered when the graph is rebuilt, so components should not
+        //! update the vertices of such primitives in place.
+        virtual bool IsRenderingToRenderTarget() const = 0;
+
         //---- Functions for supporting fading  (used during creation of the graph, not rendering ) ----
 
         //! Push an alpha fade, this is multiplied with any existing alpha fade from parents
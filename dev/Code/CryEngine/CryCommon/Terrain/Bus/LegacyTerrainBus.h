@@ -12,6 +12,7 @@
 #pragma once
 
 #include <AzCore/EBus/EBus.h>
+#include <AzCore/Math/Vector3.h>
 
 namespace LegacyTerrain
 {
@@ -23,6 +24,21 @@ namespace LegacyTerrain
          * Requests a refresh of the terrain. It will be broadcast via the LegacyTerrainNotificationBus
          */
         virtual void RequestTerrainUpdate() = 0;
+
+        /**
+         * Samples terrain heights and surface normals over a regular grid in a single call.
+         * Each height is sampled once; normals are derived from the neighbouring grid samples. This is much cheaper
+         * than separate GetTerrainElevation / GetTerrainSurfaceNormal queries per point, which sample the heightmap
+         * five times per point.
+         * @param minX world x of the first sample.
+         * @param minY world y of the first sample.
+         * @param step distance in metres between adjacent samples, in both directions.
+         * @param numX number of samples along x.
+         * @param numY number of samples along y.
+         * @param[out] heights numX * numY heights, x varying fastest. May be null.
+         * @param[out] normals numX * numY normals, x varying fastest. May be null.
+         */
+        virtual void GetHeightsAndNormals(float minX, float minY, float step, AZ::u32 numX, AZ::u32 numY, float* heights, AZ::Vector3* normals) const = 0;
     };
     using CryTerrainRequestBus = AZ::EBus<CryTerrainRequests>;
 
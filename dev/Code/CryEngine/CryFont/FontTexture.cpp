@@ -229,6 +229,29 @@ CTextureSlot* CFontTexture::GetLRUSlot()
     return pLRUSlot;
 }
 
+//-------------------------------------------------------------------------------------------------
+void CFontTexture::BuildEvictionList(uint16 wCurrentUsage)
+{
+    m_pEvictionList.clear();
+
+    for (CTextureSlot* pSlot : m_pSlotList)
+    {
+        if (pSlot->wSlotUsage == 0 || pSlot->wSlotUsage != wCurrentUsage)
+        {
+            m_pEvictionList.push_back(pSlot);
+        }
+    }
+
+    // same order GetLRUSlot would pick them in: free slots first, then by age
+    std::stable_sort(m_pEvictionList.begin(), m_pEvictionList.end(),
+        [this](const CTextureSlot* a, const CTextureSlot* b)
+        {
+            const uint32 ageA = a->wSlotUsage == 0 ? 0x10000 : uint16(m_wSlotUsage - a->wSlotUsage);
+            const uint32 ageB = b->wSlotUsage == 0 ? 0x10000 : uint16(m_wSlotUsage - b->wSlotUsage);
+            return ageA > ageB;
+        });
+}
+
 //-------------------------------------------------------------------------------------------------
 CTextureSlot* CFontTexture::GetMRUSlot()
 {
@@ -266,6 +289,12 @@ int CFontTexture::PreCacheString(const char* szString, int* pUpdated, float size
     uint16 wSlotUsage = m_wSlotUsage++;
     int iUpdated = 0;
 
+    // Scanning every slot for the LRU one on each miss is expensive for strings with many new glyphs
+    // (e.g. CJK text in a large font texture), so the candidates are ordered once on the first miss
+    // and then consumed in order
+    bool bEvictionListBuilt = false;
+    size_t nextEvictionSlot = 0;
+
     uint32 cChar;
     for (Unicode::CIterator<const char*, false> it(szString); cChar = *it; ++it)
     {
@@ -273,7 +302,19 @@ int CFontTexture::PreCacheString(const char* szString, int* pUpdated, float size
 
         if (!pSlot)
         {
-            pSlot = GetLRUSlot();
+            if (!bEvictionListBuilt)
+            {
+                BuildEvictionList(wSlotUsage);
+                bEvictionListBuilt = true;
+            }
+
+            // skip any slot that has been used by this string since the list was built
+            while (nextEvictionSlot < m_pEvictionList.size() && m_pEvictionList[nextEvictionSlot]->wSlotUsage == wSlotUsage)
+            {
+                ++nextEvictionSlot;
+            }
+
+            pSlot = nextEvictionSlot < m_pEvictionList.size() ? m_pEvictionList[nextEvictionSlot++] : GetLRUSlot();
 
             if (!pSlot)
             {
@@ -513,6 +554,7 @@ int CFontTexture::ReleaseSlotList()
 
         pItor = m_pSlotList.erase(pItor);
     }
+    m_pEvictionList.clear();
 
     return 1;
 }
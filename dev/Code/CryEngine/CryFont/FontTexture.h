@@ -179,6 +179,9 @@ public:
     CTextureSlot* GetGradientSlot();
 
     CTextureSlot* GetLRUSlot();
+    //! Fill m_pEvictionList with the slots that can be reused, least recently used first.
+    //! \param wCurrentUsage Slots stamped with this usage are in use by the current string and are excluded.
+    void BuildEvictionList(uint16 wCurrentUsage);
     CTextureSlot* GetMRUSlot();
 
     //! Returns 1 if texture updated, returns 2 if texture not updated, returns 0 on error
@@ -290,6 +293,7 @@ private: // ---------------------------------------------------------------
     CGlyphCache                     m_pGlyphCache;
     CTextureSlotList            m_pSlotList;
     CTextureSlotTable           m_pSlotTable;
+    CTextureSlotList            m_pEvictionList;            // Reused by PreCacheString, slots ordered oldest first
 
     FONT_TEXTURE_TYPE*     m_pBuffer;                           // [y*iWidth * x] x=0..iWidth-1, y=0..iHeight-1
 
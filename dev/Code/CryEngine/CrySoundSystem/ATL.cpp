@@ -880,9 +880,17 @@ namespace Audio
 
                             auto const pPositionedObject = static_cast<CATLAudioObject*>(pObject);
 
-                            AudioSystemImplementationRequestBus::BroadcastResult(eResult, &AudioSystemImplementationRequestBus::Events::SetPosition,
-                                pPositionedObject->GetImplDataPtr(),
-                                pRequestData->oPosition);
+                            if (pPositionedObject->IsVirtual())
+                            {
+                                // Only remember it, the object manager forwards it once the object is audible again.
+                                eResult = eARS_SUCCESS;
+                            }
+                            else
+                            {
+                                AudioSystemImplementationRequestBus::BroadcastResult(eResult, &AudioSystemImplementationRequestBus::Events::SetPosition,
+                                    pPositionedObject->GetImplDataPtr(),
+                                    pRequestData->oPosition);
+                            }
 
                             if (eResult == eARS_SUCCESS)
                             {
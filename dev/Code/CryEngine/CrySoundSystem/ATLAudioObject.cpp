@@ -807,7 +807,7 @@ namespace Audio
         CATLAudioObjectBase::Update(fUpdateIntervalMS, rListenerPosition);
         m_oPropagationProcessor.Update(fUpdateIntervalMS);
 
-        if (CanRunObstructionOcclusion())
+        if (CanRunObstructionOcclusion() && !IsVirtual())
         {
             const float fDistance = (m_oPosition.GetPositionVec() - rListenerPosition.GetPositionVec()).GetLength();
 
@@ -854,11 +854,38 @@ namespace Audio
         m_oPosition = oNewPosition;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CATLAudioObject::UpdateVirtualState(const SATLWorldPosition& rListenerPosition, const float fVirtualizationDistance)
+    {
+        const bool bWasVirtual = IsVirtual();
+        bool bVirtual = false;
+
+        if (fVirtualizationDistance > 0.0f)
+        {
+            // Come back a little inside the range we left from, so objects sitting on the boundary don't toggle every update.
+            const float fDistance = bWasVirtual ? fVirtualizationDistance * 0.9f : fVirtualizationDistance;
+            bVirtual = (m_oPosition.GetPositionVec() - rListenerPosition.GetPositionVec()).GetLengthSquared() > (fDistance * fDistance);
+        }
+
+        if (bVirtual)
+        {
+            m_nFlags |= eAOF_VIRTUAL;
+        }
+        else
+        {
+            m_nFlags &= ~eAOF_VIRTUAL;
+        }
+
+        // Report objects that just became audible, the caller needs to forward their latest position.
+        return bWasVirtual && !bVirtual;
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CATLAudioObject::Clear()
     {
         CATLAudioObjectBase::Clear();
         m_oPosition = SATLWorldPosition();
+        m_nFlags &= ~eAOF_VIRTUAL;
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -424,6 +424,15 @@ namespace Audio
             return (m_nFlags & eAOF_TRACK_VELOCITY) != 0;
         }
         void UpdateVelocity(const float fUpdateIntervalMS);
+        bool IsVirtual() const
+        {
+            return (m_nFlags & eAOF_VIRTUAL) != 0;
+        }
+        bool UpdateVirtualState(const SATLWorldPosition& rListenerPosition, const float fVirtualizationDistance);
+        const SATLWorldPosition& GetPosition() const
+        {
+            return m_oPosition;
+        }
 
     private:
         TATLEnumFlagsType m_nFlags;
@@ -435,10 +444,6 @@ namespace Audio
 #if defined(INCLUDE_AUDIO_PRODUCTION_CODE)
     public:
         void DrawDebugInfo(IRenderAuxGeom& auxGeom, const Vec3& vListenerPos, const CATLDebugNameStore* const pDebugNameStore) const;
-        const SATLWorldPosition& GetPosition() const
-        {
-            return m_oPosition;
-        }
 #endif // INCLUDE_AUDIO_PRODUCTION_CODE
     };
 } // namespace Audio
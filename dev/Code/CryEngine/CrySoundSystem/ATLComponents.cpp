@@ -308,6 +308,7 @@ namespace Audio
 
         m_fTimeSinceLastVelocityUpdateMS += fUpdateIntervalMS;
         const bool bUpdateVelocity = m_fTimeSinceLastVelocityUpdateMS > s_fVelocityUpdateIntervalMS;
+        const float fVirtualizationDistance = g_audioCVars.m_fAudioObjectVirtualizationDistance;
 
         for (auto& audioObjectPair : m_cAudioObjects)
         {
@@ -315,8 +316,21 @@ namespace Audio
 
             if (HasActiveEvents(pObject))
             {
+                if (pObject->UpdateVirtualState(rListenerPosition, fVirtualizationDistance))
+                {
+                    // Position updates were held back while virtual, bring the middleware up to date.
+                    AudioSystemImplementationRequestBus::Broadcast(&AudioSystemImplementationRequestBus::Events::SetPosition,
+                        pObject->GetImplDataPtr(),
+                        pObject->GetPosition());
+                }
+
                 pObject->Update(fUpdateIntervalMS, rListenerPosition);
 
+                if (pObject->IsVirtual())
+                {
+                    continue;
+                }
+
                 if (pObject->CanRunObstructionOcclusion())
                 {
                     SATLSoundPropagationData oPropagationData;
@@ -54,6 +54,7 @@ namespace Audio
     {
         eAOF_NONE = 0,
         eAOF_TRACK_VELOCITY = BIT(0),
+        eAOF_VIRTUAL        = BIT(1),   // out of audible range, position updates are kept in the ATL only
     };
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -388,6 +389,7 @@ namespace Audio
             , m_fileSize(0)
             , m_useCount(0)
             , m_memoryBlockAlignment(AUDIO_MEMORY_ALIGNMENT)
+            , m_lastUseStamp(0)
             , m_flags(eAFF_NOTFOUND)
             , m_dataScope(eADS_ALL)
             , m_streamTaskType(eStreamTaskTypeCount)
@@ -406,6 +408,7 @@ namespace Audio
         size_t m_fileSize;
         size_t m_useCount;
         size_t m_memoryBlockAlignment;
+        AZ::u64 m_lastUseStamp;     // when the entry last became removable, oldest gets evicted first
         CCryFlags<TATLEnumFlagsType> m_flags;
         EATLDataScope m_dataScope;
         EStreamTaskType m_streamTaskType;
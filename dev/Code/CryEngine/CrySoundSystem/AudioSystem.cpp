@@ -129,9 +129,74 @@ namespace Audio
         AZ_Assert(0 == (request.nFlags & eARF_THREAD_SAFE_PUSH), "AudioSystem::PushRequest - called with flag THREAD_SAFE_PUSH!");
         AZ_Assert(0 == (request.nFlags & eARF_EXECUTE_BLOCKING), "AudioSystem::PushRequest - called with flag EXECUTE_BLOCKING!");
 
+        if (CoalesceRequest(request))
+        {
+            return;
+        }
+
+        FlushCoalescedRequests();
         AudioSystemInternalRequestBus::QueueBroadcast(&AudioSystemInternalRequestBus::Events::ProcessRequestByPriority, request);
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CAudioSystem::CoalesceRequest(const CAudioRequestInternal& request)
+    {
+        // Main Thread!
+        if (!request.pData || request.pData->eRequestType != eART_AUDIO_OBJECT_REQUEST
+            || request.nAudioObjectID == INVALID_AUDIO_OBJECT_ID
+            || (request.nFlags & (eARF_SYNC_CALLBACK | eARF_SYNC_FINISHED_CALLBACK)) != 0)
+        {
+            return false;
+        }
+
+        TCoalescingKey key;
+        auto const pRequestDataBase = static_cast<const SAudioObjectRequestDataInternalBase*>(request.pData.get());
+        switch (pRequestDataBase->eType)
+        {
+            case eAORT_SET_POSITION:
+            {
+                key = TCoalescingKey(request.nAudioObjectID, INVALID_AUDIO_CONTROL_ID);
+                break;
+            }
+            case eAORT_SET_RTPC_VALUE:
+            {
+                auto const pRequestData = static_cast<const SAudioObjectRequestDataInternal<eAORT_SET_RTPC_VALUE>*>(pRequestDataBase);
+                key = TCoalescingKey(request.nAudioObjectID, pRequestData->nControlID);
+                break;
+            }
+            default:
+            {
+                return false;
+            }
+        }
+
+        auto iter = m_coalescedRequestLookup.find(key);
+        if (iter != m_coalescedRequestLookup.end())
+        {
+            // Superseded by a newer value before the audio thread saw it, replace in place.
+            m_coalescedRequests[iter->second] = request;
+        }
+        else
+        {
+            m_coalescedRequestLookup.emplace(key, m_coalescedRequests.size());
+            m_coalescedRequests.push_back(request);
+        }
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioSystem::FlushCoalescedRequests()
+    {
+        // Main Thread!
+        if (!m_coalescedRequests.empty())
+        {
+            AudioSystemInternalRequestBus::QueueBroadcast(&AudioSystemInternalRequestBus::Events::ProcessRequestBatch, m_coalescedRequests);
+            m_coalescedRequests.clear();
+            m_coalescedRequestLookup.clear();
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CAudioSystem::PushRequestBlocking(const SAudioRequest& audioRequestData)
     {
@@ -196,6 +261,9 @@ namespace Audio
         FUNCTION_PROFILER_ALWAYS(GetISystem(), PROFILE_AUDIO);
         AZ_Assert(gEnv->mMainThreadId == CryGetCurrentThreadId(), "AudioSystem::ExternalUpdate - called from non-Main thread!");
 
+        // Hand this frame's merged position/RTPC updates to the audio thread.
+        FlushCoalescedRequests();
+
         // Notify callbacks on the pending callbacks queue...
         // These are requests that were completed then queued for callback processing to happen here.
         ExecuteRequestCompletionCallbacks(m_pendingCallbacksQueue, m_pendingCallbacksMutex);
@@ -312,6 +380,9 @@ namespace Audio
         m_apAudioProxies.clear();
         m_apAudioProxiesToBeFreed.clear();
 
+        m_coalescedRequests.clear();
+        m_coalescedRequestLookup.clear();
+
         // Release the audio implementation...
         SAudioRequest request;
         SAudioManagerRequestData<eAMRT_RELEASE_AUDIO_IMPL> requestData;
@@ -690,6 +761,37 @@ namespace Audio
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioSystem::ProcessRequestBatch(TAudioRequestBatch requestBatch)
+    {
+        FUNCTION_PROFILER_ALWAYS(GetISystem(), PROFILE_AUDIO);
+        AZ_Assert(gEnv->mMainThreadId != CryGetCurrentThreadId(), "AudioSystem::ProcessRequestBatch - called from Main thread!");
+
+        if (m_oATL.CanProcessRequests())
+        {
+            for (auto& request : requestBatch)
+            {
+                if (request.eStatus == eARS_NONE)
+                {
+                    request.eStatus = eARS_PENDING;
+                    m_oATL.ProcessRequest(request);
+                }
+
+                AZ_Assert(request.eStatus != eARS_PENDING, "AudioSystem::ProcessRequestBatch - ATL finished processing request, but request is still in pending state!");
+            }
+
+            // push the whole batch onto the callbacks queue under a single lock...
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingCallbacksMutex);
+            for (const auto& request : requestBatch)
+            {
+                if (request.eStatus != eARS_PENDING)
+                {
+                    m_pendingCallbacksQueue.push_back(request);
+                }
+            }
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     bool CAudioSystem::ProcessRequests(TAudioRequests& requestQueue)
     {
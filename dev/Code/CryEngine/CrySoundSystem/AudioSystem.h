@@ -17,6 +17,7 @@
 #include <AudioInternalInterfaces.h>
 
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -48,6 +49,8 @@ namespace Audio
     };
 
 
+    using TAudioRequestBatch = AZStd::vector<CAudioRequestInternal, Audio::AudioSystemStdAllocator>;
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     class AudioSystemInternalRequests
         : public AZ::EBusTraits
@@ -64,6 +67,7 @@ namespace Audio
         ///////////////////////////////////////////////////////////////////////////////////////////////
 
         virtual void ProcessRequestByPriority(CAudioRequestInternal audioRequestData) = 0;
+        virtual void ProcessRequestBatch(TAudioRequestBatch audioRequestBatch) = 0;
     };
 
     using AudioSystemInternalRequestBus = AZ::EBus<AudioSystemInternalRequests>;
@@ -95,6 +99,7 @@ namespace Audio
         void PushRequestBlocking(const SAudioRequest& audioRequestData) override;
         void PushRequestThreadSafe(const SAudioRequest& audioRequestData) override;
         void ProcessRequestByPriority(CAudioRequestInternal audioRequestInternalData) override;
+        void ProcessRequestBatch(TAudioRequestBatch audioRequestBatch) override;
 
         void ExternalUpdate() override;
 
@@ -135,12 +140,17 @@ namespace Audio
     private:
         using TAudioRequests = AZStd::deque<CAudioRequestInternal, Audio::AudioSystemStdAllocator>;
         using TAudioProxies = AZStd::vector<CAudioProxy*, Audio::AudioSystemStdAllocator>;
+        using TCoalescingKey = AZStd::pair<TAudioObjectID, TAudioControlID>;
+        using TCoalescingLookup = AZStd::unordered_map<TCoalescingKey, size_t, AZStd::hash<TCoalescingKey>, AZStd::equal_to<TCoalescingKey>, Audio::AudioSystemStdAllocator>;
 
         void UpdateTime();
         void InternalUpdate();
         bool ProcessRequests(TAudioRequests& rRequestQueue);
         void ProcessRequestBlocking(CAudioRequestInternal& audioRequestInternalData);
 
+        bool CoalesceRequest(const CAudioRequestInternal& audioRequestInternalData);
+        void FlushCoalescedRequests();
+
         void ExecuteRequestCompletionCallbacks(TAudioRequests& requestQueue, AZStd::mutex& requestQueueMutex, bool bTryLock = false);
         void ExtractCompletedRequests(TAudioRequests& rRequestQueue, TAudioRequests& rSyncCallbacksQueue);
 
@@ -163,6 +173,12 @@ namespace Audio
         AZStd::mutex m_threadSafeCallbacksMutex;
         AZStd::mutex m_pendingCallbacksMutex;
 
+        // Position and RTPC updates pushed on the main thread are merged here (latest value wins per
+        // object/control) and sent to the audio thread as a single batch. The batch is flushed before any
+        // other request is queued, so ordering relative to triggers, resets, etc. is preserved.
+        TAudioRequestBatch m_coalescedRequests;
+        TCoalescingLookup m_coalescedRequestLookup;
+
 
         // Synchronization objects
         AZStd::binary_semaphore m_mainEvent;
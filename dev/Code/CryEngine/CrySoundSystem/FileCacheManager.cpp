@@ -26,6 +26,11 @@ namespace Audio
         : m_preloadRequests(preloadRequests)
         , m_currentByteTotal(0)
         , m_maxByteTotal(0)
+        , m_useStamp(0)
+        , m_cacheHits(0)
+        , m_cacheMisses(0)
+        , m_evictions(0)
+        , m_fragmentedAllocations(0)
     {
     }
 
@@ -315,7 +320,7 @@ namespace Audio
                 // Only "use-counted" files can become removable!
                 if (audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_USE_COUNTED))
                 {
-                    audioFileEntry->m_flags.AddFlags(eAFF_REMOVABLE);
+                    MarkRemovable(audioFileEntry);
                 }
 
                 if (now || ignoreUsedCount)
@@ -394,6 +399,12 @@ namespace Audio
                 "FileCacheManager (%" PRISIZE_T " of %" PRISIZE_T " KiB) [Entries: %" PRISIZE_T "]", m_currentByteTotal >> 10, m_maxByteTotal >> 10, m_audioFileEntries.size());
             positionY += 15.0f;
 
+            const size_t totalRequests = m_cacheHits + m_cacheMisses;
+            auxGeom.Draw2dLabel(posX, positionY, 1.4f, orange, false,
+                "Hit rate: %.1f%% (%" PRISIZE_T " hits, %" PRISIZE_T " loads)  Evictions: %" PRISIZE_T "  Fragmented allocations: %" PRISIZE_T,
+                totalRequests > 0 ? (100.0f * m_cacheHits) / totalRequests : 0.0f, m_cacheHits, m_cacheMisses, m_evictions, m_fragmentedAllocations);
+            positionY += 15.0f;
+
             bool displayAll = (g_audioCVars.m_nFileCacheManagerDebugFilter == eAFCMDF_ALL);
             bool displayGlobals = ((g_audioCVars.m_nFileCacheManagerDebugFilter & eAFCMDF_GLOBALS) != 0);
             bool displayLevels = ((g_audioCVars.m_nFileCacheManagerDebugFilter & eAFCMDF_LEVEL_SPECIFICS) != 0);
@@ -509,7 +520,10 @@ namespace Audio
             if (requestSize <= maxAvailableSize)
             {
                 // Here we need to cleanup first before allowing the new request to be allocated.
-                TryToUncacheFiles();
+                // Only evict as many of the least recently used entries as needed to make room.
+                while ((m_maxByteTotal - m_currentByteTotal) < requestSize && UncacheLeastRecentlyUsedFile())
+                {
+                }
 
                 // We should only indicate success if there's actually really enough room for the new entry!
                 success = (m_maxByteTotal - m_currentByteTotal) >= requestSize;
@@ -621,13 +635,13 @@ namespace Audio
             audioFileEntry->m_memoryBlock.reset(m_memoryHeap->AllocateBlock(audioFileEntry->m_fileSize, audioFileEntry->m_filePath.c_str(), audioFileEntry->m_memoryBlockAlignment));
         }
 
-        if (!audioFileEntry->m_memoryBlock)
+        if (!audioFileEntry->m_memoryBlock && m_memoryHeap)
         {
-            // Memory block is either full or too fragmented, let's try to throw everything out that can be removed and allocate again.
-            TryToUncacheFiles();
+            // The byte budget said it fits, so the heap is too fragmented for this block.
+            ++m_fragmentedAllocations;
 
-            // And try again!
-            if (m_memoryHeap)
+            // Throw out removable entries, oldest first, until the allocation succeeds.
+            while (!audioFileEntry->m_memoryBlock && UncacheLeastRecentlyUsedFile())
             {
                 audioFileEntry->m_memoryBlock.reset(m_memoryHeap->AllocateBlock(audioFileEntry->m_fileSize, audioFileEntry->m_filePath.c_str(), audioFileEntry->m_memoryBlockAlignment));
             }
@@ -672,17 +686,36 @@ namespace Audio
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
-    void CFileCacheManager::TryToUncacheFiles()
+    bool CFileCacheManager::UncacheLeastRecentlyUsedFile()
     {
+        CATLAudioFileEntry* oldestEntry = nullptr;
+
         for (auto& audioFileEntryPair : m_audioFileEntries)
         {
             CATLAudioFileEntry* const audioFileEntry = audioFileEntryPair.second;
 
-            if (audioFileEntry && audioFileEntry->m_flags.AreAllFlagsActive(eAFF_CACHED | eAFF_REMOVABLE))
+            if (audioFileEntry && audioFileEntry->m_flags.AreAllFlagsActive(eAFF_CACHED | eAFF_REMOVABLE)
+                && (!oldestEntry || audioFileEntry->m_lastUseStamp < oldestEntry->m_lastUseStamp))
             {
-                UncacheFileCacheEntryInternal(audioFileEntry, true);
+                oldestEntry = audioFileEntry;
             }
         }
+
+        if (oldestEntry)
+        {
+            UncacheFileCacheEntryInternal(oldestEntry, true);
+            ++m_evictions;
+            return true;
+        }
+
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CFileCacheManager::MarkRemovable(CATLAudioFileEntry* const audioFileEntry)
+    {
+        audioFileEntry->m_flags.AddFlags(eAFF_REMOVABLE);
+        audioFileEntry->m_lastUseStamp = ++m_useStamp;
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -723,6 +756,8 @@ namespace Audio
             && audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_NOTCACHED)
             && !audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_CACHED | eAFF_LOADING))
         {
+            ++m_cacheMisses;
+
             if (DoesRequestFitInternal(audioFileEntry->m_fileSize) && AllocateMemoryBlockInternal(audioFileEntry))
             {
                 StreamReadParams streamReadParams;
@@ -764,6 +799,7 @@ namespace Audio
         {
             // The user should be made aware of it.
             g_audioLogger.Log(eALT_COMMENT, "AFCM: Could not cache '%s' as it is either already loaded or currently loading!", audioFileEntry->m_filePath.c_str());
+            ++m_cacheHits;
             success = true;
         }
         else if (audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_NOTFOUND))
@@ -791,7 +827,7 @@ namespace Audio
             }
             else
             {
-                audioFileEntry->m_flags.AddFlags(eAFF_REMOVABLE);
+                MarkRemovable(audioFileEntry);
             }
         }
 
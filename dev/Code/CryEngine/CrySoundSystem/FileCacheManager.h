@@ -79,7 +79,8 @@ namespace Audio
         bool FinishStreamInternal(const IReadStreamPtr readStream, const unsigned int error);
         bool AllocateMemoryBlockInternal(CATLAudioFileEntry* const __restrict audioFileEntry);
         void UncacheFile(CATLAudioFileEntry* const audioFileEntry);
-        void TryToUncacheFiles();
+        bool UncacheLeastRecentlyUsedFile();
+        void MarkRemovable(CATLAudioFileEntry* const audioFileEntry);
         void UpdateLocalizedFileEntryData(CATLAudioFileEntry* const audioFileEntry);
         bool TryCacheFileCacheEntryInternal(CATLAudioFileEntry* const audioFileEntry, const TAudioFileEntryID fileID, const bool loadSynchronously, const bool overrideUseCount = false, const size_t useCount = 0);
 
@@ -90,5 +91,12 @@ namespace Audio
         AZStd::unique_ptr<CCustomMemoryHeap> m_memoryHeap;
         size_t m_currentByteTotal;
         size_t m_maxByteTotal;
+
+        // Eviction order and statistics for the debug overlay.
+        AZ::u64 m_useStamp;
+        size_t m_cacheHits;
+        size_t m_cacheMisses;
+        size_t m_evictions;
+        size_t m_fragmentedAllocations;
     };
 } // namespace Audio
@@ -38,6 +38,7 @@ namespace Audio
         , m_fFullObstructionMaxDistance(0.0f)
         , m_fPositionUpdateThreshold(0.0f)
         , m_fVelocityTrackingThreshold(0.0f)
+        , m_fAudioObjectVirtualizationDistance(0.0f)
         , m_audioListenerTranslationPercentage(0.f)
         , m_audioListenerTranslationZOffset(0.f)
 
@@ -141,6 +142,14 @@ namespace Audio
             "Usage: s_VelocityTrackingThreshold [0/...]\n"
             "Default: 0.1 (10 cm/s)\n");
 
+        REGISTER_CVAR2("s_AudioObjectVirtualizationDistance", &m_fAudioObjectVirtualizationDistance, m_fAudioObjectVirtualizationDistance, VF_CHEAT | VF_CHEAT_NOCHECK,
+            "Audio objects farther than this from the listener become virtual: their position updates are no longer\n"
+            "forwarded to the audio middleware and obstruction/occlusion and velocity tracking are skipped.\n"
+            "Playing events are not stopped, so once the object comes back into range it resumes at the correct time.\n"
+            "Set this to the largest attenuation range used by the project's sounds.\n"
+            "Usage: s_AudioObjectVirtualizationDistance [0/...]\n"
+            "Default: 0 (off)\n");
+
         REGISTER_CVAR2("s_FileCacheManagerSize", &m_nFileCacheManagerSize, m_nFileCacheManagerSize, VF_REQUIRE_APP_RESTART,
             "Sets the size in KiB the AFCM will allocate on the heap.\n"
             "Usage: s_FileCacheManagerSize [0/...]\n"
@@ -314,6 +323,7 @@ namespace Audio
         pConsole->UnregisterVariable("s_FullObstructionMaxDistance");
         pConsole->UnregisterVariable("s_PositionUpdateThreshold");
         pConsole->UnregisterVariable("s_VelocityTrackingThreshold");
+        pConsole->UnregisterVariable("s_AudioObjectVirtualizationDistance");
         pConsole->UnregisterVariable("s_FileCacheManagerSize");
         pConsole->UnregisterVariable("s_AudioObjectPoolSize");
         pConsole->UnregisterVariable("s_AudioEventPoolSize");
@@ -43,6 +43,7 @@ namespace Audio
         float m_fFullObstructionMaxDistance;
         float m_fPositionUpdateThreshold;
         float m_fVelocityTrackingThreshold;
+        float m_fAudioObjectVirtualizationDistance;
 
         float m_audioListenerTranslationZOffset;
         float m_audioListenerTranslationPercentage;
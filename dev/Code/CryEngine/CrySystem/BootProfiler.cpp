@@ -18,6 +18,7 @@
 #include "BootProfiler.h"
 #include "ThreadInfo.h"
 #include <stack>
+#include <time.h>
 #include <AzFramework/IO/FileOperations.h>
 
 
@@ -35,6 +36,46 @@ namespace
 
 int CBootProfiler::CV_sys_bp_frames = 0;
 float CBootProfiler::CV_sys_bp_time_threshold = 0;
+int CBootProfiler::CV_sys_bp_chrome_trace = 0;
+
+namespace
+{
+    // CPU time consumed by the calling thread, used to tell how much of a block was spent working rather than
+    // waiting on IO, locks or other threads. Returns 0 where the platform has no per-thread clock.
+    int64 GetCurrentThreadCpuTimeUS()
+    {
+#if defined(AZ_PLATFORM_WINDOWS)
+        FILETIME creationTime, exitTime, kernelTime, userTime;
+        if (GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+        {
+            const uint64 kernel = (static_cast<uint64>(kernelTime.dwHighDateTime) << 32) | kernelTime.dwLowDateTime;
+            const uint64 user = (static_cast<uint64>(userTime.dwHighDateTime) << 32) | userTime.dwLowDateTime;
+            return static_cast<int64>((kernel + user) / 10); // 100ns units
+        }
+        return 0;
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+        timespec ts;
+        if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+        {
+            return static_cast<int64>(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+        }
+        return 0;
+#else
+        return 0;
+#endif
+    }
+
+    void EscapeJsonString(string& str)
+    {
+        str.replace("\\", "\\\\");
+        str.replace("\"", "\\\"");
+        str.replace("\n", "\\n");
+        str.replace("\r", "\\r");
+        str.replace("\t", "\\t");
+        // AZ::IO::Print treats the buffer as a format string.
+        str.replace("%", "\\u0025");
+    }
+}
 
 class CProfileBlockTimes
 {
@@ -57,6 +98,8 @@ public:
     LARGE_INTEGER m_startTimeStamp;
     LARGE_INTEGER m_stopTimeStamp;
     LARGE_INTEGER m_freq;
+    int64 m_startCpuTimeUS;
+    int64 m_stopCpuTimeUS;
 
     CBootProfilerRecord* m_pParent;
     typedef AZStd::vector<CBootProfilerRecord*> ChildVector;
@@ -64,10 +107,12 @@ public:
 
     CryFixedStringT<256> m_args;
 
-    ILINE CBootProfilerRecord(const char* label, LARGE_INTEGER timestamp, LARGE_INTEGER freq, const char* args)
+    ILINE CBootProfilerRecord(const char* label, LARGE_INTEGER timestamp, LARGE_INTEGER freq, int64 cpuTimeUS, const char* args)
         : m_label(label)
         , m_startTimeStamp(timestamp)
         , m_freq(freq)
+        , m_startCpuTimeUS(cpuTimeUS)
+        , m_stopCpuTimeUS(-1)
         , m_pParent(NULL)
     {
         memset(&m_stopTimeStamp, 0, sizeof(m_stopTimeStamp));
@@ -104,6 +149,8 @@ public:
             return;
         }
 
+        const float cpuTime = GetCpuTimeMS();
+
         string tabs; //tabs(depth++, '\t')
         tabs.insert(0, depth++, '\t');
 
@@ -125,8 +172,8 @@ public:
                 m_args.replace("%", "&#37;");
             }
 
-            sprintf_s(buf, buf_size, "%s<block name=\"%s\" totalTimeMS=\"%f\" startTime=\"%" PRIu64 "\" stopTime=\"%" PRIu64 "\" args=\"%s\"> \n",
-                tabs.c_str(), label.c_str(), time, m_startTimeStamp.QuadPart, m_stopTimeStamp.QuadPart, m_args.c_str());
+            sprintf_s(buf, buf_size, "%s<block name=\"%s\" totalTimeMS=\"%f\" cpuTimeMS=\"%f\" waitTimeMS=\"%f\" startTime=\"%" PRIu64 "\" stopTime=\"%" PRIu64 "\" args=\"%s\"> \n",
+                tabs.c_str(), label.c_str(), time, cpuTime, AZStd::GetMax(time - cpuTime, 0.0f), m_startTimeStamp.QuadPart, m_stopTimeStamp.QuadPart, m_args.c_str());
             AZ::IO::Print(fileHandle, buf);
         }
 
@@ -141,6 +188,43 @@ public:
         sprintf_s(buf, buf_size, "%s</block>\n", tabs.c_str());
         AZ::IO::Print(fileHandle, buf);
     }
+
+    // Thread CPU time spent inside the block, 0 for blocks that were still open when the session stopped.
+    float GetCpuTimeMS() const
+    {
+        return m_stopCpuTimeUS >= 0 ? (float)(m_stopCpuTimeUS - m_startCpuTimeUS) / 1000.f : 0.f;
+    }
+
+    // Writes the block and its children as Chrome trace "complete" events (chrome://tracing, Perfetto).
+    void PrintChromeTrace(AZ::IO::HandleType fileHandle, char* buf, size_t buf_size, unsigned int threadIndex, LARGE_INTEGER sessionStartTime, LARGE_INTEGER stopTime, const float timeThreshold)
+    {
+        if (m_stopTimeStamp.QuadPart == 0)
+        {
+            m_stopTimeStamp = stopTime;
+        }
+
+        const double toMicroseconds = 1000000.0 / (double)m_freq.QuadPart;
+        const double duration = (double)(m_stopTimeStamp.QuadPart - m_startTimeStamp.QuadPart) * toMicroseconds;
+        if (timeThreshold > 0.0f && duration < timeThreshold * 1000.0)
+        {
+            return;
+        }
+
+        string label = m_label;
+        EscapeJsonString(label);
+        string args = m_args.c_str();
+        EscapeJsonString(args);
+
+        sprintf_s(buf, buf_size, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"cpuTimeMS\":%f,\"args\":\"%s\"}}",
+            label.c_str(), threadIndex, (double)(m_startTimeStamp.QuadPart - sessionStartTime.QuadPart) * toMicroseconds, duration, GetCpuTimeMS(), args.c_str());
+        AZ::IO::Print(fileHandle, buf);
+
+        for (CBootProfilerRecord* record : m_Childs)
+        {
+            assert(record);
+            record->PrintChromeTrace(fileHandle, buf, buf_size, threadIndex, sessionStartTime, stopTime, timeThreshold);
+        }
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -257,9 +341,11 @@ public:
     CBootProfilerRecord* StartBlock(const char* name, const char* args);
     void StopBlock(CBootProfilerRecord* record);
 
-    void CollectResults(const char* filename, const float timeThreshold);
+    void CollectResults(const char* filename, const float timeThreshold, bool chromeTrace);
 
 private:
+    void CollectChromeTrace(const char* filename, const float timeThreshold);
+
     string m_name;
 
     CProfileInfo m_threadsProfileInfo[eMAX_THREADS_TO_PROFILE];
@@ -330,7 +416,7 @@ CBootProfilerRecord* CBootProfilerSession::StartBlock(const char* name, const ch
         }
 
         CBootProfilerRecord* rec = pool->allocateRecord();
-        profile.m_pRoot = profile.m_pCurrent = new(rec)CBootProfilerRecord("root", m_startTimeStamp, m_freq, args);
+        profile.m_pRoot = profile.m_pCurrent = new(rec)CBootProfilerRecord("root", m_startTimeStamp, m_freq, 0, args);
     }
 
     assert(pool);
@@ -354,7 +440,7 @@ CBootProfilerRecord* CBootProfilerSession::StartBlock(const char* name, const ch
         rec = pool->allocateRecord();
     }
 
-    profile.m_pCurrent = new(rec)CBootProfilerRecord(name, time, freq, args);
+    profile.m_pCurrent = new(rec)CBootProfilerRecord(name, time, freq, GetCurrentThreadCpuTimeUS(), args);
     profile.m_pCurrent->m_pParent = pParent;
     pParent->m_Childs.push_back(profile.m_pCurrent);
 
@@ -368,6 +454,7 @@ void CBootProfilerSession::StopBlock(CBootProfilerRecord* record)
         LARGE_INTEGER time;
         QueryPerformanceCounter(&time);
         record->m_stopTimeStamp = time;
+        record->m_stopCpuTimeUS = GetCurrentThreadCpuTimeUS();
 
         unsigned int curThread = CryGetCurrentThreadId();
         unsigned int threadIndex = GetThreadIndexByID(curThread);
@@ -378,8 +465,60 @@ void CBootProfilerSession::StopBlock(CBootProfilerRecord* record)
     }
 }
 
-void CBootProfilerSession::CollectResults(const char* filename, const float timeThreshold)
+void CBootProfilerSession::CollectChromeTrace(const char* filename, const float timeThreshold)
 {
+    static const char* szTestResults = "@cache@\\TestResults";
+    string filePath = string(szTestResults) + "\\" + "bp_" + filename + ".json";
+    char path[ICryPak::g_nMaxPath] = "";
+    gEnv->pCryPak->AdjustFileName(filePath.c_str(), path, AZ_ARRAY_SIZE(path), ICryPak::FLAGS_PATH_REAL | ICryPak::FLAGS_FOR_WRITING);
+    gEnv->pCryPak->MakeDir(szTestResults);
+
+    AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+    gEnv->pFileIO->Open(path, AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, fileHandle);
+    if (fileHandle == AZ::IO::InvalidHandle)
+    {
+        return;
+    }
+
+    char buf[1024];
+    const unsigned int buf_size = sizeof(buf);
+
+    // Starts with a metadata event so every following event can be prefixed with a comma.
+    sprintf_s(buf, buf_size, "{\"traceEvents\":[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"%s\"}}", filename);
+    AZ::IO::Print(fileHandle, buf);
+
+    const size_t numThreads = m_threadCounter;
+    for (size_t i = 0; i < numThreads; ++i)
+    {
+        CBootProfilerRecord* pRoot = m_threadsProfileInfo[i].m_pRoot;
+        if (pRoot)
+        {
+            string threadName = GetThreadNameByIndex(i) ? GetThreadNameByIndex(i) : "UNKNOWN";
+            EscapeJsonString(threadName);
+            sprintf_s(buf, buf_size, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"%s\"}}", (unsigned int)i, threadName.c_str());
+            AZ::IO::Print(fileHandle, buf);
+
+            for (CBootProfilerRecord* record : pRoot->m_Childs)
+            {
+                assert(record);
+                record->PrintChromeTrace(fileHandle, buf, buf_size, (unsigned int)i, m_startTimeStamp, m_stopTimeStamp, timeThreshold);
+            }
+        }
+    }
+
+    sprintf_s(buf, buf_size, "\n]}\n");
+    AZ::IO::Print(fileHandle, buf);
+    gEnv->pFileIO->Close(fileHandle);
+}
+
+void CBootProfilerSession::CollectResults(const char* filename, const float timeThreshold, bool chromeTrace)
+{
+    // The xml writer escapes the record arguments in place, write the trace first.
+    if (chromeTrace)
+    {
+        CollectChromeTrace(filename, timeThreshold);
+    }
+
     static const char* szTestResults = "@cache@\\TestResults";
     string filePath = string(szTestResults) + "\\" + "bp_" + filename + ".xml";
     char path[ICryPak::g_nMaxPath] = "";
@@ -502,7 +641,7 @@ void CBootProfiler::StopSession(const char* sessionName)
                 m_pCurrentSession = NULL;
 
                 session->Stop();
-                session->CollectResults(sessionName, CV_sys_bp_time_threshold);
+                session->CollectResults(sessionName, CV_sys_bp_time_threshold, CV_sys_bp_chrome_trace != 0);
 
                 delete session;
             }
@@ -576,6 +715,7 @@ void CBootProfiler::RegisterCVars()
 {
     REGISTER_CVAR2("sys_bp_frames", &CV_sys_bp_frames, 0, VF_DEV_ONLY, "Starts frame profiling for specified number of frames using BootProfiler");
     REGISTER_CVAR2("sys_bp_time_threshold", &CV_sys_bp_time_threshold, 0.1f, VF_DEV_ONLY, "If greater than 0 don't write blocks that took less time (default 0.1 ms)");
+    REGISTER_CVAR2("sys_bp_chrome_trace", &CV_sys_bp_chrome_trace, 0, VF_DEV_ONLY, "Also write each BootProfiler session as TestResults/bp_(session_name).json in Chrome trace format, viewable in chrome://tracing");
 }
 
 void CBootProfiler::OnSystemEvent(ESystemEvent event, UINT_PTR wparam, UINT_PTR lparam)
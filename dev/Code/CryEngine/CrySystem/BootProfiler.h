@@ -55,6 +55,7 @@ private:
 
     static int                      CV_sys_bp_frames;
     static float                    CV_sys_bp_time_threshold;
+    static int                      CV_sys_bp_chrome_trace;
     CBootProfilerRecord*    m_pFrameRecord;
 
     int m_levelLoadAdditionalFrames;
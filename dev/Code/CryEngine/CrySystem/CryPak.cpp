@@ -2619,6 +2619,10 @@ bool CCryPak::OpenPackCommon(const char* szBindRoot, const char* szFullPath, uns
     {
         m_pLog->LogWithType(IMiniLog::eComment, "Opening pak file %s to %s", szFullPath, szBindRoot ? szBindRoot : "<NIL>");
         desc.pZip = static_cast<CryArchive*>((ICryArchive*)desc.pArchive)->GetCache();
+        if (m_pPakVars->nMapUncompressedEntries && !desc.pZip->IsInMemory())
+        {
+            desc.pZip->MapFile(szFullPath);
+        }
 
         // Insert the pak lexically but before any override paks
         // This allows us to order the paks allowing the later paks
@@ -3150,6 +3154,9 @@ int CZipPseudoFile::Ungetc(int c)
     return c;
 }
 
+// partial reads of block compressed files of at least this many bytes don't decompress the whole file
+#define LZ4_BLOCKS_MIN_PARTIAL_READ (64 * 1024)
+
 CCachedFileData::CCachedFileData(class CCryPak* pPak, ZipDir::Cache* pZip, unsigned int nArchiveFlags, ZipDir::FileEntry* pFileEntry, const char* szFilename)
 {
     m_pPak = pPak;
@@ -3177,11 +3184,12 @@ CCachedFileData::~CCachedFileData()
     }
 
     // forced destruction
-    if (m_pFileData)
+    if (m_pFileData && !m_pFileMapping)
     {
         g_pPakHeap->FreeTemporary(m_pFileData);
-        m_pFileData = NULL;
     }
+    m_pFileData = NULL;
+    m_pFileMapping = NULL;
 
     m_pZip = NULL;
     m_pFileEntry = NULL;
@@ -3239,6 +3247,13 @@ void* CCachedFileData::GetData(bool bRefreshCache, bool decompress, bool decrypt
         AUTO_LOCK_CS(m_csDecompressDecryptLock);
         if (!m_pFileData)
         {
+            // entries stored as they are in a mapped zip are used in place
+            if (void* mappedData = m_pZip->GetMappedFileData(m_pFileEntry, m_pFileMapping))
+            {
+                m_pFileData = mappedData;
+                return m_pFileData;
+            }
+
             // don't try to decompress or decrypt if its not actually compressed or encrypted
             decompress = decompress && m_pFileEntry->IsCompressed();
             decrypt = decrypt && m_pFileEntry->IsEncrypted();
@@ -3292,8 +3307,27 @@ int64 CCachedFileData::ReadData(void* pBuffer, int64 nFileOffset, int64 nReadSiz
     if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
     {
         AUTO_LOCK_CS(m_csDecompressDecryptLock);
+        // copy straight out of the mapping of the zip, if there is one, instead of seeking and reading the file
+        ZipDir::FileMappingPtr pMapping;
+        const char* pMappedData = m_pFileMapping ? static_cast<const char*>(m_pFileData) : m_pZip->GetMappedFileData(m_pFileEntry, pMapping);
+        if (pMappedData)
+        {
+            memcpy(pBuffer, pMappedData + nFileOffset, (size_t)nReadSize);
+        }
         // Uncompressed read.
-        if (ZipDir::ZD_ERROR_SUCCESS != m_pZip->ReadFile(m_pFileEntry, NULL, pBuffer, false, nFileOffset, nReadSize))
+        else if (ZipDir::ZD_ERROR_SUCCESS != m_pZip->ReadFile(m_pFileEntry, NULL, pBuffer, false, nFileOffset, nReadSize))
+        {
+            return -1;
+        }
+    }
+    else if (m_pFileEntry->nMethod == ZipFile::METHOD_LZ4_BLOCKS && !m_pFileData && (nReadSize == nFileSize || nReadSize >= LZ4_BLOCKS_MIN_PARTIAL_READ))
+    {
+        // Whole file reads are decompressed straight into the buffer, large partial reads only decompress the blocks
+        // they overlap. Neither keeps a decompressed copy of the file, small reads still go through GetData.
+        const ZipDir::ErrorEnum nError = nReadSize == nFileSize
+            ? m_pZip->ReadFile(m_pFileEntry, NULL, pBuffer)
+            : m_pZip->ReadFileBlocks(m_pFileEntry, pBuffer, nFileOffset, nReadSize);
+        if (nError != ZipDir::ZD_ERROR_SUCCESS)
         {
             return -1;
         }
@@ -77,7 +77,8 @@ struct CCachedFileData
 
     size_t sizeofThis() const
     {
-        return sizeof(*this) + (m_pFileData && m_pFileEntry ? m_pFileEntry->desc.lSizeUncompressed : 0);
+        // mapped data is owned by the zip file mapping
+        return sizeof(*this) + (m_pFileData && m_pFileEntry && !m_pFileMapping ? m_pFileEntry->desc.lSizeUncompressed : 0);
     }
 
     void GetMemoryUsage(ICrySizer* pSizer) const
@@ -92,6 +93,8 @@ struct CCachedFileData
 
 public:
     void* m_pFileData;
+    // set when m_pFileData points into the mapping of the zip file instead of a temporary allocation
+    ZipDir::FileMappingPtr m_pFileMapping;
 
     // the zip file in which this file is opened
     ZipDir::CachePtr m_pZip;
@@ -60,6 +60,21 @@ namespace FrameProfileRenderConstants
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+void CFrameProfileSystem::AppendHWCounters(char* szText, size_t textSize, CFrameProfiler* pProfiler)
+{
+    const SFrameProfilerHWCounters& hw = pProfiler->m_hwCountersLastFrame;
+    if (!profile_hw_counters || hw.m_cycles <= 0)
+    {
+        return;
+    }
+
+    char buf[128];
+    sprintf_s(buf, "  [IPC %.2f  CacheMiss %.1fk  BrMiss %.1fk]",
+        (float)hw.m_instructions / (float)hw.m_cycles, (float)hw.m_cacheMisses / 1000.0f, (float)hw.m_branchMisses / 1000.0f);
+    azstrcat(szText, textSize, buf);
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CFrameProfileSystem::DrawLabel(float col, float row, float* fColor, float glow, const char* szText, float fScale)
 {
@@ -784,6 +799,7 @@ void CFrameProfileSystem::RenderProfiler(CFrameProfiler* pProfiler, int level, f
             sprintf_s(buf, " (%s)", pProfiler->m_stallCause);
             cry_strcat(szText, buf);
         }
+        AppendHWCounters(szText, AZ_ARRAY_SIZE(szText), pProfiler);
         DrawLabel(col + colTextOfs, row, ValueColor, glow, szText);
 
         // Render min/max values
@@ -889,6 +905,7 @@ void CFrameProfileSystem::RenderProfiler(CFrameProfiler* pProfiler, int level, f
             *szText = 0;
         }
         cry_strcat(szText, GetFullName(pProfiler));
+        AppendHWCounters(szText, AZ_ARRAY_SIZE(szText), pProfiler);
 
         DrawLabel(col + 20 + level, row, TextColor, glow, szText);
 
@@ -65,6 +65,7 @@ CryCriticalSection CFrameProfileSystem::m_staticProfilersLock;
 
 int CFrameProfileSystem::profile_callstack = 0;
 int CFrameProfileSystem::profile_log = 0;
+int CFrameProfileSystem::profile_hw_counters = 0;
 threadID CFrameProfileSystem::s_nFilterThreadId = 0;
 
 //////////////////////////////////////////////////////////////////////////
@@ -190,6 +191,9 @@ void CFrameProfileSystem::Init(ISystem* pSystem, int nThreadSupport)
 
     REGISTER_CVAR(profile_callstack, 0, 0, "Logs all Call Stacks of the selected profiler function for one frame");
     REGISTER_CVAR(profile_log, 0, 0, "Logs profiler output");
+    REGISTER_CVAR(profile_hw_counters, 0, 0,
+        "Samples CPU hardware counters (IPC, cache misses, branch mispredicts) per profiler section.\n"
+        "Adds a system call per section start/end, so timings are inflated while enabled. Linux only.");
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -436,6 +440,8 @@ void CFrameProfileSystem::Reset()
             pProfiler->m_displayedValue = 0;
             pProfiler->m_variance = 0;
             pProfiler->m_peak = 0;
+            memset(&pProfiler->m_hwCounters, 0, sizeof(pProfiler->m_hwCounters));
+            memset(&pProfiler->m_hwCountersLastFrame, 0, sizeof(pProfiler->m_hwCountersLastFrame));
         }
     }
     // Iterate over all profilers update their history and reset them.
@@ -578,6 +584,10 @@ void CFrameProfileSystem::StartProfilerSection(CFrameProfilerSection* pSection)
     // Push section on stack for current thread.
     s_pFrameProfileSystem->m_ProfilerThreads.PushSection(pSection, nThreadId);
     pSection->m_excludeTime = 0;
+    if (!profile_hw_counters || !HWCounterSampler::Read(pSection->m_hwStart))
+    {
+        pSection->m_hwStart.m_cycles = -1;
+    }
     pSection->m_startTime = CryGetTicks();
 }
 
@@ -608,6 +618,18 @@ void CFrameProfileSystem::AccumulateProfilerSection(CFrameProfilerSection* pSect
         return;
     }
 
+    if (pSection->m_hwStart.m_cycles >= 0)
+    {
+        SFrameProfilerHWCounters hwEnd;
+        if (HWCounterSampler::Read(hwEnd))
+        {
+            pProfiler->m_hwCounters.m_cycles += hwEnd.m_cycles - pSection->m_hwStart.m_cycles;
+            pProfiler->m_hwCounters.m_instructions += hwEnd.m_instructions - pSection->m_hwStart.m_instructions;
+            pProfiler->m_hwCounters.m_cacheMisses += hwEnd.m_cacheMisses - pSection->m_hwStart.m_cacheMisses;
+            pProfiler->m_hwCounters.m_branchMisses += hwEnd.m_branchMisses - pSection->m_hwStart.m_branchMisses;
+        }
+    }
+
     assert(GetCurrentThreadId() == pProfiler->m_threadId);
 
     int64 totalTime = endTime - pSection->m_startTime;
@@ -993,6 +1015,7 @@ void CFrameProfileSystem::EndFrame()
                     pProfiler->m_totalTime  = 0;
                     pProfiler->m_selfTime   = 0;
                     pProfiler->m_count  = 0;
+                    memset(&pProfiler->m_hwCounters, 0, sizeof(pProfiler->m_hwCounters));
                 }
             }
         }
@@ -1167,6 +1190,11 @@ void CFrameProfileSystem::EndFrame()
                         pOtherThread->m_selfTime = 0;
                         pThread->m_totalTime += pOtherThread->m_totalTime;
                         pOtherThread->m_totalTime = 0;
+                        pThread->m_hwCounters.m_cycles += pOtherThread->m_hwCounters.m_cycles;
+                        pThread->m_hwCounters.m_instructions += pOtherThread->m_hwCounters.m_instructions;
+                        pThread->m_hwCounters.m_cacheMisses += pOtherThread->m_hwCounters.m_cacheMisses;
+                        pThread->m_hwCounters.m_branchMisses += pOtherThread->m_hwCounters.m_branchMisses;
+                        memset(&pOtherThread->m_hwCounters, 0, sizeof(pOtherThread->m_hwCounters));
                         pOtherThread->m_displayedValue = 0;
                     }
                 }
@@ -1329,6 +1357,8 @@ void CFrameProfileSystem::EndFrame()
             pProfiler->m_selfTime = 0;
             pProfiler->m_peak = 0;
             pProfiler->m_count = 0;
+            pProfiler->m_hwCountersLastFrame = pProfiler->m_hwCounters;
+            memset(&pProfiler->m_hwCounters, 0, sizeof(pProfiler->m_hwCounters));
         }
     }
 
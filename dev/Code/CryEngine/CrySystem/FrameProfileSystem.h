@@ -16,6 +16,7 @@
 #pragma once
 
 #include "FrameProfiler.h"
+#include "HWCounterSampler.h"
 #include <AzFramework/Input/Events/InputChannelEventListener.h>
 
 #ifdef USE_FRAME_PROFILER
@@ -61,6 +62,7 @@ public:
     // Cvars.
     static int profile_callstack;
     static int profile_log;
+    static int profile_hw_counters;
 
     //struct SPeakRecord
     //{
@@ -255,6 +257,10 @@ public:
                 {
                     pSection->m_startTime = now;
                     pSection->m_excludeTime = 0;
+                    if (pSection->m_hwStart.m_cycles >= 0 && !HWCounterSampler::Read(pSection->m_hwStart))
+                    {
+                        pSection->m_hwStart.m_cycles = -1;
+                    }
                 }
             }
         }
@@ -483,6 +489,8 @@ public:
     void    CalcDisplayedProfilers();
     void    DrawGraph();
     void    DrawLabel(float raw, float column, float* fColor, float glow, const char* szText, float fScale = 1.0f);
+    //! Appends last frame hardware counter values (profile_hw_counters) to a profiler label.
+    void    AppendHWCounters(char* szText, size_t textSize, CFrameProfiler* pProfiler);
     void    DrawRect(float x1, float y1, float x2, float y2, float* fColor);
     CFrameProfiler* GetSelectedProfiler();
     // Recursively add frame profiler and childs to displayed list.
@@ -0,0 +1,172 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+// Original file Copyright Crytek GMBH or its affiliates, used under license.
+
+#include "StdAfx.h"
+#include "HWCounterSampler.h"
+
+#include <FrameProfiler.h>
+
+#if defined(LINUX)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <string.h>
+#endif
+
+#if defined(LINUX)
+
+namespace
+{
+    enum
+    {
+        eCounter_Cycles,
+        eCounter_Instructions,
+        eCounter_CacheMisses,
+        eCounter_BranchMisses,
+        eCounter_Count
+    };
+
+    int OpenCounter(uint64 config, int groupFd)
+    {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.disabled = groupFd == -1 ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        // pid 0 / cpu -1: measure the calling thread on whichever CPU it runs.
+        return (int)syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0);
+    }
+
+    // One counter group per thread, closed when the thread exits.
+    struct SThreadCounterGroup
+    {
+        int m_fds[eCounter_Count];
+        bool m_bInitialized;
+        bool m_bAvailable;
+
+        SThreadCounterGroup()
+            : m_bInitialized(false)
+            , m_bAvailable(false)
+        {
+            for (int i = 0; i < eCounter_Count; ++i)
+            {
+                m_fds[i] = -1;
+            }
+        }
+
+        ~SThreadCounterGroup()
+        {
+            Close();
+        }
+
+        void Close()
+        {
+            for (int i = eCounter_Count - 1; i >= 0; --i)
+            {
+                if (m_fds[i] >= 0)
+                {
+                    close(m_fds[i]);
+                    m_fds[i] = -1;
+                }
+            }
+            m_bAvailable = false;
+        }
+
+        bool Open()
+        {
+            if (m_bInitialized)
+            {
+                return m_bAvailable;
+            }
+            m_bInitialized = true;
+
+            static const uint64 configs[eCounter_Count] =
+            {
+                PERF_COUNT_HW_CPU_CYCLES,
+                PERF_COUNT_HW_INSTRUCTIONS,
+                PERF_COUNT_HW_CACHE_MISSES,
+                PERF_COUNT_HW_BRANCH_MISSES
+            };
+
+            m_fds[0] = OpenCounter(configs[0], -1);
+            if (m_fds[0] < 0)
+            {
+                // No PMU access (virtualized, or perf_event_paranoid too strict); don't retry.
+                return false;
+            }
+            for (int i = 1; i < eCounter_Count; ++i)
+            {
+                m_fds[i] = OpenCounter(configs[i], m_fds[0]);
+                if (m_fds[i] < 0)
+                {
+                    Close();
+                    return false;
+                }
+            }
+
+            ioctl(m_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+            m_bAvailable = true;
+            return true;
+        }
+    };
+
+    thread_local SThreadCounterGroup s_threadCounters;
+}
+
+bool HWCounterSampler::IsAvailable()
+{
+    return s_threadCounters.Open();
+}
+
+bool HWCounterSampler::Read(SFrameProfilerHWCounters& counters)
+{
+    memset(&counters, 0, sizeof(counters));
+    if (!s_threadCounters.Open())
+    {
+        return false;
+    }
+
+    // PERF_FORMAT_GROUP layout: number of counters followed by their values.
+    uint64 values[1 + eCounter_Count];
+    if (read(s_threadCounters.m_fds[0], values, sizeof(values)) != (ssize_t)sizeof(values) || values[0] != eCounter_Count)
+    {
+        return false;
+    }
+
+    counters.m_cycles = (int64)values[1 + eCounter_Cycles];
+    counters.m_instructions = (int64)values[1 + eCounter_Instructions];
+    counters.m_cacheMisses = (int64)values[1 + eCounter_CacheMisses];
+    counters.m_branchMisses = (int64)values[1 + eCounter_BranchMisses];
+    return true;
+}
+
+#else
+
+bool HWCounterSampler::IsAvailable()
+{
+    return false;
+}
+
+bool HWCounterSampler::Read(SFrameProfilerHWCounters& counters)
+{
+    memset(&counters, 0, sizeof(counters));
+    return false;
+}
+
+#endif // defined(LINUX)
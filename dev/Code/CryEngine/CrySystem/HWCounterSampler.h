@@ -0,0 +1,36 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+// Original file Copyright Crytek GMBH or its affiliates, used under license.
+
+#ifndef CRYINCLUDE_CRYSYSTEM_HWCOUNTERSAMPLER_H
+#define CRYINCLUDE_CRYSYSTEM_HWCOUNTERSAMPLER_H
+#pragma once
+
+struct SFrameProfilerHWCounters;
+
+//////////////////////////////////////////////////////////////////////////
+// Reads CPU performance monitoring counters (cycles, retired instructions,
+// cache misses, branch mispredicts) for the calling thread.
+// Counters are opened lazily per thread as a single group so all values
+// are read with one system call and stay consistent with each other.
+// Only implemented on Linux (perf_event); elsewhere IsAvailable() is false
+// and Read() returns zeros.
+//////////////////////////////////////////////////////////////////////////
+namespace HWCounterSampler
+{
+    //! True if counters can be opened for the calling thread.
+    bool IsAvailable();
+    //! Snapshot the calling thread's counters. Returns false (and zeros) if unavailable.
+    bool Read(SFrameProfilerHWCounters& counters);
+}
+
+#endif // CRYINCLUDE_CRYSYSTEM_HWCOUNTERSAMPLER_H
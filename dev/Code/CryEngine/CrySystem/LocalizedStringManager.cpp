@@ -43,6 +43,7 @@ const char c_sys_localization_debug[] = "sys_localization_debug";
 const char c_sys_localization_encode[] = "sys_localization_encode";
 #define LOC_WINDOW "Localization"
 const char c_sys_localization_format[] = "sys_localization_format";
+const char c_sys_localization_resident_languages[] = "sys_localization_resident_languages";
 
 enum ELocalizedXmlColumns
 {
@@ -218,8 +219,10 @@ void CLocalizedStringsManager::LocalizationDumpLoadedInfo(IConsoleCmdArgs* pArgs
 
 //////////////////////////////////////////////////////////////////////
 CLocalizedStringsManager::CLocalizedStringsManager(ISystem* pSystem)
-    : m_cvarLocalizationDebug(0)
+    : m_nLanguageActivations(0)
+    , m_cvarLocalizationDebug(0)
     , m_cvarLocalizationEncode(1)
+    , m_cvarLocalizationResidentLanguages(2)
     , m_availableLocalizations(0)
 {
     m_pSystem = pSystem;
@@ -260,6 +263,13 @@ CLocalizedStringsManager::CLocalizedStringsManager(ISystem* pSystem)
         "    0: Crytek Legacy Localization (Excel 2003)\n"
         "    1: AGS XML\n"
         "Default is 1 (AGS Xml)");
+
+    REGISTER_CVAR2(c_sys_localization_resident_languages, &m_cvarLocalizationResidentLanguages, m_cvarLocalizationResidentLanguages, VF_NULL,
+        "Number of languages whose string tables stay loaded after switching language.\n"
+        "Switching back to a resident language reuses its strings instead of reparsing every table.\n"
+        "Usage: sys_localization_resident_languages [1..n]\n"
+        "1: only the current language is kept, every switch reparses the tables\n"
+        "Default is 2 (current and previous language).");
     //Check that someone hasn't added a language ID without a language name
     assert(PLATFORM_INDEPENDENT_LANGUAGE_NAMES[ ILocalizationManager::ePILID_MAX_OR_INVALID - 1 ] != 0);
 
@@ -320,19 +330,27 @@ void CLocalizedStringsManager::FreeLocalizationData()
 
     for (uint32 i = 0; i < m_languages.size(); i++)
     {
-        if (m_cvarLocalizationEncode == 1)
+        FreeLanguageData(m_languages[i]);
+    }
+    m_loadedTables.clear();
+}
+
+//////////////////////////////////////////////////////////////////////
+void CLocalizedStringsManager::FreeLanguageData(SLanguage* pLanguage)
+{
+    AutoLock lock(m_cs);    //Make sure to lock, as this is a modifying operation
+
+    if (m_cvarLocalizationEncode == 1)
+    {
+        for (uint8 iEncoder = 0; iEncoder < pLanguage->m_vEncoders.size(); iEncoder++)
         {
-            auto pLanguage = m_languages[i];
-            for (uint8 iEncoder = 0; iEncoder < pLanguage->m_vEncoders.size(); iEncoder++)
-            {
-                SAFE_DELETE(pLanguage->m_vEncoders[iEncoder]);
-            }
+            SAFE_DELETE(pLanguage->m_vEncoders[iEncoder]);
         }
-        std::for_each(m_languages[i]->m_vLocalizedStrings.begin(), m_languages[i]->m_vLocalizedStrings.end(), stl::container_object_deleter());
-        m_languages[i]->m_keysMap.clear();
-        m_languages[i]->m_vLocalizedStrings.clear();
     }
-    m_loadedTables.clear();
+    std::for_each(pLanguage->m_vLocalizedStrings.begin(), pLanguage->m_vLocalizedStrings.end(), stl::container_object_deleter());
+    pLanguage->m_keysMap.clear();
+    pLanguage->m_vLocalizedStrings.clear();
+    pLanguage->m_loadedTables.clear();
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -786,8 +804,20 @@ bool CLocalizedStringsManager::ReleaseLocalizationDataByTag(
     }
     m_loadedTables = newLoadedTables;
 
+    // Resident languages other than the current one still hold strings for this tag; drop them rather than
+    // stripping each one, they get reloaded from the remaining tables when switched back to.
+    for (uint32 i = 0; i < m_languages.size(); i++)
+    {
+        if (m_languages[i] != m_pLanguage && !m_languages[i]->m_loadedTables.empty())
+        {
+            FreeLanguageData(m_languages[i]);
+        }
+    }
+
     if (m_pLanguage)
     {
+        m_pLanguage->m_loadedTables = m_loadedTables;
+
         //LARGE_INTEGER liStart;
         //QueryPerformanceCounter(&liStart);
         AutoLock lock(m_cs);    //Make sure to lock, as this is a modifying operation
@@ -1001,6 +1031,7 @@ bool CLocalizedStringsManager::DoLoadExcelXmlSpreadsheet(const char* sFileName,
         sNewFile.second.bDataStripping = false; // this is off for now
         sNewFile.second.nTagID = nTagID;
         m_loadedTables.insert(sNewFile);
+        m_pLanguage->m_loadedTables.insert(sNewFile);
     }
 
     // Cell Index
@@ -1658,6 +1689,7 @@ bool CLocalizedStringsManager::DoLoadAGSXmlDocument(const char* sFileName, uint8
         sNewFile.second.bDataStripping = false; // this is off for now
         sNewFile.second.nTagID = nTagID;
         m_loadedTables.insert(sNewFile);
+        m_pLanguage->m_loadedTables.insert(sNewFile);
     }
     const char* key = nullptr;
     AZStd::string keyString;
@@ -1786,6 +1818,82 @@ void CLocalizedStringsManager::ReloadData()
     }
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CLocalizedStringsManager::ActivateLanguageData()
+{
+    if (!m_pLanguage)
+    {
+        return;
+    }
+
+    m_pLanguage->m_nActivationStamp = ++m_nLanguageActivations;
+
+    // A language kept resident from an earlier switch only needs reloading if the set of tables changed since.
+    bool bResident = m_pLanguage->m_loadedTables.size() == m_loadedTables.size();
+    for (tmapFilenames::const_iterator it = m_loadedTables.begin(); bResident && it != m_loadedTables.end(); ++it)
+    {
+        tmapFilenames::const_iterator found = m_pLanguage->m_loadedTables.find(it->first);
+        bResident = found != m_pLanguage->m_loadedTables.end() && found->second.nTagID == it->second.nTagID;
+    }
+
+    if (bResident)
+    {
+        if (m_cvarLocalizationDebug >= 2)
+        {
+            CryLog("<Localization> Reusing %" PRISIZE_T " resident strings for <%s>", m_pLanguage->m_vLocalizedStrings.size(), m_pLanguage->sLanguage.c_str());
+        }
+    }
+    else
+    {
+        tmapFilenames temp = m_loadedTables;
+
+        LoadFunc loadFunction = GetLoadFunction();
+        FreeLanguageData(m_pLanguage);
+        for (tmapFilenames::iterator it = temp.begin(); it != temp.end(); it++)
+        {
+            (this->*loadFunction)((*it).first, (*it).second.nTagID, true);
+        }
+    }
+
+    EvictResidentLanguages();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLocalizedStringsManager::EvictResidentLanguages()
+{
+    const uint32 maxResident = static_cast<uint32>(std::max(m_cvarLocalizationResidentLanguages, 1));
+    for (;; )
+    {
+        uint32 numResident = 0;
+        SLanguage* pOldest = nullptr;
+        for (uint32 i = 0; i < m_languages.size(); i++)
+        {
+            SLanguage* pLanguage = m_languages[i];
+            if (pLanguage == m_pLanguage || pLanguage->m_loadedTables.empty())
+            {
+                continue;
+            }
+            ++numResident;
+            if (!pOldest || pLanguage->m_nActivationStamp < pOldest->m_nActivationStamp)
+            {
+                pOldest = pLanguage;
+            }
+        }
+
+        // The current language always counts as one of the resident languages.
+        if (!pOldest || numResident + 1 <= maxResident)
+        {
+            break;
+        }
+
+        if (m_cvarLocalizationDebug >= 2)
+        {
+            CryLog("<Localization> Releasing resident strings for <%s>", pOldest->sLanguage.c_str());
+        }
+        FreeLanguageData(pOldest);
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CLocalizedStringsManager::AddLocalizedString(SLanguage* pLanguage, SLocalizedStringEntry* pEntry, const uint32 keyCRC32)
 {
@@ -2554,7 +2662,7 @@ void CLocalizedStringsManager::InternalSetCurrentLanguage(CLocalizedStringsManag
         setlocale(LC_ALL, "C");
     }
 #endif
-    ReloadData();
+    ActivateLanguageData();
     if (gEnv->pCryFont)
     {
         gEnv->pCryFont->OnLanguageChanged();
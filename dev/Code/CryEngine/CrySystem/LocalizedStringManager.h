@@ -227,6 +227,15 @@ private:
     //Keys as CRC32. Strings previously, but these proved too large
     typedef VectorMap<uint32, SLocalizedStringEntry*>   StringsKeyMap;
 
+    struct SFileInfo
+    {
+        bool    bDataStripping;
+        uint8 nTagID;
+    };
+
+    typedef std::pair<string, SFileInfo> pairFileName;
+    typedef std::map<string, SFileInfo> tmapFilenames;
+
     struct SLanguage
     {
         typedef std::vector<SLocalizedStringEntry*> TLocalizedStringEntries;
@@ -237,6 +246,17 @@ private:
         TLocalizedStringEntries m_vLocalizedStrings;
         THuffmanCoders m_vEncoders;
 
+        // Tables whose strings are currently held by this language. Lets a language that is switched back to
+        // keep its parsed strings instead of reloading every table.
+        tmapFilenames m_loadedTables;
+        // Value of m_nLanguageActivations when this language was last made current; used to evict the least recently used one.
+        uint32 m_nActivationStamp;
+
+        SLanguage()
+            : m_nActivationStamp(0)
+        {
+        }
+
         void GetMemoryUsage(ICrySizer* pSizer) const
         {
             pSizer->AddObject(this, sizeof(*this));
@@ -247,12 +267,6 @@ private:
         }
     };
 
-    struct SFileInfo
-    {
-        bool    bDataStripping;
-        uint8 nTagID;
-    };
-
 #ifndef _RELEASE
     std::map<string, bool> m_warnedAboutLabels;
     bool m_haveWarnedAboutAtLeastOneLabel;
@@ -269,13 +283,14 @@ private:
     //////////////////////////////////////////////////////////////////////////
     void ParseFirstLine(IXmlTableReader* pXmlTableReader, char* nCellIndexToType, std::map<int, string>& SoundMoodIndex, std::map<int, string>& EventParameterIndex);
     void InternalSetCurrentLanguage(SLanguage* pLanguage);
+    void FreeLanguageData(SLanguage* pLanguage);
+    void ActivateLanguageData();
+    void EvictResidentLanguages();
     ISystem* m_pSystem;
     // Pointer to the current language.
     SLanguage* m_pLanguage;
 
     // all loaded Localization Files
-    typedef std::pair<string, SFileInfo> pairFileName;
-    typedef std::map<string, SFileInfo> tmapFilenames;
     tmapFilenames m_loadedTables;
 
 
@@ -293,6 +308,7 @@ private:
 
     // Array of loaded languages.
     std::vector<SLanguage*> m_languages;
+    uint32 m_nLanguageActivations;
 
     typedef std::set<string> PrototypeSoundEvents;
     PrototypeSoundEvents m_prototypeEvents;  // this set is purely used for clever string/string assigning to save memory
@@ -313,6 +329,7 @@ private:
     int m_cvarLocalizationDebug;
     int m_cvarLocalizationEncode;   //Encode/Compress translated text to save memory
     int m_cvarLocalizationFormat;
+    int m_cvarLocalizationResidentLanguages;    //Number of languages whose parsed strings are kept loaded across language switches
 
     //The localizations that are available for this SKU. Used for determining what to show on a language select screen or whether to show one at all
     TLocalizationBitfield m_availableLocalizations;
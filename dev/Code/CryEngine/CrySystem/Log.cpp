@@ -76,6 +76,7 @@ CLog::CLog(ISystem* pSystem)
     m_pSystem = pSystem;
     m_pLogVerbosity = 0;
     m_pLogWriteToFile = 0;
+    m_pLogWriteToFileAsync = 0;
     m_pLogWriteToFileVerbosity = 0;
     m_pLogVerbosityOverridesWriteToFile = 0;
     m_pLogIncludeTime = 0;
@@ -83,6 +84,7 @@ CLog::CLog(ISystem* pSystem)
     m_pLogModule = 0;
     m_fLastLoadingUpdateTime = -1.f;    // for streaming engine update
     m_backupLogs = true;
+    m_fileWriterQuit = false;
 
 #if defined(SUPPORT_LOG_IDENTER)
     m_indentation = 0;
@@ -134,6 +136,11 @@ void CLog::RegisterConsoleVariables()
         //writing to game.log during game play causes stalls on consoles
         m_pLogWriteToFile = REGISTER_INT("log_WriteToFile", 1, VF_DUMPTODISK, "toggle whether to write log to file (game.log)");
 
+        m_pLogWriteToFileAsync = REGISTER_INT("log_WriteToFileAsync", 0, VF_DUMPTODISK,
+                "toggle whether log file writes are handed to a dedicated writer thread\n"
+                "0=write to the log file on the logging thread (default)\n"
+                "1=queue lines for the writer thread, lines still queued are written on log_flush, crash or shutdown");
+
         m_pLogWriteToFileVerbosity = REGISTER_INT("log_WriteToFileVerbosity", DEFAULT_VERBOSITY, VF_DUMPTODISK,
                 "defines the verbosity level for log messages written to files\n"
                 "-1=suppress all logs (including eAlways)\n"
@@ -212,6 +219,8 @@ CLog::~CLog()
     assert (m_indentation == 0);
 #endif
 
+    StopFileWriter();
+
     CreateBackupFile();
 
     UnregisterConsoleVariables();
@@ -223,6 +232,7 @@ void CLog::UnregisterConsoleVariables()
 {
     m_pLogVerbosity = 0;
     m_pLogWriteToFile = 0;
+    m_pLogWriteToFileAsync = 0;
     m_pLogWriteToFileVerbosity = 0;
     m_pLogVerbosityOverridesWriteToFile = 0;
     m_pLogIncludeTime = 0;
@@ -232,6 +242,7 @@ void CLog::UnregisterConsoleVariables()
 //////////////////////////////////////////////////////////////////////////
 void CLog::CloseLogFile(bool forceClose)
 {
+    AZStd::lock_guard<AZStd::recursive_mutex> fileLock(m_fileWriteLock);
     if (m_logFileHandle != AZ::IO::InvalidHandle)
     {
         AZ::IO::FileIOBase::GetDirectInstance()->Close(m_logFileHandle);
@@ -271,6 +282,124 @@ AZ::IO::HandleType CLog::OpenLogFile(const char* filename, const char* mode)
     return m_logFileHandle;
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CLog::WriteStringToFile(const char* szString, bool bAdd)
+{
+    AZStd::lock_guard<AZStd::recursive_mutex> fileLock(m_fileWriteLock);
+    CDebugAllowFileAccess dafa;
+
+    if (m_logFileHandle == AZ::IO::InvalidHandle)
+    {
+        OpenLogFile(m_szFilename, "w+t");
+    }
+
+    if (m_logFileHandle != AZ::IO::InvalidHandle)
+    {
+#if defined(KEEP_LOG_FILE_OPEN)
+        if (m_bFirstLine)
+        {
+            m_bFirstLine = false;
+        }
+#endif
+        if (bAdd)
+        {
+            // if adding to a prior line erase the \n at the end.
+            AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_logFileHandle, -2, AZ::IO::SeekType::SeekFromEnd);
+        }
+        AZ::IO::FPutS(szString, m_logFileHandle);
+#if !defined(KEEP_LOG_FILE_OPEN)
+        CloseLogFile();
+#endif
+        // do not use FLUSH on log files.  Doing so will slow the engine down greatly when logging.
+        // (the log is flushed automatically when an unhandled exception occurs)
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLog::QueueFileWrite(const char* szString, bool bAdd)
+{
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingFileWritesLock);
+        if (!m_fileWriterThread.joinable())
+        {
+            AZStd::thread_desc desc;
+            desc.m_name = "Log File Writer";
+            m_fileWriterQuit = false;
+            m_fileWriterThread = AZStd::thread([this]() { FileWriterThread(); }, &desc);
+        }
+
+        SPendingFileWrite write;
+        write.text = szString;
+        write.bAdd = bAdd;
+        m_pendingFileWrites.push_back(AZStd::move(write));
+    }
+    m_pendingFileWritesSignal.notify_one();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLog::FlushFileWrites()
+{
+    AZStd::lock_guard<AZStd::recursive_mutex> fileLock(m_fileWriteLock);
+
+    AZStd::vector<SPendingFileWrite> writes;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingFileWritesLock);
+        writes.swap(m_pendingFileWrites);
+    }
+
+    for (const SPendingFileWrite& write : writes)
+    {
+        WriteStringToFile(write.text.c_str(), write.bAdd);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLog::FileWriterThread()
+{
+    AZStd::vector<SPendingFileWrite> writes;
+    for (;; )
+    {
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_pendingFileWritesLock);
+            m_pendingFileWritesSignal.wait(lock, [this]() { return m_fileWriterQuit || !m_pendingFileWrites.empty(); });
+            if (m_pendingFileWrites.empty())
+            {
+                return;
+            }
+        }
+
+        // Take the file before the batch, otherwise a FlushFileWrites from the logging thread could write newer lines ahead of it.
+        AZStd::lock_guard<AZStd::recursive_mutex> fileLock(m_fileWriteLock);
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingFileWritesLock);
+            writes.swap(m_pendingFileWrites);
+        }
+
+        for (const SPendingFileWrite& write : writes)
+        {
+            WriteStringToFile(write.text.c_str(), write.bAdd);
+        }
+        writes.clear();
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CLog::StopFileWriter()
+{
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_pendingFileWritesLock);
+        m_fileWriterQuit = true;
+    }
+    m_pendingFileWritesSignal.notify_all();
+
+    // the writer drains the queue before it exits
+    if (m_fileWriterThread.joinable())
+    {
+        m_fileWriterThread.join();
+    }
+    FlushFileWrites();
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CLog::SetVerbosity(int verbosity)
 {
@@ -1171,32 +1300,15 @@ void CLog::LogStringToFile(const char* szString, ELogType logType, bool bAdd, Me
 
     if (logToFile)
     {
-        CDebugAllowFileAccess dafa;
-
-        if (m_logFileHandle == AZ::IO::InvalidHandle)
+        if (m_pLogWriteToFileAsync && m_pLogWriteToFileAsync->GetIVal())
         {
-            OpenLogFile(m_szFilename, "w+t");
+            QueueFileWrite(tempString.c_str(), bAdd);
         }
-
-        if (m_logFileHandle != AZ::IO::InvalidHandle)
+        else
         {
-#if defined(KEEP_LOG_FILE_OPEN)
-            if (m_bFirstLine)
-            {
-                m_bFirstLine = false;
-            }
-#endif
-            if (bAdd)
-            {
-                // if adding to a prior line erase the \n at the end.
-                AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_logFileHandle, -2, AZ::IO::SeekType::SeekFromEnd);
-            }
-            AZ::IO::FPutS(tempString.c_str(), m_logFileHandle);
-#if !defined(KEEP_LOG_FILE_OPEN)
-            CloseLogFile();
-#endif
-            // do not use FLUSH on log files.  Doing so will slow the engine down greatly when logging.
-            // (the log is flushed automatically when an unhandled exception occurs)
+            AZStd::lock_guard<AZStd::recursive_mutex> fileLock(m_fileWriteLock);
+            FlushFileWrites();
+            WriteStringToFile(tempString.c_str(), bAdd);
         }
     }
 }
@@ -1613,6 +1725,7 @@ const char* CLog::GetModuleFilter()
 
 void CLog::FlushAndClose()
 {
+    FlushFileWrites();
 #if defined(KEEP_LOG_FILE_OPEN)
     if (m_logFileHandle)
     {
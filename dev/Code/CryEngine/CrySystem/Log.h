@@ -18,6 +18,12 @@
 #include <MultiThread.h>
 #include <MultiThread_Containers.h>
 
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/string.h>
+
 //////////////////////////////////////////////////////////////////////
 #if defined(ANDROID) || defined(AZ_PLATFORM_APPLE_OSX)
     #define MAX_TEMP_LENGTH_SIZE    4098
@@ -144,6 +150,20 @@ private: // -------------------------------------------------------------------
     AZ::IO::HandleType OpenLogFile(const char* filename, const char* mode);
     void CloseLogFile(bool force = false);
 
+    // A formatted line waiting for the file writer thread (log_WriteToFileAsync)
+    struct SPendingFileWrite
+    {
+        AZStd::string text;
+        bool bAdd;
+    };
+
+    void WriteStringToFile(const char* szString, bool bAdd);
+    void QueueFileWrite(const char* szString, bool bAdd);
+    // writes any queued lines on the calling thread, keeps the file in order when switching modes or closing
+    void FlushFileWrites();
+    void FileWriterThread();
+    void StopFileWriter();
+
     // will format the message into m_szTemp
     void FormatMessage(const char* szCommand, ...) PRINTF_PARAMS(2, 3);
 
@@ -190,6 +210,13 @@ private: // -------------------------------------------------------------------
 
     CryCriticalSection m_logCriticalSection;
 
+    AZStd::recursive_mutex m_fileWriteLock;                 // held while m_logFileHandle is written, opened or closed
+    AZStd::mutex m_pendingFileWritesLock;
+    AZStd::condition_variable m_pendingFileWritesSignal;
+    AZStd::vector<SPendingFileWrite> m_pendingFileWrites;
+    AZStd::thread m_fileWriterThread;
+    bool m_fileWriterQuit;
+
     struct SLogHistoryItem
     {
         char str[MAX_WARNING_LENGTH];
@@ -229,6 +256,7 @@ public: // -------------------------------------------------------------------
 
     ICVar*                 m_pLogVerbosity;                                             //
     ICVar*                 m_pLogWriteToFile;                                       //
+    ICVar*                 m_pLogWriteToFileAsync;                                  //
     ICVar*                 m_pLogWriteToFileVerbosity;                      //
     ICVar*                 m_pLogVerbosityOverridesWriteToFile;     //
     ICVar*                 m_pLogSpamDelay;                       //
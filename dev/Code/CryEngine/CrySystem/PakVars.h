@@ -55,6 +55,7 @@ struct PakVars
     int nSaveLevelResourceList;
     int nValidateFileHashes;
     int nUncachedStreamReads;
+    int nMapUncompressedEntries;
     int nInMemoryPerPakSizeLimit;
     int nTotalInMemoryPakSizeLimit;
     int nLoadCache;
@@ -89,6 +90,8 @@ struct PakVars
 #endif
 
         nUncachedStreamReads = 1;
+        // Map paks into memory and use their uncompressed entries in place
+        nMapUncompressedEntries = 1;
         // Limits in MB
         nInMemoryPerPakSizeLimit = 6;
         nTotalInMemoryPakSizeLimit = 30;
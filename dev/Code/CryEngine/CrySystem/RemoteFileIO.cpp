@@ -24,6 +24,7 @@
 #include <AzCore/Math/Crc.h>
 #include <AzCore/std/algorithm.h> // for GetMin()
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/functional.h> // for function<> in the find files callback.
 #ifdef REMOTEFILEIO_CACHE_FILETREE
 #include <AzCore/std/string/wildcard.h>
@@ -42,6 +43,7 @@ namespace AZ
 #endif
 
         const size_t READ_CHUNK_SIZE = 1024 * 256;
+        const AZ::u32 READ_PIPELINE_DEPTH = 4;
 
 #ifdef NETWORKFILEIO_LOG
         AZ::OSString s_IOLog;
@@ -266,35 +268,88 @@ namespace AZ
             return ResultCode::Success;
         }
 
+        namespace
+        {
+            //! One chunk request of a pipelined NetworkFileIO::Read
+            struct PipelinedRead
+            {
+                FileReadResponse m_response;
+                AZStd::binary_semaphore m_arrived;
+                AZ::u64 m_requestedSize = 0;
+                bool m_succeeded = false;
+            };
+        }
+
         Result NetworkFileIO::Read(HandleType fileHandle, void* buffer, AZ::u64 size, bool failOnFewerThanSizeBytesRead, AZ::u64* bytesRead)
         {
             REMOTEFILE_LOG_CALL(AZStd::string::format("NetworkFileIO()::Read(filehandle=%i, buffer=OUT, size=%u, failOnFewerThanSizeBytesRead=%s, bytesRead=OUT)", fileHandle, size, failOnFewerThanSizeBytesRead ? "True" : "False").c_str());
-            size_t remainingBytesToRead = size;
+            AZ::u64 remainingBytesToRead = size;
             AZ::u64 actualRead = 0;
-            while(remainingBytesToRead)
+
+            // Large reads are split into chunks and up to READ_PIPELINE_DEPTH chunk requests are kept in flight, so the
+            // round trip to the asset processor is paid once per batch rather than once per chunk. The asset processor
+            // services the requests of a connection in order, so the responses are the consecutive pieces of the file.
+            PipelinedRead pending[READ_PIPELINE_DEPTH];
+            AZ::u32 issued = 0;
+            AZ::u32 consumed = 0;
+            AZ::u64 bytesInFlight = 0;
+            bool requestFailed = false;
+            bool finished = false;
+            ResultCode returnValue = ResultCode::Success;
+
+            do
             {
-                AZ::u64 readSize = GetMin<AZ::u64>(remainingBytesToRead, READ_CHUNK_SIZE);
-                FileReadRequest request(fileHandle, readSize, false);
-                FileReadResponse response;
-                if (!SendRequest(request, response))
+                while (!finished && (remainingBytesToRead > bytesInFlight) && (issued - consumed < READ_PIPELINE_DEPTH))
                 {
-                    AZ_Assert(false, "NetworkFileIO::Read(filehandle=%i, size=%u) request failed. return Error", fileHandle, size);
-                    REMOTEFILE_LOG_APPEND(AZStd::string::format("NetworkFileIO::Read(filehandle=%i, size=%u) request failed. return Error", fileHandle, size).c_str());
-                    return ResultCode::Error;
+                    PipelinedRead& read = pending[issued % READ_PIPELINE_DEPTH];
+                    read.m_requestedSize = GetMin<AZ::u64>(remainingBytesToRead - bytesInFlight, READ_CHUNK_SIZE);
+                    read.m_succeeded = false;
+
+                    FileReadRequest request(fileHandle, read.m_requestedSize, false);
+                    if (!SendRequestAsync(request, read.m_response, [&read](bool succeeded) { read.m_succeeded = succeeded; read.m_arrived.release(); }))
+                    {
+                        requestFailed = true;
+                        finished = true;
+                        break;
+                    }
+                    bytesInFlight += read.m_requestedSize;
+                    ++issued;
+                }
+
+                if (consumed == issued)
+                {
+                    break;
+                }
+
+                // responses still have to be waited for after a failure, since they write into this stack frame
+                PipelinedRead& read = pending[consumed % READ_PIPELINE_DEPTH];
+                read.m_arrived.acquire();
+                ++consumed;
+                bytesInFlight -= read.m_requestedSize;
+
+                if (finished)
+                {
+                    continue;
+                }
+
+                if (!read.m_succeeded)
+                {
+                    requestFailed = true;
+                    finished = true;
+                    continue;
                 }
 
                 //note the response could be ANY size, could be less so be careful
-                AZ::u64 responseDataSize = response.m_data.size();
+                AZ::u64 responseDataSize = read.m_response.m_data.size();
                 if (responseDataSize <= remainingBytesToRead == false)
                 {
                     AZ_TracePrintf(NetworkFileIOChannel, "NetworkFileIO::Read(filehandle=%i, size=%u) responseDataSize too large!!! responseDataSize=%u <= remainingBytesToRead=%u", fileHandle, size, responseDataSize, remainingBytesToRead);
                     REMOTEFILE_LOG_APPEND(AZStd::string::format("NetworkFileIO::Read(filehandle=%i, size=%u) responseDataSize too large!!! responseDataSize=%u <= remainingBytesToRead=%u", fileHandle, size, responseDataSize, remainingBytesToRead).c_str());
+                    responseDataSize = remainingBytesToRead;
                 }
 
-                ResultCode returnValue = static_cast<ResultCode>(response.m_resultCode);
-
                 //only copy as much as we can
-                memcpy(buffer, response.m_data.data(), responseDataSize);
+                memcpy(buffer, read.m_response.m_data.data(), responseDataSize);
                 buffer = reinterpret_cast<char*>(buffer) + responseDataSize;
 
                 //only reduce by what should have come back
@@ -302,27 +357,41 @@ namespace AZ
 
                 //only record read bytes
                 actualRead += responseDataSize;
-                if(bytesRead)
+                if (bytesRead)
                 {
                     *bytesRead = actualRead;
                 }
 
                 //if we get an error, we only return an error if failOnFewerThanSizeBytesRead
-                if(returnValue == ResultCode::Error)
+                if (static_cast<ResultCode>(read.m_response.m_resultCode) == ResultCode::Error)
                 {
                     AZ_TracePrintf(NetworkFileIOChannel, "NetworkFileIO::Read: request failed, fileHandle=%u", fileHandle);
-                    if(failOnFewerThanSizeBytesRead && remainingBytesToRead)
-                    {
-                        REMOTEFILE_LOG_APPEND(AZStd::string::format("NetworkFileIO::Read(fileHandle=%u, size=%u) actualRead=%u failed On Fewer Than Size Bytes Read. return Error", fileHandle, size, actualRead).c_str());
-                        return ResultCode::Error;
-                    }
-                    REMOTEFILE_LOG_APPEND(AZStd::string::format("NetworkFileIO::Read(fileHandle=%u, size=%u) actualRead=%u return Success", fileHandle, size, actualRead).c_str());
-                    return ResultCode::Success;
+                    returnValue = ResultCode::Error;
+                    finished = true;
                 }
-                else if(!responseDataSize)
+                else if (!responseDataSize)
                 {
-                    break;
+                    // end of file, anything still in flight will come back empty
+                    finished = true;
+                }
+            } while (true);
+
+            if (requestFailed)
+            {
+                AZ_Assert(false, "NetworkFileIO::Read(filehandle=%i, size=%u) request failed. return Error", fileHandle, size);
+                REMOTEFILE_LOG_APPEND(AZStd::string::format("NetworkFileIO::Read(filehandle=%i, size=%u) request failed. return Error", fileHandle, size).c_str());
+                return ResultCode::Error;
+            }
+
+            if (returnValue == ResultCode::Error)
+            {
+                if (failOnFewerThanSizeBytesRead && remainingBytesToRead)
+                {
+                    REMOTEFILE_LOG_APPEND(AZStd::string::format("NetworkFileIO::Read(fileHandle=%u, size=%u) actualRead=%u failed On Fewer Than Size Bytes Read. return Error", fileHandle, size, actualRead).c_str());
+                    return ResultCode::Error;
                 }
+                REMOTEFILE_LOG_APPEND(AZStd::string::format("NetworkFileIO::Read(fileHandle=%u, size=%u) actualRead=%u return Success", fileHandle, size, actualRead).c_str());
+                return ResultCode::Success;
             }
 
             if(failOnFewerThanSizeBytesRead && remainingBytesToRead)
@@ -856,6 +925,7 @@ namespace AZ
         //////////////////////////////////////////////////////////////////////////
         const int REFRESH_FILESIZE_TIME = 500;// ms
         const size_t CACHE_LOOKAHEAD_SIZE = 1024 * 256;
+        const size_t CACHE_LOOKAHEAD_MAX_SIZE = READ_CHUNK_SIZE * READ_PIPELINE_DEPTH;
 
         RemoteFileCache::RemoteFileCache(RemoteFileCache&& other)
         {
@@ -870,6 +940,7 @@ namespace AZ
             {
                 m_cacheLookaheadBuffer = AZStd::move(other.m_cacheLookaheadBuffer);
                 m_cacheLookaheadPos = other.m_cacheLookaheadPos;
+                m_cacheLookaheadSize = other.m_cacheLookaheadSize;
                 m_fileSize = other.m_fileSize;
                 m_fileSizeTime = other.m_fileSizeTime;
                 m_filePosition = other.m_filePosition;
@@ -883,6 +954,7 @@ namespace AZ
         {
             m_cacheLookaheadPos = 0;
             m_cacheLookaheadBuffer.clear();
+            m_cacheLookaheadSize = 0;
         }
 
         AZ::u64 RemoteFileCache::RemainingBytes()
@@ -1224,8 +1296,12 @@ namespace AZ
                 AZ::u64 fsize = 0;
                 Size(fileHandle, fsize);
 
+                // grow the read-ahead while the file keeps being read sequentially, so streaming reads
+                // are pipelined on the connection; seeking out of the cache or writing starts over small
+                cache.m_cacheLookaheadSize = cache.m_cacheLookaheadSize ? AZStd::GetMin<AZ::u64>(cache.m_cacheLookaheadSize * 2, CACHE_LOOKAHEAD_MAX_SIZE) : CACHE_LOOKAHEAD_SIZE;
+
                 AZ::u64 remainingFileBytes = cache.m_fileSize - cache.m_filePosition;
-                AZ::u64 readSize = AZStd::GetMin<AZ::u64>(remainingFileBytes, CACHE_LOOKAHEAD_SIZE);
+                AZ::u64 readSize = AZStd::GetMin<AZ::u64>(remainingFileBytes, cache.m_cacheLookaheadSize);
 
                 cache.m_cacheLookaheadBuffer.clear();
                 cache.m_cacheLookaheadBuffer.resize_no_construct(readSize);
@@ -26,7 +26,7 @@
 //NetworkFileIO implements FileIOBase for serving all file system requests via the asset
 //processor connection. The asset processor on the other side of the connection uses LocalFileIO
 //to complete the task and sends the results back.
-//NetworkFileIO uses no caching at all.
+//NetworkFileIO uses no caching at all, but pipelines large reads as several chunk requests in flight.
 //RemoteFileIO derives from NetworkFileIO and adds caching to speed things up.
 
 //This option defines RemoteFileIO as NetworkFileIO, an easy way to test with no caching at all
@@ -147,6 +147,8 @@ namespace AZ
 
             AZStd::vector<char, AZ::OSStdAllocator> m_cacheLookaheadBuffer;
             AZ::u64 m_cacheLookaheadPos = 0;
+            // size of the next read-ahead, 0 until the first refill after open or after the cache was invalidated
+            AZ::u64 m_cacheLookaheadSize = 0;
 
             AZ::u64 m_fileSize = 0;
             AZ::u64 m_fileSizeTime = 0;
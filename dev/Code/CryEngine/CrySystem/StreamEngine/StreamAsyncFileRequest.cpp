@@ -30,6 +30,8 @@
 
 #include <CryProfileMarker.h>
 
+#include <AzCore/IO/Streamer.h>
+
 //#pragma optimize("",off)
 //#pragma("control %push O=0")             // to disable optimization
 
@@ -130,6 +132,7 @@ uint32 CAsyncIOFileRequest::ConfigureRead(CCachedFileData* pFileData)
     if (!pFileData || !pFileEntry->IsCompressed())
     {
         m_bCompressedBuffer = false;
+        m_bBlockCompressedBuffer = false;
         m_nFileSizeCompressed = m_nFileSize;
         m_nSizeOnMedia = m_nRequestedSize;
 
@@ -139,6 +142,7 @@ uint32 CAsyncIOFileRequest::ConfigureRead(CCachedFileData* pFileData)
     else
     {
         m_bCompressedBuffer = true;
+        m_bBlockCompressedBuffer = pFileEntry->nMethod == ZipFile::METHOD_LZ4_BLOCKS;
         m_nFileSize = pFileEntry->desc.lSizeUncompressed;
         m_nFileSizeCompressed = pFileEntry->desc.lSizeCompressed;
         m_nSizeOnMedia = m_nFileSizeCompressed;
@@ -214,8 +218,9 @@ uint32 CAsyncIOFileRequest::AllocateOutput(CCachedFileData* pZipEntry)
 
         if (m_pExternalMemoryBuffer)
         {
+            // LZ4 reads back its own output, which is slow in write only memory
             nReadAllocSize = m_bCompressedBuffer
-                ? (m_nRequestedSize < m_nFileSize ? m_nFileSize : 0)
+                ? (m_nRequestedSize < m_nFileSize || (m_bBlockCompressedBuffer && m_bWriteOnlyExternal) ? m_nFileSize : 0)
                 : 0;
         }
         else
@@ -229,7 +234,15 @@ uint32 CAsyncIOFileRequest::AllocateOutput(CCachedFileData* pZipEntry)
 
         bool bReadInBlocks = CanReadInPages();
         bool bNeedsLookahead = m_bStreamInPlace;
-        bool bBlockDecompress = m_bCompressedBuffer && bReadInBlocks;
+        bool bBlockDecompress = m_bCompressedBuffer && bReadInBlocks && !m_bBlockCompressedBuffer;
+        uint32 nBlockCompressedOffs = 0;
+
+        if (m_bBlockCompressedBuffer)
+        {
+            // the blocks are decompressed in parallel once all of them are read, so they can't share the output
+            nBlockCompressedOffs = nAllocSize;
+            nAllocSize += Align(m_nFileSizeCompressed, BUFFER_ALIGNMENT);
+        }
 
         if (bBlockDecompress)
         {
@@ -276,6 +289,11 @@ uint32 CAsyncIOFileRequest::AllocateOutput(CCachedFileData* pZipEntry)
             ? m_pExternalMemoryBuffer
             : m_pReadMemoryBuffer;
 
+        if (m_bBlockCompressedBuffer)
+        {
+            m_pBlockCompressedBuffer = &pBuffer[nBlockCompressedOffs];
+        }
+
         if (bBlockDecompress)
         {
             m_pZlibStream = (z_stream*)&pBuffer[nZStreamOffs];
@@ -454,6 +472,7 @@ void CAsyncIOFileRequest::FreeBuffer()
     }
 
     m_pLookahead = NULL;
+    m_pBlockCompressedBuffer = NULL;
 
     SStreamEngineTempMemStats& tms = GetStreamEngine()->GetTempMemStats();
 
@@ -727,6 +746,49 @@ uint32 CAsyncIOFileRequest::ReadFileResume(CStreamingIOThread* pIOThread)
     return ReadFileInPages(pIOThread, file);
 }
 
+static void GetSharedStreamSchedule(CAsyncIOFileRequest& request, AZStd::chrono::microseconds& deadline, AZ::IO::Request::PriorityType& priority)
+{
+    // The Streamer orders on deadlines, the priorities only break ties between late requests. Without a load time
+    // from the caller the deadline follows the stream engine priority, so urgent texture and geometry reads still go
+    // ahead of AZ asset reads and idle ones wait for an idle drive.
+    switch (request.m_ePriority)
+    {
+    case estpUrgent:
+        priority = AZ::IO::Request::PriorityType::DR_PRIORITY_CRITICAL;
+        deadline = AZStd::chrono::microseconds(0);
+        break;
+    case estpPreempted:
+    case estpAboveNormal:
+        priority = AZ::IO::Request::PriorityType::DR_PRIORITY_ABOVE_NORMAL;
+        deadline = AZStd::chrono::milliseconds(100);
+        break;
+    case estpNormal:
+        priority = AZ::IO::Request::PriorityType::DR_PRIORITY_NORMAL;
+        deadline = AZStd::chrono::milliseconds(500);
+        break;
+    case estpBelowNormal:
+        priority = AZ::IO::Request::PriorityType::DR_PRIORITY_BELOW_NORMAL;
+        deadline = AZStd::chrono::milliseconds(2000);
+        break;
+    default:
+        priority = AZ::IO::Request::PriorityType::DR_PRIORITY_BELOW_NORMAL;
+        deadline = AZ::IO::ExecuteWhenIdle;
+        break;
+    }
+
+    // nLoadTime is the desired load time from the StartRead call
+    if (request.m_pReadStream && request.m_ePriority != estpUrgent)
+    {
+        CReadStream* pReadStream = static_cast<CReadStream*>(&*request.m_pReadStream);
+        const unsigned nLoadTime = pReadStream->GetParams().nLoadTime;
+        if (nLoadTime)
+        {
+            const int64 nRemainingMS = (int64)nLoadTime - (gEnv->pTimer->GetAsyncTime() - pReadStream->GetRequestTime()).GetMilliSecondsAsInt64();
+            deadline = AZStd::chrono::milliseconds(max(nRemainingMS, (int64)0));
+        }
+    }
+}
+
 uint32 CAsyncIOFileRequest::ReadFileInPages(CStreamingIOThread* pIOThread, CCryFile& file)
 {
 #if !defined(_RELEASE)
@@ -759,18 +821,29 @@ uint32 CAsyncIOFileRequest::ReadFileInPages(CStreamingIOThread* pIOThread, CCryF
 
     bool const bCompressed = m_bCompressedBuffer;
     bool const bEncrypted = m_bEncryptedBuffer;
-    bool const bInPlace = m_bStreamInPlace;
+    bool const bBlockCompressed = m_bBlockCompressedBuffer;
+    bool const bInPlace = m_bStreamInPlace || bBlockCompressed;
     bool const bIgnoreOutOfTmp = IgnoreOutofTmpMem();
 
     size_t const nReadStartOffset = bCompressed
         ? (m_nFileSize - m_nFileSizeCompressed)
         : 0;
 
-    byte* const pReadBase = (byte*)m_pReadMemoryBuffer + nReadStartOffset;
-    byte* const pReadEnd = (byte*)m_pReadMemoryBuffer + m_nReadMemoryBufferSize;
+    byte* const pReadBase = bBlockCompressed
+        ? (byte*)m_pBlockCompressedBuffer
+        : (byte*)m_pReadMemoryBuffer + nReadStartOffset;
+    byte* const pReadEnd = bBlockCompressed
+        ? pReadBase + m_nFileSizeCompressed
+        : (byte*)m_pReadMemoryBuffer + m_nReadMemoryBufferSize;
 
     CStreamEngine* pStreamEngine = static_cast<CStreamEngine*>(gEnv->pSystem->GetStreamEngine());
 
+    int64 nSharedStreamOffset = 0;
+    AZ::IO::VirtualStream* pSharedStream = GetSharedStream(pZipEntry, nSharedStreamOffset);
+    AZStd::chrono::microseconds sharedDeadline;
+    AZ::IO::Request::PriorityType sharedPriority;
+    GetSharedStreamSchedule(*this, sharedDeadline, sharedPriority);
+
     uint32 nPageSize = bReadInPages
         ? min((uint32)STREAMING_PAGE_SIZE, nPageReadLen - m_nPageReadCurrent)
         : nPageReadLen - m_nPageReadCurrent;
@@ -837,7 +910,13 @@ uint32 CAsyncIOFileRequest::ReadFileInPages(CStreamingIOThread* pIOThread, CCryF
 
             bool bReadOk = false;
 
-            if (pZipEntry)
+            if (pSharedStream)
+            {
+                AZ::IO::Request::StateType state = AZ::IO::Request::StateType::ST_COMPLETED;
+                bReadOk = AZ::IO::Streamer::Read(pSharedStream, nSharedStreamOffset + m_nPageReadCurrent, nPageSize, pReadTarget, sharedDeadline, sharedPriority, &state, m_strFileName.c_str()) == nPageSize
+                    && state == AZ::IO::Request::StateType::ST_COMPLETED;
+            }
+            else if (pZipEntry)
             {
                 bReadOk = pZipEntry->m_pZip->ReadFileStreaming(pZipEntry->m_pFileEntry, pReadTarget, m_nPageReadStart + m_nPageReadCurrent, nPageSize) == ZipDir::ZD_ERROR_SUCCESS;
             }
@@ -882,7 +961,18 @@ uint32 CAsyncIOFileRequest::ReadFileInPages(CStreamingIOThread* pIOThread, CCryF
 #endif  //STREAMENGINE_SUPPORT_DECRYPT
             if (bCompressed)    //Spawn the decompression jobs here only if the file isn't encrypted. Encryption and Decompression are strictly linear, the decryption jobs will spawn decompression jobs as they complete.
             {
-                PushDecompressPage(pStreamEngine->GetJobEngineState(), pReadTarget, pTemporaryPageHdr, nPageSize, bLastBlock);
+                if (bBlockCompressed)
+                {
+                    // the blocks are independent, they are decompressed together once the whole entry is read
+                    if (bLastBlock)
+                    {
+                        PushDecompressBlock(pStreamEngine->GetJobEngineState(), m_pBlockCompressedBuffer, NULL, 0, m_nFileSizeCompressed, true);
+                    }
+                }
+                else
+                {
+                    PushDecompressPage(pStreamEngine->GetJobEngineState(), pReadTarget, pTemporaryPageHdr, nPageSize, bLastBlock);
+                }
             }
             else if (bTemporaryReadTarget)
             {
@@ -902,6 +992,31 @@ uint32 CAsyncIOFileRequest::ReadFileInPages(CStreamingIOThread* pIOThread, CCryF
     return 0;
 }
 
+AZ::IO::VirtualStream* CAsyncIOFileRequest::GetSharedStream(CCachedFileData* pZipEntry, int64& nStreamOffset)
+{
+    if (pZipEntry)
+    {
+        // the raw data is read from the pak, decryption and decompression stay on the stream engine jobs
+        ZipDir::Cache* pZip = pZipEntry->GetZip();
+        if (!pZip->GetFilePath()[0] || pZip->GetFileStreamingOffset(pZipEntry->m_pFileEntry, m_nPageReadStart, nStreamOffset) != ZipDir::ZD_ERROR_SUCCESS)
+        {
+            return NULL;
+        }
+        return GetStreamEngine()->GetSharedStream(pZip->GetFilePath());
+    }
+
+    nStreamOffset = m_nPageReadStart;
+
+    if (m_pReadStream && m_pReadStream->GetParams().nFlags & IStreamEngine::FLAGS_FILE_ON_DISK)
+    {
+        return GetStreamEngine()->GetSharedStream(m_strFileName.c_str());
+    }
+
+    char szFullPathBuf[ICryPak::g_nMaxPath];
+    const char* szFullPath = gEnv->pCryPak->AdjustFileName(m_strFileName.c_str(), szFullPathBuf, AZ_ARRAY_SIZE(szFullPathBuf), ICryPak::FOPEN_HINT_QUIET);
+    return GetStreamEngine()->GetSharedStream(szFullPath);
+}
+
 uint32 CAsyncIOFileRequest::ReadFileCheckPreempt(CStreamingIOThread* pIOThread)
 {
     if (m_ePriority != estpUrgent)
@@ -35,6 +35,14 @@ class CMTSafeHeap;
 class CAsyncIOFileRequest_TransferPtr;
 struct SStreamEngineTempMemStats;
 
+namespace AZ
+{
+    namespace IO
+    {
+        class VirtualStream;
+    }
+}
+
 #ifdef SUPPORT_RSA_AND_STREAMCIPHER_PAK_ENCRYPTION  //Could check for INCLUDE_LIBTOMCRYPT here, but only decryption is implemented here, not signing
 #include "CryTomcrypt.h"
 #endif
@@ -193,6 +201,8 @@ public:
     uint32 ReadFileResume(CStreamingIOThread* pIOThread);
     uint32 ReadFileInPages(CStreamingIOThread* pIOThread, CCryFile& file);
     uint32 ReadFileCheckPreempt(CStreamingIOThread* pIOThread);
+    // Returns the AZ::IO::Streamer stream to read the pages from and the offset of the first page in it, NULL to read them directly.
+    AZ::IO::VirtualStream* GetSharedStream(CCachedFileData* pZipEntry, int64& nStreamOffset);
 
     uint32 ConfigureRead(CCachedFileData* pFileData);
     bool CanReadInPages();
@@ -315,6 +325,7 @@ public:
     uint32 m_bSortKeyComputed : 1;
     uint32 m_bOutputAllocated : 1;
     uint32 m_bReadBegun : 1;
+    uint32 m_bBlockCompressedBuffer : 1;
 
     // Actual size of the data on the media.
     uint32 m_nSizeOnMedia;
@@ -343,6 +354,7 @@ public:
 
     z_stream_s* m_pZlibStream;
     ZipDir::UncompressLookahead* m_pLookahead;
+    void* m_pBlockCompressedBuffer; // LZ4 block entries are read here whole, then decompressed in parallel
     SStreamJobQueue* m_pDecompQueue;
 #if defined(STREAMENGINE_SUPPORT_DECRYPT)
     SStreamJobQueue* m_pDecryptQueue;
@@ -231,6 +231,18 @@ void CAsyncIOFileRequest::DecompressBlockEntry(SStreamJobEngineState engineState
 
         int readStatus = Z_OK;
 
+        if (m_bBlockCompressedBuffer)
+        {
+            CryOptionalAutoLock<CryCriticalSection> decompLock(m_externalBufferLockDecompress, m_pExternalMemoryBuffer != NULL);
+
+            // the whole entry in one job, which spreads its blocks over the job workers
+            readStatus = ZipDir::ZipBlockUncompress(m_pReadMemoryBuffer, m_nFileSize, (unsigned char*)pSrc + nOffs, nBytes);
+            if (readStatus == Z_OK)
+            {
+                nBytesDecomped = m_nFileSize;
+            }
+        }
+        else
         {
             CryOptionalAutoLock<CryCriticalSection> decompLock(m_externalBufferLockDecompress, m_pExternalMemoryBuffer != NULL);
 
@@ -672,6 +684,8 @@ void CAsyncIOFileRequest::JobFinalize_Buffer(const SStreamJobEngineState& engine
             m_pZlibStream = NULL;
         }
 
+        m_pBlockCompressedBuffer = NULL;
+
         if (m_pMemoryBuffer)
         {
             engineState.pTempMem->TempFree(engineState.pHeap, m_pMemoryBuffer, m_nMemoryBufferSize);
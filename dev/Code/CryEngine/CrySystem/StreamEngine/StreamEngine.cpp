@@ -21,6 +21,8 @@
 #include "../System.h"
 #include "IPlatformOS.h"
 
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Streamer.h>
 #include <AzCore/std/sort.h>
 
 #include <AzFramework/IO/FileOperations.h>
@@ -775,6 +777,55 @@ void CStreamEngine::UpdateJobPriority(IReadStreamPtr pJobStream)
     }
 }
 
+//////////////////////////////////////////////////////////////////////////
+AZ::IO::VirtualStream* CStreamEngine::GetSharedStream(const char* szPath)
+{
+    if (!g_cvars.sys_streaming_use_az_streamer || m_bShutDown || !AZ::IO::Streamer::IsReady())
+    {
+        return NULL;
+    }
+
+    // the devices are found from the drive of the path, so it can't be an alias
+    char szResolvedPath[ICryPak::g_nMaxPath];
+    AZ::IO::FileIOBase* pFileIO = AZ::IO::FileIOBase::GetInstance();
+    if (!pFileIO || !pFileIO->ResolvePath(szPath, szResolvedPath, AZ_ARRAY_SIZE(szResolvedPath)))
+    {
+        return NULL;
+    }
+
+    CryAutoCriticalSection lock(m_sharedStreamsLock);
+
+    TSharedStreamMap::iterator it = m_sharedStreams.find(szResolvedPath);
+    if (it != m_sharedStreams.end())
+    {
+        return it->second;
+    }
+
+    // Registered as limited, so the device closes the least recently read files instead of keeping a handle open to
+    // every pak and loose file that was ever streamed.
+    AZ::IO::VirtualStream* pStream = AZ::IO::Streamer::Instance().RegisterFileStream(szResolvedPath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, true);
+    if (pStream)
+    {
+        m_sharedStreams[szResolvedPath] = pStream;
+    }
+    return pStream;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CStreamEngine::UnregisterSharedStreams()
+{
+    CryAutoCriticalSection lock(m_sharedStreamsLock);
+
+    if (AZ::IO::Streamer::IsReady())
+    {
+        for (TSharedStreamMap::iterator it = m_sharedStreams.begin(); it != m_sharedStreams.end(); ++it)
+        {
+            AZ::IO::Streamer::Instance().UnRegisterFileStream(it->first.c_str());
+        }
+    }
+    m_sharedStreams.clear();
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CStreamEngine::StopThreads()
 {
@@ -943,6 +994,7 @@ void CStreamEngine::Shutdown()
     CancelAll();
 
     StopThreads();
+    UnregisterSharedStreams();
 
     m_streams.clear();
     m_finishedStreams.clear();
@@ -29,6 +29,14 @@
 
 #include <AzFramework/Input/Events/InputChannelEventListener.h>
 
+namespace AZ
+{
+    namespace IO
+    {
+        class VirtualStream;
+    }
+}
+
 enum EIOThread
 {
     eIOThread_HDD = 0,
@@ -127,12 +135,19 @@ public:
     bool StartFileRequest(CAsyncIOFileRequest* pFileRequest);
     void SignalToStartWork(EIOThread e, bool bForce);
 
+    // Returns the AZ::IO::Streamer stream of a file, registered on first use. Reading through it puts the read on the
+    // queue of the Streamer device for the drive, which also schedules the AZ asset reads.
+    // Returns NULL when sys_streaming_use_az_streamer is 0 or the Streamer isn't running.
+    AZ::IO::VirtualStream* GetSharedStream(const char* szPath);
+
 private:
     void StartThreads();
     void StopThreads();
 
     void ResumePausedStreams_PauseLocked();
 
+    void UnregisterSharedStreams();
+
 #if defined(STREAMENGINE_ENABLE_STATS)
     // add job to current statistics
     void UpdateStatistics(CReadStream* pReadStream);
@@ -166,6 +181,11 @@ private:
     bool m_bStreamDataOnHDD;
     bool m_bUseOpticalDriveThread;
 
+    // Streams registered with the AZ::IO::Streamer, by resolved path.
+    CryCriticalSection m_sharedStreamsLock;
+    typedef std::map<string, AZ::IO::VirtualStream*> TSharedStreamMap;
+    TSharedStreamMap m_sharedStreams;
+
     //////////////////////////////////////////////////////////////////////////
     // Streaming statistics.
     //////////////////////////////////////////////////////////////////////////
@@ -268,6 +268,7 @@ struct SSystemCVars
     ICVar* sys_streaming_debug_filter_file_name;
     ICVar* sys_localization_folder;
     int sys_streaming_in_blocks;
+    int sys_streaming_use_az_streamer;
 
     int sys_float_exceptions;
     int sys_no_crash_dialog;
@@ -150,6 +150,9 @@
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/JobManagerBus.h>
 #include <AzFramework/Driller/DrillerConsoleAPI.h>
+#include <AzCore/Debug/EBusProfiler.h>
+#include <AzCore/Memory/AllocationSnapshot.h>
+#include <AzCore/Memory/AllocatorManager.h>
 
 #include "IPlatformOS.h"
 #include "PerfHUD.h"
@@ -2099,7 +2102,9 @@ bool CSystem::InitPhysics(const SSystemInitParams& initParams)
     REGISTER_CVAR2("p_debug_explosions", &pVars->bDebugExplosions, pVars->bDebugExplosions, 0,
         "Turns on explosions debug mode");
     REGISTER_CVAR2("p_num_threads", &pVars->numThreads, pVars->numThreads, 0,
-        "The number of internal physics threads");
+        "The number of internal physics threads. Independent entity islands, living and independent entities are stepped in parallel on them,\n"
+        "islands are handed out heaviest first. Clamped to the physics thread limit of the build (1 on dedicated servers and ARM)\n"
+        "and, with sys_limit_phys_thread_count, to the number of physical cores minus one");
     REGISTER_CVAR2("p_joint_damage_accum", &pVars->jointDmgAccum, pVars->jointDmgAccum, 0,
         "Default fraction of damage (tension) accumulated on a breakable joint");
     REGISTER_CVAR2("p_joint_damage_accum_threshold", &pVars->jointDmgAccumThresh, pVars->jointDmgAccumThresh, 0,
@@ -5971,6 +5976,103 @@ void CmdDrillToFile(IConsoleCmdArgs* pArgs)
     }
 }
 
+void CmdDumpEBusStats(IConsoleCmdArgs* pArgs)
+{
+    if (!AZ::Debug::EBusProfiler::IsEnabled())
+    {
+        CryLogAlways("EBus profiling is not compiled in, build with EBUS_PROFILING set to 1.");
+        return;
+    }
+
+    const int count = pArgs->GetArgCount() > 1 ? AZStd::GetMax(atoi(pArgs->GetArg(1)), 1) : 10;
+    AZStd::vector<AZ::Debug::EBusProfiler::BusInfo> buses;
+    AZ::Debug::EBusProfiler::GetTopBuses(buses, count);
+
+    CryLogAlways("Top %d EBuses by handler time (last frame, times in microseconds):", count);
+    for (const AZ::Debug::EBusProfiler::BusInfo& bus : buses)
+    {
+        CryLogAlways("  %s", bus.m_name);
+        CryLogAlways("    dispatches %llu, events %llu, broadcasts %llu, handler time %llu, lock wait %llu",
+            bus.m_dispatches, bus.m_events, bus.m_broadcasts, bus.m_handlerTime, bus.m_lockWaitTime);
+        for (const AZ::Debug::EBusProfiler::EventInfo& event : bus.m_topEvents)
+        {
+            CryLogAlways("    %llu x %s", event.m_calls, event.m_name);
+        }
+    }
+}
+
+// Snapshots for sys_MemSnapshot, created on first use (in the OSAllocator) and released by "sys_MemSnapshot clear"
+static AZ::Debug::AllocationSnapshot* s_memSnapshots[2] = { nullptr, nullptr };
+
+void CmdMemSnapshot(IConsoleCmdArgs* pArgs)
+{
+    const char* slotName = pArgs->GetArgCount() > 1 ? pArgs->GetArg(1) : "A";
+    if (azstricmp(slotName, "clear") == 0)
+    {
+        for (AZ::Debug::AllocationSnapshot*& snapshot : s_memSnapshots)
+        {
+            delete snapshot;
+            snapshot = nullptr;
+        }
+        return;
+    }
+
+    const int slot = azstricmp(slotName, "B") == 0 ? 1 : 0;
+    if (!s_memSnapshots[slot])
+    {
+        s_memSnapshots[slot] = aznew AZ::Debug::AllocationSnapshot();
+    }
+    s_memSnapshots[slot]->Capture();
+    CryLogAlways("Memory snapshot %s: %zu allocations, %zu bytes in %zu allocators with records.", slot == 0 ? "A" : "B",
+        s_memSnapshots[slot]->GetAllocations().size(), s_memSnapshots[slot]->GetTotalBytes(), s_memSnapshots[slot]->GetAllocators().size());
+}
+
+void CmdMemSnapshotDiff(IConsoleCmdArgs* pArgs)
+{
+    if (!s_memSnapshots[0] || !s_memSnapshots[1])
+    {
+        CryLogAlways("Take snapshots A and B first (sys_MemSnapshot A, sys_MemSnapshot B).");
+        return;
+    }
+
+    const int count = pArgs->GetArgCount() > 1 ? AZStd::GetMax(atoi(pArgs->GetArg(1)), 1) : 20;
+    AZ::Debug::AllocationSnapshotDiff diff;
+    AZ::Debug::AllocationSnapshot::Diff(*s_memSnapshots[0], *s_memSnapshots[1], diff);
+    AZ::Debug::AllocationSnapshot::PrintDiff(diff, count);
+}
+
+void CmdMemBudget(IConsoleCmdArgs* pArgs)
+{
+    if (pArgs->GetArgCount() < 5)
+    {
+        CryLogAlways("Usage: sys_MemBudget <budget> <allocator> <soft limit MB> <hard limit MB>");
+        return;
+    }
+
+    const size_t softLimit = static_cast<size_t>(atof(pArgs->GetArg(3)) * 1024.0 * 1024.0);
+    const size_t hardLimit = static_cast<size_t>(atof(pArgs->GetArg(4)) * 1024.0 * 1024.0);
+    AZ::AllocatorManager::Instance().AddMemoryBudget(pArgs->GetArg(1), pArgs->GetArg(2), softLimit, hardLimit);
+}
+
+void CmdDumpMemBudgets(IConsoleCmdArgs* pArgs)
+{
+    (void)pArgs;
+    AZ::AllocatorManager& manager = AZ::AllocatorManager::Instance();
+    AZ::AllocatorManager::MemoryBudget budget;
+    CryLogAlways("Memory budgets (MB, last frame):");
+    for (int i = 0; manager.GetMemoryBudget(i, budget); ++i)
+    {
+        static const char* stateNames[] = { "ok", "OVER SOFT LIMIT", "OVER HARD LIMIT" };
+        CryLogAlways("  %s: %.2f (peak %.2f), soft %.2f, hard %.2f - %s", budget.m_name,
+            budget.m_allocatedBytes / (1024.0 * 1024.0), budget.m_peakBytes / (1024.0 * 1024.0),
+            budget.m_softLimit / (1024.0 * 1024.0), budget.m_hardLimit / (1024.0 * 1024.0), stateNames[budget.m_state]);
+        for (int iAllocator = 0; iAllocator < budget.m_numAllocators; ++iAllocator)
+        {
+            CryLogAlways("    %s", budget.m_allocatorNames[iAllocator]);
+        }
+    }
+}
+
 void ChangeLogAllocations(ICVar* pVal)
 {
     g_iTraceAllocations = pVal->GetIVal();
@@ -6081,6 +6183,7 @@ void CSystem::CreateSystemVars()
 
     attachVariable("sys_PakInMemorySizeLimit", &g_cvars.pakVars.nInMemoryPerPakSizeLimit, "Individual pak size limit for being loaded into memory (MB)");
     attachVariable("sys_PakTotalInMemorySizeLimit", &g_cvars.pakVars.nTotalInMemoryPakSizeLimit, "Total limit (in MB) for all in memory paks");
+    attachVariable("sys_PakMapUncompressed", &g_cvars.pakVars.nMapUncompressedEntries, "Map pak files into memory, so uncompressed entries are read without a copy (applies to paks opened afterwards)");
     attachVariable("sys_PakLoadCache", &g_cvars.pakVars.nLoadCache, "Load in memory paks from _LoadCache folder");
     attachVariable("sys_PakLoadModePaks", &g_cvars.pakVars.nLoadModePaks, "Load mode switching paks from modes folder");
     attachVariable("sys_PakStreamCache", &g_cvars.pakVars.nStreamCache, "Load in memory paks for faster streaming (cgf_cache.pak,dds_cache.pak)");
@@ -6390,6 +6493,10 @@ void CSystem::CreateSystemVars()
 
     REGISTER_CVAR2("sys_streaming_in_blocks", &g_cvars.sys_streaming_in_blocks, 1, VF_NULL,
         "Streaming of large files happens in blocks");
+    REGISTER_CVAR2("sys_streaming_use_az_streamer", &g_cvars.sys_streaming_use_az_streamer, 1, VF_NULL,
+        "Streaming reads go through the AZ::IO::Streamer devices, so they are scheduled together with the AZ asset reads\n"
+        "on one deadline and priority queue per drive instead of competing with them for the disk.\n"
+        "0 - read directly from the IO threads");
 
 #if (defined(WIN32) || defined(WIN64)) && !defined(_RELEASE)
     REGISTER_CVAR2("sys_float_exceptions", &g_cvars.sys_float_exceptions, 3, 0, "Use or not use floating point exceptions.");
@@ -6582,6 +6689,15 @@ void CSystem::CreateSystemVars()
 
     REGISTER_COMMAND_DEV_ONLY("DrillerStart", CmdDrillToFile, VF_DEV_ONLY, "Start a driller capture.");
     REGISTER_COMMAND_DEV_ONLY("DrillerStop", CmdDrillToFile, VF_DEV_ONLY, "Stop a driller capture.");
+    REGISTER_COMMAND_DEV_ONLY("sys_DumpEBusStats", CmdDumpEBusStats, VF_DEV_ONLY, "Prints the EBuses with the most handler time in the last frame (requires EBUS_PROFILING).\n"
+        "Usage: sys_DumpEBusStats [count=10]");
+    REGISTER_COMMAND_DEV_ONLY("sys_MemSnapshot", CmdMemSnapshot, VF_DEV_ONLY, "Captures the allocation records of all allocators into snapshot A or B, see sys_MemSnapshotDiff.\n"
+        "Usage: sys_MemSnapshot [A|B|clear]");
+    REGISTER_COMMAND_DEV_ONLY("sys_MemSnapshotDiff", CmdMemSnapshotDiff, VF_DEV_ONLY, "Prints the allocations of snapshot B that are not in snapshot A, grouped by callstack, biggest first.\n"
+        "Usage: sys_MemSnapshotDiff [count=20]");
+    REGISTER_COMMAND_DEV_ONLY("sys_MemBudget", CmdMemBudget, VF_DEV_ONLY, "Adds an allocator to a memory budget and sets the budget limits (0 for none), checked every frame.\n"
+        "Usage: sys_MemBudget <budget> <allocator> <soft limit MB> <hard limit MB>");
+    REGISTER_COMMAND_DEV_ONLY("sys_DumpMemBudgets", CmdDumpMemBudgets, VF_DEV_ONLY, "Prints the memory budgets and their usage on the last frame.");
 
     REGISTER_COMMAND("sys_SetLogLevel", CmdSetAwsLogLevel, 0, "Set AWS log level [0 - 6].");
 }
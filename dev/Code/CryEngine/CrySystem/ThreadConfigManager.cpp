@@ -34,6 +34,8 @@ CThreadConfigManager::CThreadConfigManager()
     m_defaultConfig.priority = THREAD_PRIORITY_NORMAL;
     m_defaultConfig.bDisablePriorityBoost = false;
     m_defaultConfig.paramActivityFlag = (SThreadConfig::TThreadParamFlag)~0;
+
+    m_processorTopology = AZ::JobManagerTopology::Detect();
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -351,6 +353,57 @@ void CThreadConfigManager::LoadAffinity(const XmlNodeRef& rXmlThreadRef, uint32&
     rAffinity = affinity;
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CThreadConfigManager::LoadCacheDomain(const XmlNodeRef& rXmlThreadRef, uint32& rAffinity, SThreadConfig::TThreadParamFlag& rParamActivityFlag)
+{
+    const char* szValidCharacters = ",0123456789";
+    uint32 affinity = 0;
+
+    // Validate node
+    if (!rXmlThreadRef->haveAttr("CacheDomain"))
+    {
+        return;
+    }
+
+    // Validate token
+    CryFixedStringT<32> domainRawStr(rXmlThreadRef->getAttr("CacheDomain"));
+    CryFixedStringT<32>::size_type nPos = domainRawStr.find_first_not_of(" ,0123456789");
+    if (domainRawStr.empty() || nPos != CryFixedStringT<32>::npos)
+    {
+        CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING,
+            "<ThreadConfigInfo>: [XML Parsing] Invalid \"CacheDomain\" attribute. Valid characters:\"%s\" Offending token:\"%s\"", szValidCharacters, domainRawStr.c_str());
+        return;
+    }
+
+    // Tokenize comma separated string
+    int pos = 0;
+    CryFixedStringT<32> domainTokStr = domainRawStr.Tokenize(",", pos);
+    while (!domainTokStr.empty())
+    {
+        domainTokStr.Trim();
+
+        const unsigned long domain = strtoul(domainTokStr.c_str(), NULL, 10);
+        if (domain >= m_processorTopology.m_domains.size())
+        {
+            CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_WARNING, "<ThreadConfigInfo>: [XML Parsing] \"CacheDomain\" %lu not found, this machine has %u cache domains",
+                domain, static_cast<unsigned int>(m_processorTopology.m_domains.size()));
+        }
+        else
+        {
+            affinity |= m_processorTopology.GetDomainMask(static_cast<unsigned int>(domain));
+        }
+
+        // Move to next token
+        domainTokStr = domainRawStr.Tokenize(",", pos);
+    }
+
+    if (affinity != 0)
+    {
+        rAffinity = affinity;
+        rParamActivityFlag |= SThreadConfig::eThreadParamFlag_Affinity;
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////
 void CThreadConfigManager::LoadPriority(const XmlNodeRef& rXmlThreadRef, int32& rPriority, SThreadConfig::TThreadParamFlag& rParamActivityFlag)
 {
@@ -526,6 +579,7 @@ void CThreadConfigManager::LoadStackSize(const XmlNodeRef& rXmlThreadRef, uint32
 void CThreadConfigManager::LoadThreadConfig(const XmlNodeRef& rXmlThreadRef, SThreadConfig& rThreadConfig)
 {
     LoadAffinity(rXmlThreadRef, rThreadConfig.affinityFlag, rThreadConfig.paramActivityFlag);
+    LoadCacheDomain(rXmlThreadRef, rThreadConfig.affinityFlag, rThreadConfig.paramActivityFlag);
     LoadPriority(rXmlThreadRef, rThreadConfig.priority, rThreadConfig.paramActivityFlag);
     LoadDisablePriorityBoost(rXmlThreadRef, rThreadConfig.bDisablePriorityBoost, rThreadConfig.paramActivityFlag);
     LoadStackSize(rXmlThreadRef, rThreadConfig.stackSizeBytes, rThreadConfig.paramActivityFlag);
@@ -564,6 +618,12 @@ void CThreadConfigManager::DumpThreadConfigurationsToLog()
     // Print header
     CryLogAlways("== Thread Startup Config List (\"%s\") ==", IdentifyPlatform());
 
+    // Print cache domains available to CacheDomain
+    for (unsigned int domain = 0; domain < m_processorTopology.m_domains.size(); ++domain)
+    {
+        CryLogAlways("  Cache domain %u: %u cores (Affinity:%u)", domain, static_cast<unsigned int>(m_processorTopology.m_domains[domain].size()), m_processorTopology.GetDomainMask(domain));
+    }
+
     // Print loaded default config
     CryLogAlways("  (Default) 1. \"%s\" (StackSize:%uKB | Affinity:%u | Priority:%i | PriorityBoost:\"%s\")", m_defaultConfig.szThreadName, m_defaultConfig.stackSizeBytes / 1024,
         m_defaultConfig.affinityFlag, m_defaultConfig.priority, m_defaultConfig.bDisablePriorityBoost ? "disabled" : "enabled");
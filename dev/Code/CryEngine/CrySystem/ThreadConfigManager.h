@@ -15,6 +15,7 @@
 
 #include <map>
 #include "IThreadConfigManager.h"
+#include <AzCore/Jobs/JobManagerTopology.h>
 
 /*
 ThreadConfigManager:
@@ -66,6 +67,11 @@ Affinity:
     "x"                     : Run thread on specified core
     "x, y, ..."     : Run thread on specified cores
 
+CacheDomain:
+    "x"                     : Run thread on the cores of cache domain x (cores sharing a last level cache, same grouping as the AZ job manager steal domains)
+    "x, y, ..."     : Run thread on the cores of the specified cache domains
+    Note: Overrides the "Affinity" attribute.
+
 Priority:
     "idle"                      : Hint to CryEngine to run thread with pre-set priority
     "below_normal"      : Hint to CryEngine to run thread with pre-set priority
@@ -126,6 +132,7 @@ private:
     void LoadThreadConfig(const XmlNodeRef& rXmlThreadRef, SThreadConfig& rThreadConfig);
 
     void LoadAffinity(const XmlNodeRef& rXmlThreadRef, uint32& rAffinity, SThreadConfig::TThreadParamFlag& rParamActivityFlag);
+    void LoadCacheDomain(const XmlNodeRef& rXmlThreadRef, uint32& rAffinity, SThreadConfig::TThreadParamFlag& rParamActivityFlag);
     void LoadPriority(const XmlNodeRef& rXmlThreadRef, int32& rPriority, SThreadConfig::TThreadParamFlag& rParamActivityFlag);
     void LoadDisablePriorityBoost(const XmlNodeRef& rXmlThreadRef, bool& rPriorityBoost, SThreadConfig::TThreadParamFlag& rParamActivityFlag);
     void LoadStackSize(const XmlNodeRef& rXmlThreadRef, uint32& rStackSize, SThreadConfig::TThreadParamFlag& rParamActivityFlag);
@@ -134,4 +141,5 @@ private:
     ThreadConfigMap m_threadConfig; // Note: The map key is referenced by as const char* by the value's storage class. Other containers may not support this behaviour as they will re-allocate memory as they grow/shrink.
     ThreadConfigMap m_wildcardThreadConfig;
     SThreadConfig m_defaultConfig;
+    AZ::JobManagerTopology m_processorTopology;
 };
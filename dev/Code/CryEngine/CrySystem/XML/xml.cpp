@@ -1389,7 +1389,7 @@ public:
 protected:
     void    onStartElement(const char* tagName, const char** atts);
     void    onEndElement(const char* tagName);
-    void    onRawData(const char* data);
+    void    onRawData(const char* data, int len);
 
     static void startElement(void* userData, const char* name, const char** atts)
     {
@@ -1399,18 +1399,10 @@ protected:
     {
         ((XmlParserImp*)userData)->onEndElement(name);
     }
-    static void characterData(void* userData, const char* s, int len) PREFAST_SUPPRESS_WARNING(6262)
+    static void characterData(void* userData, const char* s, int len)
     {
-        char str[32700];
-        if (len > sizeof(str) - 1)
-        {
-            assert(0);
-            len = sizeof(str) - 1;
-        }
         // Note that XML buffer userData has no terminating '\0'.
-        memcpy(str, s, len);
-        str[len] = 0;
-        ((XmlParserImp*)userData)->onRawData(str);
+        ((XmlParserImp*)userData)->onRawData(s, len);
     }
 
     void CleanStack();
@@ -1435,6 +1427,9 @@ protected:
 
     XML_Parser m_parser;
     CSimpleStringPool m_stringPool;
+
+    // Null terminated copy of character data that continues a node's content, see onRawData.
+    string m_rawDataBuffer;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -1537,26 +1532,32 @@ void    XmlParserImp::onEndElement(const char* tagName)
     m_nNodeStackTop--;
 }
 
-void    XmlParserImp::onRawData(const char* data)
+void    XmlParserImp::onRawData(const char* data, int len)
 {
     assert(m_nNodeStackTop >= 0);
-    if (m_nNodeStackTop >= 0)
+    if (m_nNodeStackTop >= 0 && len > 0)
     {
-        size_t len = strlen(data);
-        if (len > 0)
+        // Most of the character data expat reports is the indentation between elements, skip it before copying anything.
+        int nFirstText = 0;
+        while (nFirstText < len && (data[nFirstText] == ' ' || data[nFirstText] == '\t' || data[nFirstText] == '\r' || data[nFirstText] == '\n'))
         {
-            if (strspn(data, "\r\n\t ") != len)
-            {
-                CXmlNode* node = (CXmlNode*)(IXmlNode*)m_nodeStack[m_nNodeStackTop].node;
-                if (*node->m_content != '\0')
-                {
-                    node->m_content = m_stringPool.ReplaceString(node->m_content, data);
-                }
-                else
-                {
-                    node->m_content = AddString(data);
-                }
-            }
+            ++nFirstText;
+        }
+        if (nFirstText == len)
+        {
+            return;
+        }
+
+        CXmlNode* node = (CXmlNode*)(IXmlNode*)m_nodeStack[m_nNodeStackTop].node;
+        if (*node->m_content != '\0')
+        {
+            // Text split by entity references arrives in several pieces, the pool extends the last string from a terminated copy.
+            m_rawDataBuffer.assign(data, len);
+            node->m_content = m_stringPool.ReplaceString(node->m_content, m_rawDataBuffer.c_str());
+        }
+        else
+        {
+            node->m_content = m_stringPool.Append(data, len);
         }
     }
 }
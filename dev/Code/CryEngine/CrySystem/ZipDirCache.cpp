@@ -479,6 +479,198 @@ ZipDir::ErrorEnum ZipDir::Cache::ReadFileStreaming (FileEntry* pFileEntry, void*
     return ZD_ERROR_SUCCESS;
 }
 
+ZipDir::ErrorEnum ZipDir::Cache::GetFileStreamingOffset (FileEntry* pFileEntry, int64 nDataOffset, int64& nZipFileOffset)
+{
+    if (!pFileEntry || m_zipFile.IsInMemory())
+    {
+        return ZD_ERROR_INVALID_CALL;
+    }
+
+#if !defined(SUPPORT_UNENCRYPTED_PAKS)
+    if (!pFileEntry->IsEncrypted())
+    {
+        return ZD_ERROR_CORRUPTED_DATA;
+    }
+#endif  //!SUPPORT_UNENCRYPTED_PAKS
+
+    ErrorEnum nError = Refresh(pFileEntry);
+    if (nError != ZD_ERROR_SUCCESS)
+    {
+        return nError;
+    }
+
+    nZipFileOffset = (int64)pFileEntry->nFileDataOffset + nDataOffset;
+    return ZD_ERROR_SUCCESS;
+}
+
+bool ZipDir::Cache::MapFile (const char* szFilePath)
+{
+    if (m_zipFile.IsInMemory())
+    {
+        return false;
+    }
+
+    // the mapping needs a path on the local file system, paks served by a remote file IO can't be mapped
+    char resolvedPath[AZ_MAX_PATH_LEN] = { 0 };
+    if (!AZ::IO::FileIOBase::GetDirectInstance()->ResolvePath(szFilePath, resolvedPath, AZ_MAX_PATH_LEN))
+    {
+        return false;
+    }
+
+    FileMappingPtr pMapping = FileMapping::Create(resolvedPath);
+    if (!pMapping)
+    {
+        return false;
+    }
+
+    CryAutoCriticalSection lock(m_pCacheData->m_csCacheIOLock);
+    m_pCacheData->m_pFileMapping = pMapping;
+    return true;
+}
+
+char* ZipDir::Cache::GetMappedFileData (FileEntry* pFileEntry, FileMappingPtr& pMapping)
+{
+#if defined(SUPPORT_UNENCRYPTED_PAKS)
+    if (!pFileEntry || pFileEntry->nMethod != ZipFile::METHOD_STORE || pFileEntry->IsEncrypted())
+    {
+        return NULL;
+    }
+
+    {
+        CryAutoCriticalSection lock(m_pCacheData->m_csCacheIOLock);
+        pMapping = m_pCacheData->m_pFileMapping;
+    }
+    if (!pMapping || Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+    {
+        pMapping = NULL;
+        return NULL;
+    }
+
+    const uint64 nEnd = (uint64)pFileEntry->nFileDataOffset + pFileEntry->desc.lSizeUncompressed;
+    if (pFileEntry->desc.lSizeCompressed != pFileEntry->desc.lSizeUncompressed || nEnd > pMapping->GetSize())
+    {
+        pMapping = NULL;
+        return NULL;
+    }
+
+    char* pData = pMapping->GetData() + pFileEntry->nFileDataOffset;
+
+#if defined(VERIFY_PAK_ENTRY_CRC)
+    if (pFileEntry->desc.lCRC32 != 0)
+    {
+        uint32 computedCRC32 = crc32(0, (unsigned char*)pData, pFileEntry->desc.lSizeUncompressed);
+        if (pFileEntry->desc.lCRC32 != computedCRC32)
+        {
+#if !defined(_RELEASE)
+            CryWarning(VALIDATOR_MODULE_SYSTEM, VALIDATOR_ERROR, "ZipDir::Cache::GetMappedFileData mismatch detected for file %s: Generated CRC = 0x%8X, Loaded CRC = 0x%8X", GetFileEntryName(pFileEntry), computedCRC32, pFileEntry->desc.lCRC32);
+#endif //!_RELEASE
+            pMapping = NULL;
+            return NULL;
+        }
+#if defined(CHECK_CRC_ONLY_ONCE)
+        pFileEntry->desc.lCRC32 = 0;
+#endif //CHECK_CRC_ONLY_ONCE
+    }
+#endif //VERIFY_PAK_ENTRY_CRC
+
+    return pData;
+#else
+    // entries that aren't encrypted are rejected as corrupted, and encrypted ones can't be used in place
+    (void)pFileEntry;
+    pMapping = NULL;
+    return NULL;
+#endif  //SUPPORT_UNENCRYPTED_PAKS
+}
+
+ZipDir::ErrorEnum ZipDir::Cache::ReadFileBlocks (FileEntry* pFileEntry, void* pOut, int64 nDataOffset, int64 nDataReadSize)
+{
+    FUNCTION_PROFILER(gEnv->pSystem, PROFILE_SYSTEM);
+    if (!pFileEntry || pFileEntry->nMethod != ZipFile::METHOD_LZ4_BLOCKS || nDataOffset < 0 || nDataReadSize < 0
+        || nDataOffset + nDataReadSize > (int64)pFileEntry->desc.lSizeUncompressed)
+    {
+        return ZD_ERROR_INVALID_CALL;
+    }
+
+    if (nDataReadSize == 0)
+    {
+        return ZD_ERROR_SUCCESS;
+    }
+
+    ZipFile::LZ4BlockHeader header;
+    ErrorEnum nError = ReadFile(pFileEntry, NULL, &header, false, 0, sizeof(header));
+    if (nError != ZD_ERROR_SUCCESS)
+    {
+        return nError;
+    }
+
+    const uint64 nTableSize = LZ4BlockTable::GetTableSize(header);
+    if (nTableSize > pFileEntry->desc.lSizeCompressed)
+    {
+        return ZD_ERROR_CORRUPTED_DATA;
+    }
+
+    SmartPtr pTableDestroyer(m_pCacheData->m_pHeap);
+    void* pTableData = m_pCacheData->m_pHeap->TempAlloc((size_t)nTableSize, "ZipDir::Cache::ReadFileBlocks");
+    pTableDestroyer.Attach(pTableData);
+    nError = ReadFile(pFileEntry, NULL, pTableData, false, 0, nTableSize);
+    if (nError != ZD_ERROR_SUCCESS)
+    {
+        return nError;
+    }
+
+    LZ4BlockTable table;
+    if (!table.Init(pTableData, pFileEntry->desc.lSizeCompressed, pFileEntry->desc.lSizeUncompressed))
+    {
+        return ZD_ERROR_CORRUPTED_DATA;
+    }
+
+    // only the blocks that overlap the range are read, the ones at the edges are decompressed into a scratch block
+    const uint32 nBlockSize = table.GetBlockSize();
+    const uint32 nFirstBlock = (uint32)(nDataOffset / nBlockSize);
+    const uint32 nLastBlock = (uint32)((nDataOffset + nDataReadSize - 1) / nBlockSize);
+    const uint32 nBlocksStart = table.GetBlockStart(nFirstBlock);
+    const uint32 nBlocksSize = table.GetBlockEnd(nLastBlock) - nBlocksStart;
+
+    SmartPtr pBlocksDestroyer(m_pCacheData->m_pHeap);
+    char* pBlocks = (char*)m_pCacheData->m_pHeap->TempAlloc(nBlocksSize + nBlockSize, "ZipDir::Cache::ReadFileBlocks");
+    pBlocksDestroyer.Attach(pBlocks);
+    nError = ReadFile(pFileEntry, NULL, pBlocks, false, table.nBlocksOffset + nBlocksStart, nBlocksSize);
+    if (nError != ZD_ERROR_SUCCESS)
+    {
+        return nError;
+    }
+
+    char* pScratch = pBlocks + nBlocksSize;
+    char* pDst = (char*)pOut;
+    for (uint32 nBlock = nFirstBlock; nBlock <= nLastBlock; ++nBlock)
+    {
+        const int64 nBlockOffset = (int64)nBlock * nBlockSize;
+        const int64 nBlockEnd = nBlockOffset + table.GetUncompressedBlockSize(nBlock);
+        const int64 nCopyStart = max(nDataOffset, nBlockOffset);
+        const int64 nCopyEnd = min(nDataOffset + nDataReadSize, nBlockEnd);
+        const char* pSrc = pBlocks + (table.GetBlockStart(nBlock) - nBlocksStart);
+
+        if (nCopyStart == nBlockOffset && nCopyEnd == nBlockEnd)
+        {
+            if (!table.UncompressBlock(nBlock, pSrc, pDst))
+            {
+                return ZD_ERROR_CORRUPTED_DATA;
+            }
+        }
+        else
+        {
+            if (!table.UncompressBlock(nBlock, pSrc, pScratch))
+            {
+                return ZD_ERROR_CORRUPTED_DATA;
+            }
+            memcpy(pDst, pScratch + (nCopyStart - nBlockOffset), (size_t)(nCopyEnd - nCopyStart));
+        }
+        pDst += nCopyEnd - nCopyStart;
+    }
+
+    return ZD_ERROR_SUCCESS;
+}
+
 // decompress compressed file
 ZipDir::ErrorEnum ZipDir::Cache::DecompressFile (FileEntry* pFileEntry, void* pCompressed, void* pUncompressed, CryCriticalSection& csDecmopressLock)
 {
@@ -501,6 +693,16 @@ ZipDir::ErrorEnum ZipDir::Cache::DecompressFile (FileEntry* pFileEntry, void* pC
         memcpy (pBuffer, pCompressed, pFileEntry->desc.lSizeCompressed);
     }
 
+    if (pFileEntry->nMethod == ZipFile::METHOD_LZ4_BLOCKS)
+    {
+        // the blocks don't share any decompression state, so they are decompressed in parallel without the lock
+        if (Z_OK != ZipBlockUncompress(pUncompressed, nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed))
+        {
+            return ZD_ERROR_CORRUPTED_DATA;
+        }
+        return ZD_ERROR_SUCCESS;
+    }
+
     AUTO_LOCK_CS(csDecmopressLock);
     if (Z_OK != ZipRawUncompress(m_pCacheData->m_pHeap, pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed))
     {
@@ -590,6 +792,10 @@ bool ZipDir::Cache::ReOpen(const char* filePath)
 {
     CryAutoCriticalSection lock(m_pCacheData->m_csCacheIOLock);
 
+    // the file may have been replaced, views handed out before keep the old mapping alive
+    const bool bWasMapped = m_pCacheData->m_pFileMapping != NULL;
+    m_pCacheData->m_pFileMapping = NULL;
+
     m_zipFile.Close(false);
     AZ::IO::HandleType fileHandle;
     if (AZ::IO::FileIOBase::GetDirectInstance()->Open(filePath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, fileHandle))
@@ -605,6 +811,11 @@ bool ZipDir::Cache::ReOpen(const char* filePath)
         }
 #endif
 
+        if (bWasMapped)
+        {
+            MapFile(filePath);
+        }
+
         return true;
     }
 
@@ -23,6 +23,8 @@
 #define CRYINCLUDE_CRYSYSTEM_ZIPDIRCACHE_H
 #pragma once
 
+#include "ZipDirFileMapping.h"
+
 
 /////////////////////////////////////////////////////////////
 // THe Zip Dir uses a special memory layout for keeping the structure of zip file.
@@ -72,6 +74,20 @@ namespace ZipDir
         // when nDataReadSize and nDataOffset are 0, will assume whole file must be read.
         ErrorEnum ReadFile (FileEntry* pFileEntry, void* pCompressed, void* pUncompressed, const bool decompress = true, int64 nDataOffset = 0, int64 nDataReadSize = -1, const bool decrypt = true);
         ErrorEnum ReadFileStreaming (FileEntry* pFileEntry, void* pOut, int64 nDataOffset, int64 nDataReadSize);
+        // returns the offset in the zip file of the raw data at nDataOffset of the file entry, to read it through another
+        // file handle the way ReadFileStreaming would; fails for zips that are kept in memory
+        ErrorEnum GetFileStreamingOffset (FileEntry* pFileEntry, int64 nDataOffset, int64& nZipFileOffset);
+
+        // maps the whole zip file into memory, so the entries stored without compression or encryption can be
+        // handed out by GetMappedFileData instead of being read. Returns false if the file can't be mapped.
+        bool MapFile (const char* szFilePath);
+        // returns the data of the file entry inside the mapping, or NULL if the zip isn't mapped or the entry is
+        // compressed or encrypted. The returned mapping keeps the data valid.
+        char* GetMappedFileData (FileEntry* pFileEntry, FileMappingPtr& pMapping);
+
+        // reads nDataReadSize bytes at nDataOffset of an entry compressed with METHOD_LZ4_BLOCKS into pOut, only the
+        // blocks that overlap the range are read and decompressed
+        ErrorEnum ReadFileBlocks (FileEntry* pFileEntry, void* pOut, int64 nDataOffset, int64 nDataReadSize);
 
         // decompress compressed file
         ErrorEnum DecompressFile (FileEntry* pFileEntry, void* pCompressed, void* pUncompressed, CryCriticalSection& csDecmopressLock);
@@ -200,6 +216,9 @@ namespace ZipDir
             // The lock should be globally unique when all pak files are archived in a single obb file.
             CryCriticalSection m_csCacheIOLock;
 
+            // set by MapFile
+            FileMappingPtr m_pFileMapping;
+
             void GetMemoryUsage(ICrySizer* pSizer) const
             {
                 pSizer->AddObject(this, sizeof(*this));
@@ -1010,7 +1010,11 @@ void ZipDir::CacheFactory::Validate(const FileEntry& fileEntry)
 
     unsigned long nDestSize = fileEntry.desc.lSizeUncompressed;
     int nError = Z_OK;
-    if (fileEntry.nMethod)
+    if (fileEntry.nMethod == ZipFile::METHOD_LZ4_BLOCKS)
+    {
+        nError = ZipBlockUncompress (pUncompressed, nDestSize, pCompressed, fileEntry.desc.lSizeCompressed);
+    }
+    else if (fileEntry.nMethod)
     {
         nError = ZipRawUncompress (m_pHeap, pUncompressed, &nDestSize, pCompressed, fileEntry.desc.lSizeCompressed);
     }
@@ -717,6 +717,13 @@ ZipDir::ErrorEnum ZipDir::CacheRW::ReadFile (FileEntry* pFileEntry, void* pCompr
             //assert (pFileEntry->nSizeCompressed == pFileEntry->nSizeUncompressed);
             //memcpy (pUncompressed, pBuffer, pFileEntry->nSizeCompressed);
         }
+        else if (pFileEntry->nMethod == ZipFile::METHOD_LZ4_BLOCKS)
+        {
+            if (Z_OK != ZipBlockUncompress(pUncompressed, pFileEntry->desc.lSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed))
+            {
+                return ZD_ERROR_CORRUPTED_DATA;
+            }
+        }
         else
         {
             unsigned long nSizeUncompressed = pFileEntry->desc.lSizeUncompressed;
@@ -0,0 +1,142 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include "StdAfx.h"
+#include "ZipDirFileMapping.h"
+
+#if defined(WIN32) || defined(WIN64)
+#include <windows.h>
+#elif defined(APPLE) || defined(LINUX)
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+ZipDir::FileMapping::FileMapping()
+    : m_pData(NULL)
+    , m_nSize(0)
+#if defined(WIN32) || defined(WIN64)
+    , m_hFile(INVALID_HANDLE_VALUE)
+    , m_hMapping(NULL)
+#endif
+{
+}
+
+#if defined(WIN32) || defined(WIN64)
+
+ZipDir::FileMapping* ZipDir::FileMapping::Create(const char* szFilePath)
+{
+    HANDLE hFile = CreateFileA(szFilePath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return NULL;
+    }
+
+    LARGE_INTEGER nFileSize;
+    if (!GetFileSizeEx(hFile, &nFileSize) || nFileSize.QuadPart == 0)
+    {
+        CloseHandle(hFile);
+        return NULL;
+    }
+
+    HANDLE hMapping = CreateFileMappingA(hFile, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    if (!hMapping)
+    {
+        CloseHandle(hFile);
+        return NULL;
+    }
+
+    void* pData = MapViewOfFile(hMapping, FILE_MAP_COPY, 0, 0, 0);
+    if (!pData)
+    {
+        CloseHandle(hMapping);
+        CloseHandle(hFile);
+        return NULL;
+    }
+
+    FileMapping* pMapping = new FileMapping;
+    pMapping->m_pData = static_cast<char*>(pData);
+    pMapping->m_nSize = nFileSize.QuadPart;
+    pMapping->m_hFile = hFile;
+    pMapping->m_hMapping = hMapping;
+    return pMapping;
+}
+
+ZipDir::FileMapping::~FileMapping()
+{
+    if (m_pData)
+    {
+        UnmapViewOfFile(m_pData);
+    }
+    if (m_hMapping)
+    {
+        CloseHandle(m_hMapping);
+    }
+    if (m_hFile != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(m_hFile);
+    }
+}
+
+#elif defined(APPLE) || defined(LINUX)
+
+ZipDir::FileMapping* ZipDir::FileMapping::Create(const char* szFilePath)
+{
+    int fd = open(szFilePath, O_RDONLY);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode) || fileStat.st_size == 0)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    // the mapping keeps its own reference to the file
+    void* pData = mmap(NULL, fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (pData == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    FileMapping* pMapping = new FileMapping;
+    pMapping->m_pData = static_cast<char*>(pData);
+    pMapping->m_nSize = fileStat.st_size;
+    return pMapping;
+}
+
+ZipDir::FileMapping::~FileMapping()
+{
+    if (m_pData)
+    {
+        munmap(m_pData, m_nSize);
+    }
+}
+
+#else
+
+ZipDir::FileMapping* ZipDir::FileMapping::Create(const char* /*szFilePath*/)
+{
+    return NULL;
+}
+
+ZipDir::FileMapping::~FileMapping()
+{
+}
+
+#endif
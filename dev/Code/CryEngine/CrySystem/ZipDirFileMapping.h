@@ -0,0 +1,52 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#ifndef CRYINCLUDE_CRYSYSTEM_ZIPDIRFILEMAPPING_H
+#define CRYINCLUDE_CRYSYSTEM_ZIPDIRFILEMAPPING_H
+#pragma once
+
+#include "smartptr.h"
+
+namespace ZipDir
+{
+    // Read-only mapping of a whole zip file into memory. Entries that are stored uncompressed are handed out as views
+    // into it instead of being copied into a buffer. Every view holds a reference, so the mapping stays valid
+    // after the zip cache that created it is closed or reopened.
+    // The pages are mapped copy-on-write: a view can be modified by its user like a buffer, without touching the
+    // file or the other views. Pages that are only read are shared with other processes that map the same file.
+    class FileMapping
+        : public _i_multithread_reference_target_t
+    {
+    public:
+        // returns NULL if the file can't be mapped on this platform or isn't a local file
+        static FileMapping* Create(const char* szFilePath);
+
+        ~FileMapping();
+
+        char* GetData() const { return m_pData; }
+        uint64 GetSize() const { return m_nSize; }
+
+    private:
+        FileMapping();
+
+        char* m_pData;
+        uint64 m_nSize;
+#if defined(WIN32) || defined(WIN64)
+        void* m_hFile;
+        void* m_hMapping;
+#endif
+    };
+
+    typedef _smart_ptr<FileMapping> FileMappingPtr;
+}
+
+#endif // CRYINCLUDE_CRYSYSTEM_ZIPDIRFILEMAPPING_H
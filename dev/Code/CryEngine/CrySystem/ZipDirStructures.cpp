@@ -22,6 +22,12 @@
 #include <ISystem.h>
 #include "CryPak.h"
 #include "ICrypto.h"
+#include <lz4.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/parallel/atomic.h>
 
 #ifdef SUPPORT_UNBUFFERED_IO
 #include <shlwapi.h>
@@ -521,6 +527,94 @@ int ZipDir::ZipRawCompress (CMTSafeHeap* pHeap, const void* pUncompressed, unsig
     return err;
 }
 
+bool ZipDir::LZ4BlockTable::Init(const void* pData, uint32 nCompressedSize, uint32 nUncompressedSize)
+{
+    pHeader = (const ZipFile::LZ4BlockHeader*)pData;
+    if (nCompressedSize < sizeof(ZipFile::LZ4BlockHeader) || pHeader->lSignature != ZipFile::LZ4BlockHeader::SIGNATURE || pHeader->nBlockSize == 0
+        || pHeader->nBlockCount != ((uint64)nUncompressedSize + pHeader->nBlockSize - 1) / pHeader->nBlockSize
+        || GetTableSize(*pHeader) > nCompressedSize)
+    {
+        return false;
+    }
+
+    pBlockEnds = (const uint32*)(pHeader + 1);
+    nBlocksOffset = (uint32)GetTableSize(*pHeader);
+    this->nUncompressedSize = nUncompressedSize;
+
+    // validated once, so the blocks can be read on their own
+    const uint32 nBlocksSize = nCompressedSize - nBlocksOffset;
+    uint32 nBlockStart = 0;
+    for (uint32 nBlock = 0; nBlock < pHeader->nBlockCount; ++nBlock)
+    {
+        const uint32 nBlockEnd = pBlockEnds[nBlock];
+        if (nBlockEnd < nBlockStart || nBlockEnd > nBlocksSize || nBlockEnd - nBlockStart > GetUncompressedBlockSize(nBlock))
+        {
+            return false;
+        }
+        nBlockStart = nBlockEnd;
+    }
+    return true;
+}
+
+bool ZipDir::LZ4BlockTable::UncompressBlock(uint32 nBlock, const char* pSrc, char* pDst) const
+{
+    const uint32 nCompressedSize = GetBlockEnd(nBlock) - GetBlockStart(nBlock);
+    const uint32 nRawSize = GetUncompressedBlockSize(nBlock);
+    if (nCompressedSize == nRawSize)
+    {
+        memcpy(pDst, pSrc, nRawSize);
+        return true;
+    }
+    return LZ4_decompress_safe(pSrc, pDst, (int)nCompressedSize, (int)nRawSize) == (int)nRawSize;
+}
+
+int ZipDir::ZipBlockUncompress (void* pUncompressed, unsigned long nDestSize, const void* pCompressed, unsigned long nSrcSize)
+{
+    LOADING_TIME_PROFILE_SECTION(gEnv->pSystem);
+
+    LZ4BlockTable table;
+    if (!table.Init(pCompressed, (uint32)nSrcSize, (uint32)nDestSize))
+    {
+        return Z_DATA_ERROR;
+    }
+
+    const char* pBlocks = (const char*)pCompressed + table.nBlocksOffset;
+    char* pDst = (char*)pUncompressed;
+    AZStd::atomic<uint32> nNextBlock(0);
+    AZStd::atomic_bool bFailed(false);
+    auto uncompressBlocks = [&table, pBlocks, pDst, &nNextBlock, &bFailed]()
+    {
+        for (uint32 nBlock = nNextBlock.fetch_add(1); nBlock < table.GetBlockCount() && !bFailed.load(AZStd::memory_order_relaxed); nBlock = nNextBlock.fetch_add(1))
+        {
+            if (!table.UncompressBlock(nBlock, pBlocks + table.GetBlockStart(nBlock), pDst + (size_t)nBlock * table.GetBlockSize()))
+            {
+                bFailed.store(true, AZStd::memory_order_relaxed);
+            }
+        }
+    };
+
+    AZ::JobContext* pJobContext = AZ::JobContext::GetGlobalContext();
+    const uint32 nWorkerCount = pJobContext ? pJobContext->GetJobManager().GetNumWorkerThreads() : 0;
+    const uint32 nJobCount = min(nWorkerCount, table.GetBlockCount());
+    if (nJobCount <= 1)
+    {
+        uncompressBlocks();
+    }
+    else
+    {
+        AZ::JobCompletion jobCompletion;
+        for (uint32 nJob = 0; nJob < nJobCount; ++nJob)
+        {
+            AZ::Job* pJob = AZ::CreateJobFunction(uncompressBlocks, true, pJobContext);
+            pJob->SetDependent(&jobCompletion);
+            pJob->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+    return bFailed.load() ? Z_DATA_ERROR : Z_OK;
+}
+
 // finds the subdirectory entry by the name, using the names from the name pool
 // assumes: all directories are sorted in alphabetical order.
 // case-sensitive (must be lower-case if case-insensitive search in Win32 is performed)
@@ -233,6 +233,35 @@ namespace ZipDir
     // returns one of the Z_* errors (Z_OK upon success), and the size in *pDestSize. the pCompressed buffer must be at least nSrcSize*1.001+12 size
     extern int ZipRawCompress (CMTSafeHeap* pHeap, const void* pUncompressed, unsigned long* pDestSize, void* pCompressed, unsigned long nSrcSize, int nLevel);
 
+    // The block table of an entry compressed with ZipFile::METHOD_LZ4_BLOCKS (see ZipFile::LZ4BlockHeader)
+    struct LZ4BlockTable
+    {
+        const ZipFile::LZ4BlockHeader* pHeader;
+        const uint32* pBlockEnds;   // ends of the compressed blocks, relative to the first block
+        uint32 nBlocksOffset;       // offset of the first block in the data of the entry
+        uint32 nUncompressedSize;
+
+        // returns the size of the header and the block table
+        static uint64 GetTableSize(const ZipFile::LZ4BlockHeader& header) { return sizeof(header) + (uint64)header.nBlockCount * sizeof(uint32); }
+
+        // pData starts with the header and block table of an entry of nCompressedSize bytes.
+        // returns false if they don't describe nUncompressedSize bytes of data.
+        bool Init(const void* pData, uint32 nCompressedSize, uint32 nUncompressedSize);
+
+        uint32 GetBlockSize() const { return pHeader->nBlockSize; }
+        uint32 GetBlockCount() const { return pHeader->nBlockCount; }
+        uint32 GetBlockStart(uint32 nBlock) const { return nBlock ? pBlockEnds[nBlock - 1] : 0; }
+        uint32 GetBlockEnd(uint32 nBlock) const { return pBlockEnds[nBlock]; }
+        uint32 GetUncompressedBlockSize(uint32 nBlock) const { return min(pHeader->nBlockSize, nUncompressedSize - nBlock * pHeader->nBlockSize); }
+
+        // uncompresses block nBlock, that starts at pSrc, into pDst
+        bool UncompressBlock(uint32 nBlock, const char* pSrc, char* pDst) const;
+    };
+
+    // Uncompresses data that is compressed with ZipFile::METHOD_LZ4_BLOCKS into nDestSize bytes. The blocks are
+    // split between the job workers. returns one of the Z_* errors (Z_OK upon success)
+    extern int ZipBlockUncompress (void* pUncompressed, unsigned long nDestSize, const void* pCompressed, unsigned long nSrcSize);
+
     // fseek wrapper with memory in file support.
     extern int64 FSeek(CZipFile* zipFile, int64 origin, int command);
 
@@ -66,6 +66,7 @@ namespace ZipFile
         METHOD_DEFLATE_AND_STREAMCIPHER = 12, // Deflate + stream cipher encryption on a per file basis
         METHOD_STORE_AND_STREAMCIPHER_KEYTABLE = 13, // Store + Timur's encryption technique on a per file basis
         METHOD_DEFLATE_AND_STREAMCIPHER_KEYTABLE = 14, // Deflate + Timur's encryption technique on a per file basis
+        METHOD_LZ4_BLOCKS = 15, // The file is split into blocks that are compressed separately with LZ4 (see LZ4BlockHeader)
     };
 
 
@@ -247,6 +248,21 @@ namespace ZipFile
         uint16 attrTag;  // 2 bytes.
         uint16 attrSize; // 2 bytes.
     };
+
+    // The data of a METHOD_LZ4_BLOCKS entry starts with this header, followed by nBlockCount offsets (uint32) of the
+    // ends of the compressed blocks, relative to the end of the offset table, and then the blocks.
+    // Every block but the last holds nBlockSize bytes of the file and is compressed on its own, so the blocks can be
+    // decompressed in parallel or one at a time. A block whose compressed size is its uncompressed size is stored.
+    struct LZ4BlockHeader
+    {
+        enum
+        {
+            SIGNATURE = 0x42345a4c // "LZ4B"
+        };
+        uint32 lSignature;
+        uint32 nBlockSize;
+        uint32 nBlockCount;
+    } PACK_GCC;
 }
 
 #undef PACK_GCC
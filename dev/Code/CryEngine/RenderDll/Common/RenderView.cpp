@@ -127,14 +127,21 @@ void CRenderView::AddRenderItem(IRenderElement* pElem, CRenderObject* RESTRICT_P
     ri->pElem = pElem;
 
     // add flags atomically, if this one is not set already
+    // (plain read first so jobs filling the same list in parallel don't all contend on the cache line)
     volatile LONG* pBatchFlags = reinterpret_cast<volatile LONG*>(&m_BatchFlags[passInfo.GetRecursiveLevel()][nAafterWater][nList]);
-    CryInterlockedOr(pBatchFlags, nBatchFlags);
+    if ((*pBatchFlags & nBatchFlags) != nBatchFlags)
+    {
+        CryInterlockedOr(pBatchFlags, nBatchFlags);
+    }
 
     // update shadow pass flags if needed
     if (nList == EFSLIST_SHADOW_GEN && !(nBatchFlags & FB_IGNORE_SG_MASK))
     {
         volatile LONG* pShadowGenMask = reinterpret_cast<volatile LONG*>(passInfo.ShadowGenMaskAddress());
         uint32 nOrFlags = 1 << passInfo.ShadowFrustumSide();
-        CryInterlockedOr(pShadowGenMask, nOrFlags);
+        if ((*pShadowGenMask & nOrFlags) != nOrFlags)
+        {
+            CryInterlockedOr(pShadowGenMask, nOrFlags);
+        }
     }
 }
@@ -321,6 +321,7 @@ float CRenderer::CV_r_texturesstreamingResidencyThrottle;
 AllocateConstIntCVar(CRenderer, CV_r_texturesstreamingmipfading);
 int CRenderer::CV_r_TexturesStreamPoolSize;
 int CRenderer::CV_r_TexturesStreamPoolSecondarySize;
+int CRenderer::CV_r_TexturesStreamPoolIdleSlack;
 int CRenderer::CV_r_texturesskiplowermips;
 int CRenderer::CV_r_rendertargetpoolsize;
 float CRenderer::CV_r_TexturesStreamingMaxRequestedMB;
@@ -529,6 +530,7 @@ int CRenderer::CV_r_shaderslogcachemisses;
 int CRenderer::CV_r_shadersImport;
 int CRenderer::CV_r_shadersExport;
 int CRenderer::CV_r_shadersCacheUnavailableShaders;
+int CRenderer::CV_r_shadersPrecacheCacheMisses;
 AllocateConstIntCVar(CRenderer, CV_r_ShadersUseLLVMDirectXCompiler);
 
 AllocateConstIntCVar(CRenderer, CV_r_meshprecache);
@@ -2621,6 +2623,17 @@ void CRenderer::InitRenderer()
     REGISTER_CVAR3("r_TexturesStreamPoolSecondarySize", CV_r_TexturesStreamPoolSecondarySize, 0, VF_NULL,
         "Size of secondary pool for textures in MB.");
 
+#if defined(CONSOLE)
+    int nDefaultTexPoolIdleSlack = 0;
+#else
+    int nDefaultTexPoolIdleSlack = 20;
+#endif
+    REGISTER_CVAR3("r_TexturesStreamPoolIdleSlack", CV_r_TexturesStreamPoolIdleSlack, nDefaultTexPoolIdleSlack, VF_NULL,
+        "Percentage over the streaming budget that freed pool textures may stay allocated for reuse before they are released.\n"
+        "Lower values keep video memory closer to the budget at the cost of more device texture creation.\n"
+        "Usage: r_TexturesStreamPoolIdleSlack [percent]\n"
+        "Default is 20 on PC, 0 on consoles");
+
     REGISTER_CVAR3("r_TexturesStreamingSync", CV_r_texturesstreamingsync, 0, VF_RENDERER_CVAR,
         "Force only synchronous texture streaming.\n"
         "All textures will be streamed in the main thread. Useful for debug purposes.\n"
@@ -2922,6 +2935,10 @@ void CRenderer::InitRenderer()
     REGISTER_CVAR3("r_ShadersExport", CV_r_shadersExport, 1, VF_NULL,
         "0 off, 1 allow export of .fxb files during shader cache generation.");
 
+    REGISTER_CVAR3("r_ShadersPrecacheCacheMisses", CV_r_shadersPrecacheCacheMisses, 0, VF_NULL,
+        "0 off (default), 1 merge the combinations logged to ShaderCacheMisses.txt (see r_ShadersLogCacheMisses) into the shader list when generating the shader cache.\n"
+        "Allows a playtest to record the combinations it actually used so that the generated cache pre-warms them.");
+
     REGISTER_CVAR3("r_ShadersCacheUnavailableShaders", CV_r_shadersCacheUnavailableShaders, 0, VF_NULL,
         "0 off (default), 1 cache unavailable shaders to avoid requesting their compilation in future executions.");
 
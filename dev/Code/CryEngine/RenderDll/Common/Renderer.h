@@ -2112,6 +2112,7 @@ public:
     static int CV_r_shadersImport;
     static int CV_r_shadersExport;
     static int CV_r_shadersCacheUnavailableShaders;
+    static int CV_r_shadersPrecacheCacheMisses;
     DeclareStaticConstIntCVar(CV_r_ShadersUseLLVMDirectXCompiler, 0);
     static int CV_r_meshpoolsize;
     static int CV_r_meshinstancepoolsize;
@@ -2140,6 +2141,7 @@ public:
 
     static int CV_r_TexturesStreamPoolSize; //plz do not access directly, always by GetTexturesStreamPoolSize()
     static int CV_r_TexturesStreamPoolSecondarySize;
+    static int CV_r_TexturesStreamPoolIdleSlack;
     static inline int GetTexturesStreamPoolSize()
     {
         int poolSize = CV_r_TexturesStreamPoolSize + CV_r_TexturesStreamPoolSecondarySize;
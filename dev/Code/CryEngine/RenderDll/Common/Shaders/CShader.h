@@ -20,6 +20,7 @@
 #include "../ResFileLookupDataMan.h"
 
 #include <unordered_map>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/mutex.h>
 
 struct SRenderBuf;
@@ -472,6 +473,11 @@ public:
     // Concatenated list of shader names using automatic masks generation
     string m_pShadersRemapList;
 
+    // Share hash (see mfCreateShaderResources) to ids in CShader::s_ShaderResources_known, so sharing only compares candidates.
+    // Entries are validated against the slot on lookup, stale ones are dropped lazily.
+    typedef AZStd::unordered_multimap<uint32, uint16> ShareableResourcesIndex;
+    ShareableResourcesIndex m_ShareableResources;
+
     // Helper functors for cleaning up
 
     struct SShaderMapNameFlagsContainerDelete
@@ -536,6 +542,7 @@ public:
     void mfPostInit(void);
     void mfSortResources();
     CShaderResources* mfCreateShaderResources(const SInputShaderResources* Res, bool bShare);
+    void mfRebuildShareableResourcesIndex();
     bool mfRefreshResourceConstants(CShaderResources* Res);
     inline bool mfRefreshResourceConstants(SShaderItem& SI) { return mfRefreshResourceConstants((CShaderResources*)SI.m_pShaderResources); }
     bool mfUpdateTechnik (SShaderItem& SI, CCryNameTSCRC& Name);
@@ -606,6 +613,7 @@ public:
     void mfLoadDefaultSystemShaders ();
     void mfCloseShadersCache(int nID);
     void mfInitShadersCacheMissLog();
+    void mfMergeShadersCacheMisses();
 
     void mfInitShadersCache(byte bForLevel, FXShaderCacheCombinations* Combinations = NULL, const char* pCombinations = NULL, int nType = 0);
     void mfMergeShadersCombinations(FXShaderCacheCombinations* Combinations, int nType);
@@ -358,6 +358,7 @@ struct CompareCombItem
 };
 
 #define g_szTestResults "TestResults"
+#define g_szShaderCacheMisses "@cache@\\Shaders\\ShaderCacheMisses.txt"
 
 void CShaderMan::mfInitShadersCacheMissLog()
 {
@@ -373,7 +374,7 @@ void CShaderMan::mfInitShadersCacheMissLog()
     // create valid path
     gEnv->pCryPak->MakeDir(g_szTestResults);
 
-    m_ShaderCacheMissPath = string("@cache@\\Shaders\\ShaderCacheMisses.txt");  // do we want this here, or maybe in @log@ ?
+    m_ShaderCacheMissPath = string(g_szShaderCacheMisses);  // do we want this here, or maybe in @log@ ?
 
     // load data which is already stored
     AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
@@ -410,6 +411,56 @@ void CShaderMan::mfInitShadersCacheMissLog()
     }
 }
 
+// Merges the combinations a previous run logged as global cache misses for the current shader list into the
+// shader list combinations, so that shader cache generation also compiles what a playtest actually requested.
+void CShaderMan::mfMergeShadersCacheMisses()
+{
+    if (!CRenderer::CV_r_shadersPrecacheCacheMisses)
+    {
+        return;
+    }
+
+    AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+    gEnv->pFileIO->Open(g_szShaderCacheMisses, AZ::IO::OpenMode::ModeRead, fileHandle);
+    if (fileHandle == AZ::IO::InvalidHandle)
+    {
+        return;
+    }
+
+    // entries are logged as "[<shader list>]<combination>", only take the ones of the list being generated
+    const string listPrefix = string("[") + GetShaderListFilename().c_str() + "]";
+    string combinations;
+    int nMisses = 0;
+    char str[2048];
+    while (!gEnv->pFileIO->Eof(fileHandle))
+    {
+        str[0] = 0;
+        AZ::IO::FGetS(str, 2047, fileHandle);
+        if (!str[0] || azstrnicmp(str, listPrefix.c_str(), listPrefix.size()))
+        {
+            continue;
+        }
+        combinations += &str[listPrefix.size()];
+        if (combinations[combinations.size() - 1] != '\n')
+        {
+            combinations += '\n';
+        }
+        nMisses++;
+    }
+    gEnv->pFileIO->Close(fileHandle);
+
+    if (nMisses)
+    {
+        // parsing from memory resets the export list, which belongs to the shader list file
+        FXShaderCacheCombinations exportCombinations;
+        exportCombinations.swap(m_ShaderCacheExportCombinations);
+        mfInitShadersCache(false, &m_ShaderCacheCombinations[0], combinations.c_str(), 0);
+        m_ShaderCacheExportCombinations.swap(exportCombinations);
+
+        CryLogAlways("Merged %d shader cache misses from '%s' into the shader list", nMisses, g_szShaderCacheMisses);
+    }
+}
+
 void CShaderMan::mfInitShadersCache(byte bForLevel, FXShaderCacheCombinations* Combinations, const char* pCombinations, int nType)
 {
     COMPILE_TIME_ASSERT(SHADER_LIST_VER != SHADER_SERIALISE_VER);
@@ -707,6 +707,7 @@ void CShaderMan::ShutDown(void)
             delete pSR;
         }
         CShader::s_ShaderResources_known.Free();
+        m_ShareableResources.clear();
     }
 
     {
@@ -2263,6 +2264,7 @@ int CShaderMan::mfInitShadersList(std::vector<string>* Names)
         m_ShaderCacheExportCombinations.clear();
         mfCloseShadersCache(0);
         mfInitShadersCache(false, NULL, NULL, 0);
+        mfMergeShadersCacheMisses();
     }
 
 #ifndef NULL_RENDERER
@@ -3651,6 +3653,7 @@ void CShaderMan::mfSortResources()
             pPrev = pRes;
         }
     }
+    mfRebuildShareableResourcesIndex();
     iLog->Log("--- [Shaders System] : %d Shaders Resources, %d Shaders Resource groups.", CShader::s_ShaderResources_known.Num(), nGroups - 20000);
 
     // now run over the list of active (compiled binary) shaders
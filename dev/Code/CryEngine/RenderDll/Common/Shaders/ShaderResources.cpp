@@ -73,6 +73,7 @@ void CShaderResources::Reset()
     m_TexturesResourcesMap.clear();
     m_Id = 0;
     m_IdGroup = 0;
+    m_nShareHash = 0;
     m_pDeformInfo = NULL;
     m_pSky = NULL;
     m_ConstantBuffer = NULL;
@@ -38,6 +38,7 @@ public:
     SSkyInfo*                           m_pSky;                 // [Shader System TO DO] - disconnect and remove!
     uint16                              m_Id;                   // Id of the shader resource in the frame's SR list - s_ShaderResources_known
     uint16                              m_IdGroup;              // Id of the SR group for this SR in the frame's SR list.  Starts at 20,000
+    uint32                              m_nShareHash;           // Key of this SR in CShaderMan's sharing index, 0 if it is not shareable
 
     /////////////////////////////////////////////////////
     float                               m_fMinMipFactorLoad;
@@ -36,9 +36,95 @@
 #endif
 
 //===============================================================================
+// Hash of the fields mfCreateShaderResources compares before sharing a resource: resources that can
+// match always hash the same. Texture slots are combined order-independently and names are hashed
+// lowercase, matching the unordered map and the case-insensitive SEfResTexture compare.
+static uint32 sShareHash(const SInputShaderResources& res)
+{
+    uint32 nTexturesHash = 0;
+    for (const auto& iter : res.m_TexturesResourcesMap)
+    {
+        // only the slots sCanShareResources compares
+        if (iter.first < EFTT_MAX && !iter.second.m_Name.empty())
+        {
+            nTexturesHash += CCrc32::ComputeLowercase(iter.second.m_Name.c_str()) ^ (static_cast<uint32>(iter.first) * 0x9E3779B9u);
+        }
+    }
+
+    uint32 nHash = CCrc32::Compute(res.m_TexturePath.c_str());
+    nHash = nHash * 31 + res.m_ResFlags;
+    nHash = nHash * 31 + nTexturesHash;
+    return nHash | 1;   // 0 is kept for resources that are not in the sharing index
+}
+
+static bool sCanShareResources(SInputShaderResources& localCopySR, CShaderResources* pLoadedSRes)
+{
+    // [Shader System TO DO] - see if can be replaced with unified compare function
+    if (localCopySR.m_ResFlags != pLoadedSRes->GetResFlags() ||
+        localCopySR.m_LMaterial.m_Opacity != pLoadedSRes->GetStrengthValue(EFTT_OPACITY) ||
+        localCopySR.m_LMaterial.m_Emittance.a != pLoadedSRes->GetStrengthValue(EFTT_EMITTANCE) ||
+        localCopySR.m_AlphaRef != pLoadedSRes->GetAlphaRef() ||
+        localCopySR.m_TexturePath != pLoadedSRes->m_TexturePath)
+    {
+        return false;
+    }
+
+    // if there is not shader deformation or both deformations are identical
+    if (!((!pLoadedSRes->m_pDeformInfo && !localCopySR.m_DeformInfo.m_eType) || (pLoadedSRes->m_pDeformInfo && *pLoadedSRes->m_pDeformInfo == localCopySR.m_DeformInfo)))
+    {
+        return false;
+    }
+
+    // The following code runs over all slots and verify a match between current shader and
+    // loaded shaders If no match - break and add to the loaded.
+    for (uint16 j = 0; j < EFTT_MAX; j++)
+    {
+        SEfResTexture*  pLoadedTexRes = pLoadedSRes->GetTextureResource(j);
+        SEfResTexture*  pShaderTexRes = localCopySR.GetTextureResource(j);
+
+        // No loaded (cached) texture slot or no texture name for this slot
+        if (!pLoadedTexRes || pLoadedTexRes->m_Name.empty())
+        {
+            if (!pShaderTexRes || pShaderTexRes->m_Name.empty())
+            {   // match - no texture slot or texture name - move to the next slot
+                continue;
+            }
+
+            // slot exists but cannot be found in the resource - no shaders match - try the next cached shader
+            return false;
+        }
+        // Cached slot entry with texture name exists - test to see if exists for the current shader
+        else if (!pShaderTexRes || pShaderTexRes->m_Name.empty())
+        {
+            return false;  // texture slot doesn't exist / no texture name for current shader - no match - move to next cached shader
+        }
+
+        // both slots exist - run a full comparison between the two shaders (current and cached)
+        if (*pLoadedTexRes != *pShaderTexRes)
+        {
+            return false;  // no match - move to the next cached shader
+        }
+    }
+
+    // The two shader resources fully match
+    return true;
+}
+
+void CShaderMan::mfRebuildShareableResourcesIndex()
+{
+    m_ShareableResources.clear();
+    for (uint32 i = 1; i < CShader::s_ShaderResources_known.Num(); i++)
+    {
+        CShaderResources* pSR = CShader::s_ShaderResources_known[i];
+        if (pSR && pSR->m_nShareHash)
+        {
+            m_ShareableResources.insert(AZStd::make_pair(pSR->m_nShareHash, static_cast<uint16>(i)));
+        }
+    }
+}
+
 CShaderResources* CShaderMan::mfCreateShaderResources(const SInputShaderResources* Res, bool bShare)
 {
-    uint16      i, j;
     SInputShaderResources localCopySR = *Res;    // pay attention to this local copy
 
     // prepare local resources for cache-check, textures are looked up but not triggered for load
@@ -76,76 +162,40 @@ CShaderResources* CShaderMan::mfCreateShaderResources(const SInputShaderResource
 */
     }
 
-    // check local resources vs' global cache
-    int      nFree = -1;
-    for (i = 1; i < CShader::s_ShaderResources_known.Num(); i++)    // first entry is a null entry
+    // check local resources vs' the already loaded resources with the same hash
+    // NOT thread safe can be modified from render thread in SRenderShaderResources dtor ()
+    // (if flushing of unloaded textures (UnloadLevel) is not complete before pre-loading of new materials)
+    const uint32 nShareHash = sShareHash(localCopySR);
+    if (bShare && !Res->m_ShaderParams.size())
     {
-        // NOT thread safe can be modified from render thread in SRenderShaderResources dtor ()
-        // (if flushing of unloaded textures (UnloadLevel) is not complete before pre-loading of new materials)
-        CShaderResources*   pLoadedSRes = CShader::s_ShaderResources_known[i];
-        if (!pLoadedSRes)
+        auto range = m_ShareableResources.equal_range(nShareHash);
+        for (auto it = range.first; it != range.second; )
         {
-            nFree = i;  // find the first free slot in the bank
-            if (!bShare || Res->m_ShaderParams.size())
+            const uint16 nId = it->second;
+            CShaderResources* pLoadedSRes = (nId < CShader::s_ShaderResources_known.Num()) ? CShader::s_ShaderResources_known[nId] : nullptr;
+            if (!pLoadedSRes || pLoadedSRes->m_Id != nId || pLoadedSRes->m_nShareHash != nShareHash)
             {
-                break;
+                // released, renumbered or replaced since it was indexed
+                it = m_ShareableResources.erase(it);
+                continue;
             }
-            continue;
-        }
-        if (!bShare || Res->m_ShaderParams.size())
-        {
-            continue;
-        }
 
-        // [Shader System TO DO] - see if can be replaced with unified compare function
-        if (localCopySR.m_ResFlags == pLoadedSRes->GetResFlags() &&
-            localCopySR.m_LMaterial.m_Opacity == pLoadedSRes->GetStrengthValue(EFTT_OPACITY) &&
-            localCopySR.m_LMaterial.m_Emittance.a == pLoadedSRes->GetStrengthValue(EFTT_EMITTANCE) &&
-            localCopySR.m_AlphaRef == pLoadedSRes->GetAlphaRef() &&
-            localCopySR.m_TexturePath == pLoadedSRes->m_TexturePath)
-        {
-            // if there is not shader deformation or both deformations are identical
-            if ((!pLoadedSRes->m_pDeformInfo && !localCopySR.m_DeformInfo.m_eType) || (pLoadedSRes->m_pDeformInfo && *pLoadedSRes->m_pDeformInfo == localCopySR.m_DeformInfo))
+            if (sCanShareResources(localCopySR, pLoadedSRes))
             {
-                // [Shader System TO DO] - optimize 
-                // The following code runs over all slots and verify a match between current shader and 
-                // loaded shaders If no match - break and add to the loaded.
-                for (j = 0; j < EFTT_MAX; j++)
-                {
-                    SEfResTexture*  pLoadedTexRes = pLoadedSRes->GetTextureResource(j);
-                    SEfResTexture*  pShaderTexRes = localCopySR.GetTextureResource(j);
-
-                    // No loaded (cached) texture slot or no texture name for this slot
-                    if (!pLoadedTexRes || pLoadedTexRes->m_Name.empty())
-                    {
-                        if (!pShaderTexRes || pShaderTexRes->m_Name.empty())
-                        {   // match - no texture slot or texture name - move to the next slot
-                            continue;
-                        }
-
-                        // slot exists but cannot be found in the resource - no shaders match - try the next cached shader
-                        break;
-                    }
-                    // Cached slot entry with texture name exists - test to see if exists for the current shader
-                    else if (!pShaderTexRes || pShaderTexRes->m_Name.empty())
-                    {
-                        break;  // texture slot doesn't exist / no texture name for current shader - no match - move to next cached shader
-                    }
-
-                    // both slots exist - run a full comparison between the two shaders (current and cached)
-                    if (*pLoadedTexRes != *pShaderTexRes)
-                    {
-                        break;  // no match - move to the next cached shader
-                    }
-                }
-
-                // The two shader resources fully match - return the cached shader resource (no need to load)
-                if (j == EFTT_MAX)
-                {
-                    pLoadedSRes->AddRef();      // add usage count to this loaded shader resource
-                    return pLoadedSRes;
-                }
+                pLoadedSRes->AddRef();      // add usage count to this loaded shader resource
+                return pLoadedSRes;
             }
+            ++it;
+        }
+    }
+
+    int      nFree = -1;
+    for (uint32 i = 1; i < CShader::s_ShaderResources_known.Num(); i++)    // first entry is a null entry
+    {
+        if (!CShader::s_ShaderResources_known[i])
+        {
+            nFree = i;  // find the first free slot in the bank
+            break;
         }
     }
 
@@ -179,6 +229,14 @@ CShaderResources* CShaderMan::mfCreateShaderResources(const SInputShaderResource
         CShader::s_ShaderResources_known.AddElem(pSR);
     }
 
+    // Entries of released resources are only dropped when their hash is looked up again, rebuild before they pile up.
+    if (m_ShareableResources.size() >= 2 * static_cast<size_t>(CShader::s_ShaderResources_known.Num()))
+    {
+        mfRebuildShareableResourcesIndex();
+    }
+    pSR->m_nShareHash = nShareHash;
+    m_ShareableResources.insert(AZStd::make_pair(nShareHash, pSR->m_Id));
+
     return pSR;
 }
 
@@ -151,6 +151,7 @@ struct ShadowMapFrustum
             memset(mOctreePathNodeProcessed, 0x0, sizeof(mOctreePathNodeProcessed));
             mProcessedCasters.clear();
             mProcessedTerrainCasters.clear();
+            mFullUpdateRequested = false;
         }
 
         static const int MAX_TRAVERSAL_PATH_LENGTH = 32;
@@ -159,6 +160,10 @@ struct ShadowMapFrustum
 
         VectorSet<struct IShadowCaster*> mProcessedCasters;
         VectorSet<uint64> mProcessedTerrainCasters;
+
+        // Set when a caster baked into or overlapping this cached frustum was modified.
+        // Forces a full update of this frustum only, leaving the other cached cascades untouched.
+        bool mFullUpdateRequested;
     }* pShadowCacheData = nullptr;
 
 
@@ -57,6 +57,11 @@ public:
     virtual bool IsOverflowing() const = 0;
     virtual float GetBias() const { return 0.0f; }
 
+    // Streamed textures seen recently, and how many of them already had their required mip resident.
+    // The ratio tells how well the requests (including the predicted camera points) ran ahead of the view.
+    virtual int GetNumOnScreenTextures() const { return 0; }
+    virtual int GetNumOnScreenTexturesResident() const { return 0; }
+
     int GetMinStreamableMip() const;
     int GetMinStreamableMipWithSkip() const;
 
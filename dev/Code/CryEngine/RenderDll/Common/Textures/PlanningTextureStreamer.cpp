@@ -28,6 +28,8 @@ CPlanningTextureStreamer::CPlanningTextureStreamer()
     , m_nStreamAllocFails(0)
     , m_bOverBudget(false)
     , m_nPrevListSize(0)
+    , m_nStatsOnScreenTexs(0)
+    , m_nStatsOnScreenResidentTexs(0)
 {
     m_schedule.requestList.reserve(1024);
     m_schedule.trimmableList.reserve(4096);
@@ -114,6 +116,8 @@ void CPlanningTextureStreamer::BeginUpdateSchedule()
     sortInput.nOnScreenPoint = 0;
     sortInput.nPrecachedTexs = 0;
     sortInput.nListSize = 0;
+    sortInput.nOnScreenTexs = 0;
+    sortInput.nOnScreenResidentTexs = 0;
 
     sortInput.pRequestList = &schedule.requestList;
     sortInput.pTrimmableList = &schedule.trimmableList;
@@ -178,6 +182,9 @@ void CPlanningTextureStreamer::ApplySchedule(EApplyScheduleFlags asf)
     TPlanningActionVec& actions = schedule.actionList;
     TPlanningTextureReqVec& requested = schedule.requestList;
 
+    m_nStatsOnScreenTexs = (int)schedule.nOnScreenTexs;
+    m_nStatsOnScreenResidentTexs = (int)schedule.nOnScreenResidentTexs;
+
     for (TPlanningActionVec::iterator it = actions.begin(), itEnd = actions.end(); it != itEnd; ++it)
     {
         CTexture* pTex = textures[it->nTexture];
@@ -204,9 +211,7 @@ void CPlanningTextureStreamer::ApplySchedule(EApplyScheduleFlags asf)
 
         int nMaxItemsToFree = bOverflow ? 1000 : 2;
         size_t nGCLimit = schedule.memState.nMemLimit;
-#if !defined(CONSOLE)
-        nGCLimit = static_cast<size_t>(static_cast<int64>(nGCLimit) * 120 / 100);
-#endif
+        nGCLimit = static_cast<size_t>(static_cast<int64>(nGCLimit) * (100 + max(CRenderer::CV_r_TexturesStreamPoolIdleSlack, 0)) / 100);
         size_t nPoolSize = CTexture::s_pPoolMgr->GetReservedSize();
         CTexture::s_pPoolMgr->GarbageCollect(&nPoolSize, nGCLimit, nMaxItemsToFree);
     }
@@ -102,6 +102,8 @@ struct SPlanningSortState
     size_t nOnScreenPoint;
     size_t nPrecachedTexs;
     size_t nListSize;
+    size_t nOnScreenTexs;
+    size_t nOnScreenResidentTexs;
     TPlanningTextureReqVec* pRequestList;
     TStreamerTextureVec* pTrimmableList;
     TStreamerTextureVec* pUnlinkList;
@@ -121,6 +123,8 @@ struct SPlanningScheduleState
     TPlanningActionVec actionList;
     size_t nBalancePoint;
     size_t nOnScreenPoint;
+    size_t nOnScreenTexs;
+    size_t nOnScreenResidentTexs;
 };
 
 struct SPlanningUpdateMipRequest
@@ -246,6 +250,8 @@ public:
 
     virtual bool IsOverflowing() const;
     virtual float GetBias() const { return m_nBias / 256.0f; }
+    virtual int GetNumOnScreenTextures() const { return m_nStatsOnScreenTexs; }
+    virtual int GetNumOnScreenTexturesResident() const { return m_nStatsOnScreenResidentTexs; }
 
 public: // Job entry points - do not call directly!
     void Job_UpdateEntry();
@@ -316,6 +322,9 @@ private:
     int m_nStreamAllocFails;
     bool m_bOverBudget;
     size_t m_nPrevListSize;
+
+    int m_nStatsOnScreenTexs;
+    int m_nStatsOnScreenResidentTexs;
 };
 
 struct SPlanningTextureRequestOrder
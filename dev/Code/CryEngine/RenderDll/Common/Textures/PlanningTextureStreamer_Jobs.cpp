@@ -561,6 +561,19 @@ void CPlanningTextureStreamer::Job_Sort()
     int const nZoneIds[] = { sortState.arrRoundIds[0], sortState.arrRoundIds[1] };
     Job_InitKeys(pKeys, pTextures, nTextures, nFrameId - 8, nZoneIds);
 
+    // Count the visible textures that are already at their required mip, before the bias is applied
+    size_t nOnScreenTexs = 0;
+    size_t nOnScreenResidentTexs = 0;
+    for (size_t texIdx = 0; texIdx != nTextures; ++texIdx)
+    {
+        const SPlanningTextureOrderKey& key = pKeys[texIdx];
+        if (key.IsVisible())
+        {
+            ++nOnScreenTexs;
+            nOnScreenResidentTexs += key.nCurMip <= (max(0, key.GetFpMinMipCur()) >> 8) ? 1 : 0;
+        }
+    }
+
     SPlanningTextureOrderKey* pLastPrecachedKey = std::partition(pKeys, pKeys + nTextures, CTexturePrecachedPred());
     size_t nNumPrecachedTexs = std::distance(pKeys, pLastPrecachedKey);
 
@@ -592,6 +605,8 @@ void CPlanningTextureStreamer::Job_Sort()
     sortState.nOnScreenPoint = nOnScreenPoint;
     sortState.nPrecachedTexs = nNumPrecachedTexs;
     sortState.nBias = fpSortStateBias;
+    sortState.nOnScreenTexs = nOnScreenTexs;
+    sortState.nOnScreenResidentTexs = nOnScreenResidentTexs;
 }
 
 void CPlanningTextureStreamer::Job_InitKeys(SPlanningTextureOrderKey* pKeys, CTexture** pTexs, size_t nTextures, int nFrameId, const int nZoneIds[])
@@ -667,4 +682,6 @@ void CPlanningTextureStreamer::Job_ConfigureSchedule()
     schedule.memState = sortState.memState;
     schedule.nBalancePoint = sortState.nBalancePoint;
     schedule.nOnScreenPoint = sortState.nOnScreenPoint;
+    schedule.nOnScreenTexs = sortState.nOnScreenTexs;
+    schedule.nOnScreenResidentTexs = sortState.nOnScreenResidentTexs;
 }
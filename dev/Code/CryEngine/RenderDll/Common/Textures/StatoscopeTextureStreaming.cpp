@@ -62,7 +62,10 @@ IStatoscopeDataGroup::SDescription SStatoscopeTextureStreamingDG::GetDescription
         "(float bias) "
         "(int streamAllocFails) "
         "(float poolMemUsedMB) "
-        "(float poolMemWantedMB)]");
+        "(float poolMemWantedMB) "
+        "(int numOnScreen) "
+        "(int numOnScreenResident) "
+        "(float onScreenResidentRatio)]");
 }
 
 void SStatoscopeTextureStreamingDG::Write(IStatoscopeFrameRecord& fr)
@@ -96,6 +99,12 @@ void SStatoscopeTextureStreamingDG::Write(IStatoscopeFrameRecord& fr)
     fr.AddValue(CTexture::s_nStatsAllocFails);
     fr.AddValue(GetTexturePoolUsage());
     fr.AddValue(GetTexturePoolWanted());
+
+    const int nOnScreen = CTexture::s_pTextureStreamer->GetNumOnScreenTextures();
+    const int nOnScreenResident = CTexture::s_pTextureStreamer->GetNumOnScreenTexturesResident();
+    fr.AddValue(nOnScreen);
+    fr.AddValue(nOnScreenResident);
+    fr.AddValue(nOnScreen ? (float)nOnScreenResident / (float)nOnScreen : 1.0f);
 }
 
 float SStatoscopeTextureStreamingDG::GetTextureRequests()
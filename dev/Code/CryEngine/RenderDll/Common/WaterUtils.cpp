@@ -84,7 +84,8 @@ public:
         memset(m_pDisplaceGrid[1], 0, nSize);
         memset(m_pLUTK, 0, nSize);
 
-        m_nWorkerThreadID = m_nFillThreadID = 0;
+        m_nFillThreadID = 0;
+        m_nWorkerThreadID = 1;
         m_bQuit = false;
     }
 
@@ -119,7 +120,8 @@ public:
         memset(&m_pDisplaceFieldY[0], 0, nSize);
 
         nSize = m_nGridSize * m_nGridSize * sizeof(Vec4);
-        memset(m_pDisplaceGrid, 0, nSize);
+        memset(m_pDisplaceGrid[0], 0, nSize);
+        memset(m_pDisplaceGrid[1], 0, nSize);
         memset(m_pLUTK, 0, nSize);
     }
 
@@ -530,11 +532,7 @@ public:
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Renderer);
 
-        CRenderer* rd = gRenDev;
-
-        m_nFillThreadID = m_nWorkerThreadID = 0;
-
-        SWaterUpdateThreadInfo& pThreadInfo = m_pThreadInfo[m_nFillThreadID];
+        SWaterUpdateThreadInfo& pThreadInfo = m_pThreadInfo[m_nWorkerThreadID];
         pThreadInfo.nFrameID = nFrameID;
         pThreadInfo.fTime = fTime;
         pThreadInfo.bOnlyHeight = bOnlyHeight;
@@ -587,6 +585,12 @@ public:
         }
 
         WaitForJob();
+
+        // The finished grid becomes the one the renderer reads (and uploads), the job fills the other one.
+        // This adds a frame of latency but the upload never reads a grid that is being written.
+        m_nFillThreadID = m_nWorkerThreadID;
+        m_nWorkerThreadID = 1 - m_nFillThreadID;
+
         m_jobExecutor.Reset();
         m_jobExecutor.StartJob(
             [this, nFrameID, fTime, bOnlyHeight]()
@@ -19,6 +19,10 @@
 
 const float c_clipThres(0.1f);
 
+THREADLOCAL uint32 CRenderAuxGeomD3D::CAuxGeomCBCollector::s_tlsCollectorId = 0;
+THREADLOCAL CRenderAuxGeomD3D::CAuxGeomCBCollector::SThread* CRenderAuxGeomD3D::CAuxGeomCBCollector::s_tlsThread = nullptr;
+volatile int CRenderAuxGeomD3D::CAuxGeomCBCollector::s_nextCollectorId = 0;
+
 enum EAuxGeomBufferSizes
 {
     e_auxGeomVBSize = 0xffff,
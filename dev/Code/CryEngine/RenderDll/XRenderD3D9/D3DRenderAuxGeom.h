@@ -208,6 +208,12 @@ private:
                     m_rwlLocal.WUnlock();
                 }
 
+                // Only the owning thread calls Get, so the default buffer can be cached without locking
+                if (jobID == 0)
+                {
+                    m_cbCurrent = pAuxGeomCB;
+                }
+
                 return pAuxGeomCB;
             }
 
@@ -264,7 +270,19 @@ private:
 
         mutable CryRWLock m_rwGlobal;
 
+        // Identifies this collector in the thread local cache below, so a cache entry never outlives its collector
+        uint32 m_collectorId;
+
+        // Last SThread looked up by the current thread. Debug drawing calls GetIRenderAuxGeom() per primitive
+        // from many threads at once; the cache keeps those calls off the global and per thread locks.
+        static THREADLOCAL uint32 s_tlsCollectorId;
+        static THREADLOCAL SThread* s_tlsThread;
+        static volatile int s_nextCollectorId;
+
     public:
+        CAuxGeomCBCollector()
+            : m_collectorId(CryInterlockedIncrement(&s_nextCollectorId)) {}
+
         ~CAuxGeomCBCollector()
         {
             for (AUXThreadMap::iterator cbit = m_auxThreadMap.begin(); cbit != m_auxThreadMap.end(); ++cbit)
@@ -277,6 +295,11 @@ private:
         {
             threadID tid = CryGetCurrentThreadId();
 
+            if (s_tlsCollectorId == m_collectorId && s_tlsThread)
+            {
+                return s_tlsThread->Get(pRenderAuxGeomImpl, jobID, tid);
+            }
+
             m_rwGlobal.RLock();
 
             AUXThreadMap::const_iterator it = m_auxThreadMap.find(tid);
@@ -293,6 +316,9 @@ private:
                 m_rwGlobal.WUnlock();
             }
 
+            s_tlsCollectorId = m_collectorId;
+            s_tlsThread = auxThread;
+
             return auxThread->Get(pRenderAuxGeomImpl, jobID, tid);
         }
 
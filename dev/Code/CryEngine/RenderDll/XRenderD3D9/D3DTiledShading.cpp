@@ -426,6 +426,14 @@ AABB RotateAABB(const AABB& aabb, const Matrix33& mat)
     return AABB(pos - sz, pos + sz);
 }
 
+// The 3D engine culls lights by their bounding sphere only, the tighter probe and projector volumes can still
+// end up completely behind the camera or beyond the far plane. Those would never pass a tile's depth bounds test,
+// so they are dropped before using a slot in the light list.
+static inline bool IsTiledLightVolumeInDepthRange(const STiledLightCullInfo& lightCullInfo)
+{
+    return lightCullInfo.depthBounds.y >= 0.0f && lightCullInfo.depthBounds.x <= 1.0f;
+}
+
 void CTiledShading::PrepareLightList(TArray<SRenderLight>& envProbes, TArray<SRenderLight>& ambientLights, TArray<SRenderLight>& defLights)
 {
     AZ_TRACE_METHOD();
@@ -448,6 +456,7 @@ void CTiledShading::PrepareLightList(TArray<SRenderLight>& envProbes, TArray<SRe
     uint32 numTileLights = 0;
     uint32 numRenderLights = 0;
     uint32 numValidRenderLights = 0;
+    uint32 numCulledRenderLights = 0;
 
     // Reset lights
     ZeroMemory(g_tileLightsCull, sizeof(STiledLightCullInfo) * MaxNumTileLights);
@@ -523,6 +532,11 @@ void CTiledShading::PrepareLightList(TArray<SRenderLight>& envProbes, TArray<SRe
                 AABB aabb = RotateAABB(AABB(-renderLight.m_ProbeExtents, renderLight.m_ProbeExtents), Matrix33(renderLight.m_ObjMatrix));
                 aabb = RotateAABB(aabb, Matrix33(matView));
                 lightCullInfo.depthBounds = Vec2(posVS.z + aabb.min.z, posVS.z + aabb.max.z) * invCameraFar;
+                if (!IsTiledLightVolumeInDepthRange(lightCullInfo))
+                {
+                    ++numCulledRenderLights;
+                    continue;  // Skip light, before its cubemaps get added to the atlas
+                }
 
                 Vec4 u0 = Vec4(renderLight.m_ObjMatrix.GetColumn0().GetNormalized(), 0) * matView;
                 Vec4 u1 = Vec4(renderLight.m_ObjMatrix.GetColumn1().GetNormalized(), 0) * matView;
@@ -670,6 +684,12 @@ void CTiledShading::PrepareLightList(TArray<SRenderLight>& envProbes, TArray<SRe
                     lightShadeInfo.projectorMatrix = areaLightParams;
                 }
 
+                if (!IsTiledLightVolumeInDepthRange(lightCullInfo))
+                {
+                    ++numCulledRenderLights;
+                    continue;  // Skip light
+                }
+
                 // Handle shadow casters
                 if (!ambientLight && lightIdx >= firstShadowLight && lightIdx < curShadowPoolLight)
                 {
@@ -774,7 +794,7 @@ void CTiledShading::PrepareLightList(TArray<SRenderLight>& envProbes, TArray<SRe
         ZeroMemory(&g_tileLightsShade[numTileLights], sizeof(STiledLightShadeInfo));
     }
 
-    m_numSkippedLights = numRenderLights - numValidRenderLights;
+    m_numSkippedLights = numRenderLights - numValidRenderLights - numCulledRenderLights;
 
     // Add sun
     if (rd->m_RP.m_pSunLight)
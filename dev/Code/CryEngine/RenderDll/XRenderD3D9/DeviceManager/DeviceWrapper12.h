@@ -438,7 +438,14 @@ public:
     std::vector<CDeviceComputeCommandListUPtr> AcquireComputeCommandLists(uint32 listCount);
     std::vector<CDeviceCopyCommandListUPtr> AcquireCopyCommandLists(uint32 listCount, CDeviceCopyCommandList::ECopyType eType);
 
+    // True if command-lists acquired below can be recorded on several threads at the same time.
+    // DX11 records them into deferred contexts, without deferred context support (DXGL, DXMETAL) they record straight onto
+    // the immediate context and must be recorded on the render thread, in allocation-order.
+    // DX11 lists read the constant buffers when they are submitted, so buffers they use must not change until then.
+    bool SupportsParallelCommandListRecording();
+
     // Command-list sinks, will automatically submit command-lists in [global] allocation-order
+    // DX11 submits on the immediate context, so acquire and forfeit from the render thread
     void ForfeitGraphicsCommandList(CDeviceGraphicsCommandListUPtr pCommandList);
     void ForfeitComputeCommandList(CDeviceComputeCommandListUPtr pCommandList);
     void ForfeitCopyCommandList(CDeviceCopyCommandListUPtr pCommandList);
@@ -384,7 +384,9 @@ public:
         }
     };
 
-    CDeviceGraphicsCommandList_DX11()
+    CDeviceGraphicsCommandList_DX11(ID3D11DeviceContext* pDeferredContext = nullptr, uint32 submitIndex = 0)
+        : m_pDeferredContext(pDeferredContext)
+        , m_SubmitIndex(submitIndex)
     {
         Reset();
     }
@@ -392,6 +394,34 @@ public:
     void SetResources_RequestedByShaderOnly(CDeviceResourceSet_DX11* pResources);
     void SetResources_All(CDeviceResourceSet_DX11* pResources);
 
+    // State changes and draws go straight to the deferred context of command-lists acquired from the factory,
+    // the core command-list goes through the device manager on the immediate context.
+    void BindShader(EHWShaderClass shaderClass, ID3D11Resource* pShader);
+    void BindSRV(EHWShaderClass shaderClass, ID3D11ShaderResourceView* pSrv, uint32 slot);
+    void BindSampler(EHWShaderClass shaderClass, ID3D11SamplerState* pSamplerState, uint32 slot);
+    void BindConstantBuffer(EHWShaderClass shaderClass, AzRHI::ConstantBuffer* pBuffer, uint32 slot);
+    void BindVB(D3DBuffer* pBuffer, uint32 slot, uint32 offset, uint32 stride);
+    void BindIB(D3DBuffer* pBuffer, uint32 offset, DXGI_FORMAT format);
+    void BindVtxDecl(ID3D11InputLayout* pInputLayout);
+    void BindTopology(D3D11_PRIMITIVE_TOPOLOGY topology);
+    void SetDepthStencilState(ID3D11DepthStencilState* pDepthStencilState, uint32 stencilRef);
+    void SetBlendState(ID3D11BlendState* pBlendState);
+    void SetRasterState(ID3D11RasterizerState* pRasterizerState);
+
+    ID3D11DeviceContext& GetContext() const
+    {
+        if (m_pDeferredContext)
+        {
+            return *m_pDeferredContext;
+        }
+
+        return gcpRendD3D->GetDeviceContext();
+    }
+
+    _smart_ptr<ID3D11DeviceContext>                     m_pDeferredContext;
+    _smart_ptr<ID3D11CommandList>                       m_pRecordedCommandList;
+    uint32                                              m_SubmitIndex;
+
     SCachedValue<ID3D11DepthStencilState*>              m_CurrentDS;
     SCachedValue<ID3D11RasterizerState*>                m_CurrentRS;
     SCachedValue<ID3D11BlendState*>                     m_CurrentBS;
@@ -415,10 +445,209 @@ public:
 
 #define GET_DX11_COMMANDLIST(abstractCommandList) reinterpret_cast<CDeviceGraphicsCommandList_DX11*>(abstractCommandList)
 
-void CDeviceGraphicsCommandList::SetRenderTargets(uint32 targetCount, CTexture** pTargets, SDepthTexture* pDepthTarget)
+void CDeviceGraphicsCommandList_DX11::BindShader(EHWShaderClass shaderClass, ID3D11Resource* pShader)
 {
-    CD3D9Renderer* const __restrict rd = gcpRendD3D;
+    if (!m_pDeferredContext)
+    {
+        gcpRendD3D->m_DevMan.BindShader(shaderClass, pShader);
+        return;
+    }
 
+    switch (shaderClass)
+    {
+    case eHWSC_Vertex:
+        m_pDeferredContext->VSSetShader(reinterpret_cast<ID3D11VertexShader*>(pShader), NULL, 0);
+        break;
+    case eHWSC_Pixel:
+        m_pDeferredContext->PSSetShader(reinterpret_cast<ID3D11PixelShader*>(pShader), NULL, 0);
+        break;
+    case eHWSC_Geometry:
+        m_pDeferredContext->GSSetShader(reinterpret_cast<ID3D11GeometryShader*>(pShader), NULL, 0);
+        break;
+    case eHWSC_Domain:
+        m_pDeferredContext->DSSetShader(reinterpret_cast<ID3D11DomainShader*>(pShader), NULL, 0);
+        break;
+    case eHWSC_Hull:
+        m_pDeferredContext->HSSetShader(reinterpret_cast<ID3D11HullShader*>(pShader), NULL, 0);
+        break;
+    default:
+        CRY_ASSERT(false);
+    }
+}
+
+void CDeviceGraphicsCommandList_DX11::BindSRV(EHWShaderClass shaderClass, ID3D11ShaderResourceView* pSrv, uint32 slot)
+{
+    if (!m_pDeferredContext)
+    {
+        gcpRendD3D->m_DevMan.BindSRV(shaderClass, pSrv, slot);
+        return;
+    }
+
+    switch (shaderClass)
+    {
+    case eHWSC_Vertex:
+        m_pDeferredContext->VSSetShaderResources(slot, 1, &pSrv);
+        break;
+    case eHWSC_Pixel:
+        m_pDeferredContext->PSSetShaderResources(slot, 1, &pSrv);
+        break;
+    case eHWSC_Geometry:
+        m_pDeferredContext->GSSetShaderResources(slot, 1, &pSrv);
+        break;
+    case eHWSC_Domain:
+        m_pDeferredContext->DSSetShaderResources(slot, 1, &pSrv);
+        break;
+    case eHWSC_Hull:
+        m_pDeferredContext->HSSetShaderResources(slot, 1, &pSrv);
+        break;
+    default:
+        CRY_ASSERT(false);
+    }
+}
+
+void CDeviceGraphicsCommandList_DX11::BindSampler(EHWShaderClass shaderClass, ID3D11SamplerState* pSamplerState, uint32 slot)
+{
+    if (!m_pDeferredContext)
+    {
+        gcpRendD3D->m_DevMan.BindSampler(shaderClass, pSamplerState, slot);
+        return;
+    }
+
+    switch (shaderClass)
+    {
+    case eHWSC_Vertex:
+        m_pDeferredContext->VSSetSamplers(slot, 1, &pSamplerState);
+        break;
+    case eHWSC_Pixel:
+        m_pDeferredContext->PSSetSamplers(slot, 1, &pSamplerState);
+        break;
+    case eHWSC_Geometry:
+        m_pDeferredContext->GSSetSamplers(slot, 1, &pSamplerState);
+        break;
+    case eHWSC_Domain:
+        m_pDeferredContext->DSSetSamplers(slot, 1, &pSamplerState);
+        break;
+    case eHWSC_Hull:
+        m_pDeferredContext->HSSetSamplers(slot, 1, &pSamplerState);
+        break;
+    default:
+        CRY_ASSERT(false);
+    }
+}
+
+void CDeviceGraphicsCommandList_DX11::BindConstantBuffer(EHWShaderClass shaderClass, AzRHI::ConstantBuffer* pBuffer, uint32 slot)
+{
+    if (!m_pDeferredContext)
+    {
+        gcpRendD3D->m_DevMan.BindConstantBuffer(shaderClass, pBuffer, slot);
+        return;
+    }
+
+    // Deferred contexts are only created without D3D11.1, so constant buffers are never bound at an offset here
+    D3DBuffer* pPlatformBuffer = pBuffer ? pBuffer->GetPlatformBuffer() : nullptr;
+    AZ_Assert(!pBuffer || pBuffer->GetByteOffset() == 0, "Offset not supported");
+
+    switch (shaderClass)
+    {
+    case eHWSC_Vertex:
+        m_pDeferredContext->VSSetConstantBuffers(slot, 1, &pPlatformBuffer);
+        break;
+    case eHWSC_Pixel:
+        m_pDeferredContext->PSSetConstantBuffers(slot, 1, &pPlatformBuffer);
+        break;
+    case eHWSC_Geometry:
+        m_pDeferredContext->GSSetConstantBuffers(slot, 1, &pPlatformBuffer);
+        break;
+    case eHWSC_Domain:
+        m_pDeferredContext->DSSetConstantBuffers(slot, 1, &pPlatformBuffer);
+        break;
+    case eHWSC_Hull:
+        m_pDeferredContext->HSSetConstantBuffers(slot, 1, &pPlatformBuffer);
+        break;
+    default:
+        CRY_ASSERT(false);
+    }
+}
+
+void CDeviceGraphicsCommandList_DX11::BindVB(D3DBuffer* pBuffer, uint32 slot, uint32 offset, uint32 stride)
+{
+    if (!m_pDeferredContext)
+    {
+        gcpRendD3D->m_DevMan.BindVB(pBuffer, slot, offset, stride);
+        return;
+    }
+
+    m_pDeferredContext->IASetVertexBuffers(slot, 1, &pBuffer, &stride, &offset);
+}
+
+void CDeviceGraphicsCommandList_DX11::BindIB(D3DBuffer* pBuffer, uint32 offset, DXGI_FORMAT format)
+{
+    if (!m_pDeferredContext)
+    {
+        gcpRendD3D->m_DevMan.BindIB(pBuffer, offset, format);
+        return;
+    }
+
+    m_pDeferredContext->IASetIndexBuffer(pBuffer, format, offset);
+}
+
+void CDeviceGraphicsCommandList_DX11::BindVtxDecl(ID3D11InputLayout* pInputLayout)
+{
+    if (!m_pDeferredContext)
+    {
+        gcpRendD3D->m_DevMan.BindVtxDecl(pInputLayout);
+        return;
+    }
+
+    m_pDeferredContext->IASetInputLayout(pInputLayout);
+}
+
+void CDeviceGraphicsCommandList_DX11::BindTopology(D3D11_PRIMITIVE_TOPOLOGY topology)
+{
+    if (!m_pDeferredContext)
+    {
+        gcpRendD3D->m_DevMan.BindTopology(topology);
+        return;
+    }
+
+    m_pDeferredContext->IASetPrimitiveTopology(topology);
+}
+
+void CDeviceGraphicsCommandList_DX11::SetDepthStencilState(ID3D11DepthStencilState* pDepthStencilState, uint32 stencilRef)
+{
+    if (!m_pDeferredContext)
+    {
+        gcpRendD3D->m_DevMan.SetDepthStencilState(pDepthStencilState, stencilRef);
+        return;
+    }
+
+    m_pDeferredContext->OMSetDepthStencilState(pDepthStencilState, stencilRef);
+}
+
+void CDeviceGraphicsCommandList_DX11::SetBlendState(ID3D11BlendState* pBlendState)
+{
+    if (!m_pDeferredContext)
+    {
+        gcpRendD3D->m_DevMan.SetBlendState(pBlendState, NULL, 0xffffffff);
+        return;
+    }
+
+    m_pDeferredContext->OMSetBlendState(pBlendState, NULL, 0xffffffff);
+}
+
+void CDeviceGraphicsCommandList_DX11::SetRasterState(ID3D11RasterizerState* pRasterizerState)
+{
+    if (!m_pDeferredContext)
+    {
+        gcpRendD3D->m_DevMan.SetRasterState(pRasterizerState);
+        return;
+    }
+
+    m_pDeferredContext->RSSetState(pRasterizerState);
+}
+
+void CDeviceGraphicsCommandList::SetRenderTargets(uint32 targetCount, CTexture** pTargets, SDepthTexture* pDepthTarget)
+{
     ID3D11RenderTargetView* pRTV[RT_STACK_WIDTH] = { NULL };
 
     for (int i = 0; i < targetCount; ++i)
@@ -429,19 +658,17 @@ void CDeviceGraphicsCommandList::SetRenderTargets(uint32 targetCount, CTexture**
         }
     }
 
-    rd->GetDeviceContext().OMSetRenderTargets(targetCount, pRTV, pDepthTarget ? static_cast<D3DDepthSurface*>(pDepthTarget->pSurf) : NULL);
+    GET_DX11_COMMANDLIST(this)->GetContext().OMSetRenderTargets(targetCount, pRTV, pDepthTarget ? static_cast<D3DDepthSurface*>(pDepthTarget->pSurf) : NULL);
 }
 
 void CDeviceGraphicsCommandList::SetViewports(uint32 vpCount, const D3DViewPort* pViewports)
 {
-    CD3D9Renderer* const __restrict rd = gcpRendD3D;
-    rd->GetDeviceContext().RSSetViewports(vpCount, pViewports);
+    GET_DX11_COMMANDLIST(this)->GetContext().RSSetViewports(vpCount, pViewports);
 }
 
 void CDeviceGraphicsCommandList::SetScissorRects(uint32 rcCount, const D3DRectangle* pRects)
 {
-    CD3D9Renderer* const __restrict rd = gcpRendD3D;
-    rd->GetDeviceContext().RSSetScissorRects(rcCount, pRects);
+    GET_DX11_COMMANDLIST(this)->GetContext().RSSetScissorRects(rcCount, pRects);
 }
 
 void CDeviceGraphicsCommandList::SetPipelineStateImpl(CDeviceGraphicsPSOPtr devicePSO)
@@ -453,48 +680,48 @@ void CDeviceGraphicsCommandList::SetPipelineStateImpl(CDeviceGraphicsPSOPtr devi
     // RasterState, DepthStencilState, BlendState
     if (pCmdList->m_CurrentDS.Set(pDevicePSO->pDepthStencilState))
     {
-        rd->m_DevMan.SetDepthStencilState(pDevicePSO->pDepthStencilState, 0);
+        pCmdList->SetDepthStencilState(pDevicePSO->pDepthStencilState, 0);
     }
     if (pCmdList->m_CurrentBS.Set(pDevicePSO->pBlendState))
     {
-        rd->m_DevMan.SetBlendState(pDevicePSO->pBlendState, NULL, 0xffffffff);
+        pCmdList->SetBlendState(pDevicePSO->pBlendState);
     }
     if (pCmdList->m_CurrentRS.Set(pDevicePSO->pRasterizerState))
     {
-        rd->m_DevMan.SetRasterState(pDevicePSO->pRasterizerState);
+        pCmdList->SetRasterState(pDevicePSO->pRasterizerState);
     }
 
     // Shaders
     const std::array<void*, eHWSC_Num>& shaders = pDevicePSO->m_pDeviceShaders;
     if (pCmdList->m_CurrentShader[eHWSC_Vertex].Set(shaders[eHWSC_Vertex]))
     {
-        rd->m_DevMan.BindShader(eHWSC_Vertex, (ID3D11Resource*)shaders[eHWSC_Vertex]);
+        pCmdList->BindShader(eHWSC_Vertex, (ID3D11Resource*)shaders[eHWSC_Vertex]);
     }
     if (pCmdList->m_CurrentShader[eHWSC_Pixel].Set(shaders[eHWSC_Pixel]))
     {
-        rd->m_DevMan.BindShader(eHWSC_Pixel, (ID3D11Resource*)shaders[eHWSC_Pixel]);
+        pCmdList->BindShader(eHWSC_Pixel, (ID3D11Resource*)shaders[eHWSC_Pixel]);
     }
     if (pCmdList->m_CurrentShader[eHWSC_Geometry].Set(shaders[eHWSC_Geometry]))
     {
-        rd->m_DevMan.BindShader(eHWSC_Geometry, (ID3D11Resource*)shaders[eHWSC_Geometry]);
+        pCmdList->BindShader(eHWSC_Geometry, (ID3D11Resource*)shaders[eHWSC_Geometry]);
     }
     if (pCmdList->m_CurrentShader[eHWSC_Domain].Set(shaders[eHWSC_Domain]))
     {
-        rd->m_DevMan.BindShader(eHWSC_Domain, (ID3D11Resource*)shaders[eHWSC_Domain]);
+        pCmdList->BindShader(eHWSC_Domain, (ID3D11Resource*)shaders[eHWSC_Domain]);
     }
     if (pCmdList->m_CurrentShader[eHWSC_Hull].Set(shaders[eHWSC_Hull]))
     {
-        rd->m_DevMan.BindShader(eHWSC_Hull, (ID3D11Resource*)shaders[eHWSC_Hull]);
+        pCmdList->BindShader(eHWSC_Hull, (ID3D11Resource*)shaders[eHWSC_Hull]);
     }
 
     // input layout and topology
     if (pCmdList->m_CurrentInputLayout.Set(pDevicePSO->pInputLayout))
     {
-        rd->m_DevMan.BindVtxDecl(pDevicePSO->pInputLayout);
+        pCmdList->BindVtxDecl(pDevicePSO->pInputLayout);
     }
     if (pCmdList->m_CurrentTopology.Set(pDevicePSO->m_PrimitiveTopology))
     {
-        rd->m_DevMan.BindTopology(pDevicePSO->m_PrimitiveTopology);
+        pCmdList->BindTopology(pDevicePSO->m_PrimitiveTopology);
     }
 
     // update valid shader mask
@@ -527,9 +754,13 @@ void CDeviceGraphicsCommandList::SetPipelineStateImpl(CDeviceGraphicsPSOPtr devi
     pCmdList->m_NumSamplers = pDevicePSO->m_NumSamplers;
 
     // TheoM TODO: REMOVE once shaders are set up completely via pso
-    rd->m_RP.m_FlagsShader_RT = pDevicePSO->m_ShaderFlags_RT;
-    rd->m_RP.m_FlagsShader_MD = pDevicePSO->m_ShaderFlags_MD;
-    rd->m_RP.m_FlagsShader_MDV = pDevicePSO->m_ShaderFlags_MDV;
+    // The shared render pipeline flags only belong to the core command-list, the others can be recorded off the render thread
+    if (!pCmdList->m_pDeferredContext)
+    {
+        rd->m_RP.m_FlagsShader_RT = pDevicePSO->m_ShaderFlags_RT;
+        rd->m_RP.m_FlagsShader_MD = pDevicePSO->m_ShaderFlags_MD;
+        rd->m_RP.m_FlagsShader_MDV = pDevicePSO->m_ShaderFlags_MDV;
+    }
 }
 
 void CDeviceGraphicsCommandList::SetResourceLayout(CDeviceResourceLayout* pResourceLayout)
@@ -553,8 +784,6 @@ void CDeviceGraphicsCommandList::SetResourcesImpl(uint32 bindSlot, CDeviceResour
 
 void CDeviceGraphicsCommandList_DX11::SetResources_RequestedByShaderOnly(CDeviceResourceSet_DX11* pResources)
 {
-    CD3D9Renderer* const __restrict rd = gcpRendD3D;
-
     for (EHWShaderClass shaderClass = eHWSC_Vertex; shaderClass != eHWSC_Num; shaderClass = EHWShaderClass(shaderClass + 1))
     {
         if (m_ValidShaderStages & SHADERSTAGE_FROM_SHADERCLASS(shaderClass))
@@ -574,19 +803,19 @@ void CDeviceGraphicsCommandList_DX11::SetResources_RequestedByShaderOnly(CDevice
                             switch (shaderClass)
                             {
                             case eHWSC_Vertex:
-                                rd->m_DevMan.BindSRV(eHWSC_Vertex, pSrv, srvSlot);
+                                BindSRV(eHWSC_Vertex, pSrv, srvSlot);
                                 break;
                             case eHWSC_Pixel:
-                                rd->m_DevMan.BindSRV(eHWSC_Pixel, pSrv, srvSlot);
+                                BindSRV(eHWSC_Pixel, pSrv, srvSlot);
                                 break;
                             case eHWSC_Geometry:
-                                rd->m_DevMan.BindSRV(eHWSC_Geometry, pSrv, srvSlot);
+                                BindSRV(eHWSC_Geometry, pSrv, srvSlot);
                                 break;
                             case eHWSC_Domain:
-                                rd->m_DevMan.BindSRV(eHWSC_Domain, pSrv, srvSlot);
+                                BindSRV(eHWSC_Domain, pSrv, srvSlot);
                                 break;
                             case eHWSC_Hull:
-                                rd->m_DevMan.BindSRV(eHWSC_Hull, pSrv, srvSlot);
+                                BindSRV(eHWSC_Hull, pSrv, srvSlot);
                                 break;
                             default:
                                 CRY_ASSERT(false);
@@ -611,19 +840,19 @@ void CDeviceGraphicsCommandList_DX11::SetResources_RequestedByShaderOnly(CDevice
                             switch (shaderClass)
                             {
                             case eHWSC_Vertex:
-                                rd->m_DevMan.BindSampler(eHWSC_Vertex, pSamplerState, samplerSlot);
+                                BindSampler(eHWSC_Vertex, pSamplerState, samplerSlot);
                                 break;
                             case eHWSC_Pixel:
-                                rd->m_DevMan.BindSampler(eHWSC_Pixel, pSamplerState, samplerSlot);
+                                BindSampler(eHWSC_Pixel, pSamplerState, samplerSlot);
                                 break;
                             case eHWSC_Geometry:
-                                rd->m_DevMan.BindSampler(eHWSC_Geometry, pSamplerState, samplerSlot);
+                                BindSampler(eHWSC_Geometry, pSamplerState, samplerSlot);
                                 break;
                             case eHWSC_Domain:
-                                rd->m_DevMan.BindSampler(eHWSC_Domain, pSamplerState, samplerSlot);
+                                BindSampler(eHWSC_Domain, pSamplerState, samplerSlot);
                                 break;
                             case eHWSC_Hull:
-                                rd->m_DevMan.BindSampler(eHWSC_Hull, pSamplerState, samplerSlot);
+                                BindSampler(eHWSC_Hull, pSamplerState, samplerSlot);
                                 break;
                             default:
                                 CRY_ASSERT(false);
@@ -642,19 +871,19 @@ void CDeviceGraphicsCommandList_DX11::SetResources_RequestedByShaderOnly(CDevice
                     switch (shaderClass)
                     {
                     case eHWSC_Vertex:
-                        rd->m_DevMan.BindConstantBuffer(eHWSC_Vertex, cb.m_constantBuffer, cb.m_shaderSlot);
+                        BindConstantBuffer(eHWSC_Vertex, cb.m_constantBuffer, cb.m_shaderSlot);
                         break;
                     case eHWSC_Pixel:
-                        rd->m_DevMan.BindConstantBuffer(eHWSC_Pixel, cb.m_constantBuffer, cb.m_shaderSlot);
+                        BindConstantBuffer(eHWSC_Pixel, cb.m_constantBuffer, cb.m_shaderSlot);
                         break;
                     case eHWSC_Geometry:
-                        rd->m_DevMan.BindConstantBuffer(eHWSC_Geometry, cb.m_constantBuffer, cb.m_shaderSlot);
+                        BindConstantBuffer(eHWSC_Geometry, cb.m_constantBuffer, cb.m_shaderSlot);
                         break;
                     case eHWSC_Domain:
-                        rd->m_DevMan.BindConstantBuffer(eHWSC_Domain, cb.m_constantBuffer, cb.m_shaderSlot);
+                        BindConstantBuffer(eHWSC_Domain, cb.m_constantBuffer, cb.m_shaderSlot);
                         break;
                     case eHWSC_Hull:
-                        rd->m_DevMan.BindConstantBuffer(eHWSC_Hull, cb.m_constantBuffer, cb.m_shaderSlot);
+                        BindConstantBuffer(eHWSC_Hull, cb.m_constantBuffer, cb.m_shaderSlot);
                         break;
                     default:
                         CRY_ASSERT(false);
@@ -667,8 +896,6 @@ void CDeviceGraphicsCommandList_DX11::SetResources_RequestedByShaderOnly(CDevice
 
 void CDeviceGraphicsCommandList_DX11::SetResources_All(CDeviceResourceSet_DX11* pResources)
 {
-    CD3D9Renderer* const __restrict rd = gcpRendD3D;
-
     for (EHWShaderClass shaderClass = eHWSC_Vertex; shaderClass != eHWSC_Num; shaderClass = EHWShaderClass(shaderClass + 1))
     {
         if (m_ValidShaderStages & SHADERSTAGE_FROM_SHADERCLASS(shaderClass))
@@ -685,19 +912,19 @@ void CDeviceGraphicsCommandList_DX11::SetResources_All(CDeviceResourceSet_DX11*
                         switch (shaderClass)
                         {
                         case eHWSC_Vertex:
-                            rd->m_DevMan.BindSRV(eHWSC_Vertex, pSrv, slot);
+                            BindSRV(eHWSC_Vertex, pSrv, slot);
                             break;
                         case eHWSC_Pixel:
-                            rd->m_DevMan.BindSRV(eHWSC_Pixel, pSrv, slot);
+                            BindSRV(eHWSC_Pixel, pSrv, slot);
                             break;
                         case eHWSC_Geometry:
-                            rd->m_DevMan.BindSRV(eHWSC_Geometry, pSrv, slot);
+                            BindSRV(eHWSC_Geometry, pSrv, slot);
                             break;
                         case eHWSC_Domain:
-                            rd->m_DevMan.BindSRV(eHWSC_Domain, pSrv, slot);
+                            BindSRV(eHWSC_Domain, pSrv, slot);
                             break;
                         case eHWSC_Hull:
-                            rd->m_DevMan.BindSRV(eHWSC_Hull, pSrv, slot);
+                            BindSRV(eHWSC_Hull, pSrv, slot);
                             break;
                         default:
                             CRY_ASSERT(false);
@@ -718,19 +945,19 @@ void CDeviceGraphicsCommandList_DX11::SetResources_All(CDeviceResourceSet_DX11*
                         switch (shaderClass)
                         {
                         case eHWSC_Vertex:
-                            rd->m_DevMan.BindSampler(eHWSC_Vertex, pSamplerState, slot);
+                            BindSampler(eHWSC_Vertex, pSamplerState, slot);
                             break;
                         case eHWSC_Pixel:
-                            rd->m_DevMan.BindSampler(eHWSC_Pixel, pSamplerState, slot);
+                            BindSampler(eHWSC_Pixel, pSamplerState, slot);
                             break;
                         case eHWSC_Geometry:
-                            rd->m_DevMan.BindSampler(eHWSC_Geometry, pSamplerState, slot);
+                            BindSampler(eHWSC_Geometry, pSamplerState, slot);
                             break;
                         case eHWSC_Domain:
-                            rd->m_DevMan.BindSampler(eHWSC_Domain, pSamplerState, slot);
+                            BindSampler(eHWSC_Domain, pSamplerState, slot);
                             break;
                         case eHWSC_Hull:
-                            rd->m_DevMan.BindSampler(eHWSC_Hull, pSamplerState, slot);
+                            BindSampler(eHWSC_Hull, pSamplerState, slot);
                             break;
                         default:
                             CRY_ASSERT(false);
@@ -748,19 +975,19 @@ void CDeviceGraphicsCommandList_DX11::SetResources_All(CDeviceResourceSet_DX11*
                     switch (shaderClass)
                     {
                     case eHWSC_Vertex:
-                        rd->m_DevMan.BindConstantBuffer(eHWSC_Vertex, cb.m_constantBuffer, cb.m_shaderSlot);
+                        BindConstantBuffer(eHWSC_Vertex, cb.m_constantBuffer, cb.m_shaderSlot);
                         break;
                     case eHWSC_Pixel:
-                        rd->m_DevMan.BindConstantBuffer(eHWSC_Pixel, cb.m_constantBuffer, cb.m_shaderSlot);
+                        BindConstantBuffer(eHWSC_Pixel, cb.m_constantBuffer, cb.m_shaderSlot);
                         break;
                     case eHWSC_Geometry:
-                        rd->m_DevMan.BindConstantBuffer(eHWSC_Geometry, cb.m_constantBuffer, cb.m_shaderSlot);
+                        BindConstantBuffer(eHWSC_Geometry, cb.m_constantBuffer, cb.m_shaderSlot);
                         break;
                     case eHWSC_Domain:
-                        rd->m_DevMan.BindConstantBuffer(eHWSC_Domain, cb.m_constantBuffer, cb.m_shaderSlot);
+                        BindConstantBuffer(eHWSC_Domain, cb.m_constantBuffer, cb.m_shaderSlot);
                         break;
                     case eHWSC_Hull:
-                        rd->m_DevMan.BindConstantBuffer(eHWSC_Hull, cb.m_constantBuffer, cb.m_shaderSlot);
+                        BindConstantBuffer(eHWSC_Hull, cb.m_constantBuffer, cb.m_shaderSlot);
                         break;
                     default:
                         CRY_ASSERT(false);
@@ -791,19 +1018,19 @@ void CDeviceGraphicsCommandList::SetInlineConstantBuffer(uint32 bindSlot, AzRHI:
         switch (shaderClass)
         {
         case eHWSC_Vertex:
-            gcpRendD3D->m_DevMan.BindConstantBuffer(eHWSC_Vertex, pBuffer, shaderSlot);
+            pCmdList->BindConstantBuffer(eHWSC_Vertex, pBuffer, shaderSlot);
             break;
         case eHWSC_Pixel:
-            gcpRendD3D->m_DevMan.BindConstantBuffer(eHWSC_Pixel, pBuffer, shaderSlot);
+            pCmdList->BindConstantBuffer(eHWSC_Pixel, pBuffer, shaderSlot);
             break;
         case eHWSC_Geometry:
-            gcpRendD3D->m_DevMan.BindConstantBuffer(eHWSC_Geometry, pBuffer, shaderSlot);
+            pCmdList->BindConstantBuffer(eHWSC_Geometry, pBuffer, shaderSlot);
             break;
         case eHWSC_Domain:
-            gcpRendD3D->m_DevMan.BindConstantBuffer(eHWSC_Domain, pBuffer, shaderSlot);
+            pCmdList->BindConstantBuffer(eHWSC_Domain, pBuffer, shaderSlot);
             break;
         case eHWSC_Hull:
-            gcpRendD3D->m_DevMan.BindConstantBuffer(eHWSC_Hull, pBuffer, shaderSlot);
+            pCmdList->BindConstantBuffer(eHWSC_Hull, pBuffer, shaderSlot);
             break;
         }
     }
@@ -811,14 +1038,13 @@ void CDeviceGraphicsCommandList::SetInlineConstantBuffer(uint32 bindSlot, AzRHI:
 
 void CDeviceGraphicsCommandList::SetVertexBuffers(uint32 bufferCount, D3DBuffer** pBuffers, size_t* offsets, uint32* strides)
 {
-    CD3D9Renderer* const __restrict rd = gcpRendD3D;
     auto pCmdList = GET_DX11_COMMANDLIST(this);
 
     for (uint32 slot = 0; slot < bufferCount; ++slot)
     {
         if (pCmdList->m_CurrentVertexStream[slot].Set(SStreamInfo(pBuffers[slot], offsets[slot], strides[slot])))
         {
-            rd->m_DevMan.BindVB(pBuffers[slot], slot, offsets[slot], strides[slot]);
+            pCmdList->BindVB(pBuffers[slot], slot, offsets[slot], strides[slot]);
         }
     }
 }
@@ -832,7 +1058,7 @@ void CDeviceGraphicsCommandList::SetVertexBuffers(uint32 streamCount, const SStr
         if (streams[slot].pStream && pCmdList->m_CurrentVertexStream[slot].Set(streams[slot]))
         {
             D3DBuffer* pBuffer = const_cast<D3DBuffer*>(reinterpret_cast<const D3DBuffer*>(streams[slot].pStream));
-            gcpRendD3D->m_DevMan.BindVB(pBuffer, slot, streams[slot].nOffset, streams[slot].nStride);
+            pCmdList->BindVB(pBuffer, slot, streams[slot].nOffset, streams[slot].nStride);
         }
     }
 }
@@ -846,9 +1072,9 @@ void CDeviceGraphicsCommandList::SetIndexBuffer(const SStreamInfo& indexStream)
         D3DBuffer* pIB = const_cast<D3DBuffer*>(reinterpret_cast<const D3DBuffer*>(indexStream.pStream));
 
 #if !defined(SUPPORT_FLEXIBLE_INDEXBUFFER)
-        gcpRendD3D->m_DevMan.BindIB(pIB, indexStream.nOffset, DXGI_FORMAT_R16_UINT);
+        pCmdList->BindIB(pIB, indexStream.nOffset, DXGI_FORMAT_R16_UINT);
 #else
-        gcpRendD3D->m_DevMan.BindIB(pIB, indexStream.nOffset, (DXGI_FORMAT)indexStream.nStride);
+        pCmdList->BindIB(pIB, indexStream.nOffset, (DXGI_FORMAT)indexStream.nStride);
 #endif
     }
 }
@@ -868,14 +1094,25 @@ void CDeviceGraphicsCommandList::SetStencilRefImpl(uint8_t stencilRefValue)
         pDS = reinterpret_cast<CDeviceGraphicsPSO_DX11*>(m_pCurrentPipelineState)->pDepthStencilState;
     }
 
-    gcpRendD3D->m_DevMan.SetDepthStencilState(pDS, stencilRefValue);
+    pCmdList->SetDepthStencilState(pDS, stencilRefValue);
 }
 
 void CDeviceGraphicsCommandList::DrawImpl(uint32 VertexCountPerInstance, uint32 InstanceCount, uint32 StartVertexLocation, uint32 StartInstanceLocation)
 {
     CD3D9Renderer* const __restrict rd = gcpRendD3D;
 
-    if (InstanceCount > 1)
+    if (ID3D11DeviceContext* pDeferredContext = GET_DX11_COMMANDLIST(this)->m_pDeferredContext)
+    {
+        if (InstanceCount > 1)
+        {
+            pDeferredContext->DrawInstanced(VertexCountPerInstance, InstanceCount, StartVertexLocation, StartInstanceLocation);
+        }
+        else
+        {
+            pDeferredContext->Draw(VertexCountPerInstance, StartVertexLocation);
+        }
+    }
+    else if (InstanceCount > 1)
     {
         rd->m_DevMan.DrawInstanced(VertexCountPerInstance, InstanceCount, StartVertexLocation, StartInstanceLocation);
     }
@@ -893,7 +1130,18 @@ void CDeviceGraphicsCommandList::DrawIndexedImpl(uint32 IndexCountPerInstance, u
     STATIC_CHECK(false, "NOT IMPLEMENTED");
 #endif
 
-    if (InstanceCount > 1)
+    if (ID3D11DeviceContext* pDeferredContext = GET_DX11_COMMANDLIST(this)->m_pDeferredContext)
+    {
+        if (InstanceCount > 1)
+        {
+            pDeferredContext->DrawIndexedInstanced(IndexCountPerInstance, InstanceCount, StartIndexLocation, BaseVertexLocation, StartInstanceLocation);
+        }
+        else
+        {
+            pDeferredContext->DrawIndexed(IndexCountPerInstance, StartIndexLocation, BaseVertexLocation);
+        }
+    }
+    else if (InstanceCount > 1)
     {
         rd->m_DevMan.DrawIndexedInstanced(IndexCountPerInstance, InstanceCount, StartIndexLocation, BaseVertexLocation, StartInstanceLocation);
     }
@@ -905,18 +1153,38 @@ void CDeviceGraphicsCommandList::DrawIndexedImpl(uint32 IndexCountPerInstance, u
 
 void CDeviceGraphicsCommandList::ClearSurface(D3DSurface* pView, const FLOAT Color[4], UINT NumRects, const D3D11_RECT* pRect)
 {
+    if (ID3D11DeviceContext* pDeferredContext = GET_DX11_COMMANDLIST(this)->m_pDeferredContext)
+    {
+        CRY_ASSERT(NumRects == 0); // partial clears go through FX_ClearTarget, which needs the render thread
+        pDeferredContext->ClearRenderTargetView(pView, Color);
+        return;
+    }
+
     CD3D9Renderer* const __restrict rd = gcpRendD3D;
     rd->FX_ClearTarget(pView, ColorF(Color[0], Color[1], Color[2], Color[3]), NumRects, pRect);
 }
 
 void CDeviceGraphicsCommandList::LockToThread()
 {
-    // ...
+    // A deferred context has no thread affinity, it only must not be used by two threads at the same time
 }
 
 void CDeviceGraphicsCommandList::Build()
 {
-    // pContext->FinishCommandList(false, ID3D11CommandList)
+    auto pCmdList = GET_DX11_COMMANDLIST(this);
+
+    if (pCmdList->m_pDeferredContext && !pCmdList->m_pRecordedCommandList)
+    {
+        ID3D11CommandList* pRecordedCommandList = nullptr;
+        if (SUCCEEDED(pCmdList->m_pDeferredContext->FinishCommandList(FALSE, &pRecordedCommandList)))
+        {
+            pCmdList->m_pRecordedCommandList = pRecordedCommandList;
+            pRecordedCommandList->Release();
+        }
+
+        // Finishing the list clears the deferred context state
+        Reset();
+    }
 }
 
 void CDeviceGraphicsCommandList::ResetImpl()
@@ -1015,39 +1283,178 @@ CDeviceGraphicsCommandListPtr CDeviceObjectFactory::GetCoreGraphicsCommandList()
     return m_pCoreCommandList;
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Deferred contexts of the acquired command-lists, and the order their recordings are executed on the immediate context
+class CDeviceCommandListQueue_DX11
+{
+public:
+    CDeviceCommandListQueue_DX11()
+        : m_NextAcquireIndex(0)
+        , m_NextSubmitIndex(0)
+        , m_DeferredContextSupport(eDCS_Unknown)
+    {
+    }
+
+    static CDeviceCommandListQueue_DX11& GetInstance()
+    {
+        static CDeviceCommandListQueue_DX11 queue;
+        return queue;
+    }
+
+    bool SupportsDeferredContexts()
+    {
+        if (m_DeferredContextSupport == eDCS_Unknown)
+        {
+            _smart_ptr<ID3D11DeviceContext> pContext = CreateDeferredContext();
+            if (pContext)
+            {
+                m_FreeContexts.push_back(pContext);
+            }
+        }
+
+        return m_DeferredContextSupport == eDCS_Supported;
+    }
+
+    CDeviceGraphicsCommandListUPtr Acquire()
+    {
+        _smart_ptr<ID3D11DeviceContext> pContext;
+
+        if (SupportsDeferredContexts())
+        {
+            if (m_FreeContexts.empty())
+            {
+                pContext = CreateDeferredContext();
+            }
+            else
+            {
+                pContext = m_FreeContexts.back();
+                m_FreeContexts.pop_back();
+            }
+        }
+
+        // Without a deferred context the list records through the device manager, straight onto the immediate context
+        return CryMakeUnique<CDeviceGraphicsCommandList_DX11>(pContext, m_NextAcquireIndex++);
+    }
+
+    void Forfeit(CDeviceGraphicsCommandListUPtr pCommandList)
+    {
+        // Lists can be forfeited in any order, but they are executed in the order they were acquired
+        auto pCmdList = GET_DX11_COMMANDLIST(pCommandList.get());
+        pCmdList->Build();
+
+        m_PendingLists.push_back(std::move(pCommandList));
+
+        for (bool bSubmitted = true; bSubmitted; )
+        {
+            bSubmitted = false;
+
+            for (size_t i = 0; i < m_PendingLists.size(); ++i)
+            {
+                auto pPending = GET_DX11_COMMANDLIST(m_PendingLists[i].get());
+                if (pPending->m_SubmitIndex == m_NextSubmitIndex)
+                {
+                    Submit(pPending);
+
+                    m_PendingLists[i] = std::move(m_PendingLists.back());
+                    m_PendingLists.pop_back();
+                    ++m_NextSubmitIndex;
+                    bSubmitted = true;
+                    break;
+                }
+            }
+        }
+    }
+
+private:
+    enum EDeferredContextSupport
+    {
+        eDCS_Unknown,
+        eDCS_Supported,
+        eDCS_Unsupported
+    };
+
+    _smart_ptr<ID3D11DeviceContext> CreateDeferredContext()
+    {
+        _smart_ptr<ID3D11DeviceContext> pResult;
+
+#if !defined(DEVICE_SUPPORTS_D3D11_1)
+        // With D3D11.1 constant buffers are sub-allocated and bound at an offset, which the deferred path doesn't do.
+        // DXGL and DXMETAL don't implement deferred contexts and fail here.
+        ID3D11DeviceContext* pContext = nullptr;
+        if (SUCCEEDED(gcpRendD3D->GetDevice().CreateDeferredContext(0, &pContext)) && pContext)
+        {
+            pResult = pContext;
+            pContext->Release();
+        }
+#endif
+
+        if (m_DeferredContextSupport == eDCS_Unknown)
+        {
+            m_DeferredContextSupport = pResult ? eDCS_Supported : eDCS_Unsupported;
+        }
+
+        return pResult;
+    }
+
+    void Submit(CDeviceGraphicsCommandList_DX11* pCmdList)
+    {
+        if (pCmdList->m_pRecordedCommandList)
+        {
+            // Restore the immediate context state, the device manager's state cache still describes it
+            gcpRendD3D->GetDeviceContext().ExecuteCommandList(pCmdList->m_pRecordedCommandList, TRUE);
+            pCmdList->m_pRecordedCommandList = nullptr;
+        }
+
+        if (pCmdList->m_pDeferredContext)
+        {
+            m_FreeContexts.push_back(pCmdList->m_pDeferredContext);
+            pCmdList->m_pDeferredContext = nullptr;
+        }
+    }
+
+    std::vector<_smart_ptr<ID3D11DeviceContext>> m_FreeContexts;
+    std::vector<CDeviceGraphicsCommandListUPtr>  m_PendingLists;
+    uint32                                       m_NextAcquireIndex;
+    uint32                                       m_NextSubmitIndex;
+    EDeferredContextSupport                      m_DeferredContextSupport;
+};
+
+bool CDeviceObjectFactory::SupportsParallelCommandListRecording()
+{
+    return CDeviceCommandListQueue_DX11::GetInstance().SupportsDeferredContexts();
+}
+
 // Acquire one or more command-lists which are independent of the core command-list
-// Only one thread is allowed to call functions on this command-list (DX12 restriction).
-// The thread that gets the permition is the one calling Begin() on it AFAIS
+// Each list records into its own deferred context, so different threads can record different lists at the same time.
 CDeviceGraphicsCommandListUPtr CDeviceObjectFactory::AcquireGraphicsCommandList()
 {
-    // TODO: implement deferred contexts
-    __debugbreak();
-
-    return CryMakeUnique<CDeviceGraphicsCommandList>();
+    return CDeviceCommandListQueue_DX11::GetInstance().Acquire();
 }
 
 std::vector<CDeviceGraphicsCommandListUPtr> CDeviceObjectFactory::AcquireGraphicsCommandLists(uint32 listCount)
 {
-    // TODO: implement deferred contexts
-    __debugbreak();
+    std::vector<CDeviceGraphicsCommandListUPtr> pCommandLists;
+    pCommandLists.reserve(listCount);
+
+    for (uint32 i = 0; i < listCount; ++i)
+    {
+        pCommandLists.emplace_back(CDeviceCommandListQueue_DX11::GetInstance().Acquire());
+    }
 
-    return (std::vector<CDeviceGraphicsCommandListUPtr>(size_t(listCount)));
+    return pCommandLists;
 }
 
 void CDeviceObjectFactory::ForfeitGraphicsCommandList(CDeviceGraphicsCommandListUPtr pCommandList)
 {
-    // TODO: implement deferred contexts
-    __debugbreak();
-
-    // pContext->ExecuteCommandList(ID3D11CommandList)
+    CDeviceCommandListQueue_DX11::GetInstance().Forfeit(std::move(pCommandList));
 }
 
 void CDeviceObjectFactory::ForfeitGraphicsCommandLists(std::vector<CDeviceGraphicsCommandListUPtr> pCommandLists)
 {
-    // TODO: implement deferred contexts
-    __debugbreak();
-
-    // pContext->ExecuteCommandList(ID3D11CommandList)
+    for (auto& pCommandList : pCommandLists)
+    {
+        CDeviceCommandListQueue_DX11::GetInstance().Forfeit(std::move(pCommandList));
+    }
 }
 
 #undef DEVICEWRAPPER12_D3D11_CPP_WRAP_DX11
@@ -1016,6 +1016,11 @@ CDeviceGraphicsCommandListPtr CDeviceObjectFactory::GetCoreGraphicsCommandList()
     return m_pCoreCommandList;
 }
 
+bool CDeviceObjectFactory::SupportsParallelCommandListRecording()
+{
+    return true;
+}
+
 // Acquire one or more command-lists which are independent of the core command-list
 // Only one thread is allowed to call functions on this command-list (DX12 restriction).
 // The thread that gets the permition is the one calling Begin() on it AFAIS
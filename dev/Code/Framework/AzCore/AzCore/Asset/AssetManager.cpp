@@ -16,6 +16,7 @@
 #include <AzCore/Asset/LegacyAssetHandler.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/thread.h>
@@ -165,6 +166,36 @@ namespace AZ
             AssetFilterCB                   m_assetLoadFilterCB;            
         };
 
+        /*
+         * This class loads a dependency of a loading asset, ahead of the asset requesting it
+         */
+        class PrefetchAssetJob
+            : public AssetDatabaseAsyncJob
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(PrefetchAssetJob, ThreadPoolAllocator, 0);
+
+            PrefetchAssetJob(JobContext* jobContext, AssetManager* owner, const Asset<AssetData>& asset, const AssetFilterCB& assetLoadFilterCB)
+                : AssetDatabaseAsyncJob(jobContext, false, owner, asset, nullptr)
+                , m_assetLoadFilterCB(assetLoadFilterCB)
+            {
+            }
+
+            void Process() override
+            {
+                // The load is claimed when the job runs, not when it's queued. A blocking request for an asset that is
+                // still queued here loads it on the requesting thread, rather than waiting for a worker to pick this job up.
+                if (m_asset.GetStatus() == AssetData::AssetStatus::NotLoaded)
+                {
+                    m_owner->GetAsset(m_asset.GetId(), m_asset.GetType(), true, m_assetLoadFilterCB, true);
+                }
+
+                delete this;
+            }
+
+            AssetFilterCB                   m_assetLoadFilterCB;
+        };
+
         /**
          * Base class to handle blocking on an asset load. Takes care connecting to the AssetJobBus
          * and clean up of the object.
@@ -469,6 +500,7 @@ namespace AZ
             {
                 delete &*m_activeJobs.begin();
             }
+            m_prefetchedDependencies.clear();
             while (!m_handlers.empty())
             {
                 AssetHandlerMap::iterator it = m_handlers.begin();
@@ -508,6 +540,17 @@ namespace AZ
 #endif
         }
 
+        //=========================================================================
+        void AssetManager::SetDependencyPrefetchEnabled(bool enable)
+        {
+            m_dependencyPrefetchEnabled = enable;
+        }
+
+        bool AssetManager::GetDependencyPrefetchEnabled() const
+        {
+            return m_dependencyPrefetchEnabled;
+        }
+
         //=========================================================================
         // RegisterHandler
         // [7/9/2014]
@@ -763,6 +806,15 @@ namespace AZ
                                     asset.ToString<AZStd::string>().c_str());
                                 loadBlocking = false;
                             }
+                            else if (IsWaitCycle(assetInfo.m_assetId, threadId))
+                            {
+                                // the asset is loading on another thread, which (indirectly) waits for an asset this thread is loading
+                                AZ_Error("AssetManager", false,
+                                    "Trying to load %s blocking but its loading thread is waiting on an asset loading on this thread.\n"
+                                    "This means an asset has a cyclic dependency in it!",
+                                    asset.ToString<AZStd::string>().c_str());
+                                loadBlocking = false;
+                            }
                             else
                             {
                                 if (m_blockingAssetTypeManager->HasBlockingHandlersForCurrentThread())
@@ -773,6 +825,7 @@ namespace AZ
                                 {
                                     blockingWait = aznew WaitForAssetOnThreadWithNoBlockingJobs(assetData);
                                 }
+                                m_assetsWaitedOnByThread.push_back(AZStd::make_pair(threadId, assetInfo.m_assetId));
                             }
                     }
                 }
@@ -797,6 +850,15 @@ namespace AZ
                 {
                     blockingWait->WaitAndDestroy();
                     blockingWait = nullptr;
+
+                    AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+                    AZStd::thread::id threadId = AZStd::this_thread::get_id();
+                    auto waitIt = AZStd::find_if(m_assetsWaitedOnByThread.begin(), m_assetsWaitedOnByThread.end(),
+                        [threadId](const AZStd::pair<AZStd::thread::id, AssetId>& wait) { return wait.first == threadId; });
+                    if (waitIt != m_assetsWaitedOnByThread.end())
+                    {
+                        m_assetsWaitedOnByThread.erase(waitIt);
+                    }
                 }
             }
             else
@@ -805,6 +867,11 @@ namespace AZ
                 {
                     // Otherwise, queue job through the job system.
                     loadJob->Start();
+
+                    if (m_dependencyPrefetchEnabled)
+                    {
+                        PrefetchDependencies(asset, assetLoadFilterCB);
+                    }
                 }
             }
 
@@ -1137,6 +1204,125 @@ namespace AZ
             m_activeJobs.push_back(*job);
         }
 
+        //=========================================================================
+        // PrefetchDependencies
+        //=========================================================================
+        void AssetManager::PrefetchDependencies(const Asset<AssetData>& asset, const AssetFilterCB& assetLoadFilterCB)
+        {
+            AZ::Outcome<AZStd::vector<ProductDependency>, AZStd::string> dependencies = AZ::Failure<AZStd::string>("No catalog");
+            EBUS_EVENT_RESULT(dependencies, AssetCatalogRequestBus, GetAllProductDependencies, asset.GetId());
+            if (!dependencies.IsSuccess() || dependencies.GetValue().empty())
+            {
+                return;
+            }
+
+            AZStd::vector<Asset<AssetData> > prefetched;
+            prefetched.reserve(dependencies.GetValue().size());
+            for (const ProductDependency& dependency : dependencies.GetValue())
+            {
+                if (dependency.m_assetId == asset.GetId())
+                {
+                    continue;
+                }
+
+                // product dependencies include legacy assets, which aren't loaded through the asset manager
+                AssetInfo dependencyInfo;
+                EBUS_EVENT_RESULT(dependencyInfo, AssetCatalogRequestBus, GetAssetInfoById, dependency.m_assetId);
+                if (!dependencyInfo.m_assetId.IsValid() || m_handlers.find(dependencyInfo.m_assetType) == m_handlers.end())
+                {
+                    continue;
+                }
+
+                // creates the entry without loading it, so the filter can see it and later requests find it
+                Asset<AssetData> dependencyAsset = GetAsset(dependencyInfo.m_assetId, dependencyInfo.m_assetType, false);
+                AssetData* dependencyData = dependencyAsset.Get();
+
+                // an asset that isn't shared would be created again by the asset that requests it
+                if (!dependencyData || !dependencyData->IsRegisterReadonlyAndShareable() || dependencyData->GetStatus() != AssetData::AssetStatus::NotLoaded)
+                {
+                    continue;
+                }
+                if (assetLoadFilterCB && !assetLoadFilterCB(dependencyAsset))
+                {
+                    continue;
+                }
+
+                prefetched.push_back(dependencyAsset);
+            }
+
+            if (prefetched.empty())
+            {
+                return;
+            }
+
+            {
+                AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+
+                // ReleasePrefetchedDependencies runs once the status is set, so it would miss dependencies added after that
+                if (asset.Get()->IsReady() || asset.Get()->IsError())
+                {
+                    return;
+                }
+                m_prefetchedDependencies[asset.GetId()] = prefetched;
+            }
+
+            // the catalog lists the dependencies breadth first, so the closest ones are queued first
+            for (const Asset<AssetData>& dependencyAsset : prefetched)
+            {
+                PrefetchAssetJob* prefetchJob = aznew PrefetchAssetJob(m_jobContext, this, dependencyAsset, assetLoadFilterCB);
+                prefetchJob->Start();
+            }
+        }
+
+        //=========================================================================
+        // ReleasePrefetchedDependencies
+        //=========================================================================
+        void AssetManager::ReleasePrefetchedDependencies(const AssetId& assetId)
+        {
+            AZStd::vector<Asset<AssetData> > prefetched;
+            {
+                AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
+                PrefetchMap::iterator it = m_prefetchedDependencies.find(assetId);
+                if (it == m_prefetchedDependencies.end())
+                {
+                    return;
+                }
+                prefetched.swap(it->second);
+                m_prefetchedDependencies.erase(it);
+            }
+            // released outside of the lock, as releasing the last reference destroys the asset
+        }
+
+        //=========================================================================
+        // IsWaitCycle
+        //=========================================================================
+        bool AssetManager::IsWaitCycle(AssetId assetId, AZStd::thread::id threadId) const
+        {
+            // follow the thread loading the asset to the asset that thread waits on, until it leads back to this thread
+            for (size_t i = 0; i <= m_assetsWaitedOnByThread.size(); ++i)
+            {
+                auto loadingIt = m_assetsLoadingByThread.find(assetId);
+                if (loadingIt == m_assetsLoadingByThread.end())
+                {
+                    return false;
+                }
+                if (loadingIt->second == threadId)
+                {
+                    return true;
+                }
+
+                AZStd::thread::id loadingThreadId = loadingIt->second;
+                auto waitIt = AZStd::find_if(m_assetsWaitedOnByThread.begin(), m_assetsWaitedOnByThread.end(),
+                    [loadingThreadId](const AZStd::pair<AZStd::thread::id, AssetId>& wait) { return wait.first == loadingThreadId; });
+                if (waitIt == m_assetsWaitedOnByThread.end())
+                {
+                    return false;
+                }
+                assetId = waitIt->second;
+            }
+            return false;
+        }
+
         //=========================================================================
         // RegisterAssetLoading
         //=========================================================================
@@ -1221,6 +1407,8 @@ namespace AZ
             // Set status immediately from within the AssetManagerBus dispatch, so it's committed before anyone is notified (e.g. job to job, via AssetJobBus).
             asset.Get()->m_status = static_cast<int>(AssetData::AssetStatus::ReadyPreNotify);
 
+            ReleasePrefetchedDependencies(asset.GetId());
+
             // Queue broadcast message for delivery on game thread.
             AssetBus::QueueFunction(&AssetManager::NotifyAssetReady, this, Asset<AssetData>(asset));
         }
@@ -1233,6 +1421,8 @@ namespace AZ
             // Set status immediately from within the AssetManagerBus dispatch, so it's committed before anyone is notified (e.g. job to job, via AssetJobBus).
             asset.Get()->m_status = static_cast<int>(AssetData::AssetStatus::Error);
 
+            ReleasePrefetchedDependencies(asset.GetId());
+
             // Queue broadcast message for delivery on game thread.
             AssetBus::QueueFunction(&AssetManager::NotifyAssetError, this, Asset<AssetData>(asset));
         }
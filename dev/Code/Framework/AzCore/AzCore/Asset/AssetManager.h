@@ -239,6 +239,14 @@ namespace AZ
             void        SetAssetInfoUpgradingEnabled(bool enable);
             bool        GetAssetInfoUpgradingEnabled() const;
 
+            /**
+            * When an asset load is queued, the product dependencies the catalog has for it are queued as well, so they load
+            * in parallel instead of one level of the dependency tree at a time as the asset data is deserialized.
+            * The dependencies are held until the asset is ready. By default, it is enabled.
+            */
+            void        SetDependencyPrefetchEnabled(bool enable);
+            bool        GetDependencyPrefetchEnabled() const;
+
         protected:
             AssetManager(const Descriptor& desc);
             ~AssetManager();
@@ -253,6 +261,9 @@ namespace AZ
             void AddJob(AssetDatabaseJob* job);
             void RemoveJob(AssetDatabaseJob* job);
 
+            void PrefetchDependencies(const Asset<AssetData>& asset, const AssetFilterCB& assetLoadFilterCB);
+            void ReleasePrefetchedDependencies(const AssetId& assetId);
+
             //////////////////////////////////////////////////////////////////////////
             // AssetManagerBus
             void OnAssetReady(const Asset<AssetData>& asset) override;
@@ -281,6 +292,10 @@ namespace AZ
             ActiveJobList           m_activeJobs;
 
             bool m_assetInfoUpgradingEnabled = true;
+            bool m_dependencyPrefetchEnabled = true;
+
+            typedef AZStd::unordered_map<AssetId, AZStd::vector<Asset<AssetData> > > PrefetchMap;
+            PrefetchMap             m_prefetchedDependencies;   // dependencies queued ahead of a loading asset, held until it's ready (lock m_assetMutex)
             AssetInternal::LegacyBlockingAssetTypeManager* m_blockingAssetTypeManager = nullptr; // NOTE: not using unique_ptr because on some platforms, it won't compile unless LegacyBlockingAssetTypeManager is defined.
 
             static EnvironmentVariable<AssetManager*>  s_assetDB;
@@ -292,6 +307,9 @@ namespace AZ
             // to avoid recursive thread deadlocks, we keep track of which thread is loading which asset, and don't allow
             // a thread to wait for its own asset blocking.
             AZStd::unordered_map<AssetId, AZStd::thread::id> m_assetsLoadingByThread;
+            // the asset each thread is blocked on, to find cycles of threads waiting on each other's loads
+            AZStd::vector<AZStd::pair<AZStd::thread::id, AssetId> > m_assetsWaitedOnByThread;
+            bool IsWaitCycle(AssetId assetId, AZStd::thread::id threadId) const;
         };
 
         /**
@@ -400,6 +400,16 @@ namespace AZ
          */
         virtual void GetIncompatibleServices(DependencyArrayType& incompatible, const Component* instance) const    { (void)incompatible;  (void)instance; }
 
+        /**
+         * Specifies whether the component's Init and Activate functions can run on a job thread, at the same time
+         * as the Init and Activate functions of components on other entities.
+         * A component that returns true must not touch shared state from Init and Activate, which includes
+         * connecting to or sending events on buses that are not thread safe.
+         * Entity::InitEntities and Entity::ActivateEntities only process an entity on a job when all of its components return true.
+         * @return True if Init and Activate are thread safe. By default components are not.
+         */
+        virtual bool IsActivationThreadSafe() const { return false; }
+
         /**
          * Gets the current descriptor.
          * @param instance The current descriptor.
@@ -493,6 +503,7 @@ namespace AZ
     AZ_HAS_STATIC_MEMBER(ComponentDependentServices, GetDependentServices, void, (ComponentDescriptor::DependencyArrayType &));
     AZ_HAS_STATIC_MEMBER(ComponentRequiredServices, GetRequiredServices, void, (ComponentDescriptor::DependencyArrayType &));
     AZ_HAS_STATIC_MEMBER(ComponentIncompatibleServices, GetIncompatibleServices, void, (ComponentDescriptor::DependencyArrayType &));
+    AZ_HAS_STATIC_MEMBER(ComponentActivationThreadSafe, IsActivationThreadSafe, bool, ());
     /// @endcond
 
     /**
@@ -565,6 +576,15 @@ namespace AZ
             CallIncompatibleServices(incompatible, typename HasComponentIncompatibleServices<ComponentClass>::type());
         }
 
+        /**
+         * Calls the static function AZ::ComponentDescriptor::IsActivationThreadSafe, if the user provided it.
+         * @return True if the component's Init and Activate functions are thread safe.
+         */
+        bool IsActivationThreadSafe() const override
+        {
+            return CallActivationThreadSafe(typename HasComponentActivationThreadSafe<ComponentClass>::type());
+        }
+
     private:
 
         void CallReflect(ReflectContext* reflection, const AZStd::true_type&) const
@@ -611,5 +631,15 @@ namespace AZ
         void CallIncompatibleServices(ComponentDescriptor::DependencyArrayType&, const AZStd::false_type&) const
         {
         }
+
+        bool CallActivationThreadSafe(const AZStd::true_type&) const
+        {
+            return ComponentClass::IsActivationThreadSafe();
+        }
+
+        bool CallActivationThreadSafe(const AZStd::false_type&) const
+        {
+            return false;
+        }
     };
 }
\ No newline at end of file
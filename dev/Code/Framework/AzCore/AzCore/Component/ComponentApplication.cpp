@@ -19,6 +19,10 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/TickBus.h>
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Memory/AllocationRecords.h>
 
 #include <AzCore/Serialization/EditContext.h>
@@ -30,6 +34,7 @@
 
 #include <AzCore/Module/Module.h>
 #include <AzCore/Module/ModuleManager.h>
+#include <AzCore/Name/Name.h>
 
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
@@ -236,6 +241,9 @@ namespace AZ
 
         m_deltaTime = 0.f;
         m_exeDirectory[0] = '\0';
+
+        m_lastTickHandlerStatsIndex = 0;
+        m_isTickHandlerStatsEnabled = false;
     }
 
     //=========================================================================
@@ -467,10 +475,10 @@ namespace AZ
 
         // deactivate all entities
         Entity* systemEntity = nullptr;
-        while (!m_entities.empty())
+        while (!m_entities.Empty())
         {
-            Entity* entity = m_entities.begin()->second;
-            m_entities.erase(m_entities.begin());
+            Entity* entity = m_entities.GetEntities().back();
+            m_entities.Remove(entity->GetId());
 
             if (entity->GetId() == SystemEntityId)
             {
@@ -500,8 +508,7 @@ namespace AZ
             }
         }
 
-        m_entities.clear();
-        m_entities.rehash(0); // force free all memory
+        m_entities.Clear(); // force free all memory
 
         DestroyReflectionManager();
 
@@ -675,7 +682,7 @@ namespace AZ
             return false;
         }
 
-        return m_entities.insert(AZStd::make_pair(entity->GetId(), entity)).second;
+        return m_entities.Insert(entity);
     }
 
     //=========================================================================
@@ -690,7 +697,7 @@ namespace AZ
             return false;
         }
 
-        return (m_entities.erase(entity->GetId()) == 1);
+        return m_entities.Remove(entity->GetId());
     }
 
     //=========================================================================
@@ -714,12 +721,7 @@ namespace AZ
     //=========================================================================
     Entity* ComponentApplication::FindEntity(const EntityId& id)
     {
-        EntitySetType::const_iterator it = m_entities.find(id);
-        if (it != m_entities.end())
-        {
-            return it->second;
-        }
-        return nullptr;
+        return m_entities.Find(id);
     }
 
     //=========================================================================
@@ -741,9 +743,9 @@ namespace AZ
     //=========================================================================
     void ComponentApplication::EnumerateEntities(const ComponentApplicationRequests::EntityCallback& callback)
     {
-        for (const auto& entityIter : m_entities)
+        for (Entity* entity : m_entities.GetEntities())
         {
-            callback(entityIter.second);
+            callback(entity);
         }
     }
 
@@ -823,7 +825,7 @@ namespace AZ
             m_currentTime = now;
             {
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "ComponentApplication::Tick:OnTick");
-                EBUS_EVENT(TickBus, OnTick, m_deltaTime, ScriptTimePoint(now));
+                TickHandlers(m_deltaTime, ScriptTimePoint(now));
             }
         }
         if (m_drillerManager)
@@ -832,6 +834,165 @@ namespace AZ
         }
     }
 
+    //=========================================================================
+    // TickHandlers
+    //=========================================================================
+    void ComponentApplication::TickHandlers(float deltaTime, ScriptTimePoint time)
+    {
+        JobContext* jobContext = JobContext::GetGlobalContext();
+        const bool useJobs = jobContext && jobContext->GetJobManager().GetNumWorkerThreads() > 1;
+
+        for (TickHandlerTypeStats& stats : m_tickHandlerStats)
+        {
+            stats.m_handlerCount = 0;
+            stats.m_lastTickTime = AZStd::chrono::microseconds(0);
+        }
+
+        // Handlers are sorted by tick order and type. Thread safe handlers are only collected while enumerating,
+        // so no handler can disconnect before the batch is flushed, and the batch is flushed before the tick order
+        // changes or a handler that is not thread safe runs.
+        int jobTickOrder = 0;
+        TickBus::EnumerateHandlers([this, useJobs, deltaTime, &time, &jobTickOrder](TickEvents* handler)
+        {
+            if (useJobs && handler->IsTickThreadSafe())
+            {
+                const int tickOrder = handler->GetTickOrder();
+                if (!m_tickJobHandlers.empty() && tickOrder != jobTickOrder)
+                {
+                    TickJobHandlers(deltaTime, time);
+                }
+                jobTickOrder = tickOrder;
+                m_tickJobHandlers.push_back(handler);
+                return true;
+            }
+
+            if (!m_tickJobHandlers.empty())
+            {
+                TickJobHandlers(deltaTime, time);
+            }
+
+            if (m_isTickHandlerStatsEnabled)
+            {
+                const AZStd::chrono::system_clock::time_point start = AZStd::chrono::system_clock::now();
+                handler->OnTick(deltaTime, time);
+                AddTickHandlerTime(*handler, AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::system_clock::now() - start));
+            }
+            else
+            {
+                handler->OnTick(deltaTime, time);
+            }
+            return true;
+        });
+
+        if (!m_tickJobHandlers.empty())
+        {
+            TickJobHandlers(deltaTime, time);
+        }
+
+        for (TickHandlerTypeStats& stats : m_tickHandlerStats)
+        {
+            stats.m_tickCount += stats.m_handlerCount > 0 ? 1 : 0;
+            stats.m_totalTickTime += stats.m_lastTickTime;
+        }
+    }
+
+    //=========================================================================
+    // TickJobHandlers
+    //=========================================================================
+    void ComponentApplication::TickJobHandlers(float deltaTime, const ScriptTimePoint& time)
+    {
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "ComponentApplication::TickJobHandlers");
+
+        const size_t minHandlersPerJob = 4;
+        JobContext* jobContext = JobContext::GetGlobalContext();
+        const size_t jobCount = AZStd::min<size_t>(jobContext->GetJobManager().GetNumWorkerThreads(), m_tickJobHandlers.size() / minHandlersPerJob);
+        const bool collectStats = m_isTickHandlerStatsEnabled;
+        if (collectStats)
+        {
+            m_tickJobHandlerTimes.resize(m_tickJobHandlers.size());
+        }
+
+        auto tickHandler = [this, collectStats, deltaTime, &time](size_t index)
+        {
+            if (collectStats)
+            {
+                const AZStd::chrono::system_clock::time_point start = AZStd::chrono::system_clock::now();
+                m_tickJobHandlers[index]->OnTick(deltaTime, time);
+                m_tickJobHandlerTimes[index] = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::system_clock::now() - start);
+            }
+            else
+            {
+                m_tickJobHandlers[index]->OnTick(deltaTime, time);
+            }
+        };
+
+        if (jobCount <= 1)
+        {
+            for (size_t index = 0; index < m_tickJobHandlers.size(); ++index)
+            {
+                tickHandler(index);
+            }
+        }
+        else
+        {
+            AZStd::atomic<size_t> nextHandler(0);
+            JobCompletion jobCompletion;
+            for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+            {
+                Job* job = CreateJobFunction([this, &nextHandler, &tickHandler]()
+                {
+                    AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "ComponentApplication::TickJobHandlers::Job");
+                    for (size_t index = nextHandler.fetch_add(1); index < m_tickJobHandlers.size(); index = nextHandler.fetch_add(1))
+                    {
+                        tickHandler(index);
+                    }
+                }, true, jobContext);
+
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
+        if (collectStats)
+        {
+            for (size_t index = 0; index < m_tickJobHandlers.size(); ++index)
+            {
+                AddTickHandlerTime(*m_tickJobHandlers[index], m_tickJobHandlerTimes[index]);
+            }
+        }
+
+        m_tickJobHandlers.clear();
+    }
+
+    //=========================================================================
+    // AddTickHandlerTime
+    //=========================================================================
+    void ComponentApplication::AddTickHandlerTime(TickEvents& handler, AZStd::chrono::microseconds tickTime)
+    {
+        const Uuid typeId = handler.RTTI_GetType();
+        if (m_lastTickHandlerStatsIndex >= m_tickHandlerStats.size() || m_tickHandlerStats[m_lastTickHandlerStatsIndex].m_typeId != typeId)
+        {
+            auto statsIt = AZStd::find_if(m_tickHandlerStats.begin(), m_tickHandlerStats.end(), [&typeId](const TickHandlerTypeStats& stats)
+            {
+                return stats.m_typeId == typeId;
+            });
+            if (statsIt == m_tickHandlerStats.end())
+            {
+                TickHandlerTypeStats stats;
+                stats.m_typeId = typeId;
+                stats.m_typeName = handler.RTTI_GetTypeName();
+                statsIt = m_tickHandlerStats.insert(m_tickHandlerStats.end(), stats);
+            }
+            m_lastTickHandlerStatsIndex = AZStd::distance(m_tickHandlerStats.begin(), statsIt);
+        }
+
+        TickHandlerTypeStats& stats = m_tickHandlerStats[m_lastTickHandlerStatsIndex];
+        ++stats.m_handlerCount;
+        stats.m_lastTickTime += tickTime;
+    }
+
     //=========================================================================
     // Tick
     //=========================================================================
@@ -1176,6 +1337,35 @@ namespace AZ
         return ScriptTimePoint(m_currentTime);
     }
 
+    //=========================================================================
+    // SetTickHandlerStatsEnabled
+    //=========================================================================
+    void ComponentApplication::SetTickHandlerStatsEnabled(bool enabled)
+    {
+        m_isTickHandlerStatsEnabled = enabled;
+        if (enabled)
+        {
+            m_tickHandlerStats.clear();
+            m_lastTickHandlerStatsIndex = 0;
+        }
+    }
+
+    //=========================================================================
+    // IsTickHandlerStatsEnabled
+    //=========================================================================
+    bool ComponentApplication::IsTickHandlerStatsEnabled()
+    {
+        return m_isTickHandlerStatsEnabled;
+    }
+
+    //=========================================================================
+    // GetTickHandlerStats
+    //=========================================================================
+    void ComponentApplication::GetTickHandlerStats(AZStd::vector<TickHandlerTypeStats>& stats)
+    {
+        stats = m_tickHandlerStats;
+    }
+
     //=========================================================================
     // Reflect
     //=========================================================================
@@ -1220,6 +1410,8 @@ namespace AZ
         SplineReflect(context);
         // reflect polygon prism
         PolygonPrismReflect(context);
+        // reflect interned names
+        Name::Reflect(context);
     }
 
 } // namespace AZ
@@ -15,6 +15,7 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Component/EntityLookupTable.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Debug/ProfileModuleInit.h>
 #include <AzCore/Memory/AllocationRecords.h>
@@ -55,8 +56,7 @@ namespace AZ
         : public ComponentApplicationBus::Handler
         , public TickRequestBus::Handler
     {
-        // or try to use unordered set if we store the ID internally
-        typedef AZStd::unordered_map<EntityId, Entity*>  EntitySetType;
+        typedef EntityLookupTable  EntitySetType;
 
     public:
         AZ_RTTI(ComponentApplication, "{1F3B070F-89F7-4C3D-B5A3-8832D5BC81D7}");
@@ -109,7 +109,7 @@ namespace AZ
             AZ::u64         m_stackRecordLevels;        ///< If stack recording is enabled, how many stack levels to record. (default: 5)
             bool            m_enableDrilling;           ///< True to enabled drilling support for the application. RegisterDrillers will be called. Ignored in release. (default: true)
 
-            ModuleDescriptorList m_modules;             ///< Dynamic modules used by the application.
+            ModuleDescriptorList m_modules;             ///< Dynamic modules used by the application, on demand ones are loaded when one of their types is first needed.
                                                         ///< These will be loaded on startup.
 
             ///////////////////////////////////////////////
@@ -198,6 +198,9 @@ namespace AZ
         /// TickRequestBus
         float GetTickDeltaTime() override;
         ScriptTimePoint GetTimeAtCurrentTick() override;
+        void SetTickHandlerStatsEnabled(bool enabled) override;
+        bool IsTickHandlerStatsEnabled() override;
+        void GetTickHandlerStats(AZStd::vector<TickHandlerTypeStats>& stats) override;
         //////////////////////////////////////////////////////////////////////////
 
         Descriptor& GetDescriptor() { return m_descriptor; }
@@ -236,6 +239,18 @@ namespace AZ
         void ResolveModulePath(AZ::OSString& modulePath) override;
 
     protected:
+        /**
+         * Sends OnTick to the TickBus handlers in tick order.
+         * Runs of thread safe handlers with the same tick order are spread across the job threads.
+         */
+        void TickHandlers(float deltaTime, ScriptTimePoint time);
+
+        /// Ticks the thread safe handlers collected by TickHandlers and clears the batch.
+        void TickJobHandlers(float deltaTime, const ScriptTimePoint& time);
+
+        /// Adds the time spent by a handler to the stats of its type.
+        void AddTickHandlerTime(TickEvents& handler, AZStd::chrono::microseconds tickTime);
+
         virtual void CreateReflectionManager();
         void DestroyReflectionManager();
 
@@ -330,6 +345,12 @@ namespace AZ
 
         Debug::DrillerManager*                      m_drillerManager;
 
+        AZStd::vector<TickEvents*>                  m_tickJobHandlers;                   ///< Thread safe handlers waiting to be ticked on jobs.
+        AZStd::vector<AZStd::chrono::microseconds>  m_tickJobHandlerTimes;               ///< Time spent by each of the m_tickJobHandlers, when collecting stats.
+        AZStd::vector<TickHandlerTypeStats>         m_tickHandlerStats;
+        size_t                                      m_lastTickHandlerStatsIndex;         ///< Handlers are grouped by type, so the last stats are usually the next ones.
+        bool                                        m_isTickHandlerStatsEnabled;
+
         StartupParameters                           m_startupParameters;
 
 private:
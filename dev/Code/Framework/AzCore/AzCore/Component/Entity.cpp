@@ -20,6 +20,11 @@
 
 #include <AzCore/Casting/lossy_cast.h>
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/IdUtils.h>
@@ -366,6 +371,177 @@ namespace AZ
         EBUS_EVENT(EntitySystemBus, OnEntityInitialized, m_id);
     }
 
+    namespace EntityActivationInternal
+    {
+        static const size_t s_minEntitiesPerJob = 8;
+
+        bool IsActivationThreadSafe(const Entity::ComponentArrayType& components)
+        {
+            for (const Component* component : components)
+            {
+                ComponentDescriptor* componentDescriptor = nullptr;
+                EBUS_EVENT_ID_RESULT(componentDescriptor, component->RTTI_GetType(), ComponentDescriptorBus, GetDescriptor);
+                if (!componentDescriptor || !componentDescriptor->IsActivationThreadSafe())
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Calls the function for every entity. The job entities are spread across the worker threads
+        // while the calling thread takes care of the entities that are not thread safe.
+        template<class Function>
+        void ProcessEntities(const AZStd::vector<Entity*>& jobEntities, const AZStd::vector<Entity*>& entities, const Function& function)
+        {
+            JobContext* jobContext = JobContext::GetGlobalContext();
+            const size_t workerCount = jobContext ? jobContext->GetJobManager().GetNumWorkerThreads() : 0;
+            const size_t jobCount = AZStd::min(workerCount, jobEntities.size() / s_minEntitiesPerJob);
+            if (jobCount <= 1)
+            {
+                for (Entity* entity : jobEntities)
+                {
+                    function(*entity);
+                }
+                for (Entity* entity : entities)
+                {
+                    function(*entity);
+                }
+                return;
+            }
+
+            AZStd::atomic<size_t> nextEntity(0);
+            JobCompletion jobCompletion;
+            for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+            {
+                Job* job = CreateJobFunction([&jobEntities, &nextEntity, &function]()
+                {
+                    AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "Entity::ProcessEntities::Job");
+                    for (size_t index = nextEntity.fetch_add(1); index < jobEntities.size(); index = nextEntity.fetch_add(1))
+                    {
+                        function(*jobEntities[index]);
+                    }
+                }, true, jobContext);
+
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+
+            for (Entity* entity : entities)
+            {
+                function(*entity);
+            }
+
+            jobCompletion.StartAndWaitForCompletion();
+        }
+    } // namespace EntityActivationInternal
+
+    //=========================================================================
+    // InitEntities
+    //=========================================================================
+    void Entity::InitEntities(const AZStd::vector<Entity*>& entities)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        AZStd::vector<Entity*> jobEntities;
+        AZStd::vector<Entity*> mainThreadEntities;
+        for (Entity* entity : entities)
+        {
+            AZ_Assert(entity->m_state == ES_CONSTRUCTED, "Component should be in Constructed state to be Initialized!");
+            entity->m_state = ES_INITIALIZING;
+
+            bool result = true;
+            EBUS_EVENT_RESULT(result, ComponentApplicationBus, AddEntity, entity);
+            (void)result;
+            AZ_Assert(result, "Failed to add entity '%s' [0x%llx]! Did you already register an entity with this ID?", entity->m_name.c_str(), entity->m_id);
+
+            ComponentArrayType& components = entity->m_components;
+            components.erase(AZStd::remove(components.begin(), components.end(), nullptr), components.end());
+            for (Component* component : components)
+            {
+                component->SetEntity(entity);
+            }
+
+            if (EntityActivationInternal::IsActivationThreadSafe(components))
+            {
+                jobEntities.push_back(entity);
+            }
+            else
+            {
+                mainThreadEntities.push_back(entity);
+            }
+        }
+
+        EntityActivationInternal::ProcessEntities(jobEntities, mainThreadEntities, [](Entity& entity)
+        {
+            for (Component* component : entity.m_components)
+            {
+                component->Init();
+            }
+        });
+
+        for (Entity* entity : entities)
+        {
+            entity->m_state = ES_INIT;
+
+            EBUS_EVENT_ID(entity->m_id, EntityBus, OnEntityExists, entity->m_id);
+            EBUS_EVENT(EntitySystemBus, OnEntityInitialized, entity->m_id);
+        }
+    }
+
+    //=========================================================================
+    // ActivateEntities
+    //=========================================================================
+    void Entity::ActivateEntities(const AZStd::vector<Entity*>& entities)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        AZStd::vector<Entity*> activatingEntities;
+        AZStd::vector<Entity*> jobEntities;
+        AZStd::vector<Entity*> mainThreadEntities;
+        activatingEntities.reserve(entities.size());
+        for (Entity* entity : entities)
+        {
+            AZ_Assert(entity->m_state == ES_INIT, "Entity should be in Init state to be Activated!");
+
+            const DependencySortOutcome sortOutcome = entity->EvaluateDependenciesGetDetails();
+            if (!sortOutcome.IsSuccess())
+            {
+                AZ_Error("Entity", false, "Entity '%s' %s cannot be activated. %s", entity->m_name.c_str(), entity->m_id.ToString().c_str(), sortOutcome.GetError().m_message.c_str());
+                continue;
+            }
+
+            entity->m_state = ES_ACTIVATING;
+            activatingEntities.push_back(entity);
+
+            if (EntityActivationInternal::IsActivationThreadSafe(entity->m_components))
+            {
+                jobEntities.push_back(entity);
+            }
+            else
+            {
+                mainThreadEntities.push_back(entity);
+            }
+        }
+
+        EntityActivationInternal::ProcessEntities(jobEntities, mainThreadEntities, [](Entity& entity)
+        {
+            for (Component* component : entity.m_components)
+            {
+                ActivateComponent(*component);
+            }
+        });
+
+        for (Entity* entity : activatingEntities)
+        {
+            entity->m_transform = TransformBus::FindFirstHandler(entity->m_id);
+            entity->m_state = ES_ACTIVE;
+
+            EBUS_EVENT_ID(entity->m_id, EntityBus, OnEntityActivated, entity->m_id);
+            EBUS_EVENT(EntitySystemBus, OnEntityActivated, entity->m_id);
+        }
+    }
+
     //=========================================================================
     // Activate
     // [5/30/2012]
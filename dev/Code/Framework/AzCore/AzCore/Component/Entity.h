@@ -432,6 +432,29 @@ namespace AZ
         */
         static DependencySortOutcome DependencySort(ComponentArrayType& components);
 
+        /**
+         * Initializes a batch of entities, as Init() would for each of them.
+         * The components of entities for which every component reports ComponentDescriptor::IsActivationThreadSafe()
+         * are initialized on the global job context, the rest are initialized on the calling thread.
+         * Entities are registered with the application and the initialization events are sent from the calling thread,
+         * in the order of the array, once all the components are initialized.
+         * Overrides of Init() are not called.
+         * @param entities Entities in the ES_CONSTRUCTED state.
+         */
+        static void InitEntities(const AZStd::vector<Entity*>& entities);
+
+        /**
+         * Activates a batch of entities, as Activate() would for each of them.
+         * The components of each entity are sorted with DependencySort() and activated in that order. Entities for
+         * which every component reports ComponentDescriptor::IsActivationThreadSafe() are activated on the global job
+         * context, the rest are activated on the calling thread.
+         * The activation events are sent from the calling thread, in the order of the array, once all the components
+         * are active. Entities whose components cannot be sorted are not activated.
+         * Overrides of Activate() are not called.
+         * @param entities Entities in the ES_INIT state.
+         */
+        static void ActivateEntities(const AZStd::vector<Entity*>& entities);
+
     protected:
 
         /// @cond EXCLUDE_DOCS 
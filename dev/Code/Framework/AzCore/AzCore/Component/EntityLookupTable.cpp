@@ -0,0 +1,169 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef AZ_UNITY_BUILD
+
+#include <AzCore/Component/EntityLookupTable.h>
+#include <AzCore/Component/Entity.h>
+
+namespace AZ
+{
+    //=========================================================================
+    // Insert
+    //=========================================================================
+    bool EntityLookupTable::Insert(Entity* entity)
+    {
+        const u64 id = static_cast<u64>(entity->GetId());
+        if (FindSlot(id) != m_slots.size())
+        {
+            return false;
+        }
+
+        // keep the table at most half full so the probe sequences stay short
+        if ((m_entities.size() + 1) * 2 > m_slots.size())
+        {
+            const size_t slotCount = m_slots.size() * 2;
+            Rehash(slotCount > s_minSlotCount ? slotCount : s_minSlotCount);
+        }
+
+        const size_t mask = m_slots.size() - 1;
+        size_t slotIndex = GetHomeSlot(id);
+        while (m_slots[slotIndex].m_entityIndex != s_emptySlot)
+        {
+            slotIndex = (slotIndex + 1) & mask;
+        }
+
+        m_slots[slotIndex].m_id = id;
+        m_slots[slotIndex].m_entityIndex = static_cast<u32>(m_entities.size());
+        m_entities.push_back(entity);
+        return true;
+    }
+
+    //=========================================================================
+    // Remove
+    //=========================================================================
+    bool EntityLookupTable::Remove(const EntityId& id)
+    {
+        size_t slotIndex = FindSlot(static_cast<u64>(id));
+        if (slotIndex == m_slots.size())
+        {
+            return false;
+        }
+
+        // move the last entity into the hole, so the array stays dense
+        const u32 entityIndex = m_slots[slotIndex].m_entityIndex;
+        const u32 lastIndex = static_cast<u32>(m_entities.size() - 1);
+        if (entityIndex != lastIndex)
+        {
+            Entity* lastEntity = m_entities[lastIndex];
+            m_entities[entityIndex] = lastEntity;
+            m_slots[FindSlot(static_cast<u64>(lastEntity->GetId()))].m_entityIndex = entityIndex;
+        }
+        m_entities.pop_back();
+
+        // shift back the slots that follow in the probe sequence, instead of leaving a tombstone
+        const size_t mask = m_slots.size() - 1;
+        size_t nextIndex = (slotIndex + 1) & mask;
+        while (m_slots[nextIndex].m_entityIndex != s_emptySlot)
+        {
+            const size_t homeIndex = GetHomeSlot(m_slots[nextIndex].m_id);
+            // the slot can fill the hole if its home is not in the cyclic range (slotIndex, nextIndex]
+            if (((nextIndex - homeIndex) & mask) >= ((nextIndex - slotIndex) & mask))
+            {
+                m_slots[slotIndex] = m_slots[nextIndex];
+                slotIndex = nextIndex;
+            }
+            nextIndex = (nextIndex + 1) & mask;
+        }
+        m_slots[slotIndex].m_entityIndex = s_emptySlot;
+        return true;
+    }
+
+    //=========================================================================
+    // Find
+    //=========================================================================
+    Entity* EntityLookupTable::Find(const EntityId& id) const
+    {
+        const size_t slotIndex = FindSlot(static_cast<u64>(id));
+        return slotIndex != m_slots.size() ? m_entities[m_slots[slotIndex].m_entityIndex] : nullptr;
+    }
+
+    //=========================================================================
+    // Clear
+    //=========================================================================
+    void EntityLookupTable::Clear()
+    {
+        m_slots.clear();
+        m_slots.shrink_to_fit();
+        m_entities.clear();
+        m_entities.shrink_to_fit();
+    }
+
+    //=========================================================================
+    // GetHomeSlot
+    //=========================================================================
+    size_t EntityLookupTable::GetHomeSlot(u64 id) const
+    {
+        // ids have most of their entropy in a few bits, mix them before taking the low bits
+        id ^= id >> 33;
+        id *= 0xff51afd7ed558ccdull;
+        id ^= id >> 33;
+        return static_cast<size_t>(id) & (m_slots.size() - 1);
+    }
+
+    //=========================================================================
+    // FindSlot
+    //=========================================================================
+    size_t EntityLookupTable::FindSlot(u64 id) const
+    {
+        if (m_slots.empty())
+        {
+            return 0;
+        }
+
+        const size_t mask = m_slots.size() - 1;
+        for (size_t slotIndex = GetHomeSlot(id); m_slots[slotIndex].m_entityIndex != s_emptySlot; slotIndex = (slotIndex + 1) & mask)
+        {
+            if (m_slots[slotIndex].m_id == id)
+            {
+                return slotIndex;
+            }
+        }
+        return m_slots.size();
+    }
+
+    //=========================================================================
+    // Rehash
+    //=========================================================================
+    void EntityLookupTable::Rehash(size_t slotCount)
+    {
+        Slot emptySlot;
+        emptySlot.m_id = 0;
+        emptySlot.m_entityIndex = s_emptySlot;
+        m_slots.clear();
+        m_slots.resize(slotCount, emptySlot);
+
+        const size_t mask = slotCount - 1;
+        for (size_t entityIndex = 0; entityIndex < m_entities.size(); ++entityIndex)
+        {
+            const u64 id = static_cast<u64>(m_entities[entityIndex]->GetId());
+            size_t slotIndex = GetHomeSlot(id);
+            while (m_slots[slotIndex].m_entityIndex != s_emptySlot)
+            {
+                slotIndex = (slotIndex + 1) & mask;
+            }
+            m_slots[slotIndex].m_id = id;
+            m_slots[slotIndex].m_entityIndex = static_cast<u32>(entityIndex);
+        }
+    }
+} // namespace AZ
+
+#endif // #ifndef AZ_UNITY_BUILD
@@ -0,0 +1,67 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    class Entity;
+
+    /**
+     * Index of the entities registered with the component application.
+     * Entities are stored in a dense array, in no particular order, and found by id through an open addressing
+     * table of (id, index) slots. A lookup is one hash and usually a single cache line, instead of the node walk of
+     * a hash map, and the ids themselves are not changed, so they stay valid for serialization and networking.
+     * The table does not allocate until the first entity is inserted.
+     */
+    class EntityLookupTable
+    {
+    public:
+        EntityLookupTable() = default;
+
+        /// Adds the entity under its current id. Returns false if an entity with the same id is already registered.
+        bool Insert(Entity* entity);
+
+        /// Returns false if no entity is registered with the id.
+        bool Remove(const EntityId& id);
+
+        Entity* Find(const EntityId& id) const;
+
+        bool Empty() const { return m_entities.empty(); }
+        size_t Size() const { return m_entities.size(); }
+
+        /// All registered entities, in no particular order. Inserting or removing entities invalidates the array.
+        const AZStd::vector<Entity*>& GetEntities() const { return m_entities; }
+
+        /// Removes all entities and frees the memory.
+        void Clear();
+
+    private:
+        static const u32 s_emptySlot = 0xffffffff;
+        static const size_t s_minSlotCount = 64;
+
+        struct Slot
+        {
+            u64 m_id;
+            u32 m_entityIndex; ///< Index in m_entities, s_emptySlot if the slot is not used.
+        };
+
+        size_t GetHomeSlot(u64 id) const;
+        size_t FindSlot(u64 id) const;
+        void Rehash(size_t slotCount);
+
+        AZStd::vector<Slot> m_slots; ///< Power of two sized, at most half full.
+        AZStd::vector<Entity*> m_entities;
+    };
+} // namespace AZ
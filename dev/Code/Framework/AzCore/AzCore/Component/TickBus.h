@@ -21,6 +21,7 @@
 
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h> // For TickBus thread events.
 #include <AzCore/Script/ScriptTimePoint.h>
 
@@ -87,8 +88,8 @@ namespace AZ
          * Overrides the default AZ::EBusTraits handler policy so that multiple 
          * handlers can connect to the bus. This bus has one address because it  
          * uses the default EBusTraits address policy. At the address, handlers 
-         * receive events based on the order in which the components are initialized, 
-         * unless a handler explicitly sets its TickEvents::m_tickOrder.
+         * receive events based on their GetTickOrder(). Handlers with the same tick order are
+         * grouped by type, and handlers of the same type receive events in the order in which they connected.
          */
         static const AZ::EBusHandlerPolicy HandlerPolicy = EBusHandlerPolicy::MultipleAndOrdered;  
              
@@ -105,13 +106,19 @@ namespace AZ
         
         /**
          * Determines the order in which handlers receive tick events. 
-         * Handlers receive events based on the order in which the components are initialized, 
-         * unless a handler explicitly sets its position.
+         * Handlers are sorted by their tick order. Ties are broken by the handler type, so the handlers of
+         * a component type are called one after the other instead of interleaving with other types, which keeps
+         * their code and data warm in the caches.
          */
         struct BusHandlerOrderCompare
             : public AZStd::binary_function<TickEvents*, TickEvents*, bool>                           
         {
-            AZ_FORCE_INLINE bool operator()(TickEvents* left, TickEvents* right) const { return left->GetTickOrder() < right->GetTickOrder(); }
+            AZ_FORCE_INLINE bool operator()(TickEvents* left, TickEvents* right) const
+            {
+                const int leftOrder = left->GetTickOrder();
+                const int rightOrder = right->GetTickOrder();
+                return leftOrder < rightOrder || (leftOrder == rightOrder && left->RTTI_GetType() < right->RTTI_GetType());
+            }
         };
         //////////////////////////////////////////////////////////////////////////
 
@@ -135,6 +142,15 @@ namespace AZ
             return m_tickOrder;
         }
 
+        /**
+         * Specifies whether OnTick can run on a job thread, at the same time as OnTick of the other
+         * thread safe handlers with the same tick order.
+         * A thread safe handler must not connect to, disconnect from or send events on buses that are not
+         * thread safe from OnTick, and that includes the TickBus itself.
+         * @return True if OnTick is thread safe. By default handlers are not.
+         */
+        virtual bool    IsTickThreadSafe() { return false; }
+
     protected:
         // Only the component application is allowed to issue ticks.
         friend class ComponentApplication;
@@ -151,6 +167,19 @@ namespace AZ
      * The events are defined in the AZ::TickEvents class.
      */
     typedef AZ::EBus<TickEvents>    TickBus;
+
+    /**
+     * The time spent in OnTick by the TickBus handlers of one type.
+     */
+    struct TickHandlerTypeStats
+    {
+        Uuid m_typeId = Uuid::CreateNull();
+        const char* m_typeName = nullptr;
+        u32 m_handlerCount = 0;                                         ///< Number of handlers ticked in the last tick.
+        u64 m_tickCount = 0;                                            ///< Number of ticks in which handlers of this type were ticked.
+        AZStd::chrono::microseconds m_lastTickTime = AZStd::chrono::microseconds(0);   ///< Time spent by all the handlers in the last tick.
+        AZStd::chrono::microseconds m_totalTickTime = AZStd::chrono::microseconds(0);  ///< Time spent by all the handlers since the collection started.
+    };
     
     /**
      * Interface for AZ::TickRequestBus, which components use to make tick-related 
@@ -171,6 +200,23 @@ namespace AZ
          * Gets the time in seconds since the epoch.
          */
         virtual ScriptTimePoint GetTimeAtCurrentTick() = 0;
+
+        /**
+         * Enables the collection of the time spent in OnTick by each handler type.
+         * Timing the handlers adds to the cost of the tick, so the collection is disabled by default.
+         * Enabling the collection clears the previous results.
+         */
+        virtual void SetTickHandlerStatsEnabled(bool enabled) { (void)enabled; }
+
+        /**
+         * Returns true if the time spent by each handler type is being collected.
+         */
+        virtual bool IsTickHandlerStatsEnabled() { return false; }
+
+        /**
+         * Gets the time spent in OnTick by each handler type, in the order in which the types were first ticked.
+         */
+        virtual void GetTickHandlerStats(AZStd::vector<TickHandlerTypeStats>& stats) { stats.clear(); }
     };
 
     /**
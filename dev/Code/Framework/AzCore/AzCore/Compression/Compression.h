@@ -58,17 +58,34 @@ namespace AZ
         ///     8       ~1.4MB              827ms
         ///     9       ~1.4MB              858ms
         void StartCompressor(unsigned int compressionLevel = 9);
+        /// Starts a compressor that writes a raw deflate stream, without the zlib header and checksum. Use it for small
+        /// buffers compressed one by one (like network packets), where the 6 bytes of framing matter and the data is
+        /// validated elsewhere. Raw streams must be decompressed with StartRawDecompressor.
+        void StartRawCompressor(unsigned int compressionLevel = 9);
         bool IsCompressorStarted() const        { return m_strDeflate != 0; }
         void StopCompressor();
         void ResetCompressor();
 
         /// Must be called before we can decompress. Hdr is optional hdr structure that is stored at the begin of the stream and should be passed to the ResetDecompresor.
         void StartDecompressor(Header* hdr = NULL);
+        /// Starts a decompressor for streams written by a raw compressor. Raw streams usually come from untrusted sources,
+        /// so malformed data is reported with IsDecompressorFailed() instead of asserting.
+        void StartRawDecompressor();
         bool IsDecompressorStarted() const      { return m_strInflate != 0; }
         void StopDecompressor();
         /// If you will use seek/sync points we require that you pass the header since the reset will reset all states and you can't really continue (unless from the start).
         void ResetDecompressor(Header* header = NULL);
 
+        /// Presets the compressor with a dictionary, data that is likely to show up in the stream. Must be called after the
+        /// compressor is started or reset, before any data is compressed. The dictionary must be identical on the decompressor side.
+        void SetCompressorDictionary(const void* dictionary, unsigned int dictionarySize);
+        /// Sets the dictionary the stream was compressed with, the memory must stay valid while the decompressor uses it.
+        /// Must be called after the decompressor is started or reset. Raw streams use it right away, zlib streams when
+        /// the stream header asks for it.
+        void SetDecompressorDictionary(const void* dictionary, unsigned int dictionarySize);
+        /// Returns true if the last Decompress of a raw stream found malformed data.
+        bool IsDecompressorFailed() const       { return m_isInflateFailed; }
+
         //////////////////////////////////////////////////////////////////////////
         // Compressor
         /// Return compressed buffer minimal size for the given source size. compressedDataSize in compress must be at least that size, otherwise compression will fail.
@@ -94,6 +111,10 @@ namespace AZ
         z_stream_s* m_strDeflate;
         z_stream_s* m_strInflate;
         IAllocator* m_workMemoryAllocator;
+        const void* m_inflateDictionary;
+        unsigned int m_inflateDictionarySize;
+        bool        m_isRawInflate;
+        bool        m_isInflateFailed;
     };
 }
 
@@ -30,6 +30,10 @@ using namespace AZ;
 ZLib::ZLib(IAllocator* workMemAllocator)
     : m_strDeflate(NULL)
     , m_strInflate(NULL)
+    , m_inflateDictionary(NULL)
+    , m_inflateDictionarySize(0)
+    , m_isRawInflate(false)
+    , m_isInflateFailed(false)
 {
     m_workMemoryAllocator = workMemAllocator;
     if (m_workMemoryAllocator == NULL)
@@ -90,6 +94,33 @@ void ZLib::StartCompressor(unsigned int compressionLevel)
     AZ_Assert(r == Z_OK, "ZLib internal error - deflateInit() failed !!!\n");
 }
 
+//=========================================================================
+// StartRawCompressor
+//=========================================================================
+void ZLib::StartRawCompressor(unsigned int compressionLevel)
+{
+    AZ_Assert(m_strDeflate == NULL, "Compressor already started!");
+    m_strDeflate = reinterpret_cast< z_stream* >(AllocateMem(m_workMemoryAllocator, 1, sizeof(z_stream)));
+    m_strDeflate->zalloc = &ZLib::AllocateMem;
+    m_strDeflate->zfree = &ZLib::FreeMem;
+    m_strDeflate->opaque = m_workMemoryAllocator;
+    // negative window bits select a raw deflate stream
+    int r = deflateInit2(m_strDeflate, compressionLevel, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    (void)r;
+    AZ_Assert(r == Z_OK, "ZLib internal error - deflateInit2() failed !!!\n");
+}
+
+//=========================================================================
+// SetCompressorDictionary
+//=========================================================================
+void ZLib::SetCompressorDictionary(const void* dictionary, unsigned int dictionarySize)
+{
+    AZ_Assert(m_strDeflate != NULL, "Compressor not started!");
+    int r = deflateSetDictionary(m_strDeflate, reinterpret_cast<const Bytef*>(dictionary), dictionarySize);
+    (void)r;
+    AZ_Assert(r == Z_OK, "ZLib inconsistent state - deflateSetDictionary() must be called before any data is compressed!\n");
+}
+
 //=========================================================================
 // StopCompressor
 // [3/21/2011]
@@ -181,12 +212,48 @@ void ZLib::StartDecompressor(Header* header)
     int r = inflateInit(m_strInflate);
     (void)r;
     AZ_Assert(r == Z_OK, "ZLib internal error - inflateInit() failed !!!\n");
+    m_isRawInflate = false;
+    m_isInflateFailed = false;
     if (header)
     {
         SetupDecompressHeader(*header);
     }
 }
 
+//=========================================================================
+// StartRawDecompressor
+//=========================================================================
+void ZLib::StartRawDecompressor()
+{
+    AZ_Assert(m_strInflate == NULL, "Decompressor already started!");
+    m_strInflate = reinterpret_cast< z_stream* >(AllocateMem(m_workMemoryAllocator, 1, sizeof(z_stream)));
+    m_strInflate->zalloc = &ZLib::AllocateMem;
+    m_strInflate->zfree = &ZLib::FreeMem;
+    m_strInflate->opaque = m_workMemoryAllocator;
+    int r = inflateInit2(m_strInflate, -MAX_WBITS);
+    (void)r;
+    AZ_Assert(r == Z_OK, "ZLib internal error - inflateInit2() failed !!!\n");
+    m_isRawInflate = true;
+    m_isInflateFailed = false;
+}
+
+//=========================================================================
+// SetDecompressorDictionary
+//=========================================================================
+void ZLib::SetDecompressorDictionary(const void* dictionary, unsigned int dictionarySize)
+{
+    AZ_Assert(m_strInflate != NULL, "Decompressor not started!");
+    m_inflateDictionary = dictionary;
+    m_inflateDictionarySize = dictionarySize;
+    if (m_isRawInflate)
+    {
+        // raw streams have no header to request the dictionary, it's set up front
+        int r = inflateSetDictionary(m_strInflate, reinterpret_cast<const Bytef*>(dictionary), dictionarySize);
+        (void)r;
+        AZ_Assert(r == Z_OK, "ZLib inconsistent state - inflateSetDictionary() must be called before any data is decompressed!\n");
+    }
+}
+
 //=========================================================================
 // StopDecompressor
 // [3/21/2011]
@@ -209,6 +276,7 @@ void ZLib::ResetDecompressor(Header* header)
     int r = inflateReset(m_strInflate);
     (void)r;
     AZ_Assert(r == Z_OK, "ZLib inconsistent state - inflateReset() failed !!!\n");
+    m_isInflateFailed = false;
     if (header)
     {
         SetupDecompressHeader(*header);
@@ -265,6 +333,23 @@ unsigned int ZLib::Decompress(const void* compressedData, unsigned int compresse
         flush = Z_NO_FLUSH;
     }
     int r = inflate(m_strInflate, flush);
+    if (r == Z_NEED_DICT && m_inflateDictionary)
+    {
+        // zlib streams ask for the dictionary in the header, continue once it's set
+        r = inflateSetDictionary(m_strInflate, reinterpret_cast<const Bytef*>(m_inflateDictionary), m_inflateDictionarySize);
+        if (r == Z_OK)
+        {
+            r = inflate(m_strInflate, flush);
+        }
+    }
+
+    if (m_isRawInflate)
+    {
+        // a finished stream that still has output space left but no end is truncated
+        m_isInflateFailed = (r < Z_OK && r != Z_BUF_ERROR) || (flush == Z_FINISH && r != Z_STREAM_END && m_strInflate->avail_out != 0);
+        dataSize = m_strInflate->avail_out;
+        return compressedDataSize - m_strInflate->avail_in;
+    }
     /*
     Because of the way we allow random access to our compressed streams by way of adding seek points into the end of the stream, a Z_DATA_ERROR
     will occur if the compressed stream is not decompressed sequentially. This is due to the adler32 checksum of all uncompressed data up to the Z_FINISH
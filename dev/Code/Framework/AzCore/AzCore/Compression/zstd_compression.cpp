@@ -0,0 +1,224 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef AZ_UNITY_BUILD
+
+#if !defined(AZCORE_EXCLUDE_ZSTANDARD)
+
+#include <AzCore/Compression/zstd_compression.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+using namespace AZ;
+
+// needed for the custom allocator versions of the stream create functions
+#define ZSTD_STATIC_LINKING_ONLY
+#include <zstd.h>
+
+//=========================================================================
+// ZStd
+//=========================================================================
+ZStd::ZStd(IAllocator* workMemAllocator)
+    : m_cstream(NULL)
+    , m_dstream(NULL)
+    , m_isCompressorFlushPending(false)
+    , m_isDecompressorFailed(false)
+{
+    m_workMemoryAllocator = workMemAllocator;
+    if (m_workMemoryAllocator == NULL)
+    {
+        m_workMemoryAllocator = &AllocatorInstance<SystemAllocator>::Get();
+    }
+}
+
+//=========================================================================
+// ~ZStd
+//=========================================================================
+ZStd::~ZStd()
+{
+    if (m_cstream)
+    {
+        StopCompressor();
+    }
+    if (m_dstream)
+    {
+        StopDecompressor();
+    }
+}
+
+//=========================================================================
+// AllocateMem
+//=========================================================================
+void* ZStd::AllocateMem(void* userData, size_t size)
+{
+    IAllocator* allocator = reinterpret_cast<IAllocator*>(userData);
+    return allocator->Allocate(size, 8, 0, "ZStd", __FILE__, __LINE__);
+}
+
+//=========================================================================
+// FreeMem
+//=========================================================================
+void ZStd::FreeMem(void* userData, void* address)
+{
+    if (address)
+    {
+        IAllocator* allocator = reinterpret_cast<IAllocator*>(userData);
+        allocator->DeAllocate(address);
+    }
+}
+
+//=========================================================================
+// StartCompressor
+//=========================================================================
+void ZStd::StartCompressor(int compressionLevel)
+{
+    AZ_Assert(m_cstream == NULL, "Compressor already started!");
+    ZSTD_customMem customMem = { &ZStd::AllocateMem, &ZStd::FreeMem, m_workMemoryAllocator };
+    m_cstream = ZSTD_createCStream_advanced(customMem);
+    AZ_Assert(m_cstream, "ZStd internal error - ZSTD_createCStream_advanced() failed !!!\n");
+    size_t r = ZSTD_CCtx_setParameter(m_cstream, ZSTD_c_compressionLevel, compressionLevel);
+    (void)r;
+    AZ_Assert(!ZSTD_isError(r), "ZStd internal error - can't set compression level %d: %s\n", compressionLevel, ZSTD_getErrorName(r));
+    // we know the offsets of the frames, no need to pay for the checksums when seeking around
+    ZSTD_CCtx_setParameter(m_cstream, ZSTD_c_checksumFlag, 0);
+    m_isCompressorFlushPending = false;
+}
+
+//=========================================================================
+// StopCompressor
+//=========================================================================
+void ZStd::StopCompressor()
+{
+    AZ_Assert(m_cstream != NULL, "Compressor not started!");
+    ZSTD_freeCStream(m_cstream);
+    m_cstream = NULL;
+}
+
+//=========================================================================
+// SetCompressorDictionary
+//=========================================================================
+bool ZStd::SetCompressorDictionary(const void* dictionary, size_t dictionarySize)
+{
+    AZ_Assert(m_cstream != NULL, "Compressor not started!");
+    size_t r = ZSTD_CCtx_loadDictionary(m_cstream, dictionary, dictionarySize);
+    AZ_Warning("ZStd", !ZSTD_isError(r), "Failed to set the compression dictionary: %s", ZSTD_getErrorName(r));
+    return !ZSTD_isError(r);
+}
+
+//=========================================================================
+// GetMinCompressedBufferSize
+//=========================================================================
+unsigned int ZStd::GetMinCompressedBufferSize(unsigned int sourceDataSize)
+{
+    return static_cast<unsigned int>(ZSTD_compressBound(sourceDataSize));
+}
+
+//=========================================================================
+// Compress
+//=========================================================================
+unsigned int ZStd::Compress(const void* data, unsigned int& dataSize, void* compressedData, unsigned int compressedDataSize, FlushType flushType)
+{
+    AZ_Assert(m_cstream != NULL, "Compressor not started!");
+    ZSTD_inBuffer input = { data, dataSize, 0 };
+    ZSTD_outBuffer output = { compressedData, compressedDataSize, 0 };
+    ZSTD_EndDirective endOp;
+    switch (flushType)
+    {
+    case FT_FLUSH:
+        endOp = ZSTD_e_flush;
+        break;
+    case FT_END_FRAME:
+        endOp = ZSTD_e_end;
+        break;
+    case FT_NO_FLUSH:
+    default:
+        endOp = ZSTD_e_continue;
+    }
+    size_t r = ZSTD_compressStream2(m_cstream, &output, &input, endOp);
+    AZ_Assert(!ZSTD_isError(r), "ZStd compress internal error %s", ZSTD_getErrorName(r));
+    // for the flush directives the result is the number of bytes still waiting to be flushed
+    m_isCompressorFlushPending = endOp != ZSTD_e_continue && !ZSTD_isError(r) && r != 0;
+    dataSize = static_cast<unsigned int>(input.size - input.pos);
+    return static_cast<unsigned int>(output.pos);
+}
+
+//=========================================================================
+// StartDecompressor
+//=========================================================================
+void ZStd::StartDecompressor()
+{
+    AZ_Assert(m_dstream == NULL, "Decompressor already started!");
+    ZSTD_customMem customMem = { &ZStd::AllocateMem, &ZStd::FreeMem, m_workMemoryAllocator };
+    m_dstream = ZSTD_createDStream_advanced(customMem);
+    AZ_Assert(m_dstream, "ZStd internal error - ZSTD_createDStream_advanced() failed !!!\n");
+    m_isDecompressorFailed = false;
+}
+
+//=========================================================================
+// StopDecompressor
+//=========================================================================
+void ZStd::StopDecompressor()
+{
+    AZ_Assert(m_dstream != NULL, "Decompressor not started!");
+    ZSTD_freeDStream(m_dstream);
+    m_dstream = NULL;
+}
+
+//=========================================================================
+// ResetDecompressor
+//=========================================================================
+void ZStd::ResetDecompressor()
+{
+    AZ_Assert(m_dstream != NULL, "Decompressor not started!");
+    // session only, keeps the dictionary
+    ZSTD_DCtx_reset(m_dstream, ZSTD_reset_session_only);
+    m_isDecompressorFailed = false;
+}
+
+//=========================================================================
+// SetDecompressorDictionary
+//=========================================================================
+bool ZStd::SetDecompressorDictionary(const void* dictionary, size_t dictionarySize)
+{
+    AZ_Assert(m_dstream != NULL, "Decompressor not started!");
+    size_t r = ZSTD_DCtx_loadDictionary(m_dstream, dictionary, dictionarySize);
+    AZ_Warning("ZStd", !ZSTD_isError(r), "Failed to set the decompression dictionary: %s", ZSTD_getErrorName(r));
+    return !ZSTD_isError(r);
+}
+
+//=========================================================================
+// Decompress
+//=========================================================================
+unsigned int ZStd::Decompress(const void* compressedData, unsigned int compressedDataSize, void* data, unsigned int& dataSize)
+{
+    AZ_Assert(m_dstream != NULL, "Decompressor not started!");
+    ZSTD_inBuffer input = { compressedData, compressedDataSize, 0 };
+    ZSTD_outBuffer output = { data, dataSize, 0 };
+    size_t r = ZSTD_decompressStream(m_dstream, &output, &input);
+    if (ZSTD_isError(r))
+    {
+        AZ_Warning("ZStd", false, "ZStd decompress error %s", ZSTD_getErrorName(r));
+        m_isDecompressorFailed = true;
+    }
+    dataSize = static_cast<unsigned int>(output.size - output.pos);
+    return static_cast<unsigned int>(input.pos);
+}
+
+//=========================================================================
+// GetDictionaryId
+//=========================================================================
+AZ::u32 ZStd::GetDictionaryId(const void* dictionary, size_t dictionarySize)
+{
+    return ZSTD_getDictID_fromDict(dictionary, dictionarySize);
+}
+
+#endif // #if !defined(AZCORE_EXCLUDE_ZSTANDARD)
+
+#endif // #ifndef AZ_UNITY_BUILD
@@ -0,0 +1,101 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/base.h>
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+
+namespace AZ
+{
+    class IAllocator;
+
+    /**
+     * Zstandard streaming compression. Compression ratios are close to zlib at the low levels, but both compression
+     * and especially decompression are several times faster. Compressed data is split in frames, each frame can be
+     * decompressed on its own (which is what makes zstd streams cheap to seek).
+     * If you want detailed control over the compressed stream, include <zstd.h> and do it yourself!
+     */
+    class ZStd
+    {
+    public:
+        ZStd(IAllocator* workMemAllocator = 0);
+        ~ZStd();
+
+        enum FlushType
+        {
+            FT_NO_FLUSH = 0,    ///< Buffer the data as zstd sees fit.
+            FT_FLUSH,           ///< Flush all buffered data, the frame stays open.
+            FT_END_FRAME,       ///< Flush all buffered data and close the frame. The next data starts a new independent frame.
+        };
+
+        /// Must be called before we can compress. Compression level can vary from [1 - fastest to 22 - best compression], zstd default is 3.
+        void StartCompressor(int compressionLevel = 3);
+        bool IsCompressorStarted() const        { return m_cstream != NULL; }
+        void StopCompressor();
+
+        /// Presets the compressor with a dictionary, used for all frames after this call. Must be called between frames
+        /// (after the compressor is started or a frame was ended). The same dictionary must be set on the decompressor side.
+        /// The dictionary is copied, the memory can be freed after the call.
+        bool SetCompressorDictionary(const void* dictionary, size_t dictionarySize);
+        /// Returns true if the last Compress with a flush type didn't have enough output space to flush everything. Call Compress again with the same flush type.
+        bool IsCompressorFlushPending() const   { return m_isCompressorFlushPending; }
+
+        //////////////////////////////////////////////////////////////////////////
+        // Compressor
+        /// Return compressed buffer size required to compress sourceDataSize in one go.
+        static unsigned int GetMinCompressedBufferSize(unsigned int sourceDataSize);
+        /**
+         * Compressed data from the data buffer into compressedData buffer.
+         * If compressedData is NOT big enough the left over size will be returned in "dataSize". If dataSize is 0 all data has been compressed.
+         * \returns number of bytes written in compressedData.
+         */
+        unsigned int Compress(const void* data, unsigned int& dataSize, void* compressedData, unsigned int compressedDataSize, FlushType flushType = FT_NO_FLUSH);
+        //////////////////////////////////////////////////////////////////////////
+
+        /// Must be called before we can decompress.
+        void StartDecompressor();
+        bool IsDecompressorStarted() const      { return m_dstream != NULL; }
+        void StopDecompressor();
+        /// Drops the current frame, the next data passed to Decompress must be the start of a frame. The dictionary is kept.
+        void ResetDecompressor();
+
+        /// Sets the dictionary the frames were compressed with, used for all frames after this call. The dictionary is copied.
+        bool SetDecompressorDictionary(const void* dictionary, size_t dictionarySize);
+        /// Returns true if the last Decompress found malformed data (or data that needs a different dictionary).
+        bool IsDecompressorFailed() const       { return m_isDecompressorFailed; }
+
+        //////////////////////////////////////////////////////////////////////////
+        // Decompressor
+        /**
+         * Decompresses data from compressedData into the data buffer, dataSize is the size of the data buffer on input and the size left on output.
+         * Consecutive frames are decompressed as one stream.
+         * \returns number of compressed bytes processed.
+         */
+        unsigned int Decompress(const void* compressedData, unsigned int compressedDataSize, void* data, unsigned int& dataSize);
+        //////////////////////////////////////////////////////////////////////////
+
+        /// Returns the id zstd stores in the frames compressed with a dictionary (0 if the dictionary is raw content and has no id).
+        static AZ::u32 GetDictionaryId(const void* dictionary, size_t dictionarySize);
+
+    private:
+        static void* AllocateMem(void* userData, size_t size);
+        static void  FreeMem(void* userData, void* address);
+
+        ZSTD_CCtx_s* m_cstream;
+        ZSTD_DCtx_s* m_dstream;
+        IAllocator*  m_workMemoryAllocator;
+        bool         m_isCompressorFlushPending;
+        bool         m_isDecompressorFailed;
+    };
+}
@@ -0,0 +1,194 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef AZ_UNITY_BUILD
+
+#include <AzCore/Debug/EBusProfiler.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/EBus/Internal/BusProfiler.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace Debug
+    {
+#if EBUS_PROFILING
+        namespace EBusProfilerInternal
+        {
+            using Values = Internal::EBusProfileStats::Values;
+
+            static Values ReadTotals(const Internal::EBusProfileStats& stats)
+            {
+                Values values;
+                values.m_events = stats.m_otherEvents.load(AZStd::memory_order_relaxed);
+                values.m_broadcasts = stats.m_otherBroadcasts.load(AZStd::memory_order_relaxed);
+                for (const Internal::EBusProfileStats::EventStats& event : stats.m_eventStats)
+                {
+                    values.m_events += event.m_events.load(AZStd::memory_order_relaxed);
+                    values.m_broadcasts += event.m_broadcasts.load(AZStd::memory_order_relaxed);
+                }
+                values.m_dispatches = values.m_events + values.m_broadcasts + stats.m_enumerations.load(AZStd::memory_order_relaxed);
+                values.m_samples = stats.m_samples.load(AZStd::memory_order_relaxed);
+                values.m_handlerTicks = stats.m_handlerTicks.load(AZStd::memory_order_relaxed);
+                values.m_lockWaitTicks = stats.m_lockWaitTicks.load(AZStd::memory_order_relaxed);
+                return values;
+            }
+
+            static AZ::u64 GetEventCalls(const Internal::EBusProfileStats::EventStats& event)
+            {
+                return event.m_events.load(AZStd::memory_order_relaxed) + event.m_broadcasts.load(AZStd::memory_order_relaxed);
+            }
+
+            //only one in SampleRate dispatches is timed, scale the sampled time up to all dispatches
+            static AZ::u64 EstimateMicroseconds(AZ::u64 ticks, const Values& values)
+            {
+                if (values.m_samples == 0)
+                {
+                    return 0;
+                }
+                const double ticksPerMicrosecond = static_cast<double>(AZStd::GetTimeTicksPerSecond()) / 1000000.0;
+                const double scale = static_cast<double>(values.m_dispatches) / static_cast<double>(values.m_samples);
+                return static_cast<AZ::u64>(static_cast<double>(ticks) * scale / ticksPerMicrosecond);
+            }
+
+            static void FillBusInfo(const Internal::EBusProfileStats& stats, bool isFrame, EBusProfiler::BusInfo& info)
+            {
+                const Values values = isFrame ? stats.m_frame : ReadTotals(stats);
+                info.m_name = stats.m_busName;
+                info.m_dispatches = values.m_dispatches;
+                info.m_events = values.m_events;
+                info.m_broadcasts = values.m_broadcasts;
+                info.m_handlerTime = EstimateMicroseconds(values.m_handlerTicks, values);
+                info.m_lockWaitTime = EstimateMicroseconds(values.m_lockWaitTicks, values);
+
+                info.m_topEvents.clear();
+                for (const Internal::EBusProfileStats::EventStats& event : stats.m_eventStats)
+                {
+                    const AZ::u64 calls = isFrame ? event.m_frameCalls : GetEventCalls(event);
+                    const char* name = event.m_name.load(AZStd::memory_order_acquire);
+                    if (calls > 0 && name)
+                    {
+                        info.m_topEvents.push_back({ name, calls });
+                    }
+                }
+                AZStd::sort(info.m_topEvents.begin(), info.m_topEvents.end(),
+                    [](const EBusProfiler::EventInfo& lhs, const EBusProfiler::EventInfo& rhs) { return lhs.m_calls > rhs.m_calls; });
+            }
+        }
+#endif // EBUS_PROFILING
+
+        //=========================================================================
+        // IsEnabled
+        //=========================================================================
+        bool EBusProfiler::IsEnabled()
+        {
+#if EBUS_PROFILING
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        //=========================================================================
+        // EndFrame
+        //=========================================================================
+        void EBusProfiler::EndFrame()
+        {
+#if EBUS_PROFILING
+            using namespace EBusProfilerInternal;
+
+            EnvironmentVariable<Internal::EBusProfileRegistry> registry = Environment::FindVariable<Internal::EBusProfileRegistry>(Internal::EBusProfileRegistry::GetVariableName());
+            if (!registry)
+            {
+                return; // nothing was dispatched yet
+            }
+
+            const AZ::u64 profilerId = Profiler::IsReady() ? Profiler::GetId() : 0;
+
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(registry->m_mutex);
+            ++registry->m_frameCount;
+            for (Internal::EBusProfileStats* stats = registry->m_first; stats; stats = stats->m_next)
+            {
+                const Values current = ReadTotals(*stats);
+                stats->m_frame.m_dispatches = current.m_dispatches - stats->m_last.m_dispatches;
+                stats->m_frame.m_events = current.m_events - stats->m_last.m_events;
+                stats->m_frame.m_broadcasts = current.m_broadcasts - stats->m_last.m_broadcasts;
+                stats->m_frame.m_samples = current.m_samples - stats->m_last.m_samples;
+                stats->m_frame.m_handlerTicks = current.m_handlerTicks - stats->m_last.m_handlerTicks;
+                stats->m_frame.m_lockWaitTicks = current.m_lockWaitTicks - stats->m_last.m_lockWaitTicks;
+                stats->m_last = current;
+
+                for (Internal::EBusProfileStats::EventStats& event : stats->m_eventStats)
+                {
+                    const AZ::u64 calls = GetEventCalls(event);
+                    event.m_frameCalls = calls - event.m_lastCalls;
+                    event.m_lastCalls = calls;
+                }
+
+                if (profilerId != 0)
+                {
+                    if (stats->m_registerProfilerId != profilerId)
+                    {
+                        stats->m_register = ProfilerRegister::ValueCreate("EBus", stats->m_busName, AZ_FUNCTION_SIGNATURE, __LINE__);
+                        stats->m_registerProfilerId = profilerId;
+                    }
+
+                    const Values& frame = stats->m_frame;
+                    stats->m_register->ValueSet(
+                        static_cast<AZ::s64>(frame.m_dispatches),
+                        static_cast<AZ::s64>(frame.m_events),
+                        static_cast<AZ::s64>(frame.m_broadcasts),
+                        static_cast<AZ::s64>(EstimateMicroseconds(frame.m_handlerTicks, frame)),
+                        static_cast<AZ::s64>(EstimateMicroseconds(frame.m_lockWaitTicks, frame)));
+                }
+            }
+#endif // EBUS_PROFILING
+        }
+
+        //=========================================================================
+        // GetTopBuses
+        //=========================================================================
+        void EBusProfiler::GetTopBuses(AZStd::vector<BusInfo>& buses, size_t count)
+        {
+            buses.clear();
+#if EBUS_PROFILING
+            EnvironmentVariable<Internal::EBusProfileRegistry> registry = Environment::FindVariable<Internal::EBusProfileRegistry>(Internal::EBusProfileRegistry::GetVariableName());
+            if (!registry)
+            {
+                return;
+            }
+
+            {
+                AZStd::lock_guard<AZStd::recursive_mutex> lock(registry->m_mutex);
+                const bool isFrame = registry->m_frameCount > 0;
+                for (const Internal::EBusProfileStats* stats = registry->m_first; stats; stats = stats->m_next)
+                {
+                    buses.emplace_back();
+                    EBusProfilerInternal::FillBusInfo(*stats, isFrame, buses.back());
+                }
+            }
+
+            AZStd::sort(buses.begin(), buses.end(), [](const BusInfo& lhs, const BusInfo& rhs)
+            {
+                return lhs.m_handlerTime != rhs.m_handlerTime ? lhs.m_handlerTime > rhs.m_handlerTime : lhs.m_dispatches > rhs.m_dispatches;
+            });
+            if (buses.size() > count)
+            {
+                buses.resize(count);
+            }
+#else
+            (void)count;
+#endif // EBUS_PROFILING
+        }
+    } // namespace Debug
+} // namespace AZ
+
+#endif // #ifndef AZ_UNITY_BUILD
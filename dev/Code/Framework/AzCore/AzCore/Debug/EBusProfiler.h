@@ -0,0 +1,63 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace Debug
+    {
+        /**
+         * Reports the EBus dispatch counters, which are only compiled in with EBUS_PROFILING (see
+         * AzCore/EBus/Internal/BusProfiler.h). Every bus counts its Event and Broadcast calls (per event, for the first
+         * few events used) and samples the time spent in handlers and waiting for the dispatch lock.
+         * EndFrame is called by the FrameProfilerComponent every tick; it turns the counters into per frame values and
+         * publishes them as "EBus" value registers, so they reach the FrameProfilerBus and the ProfilerDriller with the
+         * other registers. Values are: dispatches, events, broadcasts, handler time and lock wait time (microseconds).
+         */
+        class EBusProfiler
+        {
+        public:
+            struct EventInfo
+            {
+                const char* m_name;     ///< Signature of the dispatched callable
+                AZ::u64 m_calls;
+            };
+
+            struct BusInfo
+            {
+                const char* m_name = nullptr;
+                AZ::u64 m_dispatches = 0;       ///< All dispatches, including handler enumeration
+                AZ::u64 m_events = 0;           ///< Event calls (to an address)
+                AZ::u64 m_broadcasts = 0;       ///< Broadcast calls
+                AZ::u64 m_handlerTime = 0;      ///< Estimated time spent in handlers, in microseconds
+                AZ::u64 m_lockWaitTime = 0;     ///< Estimated time spent waiting for the dispatch lock, in microseconds
+                AZStd::fixed_vector<EventInfo, 8> m_topEvents;
+            };
+
+            /// Returns false if EBus profiling is compiled out
+            static bool IsEnabled();
+
+            /// Computes the values for the frame that ended and updates the profiler registers
+            static void EndFrame();
+
+            /**
+             * Fills buses with up to count buses that spent the most time in handlers during the last frame. If no frame
+             * was ended yet the totals since startup are used.
+             */
+            static void GetTopBuses(AZStd::vector<BusInfo>& buses, size_t count);
+        };
+    } // namespace Debug
+} // namespace AZ
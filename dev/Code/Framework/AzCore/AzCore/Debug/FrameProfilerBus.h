@@ -32,6 +32,15 @@ namespace AZ
 
             /// Called when the frame profiler has computed a new frame (even is there is no new data).
             virtual void OnFrameProfilerData(const FrameProfiler::ThreadDataArray& data) = 0;
+
+            /// Called when a frame took longer than the component's spike threshold. The data holds the history of
+            /// the last frames (see FrameProfilerComponent numFramesStored) so handlers can capture what led to the hitch.
+            virtual void OnFrameProfilerSpike(const FrameProfiler::ThreadDataArray& data, unsigned int frameId, float frameTimeMs)
+            {
+                (void)data;
+                (void)frameId;
+                (void)frameTimeMs;
+            }
         };
 
         typedef AZ::EBus<FrameProfilerEvents> FrameProfilerBus;
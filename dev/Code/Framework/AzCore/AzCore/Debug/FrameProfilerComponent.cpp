@@ -13,6 +13,7 @@
 
 #include <AzCore/Debug/FrameProfilerComponent.h>
 #include <AzCore/Debug/FrameProfilerBus.h>
+#include <AzCore/Debug/EBusProfiler.h>
 
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -31,6 +32,8 @@ namespace AZ
             : m_numFramesStored(2)
             , m_frameId(0)
             , m_pauseOnFrame(0)
+            , m_spikeThresholdMs(0.0f)
+            , m_lastSpikeFrameId(0)
             , m_currentThreadData(NULL)
         {
         }
@@ -81,11 +84,13 @@ namespace AZ
         //=========================================================================
         void FrameProfilerComponent::OnTick(float deltaTime, ScriptTimePoint time)
         {
-            (void)deltaTime;
             (void)time;
             ++m_frameId;
             AZ_Error("Profiler", m_frameId != m_pauseOnFrame, "Triggered user pause/error on this frame! Check FrameProfilerComponent pauseOnFrame value!");
 
+            // update the EBus registers for this frame (if EBUS_PROFILING is enabled)
+            EBusProfiler::EndFrame();
+
             if (!Profiler::IsReady())
             {
                 return;                       // we can't sample registers without profiler
@@ -123,6 +128,15 @@ namespace AZ
 
             // send an even to whomever cares
             EBUS_EVENT(FrameProfilerBus, OnFrameProfilerData, m_threads);
+
+            // report hitches, but only once per history length so consecutive slow frames don't resend the same data
+            const float frameTimeMs = deltaTime * 1000.0f;
+            if (m_spikeThresholdMs > 0.0f && frameTimeMs >= m_spikeThresholdMs &&
+                (m_lastSpikeFrameId == 0 || m_frameId - m_lastSpikeFrameId >= m_numFramesStored))
+            {
+                m_lastSpikeFrameId = m_frameId;
+                EBUS_EVENT(FrameProfilerBus, OnFrameProfilerSpike, m_threads, m_frameId, frameTimeMs);
+            }
         }
 
         int FrameProfilerComponent::GetTickOrder()
@@ -261,9 +275,10 @@ namespace AZ
             if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
             {
                 serializeContext->Class<FrameProfilerComponent, AZ::Component>()
-                    ->Version(1)
+                    ->Version(2)
                     ->Field("numFramesStored", &FrameProfilerComponent::m_numFramesStored)
                     ->Field("pauseOnFrame", &FrameProfilerComponent::m_pauseOnFrame)
+                    ->Field("spikeThresholdMs", &FrameProfilerComponent::m_spikeThresholdMs)
                     ;
 
                 if (EditContext* editContext = serializeContext->GetEditContext())
@@ -276,6 +291,8 @@ namespace AZ
                         ->DataElement(AZ::Edit::UIHandlers::SpinBox, &FrameProfilerComponent::m_numFramesStored, "Number of Frames", "How many frames we will keep with the RUNTIME buffers.")
                             ->Attribute(AZ::Edit::Attributes::Min, 1)
                         ->DataElement(AZ::Edit::UIHandlers::SpinBox, &FrameProfilerComponent::m_pauseOnFrame, "Pause on frame", "Paused the engine (debug break) on a specific frame. 0 means no pause!")
+                        ->DataElement(AZ::Edit::UIHandlers::Default, &FrameProfilerComponent::m_spikeThresholdMs, "Spike threshold (ms)", "Frames taking longer than this report the stored history to FrameProfilerBus listeners. 0 disables spike capture.")
+                            ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
                         ;
                 }
             }
@@ -38,6 +38,9 @@ namespace AZ
             FrameProfilerComponent();
             virtual ~FrameProfilerComponent();
 
+            /// Frames longer than this (in milliseconds) send FrameProfilerEvents::OnFrameProfilerSpike, 0 disables it.
+            void SetSpikeThreshold(float thresholdMs) { m_spikeThresholdMs = thresholdMs; }
+
         private:
             //////////////////////////////////////////////////////////////////////////
             // Component base
@@ -77,6 +80,9 @@ namespace AZ
 
             unsigned int    m_pauseOnFrame; ///< Allows you to specify a frame the code will pause onto.
 
+            float           m_spikeThresholdMs; ///< Frame time that triggers a spike capture, 0 to disable.
+            unsigned int    m_lastSpikeFrameId; ///< Frame of the last reported spike, used to avoid reporting overlapping histories.
+
 
             FrameProfiler::ThreadDataArray  m_threads;              ///< Array with samplers for all threads
             FrameProfiler::ThreadData*      m_currentThreadData;    ///< Cached pointer to the last accessed thread data.
@@ -189,6 +189,7 @@ namespace AZ
         // [3/23/2011]
         //=========================================================================
         DrillerOutputFileStream::DrillerOutputFileStream()
+            : m_isWriterQuitting(false)
         {
 #if defined(AZ_FILE_STREAM_COMPRESSION)
             m_zlib = azcreate(ZLib, (&AllocatorInstance<OSAllocator>::Get()), OSAllocator);
@@ -202,6 +203,10 @@ namespace AZ
         //=========================================================================
         DrillerOutputFileStream::~DrillerOutputFileStream()
         {
+            if (m_writerThread.joinable())
+            {
+                Close();
+            }
 #if defined(AZ_FILE_STREAM_COMPRESSION)
             azdestroy(m_zlib, OSAllocator);
 #endif
@@ -215,7 +220,7 @@ namespace AZ
         {
             if (IO::SystemFile::Open(fileName, mode, platformFlags))
             {
-                m_dataBuffer.reserve(100 * 1024);
+                m_dataBuffer.reserve(m_dataBufferSize);
 #if defined(AZ_FILE_STREAM_COMPRESSION)
                 //              // Enable optional: encode the file in the same format as the streamer so they are interchangeable
                 //              IO::CompressorHeader ch;
@@ -231,6 +236,10 @@ namespace AZ
                 //              zlibHdr.m_numSeekPoints = 0;
                 //              IO::SystemFile::Write(&zlibHdr,sizeof(zlibHdr));
 #endif
+                m_isWriterQuitting = false;
+                AZStd::thread_desc threadDesc;
+                threadDesc.m_name = "Driller file writer";
+                m_writerThread = AZStd::thread([this]() { WriterThread(); }, &threadDesc);
                 return true;
             }
             return false;
@@ -242,35 +251,23 @@ namespace AZ
         //=========================================================================
         void DrillerOutputFileStream::Close()
         {
-            unsigned int dataSizeInBuffer = static_cast<unsigned int>(m_dataBuffer.size());
+            if (m_writerThread.joinable())
             {
-#if defined(AZ_FILE_STREAM_COMPRESSION)
-                unsigned int minCompressBufferSize = m_zlib->GetMinCompressedBufferSize(dataSizeInBuffer);
-                if (m_compressionBuffer.size() < minCompressBufferSize) // grow compression buffer if needed
+                // let the writer thread finish all full buffers, we write the last one (and finish the compression)
                 {
-                    m_compressionBuffer.clear();
-                    m_compressionBuffer.resize(minCompressBufferSize);
+                    AZStd::lock_guard<AZStd::mutex> lock(m_writerMutex);
+                    m_isWriterQuitting = true;
                 }
-                unsigned int compressedSize;
-                do
-                {
-                    compressedSize = m_zlib->Compress(m_dataBuffer.data(), dataSizeInBuffer, m_compressionBuffer.data(), (unsigned)m_compressionBuffer.size(), ZLib::FT_FINISH);
-                    if (compressedSize)
-                    {
-                        IO::SystemFile::Write(m_compressionBuffer.data(), compressedSize);
-                    }
-                } while (compressedSize > 0);
-                m_zlib->ResetCompressor();
-#else
-                if (dataSizeInBuffer)
-                {
-                    IO::SystemFile::Write(m_dataBuffer.data(), m_dataBuffer.size());
-                }
-#endif
-                m_dataBuffer.clear();
+                m_writerCondition.notify_all();
+                m_writerThread.join();
             }
+
+            WriteToFile(m_dataBuffer.data(), static_cast<unsigned int>(m_dataBuffer.size()), true);
+            m_dataBuffer.clear();
+            m_freeBuffers.clear();
             IO::SystemFile::Close();
         }
+
         //=========================================================================
         // DrillerOutputFileStream::WriteBinary
         // [3/23/2011]
@@ -282,32 +279,126 @@ namespace AZ
             {
                 if (dataSizeInBuffer > 0)
                 {
-#if defined(AZ_FILE_STREAM_COMPRESSION)
-                    // we need to flush the data
-                    unsigned int dataToCompress = static_cast<unsigned int>(dataSizeInBuffer);
-                    unsigned int minCompressBufferSize = m_zlib->GetMinCompressedBufferSize(dataToCompress);
-                    if (m_compressionBuffer.size() < minCompressBufferSize) // grow compression buffer if needed
+                    if (m_writerThread.joinable())
                     {
-                        m_compressionBuffer.clear();
-                        m_compressionBuffer.resize(minCompressBufferSize);
+                        QueueDataBuffer();
                     }
-                    while (dataToCompress > 0)
+                    else
                     {
-                        unsigned int compressedSize = m_zlib->Compress(m_dataBuffer.data(), dataToCompress, m_compressionBuffer.data(), (unsigned)m_compressionBuffer.size());
-                        if (compressedSize)
-                        {
-                            IO::SystemFile::Write(m_compressionBuffer.data(), compressedSize);
-                        }
+                        WriteToFile(m_dataBuffer.data(), static_cast<unsigned int>(dataSizeInBuffer), false);
+                        m_dataBuffer.clear();
                     }
-#else
-                    IO::SystemFile::Write(m_dataBuffer.data(), m_dataBuffer.size());
-#endif
-                    m_dataBuffer.clear();
                 }
             }
             m_dataBuffer.insert(m_dataBuffer.end(), reinterpret_cast<const unsigned char*>(data), reinterpret_cast<const unsigned char*>(data) + dataSize);
         }
 
+        //=========================================================================
+        // DrillerOutputFileStream::QueueDataBuffer
+        //=========================================================================
+        void DrillerOutputFileStream::QueueDataBuffer()
+        {
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_writerMutex);
+                // don't let a long capture run out of memory if the disk can't keep up
+                m_writerCondition.wait(lock, [this]() { return m_pendingBuffers.size() < m_maxPendingBuffers; });
+
+                m_pendingBuffers.push_back(AZStd::move(m_dataBuffer));
+                if (!m_freeBuffers.empty())
+                {
+                    m_dataBuffer = AZStd::move(m_freeBuffers.back());
+                    m_freeBuffers.pop_back();
+                }
+                else
+                {
+                    m_dataBuffer = BufferType();
+                }
+            }
+            m_writerCondition.notify_all();
+
+            m_dataBuffer.clear();
+            m_dataBuffer.reserve(m_dataBufferSize);
+        }
+
+        //=========================================================================
+        // DrillerOutputFileStream::WriterThread
+        //=========================================================================
+        void DrillerOutputFileStream::WriterThread()
+        {
+            for (;;)
+            {
+                BufferType buffer;
+                {
+                    AZStd::unique_lock<AZStd::mutex> lock(m_writerMutex);
+                    m_writerCondition.wait(lock, [this]() { return !m_pendingBuffers.empty() || m_isWriterQuitting; });
+                    if (m_pendingBuffers.empty())
+                    {
+                        return; // quitting and everything is written
+                    }
+                    buffer = AZStd::move(m_pendingBuffers.front());
+                    m_pendingBuffers.erase(m_pendingBuffers.begin());
+                }
+                m_writerCondition.notify_all();
+
+                WriteToFile(buffer.data(), static_cast<unsigned int>(buffer.size()), false);
+
+                buffer.clear();
+                AZStd::lock_guard<AZStd::mutex> lock(m_writerMutex);
+                m_freeBuffers.push_back(AZStd::move(buffer));
+            }
+        }
+
+        //=========================================================================
+        // DrillerOutputFileStream::WriteToFile
+        //=========================================================================
+        void DrillerOutputFileStream::WriteToFile(const unsigned char* data, unsigned int dataSize, bool isLastData)
+        {
+#if defined(AZ_FILE_STREAM_COMPRESSION)
+            unsigned int minCompressBufferSize = m_zlib->GetMinCompressedBufferSize(dataSize);
+            if (m_compressionBuffer.size() < minCompressBufferSize) // grow compression buffer if needed
+            {
+                m_compressionBuffer.clear();
+                m_compressionBuffer.resize(minCompressBufferSize);
+            }
+            if (isLastData)
+            {
+                unsigned int compressedSize;
+                do
+                {
+                    unsigned int dataLeft = dataSize;
+                    compressedSize = m_zlib->Compress(data, dataLeft, m_compressionBuffer.data(), (unsigned)m_compressionBuffer.size(), ZLib::FT_FINISH);
+                    data += dataSize - dataLeft;
+                    dataSize = dataLeft;
+                    if (compressedSize)
+                    {
+                        IO::SystemFile::Write(m_compressionBuffer.data(), compressedSize);
+                    }
+                } while (compressedSize > 0);
+                m_zlib->ResetCompressor();
+            }
+            else
+            {
+                while (dataSize > 0)
+                {
+                    unsigned int dataLeft = dataSize;
+                    unsigned int compressedSize = m_zlib->Compress(data, dataLeft, m_compressionBuffer.data(), (unsigned)m_compressionBuffer.size());
+                    data += dataSize - dataLeft;
+                    dataSize = dataLeft;
+                    if (compressedSize)
+                    {
+                        IO::SystemFile::Write(m_compressionBuffer.data(), compressedSize);
+                    }
+                }
+            }
+#else
+            (void)isLastData;
+            if (dataSize)
+            {
+                IO::SystemFile::Write(data, dataSize);
+            }
+#endif
+        }
+
         //////////////////////////////////////////////////////////////////////////
         //////////////////////////////////////////////////////////////////////////
         // Driller file input stream
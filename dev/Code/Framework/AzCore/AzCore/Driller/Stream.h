@@ -22,6 +22,9 @@
 #include <AzCore/IO/SystemFile.h> // for the Driller direct file stream
 
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/conditional_variable.h>
 
 namespace AZ
 {
@@ -513,14 +516,34 @@ namespace AZ
          * IMPORTANT: We provide direct IO classes (instead trough Streamer), because the driller
          * framework should NOT use engine systems (for example imagine we are drilling the Streamer, using it to
          * write the drilled data will invalidate all the results as the streamer is unaware which data is driller data and which not)
+         * Full buffers are compressed and written to the file by a dedicated thread, so the drilled threads only pay for
+         * copying the data (unless they produce it faster than it can be written, then they wait for a free buffer).
          */
         class DrillerOutputFileStream
             : public IO::SystemFile
             , public DrillerOutputStream
         {
+            typedef vector<unsigned char>::type BufferType;
+
+            static const size_t m_dataBufferSize = 100 * 1024;
+            static const size_t m_maxPendingBuffers = 8;   ///< Max number of full buffers waiting for the writer thread.
+
             ZLib* m_zlib;
-            vector<unsigned char>::type m_compressionBuffer;
-            vector<unsigned char>::type m_dataBuffer;
+            BufferType m_compressionBuffer;     ///< Used by the writer thread only (until it's stopped).
+            BufferType m_dataBuffer;
+
+            AZStd::thread m_writerThread;
+            AZStd::mutex m_writerMutex;
+            AZStd::condition_variable m_writerCondition;
+            vector<BufferType>::type m_pendingBuffers;  ///< Full buffers in the order they have to be written.
+            vector<BufferType>::type m_freeBuffers;     ///< Written buffers we can reuse.
+            bool m_isWriterQuitting;
+
+            /// Passes the current data buffer to the writer thread and gets an empty one.
+            void QueueDataBuffer();
+            void WriterThread();
+            /// Compresses (if enabled) and writes data to the file.
+            void WriteToFile(const unsigned char* data, unsigned int dataSize, bool isLastData);
         public:
             AZ_CLASS_ALLOCATOR(DrillerOutputFileStream, OSAllocator, 0)
             DrillerOutputFileStream();
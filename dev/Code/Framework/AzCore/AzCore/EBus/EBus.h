@@ -25,6 +25,7 @@
 #include <AzCore/EBus/BusImpl.h>
 #include <AzCore/EBus/Results.h>
 #include <AzCore/EBus/Internal/Debug.h>
+#include <AzCore/EBus/Internal/EpochMutex.h>
 
  // Included for backwards compatibility purposes
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -205,6 +206,28 @@ namespace AZ
         */
         static const bool LocklessDispatch = false;
 
+        /**
+        * Determines whether dispatches are guarded by per thread epochs instead of the context mutex.
+        * Intended for buses that are broadcast to from many threads at once, but whose handlers rarely change.
+        * Event/Broadcast only mark the calling thread as dispatching and never take #MutexType, connect/disconnect
+        * take #MutexType and wait until no other thread is dispatching. Connect/disconnect made by a thread that is
+        * currently dispatching on the bus are deferred until that thread's outermost dispatch returns, so a handler
+        * that disconnects from within an event must not be destroyed before the event has returned.
+        * If #MutexType is NullMutex an AZStd::recursive_mutex is used. Can't be combined with #LocklessDispatch.
+        * By default, the standard policy is used, which locks around all dispatches
+        */
+        static const bool EpochDispatch = false;
+
+        /**
+        * Determines whether Broadcast/EnumerateHandlers call the handler directly.
+        * Only valid on buses with a single address and a single handler, such as system request buses. The handler
+        * pointer is read straight from the context, no lock is taken, no routers are run and the call isn't tracked on
+        * the callstack (IsInDispatch and GetCurrentBusId don't see it). The handler must be thread safe on its own when
+        * the bus is used from multiple threads, and must only connect/disconnect while no events are in flight.
+        * By default, the standard policy is used, which locks, routes and tracks all dispatches
+        */
+        static const bool SingleHandlerDirect = false;
+
         /**
          * Specifies where EBus data is stored.
          * This drives how many instances of this EBus exist at runtime.
@@ -622,19 +645,30 @@ namespace AZ
              * The reason why a recursive_mutex is used in this situation, is that specifying LocklessDispatch is implies that the EBus will be used across multiple threads
              * @see EBusTraits::LocklessDispatch
              */
-            using ContextMutexType = AZStd::conditional_t<BusTraits::LocklessDispatch && AZStd::is_same_v<MutexType, AZ::NullMutex>, AZStd::shared_mutex, MutexType>;
+            using ContextMutexType = AZStd::conditional_t<BusTraits::EpochDispatch,
+                Internal::EBusEpochMutex<AZStd::conditional_t<AZStd::is_same_v<MutexType, AZ::NullMutex>, AZStd::recursive_mutex, MutexType>, Context>,
+                AZStd::conditional_t<BusTraits::LocklessDispatch && AZStd::is_same_v<MutexType, AZ::NullMutex>, AZStd::shared_mutex, MutexType>>;
 
             /**
              * The scoped lock guard to use (either AZStd::scoped_lock<MutexType> or NullLockGuard<MutexType>
              * during broadcast/event dispatch.
              * @see EBusTraits::LocklessDispatch
              */
-            using DispatchLockGuard = AZStd::conditional_t<BusTraits::LocklessDispatch, Internal::NullLockGuard<ContextMutexType>, AZStd::scoped_lock<ContextMutexType>>;
+            using DispatchLockGuard = AZStd::conditional_t<BusTraits::EpochDispatch, Internal::EpochDispatchLockGuard<ContextMutexType>,
+                AZStd::conditional_t<BusTraits::LocklessDispatch, Internal::NullLockGuard<ContextMutexType>, AZStd::scoped_lock<ContextMutexType>>>;
+
+            static_assert(!BusTraits::EpochDispatch || !BusTraits::LocklessDispatch, "EpochDispatch and LocklessDispatch are mutually exclusive");
+            static_assert(!BusTraits::SingleHandlerDirect || (BusTraits::AddressPolicy == EBusAddressPolicy::Single && BusTraits::HandlerPolicy == EBusHandlerPolicy::Single),
+                "SingleHandlerDirect requires a single address and a single handler");
+            static_assert(!BusTraits::SingleHandlerDirect || !BusTraits::EpochDispatch, "SingleHandlerDirect doesn't dispatch through the context mutex, EpochDispatch has no effect");
 
             BusesContainer          m_buses;         ///< The actual bus container, which is a static map for each bus type.
             ContextMutexType        m_contextMutex;  ///< Mutex to control access to the around modifying the context
             QueuePolicy             m_queue;
             RouterPolicy            m_routing;
+#if EBUS_PROFILING
+            Internal::EBusProfileStats m_profileStats; ///< Dispatch counters and timings, see AZ::Debug::EBusProfiler
+#endif
 
             Context();
             Context(EBusEnvironment* environment);
@@ -690,6 +724,18 @@ namespace AZ
         static Context& GetOrCreateContext(bool trackCallstack=true);
 
         static bool IsInDispatch(Context* context = GetContext(false));
+
+        /// @cond EXCLUDE_DOCS
+        /**
+         * On EpochDispatch buses, queues change if the current thread is dispatching and returns true. Otherwise returns false
+         * and the caller makes the change immediately.
+         */
+        template <class Function>
+        static bool DeferConnectionChange(Context& context, const void* owner, Function&& change);
+
+        /// Drops the connection changes owner deferred, handlers call this on destruction
+        static void CancelDeferredConnectionChanges(const void* owner);
+        /// @endcond
         /// @cond EXCLUDE_DOCS
         struct RouterCallstackEntry
             : public CallstackEntry
@@ -962,6 +1008,10 @@ namespace AZ
     inline void EBus<Interface, Traits>::Connect(HandlerNode& handler, const BusIdType& id)
     {
         Context& context = GetOrCreateContext();
+        if (DeferConnectionChange(context, &handler, [&handler, id]() { Connect(handler, id); }))
+        {
+            return;
+        }
         // scoped lock guard in case of exception / other odd situation
         // Context mutex is separate from the Dispatch lock guard and therefore this is safe to lock this mutex while in the middle of a dispatch
         AZStd::scoped_lock<decltype(context.m_contextMutex)> lock(context.m_contextMutex);
@@ -994,6 +1044,10 @@ namespace AZ
         // To call Disconnect() from a message while being thread safe, you need to make sure the context.m_contextMutex is AZStd::recursive_mutex. Otherwise, a deadlock will occur.
         if (Context* context = GetContext())
         {
+            if (DeferConnectionChange(*context, &handler, [&handler]() { Disconnect(handler); }))
+            {
+                return;
+            }
             // scoped lock guard in case of exception / other odd situation
             AZStd::scoped_lock<decltype(context->m_contextMutex)> lock(context->m_contextMutex);
             DisconnectInternal(*context, handler);
@@ -1183,6 +1237,25 @@ namespace AZ
         return context != nullptr && context->m_dispatches > 0;
     }
 
+    //=========================================================================
+    // DeferConnectionChange
+    //=========================================================================
+    template<class Interface, class Traits>
+    template<class Function>
+    bool EBus<Interface, Traits>::DeferConnectionChange(Context& context, const void* owner, Function&& change)
+    {
+        return Internal::EBusConnectionDeferral<Traits::EpochDispatch>::template Defer<EBus>(context, owner, AZStd::forward<Function>(change));
+    }
+
+    //=========================================================================
+    // CancelDeferredConnectionChanges
+    //=========================================================================
+    template<class Interface, class Traits>
+    void EBus<Interface, Traits>::CancelDeferredConnectionChanges(const void* owner)
+    {
+        Internal::EBusConnectionDeferral<Traits::EpochDispatch>::template Cancel<EBus>(owner);
+    }
+
     //=========================================================================
     template<class Interface, class Traits>
     EBus<Interface, Traits>::RouterCallstackEntry::RouterCallstackEntry(Iterator it, const BusIdType* busId, bool isQueued, bool isReverse)
@@ -1223,6 +1296,10 @@ namespace AZ
         void NonIdHandler<Interface, Traits, ContainerType>::BusConnect()
         {
             typename BusType::Context& context = BusType::GetOrCreateContext();
+            if (BusType::DeferConnectionChange(context, this, [this]() { BusConnect(); }))
+            {
+                return;
+            }
             AZStd::scoped_lock<decltype(context.m_contextMutex)> contextLock(context.m_contextMutex);
             if (!BusIsConnected())
             {
@@ -1236,6 +1313,10 @@ namespace AZ
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
+                if (BusType::DeferConnectionChange(*context, this, [this]() { BusDisconnect(); }))
+                {
+                    return;
+                }
                 AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
                 if (BusIsConnected())
                 {
@@ -1250,6 +1331,10 @@ namespace AZ
         void IdHandler<Interface, Traits, ContainerType>::BusConnect(const IdType& id)
         {
             typename BusType::Context& context = BusType::GetOrCreateContext();
+            if (BusType::DeferConnectionChange(context, this, [this, id]() { BusConnect(id); }))
+            {
+                return;
+            }
             AZStd::scoped_lock<decltype(context.m_contextMutex)> contextLock(context.m_contextMutex);
             if (BusIsConnected())
             {
@@ -1270,6 +1355,10 @@ namespace AZ
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
+                if (BusType::DeferConnectionChange(*context, this, [this, id]() { BusDisconnect(id); }))
+                {
+                    return;
+                }
                 AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
                 if (BusIsConnectedId(id))
                 {
@@ -1282,6 +1371,10 @@ namespace AZ
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
+                if (BusType::DeferConnectionChange(*context, this, [this]() { BusDisconnect(); }))
+                {
+                    return;
+                }
                 AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
                 if (BusIsConnected())
                 {
@@ -1296,6 +1389,10 @@ namespace AZ
         void MultiHandler<Interface, Traits, ContainerType>::BusConnect(const IdType& id)
         {
             typename BusType::Context& context = BusType::GetOrCreateContext();
+            if (BusType::DeferConnectionChange(context, this, [this, id]() { BusConnect(id); }))
+            {
+                return;
+            }
             AZStd::scoped_lock<decltype(context.m_contextMutex)> contextLock(context.m_contextMutex);
             if (m_handlerNodes.find(id) == m_handlerNodes.end())
             {
@@ -1310,6 +1407,10 @@ namespace AZ
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
+                if (BusType::DeferConnectionChange(*context, this, [this, id]() { BusDisconnect(id); }))
+                {
+                    return;
+                }
                 AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
                 auto nodeIt = m_handlerNodes.find(id);
                 if (nodeIt != m_handlerNodes.end())
@@ -1328,6 +1429,10 @@ namespace AZ
             decltype(m_handlerNodes) handlerNodesToDisconnect;
             if (typename BusType::Context* context = BusType::GetContext())
             {
+                if (BusType::DeferConnectionChange(*context, this, [this]() { BusDisconnect(); }))
+                {
+                    return;
+                }
                 AZStd::scoped_lock<decltype(context->m_contextMutex)> contextLock(context->m_contextMutex);
                 handlerNodesToDisconnect = AZStd::move(m_handlerNodes);
 
@@ -1734,6 +1839,14 @@ namespace AZ
                 // executed often. If time is not important to you, you can always queue the connect/disconnect functions
                 // on the TickBus or another safe bus.
                 AZ_Assert(context.s_callstack->m_prev == nullptr, "Current we don't allow router connect while in a message on the bus!");
+#ifdef AZ_COMPILER_MSVC
+#pragma warning(push)
+#pragma warning(disable: 4127) // conditional expression is constant (for Traits::SingleHandlerDirect in asserts)
+#endif
+                AZ_Assert(!EBus::Traits::SingleHandlerDirect, "Routers are not run on SingleHandlerDirect buses!");
+#ifdef AZ_COMPILER_MSVC
+#pragma warning(pop)
+#endif
                 {
                     AZStd::scoped_lock<decltype(context.m_contextMutex)> lock(context.m_contextMutex);
                     context.m_routing.m_routers.insert(&m_routerNode);
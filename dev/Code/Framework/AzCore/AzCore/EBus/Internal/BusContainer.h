@@ -15,11 +15,13 @@
 #include <AzCore/std/function/invoke.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
+#include <AzCore/std/typetraits/conditional.h>
 
 #include <AzCore/EBus/Internal/CallstackEntry.h>
 #include <AzCore/EBus/Internal/Handlers.h>
 #include <AzCore/EBus/Internal/StoragePolicies.h>
 #include <AzCore/EBus/Internal/Debug.h>
+#include <AzCore/EBus/Internal/BusProfiler.h>
 
 #ifdef AZ_COMPILER_MSVC
 #pragma warning(push)
@@ -80,6 +82,7 @@ namespace AZ
 // Executes router handling in a generic way
 #define EBUS_DO_ROUTING(contextParam, id, isQueued, isReverse) \
     do {                                                                                        \
+        EBUS_PROFILE_EVENT(id, func);                                                           \
         auto& local_context = (contextParam);                                                   \
         if (local_context.m_routing.m_routers.size()) {                                         \
             if (local_context.m_routing.RouteEvent(id, isQueued, isReverse, func, args...)) {   \
@@ -88,6 +91,17 @@ namespace AZ
         }                                                                                       \
     } while(false)
 
+// Takes the dispatch lock of a context, profiled when EBUS_PROFILING is enabled
+#if EBUS_PROFILING
+#define EBUS_DISPATCH_LOCK_GUARD(contextParam)                                                  \
+    EBUS_PROFILE_DISPATCH(contextParam);                                                        \
+    typename Bus::Context::DispatchLockGuard lock((contextParam).m_contextMutex);               \
+    EBUS_PROFILE_LOCK_ACQUIRED()
+#else
+#define EBUS_DISPATCH_LOCK_GUARD(contextParam)                                                  \
+    typename Bus::Context::DispatchLockGuard lock((contextParam).m_contextMutex)
+#endif
+
         // Default impl, used when there are multiple addresses and multiple handlers
         template <typename Interface, typename Traits, EBusAddressPolicy addressPolicy = Traits::AddressPolicy, EBusHandlerPolicy handlerPolicy = Traits::HandlerPolicy>
         struct EBusContainer
@@ -123,7 +137,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -165,7 +179,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -207,7 +221,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -235,7 +249,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -265,7 +279,7 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
@@ -300,7 +314,7 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
@@ -335,7 +349,7 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
@@ -356,7 +370,7 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
@@ -377,7 +391,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -422,7 +436,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -467,7 +481,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -524,7 +538,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -583,7 +597,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
 
                         auto& addresses = context->m_buses.m_addresses;
                         auto addressIt = addresses.begin();
@@ -602,7 +616,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
 
                         auto& addresses = context->m_buses.m_addresses;
                         auto addressIt = addresses.find(id);
@@ -617,7 +631,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
 
                         if (ptr)
                         {
@@ -787,7 +801,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -804,7 +818,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -821,7 +835,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -838,7 +852,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -857,7 +871,7 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
@@ -875,7 +889,7 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
@@ -893,7 +907,7 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
@@ -911,7 +925,7 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
@@ -929,7 +943,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -967,7 +981,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -1005,7 +1019,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -1061,7 +1075,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -1119,7 +1133,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
 
                         auto& addresses = context->m_buses.m_addresses;
                         auto addressIt = addresses.begin();
@@ -1157,7 +1171,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
 
                         auto& addresses = context->m_buses.m_addresses;
                         auto addressIt = addresses.find(id);
@@ -1179,7 +1193,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
 
                         if (ptr)
                         {
@@ -1322,7 +1336,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1356,7 +1370,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1390,7 +1404,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1410,7 +1424,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1432,7 +1446,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
 
                         auto& handlers = context->m_buses.m_handlers;
                         auto handlerIt = handlers.begin();
@@ -1499,9 +1513,8 @@ namespace AZ
 
             EBusContainer() = default;
 
-            // EBus will extend this class to gain the Event*/Broadcast* functions
             template <typename Bus>
-            struct Dispatcher
+            struct LockedDispatcher
             {
                 // Broadcast family
                 template <typename Function, typename... ArgsT>
@@ -1509,7 +1522,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
@@ -1525,7 +1538,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
@@ -1541,7 +1554,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
@@ -1557,7 +1570,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto handler = context->m_buses.m_handler;
@@ -1575,7 +1588,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
-                        typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        EBUS_DISPATCH_LOCK_GUARD(*context);
 
                         auto handler = context->m_buses.m_handler;
                         if (handler)
@@ -1587,6 +1600,62 @@ namespace AZ
                 }
             };
 
+            // Used with EBusTraits::SingleHandlerDirect, calls straight into the handler without locking, routing or
+            // callstack tracking
+            template <typename Bus>
+            struct DirectDispatcher
+            {
+                // Broadcast family
+                template <typename Function, typename... ArgsT>
+                static void Broadcast(Function&& func, ArgsT&&... args)
+                {
+                    if (auto handler = GetHandler())
+                    {
+                        AZStd::invoke(AZStd::forward<Function>(func), handler, AZStd::forward<ArgsT>(args)...);
+                    }
+                }
+                template <typename Results, typename Function, typename... ArgsT>
+                static void BroadcastResult(Results& results, Function&& func, ArgsT&&... args)
+                {
+                    if (auto handler = GetHandler())
+                    {
+                        results = AZStd::invoke(AZStd::forward<Function>(func), handler, AZStd::forward<ArgsT>(args)...);
+                    }
+                }
+                template <typename Function, typename... ArgsT>
+                static void BroadcastReverse(Function&& func, ArgsT&&... args)
+                {
+                    Broadcast(AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+                }
+                template <typename Results, typename Function, typename... ArgsT>
+                static void BroadcastResultReverse(Results& results, Function&& func, ArgsT&&... args)
+                {
+                    BroadcastResult(results, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+                }
+
+                // Enumerate family
+                template <class Callback>
+                static void EnumerateHandlers(Callback&& callback)
+                {
+                    if (auto handler = GetHandler())
+                    {
+                        AZStd::invoke(callback, handler);
+                    }
+                }
+
+            private:
+                AZ_FORCE_INLINE static HandlerNode GetHandler()
+                {
+                    // No callstack tracking, so the thread local callstack root is never needed
+                    auto* context = Bus::GetContext(false);
+                    return context ? context->m_buses.m_handler : nullptr;
+                }
+            };
+
+            // EBus will extend this class to gain the Event*/Broadcast* functions
+            template <typename Bus>
+            using Dispatcher = AZStd::conditional_t<Traits::SingleHandlerDirect, DirectDispatcher<Bus>, LockedDispatcher<Bus>>;
+
             void Connect(HandlerNode& handler, const IdType&)
             {
                 AZ_Assert(!m_handler, "Bus already connected to!");
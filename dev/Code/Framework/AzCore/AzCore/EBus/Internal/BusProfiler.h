@@ -0,0 +1,273 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+// Set to 1 to count dispatches and sample handler and lock wait times for every EBus, see AZ::Debug::EBusProfiler
+#ifndef EBUS_PROFILING
+#define EBUS_PROFILING 0
+#endif
+
+#if EBUS_PROFILING
+
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/time.h>
+#include <AzCore/std/typetraits/decay.h>
+#include <AzCore/std/typetraits/is_member_function_pointer.h>
+
+namespace AZ
+{
+    namespace Debug
+    {
+        class ProfilerRegister;
+    }
+
+    namespace Internal
+    {
+        struct EBusProfileStats;
+
+        /**
+         * All profiled buses, shared across modules through the environment. The mutex is recursive as allocating while
+         * it's held can dispatch (and register) other buses, registering only prepends to the list.
+         */
+        struct EBusProfileRegistry
+        {
+            static const char* GetVariableName() { return "EBusProfileRegistry"; }
+
+            AZStd::recursive_mutex m_mutex;
+            EBusProfileStats* m_first = nullptr;
+            AZ::u64 m_frameCount = 0;
+        };
+
+        /**
+         * Counters for a single bus, owned by the bus context. All dispatches are counted (a single atomic add, in the
+         * slot of the dispatched event), one in SampleRate dispatches on a thread is timed to keep the clock reads
+         * off the common path. The frame values are only accessed by EBusProfiler under the registry mutex.
+         */
+        struct EBusProfileStats
+        {
+            enum
+            {
+                SampleRate = 16,
+                MaxEvents = 8,
+            };
+
+            struct EventStats
+            {
+                AZStd::atomic<AZ::u64> m_key{ 0 };
+                AZStd::atomic<const char*> m_name{ nullptr };
+                AZStd::atomic<AZ::u64> m_events{ 0 };
+                AZStd::atomic<AZ::u64> m_broadcasts{ 0 };
+                AZ::u64 m_lastCalls = 0;
+                AZ::u64 m_frameCalls = 0;
+            };
+
+            EBusProfileStats() = default;
+            EBusProfileStats(const EBusProfileStats&) = delete;
+            EBusProfileStats& operator=(const EBusProfileStats&) = delete;
+
+            ~EBusProfileStats()
+            {
+                if (m_registry)
+                {
+                    AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registry->m_mutex);
+                    EBusProfileStats** link = &m_registry->m_first;
+                    while (*link && *link != this)
+                    {
+                        link = &(*link)->m_next;
+                    }
+                    if (*link)
+                    {
+                        *link = m_next;
+                    }
+                }
+            }
+
+            void Register(const char* busName)
+            {
+                EnvironmentVariable<EBusProfileRegistry> registry = Environment::CreateVariable<EBusProfileRegistry>(EBusProfileRegistry::GetVariableName());
+
+                AZStd::lock_guard<AZStd::recursive_mutex> lock(registry->m_mutex);
+                if (!m_registry)
+                {
+                    m_busName = busName;
+                    m_next = registry->m_first;
+                    registry->m_first = this;
+                    m_registry = registry;
+                    m_isRegistered.store(true, AZStd::memory_order_release);
+                }
+            }
+
+            template <class Function>
+            static const char* GetEventName()
+            {
+                return AZ_FUNCTION_SIGNATURE;
+            }
+
+            // Member function pointers (the usual EBUS_EVENT case) are told apart by value, any other callable by type
+            template <class Function>
+            static AZ::u64 GetEventKey(const Function& func, AZStd::true_type /*isMemberFunctionPointer*/)
+            {
+                AZ::u64 words[(sizeof(Function) + sizeof(AZ::u64) - 1) / sizeof(AZ::u64)] = { 0 };
+                memcpy(words, &func, sizeof(Function));
+                AZ::u64 key = 0;
+                for (AZ::u64 word : words)
+                {
+                    key = (key ^ word) * 0x9E3779B97F4A7C15ull;
+                }
+                return key | 1;
+            }
+            template <class Function>
+            static AZ::u64 GetEventKey(const Function&, AZStd::false_type /*isMemberFunctionPointer*/)
+            {
+                static const char typeTag = 0;
+                return static_cast<AZ::u64>(reinterpret_cast<uintptr_t>(&typeTag)) | 1;
+            }
+
+            template <class Function>
+            void CountEvent(bool isBroadcast, const Function& func)
+            {
+                using FunctionType = AZStd::decay_t<Function>;
+                const AZ::u64 key = GetEventKey<FunctionType>(func, typename AZStd::is_member_function_pointer<FunctionType>::type());
+
+                for (unsigned int i = 0; i < MaxEvents; ++i)
+                {
+                    EventStats& event = m_eventStats[(key + i) % MaxEvents];
+                    AZ::u64 eventKey = event.m_key.load(AZStd::memory_order_acquire);
+                    if (eventKey == 0)
+                    {
+                        // the name (signature of the callable) is only used for reporting, a reader may see the key
+                        // a moment before it
+                        if (event.m_key.compare_exchange_strong(eventKey, key, AZStd::memory_order_acq_rel))
+                        {
+                            event.m_name.store(GetEventName<FunctionType>(), AZStd::memory_order_release);
+                            eventKey = key;
+                        }
+                    }
+                    if (eventKey == key)
+                    {
+                        (isBroadcast ? event.m_broadcasts : event.m_events).fetch_add(1, AZStd::memory_order_relaxed);
+                        return;
+                    }
+                }
+                (isBroadcast ? m_otherBroadcasts : m_otherEvents).fetch_add(1, AZStd::memory_order_relaxed);
+            }
+
+            const char* m_busName = nullptr;
+            AZStd::atomic_bool m_isRegistered{ false };
+            AZStd::atomic<AZ::u64> m_otherEvents{ 0 };     ///< Events that didn't fit in m_eventStats
+            AZStd::atomic<AZ::u64> m_otherBroadcasts{ 0 };
+            AZStd::atomic<AZ::u64> m_enumerations{ 0 };    ///< EnumerateHandlers calls
+            AZStd::atomic<AZ::u64> m_samples{ 0 };
+            AZStd::atomic<AZ::u64> m_handlerTicks{ 0 };
+            AZStd::atomic<AZ::u64> m_lockWaitTicks{ 0 };
+            EventStats m_eventStats[MaxEvents];
+
+            // Registry data
+            EBusProfileStats* m_next = nullptr;
+            EnvironmentVariable<EBusProfileRegistry> m_registry;
+
+            // Frame data
+            struct Values
+            {
+                AZ::u64 m_dispatches = 0;
+                AZ::u64 m_events = 0;
+                AZ::u64 m_broadcasts = 0;
+                AZ::u64 m_samples = 0;
+                AZ::u64 m_handlerTicks = 0;
+                AZ::u64 m_lockWaitTicks = 0;
+            };
+            Values m_last;
+            Values m_frame;
+            Debug::ProfilerRegister* m_register = nullptr;
+            AZ::u64 m_registerProfilerId = 0;
+        };
+
+        /**
+         * Declared for the duration of a dispatch (before the dispatch lock is taken, so the lock wait is measured too),
+         * see EBUS_DISPATCH_LOCK_GUARD.
+         */
+        class EBusProfileScope
+        {
+        public:
+            EBusProfileScope(EBusProfileStats& stats, const char* busName)
+                : m_stats(stats)
+            {
+                if (!m_stats.m_isRegistered.load(AZStd::memory_order_acquire))
+                {
+                    m_stats.Register(busName);
+                }
+
+                static AZ_THREAD_LOCAL unsigned int sampleCounter = 0;
+                m_isSampled = (++sampleCounter % EBusProfileStats::SampleRate) == 0;
+                if (m_isSampled)
+                {
+                    m_start = AZStd::GetTimeNowTicks();
+                }
+            }
+
+            ~EBusProfileScope()
+            {
+                if (!m_hasEvent)
+                {
+                    m_stats.m_enumerations.fetch_add(1, AZStd::memory_order_relaxed);
+                }
+
+                if (m_isSampled)
+                {
+                    const AZStd::sys_time_t end = AZStd::GetTimeNowTicks();
+                    m_stats.m_samples.fetch_add(1, AZStd::memory_order_relaxed);
+                    m_stats.m_lockWaitTicks.fetch_add(static_cast<AZ::u64>(m_acquired - m_start), AZStd::memory_order_relaxed);
+                    m_stats.m_handlerTicks.fetch_add(static_cast<AZ::u64>(end - m_acquired), AZStd::memory_order_relaxed);
+                }
+            }
+
+            void OnLockAcquired()
+            {
+                if (m_isSampled)
+                {
+                    m_acquired = AZStd::GetTimeNowTicks();
+                }
+            }
+
+            template <class Function>
+            void OnEvent(const void* id, const Function& func)
+            {
+                m_hasEvent = true;
+                m_stats.CountEvent(id == nullptr, func);
+            }
+
+            EBusProfileScope(const EBusProfileScope&) = delete;
+            EBusProfileScope& operator=(const EBusProfileScope&) = delete;
+
+        private:
+            EBusProfileStats& m_stats;
+            AZStd::sys_time_t m_start = 0;
+            AZStd::sys_time_t m_acquired = 0;
+            bool m_isSampled;
+            bool m_hasEvent = false;
+        };
+    }
+}
+
+#define EBUS_PROFILE_DISPATCH(contextParam) AZ::Internal::EBusProfileScope ebus_profileScope((contextParam).m_profileStats, Bus::GetName())
+#define EBUS_PROFILE_LOCK_ACQUIRED() ebus_profileScope.OnLockAcquired()
+#define EBUS_PROFILE_EVENT(id, func) ebus_profileScope.OnEvent(id, func)
+
+#else // EBUS_PROFILING
+
+#define EBUS_PROFILE_DISPATCH(contextParam)
+#define EBUS_PROFILE_LOCK_ACQUIRED()
+#define EBUS_PROFILE_EVENT(id, func)
+
+#endif // EBUS_PROFILING
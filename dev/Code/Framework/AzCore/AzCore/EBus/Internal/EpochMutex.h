@@ -0,0 +1,404 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/EBus/Environment.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /**
+         * Context mutex of buses with EBusTraits::EpochDispatch.
+         * lock()/unlock() guard connection changes: they take MutexType and then wait until no other thread is inside a
+         * dispatch. lock_shared()/unlock_shared() guard the dispatch itself, they only touch a record owned by the calling
+         * thread and wait only while a connection change is in progress. A thread that is dispatching can't wait for the
+         * other dispatching threads, so its connection changes are queued with Defer() and executed once its outermost
+         * dispatch returns.
+         * Tag makes the thread local record cache unique per bus.
+         */
+        template <class MutexType, class Tag>
+        class EBusEpochMutex
+        {
+        public:
+            EBusEpochMutex();
+            ~EBusEpochMutex();
+
+            EBusEpochMutex(const EBusEpochMutex&) = delete;
+            EBusEpochMutex& operator=(const EBusEpochMutex&) = delete;
+
+            void lock();
+            bool try_lock();
+            void unlock();
+
+            void lock_shared();
+            void unlock_shared();
+
+            /// True when the current thread is dispatching and doesn't hold the write lock, connection changes must be deferred
+            bool IsDispatchingOnCurrentThread();
+
+            /// Queues change to run when the current thread leaves its outermost dispatch
+            void Defer(const void* owner, AZStd::function<void()>&& change);
+
+            /// Drops all queued changes made by owner, called when handlers are destroyed
+            void CancelDeferred(const void* owner);
+
+        private:
+            struct alignas(64) ReaderRecord
+            {
+                AZStd::atomic_uint m_depth{ 0 };
+                AZStd::native_thread_id_type m_threadId;
+                ReaderRecord* m_next = nullptr;
+            };
+
+            struct ReaderCache
+            {
+                const EBusEpochMutex* m_mutex;
+                unsigned int m_instanceId;
+                ReaderRecord* m_record;
+            };
+
+            struct DeferredChange
+            {
+                AZStd::native_thread_id_type m_threadId;
+                const void* m_owner;
+                AZStd::function<void()> m_change;
+            };
+
+            ReaderRecord& GetReaderRecord();
+            void WaitForReaders(const ReaderRecord& self);
+            void ExecuteDeferred();
+
+            MutexType m_mutex;
+            const unsigned int m_instanceId; ///< The context can be destroyed and recreated at the same address, so the cache also checks the id
+            AZStd::atomic<ReaderRecord*> m_readers{ nullptr }; ///< One record per thread that ever dispatched, only ever grows
+            AZStd::atomic_bool m_isWriting{ false };
+            AZStd::atomic<AZStd::native_thread_id_type> m_writerThread{ AZStd::native_thread_invalid_id };
+            unsigned int m_writeDepth = 0; ///< Protected by m_mutex, MutexType may be recursive
+
+            AZStd::mutex m_deferredMutex;
+            AZStd::vector<DeferredChange, EBusEnvironmentAllocator> m_deferred;
+            AZStd::atomic_uint m_numDeferred{ 0 };
+
+            static AZ_THREAD_LOCAL ReaderCache s_readerCache;
+            static AZStd::atomic_uint s_nextInstanceId;
+        };
+
+        template <class MutexType, class Tag>
+        AZ_THREAD_LOCAL typename EBusEpochMutex<MutexType, Tag>::ReaderCache EBusEpochMutex<MutexType, Tag>::s_readerCache = { nullptr, 0, nullptr };
+
+        template <class MutexType, class Tag>
+        AZStd::atomic_uint EBusEpochMutex<MutexType, Tag>::s_nextInstanceId{ 1 };
+
+        // Lock guard used during dispatch on a bus which supports EpochDispatch.
+        template <class Lock>
+        struct EpochDispatchLockGuard
+        {
+            explicit EpochDispatchLockGuard(Lock& lock)
+                : m_lock(lock)
+            {
+                m_lock.lock_shared();
+            }
+            ~EpochDispatchLockGuard()
+            {
+                m_lock.unlock_shared();
+            }
+
+            EpochDispatchLockGuard(const EpochDispatchLockGuard&) = delete;
+            EpochDispatchLockGuard& operator=(const EpochDispatchLockGuard&) = delete;
+
+            Lock& m_lock;
+        };
+
+        // Routes connection changes made during a dispatch to the deferred queue on EpochDispatch buses, no-op otherwise.
+        template <bool IsEpochDispatch>
+        struct EBusConnectionDeferral
+        {
+            template <class Bus, class Function>
+            static bool Defer(typename Bus::Context&, const void*, Function&&)
+            {
+                return false;
+            }
+
+            template <class Bus>
+            static void Cancel(const void*)
+            {
+            }
+        };
+
+        template <>
+        struct EBusConnectionDeferral<true>
+        {
+            template <class Bus, class Function>
+            static bool Defer(typename Bus::Context& context, const void* owner, Function&& change)
+            {
+                if (!context.m_contextMutex.IsDispatchingOnCurrentThread())
+                {
+                    return false;
+                }
+                context.m_contextMutex.Defer(owner, AZStd::function<void()>(AZStd::forward<Function>(change)));
+                return true;
+            }
+
+            template <class Bus>
+            static void Cancel(const void* owner)
+            {
+                if (typename Bus::Context* context = Bus::GetContext(false))
+                {
+                    context->m_contextMutex.CancelDeferred(owner);
+                }
+            }
+        };
+
+        //=========================================================================
+        template <class MutexType, class Tag>
+        EBusEpochMutex<MutexType, Tag>::EBusEpochMutex()
+            : m_instanceId(s_nextInstanceId.fetch_add(1))
+        {
+        }
+
+        //=========================================================================
+        template <class MutexType, class Tag>
+        EBusEpochMutex<MutexType, Tag>::~EBusEpochMutex()
+        {
+            ReaderRecord* record = m_readers.load();
+            while (record)
+            {
+                ReaderRecord* next = record->m_next;
+                record->~ReaderRecord();
+                EBusEnvironmentAllocator().deallocate(record, sizeof(ReaderRecord), alignof(ReaderRecord));
+                record = next;
+            }
+        }
+
+        //=========================================================================
+        template <class MutexType, class Tag>
+        void EBusEpochMutex<MutexType, Tag>::lock()
+        {
+            m_mutex.lock();
+            if (m_writeDepth++ == 0)
+            {
+                m_writerThread.store(AZStd::this_thread::get_id().m_id);
+                m_isWriting.store(true);
+                WaitForReaders(GetReaderRecord());
+            }
+        }
+
+        //=========================================================================
+        template <class MutexType, class Tag>
+        bool EBusEpochMutex<MutexType, Tag>::try_lock()
+        {
+            if (!m_mutex.try_lock())
+            {
+                return false;
+            }
+            if (m_writeDepth == 0)
+            {
+                ReaderRecord& self = GetReaderRecord();
+                m_isWriting.store(true);
+                for (ReaderRecord* record = m_readers.load(); record; record = record->m_next)
+                {
+                    if (record != &self && record->m_depth.load() > 0)
+                    {
+                        m_isWriting.store(false);
+                        m_mutex.unlock();
+                        return false;
+                    }
+                }
+                m_writerThread.store(AZStd::this_thread::get_id().m_id);
+            }
+            ++m_writeDepth;
+            return true;
+        }
+
+        //=========================================================================
+        template <class MutexType, class Tag>
+        void EBusEpochMutex<MutexType, Tag>::unlock()
+        {
+            if (--m_writeDepth == 0)
+            {
+                m_writerThread.store(AZStd::native_thread_invalid_id);
+                m_isWriting.store(false, AZStd::memory_order_release);
+            }
+            m_mutex.unlock();
+        }
+
+        //=========================================================================
+        template <class MutexType, class Tag>
+        void EBusEpochMutex<MutexType, Tag>::lock_shared()
+        {
+            ReaderRecord& record = GetReaderRecord();
+
+            // Nested dispatches are already counted (a writer is waiting for them) and the writer may dispatch itself
+            if (record.m_depth.load(AZStd::memory_order_relaxed) > 0 || m_writerThread.load(AZStd::memory_order_relaxed) == record.m_threadId)
+            {
+                record.m_depth.fetch_add(1, AZStd::memory_order_relaxed);
+                return;
+            }
+
+            for (;;)
+            {
+                // Pairs with the store of m_isWriting in lock(), one of the two threads is guaranteed to see the other
+                record.m_depth.fetch_add(1);
+                if (!m_isWriting.load())
+                {
+                    return;
+                }
+
+                record.m_depth.fetch_sub(1);
+                while (m_isWriting.load(AZStd::memory_order_acquire))
+                {
+                    AZStd::this_thread::yield();
+                }
+            }
+        }
+
+        //=========================================================================
+        template <class MutexType, class Tag>
+        void EBusEpochMutex<MutexType, Tag>::unlock_shared()
+        {
+            ReaderRecord& record = GetReaderRecord();
+            if (record.m_depth.fetch_sub(1, AZStd::memory_order_release) == 1 && m_numDeferred.load(AZStd::memory_order_acquire) > 0)
+            {
+                ExecuteDeferred();
+            }
+        }
+
+        //=========================================================================
+        template <class MutexType, class Tag>
+        bool EBusEpochMutex<MutexType, Tag>::IsDispatchingOnCurrentThread()
+        {
+            ReaderRecord& record = GetReaderRecord();
+            return record.m_depth.load(AZStd::memory_order_relaxed) > 0 && m_writerThread.load(AZStd::memory_order_relaxed) != record.m_threadId;
+        }
+
+        //=========================================================================
+        template <class MutexType, class Tag>
+        void EBusEpochMutex<MutexType, Tag>::Defer(const void* owner, AZStd::function<void()>&& change)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_deferredMutex);
+            m_deferred.push_back({ AZStd::this_thread::get_id().m_id, owner, AZStd::move(change) });
+            m_numDeferred.fetch_add(1, AZStd::memory_order_release);
+        }
+
+        //=========================================================================
+        template <class MutexType, class Tag>
+        void EBusEpochMutex<MutexType, Tag>::CancelDeferred(const void* owner)
+        {
+            if (m_numDeferred.load(AZStd::memory_order_acquire) == 0)
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_deferredMutex);
+            for (size_t i = 0; i < m_deferred.size(); )
+            {
+                if (m_deferred[i].m_owner == owner)
+                {
+                    m_deferred.erase(m_deferred.begin() + i);
+                    m_numDeferred.fetch_sub(1, AZStd::memory_order_relaxed);
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+        }
+
+        //=========================================================================
+        template <class MutexType, class Tag>
+        typename EBusEpochMutex<MutexType, Tag>::ReaderRecord& EBusEpochMutex<MutexType, Tag>::GetReaderRecord()
+        {
+            if (s_readerCache.m_mutex == this && s_readerCache.m_instanceId == m_instanceId)
+            {
+                return *s_readerCache.m_record;
+            }
+
+            const AZStd::native_thread_id_type threadId = AZStd::this_thread::get_id().m_id;
+            ReaderRecord* head = m_readers.load(AZStd::memory_order_acquire);
+            ReaderRecord* record = head;
+            while (record && record->m_threadId != threadId)
+            {
+                record = record->m_next;
+            }
+
+            if (!record)
+            {
+                // Records are never removed, so pushing to the front only has to race with other pushes
+                record = new(EBusEnvironmentAllocator().allocate(sizeof(ReaderRecord), alignof(ReaderRecord))) ReaderRecord();
+                record->m_threadId = threadId;
+                record->m_next = head;
+                while (!m_readers.compare_exchange_weak(record->m_next, record))
+                {
+                }
+            }
+
+            s_readerCache.m_mutex = this;
+            s_readerCache.m_instanceId = m_instanceId;
+            s_readerCache.m_record = record;
+            return *record;
+        }
+
+        //=========================================================================
+        template <class MutexType, class Tag>
+        void EBusEpochMutex<MutexType, Tag>::WaitForReaders(const ReaderRecord& self)
+        {
+            for (ReaderRecord* record = m_readers.load(); record; record = record->m_next)
+            {
+                if (record == &self)
+                {
+                    continue;
+                }
+                while (record->m_depth.load() > 0)
+                {
+                    AZStd::this_thread::yield();
+                }
+            }
+        }
+
+        //=========================================================================
+        template <class MutexType, class Tag>
+        void EBusEpochMutex<MutexType, Tag>::ExecuteDeferred()
+        {
+            const AZStd::native_thread_id_type threadId = AZStd::this_thread::get_id().m_id;
+            AZStd::vector<AZStd::function<void()>, EBusEnvironmentAllocator> changes;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_deferredMutex);
+                for (size_t i = 0; i < m_deferred.size(); )
+                {
+                    if (m_deferred[i].m_threadId == threadId)
+                    {
+                        changes.push_back(AZStd::move(m_deferred[i].m_change));
+                        m_deferred.erase(m_deferred.begin() + i);
+                        m_numDeferred.fetch_sub(1, AZStd::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        ++i;
+                    }
+                }
+            }
+
+            // The thread is no longer dispatching, so these go through the regular (locking) connect/disconnect
+            for (auto& change : changes)
+            {
+                change();
+            }
+        }
+    }
+}
@@ -196,6 +196,7 @@ namespace AZ
 #ifdef AZ_COMPILER_MSVC
 #pragma warning(pop)
 #endif
+                BusType::CancelDeferredConnectionChanges(this);
                 if (BusIsConnected())
                 {
                     BusDisconnect();
@@ -290,6 +291,7 @@ namespace AZ
 #ifdef AZ_COMPILER_MSVC
 #pragma warning(pop)
 #endif
+                BusType::CancelDeferredConnectionChanges(this);
                 if (BusIsConnected())
                 {
                     BusDisconnect();
@@ -376,6 +378,7 @@ namespace AZ
 #pragma warning(pop)
 #endif
 
+                BusType::CancelDeferredConnectionChanges(this);
                 if (BusIsConnected())
                 {
                     BusDisconnect();
@@ -53,6 +53,7 @@ namespace AZ
             virtual void        Seek(OffsetType bytes, SeekMode mode);
             virtual SizeType    Read(SizeType bytes, void* oBuffer);
             virtual SizeType    Write(SizeType bytes, const void* iBuffer);
+            const void*         GetContiguousBuffer() const override        { return m_buffer->data(); }
             template<typename T>
             inline SizeType Write(const T* iBuffer)
             {
@@ -45,6 +45,8 @@ namespace AZ
             virtual bool        WriteSeekPoint(CompressorStream* stream)                                                          { (void)stream; return false; }
             /// Initializes Compressor for writing data.
             virtual bool        StartCompressor(CompressorStream* stream, int compressionLevel, SizeType autoSeekDataSize)        { (void)stream; (void)compressionLevel; (void)autoSeekDataSize; return false; }
+            /// Compress the stream with a dictionary known to the compressor, must be called after StartCompressor before any data is written.
+            virtual bool        SetDictionary(CompressorStream* stream, AZ::u32 dictionaryId)                                     { (void)stream; (void)dictionaryId; return false; }
             /// Called just before we close the stream. All compression data will be flushed and finalized. (You can't add data afterwards).
             virtual bool        Close(CompressorStream* stream) = 0;
         };
@@ -15,6 +15,7 @@
 #include <AzCore/IO/CompressorStream.h>
 #include <AzCore/IO/Compressor.h>
 #include <AzCore/IO/CompressorZLib.h>
+#include <AzCore/IO/CompressorZStd.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Memory/Memory.h>
 
@@ -238,6 +239,17 @@ bool CompressorStream::WriteCompressedSeekPoint()
     return m_compressorData && m_compressorData->m_compressor ? m_compressorData->m_compressor->WriteSeekPoint(this) : true;
 }
 
+/*!
+\brief Makes the compressor use a dictionary for this stream, only supported by some compressors (see CompressorZStd::RegisterDictionary)
+\detail Must be called after WriteCompressedHeader, before any data is written
+\param dictionaryId id of the dictionary to use, it must be known to the compressor when the stream is read back
+\return true if the compressor supports dictionaries and the dictionary is set
+*/
+bool CompressorStream::UseCompressionDictionary(AZ::u32 dictionaryId)
+{
+    return m_compressorData && m_compressorData->m_compressor ? m_compressorData->m_compressor->SetDictionary(this, dictionaryId) : false;
+}
+
 /*!
 \brief Retrieves the compressed length of the stream
 \return compressed length of the stream
@@ -288,6 +300,12 @@ Compressor* CompressorStream::CreateCompressor(AZ::u32 compressorId)
     {
         m_compressor.reset(aznew CompressorZLib);
     }
+#if !defined(AZCORE_EXCLUDE_ZSTANDARD)
+    else if (compressorId == CompressorZStd::TypeId())
+    {
+        m_compressor.reset(aznew CompressorZStd);
+    }
+#endif // #if !defined(AZCORE_EXCLUDE_ZSTANDARD)
     else
     {
         AZ_Assert(false, "Unable to create compressor with type id [0x%08x]", compressorId);
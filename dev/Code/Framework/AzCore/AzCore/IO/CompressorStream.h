@@ -65,6 +65,7 @@ namespace AZ
             GenericStream* GetWrappedStream() const;
             bool WriteCompressedHeader(AZ::u32 compressorId, int compressionLevel = 10, SizeType autoSeekDataSize = 0);
             bool WriteCompressedSeekPoint();
+            bool UseCompressionDictionary(AZ::u32 dictionaryId);
             SizeType GetCompressedLength() const; ///< Retrieves the length of the stream, which corresponds to the compressed length
             SizeType GetUncompressedLength() const; ///< Retrieves the length of the uncompressed data from the CompressorData structure
             
@@ -78,9 +78,9 @@ namespace AZ
 
         /**
          * ZLib compressor implementation.
-         * Note: As of now the CompressorZLib is the only supported compressor. We can move much of the
-         * caching functionality into the base Compressor class to be shared. Please do so when you have
-         * an actual need to implement another compressor, don't just copy and paste.
+         * Note: CompressorZStd uses the same stream layout and caching. We can move much of the
+         * caching functionality into the base Compressor class to be shared, please do so before
+         * adding a third compressor.
          */
         class CompressorZLib
             : public Compressor
@@ -0,0 +1,720 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef AZ_UNITY_BUILD
+
+#if !defined(AZCORE_EXCLUDE_ZSTANDARD)
+
+#include <AzCore/IO/CompressorZStd.h>
+#include <AzCore/IO/CompressorStream.h>
+#include <AzCore/IO/StreamerDrillerBus.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        namespace
+        {
+            /**
+             * Dictionaries registered for all zstd streams, shared by all modules through the environment.
+             * Only a handful of dictionaries are expected (one per kind of data), so a fixed array is enough.
+             */
+            class ZStdDictionaryTable
+            {
+            public:
+                struct Dictionary
+                {
+                    AZ::u32     m_id = 0;
+                    const void* m_data = nullptr;
+                    size_t      m_size = 0;
+                };
+
+                bool Add(AZ::u32 id, const void* data, size_t size)
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                    Dictionary* freeSlot = nullptr;
+                    for (Dictionary& dictionary : m_dictionaries)
+                    {
+                        if (dictionary.m_id == id)
+                        {
+                            AZ_Warning("IO", dictionary.m_data == data, "ZStd dictionary 0x%08x is already registered with different data!", id);
+                            return dictionary.m_data == data;
+                        }
+                        if (!freeSlot && dictionary.m_id == 0)
+                        {
+                            freeSlot = &dictionary;
+                        }
+                    }
+                    if (!freeSlot)
+                    {
+                        AZ_Warning("IO", false, "Too many ZStd dictionaries registered (max %d)!", static_cast<int>(MaxDictionaries));
+                        return false;
+                    }
+                    freeSlot->m_id = id;
+                    freeSlot->m_data = data;
+                    freeSlot->m_size = size;
+                    return true;
+                }
+
+                void Remove(AZ::u32 id)
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                    for (Dictionary& dictionary : m_dictionaries)
+                    {
+                        if (dictionary.m_id == id)
+                        {
+                            dictionary = Dictionary();
+                        }
+                    }
+                }
+
+                bool Find(AZ::u32 id, Dictionary& result)
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                    for (const Dictionary& dictionary : m_dictionaries)
+                    {
+                        if (id != 0 && dictionary.m_id == id)
+                        {
+                            result = dictionary;
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+            private:
+                static const size_t MaxDictionaries = 32;
+
+                Dictionary m_dictionaries[MaxDictionaries];
+                AZStd::mutex m_mutex;
+            };
+
+            ZStdDictionaryTable& GetDictionaryTable()
+            {
+                static EnvironmentVariable<ZStdDictionaryTable> s_dictionaryTable = Environment::CreateVariable<ZStdDictionaryTable>(AZ_CRC("AZ::IO::CompressorZStdDictionaries", 0x19ffdd93));
+                return *s_dictionaryTable;
+            }
+        } // namespace
+
+        //=========================================================================
+        // CompressorZStd
+        //=========================================================================
+        CompressorZStd::CompressorZStd(unsigned int decompressionCachePerStream, unsigned int dataBufferSize)
+            : m_lastReadStream(NULL)
+            , m_lastReadStreamOffset(0)
+            , m_lastReadStreamSize(0)
+            , m_compressedDataBuffer(NULL)
+            , m_compressedDataBufferSize(dataBufferSize)
+            , m_compressedDataBufferUseCount(0)
+            , m_decompressionCachePerStream(decompressionCachePerStream)
+        {
+            AZ_Assert((dataBufferSize % (32 * 1024)) == 0, "Data buffer size %d must be multiple of 32 KB!", dataBufferSize);
+            AZ_Assert(decompressionCachePerStream > 0 && (decompressionCachePerStream % (32 * 1024)) == 0, "Decompress cache size %d must be non zero multiple of 32 KB!", decompressionCachePerStream);
+        }
+
+        //=========================================================================
+        // ~CompressorZStd
+        //=========================================================================
+        CompressorZStd::~CompressorZStd()
+        {
+            AZ_Warning("IO", m_compressedDataBufferUseCount == 0, "CompressorZStd has it's data buffer still referenced, it means that %d compressed streams have NOT closed! Freeing data...", m_compressedDataBufferUseCount);
+            while (m_compressedDataBufferUseCount)
+            {
+                ReleaseDataBuffer();
+            }
+        }
+
+        //=========================================================================
+        // TypeId
+        //=========================================================================
+        AZ::u32     CompressorZStd::TypeId()
+        {
+            return AZ_CRC("ZStd", 0x72fd505e);
+        }
+
+        //=========================================================================
+        // RegisterDictionary
+        //=========================================================================
+        AZ::u32     CompressorZStd::RegisterDictionary(const void* dictionary, size_t dictionarySize)
+        {
+            AZ::u32 dictionaryId = ZStd::GetDictionaryId(dictionary, dictionarySize);
+            AZ_Warning("IO", dictionaryId != 0, "Only trained ZStd dictionaries (with an id) can be registered!");
+            if (dictionaryId != 0 && GetDictionaryTable().Add(dictionaryId, dictionary, dictionarySize))
+            {
+                return dictionaryId;
+            }
+            return 0;
+        }
+
+        //=========================================================================
+        // UnregisterDictionary
+        //=========================================================================
+        void        CompressorZStd::UnregisterDictionary(AZ::u32 dictionaryId)
+        {
+            GetDictionaryTable().Remove(dictionaryId);
+        }
+
+        //=========================================================================
+        // ReadHeaderAndData
+        //=========================================================================
+        bool        CompressorZStd::ReadHeaderAndData(CompressorStream* stream, AZ::u8* data, unsigned int dataSize)
+        {
+            if (stream->GetCompressorData() != NULL)  // we already have compressor data
+            {
+                return false;
+            }
+
+            // Read the ZStd header should be after the default compression header...
+            // We should not be in this function otherwise.
+            if (dataSize < sizeof(CompressorZStdHeader))
+            {
+                AZ_Assert(false, "We did not read enough data, we have only %d bytes left in the buffer and we need %d!", dataSize, sizeof(CompressorZStdHeader));
+                return false;
+            }
+
+            CompressorZStdHeader* hdr = reinterpret_cast<CompressorZStdHeader*>(data);
+#ifndef AZ_BIG_ENDIAN
+            AZStd::endian_swap(hdr->m_numSeekPoints);
+            AZStd::endian_swap(hdr->m_dictionaryId);
+#endif
+            AZ_Assert(hdr->m_numSeekPoints > 0, "We should have at least one seek point for the entire stream!");
+
+            ZStdDictionaryTable::Dictionary dictionary;
+            if (hdr->m_dictionaryId != 0 && !GetDictionaryTable().Find(hdr->m_dictionaryId, dictionary))
+            {
+                AZ_Warning("IO", false, "Stream %s is compressed with ZStd dictionary 0x%08x which is not registered!", stream->GetFilename(), hdr->m_dictionaryId);
+                return false;
+            }
+
+            // go the end of the file and read all sync points.
+            SizeType compressedFileEnd = stream->GetLength();
+            if (compressedFileEnd == 0)
+            {
+                return false;
+            }
+
+            AcquireDataBuffer();
+
+            CompressorZStdData* zstdData = aznew CompressorZStdData;
+            zstdData->m_compressor = this;
+            zstdData->m_uncompressedSize = 0;
+            zstdData->m_dictionaryId = hdr->m_dictionaryId;
+            zstdData->m_decompressNextOffset = sizeof(CompressorHeader) + sizeof(CompressorZStdHeader); // start after the headers
+
+            zstdData->m_seekPoints.resize(hdr->m_numSeekPoints);
+            SizeType dataToRead = sizeof(CompressorZStdSeekPoint) * static_cast<SizeType>(hdr->m_numSeekPoints);
+            SizeType seekPointOffset = compressedFileEnd - dataToRead;
+            AZ_Assert(seekPointOffset <= compressedFileEnd, "We have an invalid archive, this is impossible!");
+            GenericStream* baseStream = stream->GetWrappedStream();
+            if (baseStream->ReadAtOffset(dataToRead, zstdData->m_seekPoints.data(), seekPointOffset) != dataToRead)
+            {
+                delete zstdData;
+                ReleaseDataBuffer();
+                return false;
+            }
+#ifndef AZ_BIG_ENDIAN
+            for (size_t i = 0; i < zstdData->m_seekPoints.size(); ++i)
+            {
+                AZStd::endian_swap(zstdData->m_seekPoints[i].m_compressedOffset);
+                AZStd::endian_swap(zstdData->m_seekPoints[i].m_uncompressedOffset);
+            }
+#endif // !AZ_BIG_ENDIAN
+
+            zstdData->m_decompressedCache = reinterpret_cast<unsigned char*>(azmalloc(m_decompressionCachePerStream, m_CompressedDataBufferAlignment, AZ::SystemAllocator, "CompressorZStd"));
+
+            zstdData->m_decompressLastOffset = seekPointOffset; // set the start address of the seek points as the last valid read address for the compressed stream.
+
+            zstdData->m_zstd.StartDecompressor();
+            if (dictionary.m_data)
+            {
+                zstdData->m_zstd.SetDecompressorDictionary(dictionary.m_data, dictionary.m_size);
+            }
+
+            stream->SetCompressorData(zstdData);
+
+            return true;
+        }
+
+        //=========================================================================
+        // WriteHeaderAndData
+        //=========================================================================
+        bool CompressorZStd::WriteHeaderAndData(CompressorStream* stream)
+        {
+            if (!Compressor::WriteHeaderAndData(stream))
+            {
+                return false;
+            }
+
+            CompressorZStdData* compressorData = static_cast<CompressorZStdData*>(stream->GetCompressorData());
+            CompressorZStdHeader header;
+            header.m_numSeekPoints = static_cast<AZ::u32>(compressorData->m_seekPoints.size());
+            header.m_dictionaryId = compressorData->m_dictionaryId;
+#ifndef AZ_BIG_ENDIAN
+            AZStd::endian_swap(header.m_numSeekPoints);
+            AZStd::endian_swap(header.m_dictionaryId);
+#endif
+            GenericStream* baseStream = stream->GetWrappedStream();
+            if (baseStream->WriteAtOffset(sizeof(header), &header, sizeof(CompressorHeader)) == sizeof(header))
+            {
+                return true;
+            }
+
+            return false;
+        }
+
+        //=========================================================================
+        // FillFromDecompressCache
+        //=========================================================================
+        inline CompressorZStd::SizeType CompressorZStd::FillFromDecompressCache(CompressorZStdData* zstdData, void*& buffer, SizeType& byteSize, SizeType& offset)
+        {
+            SizeType firstOffsetInCache = zstdData->m_decompressedCacheOffset;
+            SizeType lastOffsetInCache = firstOffsetInCache + zstdData->m_decompressedCacheDataSize;
+            SizeType firstDataOffset = offset;
+            SizeType lastDataOffset = offset + byteSize;
+            SizeType numCopied = 0;
+            if (firstOffsetInCache < lastDataOffset && lastOffsetInCache > firstDataOffset)  // check if there is data in the cache
+            {
+                size_t copyOffsetStart = 0;
+                size_t copyOffsetEnd = zstdData->m_decompressedCacheDataSize;
+
+                size_t bufferCopyOffset = 0;
+
+                if (firstOffsetInCache < firstDataOffset)
+                {
+                    copyOffsetStart = static_cast<size_t>(firstDataOffset - firstOffsetInCache);
+                }
+                else
+                {
+                    bufferCopyOffset = static_cast<size_t>(firstOffsetInCache - firstDataOffset);
+                }
+
+                if (lastOffsetInCache >= lastDataOffset)
+                {
+                    copyOffsetEnd -= static_cast<size_t>(lastOffsetInCache - lastDataOffset);
+                }
+                else if (bufferCopyOffset > 0)  // the cache block is in the middle of the data, we can't use it (since we need to split buffer request into 2)
+                {
+                    return 0;
+                }
+
+                numCopied = copyOffsetEnd - copyOffsetStart;
+                memcpy(static_cast<char*>(buffer) + bufferCopyOffset, zstdData->m_decompressedCache + copyOffsetStart, static_cast<size_t>(numCopied));
+
+                // adjust pointers and sizes
+                byteSize -= numCopied;
+                if (bufferCopyOffset == 0)
+                {
+                    // copied in the start
+                    buffer = reinterpret_cast<char*>(buffer) + numCopied;
+                    offset += numCopied;
+                }
+            }
+
+            return numCopied;
+        }
+
+        //=========================================================================
+        // FillCompressedBuffer
+        //=========================================================================
+        inline CompressorZStd::SizeType CompressorZStd::FillCompressedBuffer(CompressorStream* stream)
+        {
+            CompressorZStdData* zstdData = static_cast<CompressorZStdData*>(stream->GetCompressorData());
+            SizeType dataFromBuffer = 0;
+            if (stream == m_lastReadStream)  // if the buffer is filled with data from the current stream, try to reuse
+            {
+                if (zstdData->m_decompressNextOffset > m_lastReadStreamOffset)
+                {
+                    SizeType offsetInCache = zstdData->m_decompressNextOffset - m_lastReadStreamOffset;
+                    if (offsetInCache < m_lastReadStreamSize)  // last check if there is data overlap
+                    {
+                        // copy the usable part at the start of the buffer
+                        SizeType toMove = m_lastReadStreamSize - offsetInCache;
+                        memmove(m_compressedDataBuffer, &m_compressedDataBuffer[static_cast<size_t>(offsetInCache)], static_cast<size_t>(toMove));
+                        dataFromBuffer += toMove;
+                    }
+                }
+            }
+
+            SizeType toReadFromStream = m_compressedDataBufferSize - dataFromBuffer;
+            SizeType readOffset = zstdData->m_decompressNextOffset + dataFromBuffer;
+            if (readOffset + toReadFromStream > zstdData->m_decompressLastOffset)
+            {
+                // don't read pass the end
+                AZ_Assert(readOffset <= zstdData->m_decompressLastOffset, "Read offset should always be before the end of stream!");
+                toReadFromStream = zstdData->m_decompressLastOffset - readOffset;
+            }
+
+            SizeType numReadFromStream = 0;
+            if (toReadFromStream)  // if we did not reuse the whole buffer, read some data from the stream
+            {
+                EBUS_DBG_EVENT(StreamerDrillerBus, OnCompressorRead, stream, toReadFromStream, readOffset);
+                GenericStream* baseStream = stream->GetWrappedStream();
+                numReadFromStream = baseStream->ReadAtOffset(toReadFromStream, &m_compressedDataBuffer[static_cast<size_t>(dataFromBuffer)], readOffset);
+                EBUS_DBG_EVENT(StreamerDrillerBus, OnCompressorReadComplete, stream, numReadFromStream);
+            }
+
+            // update what's actually in the read data buffer.
+            m_lastReadStream = stream;
+            m_lastReadStreamOffset = zstdData->m_decompressNextOffset;
+            m_lastReadStreamSize = dataFromBuffer + numReadFromStream;
+            return m_lastReadStreamSize;
+        }
+
+        /**
+         * Helper class to find the best seek point for a specific offset.
+         */
+        struct CompareZStdUpper
+        {
+            inline bool operator()(const AZ::u64& offset, const CompressorZStdSeekPoint& sp) const {return offset < sp.m_uncompressedOffset; }
+        };
+
+        //=========================================================================
+        // Read
+        //=========================================================================
+        CompressorZStd::SizeType    CompressorZStd::Read(CompressorStream* stream, SizeType byteSize, SizeType offset, void* buffer)
+        {
+            AZ_Assert(stream->GetCompressorData(), "This stream doesn't have decompression enabled!");
+            CompressorZStdData* zstdData = static_cast<CompressorZStdData*>(stream->GetCompressorData());
+            AZ_Assert(!zstdData->m_zstd.IsCompressorStarted(), "You can't read/decompress while writing a compressed stream %s!", stream->GetFilename());
+
+            // check if the request can be finished from the decompressed cache
+            SizeType numRead = FillFromDecompressCache(zstdData, buffer, byteSize, offset);
+            if (byteSize == 0)  // are we done
+            {
+                return numRead;
+            }
+
+            // find the best seek point for current offset
+            CompressorZStdData::SeekPointArray::iterator it = AZStd::upper_bound(zstdData->m_seekPoints.begin(), zstdData->m_seekPoints.end(), offset, CompareZStdUpper());
+            AZ_Assert(it != zstdData->m_seekPoints.begin(), "This should be impossible, we should always have a valid seek point at 0 offset!");
+            const CompressorZStdSeekPoint& bestSeekPoint = *(--it);  // get the previous (so it includes the current offset)
+
+            // if read is continuous continue with decompression
+            bool isJumpToSeekPoint = false;
+            SizeType lastOffsetInCache = zstdData->m_decompressedCacheOffset + zstdData->m_decompressedCacheDataSize;
+            if (bestSeekPoint.m_uncompressedOffset > lastOffsetInCache)     // if the best seek point is forward, jump forward to it.
+            {
+                isJumpToSeekPoint = true;
+            }
+            else if (offset < lastOffsetInCache)    // if the seek point is in the past and the requested offset is not in the cache jump back to it.
+            {
+                isJumpToSeekPoint = true;
+            }
+
+            if (isJumpToSeekPoint)
+            {
+                // frames are independent, all we need is to drop the current one
+                zstdData->m_decompressNextOffset = bestSeekPoint.m_compressedOffset;  // set next read point
+                zstdData->m_decompressedCacheOffset = bestSeekPoint.m_uncompressedOffset; // set uncompressed offset
+                zstdData->m_decompressedCacheDataSize = 0; // invalidate the cache
+                zstdData->m_zstd.ResetDecompressor();
+            }
+
+            // decompress and move forward until the request is done
+            while (byteSize > 0)
+            {
+                // fill buffer with compressed data, zstd may still have decompressed data buffered even when there is none left
+                SizeType compressedDataSize = FillCompressedBuffer(stream);
+                unsigned int processedCompressedData = 0;
+                bool isProgress = false;
+                while (byteSize > 0) // decompressed data either until we are done with the request (byteSize == 0) or we need to fill the compression buffer again.
+                {
+                    // if we have data in the cache move to the next offset, we always move forward by default.
+                    zstdData->m_decompressedCacheOffset += zstdData->m_decompressedCacheDataSize;
+
+                    // decompress in the cache buffer
+                    unsigned int availDecompressedCacheSize = m_decompressionCachePerStream; // reset buffer size
+                    unsigned int processed = zstdData->m_zstd.Decompress(&m_compressedDataBuffer[processedCompressedData], static_cast<unsigned int>(compressedDataSize) - processedCompressedData, zstdData->m_decompressedCache, availDecompressedCacheSize);
+                    zstdData->m_decompressedCacheDataSize = m_decompressionCachePerStream - availDecompressedCacheSize;
+                    processedCompressedData += processed;
+                    if (zstdData->m_zstd.IsDecompressorFailed())
+                    {
+                        // corrupted data, don't continue from here, the next read has to jump to a seek point.
+                        zstdData->m_decompressedCacheDataSize = 0;
+                        zstdData->m_decompressNextOffset = zstdData->m_decompressLastOffset;
+                        zstdData->m_zstd.ResetDecompressor();
+                        return numRead;
+                    }
+                    if (processed == 0 && zstdData->m_decompressedCacheDataSize == 0)
+                    {
+                        break; // we processed everything we could, load more compressed data.
+                    }
+                    isProgress = true;
+                    // fill what we can from the cache
+                    numRead += FillFromDecompressCache(zstdData, buffer, byteSize, offset);
+                }
+                // update next read position the the compressed stream
+                zstdData->m_decompressNextOffset += processedCompressedData;
+
+                if (!isProgress)
+                {
+                    return numRead; // we are done reading and obviously we did not managed to read all data
+                }
+            }
+            return numRead;
+        }
+
+        //=========================================================================
+        // Write
+        //=========================================================================
+        CompressorZStd::SizeType    CompressorZStd::Write(CompressorStream* stream, SizeType byteSize, const void* data, SizeType offset)
+        {
+            (void)offset;
+
+            AZ_Assert(stream && stream->GetCompressorData(), "This stream doesn't have compression enabled! Call Stream::WriteCompressed after you create the file!");
+            AZ_Assert(offset == SizeType(-1) || offset == stream->GetCurPos(), "We can write compressed data only at the end of the stream!");
+
+            m_lastReadStream = NULL; // invalidate last read position, otherwise m_dataBuffer will be corrupted (as we are about to write in it).
+
+            CompressorZStdData* zstdData = static_cast<CompressorZStdData*>(stream->GetCompressorData());
+            AZ_Assert(!zstdData->m_zstd.IsDecompressorStarted(), "You can't write while reading/decompressing a compressed stream!");
+
+            const u8* bytes = reinterpret_cast<const u8*>(data);
+            unsigned int dataToCompress = static_cast<unsigned int>(byteSize);
+            while (dataToCompress != 0)
+            {
+                unsigned int oldDataToCompress = dataToCompress;
+                unsigned int compressedSize = zstdData->m_zstd.Compress(bytes, dataToCompress, m_compressedDataBuffer, m_compressedDataBufferSize);
+                if (compressedSize)
+                {
+                    EBUS_DBG_EVENT(StreamerDrillerBus, OnCompressorWrite, stream, compressedSize, SizeType(-1));
+                    GenericStream* baseStream = stream->GetWrappedStream();
+                    SizeType numWritten = baseStream->Write(compressedSize, m_compressedDataBuffer);
+                    EBUS_DBG_EVENT(StreamerDrillerBus, OnCompressorWriteComplete, stream, numWritten);
+                    if (numWritten != compressedSize)
+                    {
+                        return numWritten; // error we could not write all data
+                    }
+                }
+                bytes += oldDataToCompress - dataToCompress;
+            }
+            zstdData->m_uncompressedSize += byteSize;
+
+            if (zstdData->m_autoSeekSize > 0)
+            {
+                // insert a seek point if needed (the first one is always at the start).
+                if ((zstdData->m_uncompressedSize - zstdData->m_seekPoints.back().m_uncompressedOffset) > zstdData->m_autoSeekSize)
+                {
+                    WriteSeekPoint(stream);
+                }
+            }
+            return byteSize;
+        }
+
+        //=========================================================================
+        // EndFrame
+        //=========================================================================
+        bool        CompressorZStd::EndFrame(CompressorStream* stream)
+        {
+            CompressorZStdData* zstdData = static_cast<CompressorZStdData*>(stream->GetCompressorData());
+
+            m_lastReadStream = NULL; // invalidate last read position, otherwise m_dataBuffer will be corrupted (as we are about to write in it).
+
+            do
+            {
+                unsigned int dataToCompress = 0;
+                unsigned int compressedSize = zstdData->m_zstd.Compress(NULL, dataToCompress, m_compressedDataBuffer, m_compressedDataBufferSize, ZStd::FT_END_FRAME);
+                if (compressedSize)
+                {
+                    EBUS_DBG_EVENT(StreamerDrillerBus, OnCompressorWrite, stream, compressedSize, SizeType(-1));
+                    GenericStream* baseStream = stream->GetWrappedStream();
+                    SizeType numWritten = baseStream->Write(compressedSize, m_compressedDataBuffer);
+                    EBUS_DBG_EVENT(StreamerDrillerBus, OnCompressorWriteComplete, stream, numWritten);
+                    if (numWritten != compressedSize)
+                    {
+                        return false; // error we wrote less than than requested!
+                    }
+                }
+            } while (zstdData->m_zstd.IsCompressorFlushPending());
+
+            return true;
+        }
+
+        //=========================================================================
+        // WriteSeekPoint
+        //=========================================================================
+        bool        CompressorZStd::WriteSeekPoint(CompressorStream* stream)
+        {
+            AZ_Assert(stream && stream->GetCompressorData(), "This stream doesn't have compression enabled! Call Stream::WriteCompressed after you create the file!");
+            CompressorZStdData* zstdData = static_cast<CompressorZStdData*>(stream->GetCompressorData());
+
+            if (zstdData->m_seekPoints.back().m_uncompressedOffset == zstdData->m_uncompressedSize)
+            {
+                return true; // nothing written since the last seek point, don't add an empty frame
+            }
+
+            if (!EndFrame(stream))
+            {
+                return false;
+            }
+
+            CompressorZStdSeekPoint sp;
+            sp.m_compressedOffset = stream->GetLength();
+            sp.m_uncompressedOffset = zstdData->m_uncompressedSize;
+            zstdData->m_seekPoints.push_back(sp);
+            return true;
+        }
+
+        //=========================================================================
+        // StartCompressor
+        //=========================================================================
+        bool        CompressorZStd::StartCompressor(CompressorStream* stream, int compressionLevel, SizeType autoSeekDataSize)
+        {
+            AZ_Assert(stream && stream->GetCompressorData() == NULL, "Stream has compressor already enabled!");
+
+            AcquireDataBuffer();
+
+            CompressorZStdData* zstdData = aznew CompressorZStdData;
+            zstdData->m_compressor = this;
+            zstdData->m_uncompressedSize = 0;
+            zstdData->m_autoSeekSize = autoSeekDataSize;
+            compressionLevel = AZ::GetClamp(compressionLevel, 1, 19); // remap to zstd levels (without the "ultra" ones that need a lot of memory to decompress)
+
+            zstdData->m_zstd.StartCompressor(compressionLevel);
+
+            stream->SetCompressorData(zstdData);
+
+            if (WriteHeaderAndData(stream))
+            {
+                // add the first and always present seek point at the start of the compressed stream
+                CompressorZStdSeekPoint sp;
+                sp.m_compressedOffset = sizeof(CompressorHeader) + sizeof(CompressorZStdHeader);
+                sp.m_uncompressedOffset = 0;
+                zstdData->m_seekPoints.push_back(sp);
+                return true;
+            }
+            return false;
+        }
+
+        //=========================================================================
+        // SetDictionary
+        //=========================================================================
+        bool        CompressorZStd::SetDictionary(CompressorStream* stream, AZ::u32 dictionaryId)
+        {
+            AZ_Assert(stream && stream->GetCompressorData(), "This stream doesn't have compression enabled! Call Stream::WriteCompressed after you create the file!");
+            CompressorZStdData* zstdData = static_cast<CompressorZStdData*>(stream->GetCompressorData());
+            if (!zstdData->m_zstd.IsCompressorStarted() || zstdData->m_uncompressedSize != 0)
+            {
+                AZ_Warning("IO", false, "The compression dictionary must be set before any data is written!");
+                return false;
+            }
+
+            ZStdDictionaryTable::Dictionary dictionary;
+            if (!GetDictionaryTable().Find(dictionaryId, dictionary))
+            {
+                AZ_Warning("IO", false, "ZStd dictionary 0x%08x is not registered!", dictionaryId);
+                return false;
+            }
+
+            if (!zstdData->m_zstd.SetCompressorDictionary(dictionary.m_data, dictionary.m_size))
+            {
+                return false;
+            }
+            zstdData->m_dictionaryId = dictionaryId;
+            return true;
+        }
+
+        //=========================================================================
+        // Close
+        //=========================================================================
+        bool CompressorZStd::Close(CompressorStream* stream)
+        {
+            AZ_Assert(stream->IsOpen(), "Stream is not open to be closed!");
+
+            CompressorZStdData* zstdData = static_cast<CompressorZStdData*>(stream->GetCompressorData());
+            GenericStream* baseStream = stream->GetWrappedStream();
+
+            bool result = true;
+            if (zstdData->m_zstd.IsCompressorStarted())
+            {
+                // flush all compressed data and end the last frame
+                if (zstdData->m_seekPoints.back().m_uncompressedOffset != zstdData->m_uncompressedSize)
+                {
+                    result = EndFrame(stream);
+                }
+
+                result = result && WriteHeaderAndData(stream);
+                if (result)
+                {
+                    // now write the seek points and the end of the file
+    #ifndef AZ_BIG_ENDIAN
+                    for (size_t i = 0; i < zstdData->m_seekPoints.size(); ++i)
+                    {
+                        AZStd::endian_swap(zstdData->m_seekPoints[i].m_compressedOffset);
+                        AZStd::endian_swap(zstdData->m_seekPoints[i].m_uncompressedOffset);
+                    }
+    #endif // !AZ_BIG_ENDIAN
+                    SizeType dataToWrite = zstdData->m_seekPoints.size() * sizeof(CompressorZStdSeekPoint);
+                    baseStream->Seek(0U, GenericStream::SeekMode::ST_SEEK_END);
+                    result = (baseStream->Write(dataToWrite, zstdData->m_seekPoints.data()) == dataToWrite);
+                }
+            }
+            else
+            {
+                if (m_lastReadStream == stream)
+                {
+                    m_lastReadStream = NULL; // invalidate the data in m_dataBuffer if it was from the current stream.
+                }
+            }
+
+            // if we have decompressor cache delete it
+            if (zstdData->m_decompressedCache)
+            {
+                azfree(zstdData->m_decompressedCache, AZ::SystemAllocator, m_decompressionCachePerStream, m_CompressedDataBufferAlignment);
+            }
+
+            ReleaseDataBuffer();
+
+            // last step reset stream compressor data.
+            stream->SetCompressorData(nullptr);
+            return result;
+        }
+
+        //=========================================================================
+        // AcquireDataBuffer
+        //=========================================================================
+        void CompressorZStd::AcquireDataBuffer()
+        {
+            if (m_compressedDataBuffer == NULL)
+            {
+                AZ_Assert(m_compressedDataBufferUseCount == 0, "Buffer usecount should be 0 if the buffer is NULL");
+                m_compressedDataBuffer = reinterpret_cast<unsigned char*>(azmalloc(m_compressedDataBufferSize, m_CompressedDataBufferAlignment, AZ::SystemAllocator, "CompressorZStd"));
+                m_lastReadStream = NULL; // reset the cache info in the m_dataBuffer
+            }
+            ++m_compressedDataBufferUseCount;
+        }
+
+        //=========================================================================
+        // ReleaseDataBuffer
+        //=========================================================================
+        void CompressorZStd::ReleaseDataBuffer()
+        {
+            --m_compressedDataBufferUseCount;
+            if (m_compressedDataBufferUseCount == 0)
+            {
+                AZ_Assert(m_compressedDataBuffer != NULL, "Invalid data buffer! We should have a non null pointer!");
+                azfree(m_compressedDataBuffer, AZ::SystemAllocator, m_compressedDataBufferSize, m_CompressedDataBufferAlignment);
+                m_compressedDataBuffer = NULL;
+                m_lastReadStream = NULL; // reset the cache info in the m_dataBuffer
+            }
+        }
+    }   // namespace IO
+}   // namespace AZ
+
+#endif // #if !defined(AZCORE_EXCLUDE_ZSTANDARD)
+
+#endif // #ifndef AZ_UNITY_BUILD
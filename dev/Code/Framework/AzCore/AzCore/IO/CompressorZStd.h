@@ -0,0 +1,154 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <AzCore/IO/Compressor.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Compression/zstd_compression.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        /**
+         * Header stored after the standard compression header.
+         * This structure is padded an aligned don't change members.
+         */
+        struct CompressorZStdHeader
+        {
+            AZ::u32         m_numSeekPoints;    ///< Number of seek points located at the end of the stream.
+            AZ::u32         m_dictionaryId;     ///< Id of the dictionary the stream was compressed with, 0 if none.
+        };
+
+        /**
+         * Seek points are stored at the end of the archive, we always have at least one at the start of the data.
+         * Each seek point is the start of an independent zstd frame, so seeking to them only resets the decompressor.
+         */
+        struct CompressorZStdSeekPoint
+        {
+            AZ::u64     m_compressedOffset;         ///< Location in the compressed stream of the frame start.
+            AZ::u64     m_uncompressedOffset;       ///< Location in the decompressed stream.
+        };
+
+        /**
+         * ZStd compressor per stream data.
+         */
+        class CompressorZStdData
+            : public CompressorData
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(CompressorZStdData, AZ::SystemAllocator, 0);
+
+            CompressorZStdData(IAllocator* zstdMemAllocator = 0)
+                : m_zstd(zstdMemAllocator)
+                , m_decompressNextOffset(0)
+                , m_decompressLastOffset(0)
+                , m_decompressedCache(0)
+                , m_decompressedCacheDataSize(0)
+                , m_decompressedCacheOffset(0)
+                , m_dictionaryId(0)
+            {}
+
+            ZStd                                    m_zstd;
+            AZ::u64                                 m_decompressNextOffset;     ///< Next offset in the compressed stream for decompressing.
+            AZ::u64                                 m_decompressLastOffset;     ///< Last valid offset in the compressed stream of the compressed data. Used only when we decompress.
+            unsigned char*                          m_decompressedCache;        ///< Decompressed stream cache.
+            unsigned int                            m_decompressedCacheDataSize;///< Number of valid bytes in the decompressed cache.
+            union
+            {
+                AZ::u64                             m_decompressedCacheOffset;  ///< Used when decompressing. Decompressed cache is the data offset in the uncompressed data stream.
+                AZ::u64                             m_autoSeekSize;             ///< Used when compressing to define auto seek point window.
+            };
+            AZ::u32                                 m_dictionaryId;             ///< Dictionary used for this stream, 0 if none.
+
+            typedef AZStd::vector<CompressorZStdSeekPoint> SeekPointArray;
+            SeekPointArray                          m_seekPoints;               ///< List of seek points for the archive, we must have at least one!
+        };
+
+        /**
+         * Zstandard compressor implementation. Same stream layout and caching as CompressorZLib, but every seek point
+         * starts a new zstd frame, which makes jumping to a seek point cheap, and decompression is a lot faster.
+         * Streams can be compressed with a dictionary, which helps a lot with small files that look alike. Dictionaries
+         * are registered once with RegisterDictionary (their zstd id is stored in the stream) and the compressed
+         * stream picks one with CompressorStream::UseCompressionDictionary.
+         */
+        class CompressorZStd
+            : public Compressor
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(CompressorZStd, AZ::SystemAllocator, 0);
+
+            /**
+             * \param decompressionCachePerStream cache of decompressed data stored per stream, the more streams you have open the more memory it will use.
+             * Unlike CompressorZLib the cache is required, it's where the data is decompressed to.
+             * \param dataBufferSize we have one compressor per device, only one stream can read/write at a time and the data buffer is shared for IO operations,
+             * the buffer is refCounted and existing only when we read/write compressed streams.
+             */
+            CompressorZStd(unsigned int decompressionCachePerStream = 64 * 1024, unsigned int dataBufferSize = 128 * 1024);
+
+            virtual ~CompressorZStd();
+
+            /// Return compressor type id.
+            static AZ::u32      TypeId();
+            virtual AZ::u32     GetTypeId() const           { return TypeId(); }
+            /// Called when we open a stream to Read for the first time. Data contains the first. dataSize <= m_maxHeaderSize.
+            virtual bool        ReadHeaderAndData(CompressorStream* stream, AZ::u8* data, unsigned int dataSize);
+            /// Called when we are about to start writing to a compressed stream.
+            virtual bool        WriteHeaderAndData(CompressorStream* stream);
+            /// Forwarded function from the Device when we from a compressed stream.
+            virtual SizeType    Read(CompressorStream* stream, SizeType byteSize, SizeType offset, void* buffer);
+            /// Forwarded function from the Device when we write to a compressed stream.
+            virtual SizeType    Write(CompressorStream* stream, SizeType byteSize, const void* data, SizeType offset = SizeType(-1));
+            /// Write a seek point (ends the current frame).
+            virtual bool        WriteSeekPoint(CompressorStream* stream);
+            /// Set auto seek point even dataSize bytes.
+            virtual bool        StartCompressor(CompressorStream* stream, int compressionLevel, SizeType autoSeekDataSize);
+            /// Compress the stream with a registered dictionary, must be called before any data is written.
+            virtual bool        SetDictionary(CompressorStream* stream, AZ::u32 dictionaryId);
+            /// Called just before we close the stream. All compression data will be flushed and finalized. (You can't add data afterwards).
+            virtual bool        Close(CompressorStream* stream);
+
+            /**
+             * Registers a trained zstd dictionary for all compressed streams, returns its id (0 if the data isn't a trained dictionary).
+             * The memory is not copied, it must stay valid until the dictionary is unregistered.
+             */
+            static AZ::u32      RegisterDictionary(const void* dictionary, size_t dictionarySize);
+            static void         UnregisterDictionary(AZ::u32 dictionaryId);
+
+        protected:
+
+            /// Read as much data as possible and adjust the parameters.
+            SizeType            FillFromDecompressCache(CompressorZStdData* zstdData, void*& buffer, SizeType& byteSize, SizeType& offset);
+            /// Read data from stream into the compression buffer.
+            SizeType            FillCompressedBuffer(CompressorStream* stream);
+            /// Compress everything buffered so far and end the current frame.
+            bool                EndFrame(CompressorStream* stream);
+            /// Acquire data buffer resource (if not created it will be allocated) and increment m_dataBufferUseCount.
+            void                AcquireDataBuffer();
+            /// Release data buffer resource, if m_dataBufferUseCount == 0 all memory will be freed.
+            void                ReleaseDataBuffer();
+
+            CompressorStream*   m_lastReadStream;                   ///< Cached last stream we read data into the m_dataBuffer.
+            SizeType            m_lastReadStreamOffset;             ///< Offset of the last read (in the m_dataBuffer) in the compressed stream.
+            SizeType            m_lastReadStreamSize;               ///< Size of the data in m_dataBuffer of the last read.
+
+            static const int    m_CompressedDataBufferAlignment = 16;         // Alignment for data buffer.
+            unsigned char*      m_compressedDataBuffer;                       ///< Data buffer used to read/write compressed data.
+            unsigned int        m_compressedDataBufferSize;                   ///< Data buffer size (stored so we can lazy allocate m_dataBuffer as we need).
+            unsigned int        m_compressedDataBufferUseCount;               ///< Data buffer use count.
+            unsigned int        m_decompressionCachePerStream;      ///< Cache per stream for each compressed stream stream in bytes.
+        };
+    }   // namespace IO
+}   // namespace AZ
@@ -80,12 +80,7 @@ namespace AZ
         Device::~Device()
         {
             DeviceRequestBus::Handler::BusDisconnect();
-            {
-                AZStd::lock_guard<AZStd::recursive_mutex> lock(m_lock);
-                m_shutdown_thread.store(true, AZStd::memory_order_release);
-                m_addReqCond.notify_all();
-            }
-            m_thread.join();
+            StopThread();
 
             // Delete all requests
             AZ_Warning("IO", m_pending.empty(), "We have %d pending request(s)! Cancelling...", m_pending.size());
@@ -429,21 +424,7 @@ namespace AZ
             m_currentStream = stream;
             m_currentStreamOffset = byteOffset + bytesTransfered;
 
-            // decompressor
-            if ((request->m_bytesProcessedStart + request->m_bytesProcessedEnd) == request->m_byteSize)
-            {
-                CompleteRequest(request);
-            }
-            else if (bytesTransfered != bytesToProcess)
-            {
-                CompleteRequest(request, Request::StateType::ST_ERROR_FAILED_IN_OPERATION);
-            }
-            else
-            {
-                // if we have not finished the current request push in back for reschedule
-                request->m_state = Request::StateType::ST_PENDING;
-                m_pending.push_back(*request);
-            }
+            FinishOperation(request, bytesToProcess, bytesTransfered);
         }
 
         /*!
@@ -488,6 +469,14 @@ namespace AZ
             m_currentStream = stream;
             m_currentStreamOffset = byteOffset + bytesTransfered;
 
+            FinishOperation(request, bytesToProcess, bytesTransfered);
+        }
+
+        //=========================================================================
+        // FinishOperation
+        //=========================================================================
+        void Device::FinishOperation(Request* request, SizeType bytesToProcess, SizeType bytesTransfered)
+        {
             // decompressor
             if ((request->m_bytesProcessedStart + request->m_bytesProcessedEnd) == request->m_byteSize)
             {
@@ -596,18 +585,7 @@ namespace AZ
                 {
                     continue;                   // if we have read cache hits during scheduling, there may be no more requests.
                 }
-                Request* request = &m_pending.front();
-                m_pending.pop_front();
-                request->m_state = Request::StateType::ST_IN_PROCESS;
-                if (request->m_operation == Request::OperationType::OT_READ)
-                {
-                    ReadStream(request);
-                }
-                else
-                {
-                    WriteStream(request);
-                }
-
+                ExecuteScheduledRequests();
 
                 // Pause the device thread if necessary.
                 if (m_threadSleepTimeMS > -1)
@@ -617,6 +595,40 @@ namespace AZ
             }
         }
 
+        //=========================================================================
+        // ExecuteScheduledRequests
+        //=========================================================================
+        void Device::ExecuteScheduledRequests()
+        {
+            Request* request = &m_pending.front();
+            m_pending.pop_front();
+            request->m_state = Request::StateType::ST_IN_PROCESS;
+            if (request->m_operation == Request::OperationType::OT_READ)
+            {
+                ReadStream(request);
+            }
+            else
+            {
+                WriteStream(request);
+            }
+        }
+
+        //=========================================================================
+        // StopThread
+        //=========================================================================
+        void Device::StopThread()
+        {
+            if (m_thread.joinable())
+            {
+                {
+                    AZStd::lock_guard<AZStd::recursive_mutex> lock(m_lock);
+                    m_shutdown_thread.store(true, AZStd::memory_order_release);
+                    m_addReqCond.notify_all();
+                }
+                m_thread.join();
+            }
+        }
+
         /*!
         \brief Opens a file using the fileName and flags parameter and registers the Virtual File Stream to this device
         \param[in] request Handle to request object which contains request priority, current state and callback
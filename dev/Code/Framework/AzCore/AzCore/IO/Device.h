@@ -138,9 +138,18 @@ namespace AZ
             /// Schedule all requests.
             virtual void            ScheduleRequests() = 0;
 
+            /// Executes the scheduled requests, by default only the one at the front of \ref m_pending.
+            virtual void            ExecuteScheduledRequests();
+
             /// Device thread "main" function"
             void ProcessRequests();
 
+            /// Stops the device thread. Devices that own resources used by the device thread should call this from their destructor.
+            void StopThread();
+
+            /// Completes the request if all its bytes are processed, fails it if the operation came short, otherwise puts it back in \ref m_pending.
+            void FinishOperation(Request* request, SizeType bytesToProcess, SizeType bytesTransfered);
+
             /// Complete a request. isLocked refers to m_lock mutex, if true we don't need to lock it inside the function.
             void CompleteRequest(Request* request, Request::StateType state = Request::StateType::ST_COMPLETED, bool isLocked = false);
 
@@ -53,6 +53,9 @@ namespace AZ
             virtual OpenMode    GetModeFlags() const { return OpenMode(); }
             virtual bool        ReOpen() { return true; }
             virtual void        Close() {}
+            //! Returns the start of the stream's data if the whole stream lives in one memory buffer, otherwise nullptr.
+            //! Readers can use it to reference the data in place instead of reading it into a copy.
+            virtual const void* GetContiguousBuffer() const { return nullptr; }
         protected:
             SizeType ComputeSeekPosition(OffsetType bytes, SeekMode mode);
         };
@@ -163,6 +166,7 @@ namespace AZ
             virtual SizeType    Read(SizeType bytes, void* oBuffer);
             virtual SizeType    Write(SizeType bytes, const void* iBuffer);
             virtual const void* GetData() const                             { return m_buffer; }
+            const void*         GetContiguousBuffer() const override        { return m_buffer; }
             virtual SizeType    GetCurPos() const                           { return m_curOffset; }
             virtual SizeType    GetLength() const                           { return m_curLen; }
 
@@ -0,0 +1,336 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef AZ_UNITY_BUILD
+
+#include <AzCore/IO/SolidStateDevice.h>
+#include <AzCore/IO/Streamer.h>
+#include <AzCore/IO/StreamerDrillerBus.h>
+#include <AzCore/IO/VirtualStream.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        namespace
+        {
+            // bounds a batch, so newly added requests with an earlier deadline don't wait on a long run of reads of one stream
+            const size_t s_maxReadsPerReader = 4;
+        }
+
+        //=========================================================================
+        // SolidStateDevice
+        //=========================================================================
+        SolidStateDevice::SolidStateDevice(const AZStd::string& name, FileIOBase* ioBase, unsigned int queueDepth, const AZStd::thread_desc* threadDesc, int threadSleepTimeMS)
+            : Device(name, ioBase, threadDesc, threadSleepTimeMS)
+            , m_queueDepth(queueDepth > 0 ? queueDepth : 1)
+            , m_nextGroup(0)
+            , m_shutdownReaders(false)
+        {
+            m_type = DT_FLASH_DRIVE;
+
+            m_sectorSize = 4096;
+            m_eccBlockSize = 4096;
+            m_readBytesPerMicrosecond = 500.0 * 1024.0 * 1024.0 / 1000000.0 /* to microsecond */;
+            m_writeBytesPerMicrosecond = 250.0 * 1024.0 * 1024.0 / 1000000.0 /* to microsecond */;
+
+            // No read cache, its blocks are there to read ahead and save seeks. On flash the reads go straight into the
+            // request buffers and are split in larger operations.
+            m_maxOperationSize = 256 * 1024;
+
+            m_reads.reserve(m_queueDepth * s_maxReadsPerReader);
+            m_groupStarts.reserve(m_queueDepth + 1);
+
+            AZStd::thread_desc readerDesc;
+            if (threadDesc)
+            {
+                readerDesc = *threadDesc;
+            }
+            readerDesc.m_name = "AZ::SSD stream reader";
+
+            // the device thread reads too
+            m_readers.reserve(m_queueDepth - 1);
+            for (unsigned int i = 1; i < m_queueDepth; ++i)
+            {
+                m_readers.emplace_back(AZStd::bind(&SolidStateDevice::ProcessReads, this), &readerDesc);
+            }
+        }
+
+        //=========================================================================
+        // ~SolidStateDevice
+        //=========================================================================
+        SolidStateDevice::~SolidStateDevice()
+        {
+            // the device thread hands reads to the readers, so it has to stop first
+            StopThread();
+
+            m_shutdownReaders.store(true, AZStd::memory_order_release);
+            m_readsReady.release(static_cast<unsigned int>(m_readers.size()));
+            for (AZStd::thread& reader : m_readers)
+            {
+                reader.join();
+            }
+        }
+
+        //=========================================================================
+        // SortOnDeadline
+        //=========================================================================
+        bool SolidStateDevice::SortOnDeadline(Request& left, Request& right)
+        {
+            // writes go first and keep their order, the writes to a stream must be executed in order
+            if (left.m_operation != right.m_operation)
+            {
+                return left.m_operation == Request::OperationType::OT_WRITE;
+            }
+            if (left.m_operation == Request::OperationType::OT_WRITE)
+            {
+                return false;
+            }
+
+            // without seeks earliest deadline first is the order that misses the fewest deadlines
+            if (left.m_deadline != right.m_deadline)
+            {
+                return left.m_deadline < right.m_deadline;
+            }
+            return left.m_priority < right.m_priority;
+        }
+
+        //=========================================================================
+        // ScheduleRequests
+        //=========================================================================
+        void SolidStateDevice::ScheduleRequests()
+        {
+            // sorted on every pass, so deadlines changed by Streamer::RescheduleRequest apply to the next batch
+            m_pending.sort(&SolidStateDevice::SortOnDeadline);
+
+            // the drive works through the queue at its bandwidth whatever the order, so a request completes when all
+            // requests ahead of it are transferred
+            AZStd::chrono::system_clock::time_point now = AZStd::chrono::system_clock::now();
+            double microsecondsAhead = 0.0;
+            for (Request& r : m_pending)
+            {
+                SizeType byteSize = r.m_byteSize - (r.m_bytesProcessedStart + r.m_bytesProcessedEnd);
+                microsecondsAhead += double(byteSize) / (r.m_operation == Request::OperationType::OT_READ ? m_readBytesPerMicrosecond : m_writeBytesPerMicrosecond);
+                r.m_estimatedCompletion = now + AZStd::chrono::microseconds(AZStd::sys_time_t(microsecondsAhead));
+            }
+        }
+
+        //=========================================================================
+        // ExecuteScheduledRequests
+        //=========================================================================
+        void SolidStateDevice::ExecuteScheduledRequests()
+        {
+            if (m_pending.front().m_operation == Request::OperationType::OT_WRITE)
+            {
+                Device::ExecuteScheduledRequests();
+                return;
+            }
+
+            GatherReads();
+            if (m_reads.empty())
+            {
+                m_groupStarts.clear();
+                return; // the streams failed to open
+            }
+
+            const size_t groupCount = m_groupStarts.size() - 1;
+            const size_t readerCount = AZStd::GetMin(m_readers.size(), groupCount - 1);
+            m_nextGroup.store(0, AZStd::memory_order_relaxed);
+            if (readerCount > 0)
+            {
+                m_readsReady.release(static_cast<unsigned int>(readerCount));
+            }
+            ReadGroups();
+            for (size_t i = 0; i < readerCount; ++i)
+            {
+                m_readsDone.acquire();
+            }
+
+            for (ScheduledRead& read : m_reads)
+            {
+                Request* request = read.m_request;
+                EBUS_DBG_EVENT(StreamerDrillerBus, OnRead, request->m_stream, read.m_bytesToProcess, read.m_byteOffset);
+                EBUS_DBG_EVENT(StreamerDrillerBus, OnReadComplete, request->m_stream, read.m_bytesTransfered);
+
+                request->m_bytesProcessedStart += read.m_bytesTransfered;
+
+                // update current stream
+                m_currentStream = request->m_stream;
+                m_currentStreamOffset = read.m_byteOffset + read.m_bytesTransfered;
+
+                FinishOperation(request, read.m_bytesToProcess, read.m_bytesTransfered);
+            }
+
+            m_reads.clear();
+            m_groupStarts.clear();
+        }
+
+        //=========================================================================
+        // GatherReads
+        //=========================================================================
+        void SolidStateDevice::GatherReads()
+        {
+            // Each group is read by one reader. All compressed streams share a group, their compressor has a single
+            // data buffer for all streams.
+            const size_t invalidGroup = size_t(-1);
+            size_t compressedGroup = invalidGroup;
+            size_t numGroups = 0;
+            m_batchStreams.clear();
+
+            const SizeType maxLimitedStreams = GetStreamer()->GetMaxNumOpenLimitedStream();
+            SizeType numLimitedStreams = 0;
+
+            const size_t maxReads = m_queueDepth * s_maxReadsPerReader;
+            for (Request::ListType::iterator iter = m_pending.begin(); iter != m_pending.end() && m_reads.size() < maxReads; )
+            {
+                Request& request = *iter;
+                if (request.m_operation != Request::OperationType::OT_READ)
+                {
+                    break; // writes are executed on their own
+                }
+
+                VirtualStream* stream = request.m_stream;
+                auto batchStreamIter = AZStd::find_if(m_batchStreams.begin(), m_batchStreams.end(), [stream](const BatchStream& batchStream) { return batchStream.m_stream == stream; });
+                size_t group;
+                if (batchStreamIter != m_batchStreams.end())
+                {
+                    group = batchStreamIter->m_group;
+                }
+                else
+                {
+                    const bool isNewGroup = !stream->IsCompressed() || compressedGroup == invalidGroup;
+                    if (isNewGroup && numGroups == m_queueDepth)
+                    {
+                        ++iter;
+                        continue;
+                    }
+
+                    // opening a limited stream closes the least recently used one, so a batch can't use more limited
+                    // streams than can be open at once
+                    const bool isLimited = maxLimitedStreams > 0 && IsLimitedStream(stream);
+                    if (isLimited && numLimitedStreams == maxLimitedStreams)
+                    {
+                        ++iter;
+                        continue;
+                    }
+
+                    if (!OpenStream(stream))
+                    {
+                        iter = m_pending.erase(iter);
+                        CompleteRequest(&request, Request::StateType::ST_ERROR_FAILED_TO_OPEN_STREAM);
+                        continue;
+                    }
+                    numLimitedStreams += isLimited ? 1 : 0;
+
+                    if (isNewGroup)
+                    {
+                        group = numGroups++;
+                        if (stream->IsCompressed())
+                        {
+                            compressedGroup = group;
+                        }
+                    }
+                    else
+                    {
+                        group = compressedGroup;
+                    }
+
+                    BatchStream batchStream;
+                    batchStream.m_stream = stream;
+                    batchStream.m_group = group;
+                    m_batchStreams.push_back(batchStream);
+                }
+
+                iter = m_pending.erase(iter);
+                request.m_state = Request::StateType::ST_IN_PROCESS;
+
+                ScheduledRead read;
+                read.m_request = &request;
+                read.m_group = group;
+                read.m_buffer = static_cast<char*>(request.m_buffer) + request.m_bytesProcessedStart;
+                read.m_byteOffset = request.GetStreamByteOffset() + request.m_bytesProcessedStart;
+                read.m_bytesToProcess = AZStd::GetMin(request.m_byteSize - (request.m_bytesProcessedStart + request.m_bytesProcessedEnd), m_maxOperationSize);
+                read.m_bytesTransfered = 0;
+                m_reads.push_back(read);
+            }
+
+            // in offset order within a stream, so they reach the drive as a sequential read
+            AZStd::sort(m_reads.begin(), m_reads.end(), [](const ScheduledRead& left, const ScheduledRead& right)
+            {
+                if (left.m_group != right.m_group)
+                {
+                    return left.m_group < right.m_group;
+                }
+                if (left.m_request->m_stream != right.m_request->m_stream)
+                {
+                    return left.m_request->m_stream < right.m_request->m_stream;
+                }
+                return left.m_byteOffset < right.m_byteOffset;
+            });
+
+            for (size_t i = 0; i < m_reads.size(); ++i)
+            {
+                if (i == 0 || m_reads[i].m_group != m_reads[i - 1].m_group)
+                {
+                    m_groupStarts.push_back(i);
+                }
+            }
+            m_groupStarts.push_back(m_reads.size());
+        }
+
+        //=========================================================================
+        // ReadGroups
+        //=========================================================================
+        void SolidStateDevice::ReadGroups()
+        {
+            const size_t groupCount = m_groupStarts.size() - 1;
+            for (size_t group = m_nextGroup.fetch_add(1); group < groupCount; group = m_nextGroup.fetch_add(1))
+            {
+                for (size_t i = m_groupStarts[group]; i < m_groupStarts[group + 1]; ++i)
+                {
+                    ScheduledRead& read = m_reads[i];
+                    read.m_bytesTransfered = read.m_request->m_stream->ReadAtOffset(read.m_bytesToProcess, read.m_buffer, read.m_byteOffset); // read raw
+                }
+            }
+        }
+
+        //=========================================================================
+        // ProcessReads
+        //=========================================================================
+        void SolidStateDevice::ProcessReads()
+        {
+            for (;;)
+            {
+                m_readsReady.acquire();
+                if (m_shutdownReaders.load(AZStd::memory_order_acquire))
+                {
+                    break;
+                }
+                ReadGroups();
+                m_readsDone.release();
+            }
+        }
+
+        //=========================================================================
+        // IsLimitedStream
+        //=========================================================================
+        bool SolidStateDevice::IsLimitedStream(GenericStream* stream)
+        {
+            StreamID id = Uuid::CreateName(stream->GetFilename());
+            AZStd::lock_guard<decltype(m_lock)> lock(m_lock);
+            auto streamDataIter = m_streams.find(id);
+            return streamDataIter != m_streams.end() && streamDataIter->second->m_isLimited;
+        }
+    } // IO
+} // AZ
+
+#endif // #ifndef AZ_UNITY_BUILD
@@ -0,0 +1,93 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/IO/Device.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/semaphore.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/Memory/Memory.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        /**
+         * Device for flash drives (SATA and NVMe SSDs). There is no seek cost to schedule around, so requests are ordered on
+         * their deadline and up to queueDepth reads on different streams are kept in flight at once, which is what these
+         * drives need to reach their bandwidth. Reads of one stream are grouped and issued in offset order by a single
+         * reader, so they reach the drive as sequential reads.
+         */
+        class SolidStateDevice
+            : public Device
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(SolidStateDevice, SystemAllocator, 0)
+
+            /// \param queueDepth maximum number of reads in flight, queueDepth - 1 reader threads are created in addition to the device thread.
+            SolidStateDevice(const AZStd::string& name, FileIOBase* ioBase, unsigned int queueDepth, const AZStd::thread_desc* threadDesc = 0, int threadSleepTimeMS = -1);
+            ~SolidStateDevice() override;
+
+        protected:
+            struct ScheduledRead
+            {
+                Request* m_request;
+                size_t m_group;
+                void* m_buffer;
+                SizeType m_byteOffset;
+                SizeType m_bytesToProcess;
+                SizeType m_bytesTransfered;
+            };
+
+            struct BatchStream
+            {
+                GenericStream* m_stream;
+                size_t m_group;
+            };
+
+            /// Schedule all requests. (called in the device thread context)
+            void ScheduleRequests() override;
+
+            /// Executes the next write on its own, or a batch of reads across the readers. (called in the device thread context)
+            void ExecuteScheduledRequests() override;
+
+            /// Takes reads from the front of \ref m_pending into \ref m_reads, one group per stream and one for all compressed streams.
+            void GatherReads();
+
+            /// Reads groups of \ref m_reads until there are none left, called from the device thread and the reader threads.
+            void ReadGroups();
+
+            /// Reader thread "main" function.
+            void ProcessReads();
+
+            bool IsLimitedStream(GenericStream* stream);
+
+            static bool SortOnDeadline(Request& left, Request& right);
+
+            double m_readBytesPerMicrosecond;
+            double m_writeBytesPerMicrosecond;
+            unsigned int m_queueDepth;
+
+            AZStd::vector<ScheduledRead> m_reads;           ///< Reads of the current batch, grouped by stream.
+            AZStd::vector<size_t> m_groupStarts;            ///< Start of each stream group in m_reads, followed by m_reads.size().
+            AZStd::vector<BatchStream> m_batchStreams;      ///< Streams of the current batch and their group.
+            AZStd::atomic<size_t> m_nextGroup;              ///< Next group to be read by the device or a reader thread.
+
+            AZStd::vector<AZStd::thread> m_readers;
+            AZStd::semaphore m_readsReady;
+            AZStd::semaphore m_readsDone;
+            AZStd::atomic_bool m_shutdownReaders;
+        };
+    }
+}
@@ -16,6 +16,7 @@
 #include <AzCore/IO/NetworkDevice.h>
 #include <AzCore/IO/OpticalDevice.h>
 #include <AzCore/IO/MagneticDevice.h>
+#include <AzCore/IO/SolidStateDevice.h>
 #include <AzCore/IO/StreamerUtil.h>
 #include <AzCore/IO/Compressor.h>
 
@@ -25,6 +26,10 @@
 #if defined(AZ_PLATFORM_WINDOWS)
 #   include <direct.h>
 #   include <AzCore/PlatformIncl.h>
+#   include <winioctl.h>
+#elif defined(AZ_PLATFORM_LINUX)
+#   include <sys/stat.h>
+#   include <sys/sysmacros.h>
 #endif
 
 
@@ -50,6 +55,7 @@ namespace AZ
             unsigned int        m_cacheBlockSize;               ///< Must be multiple of device sector size.
             unsigned int        m_numCacheBlocks;
             int                 m_deviceThreadSleepTimeMS;      ///< Device thread sleep time between each operation.
+            unsigned int        m_solidStateQueueDepth;         ///< Max number of reads in flight on a flash drive.
             AZStd::thread_desc  m_threadDesc;                   ///< Device thread descriptor.
 
             // todo stream overlay map
@@ -151,6 +157,65 @@ Streamer& Streamer::Instance()
     return *g_streamer.Get();
 }
 
+#if defined(AZ_PLATFORM_WINDOWS)
+//=========================================================================
+// IsSolidStateVolume
+//=========================================================================
+static bool IsSolidStateVolume(const char* root)
+{
+    // only drive letter roots ("C:\") can be opened as a volume
+    if (root[1] != ':')
+    {
+        return false;
+    }
+
+    char volumePath[] = "\\\\.\\X:";
+    volumePath[4] = root[0];
+    HANDLE volume = CreateFileA(volumePath, 0, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, 0, nullptr);
+    if (volume == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    // drives without seek penalty are flash drives, this query is not supported before Windows 8
+    STORAGE_PROPERTY_QUERY query = {};
+    query.PropertyId = StorageDeviceSeekPenaltyProperty;
+    query.QueryType = PropertyStandardQuery;
+    DEVICE_SEEK_PENALTY_DESCRIPTOR seekPenalty = {};
+    DWORD bytesReturned = 0;
+    BOOL result = DeviceIoControl(volume, IOCTL_STORAGE_QUERY_PROPERTY, &query, sizeof(query), &seekPenalty, sizeof(seekPenalty), &bytesReturned, nullptr);
+    CloseHandle(volume);
+    return result && bytesReturned >= sizeof(seekPenalty) && !seekPenalty.IncursSeekPenalty;
+}
+#elif defined(AZ_PLATFORM_LINUX)
+//=========================================================================
+// IsSolidStateVolume
+//=========================================================================
+static bool IsSolidStateVolume(const char* path)
+{
+    struct stat pathStat;
+    if (stat(path, &pathStat) != 0)
+    {
+        return false;
+    }
+
+    // partitions don't have a queue, their disk is the parent in sysfs
+    const char* rotationalPaths[] = { "/sys/dev/block/%u:%u/queue/rotational", "/sys/dev/block/%u:%u/../queue/rotational" };
+    for (const char* rotationalPath : rotationalPaths)
+    {
+        char sysPath[128];
+        azsnprintf(sysPath, AZ_ARRAY_SIZE(sysPath), rotationalPath, major(pathStat.st_dev), minor(pathStat.st_dev));
+        if (FILE* rotationalFile = fopen(sysPath, "r"))
+        {
+            const int rotational = fgetc(rotationalFile);
+            fclose(rotationalFile);
+            return rotational == '0';
+        }
+    }
+    return false;
+}
+#endif
+
 //=========================================================================
 // GetDeviceSpecsFromPath
 // [11/10/2011]
@@ -213,7 +278,7 @@ GetDeviceSpecsFromPath(const char* fullpath, AZStd::string* deviceName, Device::
         {
             if (deviceType)
             {
-                *deviceType = Device::DT_MAGNETIC_DRIVE;
+                *deviceType = IsSolidStateVolume(root) ? Device::DT_FLASH_DRIVE : Device::DT_MAGNETIC_DRIVE;
             }
             if (deviceName)
             {
@@ -244,7 +309,11 @@ GetDeviceSpecsFromPath(const char* fullpath, AZStd::string* deviceName, Device::
 
     if (deviceType)
     {
+#if defined(AZ_PLATFORM_LINUX)
+        *deviceType = IsSolidStateVolume(fullpath) ? Device::DT_FLASH_DRIVE : Device::DT_MAGNETIC_DRIVE;
+#else
         *deviceType = Device::DT_MAGNETIC_DRIVE;
+#endif
     }
     if (deviceName)
     {
@@ -338,6 +407,7 @@ Streamer::Streamer(const Descriptor& desc)
     m_data->m_cacheBlockSize = desc.m_cacheBlockSize;
     m_data->m_numCacheBlocks = desc.m_numCacheBlocks;
     m_data->m_deviceThreadSleepTimeMS = desc.m_deviceThreadSleepTimeMS;
+    m_data->m_solidStateQueueDepth = desc.m_solidStateQueueDepth;
 
     if (desc.m_threadDesc)
     {
@@ -399,6 +469,10 @@ Streamer::FindDevice(const char* streamName)
     AZStd::string oPhysicalName;
     Device::Type oType;
     GetDeviceSpecsFromPath(fullStreamName.c_str(), &oPhysicalName, &oType);
+    if (oType == Device::DT_FLASH_DRIVE && m_data->m_solidStateQueueDepth == 0)
+    {
+        oType = Device::DT_MAGNETIC_DRIVE;
+    }
     if (!oPhysicalName.empty())
     {
         AZStd::lock_guard<AZStd::mutex> lock(m_data->m_devicesLock);
@@ -426,6 +500,11 @@ Streamer::FindDevice(const char* streamName)
                 threadDesc.m_name = "AZ::HDD stream";
                 device = aznew MagneticDevice(oPhysicalName, FileIOBase::GetInstance(), m_data->m_cacheBlockSize, m_data->m_numCacheBlocks, &threadDesc, m_data->m_deviceThreadSleepTimeMS);
             }
+            else if (oType == Device::DT_FLASH_DRIVE)
+            {
+                threadDesc.m_name = "AZ::SSD stream";
+                device = aznew SolidStateDevice(oPhysicalName, FileIOBase::GetInstance(), m_data->m_solidStateQueueDepth, &threadDesc, m_data->m_deviceThreadSleepTimeMS);
+            }
             else if (oType == Device::DT_NETWORK_DRIVE)
             {
                 threadDesc.m_name = "AZ::Net stream";
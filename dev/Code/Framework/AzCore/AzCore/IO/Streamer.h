@@ -58,6 +58,7 @@ namespace AZ
                     , m_cacheBlockSize(32 * 1024)
                     , m_numCacheBlocks(4)
                     , m_deviceThreadSleepTimeMS(-1)
+                    , m_solidStateQueueDepth(8)
                     , m_threadDesc(nullptr)
                 {}
                 unsigned int            m_maxNumOpenLimitedStream;      ///< Max number of open streams with limited flag on. \ref Stream::m_isLimited set to true.
@@ -65,6 +66,7 @@ namespace AZ
                 unsigned int            m_cacheBlockSize;
                 unsigned int            m_numCacheBlocks;
                 int                     m_deviceThreadSleepTimeMS;      ///< Time for the device thread to sleep between each operation. Use with caution.
+                unsigned int            m_solidStateQueueDepth;         ///< Max number of reads in flight on a flash drive. 0 treats flash drives as magnetic drives.
                 AZStd::thread_desc*    m_threadDesc;    ///< Pointer to optional thread descriptor structure. It will be used for each thread spawned (one for each device).
             };
 
@@ -174,7 +176,7 @@ namespace AZ
             /// Cancel request in async mode, function returns instantly. Request callback will be called with Request::StateType == ST_CANCELLED. This function takes in an optional semaphore which will be forwared to the Device::CancelRequest method
             void CancelRequestAsync(RequestHandle request, AZStd::semaphore* sync = nullptr);
 
-            /// Changes the scheduling parameters of the request.
+            /// Changes the scheduling parameters of the request. The device applies them on its next scheduling pass.
             static void RescheduleRequest(RequestHandle request, Request::PriorityType priority, AZStd::chrono::microseconds deadline);
 
             /// Returns the estimated completion time from NOW is microseconds.
@@ -57,6 +57,7 @@ namespace AZ
         m_maxNumOpenLimitedStream = defaultDesc.m_maxNumOpenLimitedStream;
         m_cacheBlockSize = defaultDesc.m_cacheBlockSize;
         m_numCacheBlocks = defaultDesc.m_numCacheBlocks;
+        m_solidStateQueueDepth = defaultDesc.m_solidStateQueueDepth;
         m_driller = nullptr;
 
         {
@@ -96,6 +97,7 @@ namespace AZ
         streamerDesc.m_maxNumOpenLimitedStream = m_maxNumOpenLimitedStream;
         streamerDesc.m_cacheBlockSize = m_cacheBlockSize;
         streamerDesc.m_numCacheBlocks = m_numCacheBlocks;
+        streamerDesc.m_solidStateQueueDepth = m_solidStateQueueDepth;
 
         AZStd::thread_desc threadDesc;
         if (m_deviceThreadCpuId != threadDesc.m_cpuId)
@@ -204,6 +206,7 @@ namespace AZ
                 ->Field("MaxNumberOpenLimitedStream", &StreamerComponent::m_maxNumOpenLimitedStream)
                 ->Field("CacheBlockSize", &StreamerComponent::m_cacheBlockSize)
                 ->Field("NumberOfCacheBlocks", &StreamerComponent::m_numCacheBlocks)
+                ->Field("SolidStateQueueDepth", &StreamerComponent::m_solidStateQueueDepth)
                 ->Field("DeviceThreadCpuId", &StreamerComponent::m_deviceThreadCpuId)
                 ->Field("DeviceThreadPriority", &StreamerComponent::m_deviceThreadPriority)
                 ->Field("DeviceThreadSleepTimeMS", &StreamerComponent::m_deviceThreadSleepTimeMS)
@@ -225,6 +228,8 @@ namespace AZ
                         ->Attribute(AZ::Edit::Attributes::Min, 4)
                         ->Attribute(AZ::Edit::Attributes::Max, 128)
                         ->Attribute(AZ::Edit::Attributes::Step, 2)
+                    ->DataElement(AZ::Edit::UIHandlers::SpinBox, &StreamerComponent::m_solidStateQueueDepth, "Flash drive queue depth", "Maximum number of reads in flight on flash drives (SSD). 0 treats them as magnetic drives")
+                        ->Attribute(AZ::Edit::Attributes::Max, 64)
                     ->DataElement(AZ::Edit::UIHandlers::SpinBox, &StreamerComponent::m_deviceThreadCpuId, "Device thread CPU id", "CPU core id to use for all device threads")
                         ->Attribute(AZ::Edit::Attributes::Min, -1)
                         ->Attribute(AZ::Edit::Attributes::Max, 5)
@@ -84,6 +84,7 @@ namespace AZ
         unsigned int            m_maxNumOpenLimitedStream;      ///< \ref IO::Streamer::Descriptor
         unsigned int            m_cacheBlockSize;               ///< \ref IO::Streamer::Descriptor
         unsigned int            m_numCacheBlocks;               ///< \ref IO::Streamer::Descriptor
+        unsigned int            m_solidStateQueueDepth;         ///< \ref IO::Streamer::Descriptor
         int                     m_deviceThreadCpuId;            ///< CPU Id to use for all device threads
         int                     m_deviceThreadPriority;         ///< Priority of the device thread
         int                     m_deviceThreadSleepTimeMS;      ///< Time to sleep between device operations in milliseconds. Use with caution. -1 to ignore
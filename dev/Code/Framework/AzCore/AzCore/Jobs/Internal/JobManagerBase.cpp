@@ -46,4 +46,16 @@ void JobManagerBase::Process(Job* job)
     }
 }
 
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+void JobManagerBase::SetQueuedTime(Job* job, AZ::u64 queuedTime)
+{
+    job->m_queuedTime = queuedTime;
+}
+
+AZ::u64 JobManagerBase::GetQueuedTime(const Job* job)
+{
+    return job->m_queuedTime;
+}
+#endif
+
 #endif // #ifndef AZ_UNITY_BUILD
\ No newline at end of file
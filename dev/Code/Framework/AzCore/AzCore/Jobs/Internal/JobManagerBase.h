@@ -24,6 +24,11 @@ namespace AZ
             static const AZ::u32 InvalidWorkerThreadId = ~0u;
         protected:
             void Process(Job* job);
+
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+            static void SetQueuedTime(Job* job, AZ::u64 queuedTime);
+            static AZ::u64 GetQueuedTime(const Job* job);
+#endif
         };
     }
 }
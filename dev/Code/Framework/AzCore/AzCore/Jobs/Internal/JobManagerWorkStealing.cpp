@@ -21,37 +21,187 @@
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/time.h>
+#include <AzCore/std/algorithm.h>
 
 #include <AzCore/Debug/Profiler.h>
 
-#ifdef JOBMANAGER_ENABLE_STATS
+#if defined(JOBMANAGER_ENABLE_STATS) || defined(JOBMANAGER_ENABLE_TIMELINE)
 #   include <stdio.h>
 #endif
 
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+#   include <AzCore/Debug/EventTraceDrillerBus.h>
+#endif
+
 using namespace AZ;
 using namespace Internal;
 
 
-void WorkQueue::LocalPushBack(Job* job)
+void PriorityJobLanes::PushBack(Job* job, unsigned int lane)
 {
-    LockGuard lock(m_lock);
-    m_queue.push_back(job);
+    AZ_Assert(lane < NumLanes, "Invalid job lane %u", lane);
+    m_lanes[lane].push_back(job);
+    ++m_numJobs;
 }
 
-Job* WorkQueue::LocalPopBack()
+Job* PriorityJobLanes::PopBack()
 {
-    LockGuard lock(m_lock);
+    if (m_numJobs == 0)
+    {
+        return nullptr;
+    }
+
+    const unsigned int lane = SelectLane(true);
+    Job* result = m_lanes[lane].back();
+    m_lanes[lane].pop_back();
+    --m_numJobs;
+    return result;
+}
 
-    Job* result = nullptr;
-    if (!m_queue.empty())
+Job* PriorityJobLanes::PopFront(bool applyStarvationGuard)
+{
+    if (m_numJobs == 0)
+    {
+        return nullptr;
+    }
+
+    return PopFrontFromLane(SelectLane(applyStarvationGuard));
+}
+
+Job* PriorityJobLanes::PopFrontFromLane(unsigned int lane)
+{
+    AZ_Assert(lane < NumLanes, "Invalid job lane %u", lane);
+    if (m_lanes[lane].empty())
     {
-        result = m_queue.back();
-        m_queue.pop_back();
+        return nullptr;
     }
 
+    Job* result = m_lanes[lane].front();
+    m_lanes[lane].pop_front();
+    --m_numJobs;
     return result;
 }
 
+unsigned int PriorityJobLanes::SelectLane(bool applyStarvationGuard)
+{
+    AZ_Assert(m_numJobs > 0, "Selecting a lane with no queued jobs");
+
+    unsigned int selected = 0;
+    while (m_lanes[selected].empty())
+    {
+        ++selected;
+    }
+
+    if (!applyStarvationGuard || m_starvationLimit == 0)
+    {
+        return selected;
+    }
+
+    //every non-empty lower priority lane is being passed over, the highest priority one which reached the limit runs instead
+    unsigned int starved = NumLanes;
+    for (unsigned int lane = selected + 1; lane < NumLanes; ++lane)
+    {
+        if (m_lanes[lane].empty())
+        {
+            m_passedOverCounts[lane] = 0;
+        }
+        else if ((++m_passedOverCounts[lane] > m_starvationLimit) && (starved == NumLanes))
+        {
+            starved = lane;
+        }
+    }
+
+    if (starved != NumLanes)
+    {
+        selected = starved;
+    }
+    m_passedOverCounts[selected] = 0;
+    return selected;
+}
+
+
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+void JobTimeline::Record(EventType type, AZ::u64 startTime, AZ::u64 endTime)
+{
+    if (m_numEvents == MaxEvents)
+    {
+        Flush();
+    }
+
+    Event& event = m_events[m_numEvents++];
+    event.m_startTime = startTime;
+    event.m_duration = static_cast<AZ::u32>(endTime - startTime);
+    event.m_type = type;
+
+    if (type == EVENT_STEAL_FAILED)
+    {
+        ++m_stealsFailed;
+    }
+    else if (type == EVENT_SLEEP)
+    {
+        ++m_sleeps;
+        m_sleepTime += endTime - startTime;
+    }
+}
+
+void JobTimeline::RecordJobLatency(AZ::u64 latency)
+{
+    ++m_latencySamples;
+    m_totalLatency += latency;
+    m_maxLatency = AZStd::GetMax(m_maxLatency, latency);
+}
+
+void JobTimeline::Flush()
+{
+    static const char* s_eventNames[EVENT_COUNT] = { "Job", "Steal", "Steal Failed", "Sleep" };
+
+    const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+    for (unsigned int i = 0; i < m_numEvents; ++i)
+    {
+        const Event& event = m_events[i];
+        EBUS_QUEUE_EVENT(AZ::Debug::EventTraceDrillerBus, RecordSlice, s_eventNames[event.m_type], "JobManager", threadId, event.m_startTime, event.m_duration);
+    }
+    m_numEvents = 0;
+}
+
+void JobTimeline::ClearStats()
+{
+    m_stealAttempts = 0;
+    m_stealsFailed = 0;
+    m_sleeps = 0;
+    m_latencySamples = 0;
+    m_sleepTime = 0;
+    m_totalLatency = 0;
+    m_maxLatency = 0;
+}
+#endif // JOBMANAGER_ENABLE_TIMELINE
+
+
+void WorkQueue::SetStarvationLimit(unsigned int starvationLimit)
+{
+    LockGuard lock(m_lock);
+    m_queue.SetStarvationLimit(starvationLimit);
+}
+
+bool WorkQueue::IsEmpty()
+{
+    LockGuard lock(m_lock);
+    return m_queue.IsEmpty();
+}
+
+void WorkQueue::LocalPushBack(Job* job, unsigned int lane)
+{
+    LockGuard lock(m_lock);
+    m_queue.PushBack(job, lane);
+}
+
+Job* WorkQueue::LocalPopBack()
+{
+    LockGuard lock(m_lock);
+    return m_queue.PopBack();
+}
+
 Job* WorkQueue::TryStealFront()
 {
     AZStd::exponential_backoff backoff;
@@ -60,12 +210,8 @@ Job* WorkQueue::TryStealFront()
         // Do a bounded spin with backoff to acquire the lock
         if (m_lock.try_lock())
         {
-            Job* result = nullptr;
-            if (!m_queue.empty())
-            {
-                result = m_queue.front();
-                m_queue.pop_front();
-            }
+            //thieves take the oldest job of the highest priority lane, the starvation guard is left to the owner
+            Job* result = m_queue.PopFront(false);
 
             m_lock.unlock();
             return result;
@@ -83,7 +229,47 @@ AZ_THREAD_LOCAL JobManagerWorkStealing::ThreadInfo* JobManagerWorkStealing::m_cu
 JobManagerWorkStealing::JobManagerWorkStealing(const JobManagerDesc& desc)
     : m_isAsynchronous(!desc.m_workerThreads.empty())
     , m_workerThreads(AZStd::move(CreateWorkerThreads(desc.m_workerThreads)))
+    , m_deadlinePromotionWindowTicks(static_cast<AZStd::sys_time_t>(desc.m_deadlinePromotionWindowUs) * AZStd::GetTimeTicksPerSecond() / 1000000)
+    , m_maxSuspendDepth(desc.m_maxSuspendDepth)
 {
+    //workers are blocked on the init semaphore, so nothing has been queued yet
+    m_globalJobQueue.SetStarvationLimit(desc.m_starvationLimit);
+    for (ThreadInfo* info : m_workerThreads)
+    {
+        info->m_pendingJobs.SetStarvationLimit(desc.m_starvationLimit);
+
+        if (static_cast<size_t>(info->m_stealDomain) >= m_domainWorkers.size())
+        {
+            m_domainWorkers.resize(info->m_stealDomain + 1);
+        }
+        m_domainWorkers[info->m_stealDomain].push_back(info);
+    }
+
+    //steal from our own domain first, starting after ourselves so thieves don't all pick the same victim
+    const unsigned int numWorkers = static_cast<unsigned int>(m_workerThreads.size());
+    for (unsigned int workerIndex = 0; workerIndex < numWorkers; ++workerIndex)
+    {
+        ThreadInfo* info = m_workerThreads[workerIndex];
+        for (unsigned int offset = 1; offset < numWorkers; ++offset)
+        {
+            const unsigned int victim = (workerIndex + offset) % numWorkers;
+            if (m_workerThreads[victim]->m_stealDomain == info->m_stealDomain)
+            {
+                info->m_stealOrder.push_back(victim);
+            }
+        }
+        info->m_numLocalVictims = static_cast<unsigned int>(info->m_stealOrder.size());
+        for (unsigned int offset = 1; offset < numWorkers; ++offset)
+        {
+            const unsigned int victim = (workerIndex + offset) % numWorkers;
+            if (m_workerThreads[victim]->m_stealDomain != info->m_stealDomain)
+            {
+                info->m_stealOrder.push_back(victim);
+            }
+        }
+        m_defaultStealOrder.push_back(workerIndex);
+    }
+
     //allow workers to begin processing after they have all been created, needed to wait since they may access each others queues
     m_initSemaphore.release(static_cast<unsigned int>(desc.m_workerThreads.size()));
 }
@@ -112,6 +298,9 @@ JobManagerWorkStealing::~JobManagerWorkStealing()
 void JobManagerWorkStealing::AddPendingJob(Job* job)
 {
     AZ_Assert(job->GetDependentCount() == 0, ("Job has a non-zero ready count, it should not be being added yet"));
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+    SetQueuedTime(job, AZStd::GetTimeNowMicroSecond());
+#endif
 
     ThreadInfo* info = m_currentThreadInfo;
 #ifndef AZ_MONOLITHIC_BUILD
@@ -121,11 +310,29 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
     }
 #endif
 
+    const unsigned int lane = GetJobLane(job);
+
     AZ_PROFILE_INTERVAL_START(AZ::Debug::ProfileCategory::JobManagerDetailed, job, "AzCore Job Queued Awaiting Execute");
+
+    //jobs hinting another steal domain are handed to a worker of that domain
+    const int affinityDomain = job->GetAffinityDomain();
+    if (affinityDomain >= 0 && IsAsynchronous() && static_cast<size_t>(affinityDomain) < m_domainWorkers.size() &&
+        !m_domainWorkers[affinityDomain].empty() && !(info && info->m_isWorker && info->m_stealDomain == affinityDomain))
+    {
+        const ThreadList& domainWorkers = m_domainWorkers[affinityDomain];
+        ThreadInfo* targetInfo = domainWorkers[m_nextAffinityWorker.fetch_add(1, AZStd::memory_order_relaxed) % domainWorkers.size()];
+
+        //the owner checks its queue before sleeping while holding the global queue lock
+        AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+        targetInfo->m_pendingJobs.LocalPushBack(job, lane);
+        ActivateWorker(affinityDomain);
+        return;
+    }
+
     if (info && info->m_isWorker)
     {
         //current thread is a worker, push to the local queue
-        info->m_pendingJobs.LocalPushBack(job);
+        info->m_pendingJobs.LocalPushBack(job, lane);
 #ifdef JOBMANAGER_ENABLE_STATS
         ++info->m_jobsForked;
 #endif
@@ -138,7 +345,7 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
         if (IsAsynchronous())
         {
             AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-            m_globalJobQueue.push(job);
+            PushGlobalJob(job, lane);
 
             //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
             ActivateWorker();
@@ -147,7 +354,7 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
         {
             {
                 AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                m_globalJobQueue.push(job);
+                PushGlobalJob(job, lane);
             }
 
             //no workers, so must process the jobs right now
@@ -165,6 +372,7 @@ void JobManagerWorkStealing::SuspendJobUntilReady(Job* job)
     AZ_Assert(info->m_currentJob == job, ("Can't suspend a job which isn't currently running"));
 
     info->m_currentJob = NULL; //clear current job
+    ++info->m_suspendDepth;
 
     if (IsAsynchronous())
     {
@@ -175,6 +383,7 @@ void JobManagerWorkStealing::SuspendJobUntilReady(Job* job)
         ProcessJobsSynchronous(info, job, NULL);
     }
 
+    --info->m_suspendDepth;
     info->m_currentJob = job; //restore current job
 }
 
@@ -220,6 +429,12 @@ void JobManagerWorkStealing::ClearStats()
         info->m_stealTime = 0;
     }
 #endif
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+    for (ThreadInfo* info : m_threads)
+    {
+        info->m_timeline.ClearStats();
+    }
+#endif
 }
 
 void JobManagerWorkStealing::PrintStats()
@@ -240,6 +455,20 @@ void JobManagerWorkStealing::PrintStats()
         printf(str);
     }
 #endif
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+    printf("===================================================\n");
+    printf("Job System Timeline Stats:\n");
+    printf("Thread   Steal attempts  Steals failed  Sleeps   Sleep time (ms)  Avg latency (us)  Max latency (us)\n");
+    printf("------   --------------  -------------  -------  ---------------  ----------------  ----------------\n");
+    for (unsigned int i = 0; i < m_threads.size(); ++i)
+    {
+        const JobTimeline& timeline = m_threads[i]->m_timeline;
+        const double sleepTime = static_cast<double>(timeline.m_sleepTime) / 1000.0;
+        const double avgLatency = timeline.m_latencySamples ? static_cast<double>(timeline.m_totalLatency) / timeline.m_latencySamples : 0.0;
+        printf(" %d:        %7u        %7u      %5u         %8.2f          %8.2f          %8llu\n",
+            i, timeline.m_stealAttempts, timeline.m_stealsFailed, timeline.m_sleeps, sleepTime, avgLatency, static_cast<unsigned long long>(timeline.m_maxLatency));
+    }
+#endif
 }
 
 
@@ -280,6 +509,10 @@ void JobManagerWorkStealing::ProcessJobsWorker(ThreadInfo* info)
 
     ProcessJobsInternal(info, NULL, NULL);
 
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+    info->m_timeline.Flush();
+#endif
+
     m_currentThreadInfo = NULL;
 }
 
@@ -290,6 +523,10 @@ void JobManagerWorkStealing::ProcessJobsAssist(ThreadInfo* info, Job* suspendedJ
 
     ProcessJobsInternal(info, suspendedJob, notifyFlag);
 
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+    info->m_timeline.Flush();
+#endif
+
     m_currentThreadInfo = oldInfo; //restore previous ThreadInfo, necessary as must be NULL when returning to user code to support multiple job contexts
 }
 
@@ -299,7 +536,14 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
 
     //get thread local job queue
     WorkQueue* pendingJobs = info->m_isWorker ? &info->m_pendingJobs : nullptr;
-    unsigned int victim = ((m_workerThreads.size() > 1) && (m_workerThreads[0] == info)) ? 1 : 0;
+
+    //workers try the victims in their own steal domain first, other threads try all workers
+    const AZStd::vector<unsigned int>& stealOrder = info->m_isWorker ? info->m_stealOrder : m_defaultStealOrder;
+    const unsigned int numLocalVictims = info->m_isWorker ? info->m_numLocalVictims : static_cast<unsigned int>(stealOrder.size());
+    unsigned int victimIndex = 0;
+
+    //past the suspend depth limit we only wait on our own queue and the global queue, stolen work would nest on our stack
+    const bool isStealingAllowed = !suspendedJob || (m_maxSuspendDepth == 0) || (info->m_suspendDepth <= m_maxSuspendDepth);
 
     while (true)
     {
@@ -325,7 +569,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 {
                     //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
                     AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                    if (m_globalJobQueue.empty())
+                    if (m_globalJobQueue.IsEmpty() && pendingJobs->IsEmpty())
                     {
                         shouldSleep = true;
 
@@ -341,8 +585,16 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
 
                 if (shouldSleep)
                 {
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+                    //we are idle, good time to hand the recorded events over
+                    info->m_timeline.Flush();
+                    const AZ::u64 timelineSleepStart = AZStd::GetTimeNowMicroSecond();
+#endif
                     //no available work, so go to sleep (or we have already been signaled by another thread and will acquire the semaphore but not actually sleep)
                     info->m_waitEvent.acquire();
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+                    info->m_timeline.Record(JobTimeline::EVENT_SLEEP, timelineSleepStart, AZStd::GetTimeNowMicroSecond());
+#endif
                     AZ_PROFILE_INTERVAL_END(AZ::Debug::ProfileCategory::JobManagerDetailed, info);
 
                     if (m_quitRequested)
@@ -361,14 +613,13 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
 
             {
                 AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                if (!m_globalJobQueue.empty())
-                {
-                    job = m_globalJobQueue.front();
-                    m_globalJobQueue.pop();
+                job = PopGlobalJob();
 #ifdef JOBMANAGER_ENABLE_STATS
+                if (job)
+                {
                     ++info->m_globalJobs;
-#endif
                 }
+#endif
             }
         }
 
@@ -387,9 +638,16 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
             //run current job and jobs from the local queue until it is empty
             while (job)
             {
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+                const AZ::u64 timelineJobStart = AZStd::GetTimeNowMicroSecond();
+                info->m_timeline.RecordJobLatency(timelineJobStart - GetQueuedTime(job));
+#endif
                 info->m_currentJob = job;
                 Process(job);
                 info->m_currentJob = nullptr;
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+                info->m_timeline.Record(JobTimeline::EVENT_JOB, timelineJobStart, AZStd::GetTimeNowMicroSecond());
+#endif
 
                 //...after calling Process we cannot use the job pointer again, the job has completed and may not exist anymore
 #ifdef JOBMANAGER_ENABLE_STATS
@@ -402,8 +660,17 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     return;
                 }
 
+                //critical jobs queued by non-worker threads take precedence over the local queue
+                job = TryPopGlobalCriticalJob();
+#ifdef JOBMANAGER_ENABLE_STATS
+                if (job)
+                {
+                    ++info->m_globalJobs;
+                }
+#endif
+
                 //pop a new job from the local queue
-                if (pendingJobs)
+                if (!job && pendingJobs)
                 {
                     job = pendingJobs->LocalPopBack();
                     if (job)
@@ -412,10 +679,6 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                         ActivateWorker();
                     }
                 }
-                else
-                {
-                    job = nullptr;
-                }
             }
 
 #ifdef JOBMANAGER_ENABLE_STATS
@@ -426,11 +689,26 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
             {
                 isTerminated = true;
             }
+            else if (!isStealingAllowed)
+            {
+                //our children are being processed elsewhere, back off before checking the queues again
+                AZStd::this_thread::yield();
+                isTerminated = true;
+            }
             else
             {
                 //attempt to steal a job from another thread's queue
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "JobManagerWorkStealing::ProcessJobsInternal:WorkStealing");
 
+                //go back to our own domain if the last successful steal was from another one
+                if (victimIndex >= numLocalVictims)
+                {
+                    victimIndex = 0;
+                }
+
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+                const AZ::u64 timelineStealStart = AZStd::GetTimeNowMicroSecond();
+#endif
                 unsigned int numStealAttempts = 0;
                 const unsigned int maxStealAttempts = (unsigned int)m_workerThreads.size() * 3; //try every thread a few times before giving up
                 while (!job)
@@ -443,7 +721,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     }
 
                     //select a victim thread, using the same victim as the previous successful steal if possible
-                    WorkQueue* victimQueue = &m_workerThreads[victim]->m_pendingJobs;
+                    WorkQueue* victimQueue = &m_workerThreads[stealOrder[victimIndex]]->m_pendingJobs;
 
                     //attempt the steal
                     job = victimQueue->TryStealFront();
@@ -472,13 +750,12 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     }
 
                     //steal failed, choose a new victim for next time
-                    victim = (victim + 1) % m_workerThreads.size();
-                    if (m_workerThreads[victim] == info)
-                    {
-                        //don't steal from ourselves
-                        victim = (victim + 1) % m_workerThreads.size();
-                    }
+                    victimIndex = (victimIndex + 1) % stealOrder.size();
                 }
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+                info->m_timeline.m_stealAttempts += job ? numStealAttempts + 1 : numStealAttempts;
+                info->m_timeline.Record(job ? JobTimeline::EVENT_STEAL : JobTimeline::EVENT_STEAL_FAILED, timelineStealStart, AZStd::GetTimeNowMicroSecond());
+#endif
             }
 #ifdef JOBMANAGER_ENABLE_STATS
             info->m_stealTime += AZStd::GetTimeNowTicks() - jobEndTime;
@@ -494,10 +771,9 @@ void JobManagerWorkStealing::ProcessJobsSynchronous(ThreadInfo* info, Job* suspe
     ThreadInfo* oldInfo = m_currentThreadInfo;
     m_currentThreadInfo = info;
 
-    while (!m_globalJobQueue.empty())
+    while (!m_globalJobQueue.IsEmpty())
     {
-        Job* job = m_globalJobQueue.front();
-        m_globalJobQueue.pop();
+        Job* job = PopGlobalJob();
 
         info->m_currentJob = job;
         Process(job);
@@ -604,6 +880,7 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
         ThreadInfo* info = aznew ThreadInfo;
         info->m_isWorker = true;
         info->m_workerId = iThread;
+        info->m_stealDomain = AZStd::GetMax(desc.m_stealDomain, 0);
 
         AZStd::thread_desc threadDesc;
         threadDesc.m_name = "AZ JobManager worker thread";
@@ -631,14 +908,61 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
     return workerThreads;
 }
 
-inline void JobManagerWorkStealing::ActivateWorker()
+unsigned int JobManagerWorkStealing::GetJobLane(const Job* job) const
+{
+    const unsigned int lane = static_cast<unsigned int>(job->GetPriority());
+    const AZStd::sys_time_t deadline = job->GetDeadline();
+    if (deadline != 0 && lane != static_cast<unsigned int>(JobPriority::Critical))
+    {
+        if (deadline - AZStd::GetTimeNowTicks() <= m_deadlinePromotionWindowTicks)
+        {
+            return static_cast<unsigned int>(JobPriority::Critical);
+        }
+    }
+    return lane;
+}
+
+void JobManagerWorkStealing::PushGlobalJob(Job* job, unsigned int lane)
+{
+    m_globalJobQueue.PushBack(job, lane);
+    m_numGlobalCriticalJobs.store(static_cast<unsigned int>(m_globalJobQueue.GetLaneSize(static_cast<unsigned int>(JobPriority::Critical))), AZStd::memory_order_release);
+}
+
+Job* JobManagerWorkStealing::PopGlobalJob()
+{
+    Job* job = m_globalJobQueue.PopFront(true);
+    if (job)
+    {
+        m_numGlobalCriticalJobs.store(static_cast<unsigned int>(m_globalJobQueue.GetLaneSize(static_cast<unsigned int>(JobPriority::Critical))), AZStd::memory_order_release);
+    }
+    return job;
+}
+
+Job* JobManagerWorkStealing::TryPopGlobalCriticalJob()
+{
+    if (m_numGlobalCriticalJobs.load(AZStd::memory_order_acquire) == 0)
+    {
+        return nullptr;
+    }
+
+    AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+    const unsigned int criticalLane = static_cast<unsigned int>(JobPriority::Critical);
+    Job* job = m_globalJobQueue.PopFrontFromLane(criticalLane);
+    m_numGlobalCriticalJobs.store(static_cast<unsigned int>(m_globalJobQueue.GetLaneSize(criticalLane)), AZStd::memory_order_release);
+    return job;
+}
+
+inline void JobManagerWorkStealing::ActivateWorker(int preferredDomain)
 {
     // find an available worker thread (we do it brute force because the number of threads is small)
+    const size_t numPreferred = (preferredDomain >= 0) ? m_domainWorkers[preferredDomain].size() : 0;
     while (m_numAvailableWorkers.load(AZStd::memory_order_acquire) > 0)
     {
-        for (size_t i = 0; i < m_workerThreads.size(); ++i)
+        //try the workers of the preferred domain first, then everyone
+        for (size_t i = 0; i < numPreferred + m_workerThreads.size(); ++i)
         {
-            ThreadInfo* info = m_workerThreads[i];
+            ThreadInfo* info = (i < numPreferred) ? m_domainWorkers[preferredDomain][i] : m_workerThreads[i - numPreferred];
+
             if (info->m_isAvailable.exchange(false, AZStd::memory_order_acq_rel) == true)
             {
                 // decrement number of available workers
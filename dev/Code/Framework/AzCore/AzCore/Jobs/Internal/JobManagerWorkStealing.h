@@ -17,6 +17,8 @@
 #ifdef AZCORE_JOBS_IMPL_WORK_STEALING
 
 #include <AzCore/Jobs/Internal/JobManagerBase.h>
+#include <AzCore/Jobs/Internal/JobTimeline.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobManagerDesc.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
@@ -33,10 +35,50 @@ namespace AZ
 
     namespace Internal
     {
+        /**
+         * One deque of jobs per JobPriority, not threadsafe. Pops always come from the highest priority non-empty lane,
+         * unless the starvation guard (see JobManagerDesc::m_starvationLimit) selects a lower lane which has been passed
+         * over too many times.
+         */
+        class PriorityJobLanes final
+        {
+        public:
+            enum
+            {
+                NumLanes = static_cast<unsigned int>(JobPriority::Count),
+            };
+
+            void SetStarvationLimit(unsigned int starvationLimit) { m_starvationLimit = starvationLimit; }
+
+            bool IsEmpty() const { return m_numJobs == 0; }
+            size_t GetLaneSize(unsigned int lane) const { return m_lanes[lane].size(); }
+
+            void PushBack(Job* job, unsigned int lane);
+
+            /// Pops the newest job of the selected lane, used by the owner of the lanes
+            Job* PopBack();
+            /// Pops the oldest job of the selected lane, used for FIFO processing and stealing
+            Job* PopFront(bool applyStarvationGuard);
+            /// Pops the oldest job of a specific lane, bypassing the starvation guard
+            Job* PopFrontFromLane(unsigned int lane);
+
+        private:
+            unsigned int SelectLane(bool applyStarvationGuard);
+
+            AZStd::deque<Job*> m_lanes[NumLanes];
+            unsigned int m_passedOverCounts[NumLanes] = {};
+            unsigned int m_starvationLimit = 0;
+            unsigned int m_numJobs = 0;
+        };
+
         class WorkQueue final
         {
         public:
-            void LocalPushBack(Job *job);
+            void SetStarvationLimit(unsigned int starvationLimit);
+
+            bool IsEmpty();
+
+            void LocalPushBack(Job *job, unsigned int lane);
             Job* LocalPopBack();
             Job* TryStealFront();
 
@@ -48,7 +90,7 @@ namespace AZ
             using LockType = AZStd::shared_mutex;
             using LockGuard = AZStd::lock_guard<LockType>;
 
-            AZStd::deque<Job*> m_queue;
+            PriorityJobLanes m_queue;
             LockType m_lock;
         };
 
@@ -88,7 +130,16 @@ namespace AZ
 
         private:
 
-            void ActivateWorker();
+            /// Wakes up a sleeping worker, one from preferredDomain if possible
+            void ActivateWorker(int preferredDomain = -1);
+
+            /// Lane a pending job is queued in, the priority of the job promoted to critical if its deadline is due
+            unsigned int GetJobLane(const Job* job) const;
+            /// Push and pop on the global queue, must be called while holding m_globalJobQueueMutex
+            void PushGlobalJob(Job* job, unsigned int lane);
+            Job* PopGlobalJob();
+            /// Takes a critical job from the global queue if there is one, the lock is only taken when one is queued
+            Job* TryPopGlobalCriticalJob();
 
             struct ThreadInfo
             {
@@ -97,6 +148,7 @@ namespace AZ
                 AZStd::thread::id m_threadId;
                 bool m_isWorker = false;
                 Job* m_currentJob = nullptr; //job which is currently processing on this thread
+                unsigned int m_suspendDepth = 0; //number of suspended jobs nested on this thread's stack
 
                 // valid only on workers (TODO: Use some lazy initialization as we don't need that data for non worker threads)
                 AZStd::thread m_thread;
@@ -104,6 +156,9 @@ namespace AZ
                 AZStd::binary_semaphore m_waitEvent;
                 WorkQueue m_pendingJobs;
                 unsigned int m_workerId = JobManagerBase::InvalidWorkerThreadId;
+                int m_stealDomain = 0;
+                AZStd::vector<unsigned int> m_stealOrder; //victim worker indices, own domain first
+                unsigned int m_numLocalVictims = 0; //number of m_stealOrder entries in our own domain
 
 #ifdef JOBMANAGER_ENABLE_STATS
                 unsigned int m_globalJobs = 0;
@@ -112,6 +167,9 @@ namespace AZ
                 unsigned int m_jobsStolen = 0;
                 u64 m_jobTime = 0;
                 u64 m_stealTime = 0;
+#endif
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+                JobTimeline m_timeline;
 #endif
             };
             using ThreadList = AZStd::vector<ThreadInfo*>;
@@ -136,11 +194,20 @@ namespace AZ
 
             const ThreadList m_workerThreads; //no mutex required for this list, it's only assigned during startup, must be declared after m_threads and m_initSemaphore
 
-            using GlobalJobQueue = AZStd::queue<Job*, AZStd::deque<Job*>>;
+            //workers grouped by steal domain, and the steal order used by non-worker threads, assigned during startup
+            AZStd::vector<ThreadList> m_domainWorkers;
+            AZStd::vector<unsigned int> m_defaultStealOrder;
+            AZStd::atomic_uint m_nextAffinityWorker{0};
+
+            using GlobalJobQueue = PriorityJobLanes;
             using GlobalQueueMutexType = AZStd::mutex;
 
             GlobalJobQueue              m_globalJobQueue;
             GlobalQueueMutexType        m_globalJobQueueMutex;
+            AZStd::atomic_uint          m_numGlobalCriticalJobs{0}; //lets workers check for critical global jobs between local jobs without taking the lock
+
+            const AZStd::sys_time_t     m_deadlinePromotionWindowTicks;
+            const unsigned int          m_maxSuspendDepth;
 
             volatile bool               m_quitRequested = false;
             AZStd::atomic_uint          m_numAvailableWorkers{0};
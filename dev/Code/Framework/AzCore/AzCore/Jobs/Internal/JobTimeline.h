@@ -0,0 +1,82 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef AZCORE_JOBS_INTERNAL_JOBTIMELINE_H
+#define AZCORE_JOBS_INTERNAL_JOBTIMELINE_H 1
+
+// Included directly from JobManagerWorkStealing.h, only compiled in with JOBMANAGER_ENABLE_TIMELINE
+
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+
+#include <AzCore/base.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /**
+         * Per thread recorder of job manager activity. Events are stored in a fixed buffer owned by the thread, which is
+         * streamed to the EventTraceDriller (and from there to Chrome tracing) when it fills up, when the worker goes to
+         * sleep and when the thread stops processing jobs. Only the owning thread may record or flush. Counters are
+         * kept for the whole run so they can be printed with the other job manager stats.
+         */
+        class JobTimeline final
+        {
+        public:
+            enum EventType : AZ::u8
+            {
+                EVENT_JOB,
+                EVENT_STEAL,
+                EVENT_STEAL_FAILED,
+                EVENT_SLEEP,
+                EVENT_COUNT
+            };
+
+            /// All times are in microseconds, see AZStd::GetTimeNowMicroSecond
+            void Record(EventType type, AZ::u64 startTime, AZ::u64 endTime);
+            void RecordJobLatency(AZ::u64 latency);
+
+            /// Sends all recorded events to the EventTraceDrillerBus queue
+            void Flush();
+
+            void ClearStats();
+
+            unsigned int m_stealAttempts = 0;
+            unsigned int m_stealsFailed = 0;
+            unsigned int m_sleeps = 0;
+            unsigned int m_latencySamples = 0;
+            u64 m_sleepTime = 0;
+            u64 m_totalLatency = 0;
+            u64 m_maxLatency = 0;
+
+        private:
+            enum
+            {
+                MaxEvents = 1024,
+            };
+
+            struct Event
+            {
+                AZ::u64 m_startTime;
+                AZ::u32 m_duration;
+                EventType m_type;
+            };
+
+            Event m_events[MaxEvents];
+            unsigned int m_numEvents = 0;
+        };
+    }
+}
+
+#endif // JOBMANAGER_ENABLE_TIMELINE
+
+#endif
+#pragma once
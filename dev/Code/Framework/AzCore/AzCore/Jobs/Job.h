@@ -149,6 +149,31 @@ namespace AZ
          */
         JobContext* GetContext() const;
 
+        /**
+         * Priority lane the job will be queued in once it becomes pending, defaults to the priority of the context.
+         * Can only be changed before the job is started.
+         */
+        void SetPriority(JobPriority priority);
+        JobPriority GetPriority() const;
+
+        /**
+         * Optional deadline hint, as an absolute time in AZStd::GetTimeNowTicks() units, 0 means no deadline (default).
+         * A job which is due (see JobManagerDesc::m_deadlinePromotionWindowUs) when it becomes pending is queued in the
+         * critical lane. Can only be changed before the job is started.
+         */
+        void SetDeadline(AZStd::sys_time_t deadline);
+        AZStd::sys_time_t GetDeadline() const;
+
+        /**
+         * Optional hint to run this job on a worker of the given steal domain (see JobManagerThreadDesc::m_stealDomain),
+         * e.g. to keep it close to the data of the job which created it. -1 means no preference (default), domains above
+         * MaxAffinityDomain can't be hinted. Can only be changed before the job is started.
+         */
+        void SetAffinityDomain(int domain);
+        int GetAffinityDomain() const;
+
+        static const int MaxAffinityDomain = 14;
+
         /**
          * Gets the dependent job, the dependent job will not start until this job has completed.
          */
@@ -195,15 +220,25 @@ namespace AZ
             FLAG_AUTO_DELETE = (1 << 31),
             FLAG_CHILD_JOBS  = (1 << 30),
 
+            //2 bits for priority
+            FLAG_PRIORITY_SHIFT = 24,
+            FLAG_PRIORITY_MASK = (3 << FLAG_PRIORITY_SHIFT),
+
+            //4 bits for affinity domain + 1, 0 is no preference
+            FLAG_AFFINITY_SHIFT = 26,
+            FLAG_AFFINITY_MASK = (15 << FLAG_AFFINITY_SHIFT),
+
             //24 bits for count
             FLAG_DEPENDENTCOUNT_MASK = 0x00ffffff
         };
 
     protected:
-        //16 bytes of overhead per job, including the vtable pointer (20 bytes in debug)
+        //24 bytes of overhead per job, including the vtable pointer and deadline (28 bytes in debug)
 
         JobContext* volatile m_context;
 
+        AZStd::sys_time_t m_deadline;
+
         //storing dependent count together with some other values, to save space. Dependent count is stored in lowest
         //bits to allow us to atomically increment/decrement it.
 #ifdef AZCORE_JOBS_IMPL_SYNCHRONOUS
@@ -217,6 +252,10 @@ namespace AZ
         //state is only really necessary for debugging... we could squeeze it into the dependent count member, but it
         //would require atomic ops to set/read it, so not really worth it.
         int m_state;
+
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+        AZ::u64 m_queuedTime; //time the job became pending, used to measure queue latency
+#endif
     };
 
     //============================================================================================================
@@ -239,8 +278,13 @@ namespace AZ
         {
             countAndFlags |= (unsigned int)FLAG_AUTO_DELETE;
         }
+        countAndFlags |= static_cast<unsigned int>(m_context->GetDefaultPriority()) << FLAG_PRIORITY_SHIFT;
         SetDependentCountAndFlags(countAndFlags);
         StoreDependent(NULL);
+        m_deadline = 0;
+#ifdef JOBMANAGER_ENABLE_TIMELINE
+        m_queuedTime = 0;
+#endif
 
 #ifdef AZ_DEBUG_JOB_STATE
         SetState(STATE_SETUP);
@@ -403,6 +447,51 @@ namespace AZ
         return m_context;
     }
 
+    inline void Job::SetPriority(JobPriority priority)
+    {
+#ifdef AZ_DEBUG_JOB_STATE
+        AZ_Assert(m_state == STATE_SETUP, "Priority can only be set before the job is started");
+#endif
+        AZ_Assert(priority < JobPriority::Count, "Invalid job priority");
+        unsigned int countAndFlags = GetDependentCountAndFlags();
+        countAndFlags = (countAndFlags & ~(unsigned int)FLAG_PRIORITY_MASK) | (static_cast<unsigned int>(priority) << FLAG_PRIORITY_SHIFT);
+        SetDependentCountAndFlags(countAndFlags);
+    }
+
+    AZ_FORCE_INLINE JobPriority Job::GetPriority() const
+    {
+        return static_cast<JobPriority>((GetDependentCountAndFlags() & (unsigned int)FLAG_PRIORITY_MASK) >> FLAG_PRIORITY_SHIFT);
+    }
+
+    AZ_FORCE_INLINE void Job::SetDeadline(AZStd::sys_time_t deadline)
+    {
+#ifdef AZ_DEBUG_JOB_STATE
+        AZ_Assert(m_state == STATE_SETUP, "Deadline can only be set before the job is started");
+#endif
+        m_deadline = deadline;
+    }
+
+    AZ_FORCE_INLINE AZStd::sys_time_t Job::GetDeadline() const
+    {
+        return m_deadline;
+    }
+
+    inline void Job::SetAffinityDomain(int domain)
+    {
+#ifdef AZ_DEBUG_JOB_STATE
+        AZ_Assert(m_state == STATE_SETUP, "Affinity can only be set before the job is started");
+#endif
+        AZ_Assert(domain >= -1 && domain <= MaxAffinityDomain, "Affinity domain %d out of range", domain);
+        unsigned int countAndFlags = GetDependentCountAndFlags();
+        countAndFlags = (countAndFlags & ~(unsigned int)FLAG_AFFINITY_MASK) | (static_cast<unsigned int>(domain + 1) << FLAG_AFFINITY_SHIFT);
+        SetDependentCountAndFlags(countAndFlags);
+    }
+
+    AZ_FORCE_INLINE int Job::GetAffinityDomain() const
+    {
+        return static_cast<int>((GetDependentCountAndFlags() & (unsigned int)FLAG_AFFINITY_MASK) >> FLAG_AFFINITY_SHIFT) - 1;
+    }
+
     AZ_FORCE_INLINE unsigned int Job::GetDependentCount() const
     {
         return (GetDependentCountAndFlags() & FLAG_DEPENDENTCOUNT_MASK);
@@ -18,6 +18,18 @@ namespace AZ
 {
     class JobManager;
 
+    /**
+     * Priority lane a job is queued in. Workers always run jobs from the highest priority lane first, both from
+     * their own queue and when stealing, see JobManagerDesc for the starvation guard which keeps lower lanes moving.
+     */
+    enum class JobPriority : unsigned char
+    {
+        Critical = 0,   ///< Frame critical work (culling, skinning, etc.)
+        Normal,         ///< Default priority
+        Background,     ///< Long running work which can be deferred (asset processing, vegetation, etc.)
+        Count
+    };
+
     /**
      * A job context stores information about the execution environment of jobs, a single context should be shared
      * between many jobs.
@@ -29,15 +41,23 @@ namespace AZ
 
         JobContext(JobManager& jobManager)
             : m_jobManager(jobManager)
-            , m_cancelGroup(NULL) { }
+            , m_cancelGroup(NULL)
+            , m_defaultPriority(JobPriority::Normal) { }
 
         JobContext(JobManager& jobManager, JobCancelGroup& cancelGroup)
             : m_jobManager(jobManager)
-            , m_cancelGroup(&cancelGroup) { }
+            , m_cancelGroup(&cancelGroup)
+            , m_defaultPriority(JobPriority::Normal) { }
+
+        JobContext(JobManager& jobManager, JobPriority defaultPriority)
+            : m_jobManager(jobManager)
+            , m_cancelGroup(NULL)
+            , m_defaultPriority(defaultPriority) { }
 
         JobContext(const JobContext& rhs)
             : m_jobManager(rhs.m_jobManager)
-            , m_cancelGroup(rhs.m_cancelGroup) { }
+            , m_cancelGroup(rhs.m_cancelGroup)
+            , m_defaultPriority(rhs.m_defaultPriority) { }
 
         JobContext& operator=(const JobContext&) = delete;
 
@@ -50,6 +70,14 @@ namespace AZ
 
         JobCancelGroup* GetCancelGroup() const { return m_cancelGroup; }
 
+        /**
+         * Priority given to jobs created with this context, individual jobs can override it with Job::SetPriority.
+         * Call this only before jobs using this context have been created, it is not threadsafe.
+         */
+        void SetDefaultPriority(JobPriority priority) { m_defaultPriority = priority; }
+
+        JobPriority GetDefaultPriority() const { return m_defaultPriority; }
+
         /**
          * Sets the global job context, this is what will be used when creating a top-level job without specifying
          * the context explicitly.
@@ -68,6 +96,7 @@ namespace AZ
 
         JobManager& m_jobManager;
         JobCancelGroup* m_cancelGroup;
+        JobPriority m_defaultPriority;
     };
 }
 
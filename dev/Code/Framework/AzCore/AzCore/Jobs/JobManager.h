@@ -16,6 +16,10 @@
 #include <AzCore/Jobs/JobManagerDesc.h>
 #include <AzCore/Memory/Memory.h>
 
+// Records per thread job, steal and sleep events and streams them to the EventTraceDriller, must be defined before the
+// job manager implementation is included
+//#define JOBMANAGER_ENABLE_TIMELINE
+
 // Other job manager implementation could be chosen here on a per-platform basis.  The work stealing implementation requires thread local storage and atomics (pointer-sized, 32-bit)
 #if defined(AZ_THREAD_LOCAL)
 #   define AZCORE_JOBS_IMPL_WORK_STEALING
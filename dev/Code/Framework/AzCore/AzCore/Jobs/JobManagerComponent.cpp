@@ -18,6 +18,7 @@
 #include <AzCore/Serialization/EditContext.h>
 
 #include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerTopology.h>
 #include <AzCore/Jobs/JobContext.h>
 
 #include <AzCore/std/parallel/thread.h>
@@ -34,6 +35,7 @@ namespace AZ
         , m_jobGlobalContext(nullptr)
         , m_numberOfWorkerThreads(0)
         , m_firstThreadCPU(-1)
+        , m_useCacheTopology(false)
     {
     }
 
@@ -60,9 +62,16 @@ namespace AZ
         }
 
         threadDesc.m_cpuId = AFFINITY_MASK_USERTHREADS;
-        for (int i = 0; i < numberOfWorkerThreads; ++i)
+        if (m_useCacheTopology)
         {
-            desc.m_workerThreads.push_back(threadDesc);
+            JobManagerTopology::Detect().AddWorkerThreads(desc, numberOfWorkerThreads, threadDesc);
+        }
+        else
+        {
+            for (int i = 0; i < numberOfWorkerThreads; ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
         }
 
         m_jobManager = aznew JobManager(desc);
@@ -124,6 +133,7 @@ namespace AZ
                 ->Version(1)
                 ->Field("NumberOfWorkerThreads", &JobManagerComponent::m_numberOfWorkerThreads)
                 ->Field("FirstThreadCPUID", &JobManagerComponent::m_firstThreadCPU)
+                ->Field("UseCacheTopology", &JobManagerComponent::m_useCacheTopology)
                 ;
 
             if (EditContext* editContext = serializeContext->GetEditContext())
@@ -139,6 +149,7 @@ namespace AZ
                     ->DataElement(AZ::Edit::UIHandlers::SpinBox, &JobManagerComponent::m_firstThreadCPU, "CPU ID", "First CPU ID for a worker thread, each consecutive thread will use the next CPU ID. -1 Will not assign CPU Ids")
                         ->Attribute(AZ::Edit::Attributes::Min, -1)
                         ->Attribute(AZ::Edit::Attributes::Max, 16)
+                    ->DataElement(AZ::Edit::UIHandlers::CheckBox, &JobManagerComponent::m_useCacheTopology, "Cache aware stealing", "Groups worker threads by shared last level cache (L3 / NUMA node), workers steal within their group first")
                     ;
             }
         }
@@ -53,10 +53,18 @@ namespace AZ
         */
         int     m_stackSize;
 
-        JobManagerThreadDesc(int cpuId = -1, int priority = -100000, int stackSize = -1)
+        /**
+         *  Steal domain of the thread, usually the group of processors sharing a last level cache (see JobManagerTopology).
+         *  Workers steal from workers of their own domain first, and jobs can hint a domain with Job::SetAffinityDomain.
+         *  Default is 0, all workers in one domain.
+         */
+        int     m_stealDomain;
+
+        JobManagerThreadDesc(int cpuId = -1, int priority = -100000, int stackSize = -1, int stealDomain = 0)
             : m_cpuId(cpuId)
             , m_priority(priority)
             , m_stackSize(stackSize)
+            , m_stealDomain(stealDomain)
         {
         }
     };
@@ -70,5 +78,26 @@ namespace AZ
 
         using DescList = AZStd::fixed_vector<JobManagerThreadDesc, 64>;
         DescList m_workerThreads; ///< List of worker threads to create
+
+        /**
+         * Starvation guard for the priority lanes. Once a non-empty lower priority lane has been passed over this many
+         * times in a row, its next job is run ahead of the higher priority lanes. 0 disables the guard, in which case
+         * lower priority jobs only run when all higher priority lanes are empty.
+         */
+        unsigned int m_starvationLimit = 32;
+
+        /**
+         * Jobs with a deadline hint (see Job::SetDeadline) that has passed, or is less than this many microseconds away
+         * when the job becomes pending, are queued in the critical lane regardless of their priority.
+         */
+        unsigned int m_deadlinePromotionWindowUs = 0;
+
+        /**
+         * Opt-in limit on how deeply suspended jobs (WaitForChildren, StartAndWaitForCompletion) can nest on a worker.
+         * A suspended worker keeps processing jobs while it waits, which nests them on its stack. Past this depth it no
+         * longer steals from other workers and only runs jobs from its own queue or the global queue, which keeps
+         * unrelated work off its stack while its own children complete. 0 means no limit (default).
+         */
+        unsigned int m_maxSuspendDepth = 0;
     };
 }
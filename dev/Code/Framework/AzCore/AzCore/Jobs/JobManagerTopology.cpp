@@ -0,0 +1,258 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef AZ_UNITY_BUILD
+
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/Jobs/JobManagerTopology.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/string.h>
+
+#if defined(AZ_PLATFORM_LINUX) || defined(AZ_PLATFORM_ANDROID)
+#   include <stdio.h>
+#   include <stdlib.h>
+#endif
+
+namespace AZ
+{
+    namespace JobManagerTopologyInternal
+    {
+#if defined(AZ_PLATFORM_WINDOWS)
+        static void DetectDomains(JobManagerTopology& topology)
+        {
+            DWORD length = 0;
+            GetLogicalProcessorInformationEx(RelationCache, nullptr, &length);
+            if (GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+            {
+                return;
+            }
+
+            AZStd::vector<char> buffer(length);
+            if (!GetLogicalProcessorInformationEx(RelationCache, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data()), &length))
+            {
+                return;
+            }
+
+            //the last level cache defines the domains
+            BYTE lastLevel = 0;
+            for (DWORD offset = 0; offset < length; )
+            {
+                auto info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data() + offset);
+                lastLevel = AZStd::GetMax(lastLevel, info->Cache.Level);
+                offset += info->Size;
+            }
+
+            for (DWORD offset = 0; offset < length; )
+            {
+                auto info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data() + offset);
+                offset += info->Size;
+
+                //only the first processor group is supported, same as thread affinity masks
+                if (info->Cache.Level != lastLevel || info->Cache.GroupMask.Group != 0 || (info->Cache.Type != CacheUnified && info->Cache.Type != CacheData))
+                {
+                    continue;
+                }
+
+                JobManagerTopology::ProcessorList processors;
+                for (unsigned int processor = 0; processor < sizeof(KAFFINITY) * 8; ++processor)
+                {
+                    if (info->Cache.GroupMask.Mask & (KAFFINITY(1) << processor))
+                    {
+                        processors.push_back(processor);
+                    }
+                }
+
+                if (!processors.empty())
+                {
+                    topology.m_domains.push_back(AZStd::move(processors));
+                }
+            }
+        }
+#elif defined(AZ_PLATFORM_LINUX) || defined(AZ_PLATFORM_ANDROID)
+        static bool ReadLine(const char* path, char* line, int lineSize)
+        {
+            FILE* file = fopen(path, "r");
+            if (!file)
+            {
+                return false;
+            }
+
+            const bool result = fgets(line, lineSize, file) != nullptr;
+            fclose(file);
+            return result;
+        }
+
+        //parses sysfs cpu lists, i.e. "0-3,8-11"
+        static JobManagerTopology::ProcessorList ParseProcessorList(const char* list)
+        {
+            JobManagerTopology::ProcessorList processors;
+            unsigned int first = 0;
+            unsigned int last = 0;
+            int consumed = 0;
+            while (sscanf(list, "%u%n", &first, &consumed) == 1)
+            {
+                list += consumed;
+                last = first;
+                if (*list == '-' && sscanf(list + 1, "%u%n", &last, &consumed) == 1)
+                {
+                    list += consumed + 1;
+                }
+
+                for (unsigned int processor = first; processor <= last; ++processor)
+                {
+                    processors.push_back(processor);
+                }
+
+                if (*list != ',')
+                {
+                    break;
+                }
+                ++list;
+            }
+            return processors;
+        }
+
+        static void DetectDomains(JobManagerTopology& topology)
+        {
+            const unsigned int numProcessors = AZStd::thread::hardware_concurrency();
+
+            AZStd::vector<AZStd::string> domainKeys;
+            for (unsigned int processor = 0; processor < numProcessors; ++processor)
+            {
+                //the highest cache index reporting a level is the last level cache
+                char sharedList[256] = { 0 };
+                int lastLevel = 0;
+                for (unsigned int index = 0; index < 8; ++index)
+                {
+                    char path[128];
+                    char line[256];
+                    azsnprintf(path, AZ_ARRAY_SIZE(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/level", processor, index);
+                    if (!ReadLine(path, line, AZ_ARRAY_SIZE(line)))
+                    {
+                        break;
+                    }
+
+                    const int level = atoi(line);
+                    azsnprintf(path, AZ_ARRAY_SIZE(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/shared_cpu_list", processor, index);
+                    if (level >= lastLevel && ReadLine(path, line, AZ_ARRAY_SIZE(line)))
+                    {
+                        lastLevel = level;
+                        azstrcpy(sharedList, AZ_ARRAY_SIZE(sharedList), line);
+                    }
+                }
+
+                if (lastLevel == 0)
+                {
+                    //no cache information, fall back to a single domain
+                    topology.m_domains.clear();
+                    return;
+                }
+
+                const auto found = AZStd::find(domainKeys.begin(), domainKeys.end(), sharedList);
+                if (found == domainKeys.end())
+                {
+                    domainKeys.push_back(sharedList);
+                    topology.m_domains.push_back(ParseProcessorList(sharedList));
+                }
+            }
+        }
+#else
+        static void DetectDomains(JobManagerTopology&)
+        {
+        }
+#endif
+    }
+
+    JobManagerTopology JobManagerTopology::Detect()
+    {
+        JobManagerTopology topology;
+        JobManagerTopologyInternal::DetectDomains(topology);
+
+        if (topology.m_domains.empty())
+        {
+            ProcessorList processors;
+            const unsigned int numProcessors = AZStd::thread::hardware_concurrency();
+            for (unsigned int processor = 0; processor < numProcessors; ++processor)
+            {
+                processors.push_back(processor);
+            }
+            topology.m_domains.push_back(AZStd::move(processors));
+        }
+
+        return topology;
+    }
+
+    AZ::u32 JobManagerTopology::GetDomainMask(unsigned int domain) const
+    {
+        AZ::u32 mask = 0;
+        if (domain < m_domains.size())
+        {
+            for (unsigned int processor : m_domains[domain])
+            {
+                if (processor < 32)
+                {
+                    mask |= (1u << processor);
+                }
+            }
+        }
+        return mask;
+    }
+
+    void JobManagerTopology::AddWorkerThreads(JobManagerDesc& desc, unsigned int numWorkers, const JobManagerThreadDesc& threadDesc, bool pinToProcessor) const
+    {
+        //interleave the domains so that a partial set of workers is still spread over all of them
+        AZStd::vector<AZStd::pair<unsigned int, unsigned int>> processors; // (domain, processor)
+        for (size_t slot = 0; processors.size() < numWorkers; ++slot)
+        {
+            bool isSlotUsed = false;
+            for (unsigned int domain = 0; domain < m_domains.size(); ++domain)
+            {
+                if (slot < m_domains[domain].size())
+                {
+                    processors.emplace_back(domain, m_domains[domain][slot]);
+                    isSlotUsed = true;
+                }
+            }
+
+            if (!isSlotUsed)
+            {
+                break;
+            }
+        }
+
+        if (processors.empty())
+        {
+            return;
+        }
+
+        for (unsigned int i = 0; i < numWorkers && desc.m_workerThreads.size() < desc.m_workerThreads.capacity(); ++i)
+        {
+            const AZStd::pair<unsigned int, unsigned int>& processor = processors[i % processors.size()];
+
+            JobManagerThreadDesc workerDesc = threadDesc;
+            workerDesc.m_stealDomain = static_cast<int>(processor.first);
+            if (pinToProcessor)
+            {
+#if defined(AZ_PLATFORM_WINDOWS)
+                //affinity mask
+                workerDesc.m_cpuId = (processor.second < 32) ? static_cast<int>(1u << processor.second) : -1;
+#else
+                //processor index
+                workerDesc.m_cpuId = static_cast<int>(processor.second);
+#endif
+            }
+            desc.m_workerThreads.push_back(workerDesc);
+        }
+    }
+}
+
+#endif // #ifndef AZ_UNITY_BUILD
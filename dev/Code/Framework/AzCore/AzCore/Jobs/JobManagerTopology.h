@@ -0,0 +1,47 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    /**
+     * Groups of logical processors which share a last level cache (an L3 cluster, AMD CCX, or a socket on NUMA
+     * machines). Stealing jobs within a group is much cheaper than across groups, so the job manager uses these as
+     * steal domains, see JobManagerThreadDesc::m_stealDomain. Engine threads can be placed with the same grouping
+     * (ThreadConfigManager "CacheDomain" attribute) to keep them off the job workers' caches.
+     */
+    struct JobManagerTopology
+    {
+        using ProcessorList = AZStd::vector<unsigned int>;
+
+        AZStd::vector<ProcessorList> m_domains;
+
+        /**
+         * Queries the processor cache layout from the OS. Platforms without that information (or when the query fails)
+         * report a single domain containing all processors.
+         */
+        static JobManagerTopology Detect();
+
+        /// Bitfield of the processors in a domain, processors above 31 are not representable and left out
+        AZ::u32 GetDomainMask(unsigned int domain) const;
+
+        /**
+         * Appends numWorkers thread descriptors to desc (up to its capacity), based on threadDesc and spread evenly over
+         * the processors of all domains. If pinToProcessor is set each worker is restricted to its processor.
+         */
+        void AddWorkerThreads(JobManagerDesc& desc, unsigned int numWorkers, const JobManagerThreadDesc& threadDesc, bool pinToProcessor = false) const;
+    };
+}
@@ -0,0 +1,197 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef AZ_UNITY_BUILD
+
+#include <AzCore/Math/BatchMath.h>
+
+using namespace AZ;
+
+namespace
+{
+    // The last batch of an array is padded by repeating its last element, so the full width kernels can run on it
+    // and only the valid results are written back.
+    template<class T>
+    AZ_MATH_FORCE_INLINE void LoadTail(const T* values, size_t count, T* tailOut)
+    {
+        for (size_t i = 0; i < 4; ++i)
+        {
+            tailOut[i] = values[i < count ? i : count - 1];
+        }
+    }
+
+    template<class T>
+    AZ_MATH_FORCE_INLINE void StoreTail(const T* tail, size_t count, T* valuesOut)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            valuesOut[i] = tail[i];
+        }
+    }
+
+    AZ_MATH_FORCE_INLINE void TransformAabbs4(const Transformx4& transform, const Aabb* aabbs, Aabb* aabbsOut)
+    {
+        // center and half extents form, the transformed half extents are |R| * halfExtents
+        const Vector3x4 min(aabbs[0].GetMin(), aabbs[1].GetMin(), aabbs[2].GetMin(), aabbs[3].GetMin());
+        const Vector3x4 max(aabbs[0].GetMax(), aabbs[1].GetMax(), aabbs[2].GetMax(), aabbs[3].GetMax());
+        const Vector4 half(0.5f);
+        const Vector3x4 center = transform.TransformPoint((min + max) * half);
+        const Vector3x4 halfExtents = (max - min) * half;
+
+        Vector3x4 rotatedExtents;
+        rotatedExtents.SetX(transform.GetElement(0, 0).GetAbs() * halfExtents.GetX() + transform.GetElement(0, 1).GetAbs() * halfExtents.GetY() + transform.GetElement(0, 2).GetAbs() * halfExtents.GetZ());
+        rotatedExtents.SetY(transform.GetElement(1, 0).GetAbs() * halfExtents.GetX() + transform.GetElement(1, 1).GetAbs() * halfExtents.GetY() + transform.GetElement(1, 2).GetAbs() * halfExtents.GetZ());
+        rotatedExtents.SetZ(transform.GetElement(2, 0).GetAbs() * halfExtents.GetX() + transform.GetElement(2, 1).GetAbs() * halfExtents.GetY() + transform.GetElement(2, 2).GetAbs() * halfExtents.GetZ());
+
+        Vector3 newMin[4];
+        Vector3 newMax[4];
+        (center - rotatedExtents).StoreToVector3s(newMin);
+        (center + rotatedExtents).StoreToVector3s(newMax);
+        for (int i = 0; i < 4; ++i)
+        {
+            aabbsOut[i] = Aabb::CreateFromMinMax(newMin[i], newMax[i]);
+        }
+    }
+}
+
+namespace AZ
+{
+    //=======================================================================
+    //
+    // TransformPoints
+    //
+    //=======================================================================
+    void TransformPoints(const Transform& transform, const Vector3* points, Vector3* pointsOut, size_t count)
+    {
+        const Transformx4 transform4 = Transformx4::CreateFromTransform(transform);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            transform4.TransformPoint(Vector3x4::CreateFromVector3s(&points[i])).StoreToVector3s(&pointsOut[i]);
+        }
+        if (i < count)
+        {
+            Vector3 tail[4];
+            LoadTail(&points[i], count - i, tail);
+            transform4.TransformPoint(Vector3x4::CreateFromVector3s(tail)).StoreToVector3s(tail);
+            StoreTail(tail, count - i, &pointsOut[i]);
+        }
+    }
+
+    //=======================================================================
+    //
+    // MultiplyTransforms
+    //
+    //=======================================================================
+    void MultiplyTransforms(const Transform& lhs, const Transform* rhs, Transform* transformsOut, size_t count)
+    {
+        const Transformx4 lhs4 = Transformx4::CreateFromTransform(lhs);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            (lhs4 * Transformx4::CreateFromTransforms(&rhs[i])).StoreToTransforms(&transformsOut[i]);
+        }
+        if (i < count)
+        {
+            Transform tail[4];
+            LoadTail(&rhs[i], count - i, tail);
+            (lhs4 * Transformx4::CreateFromTransforms(tail)).StoreToTransforms(tail);
+            StoreTail(tail, count - i, &transformsOut[i]);
+        }
+    }
+
+    void MultiplyTransforms(const Transform* lhs, const Transform* rhs, Transform* transformsOut, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            (Transformx4::CreateFromTransforms(&lhs[i]) * Transformx4::CreateFromTransforms(&rhs[i])).StoreToTransforms(&transformsOut[i]);
+        }
+        if (i < count)
+        {
+            Transform lhsTail[4];
+            Transform rhsTail[4];
+            LoadTail(&lhs[i], count - i, lhsTail);
+            LoadTail(&rhs[i], count - i, rhsTail);
+            (Transformx4::CreateFromTransforms(lhsTail) * Transformx4::CreateFromTransforms(rhsTail)).StoreToTransforms(lhsTail);
+            StoreTail(lhsTail, count - i, &transformsOut[i]);
+        }
+    }
+
+    //=======================================================================
+    //
+    // TransformAabbs
+    //
+    //=======================================================================
+    void TransformAabbs(const Transform& transform, const Aabb* aabbs, Aabb* aabbsOut, size_t count)
+    {
+        const Transformx4 transform4 = Transformx4::CreateFromTransform(transform);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            TransformAabbs4(transform4, &aabbs[i], &aabbsOut[i]);
+        }
+        if (i < count)
+        {
+            Aabb tail[4];
+            LoadTail(&aabbs[i], count - i, tail);
+            TransformAabbs4(transform4, tail, tail);
+            StoreTail(tail, count - i, &aabbsOut[i]);
+        }
+    }
+
+    void TransformAabbs(const Transform* transforms, const Aabb* aabbs, Aabb* aabbsOut, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            TransformAabbs4(Transformx4::CreateFromTransforms(&transforms[i]), &aabbs[i], &aabbsOut[i]);
+        }
+        if (i < count)
+        {
+            Transform transformTail[4];
+            Aabb tail[4];
+            LoadTail(&transforms[i], count - i, transformTail);
+            LoadTail(&aabbs[i], count - i, tail);
+            TransformAabbs4(Transformx4::CreateFromTransforms(transformTail), tail, tail);
+            StoreTail(tail, count - i, &aabbsOut[i]);
+        }
+    }
+
+    //=======================================================================
+    //
+    // GetAabbUnion
+    //
+    //=======================================================================
+    const Aabb GetAabbUnion(const Aabb* aabbs, size_t count)
+    {
+        // each Vector3 min/max is already one SIMD instruction, 4 independent accumulators keep the pipeline busy
+        Aabb result[4] = { Aabb::CreateNull(), Aabb::CreateNull(), Aabb::CreateNull(), Aabb::CreateNull() };
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            result[0].AddAabb(aabbs[i]);
+            result[1].AddAabb(aabbs[i + 1]);
+            result[2].AddAabb(aabbs[i + 2]);
+            result[3].AddAabb(aabbs[i + 3]);
+        }
+        for (; i < count; ++i)
+        {
+            result[0].AddAabb(aabbs[i]);
+        }
+        result[0].AddAabb(result[1]);
+        result[2].AddAabb(result[3]);
+        result[0].AddAabb(result[2]);
+        return result[0];
+    }
+}
+
+#endif // #ifndef AZ_UNITY_BUILD
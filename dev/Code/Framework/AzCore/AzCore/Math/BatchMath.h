@@ -0,0 +1,200 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+
+namespace AZ
+{
+    /**
+     * Contains 4 separate Vector3's, in structure-of-arrays form to fully leverage 4 way SIMD instructions.
+     * Each of x, y and z holds that component of all 4 vectors, so every Vector4 operation works on 4 vectors at once.
+     */
+    class Vector3x4
+    {
+    public:
+        ///Default constructor does not initialize the vectors.
+        Vector3x4() {}
+
+        ///Transposes 4 vectors into structure-of-arrays form.
+        explicit Vector3x4(const Vector3& v0, const Vector3& v1, const Vector3& v2, const Vector3& v3);
+
+        explicit Vector3x4(const Vector4& x, const Vector4& y, const Vector4& z)
+            : m_x(x)
+            , m_y(y)
+            , m_z(z) {}
+
+        ///Copies the vector into all 4 lanes.
+        static AZ_MATH_FORCE_INLINE const Vector3x4 CreateFromVector3(const Vector3& v)  { return Vector3x4(Vector4(v.GetX()), Vector4(v.GetY()), Vector4(v.GetZ())); }
+
+        ///Loads values[0] to values[3].
+        static AZ_MATH_FORCE_INLINE const Vector3x4 CreateFromVector3s(const Vector3* values)  { return Vector3x4(values[0], values[1], values[2], values[3]); }
+
+        ///Transposes back and stores all 4 vectors to values[0] to values[3].
+        void StoreToVector3s(Vector3* values) const;
+
+        AZ_MATH_FORCE_INLINE const Vector4& GetX() const    { return m_x; }
+        AZ_MATH_FORCE_INLINE const Vector4& GetY() const    { return m_y; }
+        AZ_MATH_FORCE_INLINE const Vector4& GetZ() const    { return m_z; }
+        AZ_MATH_FORCE_INLINE void SetX(const Vector4& x)    { m_x = x; }
+        AZ_MATH_FORCE_INLINE void SetY(const Vector4& y)    { m_y = y; }
+        AZ_MATH_FORCE_INLINE void SetZ(const Vector4& z)    { m_z = z; }
+
+        ///Extracts a single vector, this is slow, use StoreToVector3s when all 4 are needed.
+        AZ_MATH_FORCE_INLINE const Vector3 GetVector3(int index) const  { return Vector3(m_x.GetElement(index), m_y.GetElement(index), m_z.GetElement(index)); }
+
+        ///Dot products of the 4 pairs of vectors.
+        AZ_MATH_FORCE_INLINE const Vector4 Dot(const Vector3x4& rhs) const      { return m_x * rhs.m_x + m_y * rhs.m_y + m_z * rhs.m_z; }
+
+        AZ_MATH_FORCE_INLINE const Vector3x4 GetAbs() const     { return Vector3x4(m_x.GetAbs(), m_y.GetAbs(), m_z.GetAbs()); }
+
+        AZ_MATH_FORCE_INLINE const Vector3x4 operator-() const                      { return Vector3x4(-m_x, -m_y, -m_z); }
+        AZ_MATH_FORCE_INLINE const Vector3x4 operator+(const Vector3x4& rhs) const  { return Vector3x4(m_x + rhs.m_x, m_y + rhs.m_y, m_z + rhs.m_z); }
+        AZ_MATH_FORCE_INLINE const Vector3x4 operator-(const Vector3x4& rhs) const  { return Vector3x4(m_x - rhs.m_x, m_y - rhs.m_y, m_z - rhs.m_z); }
+        AZ_MATH_FORCE_INLINE const Vector3x4 operator*(const Vector3x4& rhs) const  { return Vector3x4(m_x * rhs.m_x, m_y * rhs.m_y, m_z * rhs.m_z); }
+        ///Scales each of the 4 vectors by the matching lane of the multiplier.
+        AZ_MATH_FORCE_INLINE const Vector3x4 operator*(const Vector4& multiplier) const { return Vector3x4(m_x * multiplier, m_y * multiplier, m_z * multiplier); }
+
+        AZ_MATH_FORCE_INLINE Vector3x4& operator+=(const Vector3x4& rhs)
+        {
+            *this = (*this) + rhs;
+            return *this;
+        }
+        AZ_MATH_FORCE_INLINE Vector3x4& operator-=(const Vector3x4& rhs)
+        {
+            *this = (*this) - rhs;
+            return *this;
+        }
+
+    private:
+        Vector4 m_x;
+        Vector4 m_y;
+        Vector4 m_z;
+    };
+
+    /**
+     * Contains 4 separate Transforms, in structure-of-arrays form. GetElement(row, col) holds that element of all 4
+     * transforms, so a batch of 4 points or transforms is processed with the same number of instructions as a single one.
+     */
+    class Transformx4
+    {
+    public:
+        ///Default constructor does not initialize the transforms.
+        Transformx4() {}
+
+        ///Transposes 4 transforms into structure-of-arrays form.
+        explicit Transformx4(const Transform& t0, const Transform& t1, const Transform& t2, const Transform& t3);
+
+        ///Copies the transform into all 4 lanes.
+        static const Transformx4 CreateFromTransform(const Transform& t);
+
+        ///Loads values[0] to values[3].
+        static AZ_MATH_FORCE_INLINE const Transformx4 CreateFromTransforms(const Transform* values)  { return Transformx4(values[0], values[1], values[2], values[3]); }
+
+        ///Transposes back and stores all 4 transforms to values[0] to values[3].
+        void StoreToTransforms(Transform* values) const;
+
+        AZ_MATH_FORCE_INLINE const Vector4& GetElement(int row, int col) const      { return m_elements[row][col]; }
+        AZ_MATH_FORCE_INLINE void SetElement(int row, int col, const Vector4& value) { m_elements[row][col] = value; }
+
+        AZ_MATH_FORCE_INLINE const Vector3x4 GetTranslation() const { return Vector3x4(m_elements[0][3], m_elements[1][3], m_elements[2][3]); }
+
+        ///Transforms 4 points, lane i of the point by lane i of the transform.
+        const Vector3x4 TransformPoint(const Vector3x4& p) const;
+
+        ///Transforms 4 vectors by the upper 3x3 part, ignoring the translation.
+        const Vector3x4 Multiply3x3(const Vector3x4& v) const;
+
+        ///Multiplies the 4 pairs of transforms, the same as Transform::operator* for each lane.
+        const Transformx4 operator*(const Transformx4& rhs) const;
+
+    private:
+        Vector4 m_elements[3][4];
+    };
+
+    AZ_MATH_FORCE_INLINE const Transformx4 Transformx4::CreateFromTransform(const Transform& t)
+    {
+        Transformx4 result;
+        for (int row = 0; row < 3; ++row)
+        {
+            for (int col = 0; col < 4; ++col)
+            {
+                result.m_elements[row][col] = Vector4(t.GetElement(row, col));
+            }
+        }
+        return result;
+    }
+
+    AZ_MATH_FORCE_INLINE const Vector3x4 Transformx4::TransformPoint(const Vector3x4& p) const
+    {
+        return Multiply3x3(p) + GetTranslation();
+    }
+
+    AZ_MATH_FORCE_INLINE const Vector3x4 Transformx4::Multiply3x3(const Vector3x4& v) const
+    {
+        const Vector4 x = m_elements[0][0] * v.GetX() + m_elements[0][1] * v.GetY() + m_elements[0][2] * v.GetZ();
+        const Vector4 y = m_elements[1][0] * v.GetX() + m_elements[1][1] * v.GetY() + m_elements[1][2] * v.GetZ();
+        const Vector4 z = m_elements[2][0] * v.GetX() + m_elements[2][1] * v.GetY() + m_elements[2][2] * v.GetZ();
+        return Vector3x4(x, y, z);
+    }
+
+    AZ_MATH_FORCE_INLINE const Transformx4 Transformx4::operator*(const Transformx4& rhs) const
+    {
+        Transformx4 result;
+        for (int row = 0; row < 3; ++row)
+        {
+            const Vector4& a0 = m_elements[row][0];
+            const Vector4& a1 = m_elements[row][1];
+            const Vector4& a2 = m_elements[row][2];
+            for (int col = 0; col < 4; ++col)
+            {
+                result.m_elements[row][col] = a0 * rhs.m_elements[0][col] + a1 * rhs.m_elements[1][col] + a2 * rhs.m_elements[2][col];
+            }
+            result.m_elements[row][3] += m_elements[row][3];
+        }
+        return result;
+    }
+
+    //===============================================================
+    // Batch kernels
+    //===============================================================
+    // All kernels process the arrays 4 elements at a time and handle any count, the output may alias the input.
+
+    ///pointsOut[i] = transform * points[i]
+    void TransformPoints(const Transform& transform, const Vector3* points, Vector3* pointsOut, size_t count);
+
+    ///transformsOut[i] = lhs * rhs[i], e.g. the world transforms of all children of one parent.
+    void MultiplyTransforms(const Transform& lhs, const Transform* rhs, Transform* transformsOut, size_t count);
+
+    ///transformsOut[i] = lhs[i] * rhs[i]
+    void MultiplyTransforms(const Transform* lhs, const Transform* rhs, Transform* transformsOut, size_t count);
+
+    ///aabbsOut[i] is aabbs[i] transformed by transform, the same box as Aabb::GetTransformedAabb (up to rounding).
+    ///The boxes must be valid, a null Aabb doesn't stay null.
+    void TransformAabbs(const Transform& transform, const Aabb* aabbs, Aabb* aabbsOut, size_t count);
+
+    ///aabbsOut[i] is aabbs[i] transformed by transforms[i].
+    void TransformAabbs(const Transform* transforms, const Aabb* aabbs, Aabb* aabbsOut, size_t count);
+
+    ///Returns the box containing all the boxes, a null Aabb if count is 0.
+    const Aabb GetAabbUnion(const Aabb* aabbs, size_t count);
+}
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD
+    #include <AzCore/Math/Internal/BatchMathWin32.inl>
+#else
+    #include <AzCore/Math/Internal/BatchMathFpu.inl>
+#endif
@@ -119,6 +119,45 @@ namespace AZ
         Set(data, size, forceLowerCase);
     }
 
+    namespace
+    {
+        /**
+         * Tables for processing 8 bytes per step ("slicing-by-8"), m_table[n][b] is the crc of byte b followed by n zero bytes.
+         * This is the same CRC-32 (not the CRC-32C the SSE4.2/ARMv8 instructions compute), so all stored crcs stay valid.
+         */
+        struct CrcSliceTables
+        {
+            CrcSliceTables()
+            {
+                for (unsigned int i = 0; i < 256; ++i)
+                {
+                    m_table[0][i] = crc_table[i];
+                }
+                for (unsigned int slice = 1; slice < 8; ++slice)
+                {
+                    for (unsigned int i = 0; i < 256; ++i)
+                    {
+                        const unsigned int prev = m_table[slice - 1][i];
+                        m_table[slice][i] = (prev >> 8) ^ crc_table[prev & 0xff];
+                    }
+                }
+            }
+
+            unsigned int m_table[8][256];
+        };
+
+        const CrcSliceTables& GetCrcSliceTables()
+        {
+            static const CrcSliceTables s_tables;
+            return s_tables;
+        }
+
+        inline unsigned char CrcToLower(unsigned char c)
+        {
+            return ((c >= 'A') && (c <= 'Z')) ? static_cast<unsigned char>(c + 'a' - 'A') : c;
+        }
+    } // namespace
+
     //=========================================================================
     //
     // Crc32 - Set
@@ -135,21 +174,43 @@ namespace AZ
         else
         {
             unsigned int crc = 0xffffffffL;
+#if !defined(AZ_BIG_ENDIAN)
+            // most strings are short, only use the big tables for longer data
+            if (size >= 16)
+            {
+                const unsigned int (&table)[8][256] = GetCrcSliceTables().m_table;
+                unsigned char block[8];
+                while (size >= 8)
+                {
+                    if (forceLowerCase)
+                    {
+                        for (int i = 0; i < 8; ++i)
+                        {
+                            block[i] = CrcToLower(buf[i]);
+                        }
+                    }
+                    else
+                    {
+                        memcpy(block, buf, 8);
+                    }
+                    u32 low, high;
+                    memcpy(&low, block, 4);
+                    memcpy(&high, block + 4, 4);
+                    low ^= crc;
+                    crc = table[7][low & 0xff] ^ table[6][(low >> 8) & 0xff] ^ table[5][(low >> 16) & 0xff] ^ table[4][low >> 24] ^
+                          table[3][high & 0xff] ^ table[2][(high >> 8) & 0xff] ^ table[1][(high >> 16) & 0xff] ^ table[0][high >> 24];
+                    buf += 8;
+                    size -= 8;
+                }
+            }
+#endif // !AZ_BIG_ENDIAN
             if (size)
             {
                 if (forceLowerCase)
                 {
                     do
                     {
-                        if ((*buf >= 'A') && (*buf <= 'Z'))
-                        {
-                            crc = CRC32(crc, (*buf) + 'a' - 'A');
-                            buf++;
-                        }
-                        else
-                        {
-                            crc = CRC32(crc, *buf++);
-                        }
+                        crc = CRC32(crc, CrcToLower(*buf++));
                     } while (--size);
                 }
                 else
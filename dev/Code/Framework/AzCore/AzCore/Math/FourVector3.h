@@ -12,25 +12,12 @@
 #ifndef AZCORE_MATH_FOURVECTOR3_H
 #define AZCORE_MATH_FOURVECTOR3_H 1
 
+#include <AzCore/Math/BatchMath.h>
+
 namespace AZ
 {
-    /**
-     * Contains 4 separate Vector3's, in structure-of-arrays form to fully leverage 4 way SIMD instructions.
-     */
-    class FourVector3
-    {
-    public:
-        explicit FourVector3(const Vector3& v0, const Vector3& v1, const Vector3& v2, const Vector3& v3);
-        explicit FourVector3(const Vector4& x, const Vector4& y, const Vector4& z);
-        AZ_MATH_FORCE_INLINE const FourVector3 operator+(const FourVector3& rhs) const
-        {
-            return FourVector3(m_x + rhs.m_x, m_y + rhs.m_y, m_z + rhs.m_z);
-        }
-    private:
-        Vector4 m_x;
-        Vector4 m_y;
-        Vector4 m_z;
-    };
+    ///The structure-of-arrays Vector3 lives in BatchMath.h now, together with the batch transform kernels.
+    typedef Vector3x4 FourVector3;
 }
 
 #endif
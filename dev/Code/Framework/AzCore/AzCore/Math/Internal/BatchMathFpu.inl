@@ -0,0 +1,51 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+namespace AZ
+{
+    AZ_MATH_FORCE_INLINE Vector3x4::Vector3x4(const Vector3& v0, const Vector3& v1, const Vector3& v2, const Vector3& v3)
+        : m_x(v0.GetX(), v1.GetX(), v2.GetX(), v3.GetX())
+        , m_y(v0.GetY(), v1.GetY(), v2.GetY(), v3.GetY())
+        , m_z(v0.GetZ(), v1.GetZ(), v2.GetZ(), v3.GetZ())
+    {
+    }
+
+    AZ_MATH_FORCE_INLINE void Vector3x4::StoreToVector3s(Vector3* values) const
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            values[i].Set(m_x.GetElement(i), m_y.GetElement(i), m_z.GetElement(i));
+        }
+    }
+
+    AZ_MATH_FORCE_INLINE Transformx4::Transformx4(const Transform& t0, const Transform& t1, const Transform& t2, const Transform& t3)
+    {
+        for (int row = 0; row < 3; ++row)
+        {
+            for (int col = 0; col < 4; ++col)
+            {
+                m_elements[row][col].Set(t0.GetElement(row, col), t1.GetElement(row, col), t2.GetElement(row, col), t3.GetElement(row, col));
+            }
+        }
+    }
+
+    AZ_MATH_FORCE_INLINE void Transformx4::StoreToTransforms(Transform* values) const
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            for (int row = 0; row < 3; ++row)
+            {
+                values[i].SetRow(row, m_elements[row][0].GetElement(i), m_elements[row][1].GetElement(i), m_elements[row][2].GetElement(i), m_elements[row][3].GetElement(i));
+            }
+        }
+    }
+}
@@ -0,0 +1,71 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+namespace AZ
+{
+    AZ_MATH_FORCE_INLINE Vector3x4::Vector3x4(const Vector3& v0, const Vector3& v1, const Vector3& v2, const Vector3& v3)
+    {
+        SimdVectorType r0 = v0.m_value;
+        SimdVectorType r1 = v1.m_value;
+        SimdVectorType r2 = v2.m_value;
+        SimdVectorType r3 = v3.m_value;
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        m_x = Vector4(r0);
+        m_y = Vector4(r1);
+        m_z = Vector4(r2);
+    }
+
+    AZ_MATH_FORCE_INLINE void Vector3x4::StoreToVector3s(Vector3* values) const
+    {
+        SimdVectorType r0 = m_x.m_value;
+        SimdVectorType r1 = m_y.m_value;
+        SimdVectorType r2 = m_z.m_value;
+        SimdVectorType r3 = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        values[0] = Vector3(r0);
+        values[1] = Vector3(r1);
+        values[2] = Vector3(r2);
+        values[3] = Vector3(r3);
+    }
+
+    AZ_MATH_FORCE_INLINE Transformx4::Transformx4(const Transform& t0, const Transform& t1, const Transform& t2, const Transform& t3)
+    {
+        for (int row = 0; row < 3; ++row)
+        {
+            SimdVectorType c0 = t0.m_rows[row];
+            SimdVectorType c1 = t1.m_rows[row];
+            SimdVectorType c2 = t2.m_rows[row];
+            SimdVectorType c3 = t3.m_rows[row];
+            _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+            m_elements[row][0] = Vector4(c0);
+            m_elements[row][1] = Vector4(c1);
+            m_elements[row][2] = Vector4(c2);
+            m_elements[row][3] = Vector4(c3);
+        }
+    }
+
+    AZ_MATH_FORCE_INLINE void Transformx4::StoreToTransforms(Transform* values) const
+    {
+        for (int row = 0; row < 3; ++row)
+        {
+            SimdVectorType r0 = m_elements[row][0].m_value;
+            SimdVectorType r1 = m_elements[row][1].m_value;
+            SimdVectorType r2 = m_elements[row][2].m_value;
+            SimdVectorType r3 = m_elements[row][3].m_value;
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            values[0].m_rows[row] = r0;
+            values[1].m_rows[row] = r1;
+            values[2].m_rows[row] = r2;
+            values[3].m_rows[row] = r3;
+        }
+    }
+}
@@ -386,6 +386,7 @@ namespace AZ
 
     private:
         friend class Matrix3x3;
+        friend class Transformx4;
         friend const Vector3 operator*(const Vector3& lhs, const Transform& rhs);
         friend const Vector4 operator*(const Vector4& lhs, const Transform& rhs);
 
@@ -373,6 +373,7 @@ namespace AZ
         friend class Matrix4x4;
         friend class Matrix3x3;
         friend class Quaternion;
+        friend class Vector3x4;
         friend const Vector3 operator*(const Vector3& lhs, const Transform& rhs);
         friend const Vector3 operator*(const Vector3& lhs, const Matrix4x4& rhs);
         friend const Vector3 operator*(const Vector3& lhs, const Matrix3x3& rhs);
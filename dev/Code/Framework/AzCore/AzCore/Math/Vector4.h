@@ -293,6 +293,8 @@ namespace AZ
         friend class Transform;
         friend class Matrix4x4;
         friend class Matrix3x3;
+        friend class Vector3x4;
+        friend class Transformx4;
         friend const Vector4 operator*(const Vector4& lhs, const Transform& rhs);
         friend const Vector4 operator*(const Vector4& lhs, const Matrix4x4& rhs);
 
@@ -0,0 +1,316 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef AZ_UNITY_BUILD
+
+#include <AzCore/Memory/AllocationSnapshot.h>
+#include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/Memory.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace Debug
+    {
+        namespace AllocationSnapshotInternal
+        {
+            typedef AZStd::unordered_map<AZ::u64, unsigned int, AZStd::hash<AZ::u64>, AZStd::equal_to<AZ::u64>, OSStdAllocator> IndexMapType;
+
+            // FNV-1a
+            static const AZ::u64 HashSeed = 14695981039346656037ull;
+
+            static AZ::u64 HashBytes(AZ::u64 hash, const void* data, size_t byteSize)
+            {
+                const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+                for (size_t i = 0; i < byteSize; ++i)
+                {
+                    hash = (hash ^ bytes[i]) * 1099511628211ull;
+                }
+                return hash;
+            }
+
+            static AZ::u64 HashString(AZ::u64 hash, const char* string)
+            {
+                return string ? HashBytes(hash, string, strlen(string)) : HashBytes(hash, "", 1);
+            }
+
+            /// Allocations are identified by the callstack if there is one, otherwise by the name and file/line.
+            static AZ::u64 HashAllocationSite(const AllocationInfo& info, unsigned char numStackLevels, unsigned int& numFrames)
+            {
+                AZ::u64 hash = HashSeed;
+                numFrames = 0;
+                if (info.m_stackFrames)
+                {
+                    for (unsigned char i = 0; i < numStackLevels; ++i)
+                    {
+                        if (info.m_stackFrames[i].IsValid())
+                        {
+                            hash = HashBytes(hash, &info.m_stackFrames[i].m_programCounter, sizeof(info.m_stackFrames[i].m_programCounter));
+                            ++numFrames;
+                        }
+                    }
+                }
+                if (numFrames == 0)
+                {
+                    hash = HashString(hash, info.m_name);
+                    hash = HashString(hash, info.m_fileName);
+                    hash = HashBytes(hash, &info.m_lineNum, sizeof(info.m_lineNum));
+                }
+                return hash;
+            }
+
+            static bool IsAddressLess(const AllocationSnapshot& lhsSnapshot, const AllocationSnapshot::Allocation& lhs, const AllocationSnapshot& rhsSnapshot, const AllocationSnapshot::Allocation& rhs)
+            {
+                if (lhs.m_address != rhs.m_address)
+                {
+                    return reinterpret_cast<uintptr_t>(lhs.m_address) < reinterpret_cast<uintptr_t>(rhs.m_address);
+                }
+                return reinterpret_cast<uintptr_t>(lhsSnapshot.GetAllocators()[lhs.m_allocator].m_allocator) < reinterpret_cast<uintptr_t>(rhsSnapshot.GetAllocators()[rhs.m_allocator].m_allocator);
+            }
+        }
+
+        //=========================================================================
+        // AllocationSnapshot
+        //=========================================================================
+        AllocationSnapshot::AllocationSnapshot()
+            : m_totalBytes(0)
+        {
+        }
+
+        //=========================================================================
+        // Capture
+        //=========================================================================
+        void AllocationSnapshot::Capture()
+        {
+            using namespace AllocationSnapshotInternal;
+
+            Clear();
+            m_strings.push_back(0); // offset 0 is "no string"
+
+            IndexMapType callstackIndices;
+            AllocatorManager& manager = AllocatorManager::Instance();
+            for (int i = 0; i < manager.GetNumAllocators(); ++i)
+            {
+                IAllocator* allocator = manager.GetAllocator(i);
+                AllocationRecords* records = allocator->GetRecords();
+                if (!records)
+                {
+                    continue;
+                }
+
+                const unsigned int allocatorIndex = static_cast<unsigned int>(m_allocators.size());
+                m_allocators.push_back({ allocator, allocator->GetName() });
+
+                AZStd::lock_guard<AllocationRecords> lock(*records);
+                const unsigned char numStackLevels = records->GetNumStackLevels();
+                const AllocationRecordsType& map = records->GetMap();
+                m_allocations.reserve(m_allocations.size() + map.size());
+                for (const AllocationRecordsType::value_type& record : map)
+                {
+                    const AllocationInfo& info = record.second;
+                    unsigned int numFrames;
+                    const AZ::u64 hash = HashAllocationSite(info, numStackLevels, numFrames);
+
+                    IndexMapType::pair_iter_bool callstackIter = callstackIndices.insert_key(hash);
+                    if (callstackIter.second)
+                    {
+                        callstackIter.first->second = static_cast<unsigned int>(m_callstacks.size());
+
+                        Callstack callstack;
+                        callstack.m_hash = hash;
+                        callstack.m_name = AddString(info.m_name);
+                        callstack.m_fileName = AddString(info.m_fileName);
+                        callstack.m_lineNum = info.m_lineNum;
+                        callstack.m_firstFrame = static_cast<unsigned int>(m_stackFrames.size());
+                        callstack.m_numFrames = numFrames;
+                        for (unsigned char iFrame = 0; numFrames > 0 && iFrame < numStackLevels; ++iFrame)
+                        {
+                            if (info.m_stackFrames[iFrame].IsValid())
+                            {
+                                m_stackFrames.push_back(info.m_stackFrames[iFrame]);
+                            }
+                        }
+                        m_callstacks.push_back(callstack);
+                    }
+
+                    m_allocations.push_back({ record.first, info.m_byteSize, allocatorIndex, callstackIter.first->second });
+                    m_totalBytes += info.m_byteSize;
+                }
+            }
+
+            AZStd::sort(m_allocations.begin(), m_allocations.end(), [this](const Allocation& lhs, const Allocation& rhs)
+            {
+                return IsAddressLess(*this, lhs, *this, rhs);
+            });
+        }
+
+        //=========================================================================
+        // Clear
+        //=========================================================================
+        void AllocationSnapshot::Clear()
+        {
+            m_allocations.set_capacity(0);
+            m_callstacks.set_capacity(0);
+            m_allocators.set_capacity(0);
+            m_stackFrames.set_capacity(0);
+            m_strings.set_capacity(0);
+            m_totalBytes = 0;
+        }
+
+        //=========================================================================
+        // GetString
+        //=========================================================================
+        const char* AllocationSnapshot::GetString(unsigned int offset) const
+        {
+            return offset != 0 ? &m_strings[offset] : nullptr;
+        }
+
+        //=========================================================================
+        // AddString
+        //=========================================================================
+        unsigned int AllocationSnapshot::AddString(const char* string)
+        {
+            if (!string)
+            {
+                return 0;
+            }
+            const unsigned int offset = static_cast<unsigned int>(m_strings.size());
+            m_strings.insert(m_strings.end(), string, string + strlen(string) + 1);
+            return offset;
+        }
+
+        //=========================================================================
+        // Diff
+        //=========================================================================
+        void AllocationSnapshot::Diff(const AllocationSnapshot& from, const AllocationSnapshot& to, AllocationSnapshotDiff& result)
+        {
+            using namespace AllocationSnapshotInternal;
+
+            result.Clear();
+
+            IndexMapType groupIndices;
+            const AllocationArrayType& fromAllocations = from.m_allocations;
+            size_t iFrom = 0;
+            for (const Allocation& allocation : to.m_allocations)
+            {
+                // both are sorted by address, everything in "from" before this allocation was freed
+                while (iFrom < fromAllocations.size() && IsAddressLess(from, fromAllocations[iFrom], to, allocation))
+                {
+                    ++result.m_numFreedAllocations;
+                    result.m_freedBytes += fromAllocations[iFrom].m_byteSize;
+                    ++iFrom;
+                }
+
+                const Callstack& callstack = to.m_callstacks[allocation.m_callstack];
+                if (iFrom < fromAllocations.size() && !IsAddressLess(to, allocation, from, fromAllocations[iFrom]))
+                {
+                    // same address in the same allocator, if the size and callstack match it's the same allocation
+                    const Allocation& fromAllocation = fromAllocations[iFrom++];
+                    if (fromAllocation.m_byteSize == allocation.m_byteSize && from.m_callstacks[fromAllocation.m_callstack].m_hash == callstack.m_hash)
+                    {
+                        continue;
+                    }
+                    ++result.m_numFreedAllocations;
+                    result.m_freedBytes += fromAllocation.m_byteSize;
+                }
+
+                ++result.m_numNewAllocations;
+                result.m_newBytes += allocation.m_byteSize;
+
+                const AllocatorInfo& allocator = to.m_allocators[allocation.m_allocator];
+                const uintptr_t allocatorAddress = reinterpret_cast<uintptr_t>(allocator.m_allocator);
+                const AZ::u64 groupKey = HashBytes(callstack.m_hash, &allocatorAddress, sizeof(allocatorAddress));
+                IndexMapType::pair_iter_bool groupIter = groupIndices.insert_key(groupKey);
+                if (groupIter.second)
+                {
+                    groupIter.first->second = static_cast<unsigned int>(result.m_groups.size());
+
+                    AllocationSnapshotDiff::Group group;
+                    group.m_allocatorName = allocator.m_name;
+                    group.m_name = to.GetString(callstack.m_name);
+                    group.m_fileName = to.GetString(callstack.m_fileName);
+                    group.m_lineNum = callstack.m_lineNum;
+                    group.m_stackFrames = callstack.m_numFrames ? &to.m_stackFrames[callstack.m_firstFrame] : nullptr;
+                    group.m_numFrames = callstack.m_numFrames;
+                    group.m_numAllocations = 0;
+                    group.m_byteSize = 0;
+                    result.m_groups.push_back(group);
+                }
+
+                AllocationSnapshotDiff::Group& group = result.m_groups[groupIter.first->second];
+                ++group.m_numAllocations;
+                group.m_byteSize += allocation.m_byteSize;
+            }
+
+            for (; iFrom < fromAllocations.size(); ++iFrom)
+            {
+                ++result.m_numFreedAllocations;
+                result.m_freedBytes += fromAllocations[iFrom].m_byteSize;
+            }
+
+            AZStd::sort(result.m_groups.begin(), result.m_groups.end(), [](const AllocationSnapshotDiff::Group& lhs, const AllocationSnapshotDiff::Group& rhs)
+            {
+                return lhs.m_byteSize != rhs.m_byteSize ? lhs.m_byteSize > rhs.m_byteSize : lhs.m_numAllocations > rhs.m_numAllocations;
+            });
+        }
+
+        //=========================================================================
+        // PrintDiff
+        //=========================================================================
+        void AllocationSnapshot::PrintDiff(const AllocationSnapshotDiff& diff, size_t maxGroups)
+        {
+            AZ_Printf("Memory", "Allocation snapshot diff: %zu new allocations (%zu bytes) from %zu callstacks, %zu freed allocations (%zu bytes)\n",
+                diff.m_numNewAllocations, diff.m_newBytes, diff.m_groups.size(), diff.m_numFreedAllocations, diff.m_freedBytes);
+
+            const size_t numGroups = AZStd::GetMin(maxGroups, diff.m_groups.size());
+            for (size_t iGroup = 0; iGroup < numGroups; ++iGroup)
+            {
+                const AllocationSnapshotDiff::Group& group = diff.m_groups[iGroup];
+                AZ_Printf("Memory", "%s: %zu allocations, %zu bytes, name \"%s\"\n", group.m_allocatorName, group.m_numAllocations, group.m_byteSize, group.m_name ? group.m_name : "");
+                if (group.m_numFrames == 0)
+                {
+                    AZ_Printf("Memory", " %s (%d)\n", group.m_fileName ? group.m_fileName : "<unknown>", group.m_lineNum);
+                    continue;
+                }
+
+                const unsigned int decodeStep = 40;
+                SymbolStorage::StackLine lines[decodeStep];
+                for (unsigned int iFrame = 0; iFrame < group.m_numFrames; iFrame += decodeStep)
+                {
+                    const unsigned int numToDecode = AZStd::GetMin(decodeStep, group.m_numFrames - iFrame);
+                    SymbolStorage::DecodeFrames(&group.m_stackFrames[iFrame], numToDecode, lines);
+                    for (unsigned int i = 0; i < numToDecode; ++i)
+                    {
+                        AZ_Printf("Memory", " %s\n", lines[i]);
+                    }
+                }
+            }
+        }
+
+        //=========================================================================
+        // Clear
+        //=========================================================================
+        void AllocationSnapshotDiff::Clear()
+        {
+            m_groups.clear();
+            m_numNewAllocations = 0;
+            m_newBytes = 0;
+            m_numFreedAllocations = 0;
+            m_freedBytes = 0;
+        }
+    } // namespace Debug
+} // namespace AZ
+
+#endif // #ifndef AZ_UNITY_BUILD
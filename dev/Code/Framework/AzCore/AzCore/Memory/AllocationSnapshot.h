@@ -0,0 +1,139 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Debug/StackTracer.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    class IAllocator;
+
+    namespace Debug
+    {
+        struct AllocationSnapshotDiff;
+
+        /**
+         * Copy of the allocation records of all allocators at one point in time, used to find the allocations that were
+         * made between two points and are still alive (for example leaks across a level transition):
+         * \code
+         * AllocationSnapshot before, after;
+         * before.Capture();
+         * ... load and unload a level ...
+         * after.Capture();
+         * AllocationSnapshotDiff diff;
+         * AllocationSnapshot::Diff(before, after, diff);
+         * AllocationSnapshot::PrintDiff(diff, 20);
+         * \endcode
+         * Only allocators with records are captured (see AllocationRecords and the MemoryDriller), callstacks are only
+         * available when the records mode stores them (RECORD_FULL or RECORD_STACK_IF_NO_FILE_LINE).
+         * The snapshot uses the OSAllocator, so capturing and diffing doesn't show up in the records itself.
+         */
+        class AllocationSnapshot
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(AllocationSnapshot, OSAllocator, 0);
+
+            /// Allocation site, shared by all allocations with the same callstack (or name/file/line if there is no callstack).
+            struct Callstack
+            {
+                AZ::u64         m_hash;
+                unsigned int    m_name;             ///< Offset in the string buffer, see GetString.
+                unsigned int    m_fileName;
+                int             m_lineNum;
+                unsigned int    m_firstFrame;       ///< Index of the first stack frame, see GetStackFrames.
+                unsigned int    m_numFrames;
+            };
+
+            struct Allocation
+            {
+                void*           m_address;
+                size_t          m_byteSize;
+                unsigned int    m_allocator;        ///< Index in GetAllocators.
+                unsigned int    m_callstack;        ///< Index in GetCallstacks.
+            };
+
+            struct AllocatorInfo
+            {
+                IAllocator*     m_allocator;
+                const char*     m_name;
+            };
+
+            typedef AZStd::vector<Allocation, OSStdAllocator>       AllocationArrayType;
+            typedef AZStd::vector<Callstack, OSStdAllocator>        CallstackArrayType;
+            typedef AZStd::vector<AllocatorInfo, OSStdAllocator>    AllocatorArrayType;
+
+            AllocationSnapshot();
+
+            /// Replaces the snapshot with the current records of all registered allocators.
+            void    Capture();
+            /// Releases the snapshot memory.
+            void    Clear();
+            bool    IsEmpty() const                                 { return m_allocations.empty(); }
+
+            /// Allocations sorted by address.
+            const AllocationArrayType&  GetAllocations() const      { return m_allocations; }
+            const CallstackArrayType&   GetCallstacks() const       { return m_callstacks; }
+            const AllocatorArrayType&   GetAllocators() const       { return m_allocators; }
+            const StackFrame*           GetStackFrames() const      { return m_stackFrames.data(); }
+            /// Returns a copied name or file name, NULL if the allocation didn't have one.
+            const char*                 GetString(unsigned int offset) const;
+            size_t                      GetTotalBytes() const       { return m_totalBytes; }
+
+            /// Groups the allocations of "to" that are not in "from" by allocator and callstack, biggest first.
+            static void Diff(const AllocationSnapshot& from, const AllocationSnapshot& to, AllocationSnapshotDiff& result);
+            /// Prints the totals and the first maxGroups groups of the diff with the decoded callstacks.
+            static void PrintDiff(const AllocationSnapshotDiff& diff, size_t maxGroups);
+
+        private:
+            AllocationSnapshot(const AllocationSnapshot&) = delete;
+            AllocationSnapshot& operator=(const AllocationSnapshot&) = delete;
+
+            unsigned int    AddString(const char* string);
+
+            AllocationArrayType                     m_allocations;
+            CallstackArrayType                      m_callstacks;
+            AllocatorArrayType                      m_allocators;
+            AZStd::vector<StackFrame, OSStdAllocator> m_stackFrames;
+            AZStd::vector<char, OSStdAllocator>     m_strings;
+            size_t                                  m_totalBytes;
+        };
+
+        /**
+         * Result of AllocationSnapshot::Diff. The names and stack frames point into the "to" snapshot, which must stay
+         * alive (and not be captured again) while the diff is used.
+         */
+        struct AllocationSnapshotDiff
+        {
+            struct Group
+            {
+                const char*         m_allocatorName;
+                const char*         m_name;
+                const char*         m_fileName;
+                int                 m_lineNum;
+                const StackFrame*   m_stackFrames;
+                unsigned int        m_numFrames;
+                size_t              m_numAllocations;
+                size_t              m_byteSize;
+            };
+
+            void Clear();
+
+            AZStd::vector<Group, OSStdAllocator>    m_groups;
+            size_t  m_numNewAllocations = 0;        ///< Allocations in "to" only
+            size_t  m_newBytes = 0;
+            size_t  m_numFreedAllocations = 0;      ///< Allocations in "from" only
+            size_t  m_freedBytes = 0;
+        };
+    } // namespace Debug
+} // namespace AZ
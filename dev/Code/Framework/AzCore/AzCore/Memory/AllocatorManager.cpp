@@ -53,6 +53,7 @@ AllocatorManager& AllocatorManager::Instance()
 AllocatorManager::AllocatorManager()
 {
     m_numAllocators = 0;
+    m_numBudgets = 0;
     m_isAllocatorLeaking = false;
     m_defaultTrackingRecordMode = AZ::Debug::AllocationRecords::RECORD_STACK_IF_NO_FILE_LINE;
 }
@@ -248,4 +249,156 @@ AllocatorManager::DebugBreak(void* address, const Debug::AllocationInfo& info)
     }
 }
 
+//=========================================================================
+// AddMemoryBudget
+//=========================================================================
+bool
+AllocatorManager::AddMemoryBudget(const char* budgetName, const char* allocatorName, size_t softLimit, size_t hardLimit)
+{
+    AZStd::lock_guard<AZStd::recursive_mutex> lock(m_budgetMutex);
+    MemoryBudget* budget = nullptr;
+    for (int i = 0; i < m_numBudgets; ++i)
+    {
+        if (strcmp(m_budgets[i].m_name, budgetName) == 0)
+        {
+            budget = &m_budgets[i];
+            break;
+        }
+    }
+
+    if (!budget)
+    {
+        if (m_numBudgets == MaxNumMemoryBudgets)
+        {
+            AZ_Warning("Memory", false, "Too many memory budgets, max is %d! Budget \"%s\" was not added.", MaxNumMemoryBudgets, budgetName);
+            return false;
+        }
+        budget = &m_budgets[m_numBudgets++];
+        azstrncpy(budget->m_name, MemoryBudget::MaxNameLength, budgetName, MemoryBudget::MaxNameLength - 1);
+        budget->m_name[MemoryBudget::MaxNameLength - 1] = 0;
+        budget->m_numAllocators = 0;
+        budget->m_allocatedBytes = 0;
+        budget->m_peakBytes = 0;
+        budget->m_state = MemoryBudget::BUDGET_OK;
+    }
+
+    bool isAllocatorAdded = false;
+    for (int i = 0; i < budget->m_numAllocators; ++i)
+    {
+        isAllocatorAdded |= strcmp(budget->m_allocatorNames[i], allocatorName) == 0;
+    }
+    if (!isAllocatorAdded)
+    {
+        if (budget->m_numAllocators == MemoryBudget::MaxNumAllocators)
+        {
+            AZ_Warning("Memory", false, "Memory budget \"%s\" already has %d allocators! Allocator \"%s\" was not added.", budget->m_name, MemoryBudget::MaxNumAllocators, allocatorName);
+            return false;
+        }
+        char* name = budget->m_allocatorNames[budget->m_numAllocators++];
+        azstrncpy(name, MemoryBudget::MaxNameLength, allocatorName, MemoryBudget::MaxNameLength - 1);
+        name[MemoryBudget::MaxNameLength - 1] = 0;
+    }
+
+    budget->m_softLimit = softLimit;
+    budget->m_hardLimit = hardLimit;
+    return true;
+}
+
+//=========================================================================
+// RemoveMemoryBudget
+//=========================================================================
+void
+AllocatorManager::RemoveMemoryBudget(const char* budgetName)
+{
+    AZStd::lock_guard<AZStd::recursive_mutex> lock(m_budgetMutex);
+    for (int i = 0; i < m_numBudgets; ++i)
+    {
+        if (strcmp(m_budgets[i].m_name, budgetName) == 0)
+        {
+            --m_numBudgets;
+            m_budgets[i] = m_budgets[m_numBudgets];
+            return;
+        }
+    }
+}
+
+//=========================================================================
+// UpdateMemoryBudgets
+//=========================================================================
+void
+AllocatorManager::UpdateMemoryBudgets()
+{
+    if (m_numBudgets == 0)
+    {
+        return;
+    }
+
+    AZStd::lock_guard<AZStd::recursive_mutex> lock(m_budgetMutex);
+    for (int iBudget = 0; iBudget < m_numBudgets; ++iBudget)
+    {
+        MemoryBudget& budget = m_budgets[iBudget];
+        size_t allocatedBytes = 0;
+        {
+            AZStd::lock_guard<AZStd::mutex> allocatorLock(m_allocatorListMutex);
+            for (int i = 0; i < m_numAllocators; ++i)
+            {
+                for (int iName = 0; iName < budget.m_numAllocators; ++iName)
+                {
+                    if (strcmp(m_allocators[i]->GetName(), budget.m_allocatorNames[iName]) == 0)
+                    {
+                        allocatedBytes += m_allocators[i]->NumAllocatedBytes();
+                        break;
+                    }
+                }
+            }
+        }
+
+        budget.m_allocatedBytes = allocatedBytes;
+        budget.m_peakBytes = AZStd::GetMax(budget.m_peakBytes, allocatedBytes);
+
+        MemoryBudget::State state = MemoryBudget::BUDGET_OK;
+        if (budget.m_hardLimit != 0 && allocatedBytes > budget.m_hardLimit)
+        {
+            state = MemoryBudget::BUDGET_OVER_HARD_LIMIT;
+        }
+        else if (budget.m_softLimit != 0 && allocatedBytes > budget.m_softLimit)
+        {
+            state = MemoryBudget::BUDGET_OVER_SOFT_LIMIT;
+        }
+
+        // only report changes, so a budget that stays over a limit doesn't flood the log every frame
+        if (state != budget.m_state)
+        {
+            budget.m_state = state;
+            switch (state)
+            {
+            case MemoryBudget::BUDGET_OVER_HARD_LIMIT:
+                AZ_Error("Memory", false, "Memory budget \"%s\" is over its hard limit: %zu bytes allocated, limit %zu bytes!", budget.m_name, allocatedBytes, budget.m_hardLimit);
+                break;
+            case MemoryBudget::BUDGET_OVER_SOFT_LIMIT:
+                AZ_Warning("Memory", false, "Memory budget \"%s\" is over its soft limit: %zu bytes allocated, limit %zu bytes.", budget.m_name, allocatedBytes, budget.m_softLimit);
+                break;
+            default:
+                AZ_TracePrintf("Memory", "Memory budget \"%s\" is back within its limits: %zu bytes allocated.\n", budget.m_name, allocatedBytes);
+                break;
+            }
+        }
+    }
+}
+
+//=========================================================================
+// GetMemoryBudget
+//=========================================================================
+bool
+AllocatorManager::GetMemoryBudget(int index, MemoryBudget& budget)
+{
+    AZStd::lock_guard<AZStd::recursive_mutex> lock(m_budgetMutex);
+    if (index < 0 || index >= m_numBudgets)
+    {
+        return false;
+    }
+    budget = m_budgets[index];
+    return true;
+}
+
 #endif // #ifndef AZ_UNITY_BUILD
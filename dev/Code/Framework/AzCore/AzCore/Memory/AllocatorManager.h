@@ -85,6 +85,50 @@ namespace AZ
         void ResetMemoryBreak(int slot = -1);
         //////////////////////////////////////////////////////////////////////////
 
+        //////////////////////////////////////////////////////////////////////////
+        // Memory budgets
+        static const int MaxNumMemoryBudgets = 16;
+        /**
+         * Named budget (usually a subsystem) for the allocated bytes of one or more allocators (by allocator name).
+         * A limit of 0 means no limit.
+         */
+        struct MemoryBudget
+        {
+            enum State : int
+            {
+                BUDGET_OK,
+                BUDGET_OVER_SOFT_LIMIT,
+                BUDGET_OVER_HARD_LIMIT,
+            };
+
+            static const int MaxNameLength = 64;
+            static const int MaxNumAllocators = 4;
+
+            char            m_name[MaxNameLength];
+            char            m_allocatorNames[MaxNumAllocators][MaxNameLength];
+            int             m_numAllocators;
+            size_t          m_softLimit;
+            size_t          m_hardLimit;
+            size_t          m_allocatedBytes;   ///< Sum of the allocators NumAllocatedBytes on the last UpdateMemoryBudgets.
+            size_t          m_peakBytes;
+            State           m_state;
+        };
+        /**
+         * Adds the allocator to the budget (creating it if needed) and sets the budget limits. Returns false if there
+         * are already MaxNumMemoryBudgets budgets or MaxNumAllocators allocators in the budget.
+         */
+        bool AddMemoryBudget(const char* budgetName, const char* allocatorName, size_t softLimit, size_t hardLimit);
+        void RemoveMemoryBudget(const char* budgetName);
+        /**
+         * Updates the allocated bytes of all budgets and reports the budgets that went over a limit (a warning for the
+         * soft limit, an error for the hard limit) or back under. Called every frame by the MemoryComponent.
+         */
+        void UpdateMemoryBudgets();
+        int GetNumMemoryBudgets() const { return m_numBudgets; }
+        /// Returns a copy of the budget (0 to GetNumMemoryBudgets), false if the index is invalid.
+        bool GetMemoryBudget(int index, MemoryBudget& budget);
+        //////////////////////////////////////////////////////////////////////////
+
         // Called from IAllocator
         void RegisterAllocator(IAllocator* alloc);
         void UnRegisterAllocator(IAllocator* alloc);
@@ -103,6 +147,9 @@ namespace AZ
         MemoryBreak         m_memoryBreak[MaxNumMemoryBreaks];
         char                m_activeBreaks;
         AZStd::mutex        m_allocatorListMutex;
+        MemoryBudget        m_budgets[MaxNumMemoryBudgets];
+        volatile int        m_numBudgets;
+        AZStd::recursive_mutex m_budgetMutex;      ///< Recursive as reporting can end up in budget queries (trace listeners).
 
         AZ::Debug::AllocationRecords::Mode m_defaultTrackingRecordMode;
 
@@ -0,0 +1,53 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/Memory/AllocatorBase.h>
+#include <AzCore/Memory/FrameArenaSchema.h>
+
+namespace AZ
+{
+    /**
+     * Allocator for temporary memory that is released at the end of the frame (see FrameArenaSchema).
+     * When created by the MemoryComponent (MemoryComponent::m_isFrameArenaAllocator) ResetFrame is called at the
+     * start of every tick, otherwise the owner of the allocator is responsible for calling it.
+     * Use it with AZStd containers and functions through FrameArenaStdAllocator, for example
+     * AZStd::vector<int, FrameArenaStdAllocator>. Such objects must not outlive the frame they were allocated in.
+     */
+    class FrameArenaAllocator
+        : public AllocatorBase<FrameArenaSchema>
+    {
+    public:
+        AZ_TYPE_INFO(FrameArenaAllocator, "{6B3A4C1E-8F0D-4A7B-9E25-3D1C7F0B5A92}");
+
+        using Base = AllocatorBase<FrameArenaSchema>;
+
+        FrameArenaAllocator()
+            : Base("FrameArenaAllocator", "Linear allocator for memory released every frame")
+        {
+        }
+
+        /// Releases all memory allocated since the last call, see FrameArenaSchema::ResetFrame.
+        void ResetFrame()
+        {
+            m_schema->ResetFrame();
+        }
+
+        /// Number of frames reset so far
+        unsigned int GetFrameId() const
+        {
+            return m_schema->GetFrameId();
+        }
+    };
+
+    typedef AZStdAlloc<FrameArenaAllocator> FrameArenaStdAllocator;
+}
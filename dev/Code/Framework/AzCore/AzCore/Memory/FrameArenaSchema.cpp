@@ -0,0 +1,476 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef AZ_UNITY_BUILD
+
+#include <AzCore/Memory/FrameArenaSchema.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    namespace FrameArenaInternal
+    {
+        static const unsigned char PoisonValue = 0xcd;  // same as the AllocationRecords mark value
+        static const size_t RegionAlignment = 64;
+
+        // Single entry cache of the calling thread region. Every module has its own copy of the thread locals and
+        // counter, the counter address is mixed into the instance id so schemas created in different modules never
+        // share an id.
+        static AZStd::atomic_uint s_instanceCounter;
+        static AZ_THREAD_LOCAL const FrameArenaSchema* s_cachedSchema = nullptr;
+        static AZ_THREAD_LOCAL unsigned int s_cachedInstanceId = 0;
+        static AZ_THREAD_LOCAL void* s_cachedRegion = nullptr;
+    }
+
+    //=========================================================================
+    // FrameArenaSchema
+    //=========================================================================
+    FrameArenaSchema::FrameArenaSchema(const Descriptor& desc)
+        : m_desc(desc)
+        , m_numRegions(0)
+        , m_frameId(0)
+    {
+        using namespace FrameArenaInternal;
+
+        m_fallbackAllocator = m_desc.m_fallbackAllocator;
+        if (!m_fallbackAllocator)
+        {
+            AZ_Assert(AllocatorInstance<SystemAllocator>::IsReady(), "FrameArenaSchema needs the SystemAllocator (or a fallback allocator in the descriptor)!");
+            m_fallbackAllocator = &AllocatorInstance<SystemAllocator>::Get();
+        }
+        if (m_desc.m_regionSize < RegionAlignment)
+        {
+            m_desc.m_regionSize = RegionAlignment;
+        }
+        m_desc.m_regionSize = AZ_SIZE_ALIGN_UP(m_desc.m_regionSize, RegionAlignment);
+
+        m_instanceId = (s_instanceCounter.fetch_add(1, AZStd::memory_order_relaxed) + 1) ^ static_cast<unsigned int>(reinterpret_cast<uintptr_t>(&s_instanceCounter) >> 4);
+
+        const unsigned int numRegions = m_desc.m_maxNumThreads + 1;
+        m_regions = reinterpret_cast<Region*>(m_fallbackAllocator->Allocate(sizeof(Region) * numRegions, AZStd::alignment_of<Region>::value, 0, "FrameArenaSchema regions", __FILE__, __LINE__));
+        for (unsigned int i = 0; i < numRegions; ++i)
+        {
+            Region* region = new(&m_regions[i]) Region;
+            region->m_threadId.store(AZStd::native_thread_id_type(), AZStd::memory_order_relaxed);
+            region->m_begin = region->m_end = nullptr;
+            region->m_current = region->m_currentEnd = region->m_last = nullptr;
+            region->m_overflow = nullptr;
+            region->m_overflowBytes = 0;
+            region->m_frameId = ~0u; // rewind (and allocate the region) on the first allocation
+            region->m_usedBytes.store(0, AZStd::memory_order_relaxed);
+        }
+        m_sharedRegion = &m_regions[m_desc.m_maxNumThreads];
+    }
+
+    //=========================================================================
+    // ~FrameArenaSchema
+    //=========================================================================
+    FrameArenaSchema::~FrameArenaSchema()
+    {
+        const unsigned int numRegions = m_desc.m_maxNumThreads + 1;
+        for (unsigned int i = 0; i < numRegions; ++i)
+        {
+            ReleaseRegion(m_regions[i]);
+            m_regions[i].~Region();
+        }
+        m_fallbackAllocator->DeAllocate(m_regions, sizeof(Region) * numRegions, AZStd::alignment_of<Region>::value);
+        m_regions = nullptr;
+        m_sharedRegion = nullptr;
+    }
+
+    //=========================================================================
+    // ResetFrame
+    //=========================================================================
+    void FrameArenaSchema::ResetFrame()
+    {
+        // Regions are rewound by their owner threads (on the next allocation), this way allocating never needs a lock
+        m_frameId.fetch_add(1, AZStd::memory_order_acq_rel);
+    }
+
+    //=========================================================================
+    // Allocate
+    //=========================================================================
+    FrameArenaSchema::pointer_type
+    FrameArenaSchema::Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        (void)flags;
+        (void)name;
+        (void)fileName;
+        (void)lineNum;
+        (void)suppressStackRecord;
+
+        if (byteSize == 0)
+        {
+            byteSize = 1;
+        }
+        if (alignment == 0)
+        {
+            alignment = sizeof(void*) * 2; // same as malloc
+        }
+        AZ_Assert((alignment & (alignment - 1)) == 0, "Alignment must be a power of 2!");
+
+        Region* region = GetRegion();
+        if (region == m_sharedRegion)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_sharedMutex);
+            return AllocateFromRegion(*region, byteSize, alignment);
+        }
+        return AllocateFromRegion(*region, byteSize, alignment);
+    }
+
+    //=========================================================================
+    // DeAllocate
+    //=========================================================================
+    void FrameArenaSchema::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        (void)byteSize;
+        (void)alignment;
+        if (ptr == nullptr)
+        {
+            return;
+        }
+
+        Region* region = GetRegion();
+        if (region == m_sharedRegion)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_sharedMutex);
+            DeAllocateFromRegion(*region, ptr);
+            return;
+        }
+        DeAllocateFromRegion(*region, ptr);
+    }
+
+    //=========================================================================
+    // Resize
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::Resize(pointer_type ptr, size_type newSize)
+    {
+        Region* region = GetRegion();
+        if (region == m_sharedRegion)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_sharedMutex);
+            return ResizeInRegion(*region, ptr, newSize);
+        }
+        return ResizeInRegion(*region, ptr, newSize);
+    }
+
+    //=========================================================================
+    // ReAllocate
+    //=========================================================================
+    FrameArenaSchema::pointer_type FrameArenaSchema::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        if (ptr == nullptr)
+        {
+            return Allocate(newSize, newAlignment);
+        }
+
+        // Only the last allocation of the thread has a known size
+        size_type oldSize = AllocationSize(ptr);
+        if (oldSize == 0)
+        {
+            AZ_Assert(false, "FrameArenaSchema can only reallocate the last allocation of the calling thread!");
+            return nullptr;
+        }
+        if ((reinterpret_cast<size_t>(ptr) & (AZStd::GetMax<size_t>(newAlignment, 1) - 1)) == 0 && Resize(ptr, newSize) == newSize)
+        {
+            return ptr;
+        }
+
+        pointer_type newPtr = Allocate(newSize, newAlignment);
+        if (newPtr)
+        {
+            memcpy(newPtr, ptr, AZStd::GetMin(oldSize, newSize));
+        }
+        return newPtr;
+    }
+
+    //=========================================================================
+    // AllocationSize
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::AllocationSize(pointer_type ptr)
+    {
+        Region* region = GetRegion();
+        if (region == m_sharedRegion)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_sharedMutex);
+            return GetLastAllocationSize(*region, ptr);
+        }
+        return GetLastAllocationSize(*region, ptr);
+    }
+
+    //=========================================================================
+    // NumAllocatedBytes
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::NumAllocatedBytes() const
+    {
+        // Regions that weren't rewound yet still report the memory allocated in the previous frame
+        size_type numAllocatedBytes = 0;
+        const unsigned int numRegions = m_desc.m_maxNumThreads + 1;
+        for (unsigned int i = 0; i < numRegions; ++i)
+        {
+            numAllocatedBytes += m_regions[i].m_usedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return numAllocatedBytes;
+    }
+
+    //=========================================================================
+    // Capacity
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::Capacity() const
+    {
+        // Approximate, the regions can change while reading them
+        const unsigned int numClaimed = AZStd::GetMin(m_numRegions.load(AZStd::memory_order_acquire), m_desc.m_maxNumThreads);
+        return (numClaimed + 1) * m_desc.m_regionSize;
+    }
+
+    //=========================================================================
+    // GetMaxAllocationSize
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::GetMaxAllocationSize() const
+    {
+        // Larger allocations go to an overflow block
+        return m_fallbackAllocator->GetMaxAllocationSize();
+    }
+
+    //=========================================================================
+    // GetRegion
+    //=========================================================================
+    FrameArenaSchema::Region* FrameArenaSchema::GetRegion()
+    {
+        using namespace FrameArenaInternal;
+
+        if (s_cachedSchema == this && s_cachedInstanceId == m_instanceId)
+        {
+            return reinterpret_cast<Region*>(s_cachedRegion);
+        }
+
+        const AZStd::native_thread_id_type threadId = AZStd::this_thread::get_id().m_id;
+        Region* region = FindRegion(threadId);
+        if (!region)
+        {
+            const unsigned int index = m_numRegions.fetch_add(1, AZStd::memory_order_acq_rel);
+            if (index < m_desc.m_maxNumThreads)
+            {
+                region = &m_regions[index];
+                region->m_threadId.store(threadId, AZStd::memory_order_release);
+            }
+            else
+            {
+                region = m_sharedRegion;
+            }
+        }
+
+        s_cachedSchema = this;
+        s_cachedInstanceId = m_instanceId;
+        s_cachedRegion = region;
+        return region;
+    }
+
+    //=========================================================================
+    // FindRegion
+    //=========================================================================
+    FrameArenaSchema::Region* FrameArenaSchema::FindRegion(AZStd::native_thread_id_type threadId) const
+    {
+        // Only the calling thread claims a region for its own id, so it always sees its own store
+        const unsigned int numClaimed = AZStd::GetMin(m_numRegions.load(AZStd::memory_order_acquire), m_desc.m_maxNumThreads);
+        for (unsigned int i = 0; i < numClaimed; ++i)
+        {
+            if (m_regions[i].m_threadId.load(AZStd::memory_order_acquire) == threadId)
+            {
+                return &m_regions[i];
+            }
+        }
+        return nullptr;
+    }
+
+    //=========================================================================
+    // Rewind
+    //=========================================================================
+    void FrameArenaSchema::Rewind(Region& region, unsigned int frameId)
+    {
+        using namespace FrameArenaInternal;
+
+        const size_t regionSize = region.m_end - region.m_begin;
+        if (region.m_overflow)
+        {
+            // grow to the peak of the last frame, so the next frames fit in the region
+            const size_t peakSize = AZ_SIZE_ALIGN_UP(regionSize + region.m_overflowBytes, RegionAlignment);
+            while (region.m_overflow)
+            {
+                Block* block = region.m_overflow;
+                region.m_overflow = block->m_next;
+                m_fallbackAllocator->DeAllocate(block, block->m_size, RegionAlignment);
+            }
+            if (region.m_begin)
+            {
+                m_fallbackAllocator->DeAllocate(region.m_begin, regionSize, RegionAlignment);
+            }
+            region.m_begin = reinterpret_cast<char*>(m_fallbackAllocator->Allocate(peakSize, RegionAlignment, 0, "FrameArenaSchema region", __FILE__, __LINE__));
+            region.m_end = region.m_begin ? region.m_begin + peakSize : nullptr;
+        }
+        else if (region.m_begin)
+        {
+            Poison(region.m_begin, region.m_current - region.m_begin);
+        }
+        else
+        {
+            region.m_begin = reinterpret_cast<char*>(m_fallbackAllocator->Allocate(m_desc.m_regionSize, RegionAlignment, 0, "FrameArenaSchema region", __FILE__, __LINE__));
+            region.m_end = region.m_begin ? region.m_begin + m_desc.m_regionSize : nullptr;
+        }
+
+        region.m_current = region.m_begin;
+        region.m_currentEnd = region.m_end;
+        region.m_last = nullptr;
+        region.m_overflowBytes = 0;
+        region.m_usedBytes.store(0, AZStd::memory_order_relaxed);
+        region.m_frameId = frameId;
+    }
+
+    //=========================================================================
+    // AllocateFromRegion
+    //=========================================================================
+    void* FrameArenaSchema::AllocateFromRegion(Region& region, size_t byteSize, size_t alignment)
+    {
+        const unsigned int frameId = m_frameId.load(AZStd::memory_order_acquire);
+        if (region.m_frameId != frameId)
+        {
+            Rewind(region, frameId);
+        }
+
+        char* ptr = PointerAlignUp(region.m_current, alignment);
+        if (ptr == nullptr || ptr > region.m_currentEnd || static_cast<size_t>(region.m_currentEnd - ptr) < byteSize)
+        {
+            return AllocateOverflow(region, byteSize, alignment);
+        }
+
+        region.m_usedBytes.store(region.m_usedBytes.load(AZStd::memory_order_relaxed) + (ptr + byteSize - region.m_current), AZStd::memory_order_relaxed);
+        region.m_last = ptr;
+        region.m_current = ptr + byteSize;
+        return ptr;
+    }
+
+    //=========================================================================
+    // AllocateOverflow
+    //=========================================================================
+    void* FrameArenaSchema::AllocateOverflow(Region& region, size_t byteSize, size_t alignment)
+    {
+        using namespace FrameArenaInternal;
+
+        const size_t headerSize = AZ_SIZE_ALIGN_UP(sizeof(Block), RegionAlignment);
+        const size_t blockAlignment = AZStd::GetMax(alignment, RegionAlignment);
+        const size_t blockSize = AZ_SIZE_ALIGN_UP(AZStd::GetMax(m_desc.m_regionSize, headerSize + byteSize + blockAlignment), RegionAlignment);
+        Block* block = reinterpret_cast<Block*>(m_fallbackAllocator->Allocate(blockSize, RegionAlignment, 0, "FrameArenaSchema overflow", __FILE__, __LINE__));
+        if (!block)
+        {
+            return nullptr;
+        }
+        block->m_next = region.m_overflow;
+        block->m_size = blockSize;
+        region.m_overflow = block;
+        region.m_overflowBytes += blockSize;
+
+        char* ptr = PointerAlignUp(reinterpret_cast<char*>(block) + headerSize, alignment);
+        region.m_usedBytes.store(region.m_usedBytes.load(AZStd::memory_order_relaxed) + byteSize, AZStd::memory_order_relaxed);
+        region.m_last = ptr;
+        region.m_current = ptr + byteSize;
+        region.m_currentEnd = reinterpret_cast<char*>(block) + blockSize;
+        return ptr;
+    }
+
+    //=========================================================================
+    // DeAllocateFromRegion
+    //=========================================================================
+    void FrameArenaSchema::DeAllocateFromRegion(Region& region, void* ptr)
+    {
+        // Only the last allocation can be given back, everything else is released by ResetFrame. Deallocating memory
+        // from another thread (or after the reset) is fine and does nothing.
+        if (GetLastAllocationSize(region, ptr) == 0)
+        {
+            return;
+        }
+        char* last = region.m_last;
+        Poison(last, region.m_current - last);
+        region.m_usedBytes.store(region.m_usedBytes.load(AZStd::memory_order_relaxed) - (region.m_current - last), AZStd::memory_order_relaxed);
+        region.m_current = last;
+        region.m_last = nullptr;
+    }
+
+    //=========================================================================
+    // ResizeInRegion
+    //=========================================================================
+    size_t FrameArenaSchema::ResizeInRegion(Region& region, void* ptr, size_t newSize)
+    {
+        const size_t size = GetLastAllocationSize(region, ptr);
+        if (size == 0)
+        {
+            return 0;
+        }
+        char* last = region.m_last;
+        if (static_cast<size_t>(region.m_currentEnd - last) < newSize)
+        {
+            return size;
+        }
+        if (newSize < size)
+        {
+            Poison(last + newSize, size - newSize);
+        }
+        region.m_usedBytes.store(region.m_usedBytes.load(AZStd::memory_order_relaxed) + newSize - size, AZStd::memory_order_relaxed);
+        region.m_current = last + newSize;
+        return newSize;
+    }
+
+    //=========================================================================
+    // GetLastAllocationSize
+    //=========================================================================
+    size_t FrameArenaSchema::GetLastAllocationSize(Region& region, void* ptr) const
+    {
+        if (ptr == nullptr || ptr != region.m_last || region.m_frameId != m_frameId.load(AZStd::memory_order_acquire))
+        {
+            return 0;
+        }
+        return region.m_current - region.m_last;
+    }
+
+    //=========================================================================
+    // ReleaseRegion
+    //=========================================================================
+    void FrameArenaSchema::ReleaseRegion(Region& region)
+    {
+        while (region.m_overflow)
+        {
+            Block* block = region.m_overflow;
+            region.m_overflow = block->m_next;
+            m_fallbackAllocator->DeAllocate(block, block->m_size, FrameArenaInternal::RegionAlignment);
+        }
+        if (region.m_begin)
+        {
+            m_fallbackAllocator->DeAllocate(region.m_begin, region.m_end - region.m_begin, FrameArenaInternal::RegionAlignment);
+        }
+        region.m_begin = region.m_end = nullptr;
+        region.m_current = region.m_currentEnd = region.m_last = nullptr;
+        region.m_overflowBytes = 0;
+        region.m_usedBytes.store(0, AZStd::memory_order_relaxed);
+    }
+
+    //=========================================================================
+    // Poison
+    //=========================================================================
+    void FrameArenaSchema::Poison(void* address, size_t byteSize) const
+    {
+        if (m_desc.m_isPoisonMemory && byteSize > 0)
+        {
+            memset(address, FrameArenaInternal::PoisonValue, byteSize);
+        }
+    }
+} // namespace AZ
+
+#endif // #ifndef AZ_UNITY_BUILD
@@ -0,0 +1,131 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    /**
+     * Frame arena schema, a linear (bump) allocator for memory that only lives until the end of the frame.
+     * Every thread allocates from its own region without any locks, DeAllocate doesn't release memory (except for the
+     * last allocation of the thread), instead everything is released at once by ResetFrame.
+     * When a region runs out of memory overflow blocks are taken from the fallback allocator, they are released on the
+     * next frame and the region grows to the peak usage of the thread, so following frames don't overflow again.
+     * IMPORTANT: memory must not be used after ResetFrame. A thread rewinds its region on its first allocation after
+     * the reset, poisoning the released memory (with 0xcd) if m_isPoisonMemory is set.
+     */
+    class FrameArenaSchema
+        : public IAllocatorAllocate
+    {
+    public:
+        AZ_TYPE_INFO(FrameArenaSchema, "{1E7C0D0B-4D6E-4C46-9B0F-2C8A6F1D1E55}");
+
+        typedef void*       pointer_type;
+        typedef size_t      size_type;
+        typedef ptrdiff_t   difference_type;
+
+        struct Descriptor
+        {
+            Descriptor()
+                : m_regionSize(m_defaultRegionSize)
+                , m_maxNumThreads(m_defaultMaxNumThreads)
+#if defined(AZ_DEBUG_BUILD)
+                , m_isPoisonMemory(true)
+#else
+                , m_isPoisonMemory(false)
+#endif
+                , m_fallbackAllocator(nullptr)
+            {}
+
+            static const size_t         m_defaultRegionSize = 1024 * 1024;
+            static const unsigned int   m_defaultMaxNumThreads = 64;
+
+            size_t                  m_regionSize;           ///< Initial size of every thread region, allocated on the first allocation of the thread.
+            unsigned int            m_maxNumThreads;        ///< Number of threads with their own region, any further threads share one locked region.
+            bool                    m_isPoisonMemory;       ///< Fill released memory with 0xcd, to catch memory used after the end of the frame.
+            IAllocatorAllocate*     m_fallbackAllocator;    ///< Allocator for regions and overflow blocks. If NULL the SystemAllocator is used.
+        };
+
+        FrameArenaSchema(const Descriptor& desc = Descriptor());
+        virtual ~FrameArenaSchema();
+
+        /// Releases all memory allocated in the current frame, call it when no frame memory is in use (see FrameArenaAllocator).
+        void ResetFrame();
+        /// Number of ResetFrame calls
+        unsigned int GetFrameId() const { return m_frameId.load(AZStd::memory_order_acquire); }
+
+        //---------------------------------------------------------------------
+        // IAllocatorAllocate
+        //---------------------------------------------------------------------
+        pointer_type Allocate(size_type byteSize, size_type alignment, int flags = 0, const char* name = 0, const char* fileName = 0, int lineNum = 0, unsigned int suppressStackRecord = 0) override;
+        void DeAllocate(pointer_type ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        /// Grows or shrinks the last allocation of the calling thread in place, otherwise not supported.
+        size_type Resize(pointer_type ptr, size_type newSize) override;
+        pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        size_type AllocationSize(pointer_type ptr) override;
+
+        size_type NumAllocatedBytes() const override;
+        size_type Capacity() const override;
+        size_type GetMaxAllocationSize() const override;
+        IAllocatorAllocate* GetSubAllocator() override { return m_fallbackAllocator; }
+        void GarbageCollect() override {}
+
+    private:
+        FrameArenaSchema(const FrameArenaSchema&) = delete;
+        FrameArenaSchema& operator=(const FrameArenaSchema&) = delete;
+
+        /// Overflow block header, the block memory follows.
+        struct Block
+        {
+            Block*  m_next;
+            size_t  m_size;
+        };
+
+        struct alignas(64) Region
+        {
+            AZStd::atomic<AZStd::native_thread_id_type> m_threadId;
+            char*                   m_begin;
+            char*                   m_end;
+            char*                   m_current;      ///< Bump pointer, in the region or in the first overflow block.
+            char*                   m_currentEnd;
+            char*                   m_last;         ///< Start of the last allocation (for DeAllocate/Resize), NULL if unknown.
+            Block*                  m_overflow;     ///< Overflow blocks used this frame, most recent first.
+            size_t                  m_overflowBytes;
+            unsigned int            m_frameId;
+            AZStd::atomic<size_t>   m_usedBytes;
+        };
+
+        Region*     GetRegion();
+        Region*     FindRegion(AZStd::native_thread_id_type threadId) const;
+        void        Rewind(Region& region, unsigned int frameId);
+        void*       AllocateFromRegion(Region& region, size_t byteSize, size_t alignment);
+        void*       AllocateOverflow(Region& region, size_t byteSize, size_t alignment);
+        void        DeAllocateFromRegion(Region& region, void* ptr);
+        size_t      ResizeInRegion(Region& region, void* ptr, size_t newSize);
+        size_t      GetLastAllocationSize(Region& region, void* ptr) const;
+        void        ReleaseRegion(Region& region);
+        void        Poison(void* address, size_t byteSize) const;
+
+        Descriptor              m_desc;
+        IAllocatorAllocate*     m_fallbackAllocator;
+        Region*                 m_regions;              ///< m_maxNumThreads + 1 regions, the last is shared by any further threads (under m_sharedMutex).
+        Region*                 m_sharedRegion;
+        AZStd::mutex            m_sharedMutex;
+        AZStd::atomic_uint      m_numRegions;
+        AZStd::atomic_uint      m_frameId;
+        unsigned int            m_instanceId;
+    };
+}
@@ -16,8 +16,10 @@
 
 #include <AzCore/Math/Sfmt.h>
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/containers/intrusive_set.h>
 
 #ifdef _DEBUG
@@ -56,6 +58,9 @@ namespace AZ {
 
 #ifdef MULTITHREADED
 #   define  SPIN_COUNT 4000
+#   ifdef AZ_THREAD_LOCAL
+#       define THREAD_CACHE
+#   endif
 #endif
 
     //////////////////////////////////////////////////////////////////////////
@@ -478,6 +483,38 @@ namespace AZ {
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
 
+#ifdef THREAD_CACHE
+        // Per thread caches of bucket elements (see HphaSchema::Descriptor::m_isThreadCache). Every bucket has a
+        // magazine of free elements in the cache, allocations and frees use it without locking and only move half
+        // a magazine at a time from/to the bucket (one bucket lock per batch).
+        struct thread_cache
+        {
+            struct magazine
+            {
+                free_link* mHead = nullptr;
+                unsigned mCount = 0;
+            };
+            thread_cache* mNext = nullptr;
+            AZStd::native_thread_id_type mThreadId;
+            AZStd::atomic_bool mFlushRequested{ false }; ///< set by purge, the owner thread returns all its elements on the next operation
+            magazine mMagazines[NUM_BUCKETS];
+        };
+        thread_cache* thread_cache_get();
+        thread_cache* thread_cache_create();
+        void* thread_cache_alloc(thread_cache& tc, unsigned bi);
+        void thread_cache_free(thread_cache& tc, void* ptr, unsigned bi);
+        void thread_cache_refill(thread_cache::magazine& m, unsigned bi);
+        void thread_cache_flush(thread_cache::magazine& m, unsigned bi, unsigned count);
+        void thread_cache_flush_all(thread_cache& tc);
+        void thread_cache_purge();
+        void thread_cache_destroy();
+
+        thread_cache* mThreadCaches;
+        AZStd::mutex mThreadCacheMutex;
+        unsigned short mThreadCacheCapacity[NUM_BUCKETS];
+        unsigned mThreadCacheId;
+#endif // THREAD_CACHE
+
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
         {
@@ -1004,6 +1041,10 @@ namespace AZ {
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+#ifdef THREAD_CACHE
+            // elements held by thread caches keep their pages alive
+            thread_cache_purge();
+#endif
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -1037,9 +1078,28 @@ namespace AZ {
         const size_t m_treePageAlignment;
         const size_t m_poolPageSize;
         bool         m_isPoolAllocations;
+        bool         m_isThreadCache;
         IAllocatorAllocate* m_subAllocator;
     };
 
+#ifdef THREAD_CACHE
+    namespace HphaInternal
+    {
+        // Most recently used thread caches of the calling thread. Every module has its own copy of the thread locals
+        // (a thread looks its cache up again under the allocator lock when it shows up in another module), the id
+        // tells apart allocators created at the same address.
+        struct ThreadCacheSlot
+        {
+            const void* m_allocator;
+            unsigned    m_id;
+            void*       m_cache;
+        };
+        static const unsigned NumThreadCacheSlots = 4;
+        static AZ_THREAD_LOCAL ThreadCacheSlot s_threadCacheSlots[NumThreadCacheSlots];
+        static AZStd::atomic_uint s_threadCacheIdCounter;
+    }
+#endif // THREAD_CACHE
+
     //////////////////////////////////////////////////////////////////////////
     // Prevent SystemAllocator from growing in small chunks
     HpAllocator::HpAllocator(HphaSchema::Descriptor desc)
@@ -1069,6 +1129,18 @@ namespace AZ {
         m_fixedBlock = desc.m_fixedMemoryBlock;
         m_fixedBlockSize = desc.m_fixedMemoryBlockByteSize;
         m_isPoolAllocations = desc.m_isPoolAllocations;
+        m_isThreadCache = false;
+#ifdef THREAD_CACHE
+        m_isThreadCache = desc.m_isPoolAllocations && desc.m_isThreadCache;
+        mThreadCaches = nullptr;
+        mThreadCacheId = (HphaInternal::s_threadCacheIdCounter.fetch_add(1, AZStd::memory_order_relaxed) + 1) ^ static_cast<unsigned>(reinterpret_cast<uintptr_t>(&HphaInternal::s_threadCacheIdCounter) >> 4);
+        for (unsigned i = 0; i < NUM_BUCKETS; ++i)
+        {
+            // cache about m_threadCacheSize bytes of every size
+            const size_t numElements = desc.m_threadCacheSize / bucket_spacing_function_inverse(i);
+            mThreadCacheCapacity[i] = (unsigned short)AZStd::GetMin<size_t>(AZStd::GetMax<size_t>(numElements, 4), 256);
+        }
+#endif // THREAD_CACHE
         if (desc.m_fixedMemoryBlock)
         {
             block_header* bl = tree_add_block(m_fixedBlock, m_fixedBlockSize);
@@ -1090,7 +1162,10 @@ namespace AZ {
         report();
         check();
 #endif
-        
+
+#ifdef THREAD_CACHE
+        thread_cache_destroy();
+#endif
         purge();
 
 #ifdef DEBUG_ALLOCATOR 
@@ -1251,6 +1326,15 @@ namespace AZ {
         HPPA_ASSERT(size <= MAX_SMALL_ALLOCATION);
         unsigned bi = bucket_spacing_function(size);
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef THREAD_CACHE
+        if (m_isThreadCache)
+        {
+            if (thread_cache* tc = thread_cache_get())
+            {
+                return thread_cache_alloc(*tc, bi);
+            }
+        }
+#endif
 #ifdef MULTITHREADED
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
 #endif
@@ -1274,6 +1358,15 @@ namespace AZ {
     void* HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef THREAD_CACHE
+        if (m_isThreadCache)
+        {
+            if (thread_cache* tc = thread_cache_get())
+            {
+                return thread_cache_alloc(*tc, bi);
+            }
+        }
+#endif
 #ifdef MULTITHREADED
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
 #endif
@@ -1336,6 +1429,15 @@ namespace AZ {
         page* p = ptr_get_page(ptr);
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef THREAD_CACHE
+        if (m_isThreadCache)
+        {
+            if (thread_cache* tc = thread_cache_get())
+            {
+                return thread_cache_free(*tc, ptr, bi);
+            }
+        }
+#endif
 #ifdef MULTITHREADED
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
 #endif
@@ -1349,12 +1451,198 @@ namespace AZ {
         // if this asserts, the free size doesn't match the allocated size
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
+#ifdef THREAD_CACHE
+        if (m_isThreadCache)
+        {
+            if (thread_cache* tc = thread_cache_get())
+            {
+                return thread_cache_free(*tc, ptr, bi);
+            }
+        }
+#endif
 #ifdef MULTITHREADED
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
 #endif
         mBuckets[bi].free(p, ptr);
     }
 
+#ifdef THREAD_CACHE
+    HpAllocator::thread_cache* HpAllocator::thread_cache_get()
+    {
+        using namespace HphaInternal;
+        for (unsigned i = 0; i < NumThreadCacheSlots; ++i)
+        {
+            const ThreadCacheSlot& slot = s_threadCacheSlots[i];
+            if (slot.m_allocator == this && slot.m_id == mThreadCacheId)
+            {
+                return (thread_cache*)slot.m_cache;
+            }
+        }
+
+        thread_cache* tc = thread_cache_create();
+        if (tc)
+        {
+            // keep the most recently used first
+            for (unsigned i = NumThreadCacheSlots - 1; i > 0; --i)
+            {
+                s_threadCacheSlots[i] = s_threadCacheSlots[i - 1];
+            }
+            s_threadCacheSlots[0].m_allocator = this;
+            s_threadCacheSlots[0].m_id = mThreadCacheId;
+            s_threadCacheSlots[0].m_cache = tc;
+        }
+        return tc;
+    }
+
+    HpAllocator::thread_cache* HpAllocator::thread_cache_create()
+    {
+        const AZStd::native_thread_id_type threadId = AZStd::this_thread::get_id().m_id;
+        AZStd::lock_guard<AZStd::mutex> lock(mThreadCacheMutex);
+        for (thread_cache* tc = mThreadCaches; tc; tc = tc->mNext)
+        {
+            if (tc->mThreadId == threadId)
+            {
+                return tc;
+            }
+        }
+
+        // caches live until the allocator is destroyed (like the ThreadPoolSchema thread data), they are flushed
+        // by purge so memory of exited threads can still be reclaimed
+        void* mem = tree_alloc(sizeof(thread_cache));
+        if (!mem)
+        {
+            return nullptr; // fall back to the bucket locks
+        }
+        thread_cache* tc = new(mem) thread_cache;
+        tc->mThreadId = threadId;
+        tc->mNext = mThreadCaches;
+        mThreadCaches = tc;
+        return tc;
+    }
+
+    void* HpAllocator::thread_cache_alloc(thread_cache& tc, unsigned bi)
+    {
+        if (tc.mFlushRequested.load(AZStd::memory_order_relaxed))
+        {
+            thread_cache_flush_all(tc);
+        }
+        thread_cache::magazine& m = tc.mMagazines[bi];
+        if (!m.mHead)
+        {
+            thread_cache_refill(m, bi);
+            if (!m.mHead)
+            {
+                return NULL;
+            }
+        }
+        free_link* free = m.mHead;
+        m.mHead = free->mNext;
+        --m.mCount;
+        return (void*)free;
+    }
+
+    void HpAllocator::thread_cache_free(thread_cache& tc, void* ptr, unsigned bi)
+    {
+        if (tc.mFlushRequested.load(AZStd::memory_order_relaxed))
+        {
+            thread_cache_flush_all(tc);
+        }
+        thread_cache::magazine& m = tc.mMagazines[bi];
+        free_link* lnk = (free_link*)ptr;
+        lnk->mNext = m.mHead;
+        m.mHead = lnk;
+        if (++m.mCount > mThreadCacheCapacity[bi])
+        {
+            // keep half of the elements for the next allocations
+            thread_cache_flush(m, bi, m.mCount / 2);
+        }
+    }
+
+    void HpAllocator::thread_cache_refill(thread_cache::magazine& m, unsigned bi)
+    {
+        const unsigned count = AZStd::GetMax(mThreadCacheCapacity[bi] / 2u, 1u);
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+        for (unsigned i = 0; i < count; ++i)
+        {
+            page* p = mBuckets[bi].get_free_page();
+            if (!p)
+            {
+                size_t bsize = bucket_spacing_function_inverse(bi);
+                p = bucket_grow(bsize, mBuckets[bi].marker());
+                if (!p)
+                {
+                    break;
+                }
+                mBuckets[bi].add_free_page(p);
+            }
+            free_link* lnk = (free_link*)mBuckets[bi].alloc(p);
+            lnk->mNext = m.mHead;
+            m.mHead = lnk;
+            ++m.mCount;
+        }
+    }
+
+    void HpAllocator::thread_cache_flush(thread_cache::magazine& m, unsigned bi, unsigned count)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+        for (; count > 0 && m.mHead; --count)
+        {
+            free_link* lnk = m.mHead;
+            m.mHead = lnk->mNext;
+            --m.mCount;
+            mBuckets[bi].free(ptr_get_page(lnk), lnk);
+        }
+    }
+
+    void HpAllocator::thread_cache_flush_all(thread_cache& tc)
+    {
+        tc.mFlushRequested.store(false, AZStd::memory_order_relaxed);
+        for (unsigned i = 0; i < NUM_BUCKETS; ++i)
+        {
+            if (tc.mMagazines[i].mCount)
+            {
+                thread_cache_flush(tc.mMagazines[i], i, tc.mMagazines[i].mCount);
+            }
+        }
+    }
+
+    void HpAllocator::thread_cache_purge()
+    {
+        if (!m_isThreadCache)
+        {
+            return;
+        }
+        // Other threads return their elements on their next operation, the calling thread does it now
+        const AZStd::native_thread_id_type threadId = AZStd::this_thread::get_id().m_id;
+        AZStd::lock_guard<AZStd::mutex> lock(mThreadCacheMutex);
+        for (thread_cache* tc = mThreadCaches; tc; tc = tc->mNext)
+        {
+            if (tc->mThreadId == threadId)
+            {
+                thread_cache_flush_all(*tc);
+            }
+            else
+            {
+                tc->mFlushRequested.store(true, AZStd::memory_order_relaxed);
+            }
+        }
+    }
+
+    void HpAllocator::thread_cache_destroy()
+    {
+        // IMPORTANT: as with the rest of the allocator no other thread can use it at this point
+        AZStd::lock_guard<AZStd::mutex> lock(mThreadCacheMutex);
+        while (mThreadCaches)
+        {
+            thread_cache* tc = mThreadCaches;
+            mThreadCaches = tc->mNext;
+            thread_cache_flush_all(*tc);
+            tc->~thread_cache();
+            tree_free(tc);
+        }
+    }
+#endif // THREAD_CACHE
+
     size_t HpAllocator::bucket_ptr_size(void* ptr) const
     {
         page* p = ptr_get_page(ptr);
@@ -43,6 +43,8 @@ namespace AZ
                 , m_subAllocator(nullptr)
                 , m_systemChunkSize(0)
                 , m_capacity(AZ_CORE_MAX_ALLOCATOR_SIZE)
+                , m_isThreadCache(false)
+                , m_threadCacheSize(2 * 1024)
             {}
 
             unsigned int            m_memoryBlockAlignment;
@@ -54,6 +56,8 @@ namespace AZ
             IAllocatorAllocate*     m_subAllocator;                         ///< Allocator that m_memoryBlocks memory was allocated from or should be allocated (if NULL).
             size_t                  m_systemChunkSize;                      ///< Size of chunk to request from the OS when more memory is needed (defaults to m_pageSize)
             size_t                  m_capacity;                             ///< Max size this allocator can grow to
+            bool                    m_isThreadCache;                        ///< True to cache freed pool allocations per thread, so threads don't contend on the pool locks. Requires m_isPoolAllocations.
+            unsigned int            m_threadCacheSize;                      ///< Approximate number of bytes cached per thread for every pool allocation size (4 to 256 elements).
         };
 
 
@@ -13,6 +13,7 @@
 #define AZCORE_MEMORY_COMPONENT_H
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Crc.h>
 
 namespace AZ
@@ -25,6 +26,7 @@ namespace AZ
      */
     class MemoryComponent
         : public Component
+        , public TickBus::Handler
     {
     public:
         AZ_COMPONENT(AZ::MemoryComponent, "{6F450DDA-6F4D-40fd-A93B-E5CCCDBC72AB}")
@@ -39,6 +41,12 @@ namespace AZ
         void Deactivate() override;
         //////////////////////////////////////////////////////////////////////////
 
+        //////////////////////////////////////////////////////////////////////////
+        // TickBus
+        void OnTick(float deltaTime, ScriptTimePoint time) override;
+        int GetTickOrder() override;
+        //////////////////////////////////////////////////////////////////////////
+
     private:
 
         /// \ref ComponentDescriptor::GetProvidedServices
@@ -51,10 +59,12 @@ namespace AZ
         // serialized data
         bool m_isPoolAllocator;
         bool m_isThreadPoolAllocator;
+        bool m_isFrameArenaAllocator;
 
         // non-serialized data
         bool m_createdPoolAllocator;
         bool m_createdThreadPoolAllocator;
+        bool m_createdFrameArenaAllocator;
     };
 }
 
@@ -111,6 +111,8 @@ SystemAllocator::Create(const Descriptor& desc)
         }
         heapDesc.m_subAllocator = desc.m_heap.m_subAllocator;
         heapDesc.m_isPoolAllocations = desc.m_heap.m_isPoolAllocations;
+        heapDesc.m_isThreadCache = desc.m_heap.m_isThreadCache;
+        heapDesc.m_threadCacheSize = desc.m_heap.m_threadCacheSize;
         // Fix SystemAllocator from growing in small chunks
         heapDesc.m_systemChunkSize = desc.m_heap.m_systemChunkSize;
 
@@ -57,6 +57,8 @@ namespace AZ
 
             serializeContext->Class<DynamicModuleDescriptor>()
                 ->Field("dynamicLibraryPath", &DynamicModuleDescriptor::m_dynamicLibraryPath)
+                ->Field("loadOnDemand", &DynamicModuleDescriptor::m_loadOnDemand)
+                ->Field("providedTypes", &DynamicModuleDescriptor::m_providedTypes)
                 ;
 
             if (EditContext* ec = serializeContext->GetEditContext())
@@ -64,6 +66,7 @@ namespace AZ
                 ec->Class<DynamicModuleDescriptor>(
                     "Dynamic Module descriptor", "Describes a dynamic module (DLL) used by the application")
                     ->DataElement(Edit::UIHandlers::Default, &DynamicModuleDescriptor::m_dynamicLibraryPath, "Dynamic library path", "Path to DLL.")
+                    ->DataElement(Edit::UIHandlers::Default, &DynamicModuleDescriptor::m_loadOnDemand, "Load on demand", "Only load the DLL when one of its types is first needed.")
                     ;
             }
         }
@@ -180,6 +183,7 @@ namespace AZ
     // ModuleManager
     //=========================================================================
     ModuleManager::ModuleManager()
+        : m_ownerThreadId(AZStd::this_thread::get_id())
     {
         ModuleManagerRequestBus::Handler::BusConnect();
         Internal::ModuleManagerInternalRequestBus::Handler::BusConnect();
@@ -563,6 +567,18 @@ namespace AZ
         // Load DLLs specified in the application descriptor
         for (const auto& moduleDescriptor : modules)
         {
+            if (moduleDescriptor.m_loadOnDemand)
+            {
+                // Remember which types the module provides, it's loaded by LoadOnDemandModuleForType when one of them is needed
+                AZ_Warning(s_moduleLoggingScope, !moduleDescriptor.m_providedTypes.empty(), "On demand module \"%s\" doesn't list any provided types, it will never be loaded.",
+                    moduleDescriptor.m_dynamicLibraryPath.c_str());
+                for (const Uuid& typeId : moduleDescriptor.m_providedTypes)
+                {
+                    m_onDemandModuleTypes[typeId] = moduleDescriptor.m_dynamicLibraryPath;
+                }
+                continue;
+            }
+
             LoadModuleOutcome result = LoadDynamicModule(moduleDescriptor.m_dynamicLibraryPath.c_str(), lastStepToPerform, maintainReferences);
             results.emplace_back(AZStd::move(result));
         }
@@ -638,6 +654,45 @@ namespace AZ
         return m_notOwnedModules.find(preprocessedModulePath) != m_notOwnedModules.end();
     }
 
+    //=========================================================================
+    // LoadOnDemandModuleForType
+    //=========================================================================
+    bool ModuleManager::LoadOnDemandModuleForType(const Uuid& typeId)
+    {
+        auto typeIt = m_onDemandModuleTypes.find(typeId);
+        if (typeIt == m_onDemandModuleTypes.end())
+        {
+            return false;
+        }
+
+        if (AZStd::this_thread::get_id() != m_ownerThreadId)
+        {
+            AZ_Warning(s_moduleLoggingScope, false, "Type %s is provided by on demand module \"%s\" but was requested from another thread, the module can't be loaded from there. "
+                "Consider not loading this module on demand.", typeId.ToString<AZStd::string>().c_str(), typeIt->second.c_str());
+            return false;
+        }
+
+        const AZ::OSString modulePath = typeIt->second;
+
+        // Forget all the types of the module first, whatever the outcome we shouldn't try loading it again
+        for (auto it = m_onDemandModuleTypes.begin(); it != m_onDemandModuleTypes.end(); )
+        {
+            if (it->second == modulePath)
+            {
+                it = m_onDemandModuleTypes.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // If the system entity isn't active yet, the module entity is activated with all the others in OnEntityActivated
+        LoadModuleOutcome result = LoadDynamicModule(modulePath.c_str(), ModuleInitializationSteps::ActivateEntity, true);
+        AZ_Error(s_moduleLoggingScope, result.IsSuccess(), "Failed to load on demand module for type %s: %s", typeId.ToString<AZStd::string>().c_str(), result.IsSuccess() ? "" : result.GetError().c_str());
+        return result.IsSuccess();
+    }
+
     //=========================================================================
     // ClearModuleReferences
     //=========================================================================
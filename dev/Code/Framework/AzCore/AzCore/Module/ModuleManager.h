@@ -18,6 +18,7 @@
 
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/weak_ptr.h>
 #include <AzCore/std/string/string_view.h>
 
@@ -166,6 +167,7 @@ namespace AZ
         LoadModulesResult LoadDynamicModules(const ModuleDescriptorList& modules, ModuleInitializationSteps lastStepToPerform, bool maintainReferences) override;
         LoadModulesResult LoadStaticModules(CreateStaticModulesCallback staticModulesCb, ModuleInitializationSteps lastStepToPerform) override;
         bool IsModuleLoaded(const char* modulePath) override;
+        bool LoadOnDemandModuleForType(const Uuid& typeId) override;
 
         ////////////////////////////////////////////////////////////////////////
 
@@ -198,5 +200,12 @@ namespace AZ
         /// The modules we don't own
         /// Is multimap to handle CRC collisions
         UnownedModulesMap m_notOwnedModules;
+
+        using OnDemandModulesMap = AZStd::unordered_map<Uuid, AZ::OSString>;
+        /// Types provided by on demand modules which haven't been loaded yet, and the path of their module
+        OnDemandModulesMap m_onDemandModuleTypes;
+
+        /// On demand modules are only loaded from this thread
+        AZStd::thread_id m_ownerThreadId;
     };
 } // namespace AZ
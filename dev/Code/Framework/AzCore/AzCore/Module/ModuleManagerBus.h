@@ -12,8 +12,10 @@
 #pragma once
 
 #include <AzCore/EBus/EBus.h>
+#include <AzCore/Math/Uuid.h>
 #include <AzCore/Outcome/Outcome.h>
 
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/osstring.h>
 
@@ -65,6 +67,15 @@ namespace AZ
         static void Reflect(ReflectContext* context);
 
         OSString m_dynamicLibraryPath;          ///< Path to the module.
+
+        /**
+         * When set, the module is skipped by LoadDynamicModules and only loaded the first time one of
+         * m_providedTypes is needed (see ModuleManagerRequests::LoadOnDemandModuleForType).
+         * Use it for modules that most processes never touch, they cost nothing until then.
+         */
+        bool m_loadOnDemand = false;
+        /// Types reflected by the module, generated from its reflection. Only used for on demand modules.
+        AZStd::vector<Uuid, OSStdAllocator> m_providedTypes;
     };
     /**
      * Type for storing module references.
@@ -134,6 +145,18 @@ namespace AZ
          */
         virtual bool IsModuleLoaded(const char* modulePath) = 0;
 
+        /**
+         * Loads and activates the on demand module (see DynamicModuleDescriptor::m_loadOnDemand) which provides the given type.
+         * Called when a type is needed that isn't reflected, for example by the ObjectStream.
+         * Modules are only loaded on demand from the thread which created the module manager, since loading a module
+         * reflects its types and activates its system components.
+         *
+         * \param typeId the type that is needed.
+         *
+         * \returns true if a module providing the type was loaded.
+         */
+        virtual bool LoadOnDemandModuleForType(const Uuid& typeId) = 0;
+
     };
     using ModuleManagerRequestBus = AZ::EBus<ModuleManagerRequests>;
 } //namespace AZ
@@ -0,0 +1,204 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef AZ_UNITY_BUILD
+
+#include <AzCore/Name/Name.h>
+
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+
+#include <stddef.h>
+#include <string.h>
+
+namespace AZ
+{
+    namespace
+    {
+        /**
+         * Global table of interned strings, shared by all modules through the environment.
+         * The bucket array is never resized and entries are never modified or removed once published,
+         * so lookups only need acquire loads of the bucket heads. Adding takes a lock which also
+         * guarantees that each string gets exactly one entry.
+         */
+        class NameTable
+        {
+        public:
+            NameTable()
+                : m_allocator(Internal::GetAllocator())
+            {
+                for (AZStd::atomic<const Internal::NameEntry*>& bucket : m_buckets)
+                {
+                    bucket.store(nullptr, AZStd::memory_order_relaxed);
+                }
+            }
+
+            ~NameTable()
+            {
+                for (AZStd::atomic<const Internal::NameEntry*>& bucket : m_buckets)
+                {
+                    const Internal::NameEntry* entry = bucket.load(AZStd::memory_order_relaxed);
+                    while (entry)
+                    {
+                        const Internal::NameEntry* next = entry->m_next;
+                        m_allocator->DeAllocate(const_cast<Internal::NameEntry*>(entry));
+                        entry = next;
+                    }
+                }
+            }
+
+            const Internal::NameEntry* FindOrAdd(AZStd::string_view name)
+            {
+                const u32 hash = Crc32(name);
+                AZStd::atomic<const Internal::NameEntry*>& bucket = m_buckets[hash % BucketCount];
+
+                if (const Internal::NameEntry* entry = Find(bucket.load(AZStd::memory_order_acquire), name, hash))
+                {
+                    return entry;
+                }
+
+                AZStd::lock_guard<AZStd::mutex> lock(m_addMutex);
+
+                // another thread may have added the same string while we were waiting
+                const Internal::NameEntry* head = bucket.load(AZStd::memory_order_acquire);
+                if (const Internal::NameEntry* entry = Find(head, name, hash))
+                {
+                    return entry;
+                }
+
+                void* memory = m_allocator->Allocate(offsetof(Internal::NameEntry, m_string) + name.size() + 1, AZStd::alignment_of<Internal::NameEntry>::value);
+                AZ_Assert(memory, "Out of memory when adding name '%.*s'", static_cast<int>(name.size()), name.data());
+
+                Internal::NameEntry* entry = reinterpret_cast<Internal::NameEntry*>(memory);
+                entry->m_next = head;
+                entry->m_length = name.size();
+                entry->m_hash = hash;
+                memcpy(entry->m_string, name.data(), name.size());
+                entry->m_string[name.size()] = '\0';
+
+                bucket.store(entry, AZStd::memory_order_release);
+                return entry;
+            }
+
+        private:
+            static const Internal::NameEntry* Find(const Internal::NameEntry* entry, AZStd::string_view name, u32 hash)
+            {
+                for (; entry; entry = entry->m_next)
+                {
+                    if (entry->m_hash == hash && entry->m_length == name.size() && memcmp(entry->m_string, name.data(), name.size()) == 0)
+                    {
+                        return entry;
+                    }
+                }
+                return nullptr;
+            }
+
+            static const size_t BucketCount = 8192;
+
+            AZStd::atomic<const Internal::NameEntry*> m_buckets[BucketCount];
+            AZStd::mutex m_addMutex;
+            Environment::AllocatorInterface* m_allocator;
+        };
+
+        NameTable& GetNameTable()
+        {
+            static EnvironmentVariable<NameTable> s_nameTable = Environment::CreateVariable<NameTable>(AZ_CRC("AZ::NameTable", 0xadcb1c21));
+            return *s_nameTable;
+        }
+
+        /// Serializes names as their string, same binary and text representation as AZStd::string.
+        class NameSerializer
+            : public SerializeContext::IDataSerializer
+        {
+        public:
+            size_t DataToText(IO::GenericStream& in, IO::GenericStream& out, bool /*isDataBigEndian*/) override
+            {
+                const size_t dataSize = static_cast<size_t>(in.GetLength());
+
+                AZStd::string outText;
+                outText.resize(dataSize);
+                in.Read(dataSize, outText.data());
+
+                return static_cast<size_t>(out.Write(outText.size(), outText.c_str()));
+            }
+
+            size_t TextToData(const char* text, unsigned int /*textVersion*/, IO::GenericStream& stream, bool /*isDataBigEndian*/) override
+            {
+                return static_cast<size_t>(stream.Write(strlen(text), reinterpret_cast<const void*>(text)));
+            }
+
+            size_t Save(const void* classPtr, IO::GenericStream& stream, bool /*isDataBigEndian*/) override
+            {
+                const AZStd::string_view name = reinterpret_cast<const Name*>(classPtr)->GetStringView();
+                return static_cast<size_t>(stream.Write(name.size(), name.data()));
+            }
+
+            bool Load(void* classPtr, IO::GenericStream& stream, unsigned int /*version*/, bool /*isDataBigEndian*/) override
+            {
+                const size_t textLen = static_cast<size_t>(stream.GetLength());
+
+                AZStd::string text;
+                text.resize(textLen);
+                stream.Read(textLen, text.data());
+
+                *reinterpret_cast<Name*>(classPtr) = Name(AZStd::string_view(text.data(), text.size()));
+                return true;
+            }
+
+            bool CompareValueData(const void* lhs, const void* rhs) override
+            {
+                return SerializeContext::EqualityCompareHelper<Name>::CompareValues(lhs, rhs);
+            }
+        };
+    } // namespace
+
+    //=========================================================================
+    // Name
+    //=========================================================================
+    Name::Name(AZStd::string_view name)
+        : m_entry(name.empty() ? nullptr : GetNameTable().FindOrAdd(name))
+    {
+    }
+
+    //=========================================================================
+    // Reflect
+    //=========================================================================
+    void Name::Reflect(ReflectContext* context)
+    {
+        if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
+        {
+            serializeContext->Class<Name>()
+                ->Serializer<NameSerializer>()
+                ;
+        }
+
+        if (BehaviorContext* behaviorContext = azrtti_cast<BehaviorContext*>(context))
+        {
+            behaviorContext->Class<Name>()
+                ->Attribute(AZ::Script::Attributes::Storage, AZ::Script::Attributes::StorageType::Value)
+                ->Constructor<AZStd::string_view>()
+                ->Method("ToString", [](const Name* thisPtr) -> AZStd::string { return AZStd::string(thisPtr->GetStringView()); })
+                    ->Attribute(AZ::Script::Attributes::Operator, AZ::Script::Attributes::OperatorType::ToString)
+                ->Method("Equal", &Name::operator==)
+                    ->Attribute(AZ::Script::Attributes::Operator, AZ::Script::Attributes::OperatorType::Equal)
+                ->Method("IsEmpty", &Name::IsEmpty)
+                ->Method("GetHash", &Name::GetHash)
+                ;
+        }
+    }
+} // namespace AZ
+
+#endif // #ifndef AZ_UNITY_BUILD
@@ -0,0 +1,113 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ
+{
+    class ReflectContext;
+
+    namespace Internal
+    {
+        /**
+         * Interned string owned by the global name table. Entries are immutable once they are
+         * published and live as long as the table does (until the last module using it is unloaded).
+         */
+        struct NameEntry
+        {
+            const NameEntry* m_next;    ///< Next entry in the same bucket of the name table.
+            size_t m_length;
+            u32 m_hash;
+            char m_string[1];           ///< Null terminated, m_length + 1 bytes are allocated.
+        };
+    } // namespace Internal
+
+    /**
+     * Interned string, for identifiers which are compared and hashed much more often than they are created.
+     * Equal strings always share the same table entry, so comparison and hashing are O(1) and don't touch the
+     * characters, while the string itself is still available (for debugging, serialization, UI, ...).
+     *
+     * Creating a Name takes a lock only the first time a given string is seen; looking up an existing string
+     * and everything done with a Name afterwards is lock free, so Names can be used from any thread.
+     * GetHash() returns the Crc32 of the string, so it matches AZ_CRC ids computed from the same string
+     * (which means it ignores case, while Names themselves are case sensitive).
+     * The empty string is represented by the default constructed Name and doesn't use a table entry.
+     */
+    class Name
+    {
+    public:
+        AZ_TYPE_INFO(Name, "{9B254B9B-CFE3-4344-B834-EE7F4CC35CE1}");
+
+        static void Reflect(ReflectContext* context);
+
+        Name() = default;
+        explicit Name(AZStd::string_view name);
+
+        /// Returns the interned string, the view stays valid as long as the name table exists.
+        AZStd::string_view GetStringView() const
+        {
+            return m_entry ? AZStd::string_view(m_entry->m_string, m_entry->m_length) : AZStd::string_view();
+        }
+
+        /// Returns a null terminated version of the string (an empty string for an empty Name).
+        const char* GetCStr() const
+        {
+            return m_entry ? m_entry->m_string : "";
+        }
+
+        /// Returns the Crc32 of the string (0 for an empty Name).
+        u32 GetHash() const
+        {
+            return m_entry ? m_entry->m_hash : 0;
+        }
+
+        bool IsEmpty() const
+        {
+            return m_entry == nullptr;
+        }
+
+        bool operator==(const Name& rhs) const
+        {
+            return m_entry == rhs.m_entry;
+        }
+
+        bool operator!=(const Name& rhs) const
+        {
+            return m_entry != rhs.m_entry;
+        }
+
+    private:
+        const Internal::NameEntry* m_entry = nullptr;
+    };
+} // namespace AZ
+
+namespace AZStd
+{
+    /**
+     * Enables names to be keys in hashed data structures.
+     */
+    template<>
+    struct hash<AZ::Name>
+    {
+        typedef AZ::Name        argument_type;
+        typedef AZStd::size_t   result_type;
+
+        AZ_FORCE_INLINE size_t operator()(const AZ::Name& name) const
+        {
+            return static_cast<size_t>(name.GetHash());
+        }
+    };
+} // namespace AZStd
@@ -3014,8 +3014,12 @@ LUA_API const Node* lua_getDummyNode()
                     AZ_Assert(fromStack, "Argument %s for Method %s doesn't have support to be converted to Lua!", arg->m_name, method->m_name.c_str());
 
                     m_fromLua.push_back(AZStd::make_pair(fromStack, argClass));
+                    m_arguments.push_back(arg);
                 }
 
+                m_minNumArguments = static_cast<int>(m_method->GetMinNumberOfArguments());
+                m_isMember = m_method->IsMember();
+
                 if (method->HasResult())
                 {
                     m_resultToLua = ToLuaStack(context, method->GetResult(), &m_prepareResult, m_resultClass);
@@ -3047,10 +3051,10 @@ LUA_API const Node* lua_getDummyNode()
 
                 // check number of arguments
                 int numElementsOnStack = lua_gettop(lua);
-                if (numElementsOnStack < static_cast<int>(thisPtr->m_method->GetMinNumberOfArguments()))
+                if (numElementsOnStack < thisPtr->m_minNumArguments)
                 {
                     // we can here load default parameters 
-                    ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Not enough arguments for %s(%s) method, we expected %d arguments (left to right), provided %d!", thisPtr->m_method->m_name.c_str(), lua_tostring(lua, lua_upvalueindex(2)), thisPtr->m_method->GetMinNumberOfArguments(), numElementsOnStack);
+                    ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Not enough arguments for %s(%s) method, we expected %d arguments (left to right), provided %d!", thisPtr->m_method->m_name.c_str(), lua_tostring(lua, lua_upvalueindex(2)), thisPtr->m_minNumArguments, numElementsOnStack);
                     return 0;
                 }
 
@@ -3058,13 +3062,13 @@ LUA_API const Node* lua_getDummyNode()
                 BehaviorValueParameter result;
                 ScriptContext::StackVariableAllocator tempData;
 
-                int numArguments = GetMin(static_cast<int>(thisPtr->m_method->GetNumArguments()), numElementsOnStack);
+                int numArguments = GetMin(static_cast<int>(thisPtr->m_arguments.size()), numElementsOnStack);
                 AZ_Assert(static_cast<int>(AZ_ARRAY_SIZE(arguments)) >= numArguments, "Increase the argument array size!");
 
                 // for each argument read a variable from the stack to a BehaviorValueParameter
                 for (int i = 0; i < numArguments; ++i)
                 {
-                    const AZ::BehaviorParameter* parameter = thisPtr->m_method->GetArgument(i);
+                    const AZ::BehaviorParameter* parameter = thisPtr->m_arguments[i];
                     arguments[i].Set(*parameter); // store the type of result we expect (pointer, const, etc.)
                     if (!thisPtr->m_fromLua[i].first(lua, i + 1, arguments[i], thisPtr->m_fromLua[i].second, &tempData))
                     {
@@ -3075,7 +3079,7 @@ LUA_API const Node* lua_getDummyNode()
                 }
 
                 // If this pointer passed, ensure it isn't nil
-                if (thisPtr->m_method->IsMember() &&
+                if (thisPtr->m_isMember &&
                     *arguments[0].GetAsUnsafe<void*>() == nullptr)
                 {
                     ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Cannot pass nil as 'this' ptr to member function %s.", thisPtr->m_method->m_name.c_str());
@@ -3083,6 +3087,16 @@ LUA_API const Node* lua_getDummyNode()
                 }
                 int numResults = 0;
 
+                // Everything the result callback needs, so the callback only captures a single pointer. That keeps it in
+                // the AZStd::function small buffer instead of allocating the functor on every call that returns a value.
+                struct ResultAssignment
+                {
+                    lua_State* m_lua;
+                    LuaScriptCaller* m_caller;
+                    BehaviorValueParameter* m_result;
+                    int* m_numResults;
+                } resultAssignment{ lua, thisPtr, &result, &numResults };
+
                 if (thisPtr->m_resultToLua)
                 {
                     result.Set(*thisPtr->m_method->GetResult()); 
@@ -3093,12 +3107,13 @@ LUA_API const Node* lua_getDummyNode()
                     }
 
                     // TODO: Make it optional for EBuses only, make it light weight too, probably a virtual function for the store result.
-                    result.m_onAssignedResult = AZStd::function<void()>([&]()
+                    ResultAssignment* assignment = &resultAssignment;
+                    result.m_onAssignedResult = AZStd::function<void()>([assignment]()
                     {
-                        if (result.m_value)
+                        if (assignment->m_result->m_value)
                         {
-                            thisPtr->m_resultToLua(lua, result);
-                            ++numResults;
+                            assignment->m_caller->m_resultToLua(assignment->m_lua, *assignment->m_result);
+                            ++(*assignment->m_numResults);
                         }
                     });
                 }
@@ -3156,6 +3171,9 @@ LUA_API const Node* lua_getDummyNode()
             }
 
             AZStd::vector<AZStd::pair<LuaLoadFromStack, BehaviorClass*>> m_fromLua;
+            AZStd::vector<const BehaviorParameter*> m_arguments; ///< Cached method arguments, avoids the virtual lookups on every call
+            int m_minNumArguments;
+            bool m_isMember;
             LuaPushToStack m_resultToLua;
             LuaPrepareValue m_prepareResult;
             BehaviorClass* m_resultClass;
@@ -5349,9 +5367,9 @@ LUA_API const Node* lua_getDummyNode()
     }
 
     //////////////////////////////////////////////////////////////////////////
-    void ScriptContext::GarbageCollectStep(int numberOfSteps)
+    bool ScriptContext::GarbageCollectStep(int numberOfSteps)
     {
-        lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps);
+        return lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps) != 0;
     }
 
     //////////////////////////////////////////////////////////////////////////
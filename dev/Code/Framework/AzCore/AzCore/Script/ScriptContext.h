@@ -847,8 +847,9 @@ namespace AZ
         /**
          *  Step the garbage collector. There is no exact number that works in all cases, tune this number for optimal 
          * performance in your app.
+         * \returns true if the step finished a garbage collection cycle.
          */ 
-        void GarbageCollectStep(int numberOfSteps = 2);
+        bool GarbageCollectStep(int numberOfSteps = 2);
 
         lua_State* NativeContext();
 
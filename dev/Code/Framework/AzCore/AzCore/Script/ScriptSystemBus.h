@@ -57,6 +57,14 @@ namespace AZ
         /// Step GC 
         virtual void GarbageCollectStep(int numberOfSteps) = 0;
 
+        /**
+         * Sets the time spent stepping the GC of each context every system tick.
+         * The GC is stepped repeatedly until the budget is spent or a collection cycle completes.
+         *
+         * \param microseconds time budget per context and tick, 0 to run the fixed number of GC steps per tick instead
+         */
+        virtual void SetGarbageCollectorTimeBudget(AZ::u32 microseconds) = 0;
+
         /**
          * Load script asset into the a context.
          * If the load succeeds, the script table will be on top of the stack
@@ -21,6 +21,7 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Math/MathReflection.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -29,6 +30,7 @@
 #include <AzCore/Script/ScriptContextDebug.h>
 #include <AzCore/Script/ScriptDebug.h>
 
+#include <AzCore/std/chrono/clocks.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Script/lua/lua.h>
 
@@ -64,6 +66,7 @@ namespace
 ScriptSystemComponent::ScriptSystemComponent()
 {
     m_defaultGarbageCollectorSteps = 2; // this is a default value, users should tweak this number for optimal performance
+    m_garbageCollectorTimeBudget = 0;
 }
 
 //=========================================================================
@@ -271,7 +274,32 @@ void    ScriptSystemComponent::OnSystemTick()
         }
 #endif // AZ_PROFILE_TELEMETRY
 
-        contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        if (m_garbageCollectorTimeBudget == 0)
+        {
+            contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+            continue;
+        }
+
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Script, "ScriptSystemComponent::GarbageCollectBudgeted");
+
+        // Step in small increments until the frame budget is spent, stop at the end of a cycle so an idle
+        // VM doesn't immediately start collecting again.
+        const AZStd::chrono::system_clock::time_point startTime = AZStd::chrono::system_clock::now();
+        const AZStd::chrono::microseconds budget(m_garbageCollectorTimeBudget);
+        AZStd::chrono::microseconds elapsed(0);
+        bool isCycleFinished = false;
+        while (!isCycleFinished && elapsed < budget)
+        {
+            isCycleFinished = contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+            elapsed = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::system_clock::now() - startTime);
+        }
+
+#ifdef AZ_PROFILE_TELEMETRY
+        if (contextContainer.m_context->GetId() == ScriptContextIds::DefaultScriptContextId)
+        {
+            AZ_PROFILE_DATAPOINT(AZ::Debug::ProfileCategory::Script, "Script GC Time (ms)", elapsed.count() / 1000.0);
+        }
+#endif // AZ_PROFILE_TELEMETRY
     }
 }
 
@@ -305,6 +333,14 @@ void ScriptSystemComponent::GarbageCollectStep(int numberOfSteps)
     }
 }
 
+//=========================================================================
+// SetGarbageCollectorTimeBudget
+//=========================================================================
+void ScriptSystemComponent::SetGarbageCollectorTimeBudget(AZ::u32 microseconds)
+{
+    m_garbageCollectorTimeBudget = microseconds;
+}
+
 bool ScriptSystemComponent::Load(const Data::Asset<ScriptAsset>& asset, ScriptContextId id)
 {
     ContextContainer* container = GetContextContainer(id);
@@ -825,7 +861,8 @@ void ScriptSystemComponent::Reflect(ReflectContext* reflection)
     {
         
         serializeContext->Class<ScriptSystemComponent, AZ::Component>()->
-            Field("garbageCollectorSteps", &ScriptSystemComponent::m_defaultGarbageCollectorSteps);
+            Field("garbageCollectorSteps", &ScriptSystemComponent::m_defaultGarbageCollectorSteps)->
+            Field("garbageCollectorTimeBudget", &ScriptSystemComponent::m_garbageCollectorTimeBudget);
 
         if (EditContext* editContext = serializeContext->GetEditContext())
         {
@@ -65,6 +65,7 @@ namespace AZ
 
         void GarbageCollect() override;
         void GarbageCollectStep(int numberOfSteps) override;
+        void SetGarbageCollectorTimeBudget(AZ::u32 microseconds) override;
 
         bool Load(const Data::Asset<ScriptAsset>& asset, ScriptContextId id) override;
         void ClearAssetReferences(Data::AssetId assetBaseId);
@@ -121,6 +122,7 @@ namespace AZ
             int                                 m_tableReference = -2; //< The reference to the table returned by the script (default -2 == LUA_NOREF)
         };
         int m_defaultGarbageCollectorSteps;
+        AZ::u32 m_garbageCollectorTimeBudget; ///< Microseconds of GC stepping per context and tick, 0 to use the fixed steps
 
         struct ContextContainer
         {
@@ -16,6 +16,7 @@
 
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Math/MathUtils.h>
@@ -58,7 +59,12 @@ namespace AZ
             , m_context(context)
         {}
 
-        void Build(const void* classPtr, const Uuid& classId);
+        /// Builds the tree of the object. If pathFilter is provided, only the nodes along that address and
+        /// the subtree at the address are built.
+        void Build(const void* classPtr, const Uuid& classId, const DataPatch::AddressType* pathFilter = nullptr);
+
+        /// \return the node at the address in a tree built with that address as path filter, null if the object doesn't have it.
+        const DataNode* FindPathNode(const DataPatch::AddressType& address) const;
 
         bool BeginNode(
             void* ptr,
@@ -110,6 +116,9 @@ namespace AZ
 
         DataNode m_root;
         DataNode* m_currentNode;        ///< Used as temp during tree building
+        const DataPatch::AddressType* m_pathFilter = nullptr; ///< Used as temp during tree building
+        AZStd::vector<u64> m_pathChildCounters; ///< Number of children visited for each node on the path, used as temp during tree building
+        bool m_skippedNode = false;     ///< Set when BeginNode didn't create a node, so the matching EndNode has nothing to close
         SerializeContext* m_context;
         AZStd::list<SerializeContext::ClassElement> m_dynamicClassElements; ///< Storage for class elements that represent dynamic serializable fields.
     };
@@ -117,12 +126,15 @@ namespace AZ
     //=========================================================================
     // DataNodeTree::Build
     //=========================================================================
-    void DataNodeTree::Build(const void* rootClassPtr, const Uuid& rootClassId)
+    void DataNodeTree::Build(const void* rootClassPtr, const Uuid& rootClassId, const DataPatch::AddressType* pathFilter)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
 
         m_root.Reset();
         m_currentNode = nullptr;
+        m_pathFilter = pathFilter;
+        m_pathChildCounters.clear();
+        m_skippedNode = false;
 
         if (m_context && rootClassPtr)
         {
@@ -144,6 +156,25 @@ namespace AZ
         }
 
         m_currentNode = nullptr;
+        m_pathFilter = nullptr;
+    }
+
+    //=========================================================================
+    // DataNodeTree::FindPathNode
+    //=========================================================================
+    const DataNode* DataNodeTree::FindPathNode(const DataPatch::AddressType& address) const
+    {
+        // Only the matching child was built at each level of the path.
+        const DataNode* node = &m_root;
+        for (size_t depth = 0; depth < address.size(); ++depth)
+        {
+            if (node->m_children.empty())
+            {
+                return nullptr;
+            }
+            node = &node->m_children.front();
+        }
+        return node->m_classData ? node : nullptr;
     }
 
     //=========================================================================
@@ -154,6 +185,30 @@ namespace AZ
         const SerializeContext::ClassData* classData,
         const SerializeContext::ClassElement* classElement)
     {
+        if (m_pathFilter && m_currentNode && m_pathChildCounters.size() <= m_pathFilter->size())
+        {
+            // We are on the path, skip the siblings of the next node on it. Elements are identified the same way
+            // CompareElementsInternal addresses them.
+            const u64 childIndex = m_pathChildCounters.back()++;
+            u64 elementId = 0;
+            if (m_currentNode->m_classData->m_container)
+            {
+                void* elementData = (classElement && (classElement->m_flags & SerializeContext::ClassElement::FLG_POINTER)) ? *(void**)(ptr) : ptr;
+                SerializeContext::ClassPersistentId persistentIdFunction = classData->GetPersistentId(*m_context);
+                elementId = persistentIdFunction ? persistentIdFunction(elementData) : childIndex;
+            }
+            else
+            {
+                elementId = classElement ? classElement->m_nameCrc : 0;
+            }
+
+            if (elementId != (*m_pathFilter)[m_pathChildCounters.size() - 1])
+            {
+                m_skippedNode = true;
+                return false;
+            }
+        }
+
         DataNode* newNode;
         if (m_currentNode)
         {
@@ -197,6 +252,10 @@ namespace AZ
         }
 
         m_currentNode = newNode;
+        if (m_pathFilter)
+        {
+            m_pathChildCounters.push_back(0);
+        }
         return true;
     }
 
@@ -205,6 +264,17 @@ namespace AZ
     //=========================================================================
     bool DataNodeTree::EndNode()
     {
+        if (m_skippedNode)
+        {
+            m_skippedNode = false;
+            return true;
+        }
+
+        if (m_pathFilter)
+        {
+            m_pathChildCounters.pop_back();
+        }
+
         if (m_currentNode->m_classData->m_eventHandler)
         {
             m_currentNode->m_classData->m_eventHandler->OnReadEnd(m_currentNode->m_data);
@@ -1131,6 +1201,145 @@ namespace AZ
         return true;
     }
 
+    //=========================================================================
+    // Update
+    //=========================================================================
+    bool DataPatch::Update(
+        const void* source,
+        const Uuid& sourceClassId,
+        const void* target,
+        const Uuid& targetClassId,
+        const AZStd::vector<AddressType>& dirtyAddresses,
+        const FlagsMap& sourceFlagsMap,
+        const FlagsMap& targetFlagsMap,
+        SerializeContext* context)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        if (!IsValid() || m_targetClassId != targetClassId || sourceClassId != targetClassId || m_patch.find(AddressType()) != m_patch.end())
+        {
+            // The patch doesn't come from a diff of the same types, there are no subtrees to update.
+            return Create(source, sourceClassId, target, targetClassId, sourceFlagsMap, targetFlagsMap, context);
+        }
+
+        if (!source || !target)
+        {
+            AZ_Error("Serialization", false, "Can't update a patch with invalid input source %p and target %p\n", source, target);
+            return false;
+        }
+
+        if (!context)
+        {
+            EBUS_EVENT_RESULT(context, ComponentApplicationBus, GetSerializeContext);
+            if (!context)
+            {
+                AZ_Error("Serialization", false, "Not serialize context provided! Failed to get component application default serialize context! ComponentApp is not started or input serialize context should not be null!");
+                return false;
+            }
+        }
+
+        auto isPrefixOf = [](const AddressType& prefix, const AddressType& address)
+        {
+            return prefix.size() <= address.size() && AZStd::equal(prefix.begin(), prefix.end(), address.begin());
+        };
+
+        // Patches stored above a dirty address hold the whole subtree, so the diff has to restart from there.
+        AZStd::vector<AddressType> subtrees;
+        subtrees.reserve(dirtyAddresses.size());
+        for (const AddressType& dirtyAddress : dirtyAddresses)
+        {
+            AddressType subtreeAddress = dirtyAddress;
+            for (const auto& patchPair : m_patch)
+            {
+                if (patchPair.first.size() < subtreeAddress.size() && isPrefixOf(patchPair.first, subtreeAddress))
+                {
+                    subtreeAddress = patchPair.first;
+                }
+            }
+            subtrees.push_back(AZStd::move(subtreeAddress));
+        }
+
+        // Diff each subtree once, nested dirty addresses are covered by their ancestor.
+        AZStd::sort(subtrees.begin(), subtrees.end(), [](const AddressType& lhs, const AddressType& rhs) { return lhs.size() < rhs.size(); });
+        for (size_t i = 0; i < subtrees.size(); ++i)
+        {
+            for (size_t j = subtrees.size() - 1; j > i; --j)
+            {
+                if (isPrefixOf(subtrees[i], subtrees[j]))
+                {
+                    subtrees.erase(subtrees.begin() + j);
+                }
+            }
+        }
+
+        DataNodeTree sourceTree(context);
+        DataNodeTree targetTree(context);
+        AZStd::vector<AZ::u8> tmpSourceBuffer;
+
+        for (AddressType& subtreeAddress : subtrees)
+        {
+            // Drop what the patch had for the subtree.
+            for (auto patchIter = m_patch.begin(); patchIter != m_patch.end(); )
+            {
+                if (isPrefixOf(subtreeAddress, patchIter->first))
+                {
+                    patchIter = m_patch.erase(patchIter);
+                }
+                else
+                {
+                    ++patchIter;
+                }
+            }
+
+            sourceTree.Build(source, sourceClassId, &subtreeAddress);
+            targetTree.Build(target, targetClassId, &subtreeAddress);
+            const DataNode* sourceNode = sourceTree.FindPathNode(subtreeAddress);
+            const DataNode* targetNode = targetTree.FindPathNode(subtreeAddress);
+
+            if (sourceNode && targetNode)
+            {
+                // In Create the flags are accumulated while recursing from the root.
+                Flags parentAddressFlags = 0;
+                AddressType parentAddress;
+                for (size_t depth = 0; depth < subtreeAddress.size(); ++depth)
+                {
+                    parentAddressFlags = DataNodeTree::CalculateDataFlagsAtThisAddress(sourceFlagsMap, targetFlagsMap, parentAddressFlags, parentAddress);
+                    parentAddress.push_back(subtreeAddress[depth]);
+                }
+
+                DataNodeTree::CompareElementsInternal(
+                    sourceNode,
+                    targetNode,
+                    m_patch,
+                    sourceFlagsMap,
+                    targetFlagsMap,
+                    context,
+                    subtreeAddress,
+                    parentAddressFlags,
+                    tmpSourceBuffer);
+            }
+            else if (targetNode)
+            {
+                // new in the target, store it
+                auto insertResult = m_patch.insert_key(subtreeAddress);
+                insertResult.first->second.clear();
+
+                IO::ByteContainerStream<DataPatch::PatchMap::mapped_type> stream(&insertResult.first->second);
+                if (!Utils::SaveObjectToStream(stream, AZ::ObjectStream::ST_BINARY, targetNode->m_data, targetNode->m_classData->m_typeId, context, targetNode->m_classData))
+                {
+                    AZ_Assert(false, "Unable to serialize class %s, SaveObjectToStream() failed.", targetNode->m_classData->m_name);
+                }
+            }
+            else if (sourceNode)
+            {
+                // record removal of element by inserting a key with a 0 byte patch
+                m_patch.insert_key(subtreeAddress);
+            }
+        }
+
+        return true;
+    }
+
     //=========================================================================
     // Apply
     //=========================================================================
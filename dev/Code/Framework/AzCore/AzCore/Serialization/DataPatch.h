@@ -141,6 +141,45 @@ namespace AZ
             return Create(sourceClassPtr, sourceClassId, targetClassPtr, targetClassId, sourceFlagsMap, targetFlagsMap, context);
         }
 
+        /**
+         * Update a patch previously created from the same source and target, after they changed only at the given
+         * addresses. Only the subtrees at the dirty addresses are diffed, the rest of the patch is kept, which makes
+         * small edits of large objects cost about as much as the edited data (plus one pass over the patch entries).
+         * Addresses are the ones used by the patch: element name CRCs for class members, persistent ids or indices for
+         * container elements. Adding or removing container elements without persistent ids shifts the indices of the
+         * following elements, mark the container itself dirty in that case.
+         * Falls back to Create() if the patch wasn't created from objects of the same type.
+         *
+         * \param dirtyAddresses addresses of the data that changed since the patch was created or last updated.
+         * See Create() for the other parameters.
+         */
+        bool Update(
+            const void* source,
+            const Uuid& sourceClassId,
+            const void* target,
+            const Uuid& targetClassId,
+            const AZStd::vector<AddressType>& dirtyAddresses,
+            const FlagsMap& sourceFlagsMap = FlagsMap(),
+            const FlagsMap& targetFlagsMap = FlagsMap(),
+            SerializeContext* context = nullptr);
+
+        /// T and U should either be the same type a common base class
+        template<class T, class U>
+        bool Update(
+            const T* source,
+            const U* target,
+            const AZStd::vector<AddressType>& dirtyAddresses,
+            const FlagsMap& sourceFlagsMap = FlagsMap(),
+            const FlagsMap& targetFlagsMap = FlagsMap(),
+            SerializeContext* context = nullptr)
+        {
+            const void* sourceClassPtr = SerializeTypeInfo<T>::RttiCast(source, SerializeTypeInfo<T>::GetRttiTypeId(source));
+            const Uuid& sourceClassId = SerializeTypeInfo<T>::GetUuid(source);
+            const void* targetClassPtr = SerializeTypeInfo<U>::RttiCast(target, SerializeTypeInfo<U>::GetRttiTypeId(target));
+            const Uuid& targetClassId = SerializeTypeInfo<U>::GetUuid(target);
+            return Update(sourceClassPtr, sourceClassId, targetClassPtr, targetClassId, dirtyAddresses, sourceFlagsMap, targetFlagsMap, context);
+        }
+
         /**
          * Apply the patch to a source instance and generate a patched instance, from a source instance.
          * If patch can't be applied a null pointer is returned. Currently the only reason for that is if
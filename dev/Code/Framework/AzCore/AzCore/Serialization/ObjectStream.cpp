@@ -29,6 +29,7 @@
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/TextStreamWriters.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/Module/ModuleManagerBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Jobs/JobManager.h>
 
@@ -66,6 +67,14 @@ namespace AZ
         static const u8 s_xmlStreamTag = '<';
         static const u8 s_jsonStreamTag = '{';
 
+        // Types which aren't reflected may come from a module that is only loaded when one of its types is needed
+        static const SerializeContext::ClassData* FindOnDemandClassData(SerializeContext& sc, const Uuid& classId, const SerializeContext::ClassData* parent, u32 elementNameCrc)
+        {
+            bool isModuleLoaded = false;
+            ModuleManagerRequestBus::BroadcastResult(isModuleLoaded, &ModuleManagerRequests::LoadOnDemandModuleForType, classId);
+            return isModuleLoaded ? sc.FindClassData(classId, parent, elementNameCrc) : nullptr;
+        }
+
         class ObjectStreamImpl;
 
         /**
@@ -200,6 +209,10 @@ namespace AZ
 
             AZStd::fixed_vector<char, 128>       m_scratchSpace; // prevent malloc thrash
 
+            // Value of the last binary element read, referenced in the source stream when it lives in memory
+            // and the value is consumed by a serializer before the next element is read.
+            const char*                          m_inPlaceValue = nullptr;
+
             struct JSonReadNode
             {
                 JSonReadNode()
@@ -783,12 +796,18 @@ namespace AZ
                     // Wrap the stream
                     IO::GenericStream* currentStream = &m_inStream;
                     IO::MemoryStream memStream(m_inStream.GetData()->data(), 0, element.m_dataSize);
+                    IO::MemoryStream inPlaceStream(m_inPlaceValue, element.m_dataSize);
                     currentStream = &memStream;
 
                     if (element.m_byteStream.GetLength() > 0)
                     {
                         currentStream = &element.m_byteStream;
                     }
+                    else if (m_inPlaceValue && !isConvertedData)
+                    {
+                        currentStream = &inPlaceStream;
+                    }
+                    m_inPlaceValue = nullptr;
 
                     currentStream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
 
@@ -1080,6 +1099,10 @@ namespace AZ
  
                 // find the registered class data
                 cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+                if (!cd)
+                {
+                    cd = FindOnDemandClassData(sc, element.m_id, parent, element.m_nameCrc);
+                }
 
                 if (cd)
                 {
@@ -1208,6 +1231,10 @@ namespace AZ
 
                 // find the registered class data
                 cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+                if (!cd)
+                {
+                    cd = FindOnDemandClassData(sc, element.m_id, parent, element.m_nameCrc);
+                }
                 if (cd)
                 {
                     // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
@@ -1247,6 +1274,8 @@ namespace AZ
             }
             else /*ST_BINARY*/
             {
+                m_inPlaceValue = nullptr;
+
                 if (m_stream->GetCurPos() == m_stream->GetLength())
                 {
                     // Reached the end of the stream. We may reach this state if we just skipped the root element
@@ -1318,6 +1347,10 @@ namespace AZ
 
                 // find the registered class data
                 cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+                if (!cd)
+                {
+                    cd = FindOnDemandClassData(sc, element.m_id, parent, element.m_nameCrc);
+                }
                 if (cd)
                 {
                     // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
@@ -1378,7 +1411,18 @@ namespace AZ
 
                     element.m_dataSize = valueBytes;
                     element.m_stream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
-                    if (element.m_dataSize)
+
+                    // Leaf values read straight into the load stream are only needed until LoadClass hands them to the
+                    // serializer, so when the source is in memory the serializer can read them from there instead.
+                    const char* sourceBuffer = reinterpret_cast<const char*>(m_stream->GetContiguousBuffer());
+                    if (sourceBuffer && element.m_dataSize && element.m_stream == &m_inStream
+                        && cd && cd->m_serializer && element.m_id != GetAssetClassId()
+                        && m_stream->GetCurPos() + valueBytes <= m_stream->GetLength())
+                    {
+                        m_inPlaceValue = sourceBuffer + m_stream->GetCurPos();
+                        m_stream->Seek(valueBytes, IO::GenericStream::ST_SEEK_CUR);
+                    }
+                    else if (element.m_dataSize)
                     {
                         void* data = m_scratchSpace.data();
                         if (element.m_dataSize > m_scratchSpace.capacity())
@@ -1828,6 +1828,11 @@ namespace AZ
                 for (size_t i = 0, n = dataClassInfo->m_elements.size(); i < n; ++i)
                 {
                     const SerializeContext::ClassElement& ed = dataClassInfo->m_elements[i];
+                    if (callContext->m_skipPlainValues && (ed.m_flags & ClassElement::FLG_PLAIN_VALUE))
+                    {
+                        continue;
+                    }
+
                     void* dataAddress = (char*)(objectPtr) + ed.m_offset;
                     if (dataAddress)
                     {
@@ -1983,6 +1988,7 @@ namespace AZ
             this,
             SerializeContext::ENUM_ACCESS_FOR_READ,
             &m_errorLogger);
+        callContext.m_skipPlainValues = true;
 
         EnumerateInstance(
             &callContext
@@ -2016,6 +2022,7 @@ namespace AZ
                 this,
                 SerializeContext::ENUM_ACCESS_FOR_READ,
                 &m_errorLogger);
+            callContext.m_skipPlainValues = true;
 
             EnumerateInstance(
                 &callContext
@@ -2143,6 +2150,15 @@ namespace AZ
             classData->m_container->ClearElements(destPtr, this);
         }
 
+        // Plain values are not enumerated, copy them as they are laid out in the class.
+        if (destPtr)
+        {
+            for (const ClassData::PlainValueRange& range : classData->m_plainValueRanges)
+            {
+                memcpy(reinterpret_cast<char*>(destPtr) + range.m_offset, reinterpret_cast<const char*>(srcPtr) + range.m_offset, range.m_size);
+            }
+        }
+
         // push this node in the stack
         cloneData->m_parentStack.push_back();
         ObjectCloneData::ParentInfo& parentInfo = cloneData->m_parentStack.back();
@@ -23,6 +23,7 @@
 #include <AzCore/std/string/string_view.h>
 
 #include <AzCore/std/typetraits/disjunction.h>
+#include <AzCore/std/typetraits/is_arithmetic.h>
 #include <AzCore/std/typetraits/is_pointer.h>
 #include <AzCore/std/typetraits/is_abstract.h>
 #include <AzCore/std/typetraits/negation.h>
@@ -300,6 +301,7 @@ namespace AZ
                 FLG_NO_DEFAULT_VALUE    = (1 << 2),       ///< Set if the class element can't have a default value.
                 FLG_DYNAMIC_FIELD       = (1 << 3),       ///< Set if the class element represents a dynamic field (DynamicSerializableField::m_data).
                 FLG_UI_ELEMENT          = (1 << 4),       ///< Set if the class element represents a UI element tied to the ClassData of its parent.
+                FLG_PLAIN_VALUE         = (1 << 5),       ///< Set if the element is an arithmetic or enum value, which clones copy together with the other plain values of the holding class.
             };
 
             enum class AttributeOwnership
@@ -342,6 +344,14 @@ namespace AZ
         class ClassData
         {
         public:
+            /// Bytes of a class instance that hold adjacent plain value elements, see ClassElement::FLG_PLAIN_VALUE.
+            struct PlainValueRange
+            {
+                size_t m_offset;
+                size_t m_size;
+            };
+            typedef AZStd::vector<PlainValueRange> PlainValueRangeArray;
+
             ClassData();
             ~ClassData() { ClearAttributes(); }
             template<class T>
@@ -380,6 +390,7 @@ namespace AZ
 
             Edit::ClassData*    m_editData;         ///< Edit data for the class display.
             ClassElementArray   m_elements;         ///< Sub elements. If this is not empty m_serializer should be NULL (there is no point to have sub-elements, if we can serialize the entire class).
+            PlainValueRangeArray m_plainValueRanges; ///< Clone plan built with the elements, cloning copies these ranges and skips the plain value elements.
 
             ///< Attributes for this class type. Lambda is required here as AZStdFunctorAllocator expects a function pointer
             ///< that returns an IAllocatorAllocate& and the AZ::AllocatorInstance<AZ::SystemAllocator>::Get returns an AZ::SystemAllocator&
@@ -778,6 +789,7 @@ namespace AZ
             unsigned int                    m_accessFlags;          ///< Data access flags for the enumeration, see \ref EnumerationAccessFlags.
             ErrorHandler*                   m_errorHandler;         ///< Optional user error handler.
             const SerializeContext*         m_context;              ///< Serialize context containing class reflection required for data traversal.
+            bool                            m_skipPlainValues = false; ///< Don't enumerate elements flagged with ClassElement::FLG_PLAIN_VALUE, the callbacks handle them with ClassData::m_plainValueRanges.
 
             IDataContainer::ElementCB       m_elementCallback;      // Pre-bound functor computed internally to avoid allocating closures during traversal.
             ErrorHandler                    m_defaultErrorHandler;  // If no custom error handler is provided, the context provides one.
@@ -1540,6 +1552,21 @@ namespace AZ
         ed.m_editData = nullptr;
         ed.m_azRtti = GetRttiHelper<ValueType>();
 
+        if (AZStd::is_arithmetic<ElementType>::value)
+        {
+            // Extend the clone plan, fields declared next to each other in the class are copied in one go.
+            ed.m_flags |= ClassElement::FLG_PLAIN_VALUE;
+            ClassData::PlainValueRangeArray& ranges = m_classData->second.m_plainValueRanges;
+            if (!ranges.empty() && ranges.back().m_offset + ranges.back().m_size == ed.m_offset)
+            {
+                ranges.back().m_size += ed.m_dataSize;
+            }
+            else
+            {
+                ranges.push_back({ ed.m_offset, ed.m_dataSize });
+            }
+        }
+
         ed.m_genericClassInfo = SerializeGenericTypeInfo<ValueType>::GetGenericInfo();
         ed.m_typeId = SerializeGenericTypeInfo<ValueType>::GetClassTypeId();
         AZ_Assert(!ed.m_typeId.IsNull(), "You must provide a valid class id for class %s", name);
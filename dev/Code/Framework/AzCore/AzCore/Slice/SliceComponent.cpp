@@ -687,32 +687,9 @@ namespace AZ
             dependentSlice->GetEntities(sourceObjects.m_entities);
             dependentSlice->GetAllMetadataEntities(sourceObjects.m_metadataEntities);
 
-            instance->m_instantiated = dependentSlice->GetSerializeContext()->CloneObject(&sourceObjects);
-
             AZ_Assert(!sourceObjects.m_metadataEntities.empty(), "Metadata Entities must exist at slice instantiation time");
 
-            AZ::IdUtils::Remapper<EntityId>::ReplaceIdsAndIdRefs(instance->m_instantiated,
-                [&](const EntityId& originalId, bool isEntityId, const AZStd::function<EntityId()>& idGenerator) -> EntityId
-                {
-                    if (isEntityId) // replace EntityId
-                    {
-                        EntityId newId = customMapper ? customMapper(originalId, isEntityId, idGenerator) : idGenerator();
-                        auto insertIt = instance->m_baseToNewEntityIdMap.insert(AZStd::make_pair(originalId, newId));
-                        return insertIt.first->second;
-                    }
-                    else // replace EntityRef
-                    {
-                        auto findIt = instance->m_baseToNewEntityIdMap.find(originalId);
-                        if (findIt == instance->m_baseToNewEntityIdMap.end())
-                        {
-                            return originalId; // Referenced EntityId is not part of the slice, so keep the same id reference.
-                        }
-                        else
-                        {
-                            return findIt->second; // return the remapped id
-                        }
-                    }
-                }, dependentSlice->GetSerializeContext());
+            instance->m_instantiated = dependentSlice->CloneInstanceEntities(sourceObjects, instance->m_baseToNewEntityIdMap, customMapper);
 
             AZ_Assert(m_component, "We need a valid component to use this operation!");
 
@@ -1008,7 +985,7 @@ namespace AZ
 
             // Generate new Ids and populate the map.
             AZ_Assert(!dataPatch.IsValid(), "Data patch is valid for slice instance, but entity Id map is not!");
-            instance.m_instantiated = IdUtils::Remapper<EntityId>::CloneObjectAndGenerateNewIdsAndFixRefs(&sourceObjects, entityIdMap, dependentSlice->GetSerializeContext());
+            instance.m_instantiated = dependentSlice->CloneInstanceEntities(sourceObjects, entityIdMap, nullptr);
         }
         else
         {
@@ -1270,6 +1247,7 @@ namespace AZ
         : m_myAsset(nullptr)
         , m_serializeContext(nullptr)
         , m_hasGeneratedCachedDataFlags(false)
+        , m_hasCachedGeneratedInstanceIds(false)
         , m_slicesAreInstantiated(false)
         , m_allowPartialInstantiation(true)
         , m_isDynamic(false)
@@ -3050,6 +3028,119 @@ namespace AZ
         m_hasGeneratedCachedDataFlags = true;
     }
 
+    //=========================================================================
+    SliceComponent::InstantiatedContainer* SliceComponent::CloneInstanceEntities(const InstantiatedContainer& sourceObjects,
+        EntityIdToEntityIdMap& sourceToNewIdMap, const AZ::IdUtils::Remapper<AZ::EntityId>::IdMapper& customMapper)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+        AZ_Assert(sourceToNewIdMap.empty(), "Instance entities are cloned into a fresh id map.");
+
+        InstantiatedContainer* instantiated = GetSerializeContext()->CloneObject(&sourceObjects);
+
+        if (const EntityIdSet* generatedIds = GetGeneratedInstanceIds(sourceObjects))
+        {
+            // The ids to replace are known from an earlier instance, so generate them up front and fix up
+            // ids and references in one pass instead of one pass for each.
+            const AZ::IdUtils::Remapper<AZ::EntityId>::IdGenerator idGenerator = &Entity::MakeId;
+            for (const EntityId& generatedId : *generatedIds)
+            {
+                sourceToNewIdMap.emplace(generatedId, customMapper ? customMapper(generatedId, true, idGenerator) : Entity::MakeId());
+            }
+
+            AZ::IdUtils::Remapper<EntityId>::RemapIdsAndIdRefs(instantiated,
+                [&sourceToNewIdMap](const EntityId& originalId) -> EntityId
+                {
+                    auto findIt = sourceToNewIdMap.find(originalId);
+                    return findIt != sourceToNewIdMap.end() ? findIt->second : originalId;
+                }, GetSerializeContext());
+
+            return instantiated;
+        }
+
+        AZ::IdUtils::Remapper<EntityId>::ReplaceIdsAndIdRefs(instantiated,
+            [&](const EntityId& originalId, bool isEntityId, const AZStd::function<EntityId()>& idGenerator) -> EntityId
+            {
+                if (isEntityId) // replace EntityId
+                {
+                    EntityId newId = customMapper ? customMapper(originalId, isEntityId, idGenerator) : idGenerator();
+                    auto insertIt = sourceToNewIdMap.insert(AZStd::make_pair(originalId, newId));
+                    return insertIt.first->second;
+                }
+                else // replace EntityRef
+                {
+                    auto findIt = sourceToNewIdMap.find(originalId);
+                    if (findIt == sourceToNewIdMap.end())
+                    {
+                        return originalId; // Referenced EntityId is not part of the slice, so keep the same id reference.
+                    }
+                    else
+                    {
+                        return findIt->second; // return the remapped id
+                    }
+                }
+            }, GetSerializeContext());
+
+        CacheGeneratedInstanceIds(sourceToNewIdMap);
+
+        return instantiated;
+    }
+
+    //=========================================================================
+    const SliceComponent::EntityIdSet* SliceComponent::GetGeneratedInstanceIds(const InstantiatedContainer& sourceObjects) const
+    {
+        if (!m_hasCachedGeneratedInstanceIds)
+        {
+            return nullptr;
+        }
+
+        // Entities added since the ids were recorded would keep their source id, so fall back to generating the ids
+        // while enumerating. Ids generated deeper in the entities (e.g. entities owned by components) are only checked
+        // through their owning entity.
+        const size_t sourceEntityCount = sourceObjects.m_entities.size() + sourceObjects.m_metadataEntities.size();
+        if (m_cachedGeneratedInstanceIds.size() < sourceEntityCount)
+        {
+            return nullptr;
+        }
+
+        auto areIdsCached = [this](const EntityList& entities)
+        {
+            for (const Entity* entity : entities)
+            {
+                if (m_cachedGeneratedInstanceIds.find(entity->GetId()) == m_cachedGeneratedInstanceIds.end())
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        if (!areIdsCached(sourceObjects.m_entities) || !areIdsCached(sourceObjects.m_metadataEntities))
+        {
+            return nullptr;
+        }
+
+        return &m_cachedGeneratedInstanceIds;
+    }
+
+    //=========================================================================
+    void SliceComponent::CacheGeneratedInstanceIds(const EntityIdToEntityIdMap& generatedIdMap)
+    {
+        // Use lock since slice instantiation can occur from multiple threads
+        AZStd::unique_lock<AZStd::recursive_mutex> lock(m_instantiateMutex);
+        if (m_hasCachedGeneratedInstanceIds)
+        {
+            return;
+        }
+
+        m_cachedGeneratedInstanceIds.reserve(generatedIdMap.size());
+        for (const auto& idPair : generatedIdMap)
+        {
+            m_cachedGeneratedInstanceIds.insert(idPair.first);
+        }
+
+        m_hasCachedGeneratedInstanceIds = true;
+    }
+
     //=========================================================================
     const SliceComponent::DataFlagsPerEntity* SliceComponent::GetCorrectBundleOfDataFlags(EntityId entityId) const
     {
@@ -941,6 +941,20 @@ namespace AZ
         const DataFlagsPerEntity& GetDataFlagsForInstances() const;
         void BuildDataFlagsForInstances();
 
+        /// Clones the entities of this slice for a new instance, generating new entity ids and fixing up references to them.
+        /// \param sourceObjects the entities and metadata entities of this slice.
+        /// \param sourceToNewIdMap empty map that receives the source to new id mapping of the instance.
+        /// \param customMapper optional mapper used to pick the new entity ids.
+        InstantiatedContainer* CloneInstanceEntities(const InstantiatedContainer& sourceObjects, EntityIdToEntityIdMap& sourceToNewIdMap,
+            const AZ::IdUtils::Remapper<AZ::EntityId>::IdMapper& customMapper);
+
+        /// Returns the ids that get a newly generated value when a fresh instance of this slice is cloned from \ref sourceObjects,
+        /// or nullptr if they have not been recorded yet or no longer cover the source entities.
+        /// With the ids known up front, ids and id references of a new instance are remapped in a single pass.
+        const EntityIdSet* GetGeneratedInstanceIds(const InstantiatedContainer& sourceObjects) const;
+        /// Records the ids generated for the first fresh instance of this slice, given the source to new id map it produced.
+        void CacheGeneratedInstanceIds(const EntityIdToEntityIdMap& generatedIdMap);
+
         /**
         * During instance instantiation, entities from root slices may be removed by data patches. We need to remove these
         * from the metadata associations in our newly cloned instance metadata entities.
@@ -990,6 +1004,9 @@ namespace AZ
         DataFlagsPerEntity m_cachedDataFlagsForInstances; ///< Cached DataFlags to be used when instantiating instances of this slice.
         bool m_hasGeneratedCachedDataFlags; ///< Whether the cached DataFlags have been generated yet.
 
+        EntityIdSet m_cachedGeneratedInstanceIds; ///< Ids that fresh instances of this slice generate new values for.
+        AZStd::atomic<bool> m_hasCachedGeneratedInstanceIds; ///< Whether the generated instance ids have been recorded yet.
+
         AZStd::atomic<bool> m_slicesAreInstantiated; ///< Instantiate state of the base slices (they should be instantiated or not)
 
         bool m_allowPartialInstantiation; ///< Instantiation is still allowed even if dependencies are missing.
@@ -42,6 +42,7 @@
 #include "Debug/Profiler.cpp"
 #include "Debug/ProfilerDriller.cpp"
 #include "Debug/FrameProfilerComponent.cpp"
+#include "Debug/EBusProfiler.cpp"
 #include "Debug/StackTracer.cpp"
 
 #include "IO/Device.cpp"
@@ -52,6 +53,9 @@
 #else
 #pragma message("Compression is excluded from build.")
 #endif // #if !defined(AZCORE_EXCLUDE_ZLIB)
+#if !defined(AZCORE_EXCLUDE_ZSTANDARD)
+#include "IO/CompressorZStd.cpp"
+#endif // #if !defined(AZCORE_EXCLUDE_ZSTANDARD)
 
 #include "IO/Streamer.cpp"
 #include "IO/StreamerLayoutHelper.cpp"
@@ -62,6 +66,7 @@
 #include "IO/FileIO.cpp"
 
 #include "Math/Aabb.cpp"
+#include "Math/BatchMath.cpp"
 #include "Math/Crc.cpp"
 #include "Math/IntersectSegment.cpp"
 #include "Math/Matrix3x3.cpp"
@@ -83,12 +88,17 @@
 #if !defined(AZCORE_EXCLUDE_ZLIB)
 #include "Compression/Compression.cpp"
 #endif // #if !defined(AZCORE_EXCLUDE_ZLIB)
+#if !defined(AZCORE_EXCLUDE_ZSTANDARD)
+#include "Compression/zstd_compression.cpp"
+#endif // #if !defined(AZCORE_EXCLUDE_ZSTANDARD)
 
 #include "Memory/AllocationRecords.cpp"
+#include "Memory/AllocationSnapshot.cpp"
 #include "Memory/AllocatorBase.cpp"
 #include "Memory/AllocatorManager.cpp"
 #include "Memory/BestFitExternalMapAllocator.cpp"
 #include "Memory/BestFitExternalMapSchema.cpp"
+#include "Memory/FrameArenaSchema.cpp"
 #include "Memory/OSAllocator.cpp"
 //#include "Memory/HeapSchema.cpp" deprecated
 #include "Memory/HphaSchema.cpp"
@@ -118,6 +128,7 @@
 #include "Jobs/Internal/JobManagerSynchronous.cpp"
 #include "Jobs/Internal/JobManagerWorkStealing.cpp"
 #include "Jobs/JobManagerComponent.cpp"
+#include "Jobs/JobManagerTopology.cpp"
 
 #include "Driller/Driller.cpp"
 #include "Driller/DrillerBus.cpp"
@@ -0,0 +1,203 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/std/flat_hash_table.h>
+#include <AzCore/std/tuple.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashMapTableTraits
+        {
+            typedef Key                             key_type;
+            typedef EqualKey                        key_eq;
+            typedef Hasher                          hasher;
+            typedef AZStd::pair<Key, MappedType>    value_type;
+            typedef Allocator                       allocator_type;
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value)  { return value.first;   }
+        };
+    }
+
+    /**
+     * Flat hash map, a drop in replacement for the unordered_map when lookups are hot. The pairs are stored in one open
+     * addressing table (see \ref flat_hash_table) instead of a list node each, so inserting doesn't allocate per element
+     * and a lookup usually touches one group of control bytes and one slot.
+     * Unlike the unordered_map inserting invalidates iterators and references to the elements, and so does operator[].
+     * The extensions of the unordered_map (insert_key, find_as, get_allocator returning a reference) are supported.
+     */
+    template<class Key, class MappedType, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator >
+    class flat_hash_map
+        : public flat_hash_table< Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator> >
+    {
+        typedef flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator> this_type;
+        typedef flat_hash_table< Internal::FlatHashMapTableTraits<Key, MappedType, Hasher, EqualKey, Allocator> > base_type;
+    public:
+        typedef typename base_type::traits_type traits_type;
+
+        typedef typename base_type::key_type    key_type;
+        typedef typename base_type::key_eq      key_eq;
+        typedef typename base_type::hasher      hasher;
+        typedef MappedType                      mapped_type;
+
+        typedef typename base_type::allocator_type              allocator_type;
+        typedef typename base_type::size_type                   size_type;
+        typedef typename base_type::difference_type             difference_type;
+        typedef typename base_type::pointer                     pointer;
+        typedef typename base_type::const_pointer               const_pointer;
+        typedef typename base_type::reference                   reference;
+        typedef typename base_type::const_reference             const_reference;
+
+        typedef typename base_type::iterator                    iterator;
+        typedef typename base_type::const_iterator              const_iterator;
+
+        typedef typename base_type::value_type                  value_type;
+
+        typedef typename base_type::pair_iter_bool              pair_iter_bool;
+
+        AZ_FORCE_INLINE flat_hash_map()
+            : base_type(hasher(), key_eq(), allocator_type()) {}
+        explicit flat_hash_map(const allocator_type& alloc)
+            : base_type(hasher(), key_eq(), alloc) {}
+        AZ_FORCE_INLINE flat_hash_map(const flat_hash_map& rhs)
+            : base_type(rhs) {}
+        AZ_FORCE_INLINE flat_hash_map(const hasher& hash, const key_eq& keyEqual, const allocator_type& allocator)
+            : base_type(hash, keyEqual, allocator) {}
+        /// Reserves space for numElements (unlike the unordered_map which takes a number of buckets).
+        explicit flat_hash_map(size_type numElements, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::reserve(numElements);
+        }
+        template<class Iterator>
+        flat_hash_map(Iterator first, Iterator last, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::insert(first, last);
+        }
+        flat_hash_map(const std::initializer_list<value_type>& list, const hasher& hash = hasher(), const key_eq& keyEqual = key_eq(), const allocator_type& allocator = allocator_type())
+            : base_type(hash, keyEqual, allocator)
+        {
+            base_type::insert(list);
+        }
+        AZ_FORCE_INLINE flat_hash_map(this_type&& rhs)
+            : base_type(AZStd::move(rhs)) {}
+
+        this_type& operator=(this_type&& rhs)
+        {
+            base_type::operator=(AZStd::move(rhs));
+            return *this;
+        }
+        AZ_FORCE_INLINE this_type& operator=(const this_type& rhs)
+        {
+            base_type::operator=(rhs);
+            return *this;
+        }
+
+        /**
+         * Look up operator if element doesn't exists inserts a new one with (key,mapped_type()).
+         */
+        AZ_FORCE_INLINE mapped_type& operator[](const key_type& key)
+        {
+            return insert_key(key).first->second;
+        }
+        AZ_FORCE_INLINE mapped_type& operator[](key_type&& key)
+        {
+            return try_emplace(AZStd::move(key)).first->second;
+        }
+        /**
+         * Returns mapped type with based on the key, if the element doesn't exist an assert it triggered!
+         */
+        AZ_FORCE_INLINE mapped_type& at(const key_type& key)
+        {
+            iterator iter = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+        AZ_FORCE_INLINE const mapped_type& at(const key_type& key) const
+        {
+            const_iterator iter = base_type::find(key);
+            AZSTD_CONTAINER_ASSERT(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+
+        /// Constructs the mapped value from the arguments only if the key is not in the map.
+        template<class... Args>
+        AZ_FORCE_INLINE pair_iter_bool try_emplace(const key_type& key, Args&&... arguments)
+        {
+            return base_type::emplace_unique(key, AZStd::piecewise_construct_t(), AZStd::forward_as_tuple(key), AZStd::forward_as_tuple(AZStd::forward<Args>(arguments)...));
+        }
+        template<class... Args>
+        AZ_FORCE_INLINE pair_iter_bool try_emplace(key_type&& key, Args&&... arguments)
+        {
+            return base_type::emplace_unique(key, AZStd::piecewise_construct_t(), AZStd::forward_as_tuple(AZStd::move(key)), AZStd::forward_as_tuple(AZStd::forward<Args>(arguments)...));
+        }
+        template<class M>
+        pair_iter_bool insert_or_assign(const key_type& key, M&& value)
+        {
+            pair_iter_bool iterBool = try_emplace(key, AZStd::forward<M>(value));
+            if (!iterBool.second)
+            {
+                iterBool.first->second = AZStd::forward<M>(value);
+            }
+            return iterBool;
+        }
+
+        /**
+         * \anchor FlatHashMapExtensions
+         * \name Extensions
+         * @{
+         */
+        /**
+         * Insert a pair with default value base on a key only (AKA lazy insert). This can be a speed up when
+         * the object has complicated assignment function.
+         */
+        AZ_FORCE_INLINE pair_iter_bool insert_key(const key_type& key)
+        {
+            return base_type::emplace_unique(key, key);
+        }
+        /// @}
+    };
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator >
+    AZ_FORCE_INLINE void swap(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& left, flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template <class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    bool operator==(const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& a, const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& b)
+    {
+        // the iteration order depends on the capacity and erase history, compare by lookup
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+        for (const auto& element : a)
+        {
+            auto iter = b.find(element.first);
+            if (iter == b.end() || !(iter->second == element.second))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    AZ_FORCE_INLINE bool operator!=(const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& a, const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& b)
+    {
+        return !(a == b);
+    }
+}
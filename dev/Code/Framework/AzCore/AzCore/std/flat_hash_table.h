@@ -0,0 +1,876 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/utils.h>
+#include <AzCore/std/typetraits/alignment_of.h>
+
+#if AZ_TRAIT_HARDWARE_ENABLE_EMM_INTRINSICS
+#   include <emmintrin.h>
+#endif
+#if defined(AZ_COMPILER_MSVC)
+#   include <intrin.h>
+#endif
+
+namespace AZStd
+{
+    template<class Traits>
+    class flat_hash_table;
+
+    namespace Internal
+    {
+        /**
+         * Control byte of a flat_hash_table slot. Full slots store the low 7 bits of the element hash (so the byte is
+         * positive), the other states are negative.
+         */
+        typedef signed char flat_hash_ctrl_type;
+
+        enum : flat_hash_ctrl_type
+        {
+            FLAT_HASH_CTRL_EMPTY    = -128,
+            FLAT_HASH_CTRL_DELETED  = -2,
+            FLAT_HASH_CTRL_SENTINEL = -1,   ///< Stored after the last slot, stops the iterators.
+        };
+
+        AZ_FORCE_INLINE unsigned int flat_hash_trailing_zeros(unsigned int mask)
+        {
+#if defined(AZ_COMPILER_MSVC)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return static_cast<unsigned int>(index);
+#else
+            return static_cast<unsigned int>(__builtin_ctz(mask));
+#endif
+        }
+
+        /**
+         * Group of 16 control bytes, matched all at once with SSE2 (or a byte loop where it's not available).
+         * The matches are returned as bit masks, bit i set when slot i of the group matches.
+         */
+        class flat_hash_group
+        {
+        public:
+            enum
+            {
+                width = 16
+            };
+
+#if AZ_TRAIT_HARDWARE_ENABLE_EMM_INTRINSICS
+            AZ_FORCE_INLINE explicit flat_hash_group(const flat_hash_ctrl_type* ctrl)
+                : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+            AZ_FORCE_INLINE unsigned int match(flat_hash_ctrl_type h2) const
+            {
+                return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl)));
+            }
+            AZ_FORCE_INLINE unsigned int match_empty() const
+            {
+                return match(FLAT_HASH_CTRL_EMPTY);
+            }
+            AZ_FORCE_INLINE unsigned int match_empty_or_deleted() const
+            {
+                // empty and deleted are the only values smaller than the sentinel
+                return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(FLAT_HASH_CTRL_SENTINEL), m_ctrl)));
+            }
+
+        private:
+            __m128i m_ctrl;
+#else
+            AZ_FORCE_INLINE explicit flat_hash_group(const flat_hash_ctrl_type* ctrl)
+                : m_ctrl(ctrl) {}
+
+            AZ_FORCE_INLINE unsigned int match(flat_hash_ctrl_type h2) const
+            {
+                unsigned int mask = 0;
+                for (unsigned int i = 0; i < width; ++i)
+                {
+                    mask |= static_cast<unsigned int>(m_ctrl[i] == h2) << i;
+                }
+                return mask;
+            }
+            AZ_FORCE_INLINE unsigned int match_empty() const
+            {
+                return match(FLAT_HASH_CTRL_EMPTY);
+            }
+            AZ_FORCE_INLINE unsigned int match_empty_or_deleted() const
+            {
+                unsigned int mask = 0;
+                for (unsigned int i = 0; i < width; ++i)
+                {
+                    mask |= static_cast<unsigned int>(m_ctrl[i] < FLAT_HASH_CTRL_SENTINEL) << i;
+                }
+                return mask;
+            }
+
+        private:
+            const flat_hash_ctrl_type* m_ctrl;
+#endif
+        };
+
+        template<class T>
+        class flat_hash_table_const_iterator
+        {
+            template<class Traits>
+            friend class AZStd::flat_hash_table;
+            typedef flat_hash_table_const_iterator      this_type;
+        public:
+            typedef T                                   value_type;
+            typedef AZStd::ptrdiff_t                    difference_type;
+            typedef const T*                            pointer;
+            typedef const T&                            reference;
+            typedef AZStd::forward_iterator_tag         iterator_category;
+
+            AZ_FORCE_INLINE flat_hash_table_const_iterator()
+                : m_ctrl(nullptr)
+                , m_slot(nullptr) {}
+            AZ_FORCE_INLINE flat_hash_table_const_iterator(const flat_hash_ctrl_type* ctrl, T* slot)
+                : m_ctrl(ctrl)
+                , m_slot(slot) {}
+            AZ_FORCE_INLINE reference operator*() const { return *m_slot; }
+            AZ_FORCE_INLINE pointer operator->() const { return m_slot; }
+            AZ_FORCE_INLINE this_type& operator++()
+            {
+                AZSTD_CONTAINER_ASSERT(m_ctrl != nullptr && *m_ctrl != FLAT_HASH_CTRL_SENTINEL, "AZStd::flat_hash_table::const_iterator invalid slot!");
+                ++m_ctrl;
+                ++m_slot;
+                skip_free_slots();
+                return *this;
+            }
+            AZ_FORCE_INLINE this_type operator++(int)
+            {
+                this_type tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+            AZ_FORCE_INLINE bool operator==(const this_type& rhs) const { return m_slot == rhs.m_slot; }
+            AZ_FORCE_INLINE bool operator!=(const this_type& rhs) const { return m_slot != rhs.m_slot; }
+
+        protected:
+            AZ_FORCE_INLINE void skip_free_slots()
+            {
+                while (*m_ctrl < FLAT_HASH_CTRL_SENTINEL)
+                {
+                    ++m_ctrl;
+                    ++m_slot;
+                }
+            }
+
+            const flat_hash_ctrl_type*  m_ctrl;
+            T*                          m_slot;
+        };
+
+        template<class T>
+        class flat_hash_table_iterator
+            : public flat_hash_table_const_iterator<T>
+        {
+            typedef flat_hash_table_iterator            this_type;
+            typedef flat_hash_table_const_iterator<T>   base_type;
+        public:
+            typedef T*                                  pointer;
+            typedef T&                                  reference;
+
+            AZ_FORCE_INLINE flat_hash_table_iterator() {}
+            AZ_FORCE_INLINE flat_hash_table_iterator(const flat_hash_ctrl_type* ctrl, T* slot)
+                : base_type(ctrl, slot) {}
+            AZ_FORCE_INLINE reference operator*() const { return *base_type::m_slot; }
+            AZ_FORCE_INLINE pointer operator->() const { return base_type::m_slot; }
+            AZ_FORCE_INLINE this_type& operator++()
+            {
+                base_type::operator++();
+                return *this;
+            }
+            AZ_FORCE_INLINE this_type operator++(int)
+            {
+                this_type tmp = *this;
+                base_type::operator++();
+                return tmp;
+            }
+        };
+    }
+
+    /**
+     * Open addressing hash table, the base of flat_hash_map and flat_hash_set (in the same way hash_table is the base
+     * of the unordered_xxx containers). It's a "Swiss table": the elements are stored directly in one array of slots
+     * next to an array of one byte control values, so there is a single allocation for the whole table and no
+     * allocation per element. Every control byte holds 7 bits of the element hash; a lookup loads the 16 control bytes
+     * of a group and compares them all at once (SSE2), so the keys are only compared for the (almost always single)
+     * slot with matching hash bits. Groups are probed quadratically until one with an empty slot is found.
+     * The table grows when it is 7/8 full.
+     *
+     * Differences from the hash_table:
+     * \li Inserting can move all elements (on a rehash) so it invalidates all iterators, pointers and references.
+     * Erasing only invalidates the erased element.
+     * \li The iteration order is not stable, there are no buckets or local iterators, and no multi key version.
+     * \li Elements must be move constructible.
+     *
+     * Traits are the same as for the hash_table, except for the load factor and bucket values which are not used.
+     */
+    template<class Traits>
+    class flat_hash_table
+    {
+        typedef flat_hash_table<Traits>                 this_type;
+        typedef Internal::flat_hash_ctrl_type           ctrl_type;
+        typedef Internal::flat_hash_group               group_type;
+    public:
+        typedef Traits                                  traits_type;
+
+        typedef typename Traits::key_type               key_type;
+        typedef typename Traits::key_eq                 key_eq;
+        typedef typename Traits::hasher                 hasher;
+
+        typedef typename Traits::allocator_type         allocator_type;
+        typedef typename Traits::value_type             value_type;
+        typedef typename allocator_type::size_type      size_type;
+        typedef typename allocator_type::difference_type difference_type;
+        typedef value_type*                             pointer;
+        typedef const value_type*                       const_pointer;
+        typedef value_type&                             reference;
+        typedef const value_type&                       const_reference;
+
+        typedef Internal::flat_hash_table_iterator<value_type>          iterator;
+        typedef Internal::flat_hash_table_const_iterator<value_type>    const_iterator;
+
+        typedef AZStd::pair<iterator, bool>             pair_iter_bool;
+        typedef AZStd::pair<iterator, iterator>         pair_iter_iter;
+        typedef AZStd::pair<const_iterator, const_iterator> pair_citer_citer;
+
+        AZ_FORCE_INLINE explicit flat_hash_table(const hasher& hash, const key_eq& keyEqual, const allocator_type& alloc = allocator_type())
+            : m_ctrl(nullptr)
+            , m_slots(nullptr)
+            , m_size(0)
+            , m_capacity(0)
+            , m_growthLeft(0)
+            , m_keyEqual(keyEqual)
+            , m_hasher(hash)
+            , m_allocator(alloc)
+        {}
+
+        flat_hash_table(const this_type& rhs)
+            : m_ctrl(nullptr)
+            , m_slots(nullptr)
+            , m_size(0)
+            , m_capacity(0)
+            , m_growthLeft(0)
+            , m_keyEqual(rhs.m_keyEqual)
+            , m_hasher(rhs.m_hasher)
+            , m_allocator(rhs.m_allocator)
+        {
+            copy(rhs);
+        }
+
+        flat_hash_table(this_type&& rhs)
+            : m_ctrl(nullptr)
+            , m_slots(nullptr)
+            , m_size(0)
+            , m_capacity(0)
+            , m_growthLeft(0)
+            , m_keyEqual(rhs.m_keyEqual)
+            , m_hasher(rhs.m_hasher)
+            , m_allocator(rhs.m_allocator)
+        {
+            assign_rv(AZStd::forward<this_type>(rhs));
+        }
+
+        ~flat_hash_table()
+        {
+            destroy();
+        }
+
+        this_type& operator=(const this_type& rhs)
+        {
+            if (this != &rhs)
+            {
+                clear();
+                m_keyEqual = rhs.m_keyEqual;
+                m_hasher = rhs.m_hasher;
+                copy(rhs);
+            }
+            return *this;
+        }
+
+        this_type& operator=(this_type&& rhs)
+        {
+            if (this != &rhs)
+            {
+                m_keyEqual = rhs.m_keyEqual;
+                m_hasher = rhs.m_hasher;
+                assign_rv(AZStd::forward<this_type>(rhs));
+            }
+            return *this;
+        }
+
+        AZ_FORCE_INLINE iterator            begin()
+        {
+            iterator iter(m_ctrl, m_slots);
+            if (m_size == 0)
+            {
+                return end();
+            }
+            iter.skip_free_slots();
+            return iter;
+        }
+        AZ_FORCE_INLINE const_iterator      begin() const
+        {
+            const_iterator iter(m_ctrl, m_slots);
+            if (m_size == 0)
+            {
+                return end();
+            }
+            iter.skip_free_slots();
+            return iter;
+        }
+        AZ_FORCE_INLINE iterator            end()           { return iterator(m_ctrl + m_capacity, m_slots + m_capacity); }
+        AZ_FORCE_INLINE const_iterator      end() const     { return const_iterator(m_ctrl + m_capacity, m_slots + m_capacity); }
+
+        AZ_FORCE_INLINE size_type       size() const                { return m_size; }
+        AZ_FORCE_INLINE size_type       max_size() const            { return m_allocator.get_max_size() / (sizeof(value_type) + 1); }
+        AZ_FORCE_INLINE bool            empty() const               { return m_size == 0; }
+        AZ_FORCE_INLINE key_eq          key_equal() const           { return m_keyEqual; }
+        AZ_FORCE_INLINE hasher          get_hasher() const          { return m_hasher; }
+        /// Number of slots, the table has no buckets.
+        AZ_FORCE_INLINE size_type       bucket_count() const        { return m_capacity; }
+        AZ_FORCE_INLINE size_type       capacity() const            { return m_capacity; }
+
+        AZ_FORCE_INLINE float           load_factor() const         { return m_capacity ? (float)m_size / (float)m_capacity : 0.0f; }
+        AZ_FORCE_INLINE float           max_load_factor() const     { return 7.0f / 8.0f; }
+
+        AZ_FORCE_INLINE pair_iter_bool  insert(const value_type& value)
+        {
+            return emplace_unique(Traits::key_from_value(value), value);
+        }
+        AZ_FORCE_INLINE pair_iter_bool  insert(value_type&& value)
+        {
+            const key_type& key = Traits::key_from_value(value);
+            return emplace_unique(key, AZStd::move(value));
+        }
+        AZ_FORCE_INLINE iterator        insert(const_iterator, const value_type& value)
+        {
+            // ignore hint
+            return insert(value).first;
+        }
+        AZ_FORCE_INLINE iterator        insert(const_iterator, value_type&& value)
+        {
+            return insert(AZStd::move(value)).first;
+        }
+        template<class Iterator>
+        void insert(Iterator first, Iterator last)
+        {
+            for (; first != last; ++first)
+            {
+                insert(*first);
+            }
+        }
+        AZ_FORCE_INLINE void insert(std::initializer_list<value_type> list)
+        {
+            reserve(m_size + list.size());
+            insert(list.begin(), list.end());
+        }
+
+        /// Constructs the value to get the key, the value is moved into the table if the key is not present.
+        template <typename... Args>
+        pair_iter_bool emplace(Args&&... arguments)
+        {
+            value_type value(AZStd::forward<Args>(arguments)...);
+            return insert(AZStd::move(value));
+        }
+
+        iterator erase(const_iterator erasePos)
+        {
+            AZSTD_CONTAINER_ASSERT(erasePos.m_slot >= m_slots && erasePos.m_slot < m_slots + m_capacity && *erasePos.m_ctrl >= 0, "AZStd::flat_hash_table::erase - invalid iterator!");
+            const size_type index = static_cast<size_type>(erasePos.m_slot - m_slots);
+            erase_index(index);
+            iterator next(m_ctrl + index, m_slots + index);
+            next.skip_free_slots();
+            return next;
+        }
+        size_type erase(const key_type& keyValue)
+        {
+            const size_type index = find_index(keyValue, hash_key(keyValue));
+            if (index == m_capacity)
+            {
+                return 0;
+            }
+            erase_index(index);
+            return 1;
+        }
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            if (first == begin() && last == end())
+            {
+                clear();
+                return end();
+            }
+            while (first != last)
+            {
+                first = erase(first);
+            }
+            return iterator(last.m_ctrl, last.m_slot);
+        }
+
+        /// Destroys all elements, the memory is kept (use rehash(0) to release it).
+        void clear()
+        {
+            if (m_size != 0)
+            {
+                for (size_type i = 0; i < m_capacity; ++i)
+                {
+                    if (m_ctrl[i] >= 0)
+                    {
+                        m_slots[i].~value_type();
+                    }
+                }
+                m_size = 0;
+            }
+            if (m_capacity != 0)
+            {
+                memset(m_ctrl, FLAT_HASH_EMPTY_BYTE, m_capacity);
+                m_growthLeft = max_elements(m_capacity);
+            }
+        }
+
+        AZ_FORCE_INLINE iterator        find(const key_type& keyValue)
+        {
+            const size_type index = find_index(keyValue, hash_key(keyValue));
+            return iterator(m_ctrl + index, m_slots + index);
+        }
+        AZ_FORCE_INLINE const_iterator  find(const key_type& keyValue) const
+        {
+            const size_type index = find_index(keyValue, hash_key(keyValue));
+            return const_iterator(m_ctrl + index, m_slots + index);
+        }
+        AZ_FORCE_INLINE bool            contains(const key_type& keyValue) const
+        {
+            return find_index(keyValue, hash_key(keyValue)) != m_capacity;
+        }
+        AZ_FORCE_INLINE size_type       count(const key_type& keyValue) const
+        {
+            return contains(keyValue) ? 1 : 0;
+        }
+        pair_iter_iter  equal_range(const key_type& keyValue)
+        {
+            iterator first = find(keyValue);
+            iterator last = first;
+            return pair_iter_iter(first, first == end() ? last : ++last);
+        }
+        pair_citer_citer equal_range(const key_type& keyValue) const
+        {
+            const_iterator first = find(keyValue);
+            const_iterator last = first;
+            return pair_citer_citer(first, first == end() ? last : ++last);
+        }
+
+        /// Makes sure there are at least numSlotsMin slots and enough slots for the current elements, rehash(0) shrinks the table to fit.
+        void rehash(size_type numSlotsMin)
+        {
+            size_type newCapacity = AZStd::GetMax(normalize_capacity(numSlotsMin), capacity_for(m_size));
+            if (numSlotsMin == 0 && m_size == 0)
+            {
+                newCapacity = 0;
+            }
+            if (newCapacity != m_capacity)
+            {
+                resize(newCapacity);
+            }
+        }
+        /// Makes sure numElements can be stored without growing the table.
+        void reserve(size_type numElements)
+        {
+            if (numElements > m_size + m_growthLeft)
+            {
+                resize(capacity_for(numElements));
+            }
+        }
+
+        void swap(this_type& rhs)
+        {
+            if (this == &rhs)
+            {
+                return;
+            }
+            if (m_allocator == rhs.m_allocator)
+            {
+                // Same allocator, swap the tables.
+                AZStd::swap(m_ctrl, rhs.m_ctrl);
+                AZStd::swap(m_slots, rhs.m_slots);
+                AZStd::swap(m_size, rhs.m_size);
+                AZStd::swap(m_capacity, rhs.m_capacity);
+                AZStd::swap(m_growthLeft, rhs.m_growthLeft);
+                AZStd::swap(m_keyEqual, rhs.m_keyEqual);
+                AZStd::swap(m_hasher, rhs.m_hasher);
+            }
+            else
+            {
+                // Different allocators, move elements
+                this_type temp(m_hasher, m_keyEqual, m_allocator);
+                temp = AZStd::move(*this);
+                *this = AZStd::move(rhs);
+                rhs = AZStd::move(temp);
+            }
+        }
+
+        /**
+        * \anchor FlatHashExtensions
+        * \name Extensions
+        * @{
+        */
+        // The only difference from the standard is that we return the allocator instance, not a copy.
+        AZ_FORCE_INLINE allocator_type&         get_allocator()         { return m_allocator; }
+        AZ_FORCE_INLINE const allocator_type&   get_allocator() const   { return m_allocator; }
+        /// Set the table allocator. If different than the current the elements are moved to memory from the new allocator.
+        void set_allocator(const allocator_type& allocator)
+        {
+            if (m_allocator != allocator)
+            {
+                allocator_type oldAllocator = m_allocator;
+                m_allocator = allocator;
+                reallocate(m_capacity, oldAllocator);
+            }
+        }
+
+        /// Search with a type comparable to the key, see hash_table::find_as. The hash must be the same as the key hash.
+        template<class ComparableToKey, class Hasher, class KeyEqual>
+        iterator        find_as(const ComparableToKey& keyCmp, const Hasher& hash, const KeyEqual& keyEq)
+        {
+            const size_type index = find_index(keyCmp, mix_hash(hash(keyCmp)), keyEq);
+            return iterator(m_ctrl + index, m_slots + index);
+        }
+        template<class ComparableToKey, class Hasher, class KeyEqual>
+        const_iterator  find_as(const ComparableToKey& keyCmp, const Hasher& hash, const KeyEqual& keyEq) const
+        {
+            const size_type index = find_index(keyCmp, mix_hash(hash(keyCmp)), keyEq);
+            return const_iterator(m_ctrl + index, m_slots + index);
+        }
+
+        /// Checks the control bytes and that all elements can be found.
+        bool validate() const
+        {
+            size_type numElements = 0;
+            size_type numEmpty = 0;
+            for (size_type i = 0; i < m_capacity; ++i)
+            {
+                if (m_ctrl[i] >= 0)
+                {
+                    ++numElements;
+                    const key_type& key = Traits::key_from_value(m_slots[i]);
+                    const size_t hash = hash_key(key);
+                    if (m_ctrl[i] != h2(hash) || find_index(key, hash) != i)
+                    {
+                        return false;
+                    }
+                }
+                else if (m_ctrl[i] == Internal::FLAT_HASH_CTRL_EMPTY)
+                {
+                    ++numEmpty;
+                }
+            }
+            return numElements == m_size && (m_capacity == 0 || m_ctrl[m_capacity] == Internal::FLAT_HASH_CTRL_SENTINEL) && m_growthLeft <= numEmpty;
+        }
+        /// @}
+
+    protected:
+        enum
+        {
+            FLAT_HASH_EMPTY_BYTE = 0x80,
+            MIN_CAPACITY = group_type::width,
+        };
+
+        /// Inserts a value constructed from the arguments if the key is not in the table.
+        template<class... Args>
+        pair_iter_bool emplace_unique(const key_type& key, Args&&... arguments)
+        {
+            const size_t hash = hash_key(key);
+            size_type index = find_index(key, hash);
+            if (index != m_capacity)
+            {
+                return pair_iter_bool(iterator(m_ctrl + index, m_slots + index), false);
+            }
+            index = prepare_insert(hash);
+            new(&m_slots[index]) value_type(AZStd::forward<Args>(arguments)...);
+            return pair_iter_bool(iterator(m_ctrl + index, m_slots + index), true);
+        }
+
+        /// Returns the index of the key or m_capacity if it's not in the table.
+        AZ_FORCE_INLINE size_type find_index(const key_type& key, size_t hash) const
+        {
+            return find_index(key, hash, m_keyEqual);
+        }
+        template<class ComparableToKey, class KeyEqual>
+        size_type find_index(const ComparableToKey& key, size_t hash, const KeyEqual& keyEq) const
+        {
+            if (m_capacity == 0)
+            {
+                return 0;
+            }
+            const size_type groupMask = m_capacity / group_type::width - 1;
+            const ctrl_type hashBits = h2(hash);
+            size_type groupIndex = h1(hash) & groupMask;
+            for (size_type step = 1;; ++step)
+            {
+                const size_type groupStart = groupIndex * group_type::width;
+                const group_type group(m_ctrl + groupStart);
+                for (unsigned int mask = group.match(hashBits); mask != 0; mask &= mask - 1)
+                {
+                    const size_type index = groupStart + Internal::flat_hash_trailing_zeros(mask);
+                    if (keyEq(key, Traits::key_from_value(m_slots[index])))
+                    {
+                        return index;
+                    }
+                }
+                if (group.match_empty() != 0)
+                {
+                    return m_capacity;
+                }
+                // triangular probing visits every group once when the number of groups is a power of 2
+                groupIndex = (groupIndex + step) & groupMask;
+            }
+        }
+
+        /// Returns the first empty or deleted slot for the hash, the table must not be full.
+        size_type find_free_index(size_t hash) const
+        {
+            const size_type groupMask = m_capacity / group_type::width - 1;
+            size_type groupIndex = h1(hash) & groupMask;
+            for (size_type step = 1;; ++step)
+            {
+                const size_type groupStart = groupIndex * group_type::width;
+                const unsigned int mask = group_type(m_ctrl + groupStart).match_empty_or_deleted();
+                if (mask != 0)
+                {
+                    return groupStart + Internal::flat_hash_trailing_zeros(mask);
+                }
+                groupIndex = (groupIndex + step) & groupMask;
+            }
+        }
+
+        /// Takes a free slot for the hash (growing the table if needed), the caller constructs the element in it.
+        size_type prepare_insert(size_t hash)
+        {
+            size_type index = m_capacity != 0 ? find_free_index(hash) : 0;
+            // reusing a deleted slot doesn't use up an empty one, so it doesn't need to grow the table
+            if (m_growthLeft == 0 && (m_capacity == 0 || m_ctrl[index] != Internal::FLAT_HASH_CTRL_DELETED))
+            {
+                grow();
+                index = find_free_index(hash);
+            }
+            if (m_ctrl[index] == Internal::FLAT_HASH_CTRL_EMPTY)
+            {
+                --m_growthLeft;
+            }
+            m_ctrl[index] = h2(hash);
+            ++m_size;
+            return index;
+        }
+
+        /// Inserts an element that is known not to be in the table.
+        void insert_unique_no_check(value_type&& value)
+        {
+            const size_type index = prepare_insert(hash_key(Traits::key_from_value(value)));
+            new(&m_slots[index]) value_type(AZStd::move(value));
+        }
+
+        void erase_index(size_type index)
+        {
+            m_slots[index].~value_type();
+            --m_size;
+            // If the group still has an empty slot no probe sequence went past it, so the slot can become empty again.
+            // Otherwise lookups for other keys may have to continue past it, and it's marked as deleted.
+            const size_type groupStart = index & ~static_cast<size_type>(group_type::width - 1);
+            if (group_type(m_ctrl + groupStart).match_empty() != 0)
+            {
+                m_ctrl[index] = Internal::FLAT_HASH_CTRL_EMPTY;
+                ++m_growthLeft;
+            }
+            else
+            {
+                m_ctrl[index] = Internal::FLAT_HASH_CTRL_DELETED;
+            }
+        }
+
+        void grow()
+        {
+            if (m_capacity == 0)
+            {
+                resize(MIN_CAPACITY);
+            }
+            else if (m_size <= max_elements(m_capacity) / 2)
+            {
+                // mostly deleted slots, rehash in place to drop them
+                resize(m_capacity);
+            }
+            else
+            {
+                resize(m_capacity * 2);
+            }
+        }
+
+        void resize(size_type newCapacity)
+        {
+            reallocate(newCapacity, m_allocator);
+        }
+
+        /// Moves the elements to new storage from m_allocator, the old storage is released to oldAllocator.
+        void reallocate(size_type newCapacity, allocator_type& oldAllocator)
+        {
+            ctrl_type* oldCtrl = m_ctrl;
+            value_type* oldSlots = m_slots;
+            const size_type oldCapacity = m_capacity;
+
+            allocate_storage(newCapacity);
+            m_size = 0;
+            for (size_type i = 0; i < oldCapacity; ++i)
+            {
+                if (oldCtrl[i] >= 0)
+                {
+                    insert_unique_no_check(AZStd::move(oldSlots[i]));
+                    oldSlots[i].~value_type();
+                }
+            }
+            if (oldCapacity != 0)
+            {
+                oldAllocator.deallocate(oldCtrl, storage_size(oldCapacity), storage_alignment());
+            }
+        }
+
+        void allocate_storage(size_type capacity)
+        {
+            m_capacity = capacity;
+            if (capacity == 0)
+            {
+                m_ctrl = nullptr;
+                m_slots = nullptr;
+                m_growthLeft = 0;
+                return;
+            }
+            m_ctrl = reinterpret_cast<ctrl_type*>(m_allocator.allocate(storage_size(capacity), storage_alignment()));
+            m_slots = reinterpret_cast<value_type*>(reinterpret_cast<char*>(m_ctrl) + ctrl_size(capacity));
+            memset(m_ctrl, FLAT_HASH_EMPTY_BYTE, capacity);
+            m_ctrl[capacity] = Internal::FLAT_HASH_CTRL_SENTINEL;
+            m_growthLeft = max_elements(capacity);
+        }
+
+        void destroy()
+        {
+            clear();
+            if (m_capacity != 0)
+            {
+                m_allocator.deallocate(m_ctrl, storage_size(m_capacity), storage_alignment());
+            }
+            reset_storage();
+        }
+
+        void reset_storage()
+        {
+            m_ctrl = nullptr;
+            m_slots = nullptr;
+            m_size = 0;
+            m_capacity = 0;
+            m_growthLeft = 0;
+        }
+
+        void assign_rv(this_type&& rhs)
+        {
+            if (m_allocator == rhs.m_allocator)
+            {
+                destroy();
+                m_ctrl = rhs.m_ctrl;
+                m_slots = rhs.m_slots;
+                m_size = rhs.m_size;
+                m_capacity = rhs.m_capacity;
+                m_growthLeft = rhs.m_growthLeft;
+                rhs.reset_storage();
+            }
+            else
+            {
+                // we keep our allocator, move the elements one by one
+                clear();
+                reserve(rhs.m_size);
+                for (size_type i = 0; i < rhs.m_capacity; ++i)
+                {
+                    if (rhs.m_ctrl[i] >= 0)
+                    {
+                        insert_unique_no_check(AZStd::move(rhs.m_slots[i]));
+                    }
+                }
+                rhs.clear();
+            }
+        }
+
+        void copy(const this_type& rhs)
+        {
+            reserve(rhs.m_size);
+            for (size_type i = 0; i < rhs.m_capacity; ++i)
+            {
+                if (rhs.m_ctrl[i] >= 0)
+                {
+                    const size_type index = prepare_insert(hash_key(Traits::key_from_value(rhs.m_slots[i])));
+                    new(&m_slots[index]) value_type(rhs.m_slots[i]);
+                }
+            }
+        }
+
+        /// The AZStd hashes of integers and pointers are the values, spread the bits so both parts of the hash are usable.
+        static AZ_FORCE_INLINE size_t mix_hash(size_t hash)
+        {
+            const size_t multiplier = sizeof(size_t) == 8 ? static_cast<size_t>(0x9E3779B97F4A7C15ull) : static_cast<size_t>(0x9E3779B9u);
+            hash *= multiplier;
+            return hash ^ (hash >> (sizeof(size_t) * 4));
+        }
+        AZ_FORCE_INLINE size_t hash_key(const key_type& key) const  { return mix_hash(m_hasher(key)); }
+        /// Selects the first group to probe.
+        static AZ_FORCE_INLINE size_t h1(size_t hash)               { return hash >> 7; }
+        /// Stored in the control byte.
+        static AZ_FORCE_INLINE ctrl_type h2(size_t hash)            { return static_cast<ctrl_type>(hash & 0x7f); }
+
+        /// Number of elements the capacity can hold before growing (7/8 of the slots).
+        static AZ_FORCE_INLINE size_type max_elements(size_type capacity)   { return capacity - capacity / 8; }
+        static size_type normalize_capacity(size_type numSlots)
+        {
+            size_type capacity = MIN_CAPACITY;
+            while (capacity < numSlots)
+            {
+                capacity <<= 1;
+            }
+            return capacity;
+        }
+        static size_type capacity_for(size_type numElements)
+        {
+            size_type capacity = MIN_CAPACITY;
+            while (max_elements(capacity) < numElements)
+            {
+                capacity <<= 1;
+            }
+            return capacity;
+        }
+        /// Control bytes and the sentinel, padded to the slot alignment.
+        static AZ_FORCE_INLINE size_type ctrl_size(size_type capacity)
+        {
+            const size_type alignment = alignment_of<value_type>::value;
+            return (capacity + 1 + alignment - 1) & ~(alignment - 1);
+        }
+        static AZ_FORCE_INLINE size_type storage_size(size_type capacity)   { return ctrl_size(capacity) + capacity * sizeof(value_type); }
+        static AZ_FORCE_INLINE size_type storage_alignment()                { return AZStd::GetMax<size_type>(alignment_of<value_type>::value, group_type::width); }
+
+        ctrl_type*          m_ctrl;         ///< m_capacity control bytes and the sentinel, in the same allocation as the slots.
+        value_type*         m_slots;
+        size_type           m_size;
+        size_type           m_capacity;     ///< Number of slots, 0 or a power of 2 (minimum one group).
+        size_type           m_growthLeft;   ///< Number of empty slots we can fill before growing.
+        key_eq              m_keyEqual;
+        hasher              m_hasher;
+        allocator_type      m_allocator;
+    };
+}
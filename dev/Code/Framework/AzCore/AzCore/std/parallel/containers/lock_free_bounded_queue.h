@@ -0,0 +1,245 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/utils.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/exponential_backoff.h>
+#include <AzCore/std/typetraits/aligned_storage.h>
+#include <AzCore/std/typetraits/alignment_of.h>
+
+namespace AZStd
+{
+    /**
+     * A bounded, lock-free, multi-producer multi-consumer queue (D. Vyukov's array based queue).
+     * All elements live in a ring allocated once on construction, so unlike lock_free_queue it has no requirements on
+     * the allocator and doesn't allocate on push. Every cell has a sequence number telling producers and consumers
+     * whether it's free or full for the current lap, so a push or pop costs a single CAS on the (cache line padded)
+     * enqueue or dequeue position. push_batch and pop_batch claim several consecutive cells with that one CAS.
+     * push fails when the queue is full, pop when it is empty, neither blocks.
+     */
+    template<typename T, typename Allocator = AZStd::allocator>
+    class lock_free_bounded_queue
+    {
+        enum
+        {
+            CACHE_LINE_SIZE = 64
+        };
+
+        struct cell
+        {
+            atomic<AZStd::size_t> m_sequence;
+            typename aligned_storage<sizeof(T), alignment_of<T>::value>::type m_storage;
+
+            T* value() { return reinterpret_cast<T*>(&m_storage); }
+        };
+
+    public:
+        typedef T*                                  pointer;
+        typedef const T*                            const_pointer;
+        typedef T&                                  reference;
+        typedef const T&                            const_reference;
+        typedef typename Allocator::difference_type difference_type;
+        typedef typename Allocator::size_type       size_type;
+        typedef Allocator                           allocator_type;
+        typedef T                                   value_type;
+
+        ///Capacity is rounded up to a power of two (at least 2).
+        explicit lock_free_bounded_queue(size_type capacity, const allocator_type& allocator = allocator_type());
+
+        ~lock_free_bounded_queue();
+
+        ///Pushes a value onto the back of the queue. Returns false if the queue is full.
+        bool push(const_reference value)                    { return emplace(value); }
+        bool push(T&& value)                                { return emplace(AZStd::move(value)); }
+        template<class ... Args>
+        bool emplace(Args&& ... args);
+
+        ///Attempts to pop a value from the front of the queue. Returns false if the queue was empty, otherwise popped
+        ///value is stored in value_out and returns true.
+        bool pop(pointer value_out);
+
+        ///Pushes up to count values (as many as there is room for), in order. Returns the number of values pushed.
+        size_type push_batch(const_pointer values, size_type count);
+        ///Pops up to max_count values into values_out. Returns the number of values popped.
+        size_type pop_batch(pointer values_out, size_type max_count);
+
+        ///Tests if the queue is empty, limited utility for a concurrent container.
+        bool empty() const                                  { return size() == 0; }
+        ///Number of elements in the queue, limited utility for a concurrent container.
+        size_type size() const;
+        size_type capacity() const                          { return m_mask + 1; }
+
+    private:
+        //non-copyable
+        lock_free_bounded_queue(const lock_free_bounded_queue&);
+        lock_free_bounded_queue& operator=(const lock_free_bounded_queue&);
+
+        ///Claims up to max_count consecutive cells at the position, returns the number of cells claimed.
+        size_type claim(atomic<AZStd::size_t>& position, size_type sequence_offset, size_type max_count, AZStd::size_t& first);
+
+        cell* m_cells;
+        size_type m_mask;
+        allocator_type m_allocator;
+
+        AZ_ALIGN(atomic<AZStd::size_t> m_enqueue_pos, CACHE_LINE_SIZE);
+        AZ_ALIGN(atomic<AZStd::size_t> m_dequeue_pos, CACHE_LINE_SIZE);
+    };
+
+    //============================================================================================================
+    //============================================================================================================
+    //============================================================================================================
+
+    template<typename T, typename Allocator>
+    inline lock_free_bounded_queue<T, Allocator>::lock_free_bounded_queue(size_type capacity, const allocator_type& allocator)
+        : m_allocator(allocator)
+    {
+        size_type roundedCapacity = 2;
+        while (roundedCapacity < capacity)
+        {
+            roundedCapacity <<= 1;
+        }
+        m_mask = roundedCapacity - 1;
+
+        m_cells = reinterpret_cast<cell*>(m_allocator.allocate(sizeof(cell) * roundedCapacity, alignment_of<cell>::value));
+        for (size_type i = 0; i < roundedCapacity; ++i)
+        {
+            new(&m_cells[i].m_sequence) atomic<AZStd::size_t>(i);
+        }
+        m_enqueue_pos.store(0, memory_order_relaxed);
+        m_dequeue_pos.store(0, memory_order_release);
+    }
+
+    template<typename T, typename Allocator>
+    inline lock_free_bounded_queue<T, Allocator>::~lock_free_bounded_queue()
+    {
+        const AZStd::size_t end = m_enqueue_pos.load(memory_order_acquire);
+        for (AZStd::size_t pos = m_dequeue_pos.load(memory_order_acquire); pos != end; ++pos)
+        {
+            m_cells[pos & m_mask].value()->~T();
+        }
+        m_allocator.deallocate(m_cells, sizeof(cell) * (m_mask + 1), alignment_of<cell>::value);
+    }
+
+    template<typename T, typename Allocator>
+    inline typename lock_free_bounded_queue<T, Allocator>::size_type
+    lock_free_bounded_queue<T, Allocator>::claim(atomic<AZStd::size_t>& position, size_type sequence_offset, size_type max_count, AZStd::size_t& first)
+    {
+        exponential_backoff backoff;
+        AZStd::size_t pos = position.load(memory_order_relaxed);
+        while (true)
+        {
+            // count the cells that are ready for this lap (free for a producer, full for a consumer)
+            size_type count = 0;
+            bool isStale = false;
+            for (; count < max_count; ++count)
+            {
+                const AZStd::size_t sequence = m_cells[(pos + count) & m_mask].m_sequence.load(memory_order_acquire);
+                const difference_type diff = static_cast<difference_type>(sequence - (pos + count + sequence_offset));
+                if (diff != 0)
+                {
+                    // a cell from a later lap means other threads moved the position past pos
+                    isStale = diff > 0;
+                    break;
+                }
+            }
+
+            if (count == 0 && !isStale)
+            {
+                return 0; // full (producer) or empty (consumer)
+            }
+            if (count != 0 && position.compare_exchange_weak(pos, pos + count, memory_order_relaxed, memory_order_relaxed))
+            {
+                first = pos;
+                return count;
+            }
+            if (count == 0)
+            {
+                pos = position.load(memory_order_relaxed);
+            }
+            backoff.wait();
+        }
+    }
+
+    template<typename T, typename Allocator>
+    template<class ... Args>
+    inline bool lock_free_bounded_queue<T, Allocator>::emplace(Args&& ... args)
+    {
+        AZStd::size_t pos;
+        if (claim(m_enqueue_pos, 0, 1, pos) == 0)
+        {
+            return false;
+        }
+        cell& c = m_cells[pos & m_mask];
+        new(c.value()) T(AZStd::forward<Args>(args) ...);
+        c.m_sequence.store(pos + 1, memory_order_release);
+        return true;
+    }
+
+    template<typename T, typename Allocator>
+    inline bool lock_free_bounded_queue<T, Allocator>::pop(T* value_out)
+    {
+        AZStd::size_t pos;
+        if (claim(m_dequeue_pos, 1, 1, pos) == 0)
+        {
+            return false;
+        }
+        cell& c = m_cells[pos & m_mask];
+        *value_out = AZStd::move(*c.value());
+        c.value()->~T();
+        c.m_sequence.store(pos + m_mask + 1, memory_order_release);
+        return true;
+    }
+
+    template<typename T, typename Allocator>
+    inline typename lock_free_bounded_queue<T, Allocator>::size_type
+    lock_free_bounded_queue<T, Allocator>::push_batch(const T* values, size_type count)
+    {
+        AZStd::size_t first;
+        const size_type claimed = count != 0 ? claim(m_enqueue_pos, 0, count, first) : 0;
+        for (size_type i = 0; i < claimed; ++i)
+        {
+            cell& c = m_cells[(first + i) & m_mask];
+            new(c.value()) T(values[i]);
+            c.m_sequence.store(first + i + 1, memory_order_release);
+        }
+        return claimed;
+    }
+
+    template<typename T, typename Allocator>
+    inline typename lock_free_bounded_queue<T, Allocator>::size_type
+    lock_free_bounded_queue<T, Allocator>::pop_batch(T* values_out, size_type max_count)
+    {
+        AZStd::size_t first;
+        const size_type claimed = max_count != 0 ? claim(m_dequeue_pos, 1, max_count, first) : 0;
+        for (size_type i = 0; i < claimed; ++i)
+        {
+            cell& c = m_cells[(first + i) & m_mask];
+            values_out[i] = AZStd::move(*c.value());
+            c.value()->~T();
+            c.m_sequence.store(first + i + m_mask + 1, memory_order_release);
+        }
+        return claimed;
+    }
+
+    template<typename T, typename Allocator>
+    inline typename lock_free_bounded_queue<T, Allocator>::size_type lock_free_bounded_queue<T, Allocator>::size() const
+    {
+        const AZStd::size_t dequeuePos = m_dequeue_pos.load(memory_order_acquire);
+        const AZStd::size_t enqueuePos = m_enqueue_pos.load(memory_order_acquire);
+        // claimed cells count as pushed, the positions are read separately so clamp the result
+        const difference_type diff = static_cast<difference_type>(enqueuePos - dequeuePos);
+        return diff > 0 ? AZStd::GetMin(static_cast<size_type>(diff), m_mask + 1) : 0;
+    }
+}
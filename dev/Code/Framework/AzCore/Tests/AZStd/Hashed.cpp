@@ -16,6 +16,9 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/fixed_unordered_set.h>
 #include <AzCore/std/containers/fixed_unordered_map.h>
+#include <AzCore/std/containers/flat_hash_map.h>
+#include <AzCore/std/containers/flat_hash_set.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -1107,6 +1110,210 @@ namespace UnitTest
 
         EXPECT_EQ(idx, map.size());
     }
+
+    TEST_F(HashedContainers, FlatHashMapBasic)
+    {
+        typedef flat_hash_map<int, int> int_int_map_type;
+
+        int_int_map_type intint_map;
+        ValidateHash(intint_map);
+        EXPECT_EQ(0, intint_map.capacity());
+        EXPECT_TRUE(intint_map.find(10) == intint_map.end());
+        EXPECT_EQ(0, intint_map.erase(10));
+
+        int_int_map_type intint_map1(100);
+        ValidateHash(intint_map1);
+        EXPECT_GE(intint_map1.capacity(), 100);
+        const size_t reservedCapacity = intint_map1.capacity();
+        for (int i = 0; i < 100; ++i)
+        {
+            intint_map1[i] = i;
+        }
+        ValidateHash(intint_map1, 100);
+        EXPECT_EQ(reservedCapacity, intint_map1.capacity());
+
+        // insert with default value.
+        intint_map.insert_key(16);
+        ValidateHash(intint_map, 1);
+        EXPECT_EQ(16, intint_map.begin()->first);
+        EXPECT_EQ(0, intint_map.begin()->second);
+
+        EXPECT_TRUE(intint_map.insert(AZStd::make_pair(22, 11)).second);
+        EXPECT_FALSE(intint_map.insert(AZStd::make_pair(22, 12)).second);
+        ValidateHash(intint_map, 2);
+
+        // map look up
+        EXPECT_EQ(11, intint_map[22]);
+        intint_map[33] = 100;   // insert a new element
+        EXPECT_EQ(100, intint_map.at(33));
+        ValidateHash(intint_map, 3);
+
+        EXPECT_FALSE(intint_map.try_emplace(33, 5).second);
+        EXPECT_EQ(100, intint_map[33]);
+        EXPECT_TRUE(intint_map.insert_or_assign(33, 5).second == false);
+        EXPECT_EQ(5, intint_map[33]);
+        EXPECT_TRUE(intint_map.emplace(44, 4).second);
+        EXPECT_EQ(1, intint_map.count(44));
+        EXPECT_EQ(0, intint_map.count(45));
+        ValidateHash(intint_map, 4);
+
+        // grow through several rehashes
+        for (int i = 0; i < 10000; ++i)
+        {
+            intint_map[i * 7 + 1000] = i;
+        }
+        ValidateHash(intint_map, 10004);
+        EXPECT_LE(intint_map.load_factor(), intint_map.max_load_factor());
+        for (int i = 0; i < 10000; ++i)
+        {
+            int_int_map_type::iterator iter = intint_map.find(i * 7 + 1000);
+            ASSERT_TRUE(iter != intint_map.end());
+            EXPECT_EQ(i, iter->second);
+        }
+
+        // erase every other element while iterating
+        for (int_int_map_type::iterator iter = intint_map.begin(); iter != intint_map.end(); )
+        {
+            iter = (iter->first & 1) ? intint_map.erase(iter) : AZStd::next(iter);
+        }
+        ValidateHash(intint_map, 5003);
+        for (const int_int_map_type::value_type& element : intint_map)
+        {
+            EXPECT_EQ(0, element.first & 1);
+        }
+
+        int_int_map_type copy(intint_map);
+        EXPECT_EQ(intint_map, copy);
+        copy[1] = 1;
+        EXPECT_NE(intint_map, copy);
+
+        int_int_map_type moved(AZStd::move(copy));
+        ValidateHash(copy);
+        ValidateHash(moved, 5004);
+
+        intint_map.swap(moved);
+        ValidateHash(intint_map, 5004);
+        ValidateHash(moved, 5003);
+
+        intint_map.clear();
+        ValidateHash(intint_map);
+        EXPECT_GT(intint_map.capacity(), 0);
+        intint_map.rehash(0);
+        EXPECT_EQ(0, intint_map.capacity());
+    }
+
+    TEST_F(HashedContainers, FlatHashMapNonTrivialValue)
+    {
+        typedef flat_hash_map<AZStd::string, AZStd::string> string_map_type;
+        string_map_type stringMap = {
+            { "Player", "Base" },
+            { "Damageable", "Component" }
+        };
+        ValidateHash(stringMap, 2);
+        EXPECT_EQ("Base", stringMap.at("Player"));
+
+        // many inserts and erases of the same keys, the deleted slots must be reused or dropped on rehash
+        for (int i = 0; i < 1000; ++i)
+        {
+            AZStd::string key = AZStd::string::format("Key%d", i % 50);
+            stringMap[key] = key;
+            if (i % 3 == 0)
+            {
+                stringMap.erase(key);
+            }
+        }
+        for (int i = 0; i < 50; ++i)
+        {
+            AZStd::string key = AZStd::string::format("Key%d", i);
+            string_map_type::const_iterator iter = stringMap.find(key);
+            if (iter != stringMap.end())
+            {
+                EXPECT_EQ(key, iter->second);
+            }
+        }
+        EXPECT_TRUE(stringMap.validate());
+        EXPECT_LE(stringMap.capacity(), 128);
+
+        flat_hash_map<int, MoveOnlyType> moveOnlyMap;
+        moveOnlyMap.try_emplace(1, "One");
+        moveOnlyMap.emplace(2, MoveOnlyType("Two"));
+        moveOnlyMap.reserve(100);
+        ValidateHash(moveOnlyMap, 2);
+        EXPECT_EQ("One", moveOnlyMap[1].m_name);
+        EXPECT_EQ("Two", moveOnlyMap[2].m_name);
+    }
+
+    TEST_F(HashedContainers, FlatHashMapAllocator)
+    {
+        typedef flat_hash_map<int, AZStd::string, AZStd::hash<int>, AZStd::equal_to<int>, AZStd::static_buffer_allocator<32 * 1024, 16> > static_buffer_map_type;
+        static_buffer_map_type intstring_map;
+        for (int i = 0; i < 100; ++i)
+        {
+            intstring_map.emplace(i, "Value");
+        }
+        ValidateHash(intstring_map, 100);
+        // elements are stored in the table, no allocation per element
+        EXPECT_GE(intstring_map.get_allocator().get_allocated_size(), intstring_map.capacity() * sizeof(static_buffer_map_type::value_type));
+
+        static_buffer_map_type::allocator_type otherAllocator("Other");
+        intstring_map.set_allocator(otherAllocator);
+        EXPECT_STREQ("Other", intstring_map.get_allocator().get_name());
+        ValidateHash(intstring_map, 100);
+        EXPECT_EQ("Value", intstring_map[99]);
+
+        static_buffer_map_type intstring_map2;
+        intstring_map2[1000] = "Other";
+        intstring_map.swap(intstring_map2);
+        ValidateHash(intstring_map, 1);
+        ValidateHash(intstring_map2, 100);
+        EXPECT_EQ("Other", intstring_map[1000]);
+    }
+
+    TEST_F(HashedContainers, FlatHashSetBasic)
+    {
+        flat_hash_set<AZStd::string> aset1 = { "PlayerBase", "DamageableBase", "PlacementObstructionBase", "PredatorBase" };
+        flat_hash_set<AZStd::string> aset2;
+        aset2.insert("PredatorBase");
+        aset2.insert("PlayerBase");
+        aset2.insert("PlacementObstructionBase");
+        aset2.insert("DamageableBase");
+        EXPECT_FALSE(aset2.insert("DamageableBase").second);
+        ValidateHash(aset2, 4);
+        EXPECT_EQ(aset1, aset2);
+
+        EXPECT_EQ(1, aset1.erase("PlayerBase"));
+        EXPECT_EQ(0, aset1.erase("PlayerBase"));
+        EXPECT_FALSE(aset1.contains("PlayerBase"));
+        EXPECT_NE(aset1, aset2);
+        ValidateHash(aset1, 3);
+
+        flat_hash_set<int> intset;
+        for (int i = 0; i < 1000; ++i)
+        {
+            intset.insert(i);
+        }
+        ValidateHash(intset, 1000);
+        intset.erase(intset.find(500), intset.end());
+        for (int i = 0; i < 1000; ++i)
+        {
+            intset.erase(i);
+        }
+        ValidateHash(intset);
+
+        AZStd::flat_hash_set<MoveOnlyType, MoveOnlyTypeHasher> ownedStringSet;
+        AZStd::string nonOwnedString1("Test String");
+        ownedStringSet.emplace(nonOwnedString1);
+
+        auto keyEqual = [](const AZStd::string& testString, const MoveOnlyType& key)
+        {
+            return testString == key.m_name;
+        };
+        auto entityIt = ownedStringSet.find_as(nonOwnedString1, AZStd::hash<AZStd::string>(), keyEqual);
+        EXPECT_NE(ownedStringSet.end(), entityIt);
+        EXPECT_EQ(nonOwnedString1, entityIt->m_name);
+        entityIt = ownedStringSet.find_as(AZStd::string("Hashed Value"), AZStd::hash<AZStd::string>(), keyEqual);
+        EXPECT_EQ(ownedStringSet.end(), entityIt);
+    }
             
 #if defined(HAVE_BENCHMARK)
     template <template <typename...> class Hash>
@@ -1201,6 +1408,102 @@ namespace UnitTest
         Benchmark_Thrash<AZStd::unordered_map>(state);
     }
     BENCHMARK(Benchmark_UnorderedMapThrash);
+
+    void Benchmark_FlatHashMapLookup(benchmark::State& state)
+    {
+        Benchmark_Lookup<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapLookup);
+
+    void Benchmark_FlatHashMapInsert(benchmark::State& state)
+    {
+        Benchmark_Insert<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapInsert);
+
+    void Benchmark_FlatHashMapErase(benchmark::State& state)
+    {
+        Benchmark_Erase<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapErase);
+
+    void Benchmark_FlatHashMapThrash(benchmark::State& state)
+    {
+        Benchmark_Thrash<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapThrash);
+
+    // Lookups with 64 bit ids (like entity and asset ids) at the map sizes we usually have, from components of an entity
+    // to all assets/replicas of a level. Half of the lookups miss.
+    template <template <typename...> class Hash>
+    void Benchmark_LookupSized(benchmark::State& state)
+    {
+        const size_t count = static_cast<size_t>(state.range(0));
+        Hash<AZ::u64, int, AZStd::hash<AZ::u64>, AZStd::equal_to<AZ::u64>, AZStd::allocator> map;
+        AZStd::vector<AZ::u64> keys;
+        for (size_t i = 0; i < count * 2; ++i)
+        {
+            keys.push_back((i + 1) * 0x9E3779B97F4A7C15ull);
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            map.emplace(keys[i * 2], static_cast<int>(i));
+        }
+        size_t found = 0;
+        size_t index = 0;
+        while (state.KeepRunning())
+        {
+            found += map.count(keys[index]);
+            // step by a prime so consecutive lookups are not in insertion order
+            index = (index + 7919) % keys.size();
+        }
+        benchmark::DoNotOptimize(found);
+    }
+
+    // Building a map of the size, then iterating all elements.
+    template <template <typename...> class Hash>
+    void Benchmark_BuildAndIterateSized(benchmark::State& state)
+    {
+        const AZ::u64 count = static_cast<AZ::u64>(state.range(0));
+        while (state.KeepRunning())
+        {
+            Hash<AZ::u64, int, AZStd::hash<AZ::u64>, AZStd::equal_to<AZ::u64>, AZStd::allocator> map;
+            for (AZ::u64 i = 0; i < count; ++i)
+            {
+                map[(i + 1) * 0x9E3779B97F4A7C15ull] = static_cast<int>(i);
+            }
+            int sum = 0;
+            for (const auto& element : map)
+            {
+                sum += element.second;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+
+    void Benchmark_UnorderedMapLookupSized(benchmark::State& state)
+    {
+        Benchmark_LookupSized<AZStd::unordered_map>(state);
+    }
+    BENCHMARK(Benchmark_UnorderedMapLookupSized)->RangeMultiplier(8)->Range(8, 32 * 1024);
+
+    void Benchmark_FlatHashMapLookupSized(benchmark::State& state)
+    {
+        Benchmark_LookupSized<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapLookupSized)->RangeMultiplier(8)->Range(8, 32 * 1024);
+
+    void Benchmark_UnorderedMapBuildAndIterateSized(benchmark::State& state)
+    {
+        Benchmark_BuildAndIterateSized<AZStd::unordered_map>(state);
+    }
+    BENCHMARK(Benchmark_UnorderedMapBuildAndIterateSized)->RangeMultiplier(8)->Range(8, 32 * 1024);
+
+    void Benchmark_FlatHashMapBuildAndIterateSized(benchmark::State& state)
+    {
+        Benchmark_BuildAndIterateSized<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapBuildAndIterateSized)->RangeMultiplier(8)->Range(8, 32 * 1024);
 #endif
 } // namespace UnitTest
 
@@ -13,11 +13,17 @@
 #include "UserTypes.h"
 
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/parallel/containers/concurrent_vector.h>
+#include <AzCore/std/parallel/containers/lock_free_bounded_queue.h>
 #include <AzCore/std/parallel/containers/lock_free_queue.h>
 #include <AzCore/std/parallel/containers/lock_free_stamped_queue.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
 using namespace AZStd;
 using namespace UnitTestInternal;
 
@@ -45,6 +51,22 @@ namespace UnitTest
             }
         }
 
+        template <class Q>
+        void PushBounded(Q* queue)
+        {
+            for (int i = 0; i < NUM_ITERATIONS; )
+            {
+                if (queue->push(i))
+                {
+                    ++i;
+                }
+                else
+                {
+                    AZStd::this_thread::yield(); // full
+                }
+            }
+        }
+
         template <class Q>
         void Pop(Q* queue)
         {
@@ -228,4 +250,329 @@ namespace UnitTest
             AZ_TEST_ASSERT(queue.empty());
         }
     }
+
+    TEST_F(LockFreeQueue, LockFreeBoundedQueue)
+    {
+        lock_free_bounded_queue<int> queue(3);
+        EXPECT_EQ(4, queue.capacity());
+
+        int result;
+        AZ_TEST_ASSERT(queue.empty());
+        AZ_TEST_ASSERT(!queue.pop(&result));
+
+        queue.push(20);
+        AZ_TEST_ASSERT(!queue.empty());
+        AZ_TEST_ASSERT(queue.pop(&result));
+        AZ_TEST_ASSERT(result == 20);
+        AZ_TEST_ASSERT(queue.empty());
+        AZ_TEST_ASSERT(!queue.pop(&result));
+
+        // fill it, wrapping around the ring
+        for (int i = 0; i < 4; ++i)
+        {
+            AZ_TEST_ASSERT(queue.push(i));
+        }
+        AZ_TEST_ASSERT(!queue.push(4));
+        EXPECT_EQ(4, queue.size());
+        for (int i = 0; i < 4; ++i)
+        {
+            AZ_TEST_ASSERT(queue.pop(&result));
+            AZ_TEST_ASSERT(result == i);
+        }
+        AZ_TEST_ASSERT(queue.empty());
+
+        {
+            m_counter = 0;
+            AZStd::thread thread0(AZStd::bind(&LockFreeQueue::PushBounded<decltype(queue)>, this, &queue));
+            AZStd::thread thread1(AZStd::bind(&LockFreeQueue::Pop<decltype(queue)>, this, &queue));
+            thread0.join();
+            thread1.join();
+            AZ_TEST_ASSERT(m_counter == NUM_ITERATIONS);
+            AZ_TEST_ASSERT(queue.empty());
+        }
+    }
+
+    TEST_F(LockFreeQueue, LockFreeBoundedQueueBatch)
+    {
+        lock_free_bounded_queue<int> queue(8);
+        const int values[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        EXPECT_EQ(5, queue.push_batch(values, 5));
+        EXPECT_EQ(3, queue.push_batch(values + 5, 5)); // only room for 3
+        EXPECT_EQ(0, queue.push_batch(values + 8, 2));
+
+        int results[10];
+        EXPECT_EQ(2, queue.pop_batch(results, 2));
+        EXPECT_EQ(6, queue.pop_batch(results + 2, 10));
+        EXPECT_EQ(0, queue.pop_batch(results, 10));
+        for (int i = 0; i < 8; ++i)
+        {
+            EXPECT_EQ(i, results[i]);
+        }
+    }
+
+    TEST_F(LockFreeQueue, LockFreeBoundedQueueNonTrivialDestructor)
+    {
+        lock_free_bounded_queue<SharedInt> queue(4);
+        SharedInt result;
+        AZ_TEST_ASSERT(!queue.pop(&result));
+
+        queue.push(20);
+        queue.push(30);
+        AZ_TEST_ASSERT(queue.pop(&result));
+        AZ_TEST_ASSERT(result == 20);
+        queue.push(40); // the queue destructor releases the rest
+    }
+
+    TEST_F(LockFreeQueue, LockFreeBoundedQueueMultipleProducersConsumers)
+    {
+        static const int numThreads = 4;
+        static const int numValues = NUM_ITERATIONS / numThreads;
+        lock_free_bounded_queue<int> queue(64);
+        atomic<int> sum(0);
+        atomic<int> numPopped(0);
+
+        AZStd::thread producers[numThreads];
+        AZStd::thread consumers[numThreads];
+        for (int t = 0; t < numThreads; ++t)
+        {
+            producers[t] = AZStd::thread([&queue]()
+            {
+                int values[8];
+                int numPushed = 0;
+                while (numPushed < numValues)
+                {
+                    // alternate batches and single pushes
+                    const int batch = AZStd::GetMin(numValues - numPushed, 1 + numPushed % 8);
+                    for (int i = 0; i < batch; ++i)
+                    {
+                        values[i] = numPushed + i + 1;
+                    }
+                    const int pushed = batch == 1 ? (queue.push(values[0]) ? 1 : 0) : static_cast<int>(queue.push_batch(values, batch));
+                    if (pushed == 0)
+                    {
+                        AZStd::this_thread::yield(); // full
+                    }
+                    numPushed += pushed;
+                }
+            });
+            consumers[t] = AZStd::thread([&queue, &sum, &numPopped]()
+            {
+                int values[8];
+                while (numPopped.load() < numValues * numThreads)
+                {
+                    const int popped = static_cast<int>(queue.pop_batch(values, 8));
+                    for (int i = 0; i < popped; ++i)
+                    {
+                        sum += values[i];
+                    }
+                    if (popped == 0)
+                    {
+                        AZStd::this_thread::yield(); // empty
+                    }
+                    numPopped += popped;
+                }
+            });
+        }
+        for (int t = 0; t < numThreads; ++t)
+        {
+            producers[t].join();
+            consumers[t].join();
+        }
+
+        EXPECT_EQ(numValues * numThreads, numPopped.load());
+        EXPECT_EQ(numThreads * (numValues * (numValues + 1) / 2), sum.load());
+        AZ_TEST_ASSERT(queue.empty());
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+namespace Benchmark
+{
+    namespace LockFreeQueueBenchmarkInternal
+    {
+        static const int NumValuesPerProducer = 16 * 1024;
+
+        template <class Queue>
+        bool TryPush(Queue& queue, int value)
+        {
+            queue.push(value);
+            return true;
+        }
+
+        template <class T, class Allocator>
+        bool TryPush(AZStd::lock_free_bounded_queue<T, Allocator>& queue, int value)
+        {
+            return queue.push(value);
+        }
+
+        /// Moves NumValuesPerProducer values from every producer to the consumers, as fast as possible
+        template <class Queue>
+        void ProducersConsumers(Queue& queue, int numProducers, int numConsumers)
+        {
+            AZStd::atomic<int> numPopped(0);
+            const int numValues = NumValuesPerProducer * numProducers;
+
+            AZStd::vector<AZStd::thread> threads;
+            for (int i = 0; i < numProducers; ++i)
+            {
+                threads.emplace_back([&queue]()
+                {
+                    for (int value = 0; value < NumValuesPerProducer; )
+                    {
+                        value += TryPush(queue, value) ? 1 : 0;
+                    }
+                });
+            }
+            for (int i = 0; i < numConsumers; ++i)
+            {
+                threads.emplace_back([&queue, &numPopped, numValues]()
+                {
+                    int value;
+                    while (numPopped.load(AZStd::memory_order_relaxed) < numValues)
+                    {
+                        if (queue.pop(&value))
+                        {
+                            numPopped.fetch_add(1, AZStd::memory_order_relaxed);
+                        }
+                    }
+                });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        void ProducersConsumersBatched(AZStd::lock_free_bounded_queue<int>& queue, int numProducers, int numConsumers)
+        {
+            static const int BatchSize = 16;
+            AZStd::atomic<int> numPopped(0);
+            const int numValues = NumValuesPerProducer * numProducers;
+
+            AZStd::vector<AZStd::thread> threads;
+            for (int i = 0; i < numProducers; ++i)
+            {
+                threads.emplace_back([&queue]()
+                {
+                    int values[BatchSize] = { 0 };
+                    for (int numPushed = 0; numPushed < NumValuesPerProducer; )
+                    {
+                        numPushed += static_cast<int>(queue.push_batch(values, AZStd::GetMin(BatchSize, NumValuesPerProducer - numPushed)));
+                    }
+                });
+            }
+            for (int i = 0; i < numConsumers; ++i)
+            {
+                threads.emplace_back([&queue, &numPopped, numValues]()
+                {
+                    int values[BatchSize];
+                    while (numPopped.load(AZStd::memory_order_relaxed) < numValues)
+                    {
+                        numPopped.fetch_add(static_cast<int>(queue.pop_batch(values, BatchSize)), AZStd::memory_order_relaxed);
+                    }
+                });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        void ProducerConsumerArgs(::benchmark::internal::Benchmark* benchmark)
+        {
+            benchmark
+                ->ArgNames({ { "Producers" }, { "Consumers" } })
+                ->Args({ 1, 1 })
+                ->Args({ 2, 2 })
+                ->Args({ 4, 4 })
+                ->Args({ 4, 1 })
+                ->Args({ 1, 4 })
+                ->Unit(::benchmark::kMicrosecond)
+                ->UseRealTime()
+                ;
+        }
+    }
+
+    using namespace LockFreeQueueBenchmarkInternal;
+
+    class LockFreeQueueBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    };
+
+    BENCHMARK_DEFINE_F(LockFreeQueueBenchmarkFixture, BM_LockFreeBoundedQueue)(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            AZStd::lock_free_bounded_queue<int> queue(1024);
+            ProducersConsumers(queue, static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+        }
+        state.SetItemsProcessed(state.iterations() * NumValuesPerProducer * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(LockFreeQueueBenchmarkFixture, BM_LockFreeBoundedQueue)->Apply(&ProducerConsumerArgs);
+
+    BENCHMARK_DEFINE_F(LockFreeQueueBenchmarkFixture, BM_LockFreeBoundedQueueBatched)(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            AZStd::lock_free_bounded_queue<int> queue(1024);
+            ProducersConsumersBatched(queue, static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+        }
+        state.SetItemsProcessed(state.iterations() * NumValuesPerProducer * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(LockFreeQueueBenchmarkFixture, BM_LockFreeBoundedQueueBatched)->Apply(&ProducerConsumerArgs);
+
+    BENCHMARK_DEFINE_F(LockFreeQueueBenchmarkFixture, BM_LockFreeQueue)(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            AZStd::lock_free_queue<int, UnitTestInternal::MyLockFreeAllocator> queue;
+            ProducersConsumers(queue, static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+        }
+        state.SetItemsProcessed(state.iterations() * NumValuesPerProducer * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(LockFreeQueueBenchmarkFixture, BM_LockFreeQueue)->Apply(&ProducerConsumerArgs);
+
+    BENCHMARK_DEFINE_F(LockFreeQueueBenchmarkFixture, BM_LockFreeStampedQueue)(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            AZStd::lock_free_stamped_queue<int, UnitTestInternal::MyLockFreeAllocator> queue;
+            ProducersConsumers(queue, static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+        }
+        state.SetItemsProcessed(state.iterations() * NumValuesPerProducer * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(LockFreeQueueBenchmarkFixture, BM_LockFreeStampedQueue)->Apply(&ProducerConsumerArgs);
+
+    // concurrent_vector has no pop, only the producer side is comparable
+    BENCHMARK_DEFINE_F(LockFreeQueueBenchmarkFixture, BM_ConcurrentVectorPushBack)(::benchmark::State& state)
+    {
+        const int numProducers = static_cast<int>(state.range(0));
+        while (state.KeepRunning())
+        {
+            AZStd::concurrent_vector<int> vector;
+            AZStd::vector<AZStd::thread> threads;
+            for (int i = 0; i < numProducers; ++i)
+            {
+                threads.emplace_back([&vector]()
+                {
+                    for (int value = 0; value < NumValuesPerProducer; ++value)
+                    {
+                        vector.push_back(value);
+                    }
+                });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * NumValuesPerProducer * numProducers);
+    }
+    BENCHMARK_REGISTER_F(LockFreeQueueBenchmarkFixture, BM_ConcurrentVectorPushBack)
+        ->ArgName("Producers")->Arg(1)->Arg(2)->Arg(4)->Unit(::benchmark::kMicrosecond)->UseRealTime();
 }
+#endif // HAVE_BENCHMARK
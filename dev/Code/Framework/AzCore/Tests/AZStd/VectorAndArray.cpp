@@ -22,6 +22,10 @@
 
 #include <AzCore/std/utils.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif // HAVE_BENCHMARK
+
 using namespace AZStd;
 using namespace UnitTestInternal;
 
@@ -1008,3 +1012,91 @@ namespace UnitTest
         // BitsetTest-End
     }
 }
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+namespace Benchmark
+{
+    const int kNumVectorElements = 1024;
+
+    class VectorBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    };
+
+    BENCHMARK_F(VectorBenchmarkFixture, BM_Vector_PushBack)(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            AZStd::vector<int> container;
+            for (int i = 0; i < kNumVectorElements; ++i)
+            {
+                container.push_back(i);
+            }
+            ::benchmark::DoNotOptimize(container.data());
+        }
+        state.SetItemsProcessed(state.iterations() * kNumVectorElements);
+    }
+
+    BENCHMARK_F(VectorBenchmarkFixture, BM_Vector_PushBackReserved)(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            AZStd::vector<int> container;
+            container.reserve(kNumVectorElements);
+            for (int i = 0; i < kNumVectorElements; ++i)
+            {
+                container.push_back(i);
+            }
+            ::benchmark::DoNotOptimize(container.data());
+        }
+        state.SetItemsProcessed(state.iterations() * kNumVectorElements);
+    }
+
+    BENCHMARK_F(VectorBenchmarkFixture, BM_FixedVector_PushBack)(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            AZStd::fixed_vector<int, kNumVectorElements> container;
+            for (int i = 0; i < kNumVectorElements; ++i)
+            {
+                container.push_back(i);
+            }
+            ::benchmark::DoNotOptimize(container.data());
+        }
+        state.SetItemsProcessed(state.iterations() * kNumVectorElements);
+    }
+
+    BENCHMARK_F(VectorBenchmarkFixture, BM_Vector_Iterate)(::benchmark::State& state)
+    {
+        AZStd::vector<int> container(kNumVectorElements, 1);
+        while (state.KeepRunning())
+        {
+            int sum = 0;
+            for (int value : container)
+            {
+                sum += value;
+            }
+            ::benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * kNumVectorElements);
+    }
+
+    BENCHMARK_F(VectorBenchmarkFixture, BM_Vector_EraseFront)(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            state.PauseTiming();
+            AZStd::vector<int> container(kNumVectorElements, 1);
+            state.ResumeTiming();
+            while (!container.empty())
+            {
+                container.erase(container.begin());
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * kNumVectorElements);
+    }
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
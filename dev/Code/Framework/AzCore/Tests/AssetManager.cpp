@@ -1363,6 +1363,48 @@ namespace UnitTest
             //////////////////////////////////////////////////////////////////////////
         };
 
+        // Knows the product dependency of Asset1 on Asset1Prime, as the catalog exported by the AssetProcessor would
+        class DependencyCatalog
+            : public AssetCatalogRequestBus::Handler
+        {
+        public:
+            DependencyCatalog()
+            {
+                AssetCatalogRequestBus::Handler::BusConnect();
+            }
+
+            ~DependencyCatalog()
+            {
+                AssetCatalogRequestBus::Handler::BusDisconnect();
+            }
+
+            AssetInfo GetAssetInfoById(const AssetId& id) override
+            {
+                AssetInfo info;
+                if (id == AssetId(MYASSET1_ID))
+                {
+                    info.m_assetId = id;
+                    info.m_assetType = azrtti_typeid<Asset1>();
+                }
+                else if (id == AssetId(MYASSET4_ID))
+                {
+                    info.m_assetId = id;
+                    info.m_assetType = azrtti_typeid<Asset1Prime>();
+                }
+                return info;
+            }
+
+            AZ::Outcome<AZStd::vector<ProductDependency>, AZStd::string> GetAllProductDependencies(const AssetId& id) override
+            {
+                AZStd::vector<ProductDependency> dependencies;
+                if (id == AssetId(MYASSET1_ID))
+                {
+                    dependencies.push_back(ProductDependency(AssetId(MYASSET4_ID), 0));
+                }
+                return AZ::Success(dependencies);
+            }
+        };
+
         void SetUp() override
         {
             AllocatorsFixture::SetUp();
@@ -1475,6 +1517,64 @@ namespace UnitTest
 #endif
     }
 
+    TEST_F(AssetJobsFloodTest, DependenciesArePrefetched)
+    {
+        SerializeContext context;
+        Asset1Prime::Reflect(context);
+        Asset1::Reflect(context);
+
+        AssetManager::Descriptor desc;
+        desc.m_maxWorkerThreads = 2;
+        AssetManager::Create(desc);
+
+        auto& db = AssetManager::Instance();
+        EXPECT_TRUE(db.GetDependencyPrefetchEnabled());
+
+        AssetHandlerAndCatalog* assetHandlerAndCatalog = aznew AssetHandlerAndCatalog;
+        assetHandlerAndCatalog->m_context = &context;
+        AZStd::vector<AssetType> types;
+        assetHandlerAndCatalog->GetHandledAssetTypes(types);
+        for (const auto& type : types)
+        {
+            db.RegisterHandler(assetHandlerAndCatalog, type);
+            db.RegisterCatalog(assetHandlerAndCatalog, type);
+        }
+
+        {
+            Asset1Prime ap1;
+            EXPECT_TRUE(AZ::Utils::SaveObjectToFile(GetTestFolderPath() + "TestAsset4.txt", AZ::DataStream::ST_XML, &ap1, &context));
+
+            Asset1 a1;
+            a1.asset.Create(Data::AssetId(MYASSET4_ID), false);
+            EXPECT_TRUE(AZ::Utils::SaveObjectToFile(GetTestFolderPath() + "TestAsset1.txt", AZ::DataStream::ST_XML, &a1, &context));
+
+            assetHandlerAndCatalog->m_numCreations = 0;
+        }
+
+        {
+            DependencyCatalog dependencyCatalog;
+
+            Data::Asset<Asset1> asset1 = db.GetAsset(AZ::Uuid(MYASSET1_ID), azrtti_typeid<Asset1>(), true, nullptr);
+
+            // queued with the root asset, before the root data is read
+            Data::Asset<AssetData> dependency = db.FindAsset(AssetId(MYASSET4_ID));
+            EXPECT_TRUE(dependency.Get() != nullptr);
+
+            while (asset1.IsLoading() || dependency.IsLoading())
+            {
+                AssetManager::Instance().DispatchEvents();
+                AZStd::this_thread::yield();
+            }
+
+            EXPECT_TRUE(asset1.IsReady());
+            EXPECT_TRUE(dependency.IsReady());
+            EXPECT_EQ(dependency.Get(), asset1.Get()->asset.Get());
+            EXPECT_TRUE(assetHandlerAndCatalog->m_numCreations == 2);
+        }
+
+        AssetManager::Destroy();
+    }
+
     /**
     * Run multiple threads that get and release assets simultaneously to test AssetManager's thread safety
     */
@@ -19,8 +19,11 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/EntityUtils.h>
+#include <AzCore/Component/EntityLookupTable.h>
 
 #include <AzCore/IO/StreamerComponent.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Serialization/ObjectStream.h>
 
 #include <AzCore/Memory/MemoryComponent.h>
@@ -1112,6 +1115,110 @@ namespace UnitTest
         EXPECT_EQ(Entity::DependencySortResult::HasIncompatibleServices, m_entity->EvaluateDependencies());
     }
 
+    /**
+     * Batched entity activation test
+     */
+    class ThreadSafeActivationComponent
+        : public Component
+    {
+    public:
+        AZ_COMPONENT(ThreadSafeActivationComponent, "{3A0B5C1E-7F0D-4E53-9B2A-6D7C1E4F8A21}")
+
+        void Init() override { ++s_initCount; }
+        void Activate() override { m_isActive = true; ++s_activateCount; }
+        void Deactivate() override { m_isActive = false; }
+
+        static bool IsActivationThreadSafe() { return true; }
+        static void GetProvidedServices(ComponentDescriptor::DependencyArrayType& provided) { provided.push_back(AZ_CRC("ThreadSafeService")); }
+        static void Reflect(ReflectContext* /*reflection*/) {}
+
+        static AZStd::atomic_int s_initCount;
+        static AZStd::atomic_int s_activateCount;
+
+        bool m_isActive = false;
+    };
+
+    AZStd::atomic_int ThreadSafeActivationComponent::s_initCount;
+    AZStd::atomic_int ThreadSafeActivationComponent::s_activateCount;
+
+    // requires the thread safe component, so it has to be activated after it
+    class ThreadSafeDependentComponent
+        : public Component
+    {
+    public:
+        AZ_COMPONENT(ThreadSafeDependentComponent, "{8E2D4F6A-1C3B-4A5D-9E7F-0B2C4D6E8F13}")
+
+        void Activate() override { m_activatedAfterService = GetEntity()->FindComponent<ThreadSafeActivationComponent>()->m_isActive; }
+        void Deactivate() override {}
+
+        static bool IsActivationThreadSafe() { return true; }
+        static void GetRequiredServices(ComponentDescriptor::DependencyArrayType& required) { required.push_back(AZ_CRC("ThreadSafeService")); }
+        static void Reflect(ReflectContext* /*reflection*/) {}
+
+        bool m_activatedAfterService = false;
+    };
+
+    TEST_F(ComponentDependency, ActivateEntities_MixedThreadSafety_ActivatesAllEntitiesInDependencyOrder)
+    {
+        AllocatorInstance<PoolAllocator>::Create();
+        AllocatorInstance<ThreadPoolAllocator>::Create();
+
+        JobManagerDesc jobDesc;
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            jobDesc.m_workerThreads.push_back(JobManagerThreadDesc());
+        }
+        JobManager* jobManager = aznew JobManager(jobDesc);
+        JobContext* jobContext = aznew JobContext(*jobManager);
+        JobContext::SetGlobalContext(jobContext);
+
+        // component descriptors are cleaned up when application shuts down
+        aznew ThreadSafeActivationComponent::DescriptorType;
+        aznew ThreadSafeDependentComponent::DescriptorType;
+        ThreadSafeActivationComponent::s_initCount = 0;
+        ThreadSafeActivationComponent::s_activateCount = 0;
+
+        const int numEntities = 64;
+        AZStd::vector<Entity*> entities;
+        for (int i = 0; i < numEntities; ++i)
+        {
+            Entity* entity = aznew Entity();
+            // the dependent component is added first so the sort has to reorder it
+            entity->CreateComponent<ThreadSafeDependentComponent>();
+            entity->CreateComponent<ThreadSafeActivationComponent>();
+            if (i % 4 == 0)
+            {
+                // not thread safe, keeps the entity on the calling thread
+                entity->CreateComponent<ComponentD>();
+            }
+            entities.push_back(entity);
+        }
+
+        Entity::InitEntities(entities);
+        EXPECT_EQ(numEntities, ThreadSafeActivationComponent::s_initCount);
+
+        Entity::ActivateEntities(entities);
+        EXPECT_EQ(numEntities, ThreadSafeActivationComponent::s_activateCount);
+        for (Entity* entity : entities)
+        {
+            EXPECT_EQ(Entity::ES_ACTIVE, entity->GetState());
+            EXPECT_TRUE(entity->FindComponent<ThreadSafeDependentComponent>()->m_activatedAfterService);
+            EXPECT_EQ(entity, m_componentApp->FindEntity(entity->GetId()));
+        }
+
+        for (Entity* entity : entities)
+        {
+            delete entity;
+        }
+
+        JobContext::SetGlobalContext(nullptr);
+        delete jobContext;
+        delete jobManager;
+
+        AllocatorInstance<ThreadPoolAllocator>::Destroy();
+        AllocatorInstance<PoolAllocator>::Destroy();
+    }
+
     /**
      * UserSettingsComponent test
      */
@@ -1396,6 +1503,64 @@ namespace UnitTest
         run();
     }
 
+    class FrameProfilerComponentSpikeTest
+        : public AllocatorsFixture
+        , public FrameProfilerBus::Handler
+    {
+    public:
+        void OnFrameProfilerData(const FrameProfiler::ThreadDataArray& data) override
+        {
+            (void)data;
+        }
+
+        void OnFrameProfilerSpike(const FrameProfiler::ThreadDataArray& data, unsigned int frameId, float frameTimeMs) override
+        {
+            (void)data;
+            m_spikeFrames.push_back(frameId);
+            m_lastSpikeTimeMs = frameTimeMs;
+        }
+
+        AZStd::vector<unsigned int> m_spikeFrames;
+        float m_lastSpikeTimeMs = 0.0f;
+    };
+
+    TEST_F(FrameProfilerComponentSpikeTest, SlowFrames_ReportedOncePerHistory)
+    {
+        FrameProfilerBus::Handler::BusConnect();
+
+        ComponentApplication app;
+        ComponentApplication::Descriptor desc;
+        desc.m_useExistingAllocator = true;
+        desc.m_enableDrilling = false;
+        ComponentApplication::StartupParameters startupParams;
+        startupParams.m_allocator = &AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+        Entity* systemEntity = app.Create(desc, startupParams);
+        FrameProfilerComponent* frameProfiler = systemEntity->CreateComponent<FrameProfilerComponent>();
+        frameProfiler->SetSpikeThreshold(50.0f);
+
+        systemEntity->Init();
+        systemEntity->Activate();
+
+        app.Tick(0.01f);
+        EXPECT_TRUE(m_spikeFrames.empty());
+
+        app.Tick(0.1f);
+        ASSERT_EQ(1u, m_spikeFrames.size());
+        EXPECT_EQ(2u, m_spikeFrames[0]);
+        EXPECT_NEAR(100.0f, m_lastSpikeTimeMs, 0.01f);
+
+        // the default history is 2 frames, the next slow frame is still covered by the previous report
+        app.Tick(0.1f);
+        EXPECT_EQ(1u, m_spikeFrames.size());
+
+        app.Tick(0.1f);
+        EXPECT_EQ(2u, m_spikeFrames.size());
+
+        FrameProfilerBus::Handler::BusDisconnect();
+
+        app.Destroy();
+    }
+
     class SimpleEntityRefTestComponent
         : public Component
     {
@@ -1608,6 +1773,43 @@ namespace UnitTest
         }
     }
 
+    TEST_F(Components, EntityLookupTable_InsertRemoveFind_TracksRegisteredEntities)
+    {
+        const size_t numEntities = 1000;
+        AZStd::vector<Entity*> entities;
+        EntityLookupTable table;
+        for (size_t i = 0; i < numEntities; ++i)
+        {
+            entities.push_back(aznew Entity(EntityId(i * 3 + 1)));
+            EXPECT_TRUE(table.Insert(entities.back()));
+        }
+        EXPECT_FALSE(table.Insert(entities.front())); // already registered
+        EXPECT_EQ(numEntities, table.Size());
+
+        // remove every other entity, the others must stay reachable
+        for (size_t i = 0; i < numEntities; i += 2)
+        {
+            EXPECT_TRUE(table.Remove(entities[i]->GetId()));
+        }
+        EXPECT_FALSE(table.Remove(entities[0]->GetId()));
+        EXPECT_EQ(numEntities / 2, table.Size());
+
+        for (size_t i = 0; i < numEntities; ++i)
+        {
+            EXPECT_EQ(i % 2 ? entities[i] : nullptr, table.Find(entities[i]->GetId()));
+        }
+        EXPECT_EQ(nullptr, table.Find(EntityId(2)));
+
+        table.Clear();
+        EXPECT_TRUE(table.Empty());
+        EXPECT_EQ(nullptr, table.Find(entities[1]->GetId()));
+
+        for (Entity* entity : entities)
+        {
+            delete entity;
+        }
+    }
+
     TEST_F(Components, EntityIdGeneration)
     {
         // Generate 1 million ids across 100 threads, and ensure that none collide
@@ -20,6 +20,8 @@
 #include <AzCore/IO/FileIOEventBus.h>
 #include <AzCore/IO/Device.h>
 #include <AzCore/IO/CompressorZLib.h>
+#include <AzCore/IO/CompressorZStd.h>
+#include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/IO/VirtualStream.h>
 
 #include <AzCore/Memory/Memory.h>
@@ -395,6 +397,85 @@ namespace UnitTest
 
             Streamer::Destroy();
         }
+
+        void runConcurrentReads()
+        {
+            Streamer::Descriptor desc;
+            desc.m_solidStateQueueDepth = 4;
+            AZStd::string testFolder = GetTestFolderPath();
+            if (testFolder.length() > 0)
+            {
+                desc.m_fileMountPoint = testFolder.c_str();
+            }
+            Streamer::Create(desc);
+
+            const size_t numFiles = 3;
+            const size_t numValues = 64 * 1024; // larger than a single device operation
+            AZStd::string fileNames[numFiles];
+            VirtualStream* streams[numFiles];
+            AZStd::vector<u32> values(numValues);
+            for (size_t file = 0; file < numFiles; ++file)
+            {
+                fileNames[file] = GetRandomTestFileName("concurrent.dat");
+                streams[file] = GetStreamer()->RegisterFileStream(fileNames[file].c_str(), OpenMode::ModeWrite, false);
+                AZ_TEST_ASSERT(streams[file] != nullptr);
+                for (size_t i = 0; i < numValues; ++i)
+                {
+                    values[i] = static_cast<u32>(file << 24 | i);
+                }
+                Request::StateType operationState;
+                SizeType bytesTransfered = GetStreamer()->Write(streams[file], values.data(), numValues * sizeof(u32), Request::PriorityType::DR_PRIORITY_NORMAL, &operationState);
+                EXPECT_EQ(numValues * sizeof(u32), bytesTransfered);
+                EXPECT_EQ(Request::StateType::ST_COMPLETED, operationState);
+                GetStreamer()->UnRegisterStream(streams[file]);
+                streams[file] = GetStreamer()->RegisterFileStream(fileNames[file].c_str(), OpenMode::ModeRead, false);
+                AZ_TEST_ASSERT(streams[file] != nullptr);
+            }
+
+            // interleave out of order reads of all files with different deadlines, so several streams are read at once
+            const size_t numChunks = 16;
+            const size_t chunkValues = numValues / numChunks;
+            AZStd::vector<u32> readValues[numFiles];
+            SyncRequestCallback doneCB;
+            for (size_t chunk = 0; chunk < numChunks; ++chunk)
+            {
+                const size_t readChunk = (chunk * 7) % numChunks;
+                for (size_t file = 0; file < numFiles; ++file)
+                {
+                    readValues[file].resize(numValues);
+                    const AZStd::chrono::microseconds deadline(1000 * ((chunk + file) % 5));
+                    RequestHandle request = GetStreamer()->ReadAsync(streams[file], readChunk * chunkValues * sizeof(u32), chunkValues * sizeof(u32), &readValues[file][readChunk * chunkValues], doneCB, deadline);
+                    AZ_TEST_ASSERT(request != InvalidRequestHandle);
+                }
+            }
+            // one last whole file read
+            AZStd::vector<u32> wholeFile(numValues);
+            GetStreamer()->ReadAsync(streams[0], 0, numValues * sizeof(u32), wholeFile.data(), doneCB, AZStd::chrono::microseconds(0), Request::PriorityType::DR_PRIORITY_CRITICAL);
+            doneCB.Wait();
+            EXPECT_EQ(Request::StateType::ST_COMPLETED, doneCB.m_state);
+            EXPECT_EQ(0, m_fileErrors);
+
+            for (size_t file = 0; file < numFiles; ++file)
+            {
+                size_t numMismatches = 0;
+                for (size_t i = 0; i < numValues; ++i)
+                {
+                    numMismatches += readValues[file][i] != static_cast<u32>(file << 24 | i) ? 1 : 0;
+                }
+                EXPECT_EQ(0u, numMismatches);
+                GetStreamer()->UnRegisterStream(streams[file]);
+            }
+            for (size_t i = 0; i < numValues; ++i)
+            {
+                if (wholeFile[i] != static_cast<u32>(i))
+                {
+                    ADD_FAILURE() << "whole file read mismatch at " << i;
+                    break;
+                }
+            }
+
+            Streamer::Destroy();
+        }
     };
 
     TestFileIOBase FileStreamTest::m_fileIO;
@@ -405,6 +486,11 @@ namespace UnitTest
         run();
     }
 
+    TEST_F(FileStreamTest, ConcurrentReads_DataMatches)
+    {
+        runConcurrentReads();
+    }
+
 #ifdef ENABLE_PERFORMANCE_TEST
     /**
      *
@@ -1209,5 +1295,57 @@ namespace UnitTest
     }
 
 #endif // AZCORE_EXCLUDE_ZLIB
-}
 
+#if !defined(AZCORE_EXCLUDE_ZSTANDARD)
+
+    class CompressorZStdTest
+        : public AllocatorsFixture
+    {
+    };
+
+    TEST_F(CompressorZStdTest, SeekPoints_RandomReadsMatch)
+    {
+        const int numChunks = 16;
+        const int chunkValues = 16 * 1024;
+        const size_t chunkSize = chunkValues * sizeof(AZ::u32);
+
+        AZStd::vector<AZ::u32> source(numChunks * chunkValues);
+        for (size_t i = 0; i < source.size(); ++i)
+        {
+            source[i] = static_cast<AZ::u32>((i / 7) * 2654435761u);
+        }
+
+        AZStd::vector<char> compressed;
+        {
+            ByteContainerStream<AZStd::vector<char> > byteStream(&compressed);
+            CompressorStream writeStream(&byteStream, false);
+            // a seek point (new frame) every chunk
+            ASSERT_TRUE(writeStream.WriteCompressedHeader(CompressorZStd::TypeId(), 3, chunkSize - 1));
+            for (int chunk = 0; chunk < numChunks; ++chunk)
+            {
+                EXPECT_EQ(chunkSize, writeStream.Write(chunkSize, &source[chunk * chunkValues]));
+            }
+            EXPECT_EQ(source.size() * sizeof(AZ::u32), writeStream.GetUncompressedLength());
+            writeStream.Close();
+        }
+        EXPECT_LT(compressed.size(), source.size() * sizeof(AZ::u32));
+
+        ByteContainerStream<AZStd::vector<char> > byteStream(&compressed);
+        CompressorStream readStream(&byteStream, false);
+        ASSERT_TRUE(readStream.IsCompressed());
+
+        AZStd::vector<AZ::u32> result(chunkValues + 1);
+        const int chunkOrder[] = { 5, 0, 15, 15, 3, 4, 1, 12 };
+        for (int chunk : chunkOrder)
+        {
+            // start within the chunk, so the read crosses into the next frame
+            const size_t firstValue = chunk * chunkValues + 3;
+            const size_t numValues = AZStd::GetMin(result.size(), source.size() - firstValue);
+            EXPECT_EQ(numValues * sizeof(AZ::u32), readStream.ReadAtOffset(numValues * sizeof(AZ::u32), result.data(), firstValue * sizeof(AZ::u32)));
+            EXPECT_EQ(0, memcmp(result.data(), &source[firstValue], numValues * sizeof(AZ::u32)));
+        }
+        readStream.Close();
+    }
+
+#endif // AZCORE_EXCLUDE_ZSTANDARD
+}
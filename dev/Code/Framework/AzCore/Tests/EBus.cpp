@@ -14,6 +14,7 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/EBus/Results.h>
+#include <AzCore/Debug/EBusProfiler.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -48,7 +49,7 @@ namespace BusImplementation
     };
 
     // Traits for the benchmark bus
-    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
+    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, bool singleHandlerDirect = false>
     class Traits
         : public AZ::EBusTraits
     {
@@ -56,6 +57,7 @@ namespace BusImplementation
         static const AZ::EBusAddressPolicy AddressPolicy = addressPolicy;
         static const AZ::EBusHandlerPolicy HandlerPolicy = handlerPolicy;
         static const bool LocklessDispatch = locklessDispatch;
+        static const bool SingleHandlerDirect = singleHandlerDirect;
 
         // Allow queuing
         static const bool EnableEventQueue = true;
@@ -196,8 +198,8 @@ private:
 };
 
 // Definition of the benchmark bus, depending on supplied policies
-template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
-using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch>>;
+template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, bool singleHandlerDirect = false>
+using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch, singleHandlerDirect>>;
 
 #define EBUS_TEST_ALIAS(BusType, AddressPolicy, HandlerPolicy)                                              \
     using BusType = TestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy>;    \
@@ -216,6 +218,9 @@ EBUS_TEST_ALIAS(ManyToManyOrdered, ById, MultipleAndOrdered)
 EBUS_TEST_ALIAS(ManyOrderedToOne, ByIdAndOrdered, Single)
 EBUS_TEST_ALIAS(ManyOrderedToMany, ByIdAndOrdered, Multiple)
 EBUS_TEST_ALIAS(ManyOrderedToManyOrdered, ByIdAndOrdered, MultipleAndOrdered)
+// Single, dispatching directly to the handler
+using OneToOneDirect = TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Single, false, true>;
+namespace testing { namespace internal { template<> std::string GetTypeName<OneToOneDirect>() { return "OneToOneDirect"; } } }
 
 // Handler for multi-address buses
 template <typename Bus, AZ::EBusAddressPolicy addressPolicy = Bus::Traits::AddressPolicy>
@@ -2814,6 +2819,230 @@ namespace UnitTest
         }
     }
 
+    namespace EpochDispatchTest
+    {
+        struct EpochEvents
+            : public AZ::EBusTraits
+        {
+            using MutexType = AZStd::recursive_mutex;
+            static const bool EpochDispatch = true;
+
+            virtual ~EpochEvents() = default;
+            virtual void Add(int value) = 0;
+            virtual void ConnectOther() = 0;
+            virtual void DisconnectSelf() = 0;
+        };
+
+        using EpochBus = AZ::EBus<EpochEvents>;
+
+        struct EpochImpl
+            : public EpochBus::Handler
+        {
+            AZStd::atomic_int m_sum{ 0 };
+            EpochImpl* m_other = nullptr;
+
+            ~EpochImpl()
+            {
+                BusDisconnect();
+            }
+
+            void Add(int value) override
+            {
+                m_sum += value;
+            }
+            void ConnectOther() override
+            {
+                if (m_other)
+                {
+                    m_other->BusConnect();
+                    // deferred until the dispatch returns
+                    EXPECT_FALSE(m_other->BusIsConnected());
+                }
+            }
+            void DisconnectSelf() override
+            {
+                BusDisconnect();
+                EXPECT_TRUE(BusIsConnected());
+            }
+        };
+    }
+
+    TEST_F(EBus, EpochDispatch_ConnectionChangesInDispatch_AreDeferred)
+    {
+        using namespace EpochDispatchTest;
+
+        EpochImpl first;
+        EpochImpl second;
+        first.m_other = &second;
+        first.BusConnect();
+
+        EpochBus::Broadcast(&EpochBus::Events::ConnectOther);
+        EXPECT_TRUE(second.BusIsConnected());
+
+        EpochBus::Broadcast(&EpochBus::Events::Add, 1);
+        EXPECT_EQ(1, first.m_sum.load());
+        EXPECT_EQ(1, second.m_sum.load());
+
+        EpochBus::Broadcast(&EpochBus::Events::DisconnectSelf);
+        EXPECT_FALSE(first.BusIsConnected());
+        EXPECT_FALSE(second.BusIsConnected());
+    }
+
+    TEST_F(EBus, EpochDispatch_HandlerDestroyedInDispatch_CancelsDeferredConnect)
+    {
+        using namespace EpochDispatchTest;
+
+        struct Spawner
+            : public EpochBus::Handler
+        {
+            void Add(int) override
+            {
+                EpochImpl* handler = new EpochImpl();
+                handler->BusConnect();
+                delete handler;
+            }
+            void ConnectOther() override {}
+            void DisconnectSelf() override {}
+        };
+
+        Spawner spawner;
+        spawner.BusConnect();
+        EpochBus::Broadcast(&EpochBus::Events::Add, 1);
+
+        size_t numHandlers = 0;
+        EpochBus::EnumerateHandlers([&numHandlers](EpochEvents*) { ++numHandlers; return true; });
+        EXPECT_EQ(1, numHandlers);
+        spawner.BusDisconnect();
+    }
+
+    TEST_F(EBus, EpochDispatch_ThreadedBroadcastWithConnects_IsSafe)
+    {
+        using namespace EpochDispatchTest;
+
+        const size_t threadCount = 8;
+        enum : int { cycleCount = 1000 };
+        AZStd::thread threads[threadCount];
+
+        EpochImpl handler;
+        handler.BusConnect();
+
+        auto work = []()
+        {
+            for (int i = 0; i < cycleCount; ++i)
+            {
+                EpochBus::Broadcast(&EpochBus::Events::Add, 1);
+            }
+        };
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread = AZStd::thread(work);
+        }
+
+        for (int i = 0; i < cycleCount; ++i)
+        {
+            EpochImpl transient;
+            transient.BusConnect();
+            transient.BusDisconnect();
+        }
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(static_cast<int>(threadCount) * cycleCount, handler.m_sum.load());
+    }
+
+    TEST_F(EBus, SingleHandlerDirect_Dispatch_CallsHandler)
+    {
+        constexpr bool connectOnConstruct{ false };
+        Handler<OneToOneDirect> handler(0, connectOnConstruct);
+
+        int result = 0;
+        OneToOneDirect::BroadcastResult(result, &OneToOneDirect::Events::OnEvent);
+        EXPECT_EQ(0, result);
+        EXPECT_EQ(0u, handler.m_eventCalls);
+
+        handler.Connect();
+        OneToOneDirect::Broadcast(&OneToOneDirect::Events::OnEvent);
+        OneToOneDirect::BroadcastReverse(&OneToOneDirect::Events::OnEvent);
+        OneToOneDirect::BroadcastResult(result, &OneToOneDirect::Events::OnEvent);
+        EXPECT_EQ(2, result);
+        OneToOneDirect::EnumerateHandlers([](BusImplementation::Interface* handlerInterface) { handlerInterface->OnEvent(); return true; });
+        EXPECT_EQ(4u, handler.m_eventCalls);
+
+        OneToOneDirect::QueueBroadcast(&OneToOneDirect::Events::OnEvent);
+        OneToOneDirect::ExecuteQueuedEvents();
+        EXPECT_EQ(5u, handler.m_eventCalls);
+
+        handler.Disconnect();
+        OneToOneDirect::Broadcast(&OneToOneDirect::Events::OnEvent);
+        EXPECT_EQ(5u, handler.m_eventCalls);
+    }
+
+#if EBUS_PROFILING
+    namespace ProfilingTest
+    {
+        class ProfiledEvents
+            : public AZ::EBusTraits
+        {
+        public:
+            static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+            using BusIdType = int;
+
+            virtual void OnEvent() = 0;
+            virtual void OnOtherEvent() = 0;
+        };
+        using ProfiledBus = AZ::EBus<ProfiledEvents>;
+
+        class ProfiledImpl
+            : public ProfiledBus::Handler
+        {
+        public:
+            void OnEvent() override {}
+            void OnOtherEvent() override {}
+        };
+    }
+
+    TEST_F(EBus, Profiling_Dispatches_AreCountedPerFrame)
+    {
+        using namespace ProfilingTest;
+
+        ProfiledImpl handler;
+        handler.BusConnect(1);
+
+        AZ::Debug::EBusProfiler::EndFrame();
+        ProfiledBus::Event(1, &ProfiledEvents::OnEvent);
+        ProfiledBus::Event(1, &ProfiledEvents::OnEvent);
+        ProfiledBus::Event(2, &ProfiledEvents::OnEvent);
+        ProfiledBus::Broadcast(&ProfiledEvents::OnOtherEvent);
+        AZ::Debug::EBusProfiler::EndFrame();
+
+        const size_t allBuses = 4096;
+        AZStd::vector<AZ::Debug::EBusProfiler::BusInfo> buses;
+        AZ::Debug::EBusProfiler::GetTopBuses(buses, allBuses);
+        auto busIt = AZStd::find_if(buses.begin(), buses.end(), [](const AZ::Debug::EBusProfiler::BusInfo& bus) { return bus.m_name == ProfiledBus::GetName(); });
+        ASSERT_NE(buses.end(), busIt);
+        EXPECT_EQ(4u, busIt->m_dispatches);
+        EXPECT_EQ(3u, busIt->m_events);
+        EXPECT_EQ(1u, busIt->m_broadcasts);
+        ASSERT_EQ(2u, busIt->m_topEvents.size());
+        EXPECT_EQ(3u, busIt->m_topEvents[0].m_calls);
+        EXPECT_EQ(1u, busIt->m_topEvents[1].m_calls);
+
+        // nothing dispatched in the next frame
+        AZ::Debug::EBusProfiler::EndFrame();
+        AZ::Debug::EBusProfiler::GetTopBuses(buses, allBuses);
+        busIt = AZStd::find_if(buses.begin(), buses.end(), [](const AZ::Debug::EBusProfiler::BusInfo& bus) { return bus.m_name == ProfiledBus::GetName(); });
+        ASSERT_NE(buses.end(), busIt);
+        EXPECT_EQ(0u, busIt->m_dispatches);
+        EXPECT_TRUE(busIt->m_topEvents.empty());
+
+        handler.BusDisconnect();
+    }
+#endif // EBUS_PROFILING
+
     namespace MultithreadConnect
     {
         class MyEventGroup
@@ -3692,6 +3921,7 @@ namespace Benchmark
 // Internal macro callback for listing all buses
 #define BUS_BENCHMARK_PRIVATE_LIST_ALL(cb, fn)  \
     cb(fn, OneToOne, OneToOne)                  \
+    cb(fn, OneToOneDirect, OneToOne)            \
     cb(fn, OneToMany, OneToMany)                \
     cb(fn, OneToManyOrdered, OneToMany)         \
     BUS_BENCHMARK_PRIVATE_LIST_ID(cb, fn)
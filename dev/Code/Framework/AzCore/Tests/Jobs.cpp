@@ -15,7 +15,9 @@
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobCompletionSpin.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerTopology.h>
 #include <AzCore/Jobs/task_group.h>
 #include <AzCore/Jobs/Algorithms.h>
 #include <AzCore/std/delegate/delegate.h>
@@ -899,6 +901,163 @@ namespace UnitTest
         run();
     }
 
+    class JobPriorityTest
+        : public DefaultJobManagerSetupFixture
+    {
+    public:
+        void run()
+        {
+            //jobs take the default priority of their context, unless overridden
+            JobContext backgroundContext(*m_jobManager, JobPriority::Background);
+            Job* job = CreateJobFunction([]() {}, false, &backgroundContext);
+            AZ_TEST_ASSERT(job->GetPriority() == JobPriority::Background);
+            job->SetPriority(JobPriority::Critical);
+            AZ_TEST_ASSERT(job->GetPriority() == JobPriority::Critical);
+            AZ_TEST_ASSERT(job->GetDeadline() == 0);
+            job->StartAndWaitForCompletion();
+            delete job;
+
+            Job* jobs[5];
+            for (Job*& lanesJob : jobs)
+            {
+                lanesJob = CreateJobFunction([]() {}, false, m_jobContext);
+            }
+
+            const unsigned int critical = static_cast<unsigned int>(JobPriority::Critical);
+            const unsigned int normal = static_cast<unsigned int>(JobPriority::Normal);
+            const unsigned int background = static_cast<unsigned int>(JobPriority::Background);
+
+            //highest priority lane first, newest first within a lane
+            Internal::PriorityJobLanes lanes;
+            lanes.PushBack(jobs[0], background);
+            lanes.PushBack(jobs[1], normal);
+            lanes.PushBack(jobs[2], critical);
+            lanes.PushBack(jobs[3], normal);
+            AZ_TEST_ASSERT(lanes.PopBack() == jobs[2]);
+            AZ_TEST_ASSERT(lanes.PopBack() == jobs[3]);
+            AZ_TEST_ASSERT(lanes.PopBack() == jobs[1]);
+            AZ_TEST_ASSERT(lanes.PopBack() == jobs[0]);
+            AZ_TEST_ASSERT(lanes.IsEmpty());
+
+            //the starvation guard lets the background job run once it has been passed over twice
+            Internal::PriorityJobLanes guardedLanes;
+            guardedLanes.SetStarvationLimit(2);
+            guardedLanes.PushBack(jobs[4], background);
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                guardedLanes.PushBack(jobs[i], critical);
+            }
+            AZ_TEST_ASSERT(guardedLanes.PopFront(true) == jobs[0]);
+            AZ_TEST_ASSERT(guardedLanes.PopFront(true) == jobs[1]);
+            AZ_TEST_ASSERT(guardedLanes.PopFront(true) == jobs[4]);
+            AZ_TEST_ASSERT(guardedLanes.PopFront(true) == jobs[2]);
+            AZ_TEST_ASSERT(guardedLanes.PopFront(true) == jobs[3]);
+            AZ_TEST_ASSERT(guardedLanes.PopFront(true) == nullptr);
+
+            for (Job* lanesJob : jobs)
+            {
+                delete lanesJob;
+            }
+        }
+    };
+
+    TEST_F(JobPriorityTest, Test)
+    {
+        run();
+    }
+
+    class JobSuspendDepthTest
+        : public DefaultJobManagerSetupFixture
+    {
+    public:
+        void run()
+        {
+            //nested waits past the suspend depth limit must still complete
+            JobManagerDesc desc;
+            desc.m_maxSuspendDepth = 2;
+            for (unsigned int i = 0; i < m_numWorkerThreads; ++i)
+            {
+                desc.m_workerThreads.push_back(JobManagerThreadDesc());
+            }
+            JobManager jobManager(desc);
+            JobContext jobContext(jobManager);
+            m_limitedContext = &jobContext;
+
+            int result = 0;
+            Job* job = CreateJobFunction([this, &result]() { CalcFibonacci(g_fibonacciFast, &result); }, true, m_limitedContext);
+            job->StartAndWaitForCompletion();
+            AZ_TEST_ASSERT(result == g_fibonacciFastResult);
+        }
+
+        void CalcFibonacci(int n, int* result)
+        {
+            if (n < 2)
+            {
+                *result = n;
+            }
+            else
+            {
+                int result1, result2;
+                structured_task_group group(m_limitedContext);
+                group.run(AZStd::bind(&JobSuspendDepthTest::CalcFibonacci, this, n - 1, &result1));
+                group.run(AZStd::bind(&JobSuspendDepthTest::CalcFibonacci, this, n - 2, &result2));
+                group.wait();
+                *result = result1 + result2;
+            }
+        }
+
+    private:
+        JobContext* m_limitedContext = nullptr;
+    };
+
+    TEST_F(JobSuspendDepthTest, Test)
+    {
+        run();
+    }
+
+    class JobTopologyTest
+        : public DefaultJobManagerSetupFixture
+    {
+    public:
+        void run()
+        {
+            JobManagerTopology detected = JobManagerTopology::Detect();
+            AZ_TEST_ASSERT(!detected.m_domains.empty());
+
+            //workers are spread over the domains
+            JobManagerTopology topology;
+            topology.m_domains.push_back({ 0, 1 });
+            topology.m_domains.push_back({ 2, 3, 4 });
+            AZ_TEST_ASSERT(topology.GetDomainMask(1) == 0x1c);
+
+            JobManagerDesc desc;
+            topology.AddWorkerThreads(desc, 4, JobManagerThreadDesc());
+            AZ_TEST_ASSERT(desc.m_workerThreads.size() == 4);
+            AZ_TEST_ASSERT(desc.m_workerThreads[0].m_stealDomain == 0);
+            AZ_TEST_ASSERT(desc.m_workerThreads[1].m_stealDomain == 1);
+            AZ_TEST_ASSERT(desc.m_workerThreads[2].m_stealDomain == 0);
+            AZ_TEST_ASSERT(desc.m_workerThreads[3].m_stealDomain == 1);
+
+            //jobs hinting a domain run, including their forked children
+            JobManager jobManager(desc);
+            JobContext jobContext(jobManager);
+            for (int domain = -1; domain < 3; ++domain)
+            {
+                int result = 0;
+                Job* job = aznew FibonacciJobFork(g_fibonacciFast, &result, &jobContext);
+                job->SetAffinityDomain(domain);
+                AZ_TEST_ASSERT(job->GetAffinityDomain() == domain);
+                job->StartAndAssistUntilComplete();
+                AZ_TEST_ASSERT(result == g_fibonacciFastResult);
+            }
+        }
+    };
+
+    TEST_F(JobTopologyTest, Test)
+    {
+        run();
+    }
+
     class JobParallelInvokeTest
         : public DefaultJobManagerSetupFixture
     {
@@ -1322,3 +1481,69 @@ namespace UnitTest
     }
 #endif // ENABLE_PERFORMANCE_TEST
 }
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+namespace Benchmark
+{
+    class JobBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc desc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (unsigned int i = 0, numWorkerThreads = AZStd::thread::hardware_concurrency(); i < numWorkerThreads; ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+
+            m_jobManager = aznew AZ::JobManager(desc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+    };
+
+    // start state.range(0) empty jobs and wait for all of them, measures the scheduling overhead
+    BENCHMARK_DEFINE_F(JobBenchmarkFixture, BM_Job_StartAndWaitEmptyJobs)(::benchmark::State& state)
+    {
+        const int numJobs = static_cast<int>(state.range(0));
+        while (state.KeepRunning())
+        {
+            AZ::JobCompletion doneJob(m_jobContext);
+            for (int i = 0; i < numJobs; ++i)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([]() {}, true, m_jobContext);
+                job->SetDependent(&doneJob);
+                job->Start();
+            }
+            doneJob.StartAndWaitForCompletion();
+        }
+        state.SetItemsProcessed(state.iterations() * numJobs);
+    }
+    BENCHMARK_REGISTER_F(JobBenchmarkFixture, BM_Job_StartAndWaitEmptyJobs)
+        ->ArgName("Jobs")->Arg(1)->Arg(64)->Arg(1024)->Unit(::benchmark::kMicrosecond)->UseRealTime();
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
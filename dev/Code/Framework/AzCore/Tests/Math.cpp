@@ -27,6 +27,7 @@
 
 #include <AzCore/Math/Sfmt.h>
 #include <AzCore/Math/Uuid.h>
+#include <AzCore/Math/Random.h>
 
 #include <AzCore/std/containers/unordered_set.h>
 
@@ -5966,4 +5967,127 @@ namespace UnitTest
         EXPECT_NEAR(0.6, AZ::LerpInverse(1.0, 1.0 + 5.0 * epsilonD, 1.0 + 3.0 * epsilonD), epsilonD);
         EXPECT_NEAR(1.0, AZ::LerpInverse(1.0, 1.0 + 5.0 * epsilonD, 1.0 + 5.0 * epsilonD), epsilonD);
     }
-}
\ No newline at end of file
+}
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+namespace Benchmark
+{
+    class MathBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static const int NumValues = 1024;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            AZ::SimpleLcgRandom random;
+            m_vectors.resize(NumValues);
+            m_quaternions.resize(NumValues);
+            m_transforms.resize(NumValues);
+            for (int i = 0; i < NumValues; ++i)
+            {
+                m_vectors[i].Set(random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f);
+                m_quaternions[i] = AZ::Quaternion::CreateRotationZ(random.GetRandomFloat() * AZ::Constants::TwoPi);
+                m_transforms[i] = AZ::Transform::CreateFromQuaternionAndTranslation(m_quaternions[i], m_vectors[i]);
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_vectors.set_capacity(0);
+            m_quaternions.set_capacity(0);
+            m_transforms.set_capacity(0);
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZStd::vector<AZ::Vector3> m_vectors;
+        AZStd::vector<AZ::Quaternion> m_quaternions;
+        AZStd::vector<AZ::Transform> m_transforms;
+    };
+
+    BENCHMARK_F(MathBenchmarkFixture, BM_Vector3_GetNormalized)(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            for (const AZ::Vector3& v : m_vectors)
+            {
+                AZ::Vector3 result = v.GetNormalized();
+                ::benchmark::DoNotOptimize(result);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * NumValues);
+    }
+
+    BENCHMARK_F(MathBenchmarkFixture, BM_Vector3_Cross)(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            for (int i = 1; i < NumValues; ++i)
+            {
+                AZ::Vector3 result = m_vectors[i - 1].Cross(m_vectors[i]);
+                ::benchmark::DoNotOptimize(result);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * (NumValues - 1));
+    }
+
+    BENCHMARK_F(MathBenchmarkFixture, BM_Quaternion_Multiply)(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            for (int i = 1; i < NumValues; ++i)
+            {
+                AZ::Quaternion result = m_quaternions[i - 1] * m_quaternions[i];
+                ::benchmark::DoNotOptimize(result);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * (NumValues - 1));
+    }
+
+    BENCHMARK_F(MathBenchmarkFixture, BM_Transform_Multiply)(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            for (int i = 1; i < NumValues; ++i)
+            {
+                AZ::Transform result = m_transforms[i - 1] * m_transforms[i];
+                ::benchmark::DoNotOptimize(result);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * (NumValues - 1));
+    }
+
+    BENCHMARK_F(MathBenchmarkFixture, BM_Transform_TransformPoint)(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            for (int i = 0; i < NumValues; ++i)
+            {
+                AZ::Vector3 result = m_transforms[i] * m_vectors[i];
+                ::benchmark::DoNotOptimize(result);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * NumValues);
+    }
+
+    BENCHMARK_F(MathBenchmarkFixture, BM_Transform_GetInverseFull)(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            for (const AZ::Transform& tm : m_transforms)
+            {
+                AZ::Transform result = tm.GetInverseFull();
+                ::benchmark::DoNotOptimize(result);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * NumValues);
+    }
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,184 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include "TestTypes.h"
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/Quaternion.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    namespace
+    {
+        // 7 elements, so the kernels run one full batch and one padded tail
+        const size_t s_batchTestCount = 7;
+
+        Transform CreateTestTransform(size_t index)
+        {
+            const float f = static_cast<float>(index);
+            Transform t = Transform::CreateFromQuaternionAndTranslation(
+                Quaternion::CreateFromAxisAngle(Vector3(1.0f, 2.0f, 3.0f - f).GetNormalized(), 0.3f * f + 0.1f),
+                Vector3(f, -2.0f * f, 0.5f + f));
+            t.MultiplyByScale(Vector3(1.0f + 0.1f * f));
+            return t;
+        }
+    }
+
+    TEST(MATH_BatchMath, Vector3x4)
+    {
+        Vector3 v[4] = { Vector3(1.0f, 2.0f, 3.0f), Vector3(4.0f, 5.0f, 6.0f), Vector3(-1.0f, -2.0f, -3.0f), Vector3(0.5f, 0.0f, 7.0f) };
+        Vector3x4 v4 = Vector3x4::CreateFromVector3s(v);
+        EXPECT_TRUE(v4.GetX().IsClose(Vector4(1.0f, 4.0f, -1.0f, 0.5f)));
+        EXPECT_TRUE(v4.GetY().IsClose(Vector4(2.0f, 5.0f, -2.0f, 0.0f)));
+        EXPECT_TRUE(v4.GetZ().IsClose(Vector4(3.0f, 6.0f, -3.0f, 7.0f)));
+        EXPECT_TRUE(v4.GetVector3(1).IsClose(v[1]));
+
+        Vector3 sum[4];
+        (v4 + Vector3x4::CreateFromVector3(Vector3(1.0f))).StoreToVector3s(sum);
+        Vector4 dot = v4.Dot(v4);
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(sum[i].IsClose(v[i] + Vector3(1.0f)));
+            EXPECT_TRUE(dot.GetElement(i).IsClose(v[i].Dot(v[i])));
+        }
+    }
+
+    TEST(MATH_BatchMath, Transformx4)
+    {
+        Transform t[4];
+        Transform u[4];
+        for (size_t i = 0; i < 4; ++i)
+        {
+            t[i] = CreateTestTransform(i);
+            u[i] = CreateTestTransform(i + 4);
+        }
+        Transformx4 t4 = Transformx4::CreateFromTransforms(t);
+        Transform roundTrip[4];
+        t4.StoreToTransforms(roundTrip);
+
+        Transform product[4];
+        (t4 * Transformx4::CreateFromTransforms(u)).StoreToTransforms(product);
+
+        Vector3 p(1.0f, -3.0f, 2.0f);
+        Vector3 points[4];
+        t4.TransformPoint(Vector3x4::CreateFromVector3(p)).StoreToVector3s(points);
+        Vector3 vectors[4];
+        t4.Multiply3x3(Vector3x4::CreateFromVector3(p)).StoreToVector3s(vectors);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(roundTrip[i] == t[i]);
+            EXPECT_TRUE(product[i].IsClose(t[i] * u[i]));
+            EXPECT_TRUE(points[i].IsClose(t[i] * p));
+            EXPECT_TRUE(vectors[i].IsClose(t[i].Multiply3x3(p)));
+        }
+
+        Transform splat[4];
+        Transformx4::CreateFromTransform(t[2]).StoreToTransforms(splat);
+        EXPECT_TRUE(splat[0] == t[2]);
+        EXPECT_TRUE(splat[3] == t[2]);
+    }
+
+    TEST(MATH_BatchMath, TransformPoints)
+    {
+        Transform t = CreateTestTransform(3);
+        Vector3 points[s_batchTestCount];
+        Vector3 pointsOut[s_batchTestCount];
+        for (size_t i = 0; i < s_batchTestCount; ++i)
+        {
+            points[i] = Vector3(static_cast<float>(i), 1.0f, -2.0f * static_cast<float>(i));
+        }
+        TransformPoints(t, points, pointsOut, s_batchTestCount);
+        for (size_t i = 0; i < s_batchTestCount; ++i)
+        {
+            EXPECT_TRUE(pointsOut[i].IsClose(t * points[i]));
+        }
+
+        // in place
+        TransformPoints(t, points, points, s_batchTestCount);
+        for (size_t i = 0; i < s_batchTestCount; ++i)
+        {
+            EXPECT_TRUE(points[i].IsClose(pointsOut[i]));
+        }
+    }
+
+    TEST(MATH_BatchMath, MultiplyTransforms)
+    {
+        Transform parent = CreateTestTransform(2);
+        Transform lhs[s_batchTestCount];
+        Transform rhs[s_batchTestCount];
+        Transform out[s_batchTestCount];
+        for (size_t i = 0; i < s_batchTestCount; ++i)
+        {
+            lhs[i] = CreateTestTransform(i);
+            rhs[i] = CreateTestTransform(i + 1);
+        }
+
+        MultiplyTransforms(parent, rhs, out, s_batchTestCount);
+        for (size_t i = 0; i < s_batchTestCount; ++i)
+        {
+            EXPECT_TRUE(out[i].IsClose(parent * rhs[i]));
+        }
+
+        MultiplyTransforms(lhs, rhs, out, s_batchTestCount);
+        for (size_t i = 0; i < s_batchTestCount; ++i)
+        {
+            EXPECT_TRUE(out[i].IsClose(lhs[i] * rhs[i]));
+        }
+
+        // only the first count transforms are written
+        out[5] = Transform::CreateIdentity();
+        MultiplyTransforms(lhs, rhs, out, 5);
+        EXPECT_TRUE(out[5] == Transform::CreateIdentity());
+    }
+
+    TEST(MATH_BatchMath, Aabbs)
+    {
+        Transform transforms[s_batchTestCount];
+        Aabb aabbs[s_batchTestCount];
+        Aabb aabbsOut[s_batchTestCount];
+        for (size_t i = 0; i < s_batchTestCount; ++i)
+        {
+            const float f = static_cast<float>(i);
+            transforms[i] = CreateTestTransform(i);
+            aabbs[i] = Aabb::CreateFromMinMax(Vector3(-f, 0.0f, 1.0f), Vector3(1.0f, f, 2.0f + f));
+        }
+
+        TransformAabbs(transforms[1], aabbs, aabbsOut, s_batchTestCount);
+        for (size_t i = 0; i < s_batchTestCount; ++i)
+        {
+            const Aabb expected = aabbs[i].GetTransformedAabb(transforms[1]);
+            EXPECT_TRUE(aabbsOut[i].GetMin().IsClose(expected.GetMin()));
+            EXPECT_TRUE(aabbsOut[i].GetMax().IsClose(expected.GetMax()));
+        }
+
+        TransformAabbs(transforms, aabbs, aabbsOut, s_batchTestCount);
+        for (size_t i = 0; i < s_batchTestCount; ++i)
+        {
+            const Aabb expected = aabbs[i].GetTransformedAabb(transforms[i]);
+            EXPECT_TRUE(aabbsOut[i].GetMin().IsClose(expected.GetMin()));
+            EXPECT_TRUE(aabbsOut[i].GetMax().IsClose(expected.GetMax()));
+        }
+
+        Aabb expectedUnion = Aabb::CreateNull();
+        for (size_t i = 0; i < s_batchTestCount; ++i)
+        {
+            expectedUnion.AddAabb(aabbs[i]);
+        }
+        const Aabb aabbUnion = GetAabbUnion(aabbs, s_batchTestCount);
+        EXPECT_TRUE(aabbUnion.GetMin().IsClose(expectedUnion.GetMin()));
+        EXPECT_TRUE(aabbUnion.GetMax().IsClose(expectedUnion.GetMax()));
+        EXPECT_FALSE(GetAabbUnion(aabbs, 0).IsValid());
+    }
+}
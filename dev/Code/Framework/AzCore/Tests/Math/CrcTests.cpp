@@ -0,0 +1,86 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include "TestTypes.h"
+
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/containers/vector.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    namespace
+    {
+        // bit by bit CRC-32, slow but obviously right
+        u32 ReferenceCrc32(const u8* data, size_t size, bool forceLowerCase)
+        {
+            u32 crc = 0xffffffff;
+            for (size_t i = 0; i < size; ++i)
+            {
+                u8 c = data[i];
+                if (forceLowerCase && c >= 'A' && c <= 'Z')
+                {
+                    c = static_cast<u8>(c + 'a' - 'A');
+                }
+                crc ^= c;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    crc = (crc >> 1) ^ (0xedb88320 & (0u - (crc & 1)));
+                }
+            }
+            return crc ^ 0xffffffff;
+        }
+    }
+
+    class CrcTests
+        : public AllocatorsFixture
+    {
+    };
+
+    TEST_F(CrcTests, KnownValues)
+    {
+        EXPECT_EQ(0xcbf43926, static_cast<u32>(Crc32("123456789", 9, false)));
+        EXPECT_EQ(0x73887d3a, static_cast<u32>(Crc32("ZLib")));
+        EXPECT_EQ(0u, static_cast<u32>(Crc32("")));
+    }
+
+    TEST_F(CrcTests, LongUnalignedData_MatchesReference)
+    {
+        AZStd::vector<u8> data(300);
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<u8>(i * 131 + 7);
+        }
+
+        // every alignment and a mix of full 8 byte blocks and tails
+        for (size_t offset = 0; offset < 8; ++offset)
+        {
+            for (size_t size = 1; size < 100; ++size)
+            {
+                EXPECT_EQ(ReferenceCrc32(&data[offset], size, false), static_cast<u32>(Crc32(&data[offset], size, false)));
+                EXPECT_EQ(ReferenceCrc32(&data[offset], size, true), static_cast<u32>(Crc32(&data[offset], size, true)));
+            }
+        }
+    }
+
+    TEST_F(CrcTests, Add_MatchesWholeData)
+    {
+        const char text[] = "Some/Longer/Path/To/An/Asset.With.Extension";
+        const size_t length = sizeof(text) - 1;
+
+        Crc32 crc;
+        crc.Add(text, 20, false);
+        crc.Add(text + 20, length - 20, false);
+        EXPECT_EQ(Crc32(text, length, false), crc);
+    }
+}
@@ -14,12 +14,15 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Memory/BestFitExternalMapAllocator.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/HeapSchema.h>
 #include <AzCore/Memory/HphaSchema.h>
 
 #include <AzCore/Driller/Driller.h>
 #include <AzCore/Memory/MemoryDriller.h>
 #include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/AllocationSnapshot.h>
+#include <AzCore/Memory/AllocatorManager.h>
 #include <AzCore/Debug/StackTracer.h>
 
 #include <AzCore/std/parallel/thread.h>
@@ -291,6 +294,171 @@ namespace UnitTest
         run();
     }
 
+    TEST_F(MemoryTrackingFixture, SystemAllocatorThreadCache_AllocationsFromThreads_AreRecorded)
+    {
+        SystemAllocator::Descriptor desc;
+        desc.m_heap.m_isThreadCache = true;
+        desc.m_allocationRecords = true;
+        AllocatorInstance<SystemAllocator>::Create(desc);
+        SystemAllocator& sysAlloc = AllocatorInstance<SystemAllocator>::Get();
+
+        static const int numThreads = 4;
+        static const int numAllocations = 1000;
+        void* addresses[numThreads][numAllocations] = { { nullptr } };
+        AZStd::thread threads[numThreads];
+        for (int t = 0; t < numThreads; ++t)
+        {
+            threads[t] = AZStd::thread([&sysAlloc, &addresses, t]()
+            {
+                for (int i = 0; i < numAllocations; ++i)
+                {
+                    // free and reallocate some of the allocations, so they go through the thread cache
+                    const AZStd::size_t size = 1 + (i * 7 + t) % 200;
+                    addresses[t][i] = sysAlloc.Allocate(size, 8, 0, "Thread cache test", __FILE__, __LINE__);
+                    memset(addresses[t][i], t, size);
+                    if (i % 3 == 0)
+                    {
+                        sysAlloc.DeAllocate(addresses[t][i], size, 8);
+                        addresses[t][i] = sysAlloc.Allocate(size, 8, 0, "Thread cache test", __FILE__, __LINE__);
+                        memset(addresses[t][i], t, size);
+                    }
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        if (sysAlloc.GetRecords())
+        {
+            AZStd::lock_guard<AZ::Debug::AllocationRecords> lock(*sysAlloc.GetRecords());
+            EXPECT_EQ(numThreads * numAllocations, sysAlloc.GetRecords()->GetMap().size());
+        }
+
+        // free from another thread than the one that allocated
+        for (int t = 0; t < numThreads; ++t)
+        {
+            for (int i = 0; i < numAllocations; ++i)
+            {
+                EXPECT_EQ(t, *reinterpret_cast<unsigned char*>(addresses[t][i]));
+                sysAlloc.DeAllocate(addresses[t][i]);
+            }
+        }
+
+        if (sysAlloc.GetRecords())
+        {
+            AZStd::lock_guard<AZ::Debug::AllocationRecords> lock(*sysAlloc.GetRecords());
+            EXPECT_TRUE(sysAlloc.GetRecords()->GetMap().empty());
+        }
+
+        sysAlloc.GarbageCollect();
+        AllocatorInstance<SystemAllocator>::Destroy();
+    }
+
+    TEST_F(MemoryTrackingFixture, AllocationSnapshot_Diff_GroupsNewAllocationsByCallstack)
+    {
+        SystemAllocator::Descriptor desc;
+        desc.m_allocationRecords = true;
+        AllocatorInstance<SystemAllocator>::Create(desc);
+        SystemAllocator& sysAlloc = AllocatorInstance<SystemAllocator>::Get();
+        if (!sysAlloc.GetRecords())
+        {
+            AllocatorInstance<SystemAllocator>::Destroy();
+            return; // no records in this build
+        }
+
+        void* kept = sysAlloc.Allocate(64, 8, 0, "Kept", __FILE__, __LINE__);
+        void* freed = sysAlloc.Allocate(32, 8, 0, "Freed", __FILE__, __LINE__);
+
+        Debug::AllocationSnapshot before;
+        before.Capture();
+
+        sysAlloc.DeAllocate(freed);
+        static const int numLeaks = 10;
+        void* leaks[numLeaks];
+        for (int i = 0; i < numLeaks; ++i)
+        {
+            leaks[i] = sysAlloc.Allocate(128, 8, 0, "Leak", __FILE__, __LINE__);
+        }
+        void* other = sysAlloc.Allocate(16, 8, 0, "Other", __FILE__, __LINE__);
+
+        Debug::AllocationSnapshot after;
+        after.Capture();
+
+        Debug::AllocationSnapshotDiff diff;
+        Debug::AllocationSnapshot::Diff(before, after, diff);
+        EXPECT_EQ(numLeaks + 1, diff.m_numNewAllocations);
+        EXPECT_EQ(numLeaks * 128 + 16, diff.m_newBytes);
+        EXPECT_EQ(1, diff.m_numFreedAllocations);
+        EXPECT_EQ(32, diff.m_freedBytes);
+        ASSERT_EQ(2, diff.m_groups.size());
+        EXPECT_EQ(numLeaks, diff.m_groups[0].m_numAllocations);
+        EXPECT_EQ(numLeaks * 128, diff.m_groups[0].m_byteSize);
+        EXPECT_EQ(1, diff.m_groups[1].m_numAllocations);
+        EXPECT_STREQ(sysAlloc.GetName(), diff.m_groups[0].m_allocatorName);
+
+        // nothing changed
+        Debug::AllocationSnapshot::Diff(after, after, diff);
+        EXPECT_EQ(0, diff.m_numNewAllocations);
+        EXPECT_EQ(0, diff.m_numFreedAllocations);
+        EXPECT_TRUE(diff.m_groups.empty());
+
+        for (void* leak : leaks)
+        {
+            sysAlloc.DeAllocate(leak);
+        }
+        sysAlloc.DeAllocate(other);
+        sysAlloc.DeAllocate(kept);
+        AllocatorInstance<SystemAllocator>::Destroy();
+    }
+
+    TEST_F(MemoryTrackingFixture, AllocatorManager_MemoryBudgets_ReportLimits)
+    {
+        AllocatorInstance<SystemAllocator>::Create();
+        SystemAllocator& sysAlloc = AllocatorInstance<SystemAllocator>::Get();
+        AllocatorManager& manager = AllocatorManager::Instance();
+
+        const size_t baseBytes = sysAlloc.NumAllocatedBytes();
+        const size_t softLimit = baseBytes + 64 * 1024;
+        const size_t hardLimit = baseBytes + 256 * 1024;
+        EXPECT_TRUE(manager.AddMemoryBudget("TestBudget", sysAlloc.GetName(), softLimit, hardLimit));
+        EXPECT_TRUE(manager.AddMemoryBudget("TestBudget", sysAlloc.GetName(), softLimit, hardLimit)); // same allocator is only added once
+
+        AllocatorManager::MemoryBudget budget;
+        ASSERT_TRUE(manager.GetMemoryBudget(manager.GetNumMemoryBudgets() - 1, budget));
+        EXPECT_STREQ("TestBudget", budget.m_name);
+        EXPECT_EQ(1, budget.m_numAllocators);
+
+        manager.UpdateMemoryBudgets();
+        manager.GetMemoryBudget(manager.GetNumMemoryBudgets() - 1, budget);
+        EXPECT_EQ(AllocatorManager::MemoryBudget::BUDGET_OK, budget.m_state);
+
+        void* soft = sysAlloc.Allocate(128 * 1024, 16);
+        manager.UpdateMemoryBudgets();
+        manager.GetMemoryBudget(manager.GetNumMemoryBudgets() - 1, budget);
+        EXPECT_EQ(AllocatorManager::MemoryBudget::BUDGET_OVER_SOFT_LIMIT, budget.m_state);
+        EXPECT_GE(budget.m_allocatedBytes, baseBytes + 128 * 1024);
+
+        void* hard = sysAlloc.Allocate(256 * 1024, 16);
+        AZ_TEST_START_ASSERTTEST;
+        manager.UpdateMemoryBudgets();
+        manager.UpdateMemoryBudgets(); // only reported once
+        AZ_TEST_STOP_ASSERTTEST(1);
+        manager.GetMemoryBudget(manager.GetNumMemoryBudgets() - 1, budget);
+        EXPECT_EQ(AllocatorManager::MemoryBudget::BUDGET_OVER_HARD_LIMIT, budget.m_state);
+
+        sysAlloc.DeAllocate(hard);
+        sysAlloc.DeAllocate(soft);
+        manager.UpdateMemoryBudgets();
+        manager.GetMemoryBudget(manager.GetNumMemoryBudgets() - 1, budget);
+        EXPECT_EQ(AllocatorManager::MemoryBudget::BUDGET_OK, budget.m_state);
+        EXPECT_GE(budget.m_peakBytes, baseBytes + 384 * 1024);
+
+        manager.RemoveMemoryBudget("TestBudget");
+        AllocatorInstance<SystemAllocator>::Destroy();
+    }
+
     class PoolAllocatorTest
         : public MemoryTrackingFixture
     {
@@ -863,6 +1031,124 @@ namespace UnitTest
         AllocatorInstance<SystemAllocator>::Destroy();
     }
 
+    class FrameArenaAllocatorTest
+        : public MemoryTrackingFixture
+    {
+    public:
+        void SetUp() override
+        {
+            MemoryTrackingFixture::SetUp();
+            AllocatorInstance<SystemAllocator>::Create();
+
+            FrameArenaAllocator::Descriptor desc;
+            desc.m_regionSize = 4 * 1024;
+            desc.m_maxNumThreads = 2;
+            desc.m_isPoisonMemory = true;
+            AllocatorInstance<FrameArenaAllocator>::Create(desc);
+        }
+
+        void TearDown() override
+        {
+            AllocatorInstance<FrameArenaAllocator>::Destroy();
+            AllocatorInstance<SystemAllocator>::Destroy();
+            MemoryTrackingFixture::TearDown();
+        }
+    };
+
+    TEST_F(FrameArenaAllocatorTest, AllocateAndReset_ReusesRegion)
+    {
+        FrameArenaAllocator& frameAlloc = AllocatorInstance<FrameArenaAllocator>::Get();
+
+        char* first = reinterpret_cast<char*>(frameAlloc.Allocate(100, 16));
+        char* second = reinterpret_cast<char*>(frameAlloc.Allocate(10, 64));
+        ASSERT_NE(nullptr, first);
+        ASSERT_NE(nullptr, second);
+        EXPECT_EQ(0, ((size_t)first & 15));  // check alignment
+        EXPECT_EQ(0, ((size_t)second & 63));
+        EXPECT_GE(second, first + 100);
+        EXPECT_GE(frameAlloc.NumAllocatedBytes(), 110);
+
+        // only the last allocation can be given back
+        frameAlloc.DeAllocate(second, 10, 64);
+        char* third = reinterpret_cast<char*>(frameAlloc.Allocate(10, 64));
+        EXPECT_EQ(second, third);
+        frameAlloc.DeAllocate(first, 100, 16);
+        EXPECT_GE(frameAlloc.NumAllocatedBytes(), 110);
+
+        memset(first, 1, 100);
+        frameAlloc.ResetFrame();
+        EXPECT_EQ(1, frameAlloc.GetFrameId());
+        char* next = reinterpret_cast<char*>(frameAlloc.Allocate(100, 16));
+        EXPECT_EQ(first, next);
+        EXPECT_EQ(100, frameAlloc.NumAllocatedBytes());
+        EXPECT_EQ(0xcd, static_cast<unsigned char>(next[0])); // released memory is poisoned
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Overflow_GrowsRegionOnNextFrame)
+    {
+        FrameArenaAllocator& frameAlloc = AllocatorInstance<FrameArenaAllocator>::Get();
+
+        char* first = reinterpret_cast<char*>(frameAlloc.Allocate(3 * 1024, 16));
+        char* overflow = reinterpret_cast<char*>(frameAlloc.Allocate(3 * 1024, 16));
+        ASSERT_NE(nullptr, overflow);
+        EXPECT_TRUE(overflow < first || overflow >= first + 4 * 1024);
+        memset(overflow, 1, 3 * 1024);
+
+        // after the reset both allocations fit in the region
+        frameAlloc.ResetFrame();
+        char* regionStart = reinterpret_cast<char*>(frameAlloc.Allocate(3 * 1024, 16));
+        char* regionNext = reinterpret_cast<char*>(frameAlloc.Allocate(3 * 1024, 16));
+        EXPECT_EQ(regionStart + 3 * 1024, regionNext);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Containers_GrowLastAllocationInPlace)
+    {
+        AZStd::vector<int, FrameArenaStdAllocator> values;
+        values.reserve(4);
+        const int* data = values.data();
+        for (int i = 0; i < 64; ++i)
+        {
+            values.push_back(i);
+        }
+        EXPECT_EQ(data, values.data());
+        EXPECT_EQ(63, values.back());
+
+        int captured[32] = { 5 };
+        AZStd::function<int()> func([captured]() { return captured[0]; }, FrameArenaStdAllocator());
+        EXPECT_EQ(5, func());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Threads_AllocateFromOwnRegions)
+    {
+        FrameArenaAllocator& frameAlloc = AllocatorInstance<FrameArenaAllocator>::Get();
+        const int numThreads = 4; // more than m_maxNumThreads, the extra threads share a region
+        AZStd::atomic_int failed(0);
+
+        AZStd::vector<AZStd::thread> threads;
+        for (int i = 0; i < numThreads; ++i)
+        {
+            threads.emplace_back([&frameAlloc, &failed, i]()
+            {
+                for (int j = 0; j < 1000; ++j)
+                {
+                    unsigned char* ptr = reinterpret_cast<unsigned char*>(frameAlloc.Allocate(32, 8));
+                    memset(ptr, i, 32);
+                    AZStd::this_thread::yield();
+                    if (ptr[0] != i || ptr[31] != i)
+                    {
+                        ++failed;
+                    }
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        EXPECT_EQ(0, failed);
+        EXPECT_EQ(numThreads * 1000 * 32, frameAlloc.NumAllocatedBytes());
+    }
+
     /**
      * Tests azmalloc,azmallocex/azfree.
      */
@@ -2668,3 +2954,68 @@ namespace UnitTest
 }
 
 // GlobalNewDeleteTest-End
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+namespace Benchmark
+{
+    const int kNumAllocations = 1024;
+
+    class AllocatorBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            m_addresses.resize(kNumAllocations);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_addresses.set_capacity(0);
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        /// Allocates kNumAllocations blocks of state.range(0) bytes and frees them in the same order
+        template <class Allocator>
+        void AllocateAndFree(::benchmark::State& state)
+        {
+            Allocator& allocator = AZ::AllocatorInstance<Allocator>::Get();
+            const size_t size = static_cast<size_t>(state.range(0));
+            while (state.KeepRunning())
+            {
+                for (void*& address : m_addresses)
+                {
+                    address = allocator.Allocate(size, 8);
+                }
+                for (void* address : m_addresses)
+                {
+                    allocator.DeAllocate(address, size, 8);
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * kNumAllocations);
+        }
+
+        AZStd::vector<void*> m_addresses;
+    };
+
+    BENCHMARK_DEFINE_F(AllocatorBenchmarkFixture, BM_SystemAllocator_AllocateFree)(::benchmark::State& state)
+    {
+        AllocateAndFree<AZ::SystemAllocator>(state);
+    }
+    BENCHMARK_REGISTER_F(AllocatorBenchmarkFixture, BM_SystemAllocator_AllocateFree)
+        ->ArgName("Size")->Arg(16)->Arg(256)->Arg(4096);
+
+    BENCHMARK_DEFINE_F(AllocatorBenchmarkFixture, BM_PoolAllocator_AllocateFree)(::benchmark::State& state)
+    {
+        AllocateAndFree<AZ::PoolAllocator>(state);
+    }
+    BENCHMARK_REGISTER_F(AllocatorBenchmarkFixture, BM_PoolAllocator_AllocateFree)
+        ->ArgName("Size")->Arg(16)->Arg(64)->Arg(256);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
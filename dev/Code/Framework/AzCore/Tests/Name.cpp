@@ -0,0 +1,128 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Name/Name.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/thread.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    class NameTest
+        : public AllocatorsTestFixture
+    {
+    };
+
+    TEST_F(NameTest, DefaultConstructed_IsEmpty)
+    {
+        Name name;
+        EXPECT_TRUE(name.IsEmpty());
+        EXPECT_TRUE(name.GetStringView().empty());
+        EXPECT_STREQ("", name.GetCStr());
+        EXPECT_EQ(0u, name.GetHash());
+        EXPECT_EQ(Name(""), name);
+    }
+
+    TEST_F(NameTest, SameString_SharesEntry)
+    {
+        AZStd::string text = "SomeParameter";
+        Name a(text);
+        Name b("SomeParameter");
+
+        EXPECT_EQ(a, b);
+        EXPECT_EQ(a.GetCStr(), b.GetCStr());
+        EXPECT_EQ(AZStd::string_view("SomeParameter"), a.GetStringView());
+
+        // the name doesn't depend on the source string staying alive
+        text = "Changed";
+        EXPECT_STREQ("SomeParameter", a.GetCStr());
+    }
+
+    TEST_F(NameTest, DifferentStrings_AreNotEqual)
+    {
+        EXPECT_NE(Name("Speed"), Name("SpeedX"));
+        EXPECT_NE(Name("Speed"), Name());
+        // names are case sensitive even though their hash matches AZ_CRC
+        EXPECT_NE(Name("speed"), Name("Speed"));
+        EXPECT_EQ(Name("speed").GetHash(), Name("Speed").GetHash());
+    }
+
+    TEST_F(NameTest, Hash_MatchesCrc32)
+    {
+        EXPECT_EQ(static_cast<u32>(AZ_CRC("Grass", 0xa80d9ff3)), Name("Grass").GetHash());
+
+        AZStd::unordered_map<Name, int> map;
+        map[Name("Grass")] = 1;
+        map[Name("Rock")] = 2;
+        EXPECT_EQ(1, map[Name("Grass")]);
+        EXPECT_EQ(2, map[Name("Rock")]);
+        EXPECT_EQ(2u, map.size());
+    }
+
+    TEST_F(NameTest, CreateFromThreads_SameEntries)
+    {
+        const int threadCount = 8;
+        const int nameCount = 1000;
+
+        AZStd::vector<const char*> results[threadCount];
+        AZStd::thread threads[threadCount];
+        for (int t = 0; t < threadCount; ++t)
+        {
+            threads[t] = AZStd::thread([&results, t]()
+            {
+                results[t].reserve(nameCount);
+                for (int i = 0; i < nameCount; ++i)
+                {
+                    results[t].push_back(Name(AZStd::string::format("ThreadedName%d", i)).GetCStr());
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (int i = 0; i < nameCount; ++i)
+        {
+            const char* expected = Name(AZStd::string::format("ThreadedName%d", i)).GetCStr();
+            for (int t = 0; t < threadCount; ++t)
+            {
+                EXPECT_EQ(expected, results[t][i]);
+            }
+        }
+    }
+
+    TEST_F(NameTest, Serialize_RoundTripsAsString)
+    {
+        SerializeContext context;
+        Name::Reflect(&context);
+
+        const Name source("SurfaceTag");
+        Name loaded;
+
+        AZStd::vector<char> buffer;
+        IO::ByteContainerStream<AZStd::vector<char> > stream(&buffer);
+        ASSERT_TRUE(Utils::SaveObjectToStream(stream, DataStream::ST_XML, &source, &context));
+
+        // stored as readable text
+        const AZStd::string xml(buffer.begin(), buffer.end());
+        EXPECT_NE(AZStd::string::npos, xml.find("SurfaceTag"));
+
+        stream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+        ASSERT_TRUE(Utils::LoadObjectFromStreamInPlace(stream, loaded, &context));
+        EXPECT_EQ(source, loaded);
+    }
+}
@@ -985,5 +985,88 @@ namespace UnitTest
             azdestroy(patchedTargetObj->m_pointerFloat);
             delete patchedTargetObj;
         }
+
+        TEST_F(PatchingTest, UpdateDirtyAddresses_MatchesFullPatch)
+        {
+            ObjectToPatch sourceObj;
+            sourceObj.m_objectArray.resize(10);
+            for (size_t i = 0; i < sourceObj.m_objectArray.size(); ++i)
+            {
+                sourceObj.m_objectArray[i].m_persistentId = static_cast<u64>(i + 10);
+                sourceObj.m_objectArray[i].m_data = static_cast<int>(i + 200);
+            }
+
+            ObjectToPatch targetObj;
+            targetObj.m_objectArray = sourceObj.m_objectArray;
+            targetObj.m_objectArray[3].m_data = 1;
+
+            DataPatch patch;
+            patch.Create(&sourceObj, &targetObj, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get());
+
+            // Edit another element and a member, then only diff what changed.
+            targetObj.m_objectArray[5].m_data = 2;
+            targetObj.m_intValue = 3;
+
+            DataPatch::AddressType elementAddress;
+            elementAddress.push_back(AZ_CRC("m_objectArray"));
+            elementAddress.push_back(targetObj.m_objectArray[5].m_persistentId);
+            DataPatch::AddressType intAddress;
+            intAddress.push_back(AZ_CRC("m_intValue"));
+
+            EXPECT_TRUE(patch.Update(&sourceObj, &targetObj, { elementAddress, intAddress }, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get()));
+
+            AZStd::unique_ptr<ObjectToPatch> generatedObj(patch.Apply(&sourceObj, m_serializeContext.get()));
+            ASSERT_TRUE(generatedObj);
+            EXPECT_EQ(3, generatedObj->m_intValue);
+            ASSERT_EQ(targetObj.m_objectArray.size(), generatedObj->m_objectArray.size());
+            for (size_t i = 0; i < generatedObj->m_objectArray.size(); ++i)
+            {
+                EXPECT_EQ(targetObj.m_objectArray[i].m_persistentId, generatedObj->m_objectArray[i].m_persistentId);
+                EXPECT_EQ(targetObj.m_objectArray[i].m_data, generatedObj->m_objectArray[i].m_data);
+            }
+
+            // Reverting the edits and marking them dirty leaves nothing to patch.
+            targetObj.m_objectArray = sourceObj.m_objectArray;
+            targetObj.m_intValue = sourceObj.m_intValue;
+
+            DataPatch::AddressType firstEditAddress;
+            firstEditAddress.push_back(AZ_CRC("m_objectArray"));
+            firstEditAddress.push_back(targetObj.m_objectArray[3].m_persistentId);
+
+            EXPECT_TRUE(patch.Update(&sourceObj, &targetObj, { firstEditAddress, elementAddress, intAddress }, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get()));
+            EXPECT_FALSE(patch.IsData());
+        }
+
+        TEST_F(PatchingTest, UpdateDirtyAddresses_RemovedElement_RecordsRemoval)
+        {
+            ObjectToPatch sourceObj;
+            sourceObj.m_objectArray.resize(3);
+            for (size_t i = 0; i < sourceObj.m_objectArray.size(); ++i)
+            {
+                sourceObj.m_objectArray[i].m_persistentId = static_cast<u64>(i + 10);
+                sourceObj.m_objectArray[i].m_data = static_cast<int>(i + 200);
+            }
+
+            ObjectToPatch targetObj;
+            targetObj.m_objectArray = sourceObj.m_objectArray;
+
+            DataPatch patch;
+            patch.Create(&sourceObj, &targetObj, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get());
+            EXPECT_FALSE(patch.IsData());
+
+            DataPatch::AddressType removedAddress;
+            removedAddress.push_back(AZ_CRC("m_objectArray"));
+            removedAddress.push_back(targetObj.m_objectArray[1].m_persistentId);
+            targetObj.m_objectArray.erase(targetObj.m_objectArray.begin() + 1);
+
+            EXPECT_TRUE(patch.Update(&sourceObj, &targetObj, { removedAddress }, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get()));
+            EXPECT_TRUE(patch.IsData());
+
+            AZStd::unique_ptr<ObjectToPatch> generatedObj(patch.Apply(&sourceObj, m_serializeContext.get()));
+            ASSERT_TRUE(generatedObj);
+            ASSERT_EQ(2, generatedObj->m_objectArray.size());
+            EXPECT_EQ(10, generatedObj->m_objectArray[0].m_persistentId);
+            EXPECT_EQ(12, generatedObj->m_objectArray[1].m_persistentId);
+        }
     }
-}
\ No newline at end of file
+}
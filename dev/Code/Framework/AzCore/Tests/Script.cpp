@@ -39,6 +39,10 @@
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetManagerComponent.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
 namespace UnitTest
 {
     using namespace AZ;
@@ -4384,4 +4388,48 @@ ramenShop.handler:Connect(4);
 }
 
 
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    static AZ::Transform BenchmarkGetTransform(float x)
+    {
+        return AZ::Transform::CreateTranslation(AZ::Vector3(x, 0.0f, 0.0f));
+    }
+
+    // Measures the Lua to C++ call overhead of reflected methods, by calling them from a Lua loop
+    static void BM_Script_CallReflectedMethods(::benchmark::State& state, const char* loopBody)
+    {
+        AZ::BehaviorContext behaviorContext;
+        AZ::MathReflect(&behaviorContext);
+        behaviorContext.Method("BenchmarkGetTransform", &BenchmarkGetTransform);
+
+        AZ::ScriptContext scriptContext;
+        scriptContext.BindTo(&behaviorContext);
+
+        AZStd::string script = AZStd::string::format(
+            "local tm = BenchmarkGetTransform(0)\n"
+            "function RunBenchmark(count)\n"
+            "    for i = 1, count do\n"
+            "        %s\n"
+            "    end\n"
+            "end\n", loopBody);
+        scriptContext.Execute(script.c_str());
+
+        lua_State* lua = scriptContext.NativeContext();
+        while (state.KeepRunning())
+        {
+            lua_getglobal(lua, "RunBenchmark");
+            lua_pushinteger(lua, state.range(0));
+            lua_pcall(lua, 1, 0, 0);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_CAPTURE(BM_Script_CallReflectedMethods, GlobalMethodWithResult, "local result = BenchmarkGetTransform(i)")->Arg(1000);
+    BENCHMARK_CAPTURE(BM_Script_CallReflectedMethods, MemberMethodWithResult, "local result = tm:GetTranslation()")->Arg(1000);
+    BENCHMARK_CAPTURE(BM_Script_CallReflectedMethods, MemberMethodWithArgument, "tm:SetTranslation(Vector3(i, 0, 0))")->Arg(1000);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
+
 #endif // #if !defined(AZCORE_EXCLUDE_LUA)
@@ -4018,6 +4018,40 @@ namespace UnitTest
             AZStd::unordered_map<int, float*> m_mapOfFloatPointers;
             AZStd::shared_ptr<AZ::Entity> m_sharedEntityPointer;
         };
+
+        struct ClonablePlainValues
+        {
+            AZ_TYPE_INFO(ClonablePlainValues, "{5B9A3E21-7C04-4F4B-9E43-2D7C5E0A8B61}");
+            AZ_CLASS_ALLOCATOR(ClonablePlainValues, AZ::SystemAllocator, 0);
+
+            enum class Mode : AZ::u8
+            {
+                Off,
+                On,
+            };
+
+            static void Reflect(SerializeContext& serializeContext)
+            {
+                serializeContext.Class<ClonablePlainValues>()
+                    ->Field("m_int", &ClonablePlainValues::m_int)
+                    ->Field("m_float", &ClonablePlainValues::m_float)
+                    ->Field("m_text", &ClonablePlainValues::m_text)
+                    ->Field("m_values", &ClonablePlainValues::m_values)
+                    ->Field("m_child", &ClonablePlainValues::m_child)
+                    ->Field("m_mode", &ClonablePlainValues::m_mode)
+                    ->Field("m_flag", &ClonablePlainValues::m_flag)
+                    ;
+            }
+
+            int m_int = 0;
+            float m_float = 0.0f;
+            AZStd::string m_text;
+            AZStd::vector<int> m_values;
+            ClonablePlainValues* m_child = nullptr;
+            Mode m_mode = Mode::Off;
+            bool m_flag = false;
+            int m_notReflected = 0;
+        };
     }
     TEST_F(Serialization, CloneTest)
     {
@@ -4160,6 +4194,54 @@ namespace UnitTest
         delete cloneObj;
     }
 
+    TEST_F(Serialization, ClonePlainValues_CopiedWithTheirClass)
+    {
+        using namespace Clone;
+
+        ClonablePlainValues::Reflect(*m_serializeContext);
+
+        // m_int and m_float are adjacent and share a range, m_mode and m_flag share the other one.
+        const SerializeContext::ClassData* classData = m_serializeContext->FindClassData(azrtti_typeid<ClonablePlainValues>());
+        ASSERT_NE(nullptr, classData);
+        EXPECT_EQ(2, classData->m_plainValueRanges.size());
+
+        ClonablePlainValues testObj;
+        testObj.m_int = 7;
+        testObj.m_float = 2.5f;
+        testObj.m_text = "text";
+        testObj.m_values = { 1, 2, 3 };
+        testObj.m_mode = ClonablePlainValues::Mode::On;
+        testObj.m_flag = true;
+        testObj.m_notReflected = 11;
+        testObj.m_child = aznew ClonablePlainValues();
+        testObj.m_child->m_int = 8;
+        testObj.m_child->m_flag = true;
+
+        ClonablePlainValues* cloneObj = m_serializeContext->CloneObject(&testObj);
+        ASSERT_NE(nullptr, cloneObj);
+        EXPECT_EQ(testObj.m_int, cloneObj->m_int);
+        EXPECT_EQ(testObj.m_float, cloneObj->m_float);
+        EXPECT_EQ(testObj.m_text, cloneObj->m_text);
+        EXPECT_EQ(testObj.m_values, cloneObj->m_values);
+        EXPECT_EQ(testObj.m_mode, cloneObj->m_mode);
+        EXPECT_EQ(testObj.m_flag, cloneObj->m_flag);
+        EXPECT_EQ(0, cloneObj->m_notReflected);
+        ASSERT_NE(nullptr, cloneObj->m_child);
+        EXPECT_NE(testObj.m_child, cloneObj->m_child);
+        EXPECT_EQ(8, cloneObj->m_child->m_int);
+        EXPECT_TRUE(cloneObj->m_child->m_flag);
+        EXPECT_EQ(nullptr, cloneObj->m_child->m_child);
+
+        ClonablePlainValues inplaceObj;
+        m_serializeContext->CloneObjectInplace(inplaceObj, testObj.m_child);
+        EXPECT_EQ(8, inplaceObj.m_int);
+        EXPECT_TRUE(inplaceObj.m_flag);
+
+        delete cloneObj->m_child;
+        delete cloneObj;
+        delete testObj.m_child;
+    }
+
     struct TestCloneAssetData
         : public AZ::Data::AssetData
     {
@@ -8125,6 +8207,67 @@ namespace UnitTest
         EXPECT_EQ(ClassThatAllocatesMemoryInDefaultCtor::InstanceTracker::s_instanceCount, 0);
     }
 
+    class BinaryValuesHolder
+    {
+    public:
+        AZ_TYPE_INFO(BinaryValuesHolder, "{0D4C9E2A-7B6B-4A8E-9C39-6A3A1F1E5D27}");
+        AZ_CLASS_ALLOCATOR(BinaryValuesHolder, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::SerializeContext& sc)
+        {
+            sc.Class<BinaryValuesHolder>()
+                ->Version(1)
+                ->Field("shortString", &BinaryValuesHolder::m_shortString)
+                ->Field("longString", &BinaryValuesHolder::m_longString)
+                ->Field("bytes", &BinaryValuesHolder::m_bytes)
+                ->Field("value", &BinaryValuesHolder::m_value);
+        }
+
+        AZStd::string m_shortString;
+        AZStd::string m_longString;
+        AZStd::vector<AZ::u8> m_bytes;
+        float m_value = 0.0f;
+    };
+
+    TEST_F(Serialization, BinaryValuesLoadFromMemoryAndStream)
+    {
+        BinaryValuesHolder::Reflect(*GetSerializeContext());
+
+        BinaryValuesHolder source;
+        source.m_shortString = "short";
+        // longer than the reader's scratch space
+        source.m_longString = AZStd::string(300, 'x');
+        for (AZ::u8 i = 0; i < 200; ++i)
+        {
+            source.m_bytes.push_back(i);
+        }
+        source.m_value = 4.5f;
+
+        AZStd::vector<char> binaryBuffer;
+        IO::ByteContainerStream<AZStd::vector<char> > binaryStream(&binaryBuffer);
+        ObjectStream* binaryObjStream = ObjectStream::Create(&binaryStream, *GetSerializeContext(), ObjectStream::ST_BINARY);
+        binaryObjStream->WriteClass(&source);
+        binaryObjStream->Finalize();
+
+        auto verify = [&source](const BinaryValuesHolder* loaded)
+        {
+            ASSERT_TRUE(loaded);
+            EXPECT_EQ(source.m_shortString, loaded->m_shortString);
+            EXPECT_EQ(source.m_longString, loaded->m_longString);
+            EXPECT_EQ(source.m_bytes, loaded->m_bytes);
+            EXPECT_EQ(source.m_value, loaded->m_value);
+        };
+
+        BinaryValuesHolder* fromBuffer = AZ::Utils::LoadObjectFromBuffer<BinaryValuesHolder>(binaryBuffer.data(), binaryBuffer.size(), GetSerializeContext());
+        verify(fromBuffer);
+        delete fromBuffer;
+
+        binaryStream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+        BinaryValuesHolder* fromStream = AZ::Utils::LoadObjectFromStream<BinaryValuesHolder>(binaryStream, GetSerializeContext());
+        verify(fromStream);
+        delete fromStream;
+    }
+
     // Test that loading containers in-place clears any existing data in the
     // containers (
     template <typename T>
@@ -8307,3 +8450,131 @@ namespace UnitTest
     //}
 }
 
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+namespace Benchmark
+{
+    struct SerializeBenchmarkElement
+    {
+        AZ_TYPE_INFO(SerializeBenchmarkElement, "{5B8E09D5-3AC3-4F2F-9F0E-1B4E4B8A6F33}");
+        AZ_CLASS_ALLOCATOR(SerializeBenchmarkElement, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::SerializeContext& context)
+        {
+            context.Class<SerializeBenchmarkElement>()
+                ->Field("Name", &SerializeBenchmarkElement::m_name)
+                ->Field("Position", &SerializeBenchmarkElement::m_position)
+                ->Field("Value", &SerializeBenchmarkElement::m_value)
+                ->Field("Enabled", &SerializeBenchmarkElement::m_enabled)
+                ;
+        }
+
+        AZStd::string m_name;
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        float m_value = 0.0f;
+        bool m_enabled = false;
+    };
+
+    struct SerializeBenchmarkObject
+    {
+        AZ_TYPE_INFO(SerializeBenchmarkObject, "{A0E0E6D4-5C3E-4C51-8CB7-2B6B24E0B1C9}");
+        AZ_CLASS_ALLOCATOR(SerializeBenchmarkObject, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::SerializeContext& context)
+        {
+            SerializeBenchmarkElement::Reflect(context);
+            context.Class<SerializeBenchmarkObject>()
+                ->Field("Elements", &SerializeBenchmarkObject::m_elements)
+                ->Field("Lookup", &SerializeBenchmarkObject::m_lookup)
+                ;
+        }
+
+        AZStd::vector<SerializeBenchmarkElement> m_elements;
+        AZStd::unordered_map<AZ::u32, float> m_lookup;
+    };
+
+    class SerializeBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_serializeContext = aznew AZ::SerializeContext();
+            SerializeBenchmarkObject::Reflect(*m_serializeContext);
+
+            m_object = aznew SerializeBenchmarkObject();
+            for (int i = 0; i < static_cast<int>(state.range(0)); ++i)
+            {
+                SerializeBenchmarkElement element;
+                element.m_name = AZStd::string::format("Element%d", i);
+                element.m_position.Set(static_cast<float>(i), 1.0f, 2.0f);
+                element.m_value = static_cast<float>(i) * 0.5f;
+                element.m_enabled = (i & 1) != 0;
+                m_object->m_elements.push_back(element);
+                m_object->m_lookup[static_cast<AZ::u32>(i)] = element.m_value;
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            delete m_object;
+            delete m_serializeContext;
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        AZ::SerializeContext* m_serializeContext = nullptr;
+        SerializeBenchmarkObject* m_object = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(SerializeBenchmarkFixture, BM_SerializeContext_CloneObject)(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            SerializeBenchmarkObject* clone = m_serializeContext->CloneObject(m_object);
+            delete clone;
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SerializeBenchmarkFixture, BM_SerializeContext_CloneObject)
+        ->ArgName("Elements")->Arg(16)->Arg(1024)->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(SerializeBenchmarkFixture, BM_SerializeContext_SaveBinary)(::benchmark::State& state)
+    {
+        AZStd::vector<char> buffer;
+        while (state.KeepRunning())
+        {
+            buffer.clear();
+            AZ::IO::ByteContainerStream<AZStd::vector<char> > stream(&buffer);
+            AZ::Utils::SaveObjectToStream(stream, AZ::DataStream::ST_BINARY, m_object, m_serializeContext);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * buffer.size());
+    }
+    BENCHMARK_REGISTER_F(SerializeBenchmarkFixture, BM_SerializeContext_SaveBinary)
+        ->ArgName("Elements")->Arg(16)->Arg(1024)->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(SerializeBenchmarkFixture, BM_SerializeContext_LoadBinary)(::benchmark::State& state)
+    {
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char> > stream(&buffer);
+        AZ::Utils::SaveObjectToStream(stream, AZ::DataStream::ST_BINARY, m_object, m_serializeContext);
+
+        while (state.KeepRunning())
+        {
+            stream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+            SerializeBenchmarkObject loaded;
+            AZ::Utils::LoadObjectFromStreamInPlace(stream, loaded, m_serializeContext);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * buffer.size());
+    }
+    BENCHMARK_REGISTER_F(SerializeBenchmarkFixture, BM_SerializeContext_LoadBinary)
+        ->ArgName("Elements")->Arg(16)->Arg(1024)->Unit(::benchmark::kMicrosecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -1100,6 +1100,66 @@ namespace UnitTest
             delete slice2Entity;
         }
     }
+
+    TEST_F(SliceTest, InstantiateSliceRepeatedly_EachInstanceRemapsItsOwnIdsAndReferences)
+    {
+        Entity* baseSliceEntity = aznew Entity();
+        SliceComponent* baseSliceComponent = baseSliceEntity->CreateComponent<SliceComponent>();
+        baseSliceComponent->SetSerializeContext(m_serializeContext);
+        baseSliceEntity->Init();
+        baseSliceEntity->Activate();
+
+        Entity* referencedEntity = aznew Entity();
+        Entity* referencingEntity = aznew Entity();
+        referencingEntity->CreateComponent<MyTestComponent2>()->m_entityId = referencedEntity->GetId();
+        const EntityId referencedId = referencedEntity->GetId();
+        const EntityId referencingId = referencingEntity->GetId();
+        baseSliceComponent->AddEntity(referencedEntity);
+        baseSliceComponent->AddEntity(referencingEntity);
+
+        Data::Asset<SliceAsset> baseSliceAssetRef = Data::AssetManager::Instance().CreateAsset<SliceAsset>(m_catalog->GenerateMockAssetId());
+        baseSliceAssetRef.Get()->SetData(baseSliceEntity, baseSliceComponent);
+
+        Entity* sliceEntity = aznew Entity();
+        SliceComponent* sliceComponent = sliceEntity->CreateComponent<SliceComponent>();
+        sliceComponent->SetSerializeContext(m_serializeContext);
+        SliceComponent::EntityList entities;
+        sliceComponent->GetEntities(entities); // instantiate, so that the instances below are cloned as they are added
+
+        // the first instance records the ids to generate, the others are remapped from that record
+        const size_t instanceCount = 3;
+        SliceComponent::EntityIdSet newIds;
+        for (size_t instanceIndex = 0; instanceIndex < instanceCount; ++instanceIndex)
+        {
+            SliceComponent::SliceInstanceAddress address = sliceComponent->AddSlice(baseSliceAssetRef);
+            ASSERT_TRUE(address.IsValid());
+
+            const SliceComponent::EntityIdToEntityIdMap& idMap = address.GetInstance()->GetEntityIdMap();
+            auto referencedIt = idMap.find(referencedId);
+            auto referencingIt = idMap.find(referencingId);
+            ASSERT_NE(idMap.end(), referencedIt);
+            ASSERT_NE(idMap.end(), referencingIt);
+            newIds.insert(referencedIt->second);
+            newIds.insert(referencingIt->second);
+
+            bool foundReferencingEntity = false;
+            for (const Entity* entity : address.GetInstance()->GetInstantiated()->m_entities)
+            {
+                if (entity->GetId() == referencingIt->second)
+                {
+                    foundReferencingEntity = true;
+                    EXPECT_EQ(referencedIt->second, entity->FindComponent<MyTestComponent2>()->m_entityId);
+                }
+            }
+            EXPECT_TRUE(foundReferencingEntity);
+        }
+
+        EXPECT_EQ(instanceCount * 2, newIds.size());
+        EXPECT_EQ(newIds.end(), newIds.find(referencedId));
+        EXPECT_EQ(newIds.end(), newIds.find(referencingId));
+
+        delete sliceEntity;
+    }
 }
 
 #ifdef HAVE_BENCHMARK
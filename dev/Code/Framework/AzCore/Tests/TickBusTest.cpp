@@ -69,4 +69,53 @@ TEST_F(OrderedTickBus, OnTick_HandlersFireInSortedOrder)
 
     // check the order they actually fired in
     EXPECT_EQ(actualTickOrder, sortedOrder);
-}
\ No newline at end of file
+}
+// Tickers of two types with the same tick order, they push their type into a list when ticked.
+struct TypedTickerA : public TickBus::Handler
+{
+    AZ_RTTI(TypedTickerA, "{5B0E6A43-8F1C-4E2D-A7B9-3C64D1F0E2A5}", TickBus::Handler);
+
+    AZStd::vector<int>* m_targetList = nullptr;
+
+    void OnTick(float /*deltaTime*/, ScriptTimePoint /*time*/) override { m_targetList->push_back(0); }
+};
+
+struct TypedTickerB : public TickBus::Handler
+{
+    AZ_RTTI(TypedTickerB, "{C81F2D7A-4B6E-4A3C-9D05-E7A2B8F1C364}", TickBus::Handler);
+
+    AZStd::vector<int>* m_targetList = nullptr;
+
+    void OnTick(float /*deltaTime*/, ScriptTimePoint /*time*/) override { m_targetList->push_back(1); }
+};
+
+TEST_F(OrderedTickBus, OnTick_HandlersWithSameOrder_FireGroupedByType)
+{
+    AZStd::vector<int> actualTickTypes;
+
+    // connect the two types interleaved
+    AZStd::list<TypedTickerA> tickersA;
+    AZStd::list<TypedTickerB> tickersB;
+    for (int i = 0; i < 5; ++i)
+    {
+        tickersA.push_back();
+        tickersA.back().m_targetList = &actualTickTypes;
+        tickersA.back().BusConnect();
+
+        tickersB.push_back();
+        tickersB.back().m_targetList = &actualTickTypes;
+        tickersB.back().BusConnect();
+    }
+
+    TickBus::Broadcast(&TickBus::Events::OnTick, 0.f, ScriptTimePoint{});
+
+    ASSERT_EQ(10, actualTickTypes.size());
+
+    // the type only changes once
+    size_t typeChanges = 0;
+    for (size_t i = 1; i < actualTickTypes.size(); ++i)
+    {
+        typeChanges += actualTickTypes[i] != actualTickTypes[i - 1] ? 1 : 0;
+    }
+    EXPECT_EQ(1, typeChanges);
+}
@@ -36,6 +36,7 @@
 #include <AzFramework/Asset/AssetRegistry.h>
 #include <AzFramework/Components/ConsoleBus.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformPropagationSystemComponent.h>
 #include <AzFramework/Components/BootstrapReaderComponent.h>
 #include <AzFramework/Entity/BehaviorEntity.h>
 #include <AzFramework/Entity/EntityContext.h>
@@ -477,6 +478,7 @@ namespace AzFramework
             azrtti_typeid<AzFramework::NetBindingComponent>(),
             azrtti_typeid<AzFramework::NetBindingSystemComponent>(),
             azrtti_typeid<AzFramework::TransformComponent>(),
+            azrtti_typeid<AzFramework::TransformPropagationSystemComponent>(),
             azrtti_typeid<AzFramework::GameEntityContextComponent>(),
 #if !defined(_RELEASE)
             azrtti_typeid<AzFramework::TargetManagementComponent>(),
@@ -530,6 +532,7 @@ namespace AzFramework
             azrtti_typeid<AzFramework::BootstrapReaderComponent>(),
             azrtti_typeid<AzFramework::AssetCatalogComponent>(),
             azrtti_typeid<AzFramework::GameEntityContextComponent>(),
+            azrtti_typeid<AzFramework::TransformPropagationSystemComponent>(),
             azrtti_typeid<AzFramework::AssetSystem::AssetSystemComponent>(),
             azrtti_typeid<AzFramework::InputSystemComponent>(),
             azrtti_typeid<AzFramework::DrillerNetworkAgentComponent>(),
@@ -24,6 +24,7 @@
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <AzFramework/API/ApplicationAPI.h>
 #include <AzFramework/Asset/AssetRegistry.h>
+#include <AzFramework/Asset/BinaryAssetRegistry.h>
 
 // uncomment to have the catalog be dumped to stdout:
 //#define DEBUG_DUMP_CATALOG
@@ -36,6 +37,7 @@ namespace AzFramework
     AssetCatalog::AssetCatalog()
         : m_shutdownThreadSignal(false)
         , m_registry(aznew AssetRegistry())
+        , m_binaryRegistry(aznew BinaryAssetRegistry())
     {
         AZ::Data::AssetCatalogRequestBus::Handler::BusConnect();
     }
@@ -58,6 +60,8 @@ namespace AzFramework
 
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
         m_registry->Clear();
+        m_binaryRegistry->Clear();
+        m_removedBinaryAssets.clear();
     }
 
     //=========================================================================
@@ -128,14 +132,14 @@ namespace AzFramework
 
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
-        auto foundIter = m_registry->m_assetIdToInfo.find(id);
-        if (foundIter != m_registry->m_assetIdToInfo.end())
+        AZ::Data::AssetInfo assetInfo;
+        if (FindAssetInfo(id, assetInfo))
         {
-            return foundIter->second.m_relativePath;
+            return assetInfo.m_relativePath;
         }
 
         // we did not find it - try the backup mapping!
-        AZ::Data::AssetId legacyMapping = m_registry->GetAssetIdByLegacyAssetId(id);
+        AZ::Data::AssetId legacyMapping = FindAssetIdByLegacyAssetId(id);
         if (legacyMapping.IsValid())
         {
             return GetAssetPathById(legacyMapping);
@@ -156,14 +160,14 @@ namespace AzFramework
 
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
-        auto foundIter = m_registry->m_assetIdToInfo.find(id);
-        if (foundIter != m_registry->m_assetIdToInfo.end())
+        AZ::Data::AssetInfo assetInfo;
+        if (FindAssetInfo(id, assetInfo))
         {
-            return foundIter->second;
+            return assetInfo;
         }
 
         // we did not find it - try the backup mapping!
-        AZ::Data::AssetId legacyMapping = m_registry->GetAssetIdByLegacyAssetId(id);
+        AZ::Data::AssetId legacyMapping = FindAssetIdByLegacyAssetId(id);
         if (legacyMapping.IsValid())
         {
             return GetAssetInfoById(legacyMapping);
@@ -186,11 +190,10 @@ namespace AzFramework
         {
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
-            AZ::Data::AssetId foundId = m_registry->GetAssetIdByPath(m_pathBuffer.c_str());
-            if (foundId.IsValid())
+            AZ::Data::AssetId foundId = FindAssetIdByPath(m_pathBuffer.c_str());
+            AZ::Data::AssetInfo assetInfo;
+            if (foundId.IsValid() && FindAssetInfo(foundId, assetInfo))
             {
-                const AZ::Data::AssetInfo& assetInfo = m_registry->m_assetIdToInfo.find(foundId)->second;
-
                 // If the type is already registered, but with no valid type, allow it to be re-registered.
                 // Otherwise, return the Id.
                 if (!autoRegisterIfNotFound || !assetInfo.m_assetType.IsNull())
@@ -235,14 +238,15 @@ namespace AzFramework
 
     AZ::Outcome<AZStd::vector<AZ::Data::ProductDependency>, AZStd::string> AssetCatalog::GetDirectProductDependencies(const AZ::Data::AssetId& id)
     {
-        auto itr = m_registry->m_assetDependencies.find(id);
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
-        if (itr == m_registry->m_assetDependencies.end())
+        AZStd::vector<AZ::Data::ProductDependency> dependencies;
+        if (!FindDirectProductDependencies(id, dependencies))
         {
             return AZ::Failure<AZStd::string>("Failed to find asset in dependency map");
         }
 
-        return AZ::Success(itr->second);
+        return AZ::Success(AZStd::move(dependencies));
     }
     
     AZ::Outcome<AZStd::vector<AZ::Data::ProductDependency>, AZStd::string> AssetCatalog::GetAllProductDependencies(const AZ::Data::AssetId& id)
@@ -250,6 +254,7 @@ namespace AzFramework
         AZStd::vector<AZ::Data::ProductDependency> dependencyList;
         AZStd::unordered_set<AZ::Data::AssetId> assetSet;
 
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
         AddAssetDependencies(id, assetSet, dependencyList);
 
         // dependencyList will be appended to while looping, so use a traditional loop
@@ -264,12 +269,10 @@ namespace AzFramework
     void AssetCatalog::AddAssetDependencies(const AZ::Data::AssetId& searchAssetId, AZStd::unordered_set<AZ::Data::AssetId>& assetSet, AZStd::vector<AZ::Data::ProductDependency>& dependencyList)
     {
         using namespace AZ::Data;
-        auto itr = m_registry->m_assetDependencies.find(searchAssetId);
+        AZStd::vector<ProductDependency> assetDependencyList;
 
-        if (itr != m_registry->m_assetDependencies.end())
+        if (FindDirectProductDependencies(searchAssetId, assetDependencyList))
         {
-            AZStd::vector<ProductDependency>& assetDependencyList = itr->second;
-
             for (const ProductDependency& dependency : assetDependencyList)
             {
                 // Only proceed if we haven't encountered this assetId before
@@ -314,6 +317,16 @@ namespace AzFramework
             {
                 enumerateCB(it.first, it.second);
             }
+
+            for (AZ::u32 assetIndex = 0; assetIndex < m_binaryRegistry->GetAssetCount(); ++assetIndex)
+            {
+                // assets that were registered again at runtime were already enumerated above
+                AZ::Data::AssetInfo assetInfo = m_binaryRegistry->GetAssetInfoByIndex(assetIndex);
+                if (m_registry->m_assetIdToInfo.find(assetInfo.m_assetId) == m_registry->m_assetIdToInfo.end() && !IsRemovedFromBinaryRegistry(assetInfo.m_assetId))
+                {
+                    enumerateCB(assetInfo.m_assetId, assetInfo);
+                }
+            }
         }
 
         if (endCB)
@@ -329,7 +342,8 @@ namespace AzFramework
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
-        AZ_Warning("AssetCatalog", m_registry->m_assetIdToInfo.size() == 0, "Catalog reset will erase %u assets", m_registry->m_assetIdToInfo.size());
+        AZ_Warning("AssetCatalog", m_registry->m_assetIdToInfo.empty() && m_binaryRegistry->IsEmpty(), "Catalog reset will erase %u assets",
+            m_registry->m_assetIdToInfo.size() + m_binaryRegistry->GetAssetCount());
 
         // Get asset root from application.
         EBUS_EVENT_RESULT(m_assetRoot, AzFramework::ApplicationRequests::Bus, GetAssetRoot);
@@ -374,8 +388,27 @@ namespace AzFramework
             }
         }
 
-        if (!bytes.empty())
+        if (BinaryAssetRegistry::IsBinaryRegistry(bytes.data(), bytes.size()))
         {
+            // the binary catalog is used as it was read, without building a map entry per asset
+            m_registry->Clear();
+            m_removedBinaryAssets.clear();
+            if (m_binaryRegistry->Load(AZStd::move(bytes)))
+            {
+                AZ_TracePrintf("AssetCatalog",
+                    "\n========================================================\n"
+                    "Loaded binary registry containing %u assets.\n"
+                    "========================================================\n",
+                    m_binaryRegistry->GetAssetCount());
+
+                AssetCatalogEventBus::Broadcast(&AssetCatalogEventBus::Events::OnCatalogLoaded, catalogRegistryFile);
+            }
+        }
+        else if (!bytes.empty())
+        {
+            m_binaryRegistry->Clear();
+            m_removedBinaryAssets.clear();
+
             AZ::IO::MemoryStream catalogStream(bytes.data(), bytes.size());
         #if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
             ApplicationRequests::Bus::Broadcast(&ApplicationRequests::PumpSystemEventLoopWhileDoingWorkInNewThread,
@@ -436,6 +469,7 @@ namespace AzFramework
         {
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
             m_registry->RegisterAsset(id, info);
+            m_removedBinaryAssets.erase(id);
         }
         EBUS_EVENT(AzFramework::AssetCatalogEventBus, OnCatalogAssetAdded, id);
     }
@@ -452,6 +486,10 @@ namespace AzFramework
 
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
             m_registry->UnregisterAsset(assetId);
+            if (m_binaryRegistry->GetAssetCount() > 0)
+            {
+                m_removedBinaryAssets.insert(assetId);
+            }
         }
     }
 
@@ -554,8 +592,8 @@ namespace AzFramework
         if (assetId.IsValid())
         {
             // is it an add or a change?
-            auto assetInfoPair = m_registry->m_assetIdToInfo.find(assetId);
-            const bool isNewAsset = (assetInfoPair == m_registry->m_assetIdToInfo.end());
+            AZ::Data::AssetInfo existingInfo;
+            const bool isNewAsset = !FindAssetInfo(assetId, existingInfo);
 
 #if defined(AZ_ENABLE_TRACING)
             if (message.m_assetType == AZ::Data::s_invalidAssetType)
@@ -564,7 +602,7 @@ namespace AzFramework
             }
 #endif
 
-            const AZ::Data::AssetType& assetType = isNewAsset ? message.m_assetType : assetInfoPair->second.m_assetType;
+            const AZ::Data::AssetType& assetType = isNewAsset ? message.m_assetType : existingInfo.m_assetType;
 
             AZ::Data::AssetInfo newData;
             newData.m_assetId = assetId;
@@ -574,6 +612,7 @@ namespace AzFramework
 
             m_registry->RegisterAsset(assetId, newData);
             m_registry->SetAssetDependencies(assetId, message.m_dependencies);
+            m_removedBinaryAssets.erase(assetId);
 
             for (const auto& mapping : message.m_legacyAssetIds)
             {
@@ -658,12 +697,10 @@ namespace AzFramework
             InitializeCatalog(catalogRegistryFile);
 
 #if defined(DEBUG_DUMP_CATALOG)
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
-
-            for (auto& it : m_registry->m_assetIdToInfo)
+            EnumerateAssets(nullptr, [](const AZ::Data::AssetId& id, const AZ::Data::AssetInfo& info)
             {
-                AZ_TracePrintf("Asset Registry: AssetID->Info", "%s --> %s %llu bytes\n", it.first.ToString<AZStd::string>().c_str(), it.second.m_relativePath.c_str(), it.second.m_sizeBytes);
-            }
+                AZ_TracePrintf("Asset Registry: AssetID->Info", "%s --> %s %llu bytes\n", id.ToString<AZStd::string>().c_str(), info.m_relativePath.c_str(), info.m_sizeBytes);
+            }, nullptr);
 
 #endif
             return true;
@@ -671,4 +708,72 @@ namespace AzFramework
 
         return false;
     }
+
+    //=========================================================================
+    // FindAssetInfo
+    //=========================================================================
+    bool AssetCatalog::FindAssetInfo(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& assetInfo) const
+    {
+        auto foundIter = m_registry->m_assetIdToInfo.find(id);
+        if (foundIter != m_registry->m_assetIdToInfo.end())
+        {
+            assetInfo = foundIter->second;
+            return true;
+        }
+
+        return !IsRemovedFromBinaryRegistry(id) && m_binaryRegistry->FindAssetInfo(id, assetInfo);
+    }
+
+    //=========================================================================
+    // FindAssetIdByPath
+    //=========================================================================
+    AZ::Data::AssetId AssetCatalog::FindAssetIdByPath(const char* assetPath) const
+    {
+        AZ::Data::AssetId foundId = m_registry->GetAssetIdByPath(assetPath);
+        if (!foundId.IsValid())
+        {
+            foundId = m_binaryRegistry->GetAssetIdByPath(assetPath);
+            if (foundId.IsValid() && IsRemovedFromBinaryRegistry(foundId))
+            {
+                return AZ::Data::AssetId();
+            }
+        }
+        return foundId;
+    }
+
+    //=========================================================================
+    // FindAssetIdByLegacyAssetId
+    //=========================================================================
+    AZ::Data::AssetId AssetCatalog::FindAssetIdByLegacyAssetId(const AZ::Data::AssetId& legacyAssetId) const
+    {
+        AZ::Data::AssetId foundId = m_registry->GetAssetIdByLegacyAssetId(legacyAssetId);
+        if (!foundId.IsValid())
+        {
+            foundId = m_binaryRegistry->GetAssetIdByLegacyAssetId(legacyAssetId);
+        }
+        return foundId;
+    }
+
+    //=========================================================================
+    // FindDirectProductDependencies
+    //=========================================================================
+    bool AssetCatalog::FindDirectProductDependencies(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const
+    {
+        auto itr = m_registry->m_assetDependencies.find(id);
+        if (itr != m_registry->m_assetDependencies.end())
+        {
+            dependencies = itr->second;
+            return true;
+        }
+
+        return !IsRemovedFromBinaryRegistry(id) && m_binaryRegistry->GetDirectProductDependencies(id, dependencies);
+    }
+
+    //=========================================================================
+    // IsRemovedFromBinaryRegistry
+    //=========================================================================
+    bool AssetCatalog::IsRemovedFromBinaryRegistry(const AZ::Data::AssetId& id) const
+    {
+        return m_removedBinaryAssets.find(id) != m_removedBinaryAssets.end();
+    }
 } // namespace AzFramework
@@ -27,6 +27,7 @@
 namespace AzFramework
 {
     class AssetRegistry;
+    class BinaryAssetRegistry;
 
     /*
      * Implements an asset catalog that populates data by scanning an asset root.
@@ -97,13 +98,23 @@ namespace AzFramework
 
     private:
 
+        /// Lookups across both registries, the caller must hold m_registryMutex.
+        /// Assets registered at runtime take precedence over the ones in the binary catalog.
+        bool FindAssetInfo(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& assetInfo) const;
+        AZ::Data::AssetId FindAssetIdByPath(const char* assetPath) const;
+        AZ::Data::AssetId FindAssetIdByLegacyAssetId(const AZ::Data::AssetId& legacyAssetId) const;
+        bool FindDirectProductDependencies(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const;
+        bool IsRemovedFromBinaryRegistry(const AZ::Data::AssetId& id) const;
+
         AZStd::atomic_bool m_shutdownThreadSignal;                  ///< Signals the monitoring thread to stop.
         AZStd::thread m_thread;                                     ///< Monitoring thread
         AZStd::string m_assetRoot;                                  ///< Asset root the catalog is bound to.
         AZStd::unordered_set<AZStd::string> m_extensions;           ///< Valid asset extensions.
         mutable AZStd::recursive_mutex m_registryMutex;
 
-        AZStd::unique_ptr<AssetRegistry> m_registry;
+        AZStd::unique_ptr<AssetRegistry> m_registry;               ///< Assets loaded from an object stream catalog or registered at runtime.
+        AZStd::unique_ptr<BinaryAssetRegistry> m_binaryRegistry;   ///< Assets loaded from a binary catalog, used in place.
+        AZStd::unordered_set<AZ::Data::AssetId> m_removedBinaryAssets; ///< Assets of the binary catalog that were unregistered since it was loaded.
         AZStd::string m_pathBuffer;
     };
 } // namespace AzFramework
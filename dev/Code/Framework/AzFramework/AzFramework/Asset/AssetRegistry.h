@@ -58,6 +58,8 @@ namespace AzFramework
         static void ReflectSerialize(AZ::SerializeContext* serializeContext);
 
     private:
+        friend class BinaryAssetRegistry;
+
         // use these only through the legacy getters/setters above.
         using AssetPathToIdMap = AZStd::unordered_map < AZ::Uuid, AZ::Data::AssetId >;
         using LegacyAssetIdToRealAssetIdMap = AZStd::unordered_map<AZ::Data::AssetId, AZ::Data::AssetId>;
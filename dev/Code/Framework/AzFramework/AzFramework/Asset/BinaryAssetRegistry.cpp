@@ -0,0 +1,370 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzFramework/Asset/BinaryAssetRegistry.h>
+#include <AzFramework/Asset/AssetRegistry.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace AssetRegistryInternal
+{
+    // defined in AssetRegistry.cpp, the binary image stores the same path hashes as the registry it was built from
+    AZ::Uuid CreateUUIDForName(const char* name);
+}
+
+namespace BinaryAssetRegistryInternal
+{
+    // every table is aligned so that the 64 bit fields of its entries can be read in place
+    const size_t s_tableAlignment = 8;
+
+    bool IsLess(const AZ::u8* guid, AZ::u32 subId, const AZ::Data::AssetId& id)
+    {
+        int result = memcmp(guid, id.m_guid.data, sizeof(id.m_guid.data));
+        return result < 0 || (result == 0 && subId < id.m_subId);
+    }
+
+    bool IsEqual(const AZ::u8* guid, AZ::u32 subId, const AZ::Data::AssetId& id)
+    {
+        return subId == id.m_subId && memcmp(guid, id.m_guid.data, sizeof(id.m_guid.data)) == 0;
+    }
+
+    bool IsLess(const AZ::Data::AssetId& lhs, const AZ::Data::AssetId& rhs)
+    {
+        return IsLess(lhs.m_guid.data, lhs.m_subId, rhs);
+    }
+
+    template<class Entry>
+    const Entry* FindById(const Entry* entries, AZ::u32 count, const AZ::Data::AssetId& id)
+    {
+        const Entry* end = entries + count;
+        const Entry* found = AZStd::lower_bound(entries, end, id,
+            [](const Entry& entry, const AZ::Data::AssetId& value) { return IsLess(entry.m_guid, entry.m_subId, value); });
+        return (found != end && IsEqual(found->m_guid, found->m_subId, id)) ? found : nullptr;
+    }
+
+    template<class Entry>
+    bool IsTableInImage(AZ::u32 offset, AZ::u32 count, size_t imageSize)
+    {
+        return (offset % s_tableAlignment) == 0 && static_cast<AZ::u64>(offset) + static_cast<AZ::u64>(count) * sizeof(Entry) <= imageSize;
+    }
+
+    template<class Entry>
+    AZ::u32 AppendTable(AZStd::vector<char>& output, const AZStd::vector<Entry>& table)
+    {
+        output.resize((output.size() + s_tableAlignment - 1) & ~(s_tableAlignment - 1), 0);
+        AZ::u32 offset = static_cast<AZ::u32>(output.size());
+        const char* tableData = reinterpret_cast<const char*>(table.data());
+        output.insert(output.end(), tableData, tableData + table.size() * sizeof(Entry));
+        return offset;
+    }
+
+    void CopyId(const AZ::Data::AssetId& id, AZ::u8* guid, AZ::u32& subId)
+    {
+        memcpy(guid, id.m_guid.data, sizeof(id.m_guid.data));
+        subId = id.m_subId;
+    }
+
+    AZ::Data::AssetId ToAssetId(const AZ::u8* guid, AZ::u32 subId)
+    {
+        AZ::Data::AssetId id;
+        memcpy(id.m_guid.data, guid, sizeof(id.m_guid.data));
+        id.m_subId = subId;
+        return id;
+    }
+}
+
+namespace AzFramework
+{
+    using namespace BinaryAssetRegistryInternal;
+
+    //=========================================================================
+    // BinaryAssetRegistry::IsBinaryRegistry
+    //=========================================================================
+    bool BinaryAssetRegistry::IsBinaryRegistry(const void* data, size_t size)
+    {
+        AZ::u32 signature = 0;
+        if (!data || size < sizeof(signature))
+        {
+            return false;
+        }
+        memcpy(&signature, data, sizeof(signature));
+        return signature == s_signature;
+    }
+
+    //=========================================================================
+    // BinaryAssetRegistry::Write
+    //=========================================================================
+    void BinaryAssetRegistry::Write(const AssetRegistry& registry, AZStd::vector<char>& output)
+    {
+        AZStd::vector<char> stringPool;
+
+        AZStd::vector<AssetEntry> assets;
+        assets.reserve(registry.m_assetIdToInfo.size());
+        for (const auto& assetPair : registry.m_assetIdToInfo)
+        {
+            const AZ::Data::AssetInfo& assetInfo = assetPair.second;
+
+            AssetEntry entry;
+            memset(&entry, 0, sizeof(entry));
+            CopyId(assetPair.first, entry.m_guid, entry.m_subId);
+            memcpy(entry.m_assetType, assetInfo.m_assetType.data, sizeof(entry.m_assetType));
+            entry.m_sizeBytes = assetInfo.m_sizeBytes;
+            entry.m_pathOffset = static_cast<AZ::u32>(stringPool.size());
+            entry.m_pathLength = static_cast<AZ::u32>(assetInfo.m_relativePath.size());
+            stringPool.insert(stringPool.end(), assetInfo.m_relativePath.c_str(), assetInfo.m_relativePath.c_str() + assetInfo.m_relativePath.size() + 1);
+            assets.push_back(entry);
+        }
+        AZStd::sort(assets.begin(), assets.end(), [](const AssetEntry& lhs, const AssetEntry& rhs)
+        {
+            return IsLess(lhs.m_guid, lhs.m_subId, ToAssetId(rhs.m_guid, rhs.m_subId));
+        });
+
+        AZStd::vector<PathEntry> paths;
+        paths.reserve(registry.m_assetPathToId.size());
+        for (const auto& pathPair : registry.m_assetPathToId)
+        {
+            PathEntry entry;
+            memset(&entry, 0, sizeof(entry));
+            memcpy(entry.m_guid, pathPair.first.data, sizeof(entry.m_guid));
+            CopyId(pathPair.second, entry.m_assetGuid, entry.m_assetSubId);
+            paths.push_back(entry);
+        }
+        AZStd::sort(paths.begin(), paths.end(), [](const PathEntry& lhs, const PathEntry& rhs)
+        {
+            return memcmp(lhs.m_guid, rhs.m_guid, sizeof(lhs.m_guid)) < 0;
+        });
+
+        AZStd::vector<LegacyEntry> legacyIds;
+        legacyIds.reserve(registry.m_legacyAssetIdToRealAssetId.size());
+        for (const auto& legacyPair : registry.m_legacyAssetIdToRealAssetId)
+        {
+            LegacyEntry entry;
+            memset(&entry, 0, sizeof(entry));
+            CopyId(legacyPair.first, entry.m_guid, entry.m_subId);
+            CopyId(legacyPair.second, entry.m_assetGuid, entry.m_assetSubId);
+            legacyIds.push_back(entry);
+        }
+        AZStd::sort(legacyIds.begin(), legacyIds.end(), [](const LegacyEntry& lhs, const LegacyEntry& rhs)
+        {
+            return IsLess(lhs.m_guid, lhs.m_subId, ToAssetId(rhs.m_guid, rhs.m_subId));
+        });
+
+        // the dependency lists are sorted by their owner, the dependencies keep the order they were registered in
+        AZStd::vector<AZ::Data::AssetId> owners;
+        owners.reserve(registry.m_assetDependencies.size());
+        for (const auto& dependencyPair : registry.m_assetDependencies)
+        {
+            owners.push_back(dependencyPair.first);
+        }
+        AZStd::sort(owners.begin(), owners.end(), [](const AZ::Data::AssetId& lhs, const AZ::Data::AssetId& rhs) { return IsLess(lhs, rhs); });
+
+        AZStd::vector<DependencyListEntry> dependencyLists;
+        AZStd::vector<DependencyEntry> dependencies;
+        dependencyLists.reserve(owners.size());
+        for (const AZ::Data::AssetId& owner : owners)
+        {
+            const AZStd::vector<AZ::Data::ProductDependency>& ownerDependencies = registry.m_assetDependencies.find(owner)->second;
+
+            DependencyListEntry listEntry;
+            memset(&listEntry, 0, sizeof(listEntry));
+            CopyId(owner, listEntry.m_guid, listEntry.m_subId);
+            listEntry.m_firstDependency = static_cast<AZ::u32>(dependencies.size());
+            listEntry.m_dependencyCount = static_cast<AZ::u32>(ownerDependencies.size());
+            dependencyLists.push_back(listEntry);
+
+            for (const AZ::Data::ProductDependency& dependency : ownerDependencies)
+            {
+                DependencyEntry entry;
+                memset(&entry, 0, sizeof(entry));
+                CopyId(dependency.m_assetId, entry.m_guid, entry.m_subId);
+                entry.m_flags = dependency.m_flags.to_ullong();
+                dependencies.push_back(entry);
+            }
+        }
+
+        Header header;
+        memset(&header, 0, sizeof(header));
+        header.m_signature = s_signature;
+        header.m_version = s_version;
+
+        output.clear();
+        output.resize(sizeof(Header), 0);
+        header.m_assetCount = static_cast<AZ::u32>(assets.size());
+        header.m_assetOffset = AppendTable(output, assets);
+        header.m_pathCount = static_cast<AZ::u32>(paths.size());
+        header.m_pathOffset = AppendTable(output, paths);
+        header.m_legacyCount = static_cast<AZ::u32>(legacyIds.size());
+        header.m_legacyOffset = AppendTable(output, legacyIds);
+        header.m_dependencyListCount = static_cast<AZ::u32>(dependencyLists.size());
+        header.m_dependencyListOffset = AppendTable(output, dependencyLists);
+        header.m_dependencyCount = static_cast<AZ::u32>(dependencies.size());
+        header.m_dependencyOffset = AppendTable(output, dependencies);
+        header.m_stringPoolSize = static_cast<AZ::u32>(stringPool.size());
+        header.m_stringPoolOffset = AppendTable(output, stringPool);
+        memcpy(output.data(), &header, sizeof(header));
+    }
+
+    //=========================================================================
+    // BinaryAssetRegistry::Load
+    //=========================================================================
+    bool BinaryAssetRegistry::Load(AZStd::vector<char>&& image)
+    {
+        Clear();
+
+        if (!IsBinaryRegistry(image.data(), image.size()) || image.size() < sizeof(Header))
+        {
+            AZ_Error("AssetCatalog", false, "Binary asset registry is truncated.");
+            return false;
+        }
+
+        Header header;
+        memcpy(&header, image.data(), sizeof(header));
+        if (header.m_version != s_version)
+        {
+            AZ_Error("AssetCatalog", false, "Binary asset registry has version %u, expected version %u. Rebuild the asset catalog.", header.m_version, s_version);
+            return false;
+        }
+
+        if ((reinterpret_cast<AZStd::size_t>(image.data()) % s_tableAlignment) != 0 ||
+            !IsTableInImage<AssetEntry>(header.m_assetOffset, header.m_assetCount, image.size()) ||
+            !IsTableInImage<PathEntry>(header.m_pathOffset, header.m_pathCount, image.size()) ||
+            !IsTableInImage<LegacyEntry>(header.m_legacyOffset, header.m_legacyCount, image.size()) ||
+            !IsTableInImage<DependencyListEntry>(header.m_dependencyListOffset, header.m_dependencyListCount, image.size()) ||
+            !IsTableInImage<DependencyEntry>(header.m_dependencyOffset, header.m_dependencyCount, image.size()) ||
+            !IsTableInImage<char>(header.m_stringPoolOffset, header.m_stringPoolSize, image.size()))
+        {
+            AZ_Error("AssetCatalog", false, "Binary asset registry is malformed.");
+            return false;
+        }
+
+        m_image = AZStd::move(image);
+        const char* data = m_image.data();
+        m_assets = reinterpret_cast<const AssetEntry*>(data + header.m_assetOffset);
+        m_assetCount = header.m_assetCount;
+        m_paths = reinterpret_cast<const PathEntry*>(data + header.m_pathOffset);
+        m_pathCount = header.m_pathCount;
+        m_legacyIds = reinterpret_cast<const LegacyEntry*>(data + header.m_legacyOffset);
+        m_legacyCount = header.m_legacyCount;
+        m_dependencyLists = reinterpret_cast<const DependencyListEntry*>(data + header.m_dependencyListOffset);
+        m_dependencyListCount = header.m_dependencyListCount;
+        m_dependencies = reinterpret_cast<const DependencyEntry*>(data + header.m_dependencyOffset);
+        m_dependencyCount = header.m_dependencyCount;
+        m_stringPool = data + header.m_stringPoolOffset;
+        m_stringPoolSize = header.m_stringPoolSize;
+        return true;
+    }
+
+    //=========================================================================
+    // BinaryAssetRegistry::Clear
+    //=========================================================================
+    void BinaryAssetRegistry::Clear()
+    {
+        m_image.set_capacity(0);
+        m_assets = nullptr;
+        m_paths = nullptr;
+        m_legacyIds = nullptr;
+        m_dependencyLists = nullptr;
+        m_dependencies = nullptr;
+        m_stringPool = nullptr;
+        m_assetCount = 0;
+        m_pathCount = 0;
+        m_legacyCount = 0;
+        m_dependencyListCount = 0;
+        m_dependencyCount = 0;
+        m_stringPoolSize = 0;
+    }
+
+    bool BinaryAssetRegistry::IsEmpty() const
+    {
+        return m_assetCount == 0 && m_legacyCount == 0 && m_dependencyListCount == 0;
+    }
+
+    AZ::u32 BinaryAssetRegistry::GetAssetCount() const
+    {
+        return m_assetCount;
+    }
+
+    bool BinaryAssetRegistry::FindAssetInfo(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& assetInfo) const
+    {
+        const AssetEntry* entry = FindById(m_assets, m_assetCount, id);
+        if (entry)
+        {
+            assetInfo = ToAssetInfo(*entry);
+            return true;
+        }
+        return false;
+    }
+
+    AZ::Data::AssetInfo BinaryAssetRegistry::GetAssetInfoByIndex(AZ::u32 index) const
+    {
+        AZ_Assert(index < m_assetCount, "Asset index %u is out of range.", index);
+        return ToAssetInfo(m_assets[index]);
+    }
+
+    AZ::Data::AssetId BinaryAssetRegistry::GetAssetIdByPath(const char* assetPath) const
+    {
+        if ((!assetPath) || (assetPath[0] == 0))
+        {
+            return AZ::Data::AssetId();
+        }
+
+        AZ::Uuid pathHash = AssetRegistryInternal::CreateUUIDForName(assetPath);
+        const PathEntry* end = m_paths + m_pathCount;
+        const PathEntry* found = AZStd::lower_bound(m_paths, end, pathHash,
+            [](const PathEntry& entry, const AZ::Uuid& value) { return memcmp(entry.m_guid, value.data, sizeof(entry.m_guid)) < 0; });
+        if (found != end && memcmp(found->m_guid, pathHash.data, sizeof(found->m_guid)) == 0)
+        {
+            return ToAssetId(found->m_assetGuid, found->m_assetSubId);
+        }
+        return AZ::Data::AssetId();
+    }
+
+    AZ::Data::AssetId BinaryAssetRegistry::GetAssetIdByLegacyAssetId(const AZ::Data::AssetId& legacyAssetId) const
+    {
+        const LegacyEntry* entry = FindById(m_legacyIds, m_legacyCount, legacyAssetId);
+        if (entry)
+        {
+            return ToAssetId(entry->m_assetGuid, entry->m_assetSubId);
+        }
+        return AZ::Data::AssetId();
+    }
+
+    bool BinaryAssetRegistry::GetDirectProductDependencies(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const
+    {
+        const DependencyListEntry* listEntry = FindById(m_dependencyLists, m_dependencyListCount, id);
+        if (!listEntry || static_cast<AZ::u64>(listEntry->m_firstDependency) + listEntry->m_dependencyCount > m_dependencyCount)
+        {
+            return false;
+        }
+
+        dependencies.reserve(dependencies.size() + listEntry->m_dependencyCount);
+        const DependencyEntry* first = m_dependencies + listEntry->m_firstDependency;
+        for (const DependencyEntry* entry = first; entry != first + listEntry->m_dependencyCount; ++entry)
+        {
+            dependencies.emplace_back(ToAssetId(entry->m_guid, entry->m_subId), AZStd::bitset<64>(entry->m_flags));
+        }
+        return true;
+    }
+
+    AZ::Data::AssetInfo BinaryAssetRegistry::ToAssetInfo(const AssetEntry& entry) const
+    {
+        AZ::Data::AssetInfo assetInfo;
+        assetInfo.m_assetId = ToAssetId(entry.m_guid, entry.m_subId);
+        memcpy(assetInfo.m_assetType.data, entry.m_assetType, sizeof(entry.m_assetType));
+        assetInfo.m_sizeBytes = entry.m_sizeBytes;
+        if (static_cast<AZ::u64>(entry.m_pathOffset) + entry.m_pathLength < m_stringPoolSize)
+        {
+            assetInfo.m_relativePath.assign(m_stringPool + entry.m_pathOffset, entry.m_pathLength);
+        }
+        return assetInfo;
+    }
+} // namespace AzFramework
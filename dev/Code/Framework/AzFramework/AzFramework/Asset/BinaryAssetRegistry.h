@@ -0,0 +1,145 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AzFramework
+{
+    class AssetRegistry;
+
+    /**
+    * Read-only view of an asset registry stored as a flat image.
+    * The AssetProcessor writes the catalog in this layout so that the runtime can use the file contents as they
+    * were read from disk: every table is sorted by its key and looked up with a binary search, so loading the
+    * catalog does not have to create a map node or a string per asset.
+    * The image is little endian, as are all the platforms the catalog is built for.
+    */
+    class BinaryAssetRegistry
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(BinaryAssetRegistry, AZ::SystemAllocator, 0);
+
+        static const AZ::u32 s_signature = 0x52434142; // "BACR"
+        static const AZ::u32 s_version = 1;
+
+        BinaryAssetRegistry() = default;
+
+        //! Returns true if the buffer starts with the signature of a binary registry, of any version.
+        static bool IsBinaryRegistry(const void* data, size_t size);
+
+        //! Flattens the registry into a binary image. Overwrites the contents of the output buffer.
+        static void Write(const AssetRegistry& registry, AZStd::vector<char>& output);
+
+        //! Takes ownership of an image produced by Write. Returns false and stays empty if the image is malformed
+        //! or was written by a different version.
+        bool Load(AZStd::vector<char>&& image);
+        void Clear();
+
+        bool IsEmpty() const;
+        AZ::u32 GetAssetCount() const;
+
+        bool FindAssetInfo(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& assetInfo) const;
+        AZ::Data::AssetInfo GetAssetInfoByIndex(AZ::u32 index) const;
+
+        //! Same lookup rules as AssetRegistry::GetAssetIdByPath.
+        AZ::Data::AssetId GetAssetIdByPath(const char* assetPath) const;
+        AZ::Data::AssetId GetAssetIdByLegacyAssetId(const AZ::Data::AssetId& legacyAssetId) const;
+
+        //! Returns false if the registry has no dependency list for the asset, which is different from an empty list.
+        bool GetDirectProductDependencies(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const;
+
+    private:
+        struct Header
+        {
+            AZ::u32 m_signature;
+            AZ::u32 m_version;
+            AZ::u32 m_assetCount;
+            AZ::u32 m_assetOffset;
+            AZ::u32 m_pathCount;
+            AZ::u32 m_pathOffset;
+            AZ::u32 m_legacyCount;
+            AZ::u32 m_legacyOffset;
+            AZ::u32 m_dependencyListCount;
+            AZ::u32 m_dependencyListOffset;
+            AZ::u32 m_dependencyCount;
+            AZ::u32 m_dependencyOffset;
+            AZ::u32 m_stringPoolSize;
+            AZ::u32 m_stringPoolOffset;
+        };
+
+        // sorted by asset id
+        struct AssetEntry
+        {
+            AZ::u8 m_guid[16];
+            AZ::u32 m_subId;
+            AZ::u32 m_pathOffset;
+            AZ::u32 m_pathLength;
+            AZ::u32 m_padding;
+            AZ::u8 m_assetType[16];
+            AZ::u64 m_sizeBytes;
+        };
+
+        // sorted by the hash of the normalized relative path
+        struct PathEntry
+        {
+            AZ::u8 m_guid[16]; // path hash
+            AZ::u8 m_assetGuid[16];
+            AZ::u32 m_assetSubId;
+        };
+
+        // sorted by the legacy asset id
+        struct LegacyEntry
+        {
+            AZ::u8 m_guid[16];
+            AZ::u32 m_subId;
+            AZ::u8 m_assetGuid[16];
+            AZ::u32 m_assetSubId;
+        };
+
+        // sorted by the id of the asset that owns the dependencies
+        struct DependencyListEntry
+        {
+            AZ::u8 m_guid[16];
+            AZ::u32 m_subId;
+            AZ::u32 m_firstDependency;
+            AZ::u32 m_dependencyCount;
+        };
+
+        struct DependencyEntry
+        {
+            AZ::u8 m_guid[16];
+            AZ::u32 m_subId;
+            AZ::u32 m_padding;
+            AZ::u64 m_flags;
+        };
+
+        AZ::Data::AssetInfo ToAssetInfo(const AssetEntry& entry) const;
+
+        AZStd::vector<char> m_image;
+        const AssetEntry* m_assets = nullptr;
+        const PathEntry* m_paths = nullptr;
+        const LegacyEntry* m_legacyIds = nullptr;
+        const DependencyListEntry* m_dependencyLists = nullptr;
+        const DependencyEntry* m_dependencies = nullptr;
+        const char* m_stringPool = nullptr;
+        AZ::u32 m_assetCount = 0;
+        AZ::u32 m_pathCount = 0;
+        AZ::u32 m_legacyCount = 0;
+        AZ::u32 m_dependencyListCount = 0;
+        AZ::u32 m_dependencyCount = 0;
+        AZ::u32 m_stringPoolSize = 0;
+    };
+} // namespace AzFramework
@@ -15,6 +15,7 @@
 #include <AzFramework/Asset/AssetCatalogComponent.h>
 #include <AzFramework/Asset/AssetSystemComponent.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformPropagationSystemComponent.h>
 #include <AzFramework/Components/BootstrapReaderComponent.h>
 #include <AzFramework/Driller/RemoteDrillerInterface.h>
 #include <AzFramework/Entity/GameEntityContextComponent.h>
@@ -36,6 +37,7 @@ namespace AzFramework
             AzFramework::NetBindingComponent::CreateDescriptor(),
             AzFramework::NetBindingSystemComponent::CreateDescriptor(),
             AzFramework::TransformComponent::CreateDescriptor(),
+            AzFramework::TransformPropagationSystemComponent::CreateDescriptor(),
             AzFramework::GameEntityContextComponent::CreateDescriptor(),
     #if !defined(_RELEASE)
             AzFramework::TargetManagementComponent::CreateDescriptor(),
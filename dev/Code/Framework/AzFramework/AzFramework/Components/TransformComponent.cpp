@@ -12,6 +12,7 @@
 #ifndef AZ_UNITY_BUILD
 
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformPropagationBus.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Component/Entity.h>
@@ -224,6 +225,9 @@ namespace AzFramework
         , m_isStatic(false)
         , m_interpolatePosition(AZ::InterpolationMode::NoInterpolation)
         , m_interpolateRotation(AZ::InterpolationMode::NoInterpolation)
+        , m_worldDirty(false)
+        , m_hasPendingNotification(false)
+        , m_isQueued(false)
     {
         m_localTM = AZ::Transform::CreateIdentity();
         m_worldTM = AZ::Transform::CreateIdentity();
@@ -242,6 +246,9 @@ namespace AzFramework
         , m_isStatic(copy.m_isStatic)
         , m_interpolatePosition(copy.m_interpolatePosition)
         , m_interpolateRotation(copy.m_interpolateRotation)
+        , m_worldDirty(false)
+        , m_hasPendingNotification(false)
+        , m_isQueued(false)
         , m_netTargetTranslation()
         , m_netTargetRotation()
         , m_netTargetScale(copy.m_netTargetScale)        
@@ -369,6 +376,18 @@ namespace AzFramework
 
     void TransformComponent::Deactivate()
     {
+        if (m_hasPendingNotification || m_isQueued)
+        {
+            // the pending notification is dropped, descendants that are still pending queue themselves when notified of the deactivation
+            if (m_worldDirty)
+            {
+                ResolveWorldTM();
+            }
+            m_hasPendingNotification = false;
+            m_isQueued = false;
+            TransformPropagationRequestBus::Broadcast(&TransformPropagationRequestBus::Events::DequeueTransform, this);
+        }
+
         EBUS_EVENT_ID(m_parentId, AZ::TransformNotificationBus, OnChildRemoved, GetEntityId());
 
         UnbindFromNetwork();
@@ -423,7 +442,7 @@ namespace AzFramework
 
     void TransformComponent::SetWorldTranslation(const AZ::Vector3& newPosition)
     {
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetTranslation(newPosition);
         SetWorldTM(newWorldTransform);
     }
@@ -437,7 +456,7 @@ namespace AzFramework
 
     AZ::Vector3 TransformComponent::GetWorldTranslation()
     {
-        return m_worldTM.GetPosition();
+        return GetWorldTM().GetPosition();
     }
 
     AZ::Vector3 TransformComponent::GetLocalTranslation()
@@ -447,25 +466,25 @@ namespace AzFramework
 
     void TransformComponent::MoveEntity(const AZ::Vector3& offset)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetPosition();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetPosition();
         SetWorldTranslation(worldPosition + offset);
     }
 
     void TransformComponent::SetWorldX(float x)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetPosition();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetPosition();
         SetWorldTranslation(AZ::Vector3(x, worldPosition.GetY(), worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldY(float y)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetPosition();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetPosition();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), y, worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldZ(float z)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetPosition();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetPosition();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), worldPosition.GetY(), z));
     }
 
@@ -527,7 +546,7 @@ namespace AzFramework
     {
         AZ_Warning("TransformComponent", false, "SetRotation is deprecated, please use SetLocalRotation");
 
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetRotationPartFromQuaternion(AZ::ConvertEulerRadiansToQuaternion(eulerAnglesRadian));
         SetWorldTM(newWorldTransform);
     }
@@ -536,7 +555,7 @@ namespace AzFramework
     {
         AZ_Warning("TransformComponent", false, "SetRotationQuaternion is deprecated, please use SetLocalRotationQuaternion");
 
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetRotationPartFromQuaternion(quaternion);
         SetWorldTM(newWorldTransform);
     }
@@ -545,7 +564,7 @@ namespace AzFramework
     {
         AZ_Warning("TransformComponent", false, "SetRotationX is deprecated, please use SetLocalRotation");
 
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetRotationPartFromQuaternion(AZ::Quaternion::CreateRotationX(eulerAngleRadian));
         SetWorldTM(newWorldTransform);
     }
@@ -554,7 +573,7 @@ namespace AzFramework
     {
         AZ_Warning("TransformComponent", false, "SetRotationY is deprecated, please use SetLocalRotation");
 
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetRotationPartFromQuaternion(AZ::Quaternion::CreateRotationY(eulerAngleRadian));
         SetWorldTM(newWorldTransform);
     }
@@ -563,7 +582,7 @@ namespace AzFramework
     {
         AZ_Warning("TransformComponent", false, "SetRotationZ is deprecated, please use SetLocalRotation");
 
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetRotationPartFromQuaternion(AZ::Quaternion::CreateRotationZ(eulerAngleRadian));
         SetWorldTM(newWorldTransform);
     }
@@ -593,14 +612,14 @@ namespace AzFramework
     {
         AZ_Warning("TransformComponent", false, "GetRotationEulerRadians is deprecated, please use GetWorldRotation");
 
-        return m_worldTM.GetEulerRadians();
+        return GetWorldTM().GetEulerRadians();
     }
 
     AZ::Quaternion TransformComponent::GetRotationQuaternion()
     {
         AZ_Warning("TransformComponent", false, "GetRotationQuaternion is deprecated, please use GetWorldRotationQuaternion");
 
-        return AZ::Quaternion::CreateFromTransform(m_worldTM);
+        return AZ::Quaternion::CreateFromTransform(GetWorldTM());
     }
 
     float TransformComponent::GetRotationX()
@@ -626,7 +645,7 @@ namespace AzFramework
 
     AZ::Vector3 TransformComponent::GetWorldRotation()
     {
-        AZ::Transform rotate = m_worldTM;
+        AZ::Transform rotate = GetWorldTM();
         rotate.ExtractScaleExact();
         AZ::Vector3 angles = rotate.GetEulerRadians();
         return angles;
@@ -634,7 +653,7 @@ namespace AzFramework
 
     AZ::Quaternion TransformComponent::GetWorldRotationQuaternion()
     {
-        AZ::Transform rotate = m_worldTM;
+        AZ::Transform rotate = GetWorldTM();
         rotate.ExtractScaleExact();
         AZ::Quaternion quat = AZ::Quaternion::CreateFromTransform(rotate);
         return quat;
@@ -732,7 +751,7 @@ namespace AzFramework
     {
         AZ_Warning("TransformComponent", false, "SetScale is deprecated, please use SetLocalScale");
 
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         AZ::Vector3 prevScale = newWorldTransform.ExtractScale();
         if (!prevScale.IsClose(scale))
         {
@@ -745,7 +764,7 @@ namespace AzFramework
     {
         AZ_Warning("TransformComponent", false, "SetScaleX is deprecated, please use SetLocalScaleX");
 
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         AZ::Vector3 scale = newWorldTransform.ExtractScale();
         scale.SetX(scaleX);
         newWorldTransform.MultiplyByScale(scale);
@@ -756,7 +775,7 @@ namespace AzFramework
     {
         AZ_Warning("TransformComponent", false, "SetScaleY is deprecated, please use SetLocalScaleY");
 
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         AZ::Vector3 scale = newWorldTransform.ExtractScale();
         scale.SetY(scaleY);
         newWorldTransform.MultiplyByScale(scale);
@@ -767,7 +786,7 @@ namespace AzFramework
     {
         AZ_Warning("TransformComponent", false, "SetScaleZ is deprecated, please use SetLocalScaleZ");
 
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         AZ::Vector3 scale = newWorldTransform.ExtractScale();
         scale.SetZ(scaleZ);
         newWorldTransform.MultiplyByScale(scale);
@@ -778,14 +797,14 @@ namespace AzFramework
     {
         AZ_Warning("TransformComponent", false, "GetScale is deprecated, please use GetLocalScale");
 
-        return m_worldTM.RetrieveScale();
+        return GetWorldTM().RetrieveScale();
     }
 
     float TransformComponent::GetScaleX()
     {
         AZ_Warning("TransformComponent", false, "GetScaleX is deprecated, please use GetLocalScale");
 
-        AZ::Vector3 scale = m_worldTM.RetrieveScale();
+        AZ::Vector3 scale = GetWorldTM().RetrieveScale();
         return scale.GetX();
     }
 
@@ -793,7 +812,7 @@ namespace AzFramework
     {
         AZ_Warning("TransformComponent", false, "GetScaleY is deprecated, please use GetLocalScale");
 
-        AZ::Vector3 scale = m_worldTM.RetrieveScale();
+        AZ::Vector3 scale = GetWorldTM().RetrieveScale();
         return scale.GetY();
     }
 
@@ -801,7 +820,7 @@ namespace AzFramework
     {
         AZ_Warning("TransformComponent", false, "GetScaleZ is deprecated, please use GetLocalScale");
 
-        AZ::Vector3 scale = m_worldTM.RetrieveScale();
+        AZ::Vector3 scale = GetWorldTM().RetrieveScale();
         return scale.GetZ();
     }
 
@@ -848,7 +867,7 @@ namespace AzFramework
 
     AZ::Vector3 TransformComponent::GetWorldScale()
     {
-        AZ::Vector3 scale = m_worldTM.RetrieveScaleExact();
+        AZ::Vector3 scale = GetWorldTM().RetrieveScaleExact();
         return scale;
     }
 
@@ -912,6 +931,7 @@ namespace AzFramework
             // If this transform is network controlled, then the localTM is updated by the network,
             // so update m_parentTM and compute worldTM instead.
             AZ_Assert(parentEntityId == m_parentId, "We expect to receive notifications only from the current parent!");
+            ResolveBeforeParentChange();
             m_parentTM = nullptr;
             m_parentActive = false;
             ComputeWorldTM();
@@ -1081,6 +1101,8 @@ namespace AzFramework
             return;
         }
 
+        ResolveBeforeParentChange();
+
         AZ::EntityId oldParent = m_parentId;
         if (m_parentId.IsValid())
         {
@@ -1116,7 +1138,7 @@ namespace AzFramework
                 SetLocalTM(m_localTM);
             }
 
-            if (oldParent.IsValid())
+            if (oldParent.IsValid() && !m_hasPendingNotification)
             {
                 EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
             }
@@ -1135,13 +1157,33 @@ namespace AzFramework
     void TransformComponent::SetLocalTMImpl(const AZ::Transform& tm)
     {
         m_localTM = tm;
-        ComputeWorldTM();  // We can user dirty flags and compute it later on demand
+        if (TransformPropagationRequests* propagation = GetDeferredPropagation())
+        {
+            MarkWorldTMDirty(propagation);
+            return;
+        }
+        ComputeWorldTM();
     }
 
     void TransformComponent::SetWorldTMImpl(const AZ::Transform& tm)
     {
         m_worldTM = tm;
-        ComputeLocalTM(); // We can user dirty flags and compute it later on demand
+        if (TransformPropagationRequests* propagation = GetDeferredPropagation())
+        {
+            m_worldDirty = false;
+            if (m_parentTM)
+            {
+                m_localTM = m_parentTM->GetWorldTM().GetInverseFull() * m_worldTM;
+            }
+            else if (!m_parentActive)
+            {
+                m_localTM = m_worldTM;
+            }
+            QueueTransformChanged(propagation);
+            MarkChildrenWorldTMDirty();
+            return;
+        }
+        ComputeLocalTM();
     }
 
     void TransformComponent::OnTransformChangedImpl(const AZ::Transform& /*parentLocalTM*/, const AZ::Transform& parentWorldTM)
@@ -1150,6 +1192,16 @@ namespace AzFramework
         // Ignore the event until we've already derived our local transform.
         if (m_parentTM)
         {
+            if (TransformPropagationRequests* propagation = GetDeferredPropagation())
+            {
+                // a pending transform is resolved and notified by the flush that sends this notification
+                if (!m_hasPendingNotification || !propagation->IsFlushingTransforms())
+                {
+                    MarkWorldTMDirty(propagation);
+                }
+                return;
+            }
+
             m_worldTM = parentWorldTM * m_localTM;
             EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
         }
@@ -1210,6 +1262,7 @@ namespace AzFramework
     {
         (void)parentEntityId;
         AZ_Assert(parentEntityId == m_parentId, "We expect to receive notifications only from the current parent!");
+        ResolveBeforeParentChange();
         m_parentTM = nullptr;
         m_parentActive = false;
         ComputeLocalTM();
@@ -1226,11 +1279,46 @@ namespace AzFramework
             m_localTM = m_worldTM;
         }
 
+        if (m_hasPendingNotification)
+        {
+            // deferred propagation, the notification is sent on the next flush
+            return;
+        }
+
         EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
     }
 
     void TransformComponent::ComputeWorldTM()
     {
+        m_worldDirty = false;
+        if (m_parentTM)
+        {
+            m_worldTM = m_parentTM->GetWorldTM() * m_localTM;
+        }
+        else if (!m_parentActive)
+        {
+            m_worldTM = m_localTM;
+        }
+
+        if (m_hasPendingNotification)
+        {
+            // deferred propagation, the descendants may have resolved from the previous world transform
+            MarkChildrenWorldTMDirty();
+            return;
+        }
+
+        EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
+    }
+
+    TransformPropagationRequests* TransformComponent::GetDeferredPropagation()
+    {
+        TransformPropagationRequests* propagation = TransformPropagationRequestBus::FindFirstHandler();
+        return propagation && propagation->IsDeferredPropagationEnabled() ? propagation : nullptr;
+    }
+
+    void TransformComponent::ResolveWorldTM()
+    {
+        m_worldDirty = false;
         if (m_parentTM)
         {
             m_worldTM = m_parentTM->GetWorldTM() * m_localTM;
@@ -1239,7 +1327,70 @@ namespace AzFramework
         {
             m_worldTM = m_localTM;
         }
+    }
+
+    void TransformComponent::MarkWorldTMDirty(TransformPropagationRequests* propagation)
+    {
+        QueueTransformChanged(propagation);
+        if (!m_worldDirty)
+        {
+            m_worldDirty = true;
+            MarkChildrenWorldTMDirty();
+        }
+    }
+
+    void TransformComponent::MarkChildrenWorldTMDirty()
+    {
+        // a dirty transform only has dirty descendants, so the walk stops at the first dirty child and moving the same
+        // parent again in a frame costs nothing
+        AZStd::vector<AZ::EntityId> children;
+        EBUS_EVENT_ID(GetEntityId(), AZ::TransformHierarchyInformationBus, GatherChildren, children);
+        for (const AZ::EntityId& childId : children)
+        {
+            TransformComponent* child = azrtti_cast<TransformComponent*>(AZ::TransformBus::FindFirstHandler(childId));
+            if (child && child->m_parentTM && !child->m_worldDirty)
+            {
+                child->m_worldDirty = true;
+                child->m_hasPendingNotification = true;
+                child->MarkChildrenWorldTMDirty();
+            }
+        }
+    }
+
+    void TransformComponent::QueueTransformChanged(TransformPropagationRequests* propagation)
+    {
+        m_hasPendingNotification = true;
+        if (!m_isQueued)
+        {
+            m_isQueued = true;
+            propagation->QueueTransform(this);
+        }
+    }
+
+    void TransformComponent::ResolveBeforeParentChange()
+    {
+        if (m_worldDirty)
+        {
+            ResolveWorldTM();
+        }
+
+        // without its parent this transform is no longer reached from a queued ancestor
+        if (m_hasPendingNotification && !m_isQueued)
+        {
+            if (TransformPropagationRequests* propagation = GetDeferredPropagation())
+            {
+                QueueTransformChanged(propagation);
+            }
+        }
+    }
 
+    void TransformComponent::SendPendingTransformChanged()
+    {
+        m_hasPendingNotification = false;
+        if (m_worldDirty)
+        {
+            ResolveWorldTM();
+        }
         EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
     }
 
@@ -30,6 +30,7 @@ namespace AzFramework
 {
     class TransformReplicaChunk;
     class GameEntityContextComponent;
+    class TransformPropagationRequests;
 
     /// @deprecated Use AZ::TransformConfig
     using TransformComponentConfiguration = AZ::TransformConfig;
@@ -39,6 +40,8 @@ namespace AzFramework
     * It is net-bindable. Only local transform is synchronized,
     * so when parented, it relies on the parent properly synchronizing
     * his transform as well.
+    * With deferred propagation enabled (see \ref TransformPropagationRequests) moves mark the
+    * sub-hierarchy dirty and the world transforms and notifications are resolved once per frame.
     */
     class TransformComponent
         : public AZ::Component
@@ -50,6 +53,7 @@ namespace AzFramework
         , public NetBindable
     {
         friend class TransformReplicaChunk;
+        friend class TransformPropagationSystemComponent;
 
     public:
         AZ_COMPONENT(TransformComponent, AZ::TransformComponentTypeId, NetBindable, AZ::TransformInterface);
@@ -67,9 +71,9 @@ namespace AzFramework
         /// Returns true if the tm was set to the local transform
         const AZ::Transform& GetLocalTM() override { return m_localTM; }
         /// Returns true if the tm was set to the world transform
-        const AZ::Transform& GetWorldTM() override { return m_worldTM; }
+        const AZ::Transform& GetWorldTM() override { if (m_worldDirty) { ResolveWorldTM(); } return m_worldTM; }
         /// Returns both local and world transforms.
-        void GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM) override { localTM = m_localTM; worldTM = m_worldTM; }
+        void GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM) override { localTM = m_localTM; worldTM = GetWorldTM(); }
         /// Returns parent EntityID or
         AZ::EntityId  GetParentId() override { return m_parentId; }
         /// Returns parent interface if available
@@ -248,6 +252,24 @@ namespace AzFramework
         void ComputeWorldTM();
         //////////////////////////////////////////////////////////////////////////
 
+        //////////////////////////////////////////////////////////////////////////
+        // Deferred propagation
+        /// Returns the propagation system if deferred propagation is enabled, nullptr otherwise.
+        static TransformPropagationRequests* GetDeferredPropagation();
+        /// Recomputes m_worldTM from the parent, the parent resolves itself first if it is dirty.
+        void ResolveWorldTM();
+        /// Marks the world transform of this entity and all its descendants dirty and queues the notification.
+        void MarkWorldTMDirty(TransformPropagationRequests* propagation);
+        /// Marks the world transforms of all descendants dirty.
+        void MarkChildrenWorldTMDirty();
+        /// Queues OnTransformChanged for the next flush.
+        void QueueTransformChanged(TransformPropagationRequests* propagation);
+        /// Resolves the pending world transform before the parent changes, so it's computed from the right parent.
+        void ResolveBeforeParentChange();
+        /// Called by the propagation system on flush.
+        void SendPendingTransformChanged();
+        //////////////////////////////////////////////////////////////////////////
+
         //! Returns whether external calls are currently allowed to move the transform.
         bool AreMoveRequestsAllowed() const;
 
@@ -269,6 +291,9 @@ namespace AzFramework
         bool                                    m_isStatic;                 ///< If true, the transform is static and doesn't move while entity is active.
         AZ::InterpolationMode                   m_interpolatePosition;      ///< Interpolation mode for net-synced position updates
         AZ::InterpolationMode                   m_interpolateRotation;      ///< Interpolation mode for net-synced rotation updates
+        bool                                    m_worldDirty;               ///< Deferred propagation: m_worldTM is stale and is resolved from the parent on use.
+        bool                                    m_hasPendingNotification;   ///< Deferred propagation: OnTransformChanged is sent on the next flush.
+        bool                                    m_isQueued;                 ///< Deferred propagation: queued with the propagation system.
 
         //////////////////////////////////////////////////////////////////////////
         // TransformHierarchyInformationBus
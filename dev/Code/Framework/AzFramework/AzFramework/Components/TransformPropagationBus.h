@@ -0,0 +1,63 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+
+namespace AzFramework
+{
+    class TransformComponent;
+
+    /**
+     * Controls how TransformComponent propagates world transforms down the hierarchy.
+     * By default moving an entity recomputes the world transform of every descendant and sends OnTransformChanged
+     * for each of them straight away. With deferred propagation a move only marks the sub-hierarchy dirty
+     * (GetWorldTM still resolves on demand), the dirty transforms are resolved once per tick, parents before children and
+     * in parallel across independent roots, and every moved entity gets a single OnTransformChanged however often it
+     * moved during the frame.
+     * Call like this:
+     * AzFramework::TransformPropagationRequestBus::Broadcast(&AzFramework::TransformPropagationRequestBus::Events::SetDeferredPropagationEnabled, true);
+     */
+    class TransformPropagationRequests
+        : public AZ::EBusTraits
+    {
+    public:
+        //////////////////////////////////////////////////////////////////////////
+        // EBusTraits overrides
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        static const bool SingleHandlerDirect = true;
+        //////////////////////////////////////////////////////////////////////////
+
+        virtual ~TransformPropagationRequests() = default;
+
+        virtual bool IsDeferredPropagationEnabled() = 0;
+
+        /// Disabling the deferred propagation flushes the pending transforms first.
+        virtual void SetDeferredPropagationEnabled(bool enabled) = 0;
+
+        /// Resolves the pending transforms and sends their notifications now instead of on the next tick,
+        /// e.g. before systems that read transforms through notifications rather than GetWorldTM.
+        virtual void FlushTransforms() = 0;
+
+        /// Used by TransformComponent, adds a transform whose world transform or notification is pending.
+        virtual void QueueTransform(TransformComponent* transform) = 0;
+
+        /// Used by TransformComponent, removes a deactivating transform.
+        virtual void DequeueTransform(TransformComponent* transform) = 0;
+
+        /// Returns true while the notifications of a flush are being sent.
+        virtual bool IsFlushingTransforms() = 0;
+    };
+
+    using TransformPropagationRequestBus = AZ::EBus<TransformPropagationRequests>;
+} // namespace AzFramework
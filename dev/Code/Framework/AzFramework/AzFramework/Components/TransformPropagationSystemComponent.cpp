@@ -0,0 +1,278 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef AZ_UNITY_BUILD
+
+#include <AzFramework/Components/TransformPropagationSystemComponent.h>
+#include <AzFramework/Components/TransformComponent.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AzFramework
+{
+    void TransformPropagationSystemComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<TransformPropagationSystemComponent, AZ::Component>()
+                ->Version(1)
+                ->Field("DeferredPropagation", &TransformPropagationSystemComponent::m_deferredPropagation)
+                ->Field("MinTransformsPerJob", &TransformPropagationSystemComponent::m_minTransformsPerJob)
+                ;
+
+            if (AZ::EditContext* editContext = serializeContext->GetEditContext())
+            {
+                editContext->Class<TransformPropagationSystemComponent>(
+                    "Transform Propagation", "Controls how world transforms are propagated down entity hierarchies")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                        ->Attribute(AZ::Edit::Attributes::Category, "Engine")
+                        ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System", 0xc94d118b))
+                    ->DataElement(AZ::Edit::UIHandlers::CheckBox, &TransformPropagationSystemComponent::m_deferredPropagation,
+                        "Deferred Propagation", "Resolve moved hierarchies once per frame and send a single OnTransformChanged per entity,\n"
+                                                "instead of recomputing and notifying all descendants on every move.")
+                    ->DataElement(AZ::Edit::UIHandlers::SpinBox, &TransformPropagationSystemComponent::m_minTransformsPerJob,
+                        "Min Transforms Per Job", "Independent hierarchies are resolved on the job workers when a frame has at least twice this many moved transforms.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 1)
+                ;
+            }
+        }
+    }
+
+    void TransformPropagationSystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC("TransformPropagationService", 0xad5ed936));
+    }
+
+    void TransformPropagationSystemComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC("TransformPropagationService", 0xad5ed936));
+    }
+
+    void TransformPropagationSystemComponent::Activate()
+    {
+        TransformPropagationRequestBus::Handler::BusConnect();
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void TransformPropagationSystemComponent::Deactivate()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        FlushTransforms();
+        TransformPropagationRequestBus::Handler::BusDisconnect();
+    }
+
+    void TransformPropagationSystemComponent::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
+    {
+        FlushTransforms();
+    }
+
+    int TransformPropagationSystemComponent::GetTickOrder()
+    {
+        return AZ::ComponentTickBus::TICK_PRE_RENDER;
+    }
+
+    void TransformPropagationSystemComponent::SetDeferredPropagationEnabled(bool enabled)
+    {
+        if (!enabled)
+        {
+            FlushTransforms();
+        }
+        m_deferredPropagation = enabled;
+    }
+
+    void TransformPropagationSystemComponent::QueueTransform(TransformComponent* transform)
+    {
+        m_queue.push_back(transform);
+    }
+
+    void TransformPropagationSystemComponent::DequeueTransform(TransformComponent* transform)
+    {
+        auto queueIt = AZStd::find(m_queue.begin(), m_queue.end(), transform);
+        if (queueIt != m_queue.end())
+        {
+            *queueIt = m_queue.back();
+            m_queue.pop_back();
+        }
+
+        if (m_isFlushing)
+        {
+            // notification handlers can deactivate entities that are still to be notified
+            auto orderIt = AZStd::find(m_flushOrder.begin(), m_flushOrder.end(), transform);
+            if (orderIt != m_flushOrder.end())
+            {
+                *orderIt = nullptr;
+            }
+        }
+    }
+
+    void TransformPropagationSystemComponent::FlushTransforms()
+    {
+        if (m_isFlushing || m_queue.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
+
+        m_isFlushing = true;
+        m_flushQueue.swap(m_queue);
+        for (TransformComponent* transform : m_flushQueue)
+        {
+            transform->m_isQueued = false;
+        }
+
+        // A pending transform is either queued or has a pending parent, so the queued transforms without a pending
+        // parent are the roots of disjoint hierarchies that contain every pending transform.
+        for (TransformComponent* transform : m_flushQueue)
+        {
+            if (transform->m_hasPendingNotification)
+            {
+                TransformComponent* parent = azrtti_cast<TransformComponent*>(transform->m_parentTM);
+                if (!parent || !parent->m_hasPendingNotification)
+                {
+                    GatherHierarchy(transform);
+                }
+            }
+        }
+        m_flushQueue.clear();
+
+        ResolveHierarchies();
+
+        // notify on the main thread, parents before children as the immediate propagation does
+        for (size_t i = 0; i < m_flushOrder.size(); ++i)
+        {
+            if (TransformComponent* transform = m_flushOrder[i])
+            {
+                transform->SendPendingTransformChanged();
+            }
+        }
+
+        m_flushOrder.clear();
+        m_hierarchies.clear();
+        m_isFlushing = false;
+    }
+
+    void TransformPropagationSystemComponent::GatherHierarchy(TransformComponent* root)
+    {
+        HierarchyRange range;
+        range.m_begin = m_flushOrder.size();
+        m_flushOrder.push_back(root);
+        for (size_t i = range.m_begin; i < m_flushOrder.size(); ++i)
+        {
+            m_children.clear();
+            AZ::TransformHierarchyInformationBus::Event(m_flushOrder[i]->GetEntityId(), &AZ::TransformHierarchyInformationBus::Events::GatherChildren, m_children);
+            for (const AZ::EntityId& childId : m_children)
+            {
+                TransformComponent* child = azrtti_cast<TransformComponent*>(AZ::TransformBus::FindFirstHandler(childId));
+                if (child && child->m_hasPendingNotification)
+                {
+                    m_flushOrder.push_back(child);
+                }
+            }
+        }
+        range.m_end = m_flushOrder.size();
+        m_hierarchies.push_back(range);
+    }
+
+    void TransformPropagationSystemComponent::ResolveHierarchies()
+    {
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const size_t workerCount = jobContext ? jobContext->GetJobManager().GetNumWorkerThreads() : 0;
+        const size_t minTransformsPerJob = AZStd::max<size_t>(m_minTransformsPerJob, 1);
+        const size_t jobCount = AZStd::min(AZStd::min(workerCount, m_flushOrder.size() / minTransformsPerJob), m_hierarchies.size());
+        if (jobCount <= 1)
+        {
+            ResolveWorldTMs(m_flushOrder.data(), m_flushOrder.size());
+            return;
+        }
+
+        // the hierarchies are disjoint and the root's parents are resolved, so each job can take whole hierarchies
+        AZStd::atomic<size_t> nextHierarchy(0);
+        AZ::JobCompletion jobCompletion;
+        for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+        {
+            AZ::Job* job = AZ::CreateJobFunction([this, &nextHierarchy]()
+            {
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzFramework, "TransformPropagationSystemComponent::ResolveHierarchies::Job");
+                for (size_t index = nextHierarchy.fetch_add(1); index < m_hierarchies.size(); index = nextHierarchy.fetch_add(1))
+                {
+                    const HierarchyRange& range = m_hierarchies[index];
+                    ResolveWorldTMs(m_flushOrder.data() + range.m_begin, range.m_end - range.m_begin);
+                }
+            }, true, jobContext);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+    void TransformPropagationSystemComponent::ResolveWorldTMs(TransformComponent* const* transforms, size_t count)
+    {
+        // breadth first order keeps siblings together and has every parent resolved before its children
+        const size_t batchCapacity = 16;
+        AZ::Transform localTMs[batchCapacity];
+        AZ::Transform worldTMs[batchCapacity];
+        TransformComponent* batch[batchCapacity];
+        AZ::TransformInterface* batchParent = nullptr;
+        size_t batchSize = 0;
+
+        auto resolveBatch = [&]()
+        {
+            if (batchSize)
+            {
+                AZ::MultiplyTransforms(batchParent->GetWorldTM(), localTMs, worldTMs, batchSize);
+                for (size_t i = 0; i < batchSize; ++i)
+                {
+                    batch[i]->m_worldTM = worldTMs[i];
+                    batch[i]->m_worldDirty = false;
+                }
+                batchSize = 0;
+            }
+        };
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            TransformComponent* transform = transforms[i];
+            if (!transform->m_worldDirty)
+            {
+                continue;
+            }
+
+            if (!transform->m_parentTM)
+            {
+                transform->ResolveWorldTM();
+                continue;
+            }
+
+            if (transform->m_parentTM != batchParent || batchSize == batchCapacity)
+            {
+                resolveBatch();
+                batchParent = transform->m_parentTM;
+            }
+            localTMs[batchSize] = transform->m_localTM;
+            batch[batchSize] = transform;
+            ++batchSize;
+        }
+        resolveBatch();
+    }
+} // namespace AzFramework
+
+#endif // #ifndef AZ_UNITY_BUILD
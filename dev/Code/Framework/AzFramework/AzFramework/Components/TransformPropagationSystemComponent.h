@@ -0,0 +1,91 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Components/TransformPropagationBus.h>
+
+namespace AzFramework
+{
+    /**
+     * Owns the deferred world transform propagation of TransformComponent (see \ref TransformPropagationRequests).
+     * Deferred propagation is off unless enabled in the configuration or through the bus. The pending transforms are
+     * flushed on the tick, before rendering.
+     */
+    class TransformPropagationSystemComponent
+        : public AZ::Component
+        , public TransformPropagationRequestBus::Handler
+        , protected AZ::TickBus::Handler
+    {
+    public:
+        AZ_COMPONENT(TransformPropagationSystemComponent, "{6B1E9B0D-5C2F-4E8A-A7C3-2D4F9E81B6A5}");
+
+        TransformPropagationSystemComponent() = default;
+        ~TransformPropagationSystemComponent() override = default;
+
+        //////////////////////////////////////////////////////////////////////////
+        // TransformPropagationRequests
+        bool IsDeferredPropagationEnabled() override { return m_deferredPropagation; }
+        void SetDeferredPropagationEnabled(bool enabled) override;
+        void FlushTransforms() override;
+        void QueueTransform(TransformComponent* transform) override;
+        void DequeueTransform(TransformComponent* transform) override;
+        bool IsFlushingTransforms() override { return m_isFlushing; }
+        //////////////////////////////////////////////////////////////////////////
+
+        static void Reflect(AZ::ReflectContext* context);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+    protected:
+        //////////////////////////////////////////////////////////////////////////
+        // Component
+        void Activate() override;
+        void Deactivate() override;
+        //////////////////////////////////////////////////////////////////////////
+
+        //////////////////////////////////////////////////////////////////////////
+        // TickBus
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+        //////////////////////////////////////////////////////////////////////////
+
+    private:
+        struct HierarchyRange
+        {
+            size_t m_begin;
+            size_t m_end;
+        };
+
+        /// Appends the root and all its pending descendants to m_flushOrder, parents before children.
+        void GatherHierarchy(TransformComponent* root);
+
+        /// Resolves the world transforms of the gathered hierarchies, spread across the job workers when there are enough of them.
+        void ResolveHierarchies();
+
+        /// Resolves the world transforms of a range in m_flushOrder, siblings are multiplied by their parent in batches.
+        static void ResolveWorldTMs(TransformComponent* const* transforms, size_t count);
+
+        bool m_deferredPropagation = false;         ///< Serialized, enables the deferred propagation on activation.
+        AZ::u32 m_minTransformsPerJob = 256;         ///< Serialized, hierarchies are resolved on the job workers only when a flush has at least twice this many transforms.
+
+        bool m_isFlushing = false;
+        AZStd::vector<TransformComponent*> m_queue;          ///< Transforms queued since the last flush.
+        AZStd::vector<TransformComponent*> m_flushQueue;     ///< The queue being flushed, swapped with m_queue so flushing can queue again.
+        AZStd::vector<TransformComponent*> m_flushOrder;     ///< All transforms of the current flush, each hierarchy in breadth first order.
+        AZStd::vector<HierarchyRange> m_hierarchies;        ///< Ranges of independent hierarchies in m_flushOrder.
+        AZStd::vector<AZ::EntityId> m_children;              ///< Scratch for gathering children.
+    };
+} // namespace AzFramework
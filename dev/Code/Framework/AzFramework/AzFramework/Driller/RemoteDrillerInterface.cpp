@@ -142,6 +142,8 @@ namespace AzFramework
     //---------------------------------------------------------------------
     void DrillerRemoteSession::StopDrilling()
     {
+        StopLoadingCaptureData();
+
         EBUS_EVENT(DrillerNetworkConsoleCommandBus, StopRemoteDrillerSession, static_cast<AZ::u64>(reinterpret_cast<size_t>(this)));
         BusDisconnect();
 #ifdef ENABLE_COMPRESSION_FOR_REMOTE_DRILLER
@@ -156,38 +158,74 @@ namespace AzFramework
     //---------------------------------------------------------------------
     void DrillerRemoteSession::LoadCaptureData(const char* fileName)
     {
+        if (StartLoadingCaptureData(fileName))
+        {
+            while (LoadCaptureDataChunk())
+            {
+            }
+            StopLoadingCaptureData();
+        }
+    }
+    //---------------------------------------------------------------------
+    bool DrillerRemoteSession::StartLoadingCaptureData(const char* fileName)
+    {
+        StopLoadingCaptureData();
+
         m_captureFile.Open(fileName, AZ::IO::SystemFile::SF_OPEN_READ_ONLY);
         AZ_Warning("DrillerRemoteSession", m_captureFile.IsOpen(), "Failed to open %s. No driller data could be loaded.", fileName);
-        if (m_captureFile.IsOpen())
+        if (!m_captureFile.IsOpen())
         {
+            return false;
+        }
+
 #ifdef ENABLE_COMPRESSION_FOR_REMOTE_DRILLER
-            m_decompressor.StartDecompressor();
+        m_decompressor.StartDecompressor();
 #endif
-            AZ::IO::SystemFile::SizeType bytesRemaining = m_captureFile.Length();
-            AZ::IO::SystemFile::SizeType maxReadChunkSize = 1024 * 1024;
-            AZStd::vector<char> readBuffer;
-            readBuffer.resize_no_construct(static_cast<size_t>(maxReadChunkSize));
-            while (bytesRemaining > 0)
-            {
-                AZ::IO::SystemFile::SizeType bytesToRead = bytesRemaining < maxReadChunkSize ? bytesRemaining : maxReadChunkSize;
-                if (m_captureFile.Read(bytesToRead, readBuffer.data()) != bytesToRead)
-                {
-                    AZ_Warning("DrillerRemoteSession", false, "Failed reading driller data. No more driller data can be read.");
-                    break;
-                }
+        m_captureBytesRemaining = m_captureFile.Length();
+        m_isLoadingCaptureData = true;
+        return true;
+    }
+    //---------------------------------------------------------------------
+    bool DrillerRemoteSession::LoadCaptureDataChunk(AZ::IO::SystemFile::SizeType maxReadSize)
+    {
+        if (!m_isLoadingCaptureData || m_captureBytesRemaining == 0)
+        {
+            return false;
+        }
+
+        AZ::IO::SystemFile::SizeType bytesToRead = m_captureBytesRemaining < maxReadSize ? m_captureBytesRemaining : maxReadSize;
+        m_captureReadBuffer.resize_no_construct(static_cast<size_t>(bytesToRead));
+        if (m_captureFile.Read(bytesToRead, m_captureReadBuffer.data()) != bytesToRead)
+        {
+            AZ_Warning("DrillerRemoteSession", false, "Failed reading driller data. No more driller data can be read.");
+            m_captureBytesRemaining = 0;
+            return false;
+        }
 #ifdef ENABLE_COMPRESSION_FOR_REMOTE_DRILLER
-                Decompress(readBuffer.data(), static_cast<size_t>(bytesToRead));
-                ProcessIncomingDrillerData(fileName, m_uncompressedMsgBuffer.data(), m_uncompressedMsgBuffer.size());
+        Decompress(m_captureReadBuffer.data(), static_cast<size_t>(bytesToRead));
+        ProcessIncomingDrillerData(m_captureFile.Name(), m_uncompressedMsgBuffer.data(), m_uncompressedMsgBuffer.size());
 #else
-                ProcessIncomingDrillerData(fileName, readBuffer.data(), readBuffer.size());
+        ProcessIncomingDrillerData(m_captureFile.Name(), m_captureReadBuffer.data(), static_cast<size_t>(bytesToRead));
 #endif
-                bytesRemaining -= bytesToRead;
-            }
+        m_captureBytesRemaining -= bytesToRead;
+        return m_captureBytesRemaining > 0;
+    }
+    //---------------------------------------------------------------------
+    void DrillerRemoteSession::StopLoadingCaptureData()
+    {
+        if (!m_isLoadingCaptureData)
+        {
+            return;
+        }
+
 #ifdef ENABLE_COMPRESSION_FOR_REMOTE_DRILLER
-            m_decompressor.StopDecompressor();
+        m_decompressor.StopDecompressor();
 #endif
-            m_captureFile.Close();
-        }
+        m_captureFile.Close();
+        m_captureReadBuffer.clear();
+        m_captureReadBuffer.shrink_to_fit();
+        m_captureBytesRemaining = 0;
+        m_isLoadingCaptureData = false;
     }
     //---------------------------------------------------------------------
     void DrillerRemoteSession::OnReceivedMsg(TmMsgPtr msg)
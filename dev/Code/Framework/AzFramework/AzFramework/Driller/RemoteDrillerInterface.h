@@ -56,6 +56,14 @@ namespace AzFramework
         // Replay a previously captured driller session from file
         void    LoadCaptureData(const char* fileName);
 
+        // Replay a previously captured driller session from file a chunk at a time, so that tools can show the
+        // frames loaded so far and stay responsive while large captures are read.
+        // LoadCaptureDataChunk returns true while there is more data left to read.
+        bool    StartLoadingCaptureData(const char* fileName);
+        bool    LoadCaptureDataChunk(AZ::IO::SystemFile::SizeType maxReadSize = c_captureReadChunkSize);
+        void    StopLoadingCaptureData();
+        bool    IsLoadingCaptureData() const { return m_isLoadingCaptureData; }
+
     protected:
         //---------------------------------------------------------------------
         // TmMsgBus
@@ -66,6 +74,7 @@ namespace AzFramework
         void Decompress(const void* compressedBuffer, size_t compressedBufferSize);
 
         static const AZ::u32 c_decompressionBufferSize = 128 * 1024;
+        static const AZ::u32 c_captureReadChunkSize = 1024 * 1024;
 
         AZStd::vector<char>         m_uncompressedMsgBuffer;
 #ifdef ENABLE_COMPRESSION_FOR_REMOTE_DRILLER
@@ -73,6 +82,9 @@ namespace AzFramework
         char                        m_decompressionBuffer[c_decompressionBufferSize];
 #endif
         AZ::IO::SystemFile          m_captureFile;
+        AZStd::vector<char>         m_captureReadBuffer;
+        AZ::IO::SystemFile::SizeType m_captureBytesRemaining = 0;
+        bool                        m_isLoadingCaptureData = false;
     };
 
     /**
@@ -200,6 +200,9 @@ namespace AzFramework
             DispatchOnSliceInstantiationFailed(ticket, idToNotify, true);
         }
 
+        // Pools are configured per level, the spare instances are dropped along with the rest of the context.
+        ReleaseSliceInstancePools();
+
         DestroyRootSliceEntities();
 
         // Re-create fresh root slice asset.
@@ -554,6 +557,190 @@ namespace AzFramework
         }
     }
 
+    //=========================================================================
+    // SetSliceInstancePoolSize
+    //=========================================================================
+    void EntityContext::SetSliceInstancePoolSize(const AZ::Data::Asset<AZ::Data::AssetData>& asset, AZ::u32 poolSize)
+    {
+        const AZ::Data::AssetId assetId = asset.GetId();
+        if (!assetId.IsValid())
+        {
+            return;
+        }
+
+        AZ::SliceComponent* poolSlice = m_sliceInstancePoolAsset ? m_sliceInstancePoolAsset.Get()->GetComponent() : nullptr;
+
+        if (poolSize == 0)
+        {
+            m_sliceInstancePools.erase(assetId);
+            if (poolSlice)
+            {
+                poolSlice->RemoveSlice(asset);
+            }
+            return;
+        }
+
+        SliceInstancePool& pool = m_sliceInstancePools[assetId];
+        pool.m_asset = asset;
+        pool.m_stats.m_poolSize = poolSize;
+
+        if (pool.m_stats.m_available > poolSize && poolSlice)
+        {
+            // Shrinking the pool, start over rather than picking instances to destroy.
+            poolSlice->RemoveSlice(asset);
+            pool.m_stats.m_available = 0;
+        }
+
+        pool.m_asset.QueueLoad();
+
+        // OnAssetReady fills the pool, it is sent on connection if the asset is already loaded.
+        AZ::Data::AssetBus::MultiHandler::BusConnect(assetId);
+    }
+
+    //=========================================================================
+    // GetSliceInstancePoolStats
+    //=========================================================================
+    SliceInstancePoolStats EntityContext::GetSliceInstancePoolStats(const AZ::Data::AssetId& assetId) const
+    {
+        auto poolIter = m_sliceInstancePools.find(assetId);
+        return poolIter != m_sliceInstancePools.end() ? poolIter->second.m_stats : SliceInstancePoolStats();
+    }
+
+    //=========================================================================
+    // AcquirePooledSliceInstance
+    //=========================================================================
+    AZ::SliceComponent::SliceInstanceAddress EntityContext::AcquirePooledSliceInstance(const AZ::Data::Asset<AZ::Data::AssetData>& asset, const AZ::IdUtils::Remapper<AZ::EntityId>::IdMapper& customMapper)
+    {
+        auto poolIter = m_sliceInstancePools.find(asset.GetId());
+        if (poolIter == m_sliceInstancePools.end())
+        {
+            return AZ::SliceComponent::SliceInstanceAddress();
+        }
+
+        SliceInstancePool& pool = poolIter->second;
+        AZ::SliceComponent* poolSlice = m_sliceInstancePoolAsset ? m_sliceInstancePoolAsset.Get()->GetComponent() : nullptr;
+        AZ::SliceComponent::SliceReference* reference = poolSlice ? poolSlice->GetSlice(asset.GetId()) : nullptr;
+
+        // Pooled instances already have their generated ids, so requests that map ids themselves have to clone the slice.
+        if (customMapper || !reference || reference->GetInstances().empty())
+        {
+            ++pool.m_stats.m_misses;
+            return AZ::SliceComponent::SliceInstanceAddress();
+        }
+
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
+
+        // The instance is moved out of the set, it is only modified through the reference that owns it.
+        AZ::SliceComponent::SliceInstance* pooledInstance = const_cast<AZ::SliceComponent::SliceInstance*>(&*reference->GetInstances().begin());
+        AZ::SliceComponent::SliceInstanceAddress instance = m_rootAsset.Get()->GetComponent()->AddSliceInstance(reference, pooledInstance);
+
+        if (instance.IsValid())
+        {
+            ++pool.m_stats.m_hits;
+        }
+        else
+        {
+            ++pool.m_stats.m_misses;
+        }
+
+        pool.m_stats.m_available = static_cast<AZ::u32>(reference->GetInstances().size());
+        QueueFillSliceInstancePools();
+
+        return instance;
+    }
+
+    //=========================================================================
+    // FillSliceInstancePools
+    //=========================================================================
+    void EntityContext::FillSliceInstancePools()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
+
+        m_sliceInstancePoolFillQueued = false;
+
+        if (!m_rootAsset || m_sliceInstancePools.empty())
+        {
+            return;
+        }
+
+        if (!m_sliceInstancePoolAsset)
+        {
+            m_sliceInstancePoolAsset.Create(AZ::Data::AssetId(AZ::Uuid::CreateRandom()), false);
+            AZ::Data::AssetBus::MultiHandler::BusConnect(m_sliceInstancePoolAsset.GetId());
+
+            AZ::Entity* poolEntity = new AZ::Entity();
+            AZ::SliceComponent* poolSliceComponent = poolEntity->CreateComponent<AZ::SliceComponent>();
+            m_sliceInstancePoolAsset.Get()->SetData(poolEntity, poolSliceComponent);
+            poolSliceComponent->SetMyAsset(m_sliceInstancePoolAsset.Get());
+            poolSliceComponent->SetSerializeContext(m_serializeContext);
+        }
+
+        AZ::SliceComponent* poolSlice = m_sliceInstancePoolAsset.Get()->GetComponent();
+
+        // Slices added to an instantiated component are instantiated right away.
+        poolSlice->Instantiate();
+
+        for (auto& poolPair : m_sliceInstancePools)
+        {
+            SliceInstancePool& pool = poolPair.second;
+            if (!pool.m_asset.IsReady())
+            {
+                continue;
+            }
+
+            AZ::SliceComponent::SliceReference* reference = poolSlice->GetSlice(poolPair.first);
+            AZ::u32 available = reference ? static_cast<AZ::u32>(reference->GetInstances().size()) : 0;
+
+            while (available < pool.m_stats.m_poolSize)
+            {
+                AZ::SliceComponent::SliceInstanceAddress instance = poolSlice->AddSlice(pool.m_asset);
+                if (!instance.IsValid() || !instance.GetInstance()->GetInstantiated())
+                {
+                    AZ_Warning("EntityContext", false, "Failed to instantiate slice %s for its instance pool.", pool.m_asset.ToString<AZStd::string>().c_str());
+                    if (instance.IsValid())
+                    {
+                        poolSlice->RemoveSliceInstance(instance);
+                    }
+                    break;
+                }
+                ++available;
+            }
+
+            pool.m_stats.m_available = available;
+        }
+    }
+
+    //=========================================================================
+    // QueueFillSliceInstancePools
+    //=========================================================================
+    void EntityContext::QueueFillSliceInstancePools()
+    {
+        // Refilling is deferred so that instantiating the replacements doesn't add to the cost of the request that used the pool.
+        if (!m_sliceInstancePoolFillQueued)
+        {
+            m_sliceInstancePoolFillQueued = true;
+            AZ::TickBus::QueueFunction([this]() { FillSliceInstancePools(); });
+        }
+    }
+
+    //=========================================================================
+    // ReleaseSliceInstancePools
+    //=========================================================================
+    void EntityContext::ReleaseSliceInstancePools()
+    {
+        for (const auto& poolPair : m_sliceInstancePools)
+        {
+            AZ::Data::AssetBus::MultiHandler::BusDisconnect(poolPair.first);
+        }
+        m_sliceInstancePools.clear();
+
+        if (m_sliceInstancePoolAsset)
+        {
+            AZ::Data::AssetBus::MultiHandler::BusDisconnect(m_sliceInstancePoolAsset.GetId());
+            m_sliceInstancePoolAsset = nullptr;
+        }
+    }
+
     //=========================================================================
     // CloneSliceInstance
     //=========================================================================
@@ -764,7 +951,7 @@ namespace AzFramework
 
         AZ_Assert(readyAsset.GetAs<AZ::SliceAsset>(), "Asset is not a slice!");
 
-        if (readyAsset == m_rootAsset)
+        if (readyAsset == m_rootAsset || readyAsset == m_sliceInstancePoolAsset)
         {
             return;
         }
@@ -786,7 +973,11 @@ namespace AzFramework
                         AZ::Data::Asset<AZ::Data::AssetData> asset = instantiating.m_asset;
                         SliceInstantiationTicket ticket = instantiating.m_ticket;
                         m_instantiatingAssetId = instantiating.m_asset.GetId();
-                        AZ::SliceComponent::SliceInstanceAddress instance = m_rootAsset.Get()->GetComponent()->AddSlice(asset, instantiating.m_customMapper);
+                        AZ::SliceComponent::SliceInstanceAddress instance = AcquirePooledSliceInstance(asset, instantiating.m_customMapper);
+                        if (!instance.IsValid())
+                        {
+                            instance = m_rootAsset.Get()->GetComponent()->AddSlice(asset, instantiating.m_customMapper);
+                        }
 
                         // its important to remove this instantiation from the instantiation list
                         // as soon as possible, before we call these below notification functions, because they might result in our own functions
@@ -835,6 +1026,11 @@ namespace AzFramework
                         ++iter;
                     }
                 }
+
+                if (m_sliceInstancePools.find(readyAssetId) != m_sliceInstancePools.end())
+                {
+                    FillSliceInstancePools();
+                }
             };
 
         // Instantiation is queued against the tick bus. This ensures we're not holding the AssetBus lock
@@ -850,6 +1046,15 @@ namespace AzFramework
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
 
+        if (asset == m_sliceInstancePoolAsset && asset.Get() != m_sliceInstancePoolAsset.Get())
+        {
+            // A pooled slice changed, the reloaded pool holds instances made from the new data.
+            m_sliceInstancePoolAsset = asset;
+            m_sliceInstancePoolAsset.Get()->GetComponent()->ListenForAssetChanges();
+            FillSliceInstancePools();
+            return;
+        }
+
         if (asset == m_rootAsset && asset.Get() != m_rootAsset.Get())
         {
             ResetContext();
@@ -92,6 +92,16 @@ namespace AzFramework
          */
         virtual AZ::SliceComponent::SliceInstanceAddress CloneSliceInstance(AZ::SliceComponent::SliceInstanceAddress sourceInstance, AZ::SliceComponent::EntityIdToEntityIdMap& sourceToCloneEntityIdMap);
 
+        /// Keep a number of instances of a slice asset instantiated ahead of time, so that InstantiateSlice() requests
+        /// for the asset can be served without cloning the slice. Used instances are replaced on the next tick.
+        /// Requests that provide a custom id mapper always clone the slice.
+        /// \param asset slice asset to pool. The asset is queued for loading if it isn't already.
+        /// \param poolSize number of instances to keep available. 0 releases the pool.
+        void SetSliceInstancePoolSize(const AZ::Data::Asset<AZ::Data::AssetData>& asset, AZ::u32 poolSize);
+
+        /// \return usage counters of the pool for the given slice asset. All zero if the asset isn't pooled.
+        SliceInstancePoolStats GetSliceInstancePoolStats(const AZ::Data::AssetId& assetId) const;
+
         /// Load the root slice from a stream.
         /// \return whether or not the root slice was successfully loaded from the provided stream.
         /// \param stream - the source stream from which to load
@@ -181,6 +191,15 @@ namespace AzFramework
         /// \return true if this context owns the entity with the given id.
         bool IsOwnedByThisContext(const AZ::EntityId& entityId);
 
+        /// Moves an instance out of the pool for the asset into the root slice.
+        /// \return the instance, or an invalid address if the request can't be served from the pool.
+        AZ::SliceComponent::SliceInstanceAddress AcquirePooledSliceInstance(const AZ::Data::Asset<AZ::Data::AssetData>& asset, const AZ::IdUtils::Remapper<AZ::EntityId>::IdMapper& customMapper);
+
+        /// Instantiates instances into the pools that are below their configured size and whose asset is ready.
+        void FillSliceInstancePools();
+        void QueueFillSliceInstancePools();
+        void ReleaseSliceInstancePools();
+
         /// Helper function to send OnSliceInstantiationFailed events.
         static void DispatchOnSliceInstantiationFailed(const SliceInstantiationTicket& ticket, const AZ::Data::AssetId& assetId, bool canceled);
 
@@ -210,6 +229,19 @@ namespace AzFramework
 
         // Slices queued for instantation. AZStd::list is used for its stable iterators since elements are deleted during traversal in Entitycontext::OnAssetReady
         AZStd::list<InstantiatingSliceInfo> m_queuedSliceInstantiations;
+        /// Slice assets with pre-instantiated instances, see SetSliceInstancePoolSize().
+        struct SliceInstancePool
+        {
+            AZ::Data::Asset<AZ::Data::AssetData>            m_asset;
+            SliceInstancePoolStats                          m_stats;
+        };
+
+        AZStd::unordered_map<AZ::Data::AssetId, SliceInstancePool> m_sliceInstancePools;
+        // Holds the pooled instances until they are handed out. Owned by an asset like the root slice so that changes
+        // to the pooled slices reach it the same way.
+        AZ::Data::Asset<AZ::SliceAsset> m_sliceInstancePoolAsset;
+        bool m_sliceInstancePoolFillQueued = false;
+
         // Tracks if the context is currently being reset.
         // This allows systems to skip steps during teardown that will be handled in bulk by the reset.
         bool m_contextIsResetting = false;
@@ -113,6 +113,18 @@ namespace AzFramework
         AZ::u64 m_requestId;
     };
 
+    /**
+     * Usage counters of the pool of pre-instantiated instances that an entity
+     * context keeps for a slice asset.
+     */
+    struct SliceInstancePoolStats
+    {
+        AZ::u32 m_poolSize = 0;     ///< Number of instances the context keeps ready for the slice.
+        AZ::u32 m_available = 0;    ///< Number of instances that are ready right now.
+        AZ::u64 m_hits = 0;         ///< Instantiations that were served from the pool.
+        AZ::u64 m_misses = 0;       ///< Instantiations that had to clone the slice because the pool was empty.
+    };
+
     /**
      * Interface for AzFramework::EntityContextRequestBus, which is
      * the EBus that makes requests to a given entity context. 
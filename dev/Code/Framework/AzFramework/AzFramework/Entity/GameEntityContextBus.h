@@ -140,6 +140,23 @@ namespace AzFramework
          */
         virtual void CancelDynamicSliceInstantiation(const SliceInstantiationTicket& /*ticket*/) = 0;
 
+        /**
+         * Keeps a number of instances of a dynamic slice instantiated ahead of time, so that
+         * requests to instantiate the slice finish without cloning it. Call this when a level
+         * is loaded to pre-warm the slices it spawns often. Pools are released when the game
+         * context is reset.
+         * @param sliceAsset The dynamic slice asset to pool.
+         * @param poolSize The number of instances to keep ready. Use 0 to release the pool.
+         */
+        virtual void SetDynamicSlicePoolSize(const AZ::Data::Asset<AZ::Data::AssetData>& /*sliceAsset*/, AZ::u32 /*poolSize*/) {}
+
+        /**
+         * Returns how often instantiations of a pooled dynamic slice were served from its pool.
+         * @param sliceAssetId The ID of the dynamic slice asset.
+         * @return The pool counters. All zero if the slice is not pooled.
+         */
+        virtual SliceInstancePoolStats GetDynamicSlicePoolStats(const AZ::Data::AssetId& /*sliceAssetId*/) { return SliceInstancePoolStats(); }
+
         /**
          * Loads game entities from a stream.
          * @param stream The root slice.
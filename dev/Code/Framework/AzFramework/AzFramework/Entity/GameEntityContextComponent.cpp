@@ -414,6 +414,22 @@ namespace AzFramework
         CancelSliceInstantiation(ticket);
     }
 
+    //=========================================================================
+    // GameEntityContextRequestBus::SetDynamicSlicePoolSize
+    //=========================================================================
+    void GameEntityContextComponent::SetDynamicSlicePoolSize(const AZ::Data::Asset<AZ::Data::AssetData>& sliceAsset, AZ::u32 poolSize)
+    {
+        SetSliceInstancePoolSize(sliceAsset, poolSize);
+    }
+
+    //=========================================================================
+    // GameEntityContextRequestBus::GetDynamicSlicePoolStats
+    //=========================================================================
+    SliceInstancePoolStats GameEntityContextComponent::GetDynamicSlicePoolStats(const AZ::Data::AssetId& sliceAssetId)
+    {
+        return GetSliceInstancePoolStats(sliceAssetId);
+    }
+
     //=========================================================================
     // EntityContextEventBus::LoadFromStream
     //=========================================================================
@@ -62,6 +62,8 @@ namespace AzFramework
         void DeactivateGameEntity(const AZ::EntityId&) override;
         SliceInstantiationTicket InstantiateDynamicSlice(const AZ::Data::Asset<AZ::Data::AssetData>& sliceAsset, const AZ::Transform& worldTransform, const AZ::IdUtils::Remapper<AZ::EntityId>::IdMapper& customIdMapper) override;
         void CancelDynamicSliceInstantiation(const SliceInstantiationTicket& ticket) override;
+        void SetDynamicSlicePoolSize(const AZ::Data::Asset<AZ::Data::AssetData>& sliceAsset, AZ::u32 poolSize) override;
+        SliceInstancePoolStats GetDynamicSlicePoolStats(const AZ::Data::AssetId& sliceAssetId) override;
         bool LoadFromStream(AZ::IO::GenericStream& stream, bool remapIds) override;
         AZStd::string GetEntityName(const AZ::EntityId& id) override;
         void MarkEntityForNoActivation(AZ::EntityId entityId) override;
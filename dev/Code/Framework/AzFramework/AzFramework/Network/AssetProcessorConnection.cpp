@@ -979,6 +979,21 @@ namespace AzFramework
             return SendRequest(typeId, requestSerial, dataBuffer, dataLength, handler);
         }
 
+        bool AssetProcessorConnection::SendRequestAsync(AZ::u32 typeId, const void* dataBuffer, AZ::u32 dataLength, TMessageCallback handler)
+        {
+            if (m_connectionState != EConnectionState::Connected)
+            {
+                return false;
+            }
+
+            // the handler is registered before the message is queued so the response can't arrive ahead of it
+            AZ::u32 requestSerial = GetNextSerial();
+            AddResponseHandler(typeId, requestSerial, handler);
+            QueueMessageForSend(typeId, requestSerial, dataBuffer, dataLength);
+
+            return true;
+        }
+
         bool AssetProcessorConnection::SendRequest(AZ::u32 typeId, AZ::u32 serial, const void* dataBuffer, AZ::u32 dataLength, TMessageCallback handler)
         {
             // negotiation packets are always allowed
@@ -92,6 +92,7 @@ namespace AzFramework
             bool SendMsg(AZ::u32 typeId, const void* dataBuffer, AZ::u32 dataLength) override;
             bool SendMsg(AZ::u32 typeId, AZ::u32 serial, const void* dataBuffer, AZ::u32 dataLength) override;
             bool SendRequest(AZ::u32 typeId, const void* dataBuffer, AZ::u32 dataLength, TMessageCallback handler) override;
+            bool SendRequestAsync(AZ::u32 typeId, const void* dataBuffer, AZ::u32 dataLength, TMessageCallback handler) override;
 
             //! Will call callback whenever a message of type typeId arrives.
             //! @return returns a value that can be passed to /ref RemoveMessageHandler .
@@ -259,6 +260,47 @@ namespace AzFramework
             return false;
         }
 
+        //! Queue a request without blocking. onResponse is called from the connection's receive thread once the response
+        //! has been unpacked into response, with false if the request failed; response must outlive that call.
+        template <class Request, class Response>
+        static bool SendRequestAsync(const Request& request, Response& response, AZStd::function<void(bool)> onResponse, SocketConnection* connection = nullptr)
+        {
+            if (!connection)
+            {
+                connection = SocketConnection::GetInstance();
+            }
+
+            AZ_Assert(connection, "SendRequestAsync requires a valid SocketConnection");
+            if (!connection)
+            {
+                return false;
+            }
+
+            MessageBuffer requestBuffer;
+            bool serialized = PackMessage(request, requestBuffer);
+            AZ_Assert(serialized, "AssetProcessor::SendRequestAsync: failed to serialize");
+            if (!serialized)
+            {
+                return false;
+            }
+
+            auto readResponseFunction = [&response, onResponse](AZ::u32 /*typeId*/, AZ::u32 /*serial*/, const void* data, AZ::u32 dataLength)
+                {
+                    bool deserialized = false;
+                    if (dataLength != 0)
+                    {
+                        MessageBuffer responseBuffer;
+                        responseBuffer.resize_no_construct(dataLength);
+                        memcpy(responseBuffer.data(), data, dataLength);
+                        deserialized = UnpackMessage(responseBuffer, response);
+                        AZ_Warning("AssetProcessorConnection", deserialized, "Unable to deserialize the response from the remote connection (for response %s)", response.RTTI_GetTypeName());
+                    }
+                    onResponse(deserialized);
+                };
+
+            return connection->SendRequestAsync(request.GetMessageType(), requestBuffer.data(), static_cast<AZ::u32>(requestBuffer.size()), readResponseFunction);
+        }
+
         template <class Request, class Response>
         static bool SendRequest(const Request& request, Response& response, SocketConnection* connection = nullptr)
         {
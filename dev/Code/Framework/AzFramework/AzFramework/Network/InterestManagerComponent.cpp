@@ -19,6 +19,7 @@
 #include <GridMate/Replica/Interest/BitmaskInterestHandler.h>
 #include <GridMate/Replica/Interest/InterestManager.h>
 #include <GridMate/Replica/Interest/ProximityInterestHandler.h>
+#include <GridMate/Replica/Interest/SpatialHashInterestHandler.h>
 
 using namespace GridMate;
 
@@ -55,6 +56,11 @@ namespace AzFramework
             {
                 GridMate::ReplicaChunkDescriptorTable::Get().RegisterChunkType<GridMate::BitmaskInterestChunk>();
             }
+
+            if (!GridMate::ReplicaChunkDescriptorTable::Get().FindReplicaChunkDescriptor(GridMate::ReplicaChunkClassId(SpatialHashInterestChunk::GetChunkName())))
+            {
+                GridMate::ReplicaChunkDescriptorTable::Get().RegisterChunkType<GridMate::SpatialHashInterestChunk>();
+            }
         }
     }
 
@@ -118,6 +124,11 @@ namespace AzFramework
         return m_proximityHandler.get();
     }
 
+    SpatialHashInterestHandler* InterestManagerComponent::GetSpatialHashInterest()
+    {
+        return m_spatialHashHandler.get();
+    }
+
     void InterestManagerComponent::OnNetworkSessionActivated(GridSession* session)
     {
         AZ_Assert(m_session == nullptr, "Already bound to the session");
@@ -165,6 +176,9 @@ namespace AzFramework
         m_proximityHandler = AZStd::make_unique<ProximityInterestHandler>();
         m_im->RegisterHandler(m_proximityHandler.get());
 
+        m_spatialHashHandler = AZStd::make_unique<SpatialHashInterestHandler>();
+        m_im->RegisterHandler(m_spatialHashHandler.get());
+
         InterestManagerEventsBus::Broadcast(
             &InterestManagerEventsBus::Events::OnInterestManagerActivate, m_im.get());
     }
@@ -178,9 +192,11 @@ namespace AzFramework
 
             m_im->UnregisterHandler(m_bitmaskHandler.get());
             m_im->UnregisterHandler(m_proximityHandler.get());
+            m_im->UnregisterHandler(m_spatialHashHandler.get());
 
             m_bitmaskHandler = nullptr;
             m_proximityHandler = nullptr;
+            m_spatialHashHandler = nullptr;
             m_im = nullptr;
         }
     }
@@ -27,6 +27,7 @@ namespace GridMate
     class GridSession;
     class BitmaskInterestHandler;
     class ProximityInterestHandler;
+    class SpatialHashInterestHandler;
 }
 
 namespace AzFramework
@@ -45,6 +46,9 @@ namespace AzFramework
 
         // Returns interest manager instance
         virtual GridMate::ProximityInterestHandler* GetProximityInterest() = 0;
+
+        // Returns spatial hash interest handler, for worlds with a lot of moving replicas
+        virtual GridMate::SpatialHashInterestHandler* GetSpatialHashInterest() = 0;
     };
 
     // Interface Bus
@@ -97,6 +101,7 @@ namespace AzFramework
         GridMate::InterestManager* GetInterestManager() override;
         GridMate::BitmaskInterestHandler* GetBitmaskInterest() override;
         GridMate::ProximityInterestHandler* GetProximityInterest() override;
+        GridMate::SpatialHashInterestHandler* GetSpatialHashInterest() override;
 
         // SessionEventBus
         void OnNetworkSessionActivated(GridMate::GridSession* session) override;
@@ -109,6 +114,7 @@ namespace AzFramework
         AZStd::unique_ptr<GridMate::InterestManager> m_im;
         AZStd::unique_ptr<GridMate::BitmaskInterestHandler> m_bitmaskHandler;
         AZStd::unique_ptr<GridMate::ProximityInterestHandler> m_proximityHandler;
+        AZStd::unique_ptr<GridMate::SpatialHashInterestHandler> m_spatialHashHandler;
 
         GridMate::GridSession* m_session; ///< currently bound session
 
@@ -75,7 +75,8 @@ namespace AzFramework
     }
 
     NetBindingComponent::NetBindingComponent()
-        : m_isLevelSliceEntity(false)
+        : m_replicaPriority(GridMate::k_replicaPriorityNormal)
+        , m_isLevelSliceEntity(false)
     {
     }
 
@@ -98,7 +99,9 @@ namespace AzFramework
             EBUS_EVENT_RESULT(shouldBind, NetBindingSystemBus, ShouldBindToNetwork);
             if (shouldBind)
             {
-                BindToNetwork(nullptr);
+                // The binding system binds all the entities activated during the frame in one pass, and skips the
+                // ones that don't stay active until then.
+                EBUS_EVENT(NetBindingSystemBus, QueueMasterBinding, GetEntityId());
             }
         }
     }
@@ -164,15 +167,18 @@ namespace AzFramework
             NetBindingComponentChunk* chunk = GridMate::CreateReplicaChunk<NetBindingComponentChunk>();
             m_chunk = chunk;
             chunk->SetBinding(this);
+            chunk->SetPriority(m_replicaPriority);
             replica->AttachReplicaChunk(chunk);
 
             chunk->m_bindMap.Modify([&](AZStd::vector<AZ::ComponentId>& bindMap)
             {
+                AZ::Entity* entity = GetEntity();
+                bindMap.reserve(replica->GetNumChunks() + entity->GetComponents().size());
+
                 // Mark the chunks already in the replica as non-components.
                 bindMap.resize(replica->GetNumChunks(), AZ::InvalidComponentId);
 
                 // Collect the bindings and add the to the replica
-                AZ::Entity* entity = GetEntity();
                 for (Component* component : entity->GetComponents())
                 {
                     NetBindable* netBindable = azrtti_cast<NetBindable*>(component);
@@ -247,6 +253,7 @@ namespace AzFramework
 
     void NetBindingComponent::SetReplicaPriority(GridMate::ReplicaPriority replicaPriority)
     {
+        m_replicaPriority = replicaPriority;
         if (m_chunk)
         {
             m_chunk->SetPriority(replicaPriority);
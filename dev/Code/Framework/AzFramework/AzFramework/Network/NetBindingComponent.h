@@ -77,6 +77,8 @@ namespace AzFramework
 
         //! Points to the NetBindingComponentChunk counterpart.
         GridMate::ReplicaChunkPtr m_chunk;
+        //! Priority of the master replica, kept until the entity is bound.
+        GridMate::ReplicaPriority m_replicaPriority;
         bool m_isLevelSliceEntity;
         AZ::SliceComponent::SliceInstanceId m_sliceInstanceId;
     };
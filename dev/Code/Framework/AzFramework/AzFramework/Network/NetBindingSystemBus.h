@@ -83,6 +83,10 @@ namespace AzFramework
         //! Adds a bound replica to the network session as master.
         virtual void AddReplicaMaster(AZ::Entity* entity, GridMate::ReplicaPtr replica) = 0;
 
+        //! Queues a local entity to be bound to the network as master. The entities queued during a frame are bound
+        //! together on the next tick, entities that are deactivated before that are never bound.
+        virtual void QueueMasterBinding(AZ::EntityId entity) = 0;
+
         //! Spawn and bind an entity from a slice
         virtual void SpawnEntityFromSlice(GridMate::ReplicaId bindTo, const NetBindingSliceContext& bindToContext) = 0;
 
@@ -370,6 +370,12 @@ namespace AzFramework
     }
     }
 
+    void NetBindingSystemImpl::QueueMasterBinding(AZ::EntityId entityId)
+    {
+        AZ_Assert(ShouldBindToNetwork(), "Entities shouldn't be binding to the network right now!");
+        m_masterBindings.push_back(entityId);
+    }
+
 
     AZ::EntityId NetBindingSystemImpl::GetStaticIdFromEntityId(AZ::EntityId entityId)
     {
@@ -587,6 +593,7 @@ namespace AzFramework
         static AZ::Debug::Timer sTimer;
         sTimer.Stamp();
 #endif
+        ProcessMasterBindings();
         ProcessBindRequests();
 #if defined(Extra_Tracing)
         const float seconds = sTimer.StampAndGetDeltaTimeInSeconds();
@@ -669,6 +676,7 @@ namespace AzFramework
         m_spawnRequests.clear();
         m_bindRequests.clear();
         m_addMasterRequests.clear();
+        m_masterBindings.clear();
         m_currentBindingContextSequence = UnspecifiedNetBindingContextSequence;
     }
 
@@ -895,6 +903,39 @@ namespace AzFramework
         m_addMasterRequests.clear();
     }
 
+    void NetBindingSystemImpl::ProcessMasterBindings()
+    {
+        if (m_masterBindings.empty())
+        {
+            return;
+        }
+
+        // Binding can activate more entities, they are queued for the next tick
+        AZStd::vector<AZ::EntityId> masterBindings;
+        masterBindings.swap(m_masterBindings);
+
+        for (const AZ::EntityId& entityId : masterBindings)
+        {
+            AZ::Entity* entity = nullptr;
+            EBUS_EVENT_RESULT(entity, AZ::ComponentApplicationBus, FindEntity, entityId);
+            if (entity && entity->GetState() == AZ::Entity::ES_ACTIVE)
+            {
+                NetBindingHandlerInterface* binding = GetNetBindingHandler(entity);
+                if (binding && !binding->IsEntityBoundToNetwork())
+                {
+                    binding->BindToNetwork(nullptr);
+                }
+            }
+        }
+
+        if (m_masterBindings.empty())
+        {
+            // keep the allocation for the next frame
+            masterBindings.clear();
+            m_masterBindings.swap(masterBindings);
+        }
+    }
+
     bool NetBindingSystemImpl::BindAndActivate(AZ::Entity* entity, GridMate::ReplicaId replicaId, bool addToContext,
         const AZ::SliceComponent::SliceInstanceId& sliceInstanceId)
     {
@@ -184,6 +184,7 @@ namespace AzFramework
         bool ShouldBindToNetwork() override;
         NetBindingContextSequence GetCurrentContextSequence() override;
         void AddReplicaMaster(AZ::Entity* entity, GridMate::ReplicaPtr replica) override;
+        void QueueMasterBinding(AZ::EntityId entity) override;
         AZ::EntityId GetStaticIdFromEntityId(AZ::EntityId entity) override;
         AZ::EntityId GetEntityIdFromStaticId(AZ::EntityId staticEntityId) override;
         void SpawnEntityFromSlice(GridMate::ReplicaId bindTo, const NetBindingSliceContext& bindToContext) override;
@@ -221,6 +222,9 @@ namespace AzFramework
         //! Process pending bind requests
         virtual void ProcessBindRequests();
 
+        //! Bind the local entities queued by QueueMasterBinding
+        virtual void ProcessMasterBindings();
+
         //! Performs final stage of entity spawning process
         virtual bool BindAndActivate(AZ::Entity* entity, GridMate::ReplicaId replicaId, bool addToContext, const AZ::SliceComponent::SliceInstanceId& sliceInstanceId);
 
@@ -249,6 +253,7 @@ namespace AzFramework
         SpawnRequestContextContainerType m_spawnRequests;
         BindRequestContextContainerType m_bindRequests;
         AZStd::list<AZStd::pair<AZ::EntityId, GridMate::ReplicaPtr>> m_addMasterRequests;
+        AZStd::vector<AZ::EntityId> m_masterBindings;
 
         /**
          * \brief override how root slice entities' replicas should be loaded
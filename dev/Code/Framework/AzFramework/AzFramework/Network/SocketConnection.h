@@ -75,6 +75,14 @@ namespace AzFramework
         //! Send a message and wait for the response
         virtual bool SendRequest(AZ::u32 typeId, const void* dataBuffer, AZ::u32 dataLength, TMessageCallback handler) = 0;
 
+        //! Send a message without waiting for the response; handler is called when it arrives (or with 0, nullptr if the request fails).
+        //! Requests queued this way are sent in order, so several can be kept in flight on the same connection.
+        //! The default implementation falls back to the blocking SendRequest.
+        virtual bool SendRequestAsync(AZ::u32 typeId, const void* dataBuffer, AZ::u32 dataLength, TMessageCallback handler)
+        {
+            return SendRequest(typeId, dataBuffer, dataLength, handler);
+        }
+
         //! Add callback for specific typeId (allows multiple callbacks per id)
         //! This will be invoked when a complete message is received from the remote end
         virtual TMessageCallbackHandle AddMessageHandler(AZ::u32 typeId, TMessageCallback callback) = 0;
@@ -13,6 +13,7 @@
 #include <AzFramework/Physics/World.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/algorithm.h>
 
 namespace Physics
 {
@@ -50,7 +51,7 @@ namespace Physics
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<WorldConfiguration>()
-                ->Version(4, &VersionConverter)
+                ->Version(5, &VersionConverter)
                 ->Field("WorldBounds", &WorldConfiguration::m_worldBounds)
                 ->Field("MaxTimeStep", &WorldConfiguration::m_maxTimeStep)
                 ->Field("FixedTimeStep", &WorldConfiguration::m_fixedTimeStep)
@@ -61,6 +62,7 @@ namespace Physics
                 ->Field("EnableCcd", &WorldConfiguration::m_enableCcd)
                 ->Field("EnableActiveActors", &WorldConfiguration::m_enableActiveActors)
                 ->Field("EnablePcm", &WorldConfiguration::m_enablePcm)
+                ->Field("AsyncSimulation", &WorldConfiguration::m_asyncSimulation)
                 ;
 
             if (auto editContext = serializeContext->GetEditContext())
@@ -77,6 +79,8 @@ namespace Physics
                     ->DataElement(AZ::Edit::UIHandlers::Default, &WorldConfiguration::m_overlapBufferSize, "Overlap Query Buffer Size", "Maximum number of hits from a overlap query")
                     ->DataElement(AZ::Edit::UIHandlers::Default, &WorldConfiguration::m_enableCcd, "Continuous Collision Detection", "Enabled continuous collision detection in the world")
                     ->DataElement(AZ::Edit::UIHandlers::Default, &WorldConfiguration::m_enablePcm, "Persistent Contact Manifold", "Enabled the persistent contact manifold narrow-phase algorithm")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &WorldConfiguration::m_asyncSimulation, "Asynchronous Simulation",
+                        "Overlap the last simulation step of each update with the rest of the frame. Its results are applied at the start of the next update, adding one frame of latency")
                     ;
             }
         }
@@ -122,6 +126,28 @@ namespace Physics
         return Overlap(overlapRequest);
     }
 
+    void World::RayCastBatch(const RayCastRequest* requests, AZ::u32 numRequests, RayCastHit* outHits)
+    {
+        for (AZ::u32 i = 0; i < numRequests; ++i)
+        {
+            outHits[i] = RayCast(requests[i]);
+        }
+    }
+
+    AZ::u32 World::OverlapBatch(const OverlapRequest* requests, AZ::u32 numRequests, OverlapHit* outHits, AZ::u32 maxHits, AZ::u32* outHitCounts)
+    {
+        AZ::u32 numHits = 0;
+        for (AZ::u32 i = 0; i < numRequests; ++i)
+        {
+            const AZStd::vector<OverlapHit> hits = Overlap(requests[i]);
+            const AZ::u32 numRequestHits = AZStd::min(static_cast<AZ::u32>(hits.size()), maxHits - numHits);
+            AZStd::copy(hits.begin(), hits.begin() + numRequestHits, outHits + numHits);
+            outHitCounts[i] = numRequestHits;
+            numHits += numRequestHits;
+        }
+        return numHits;
+    }
+
     Physics::RayCastHit World::SphereCast(float radius, const AZ::Transform& startPose, const AZ::Vector3& direction, float distance,
         QueryType queryType, CollisionGroup collisionGroup, CustomFilterCallback filterCallback)
     {
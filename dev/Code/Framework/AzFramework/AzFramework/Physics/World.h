@@ -56,6 +56,7 @@ namespace Physics
         bool m_enablePcm = true; ///< Enables the persistent contact manifold algorithm to be used as the narrow phase algorithm
         bool m_kinematicFiltering = true; ///< Enables filtering between kinematic/kinematic  objects.
         bool m_kinematicStaticFiltering = true; ///< Enables filtering between kinematic/static objects.
+        bool m_asyncSimulation = false; ///< Lets the last simulation step of an update run while the rest of the frame executes, its results are applied at the start of the next update.
 
     private:
         static bool VersionConverter(AZ::SerializeContext& context,
@@ -144,6 +145,31 @@ namespace Physics
         /// Perform an overlap capsule query returning all objects that overlapped.
         AZStd::vector<OverlapHit> OverlapCapsule(float height, float radius, const AZ::Transform& pose, CustomFilterCallback customFilterCallback = nullptr);
 
+        /// Perform a batch of raycasts in the world, writing the closest object that intersected each ray into a caller owned buffer.
+        /// @param requests Array of numRequests raycast requests.
+        /// @param numRequests Number of requests in the batch.
+        /// @param outHits Caller owned array of at least numRequests hits. Hit i belongs to request i and is left default (no body) when nothing was hit.
+        virtual void RayCastBatch(const RayCastRequest* requests, AZ::u32 numRequests, RayCastHit* outHits);
+
+        /// Perform a batch of overlap queries, writing all objects that overlapped into a caller owned buffer.
+        /// The hits of each request are stored contiguously, in request order. Once the buffer is full the remaining hits are dropped.
+        /// @param requests Array of numRequests overlap requests.
+        /// @param numRequests Number of requests in the batch.
+        /// @param outHits Caller owned array of maxHits hits shared by all requests.
+        /// @param maxHits Capacity of outHits.
+        /// @param outHitCounts Caller owned array of at least numRequests counts, receiving the number of hits written for each request.
+        /// @returns The total number of hits written into outHits.
+        virtual AZ::u32 OverlapBatch(const OverlapRequest* requests, AZ::u32 numRequests, OverlapHit* outHits, AZ::u32 maxHits, AZ::u32* outHitCounts);
+
+        /// Sets the regions (e.g. around players or the camera) in which the world is fully simulated.
+        /// Static and sleeping bodies entirely outside all regions hibernate and stop taking part in the simulation until a region covers them again.
+        /// They remain visible to scene queries. Regions should enclose all awake bodies, as a body moving out of them no longer collides with hibernating ones.
+        /// The regions are applied on the next update. An empty list disables hibernation and wakes all hibernating bodies.
+        virtual void SetActiveRegions(const AZStd::vector<AZ::Aabb>& regions) { AZ_UNUSED(regions); }
+
+        /// Returns the number of bodies currently hibernating because they are outside the active regions.
+        virtual AZ::u32 GetNumHibernatingBodies() const { return 0; }
+
         /// Registers a pair of world bodies for which collisions should be suppressed.
         virtual void RegisterSuppressedCollision(const WorldBody& body0, const WorldBody& body1) = 0;
 
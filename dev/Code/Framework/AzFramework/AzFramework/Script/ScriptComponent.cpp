@@ -281,6 +281,47 @@ namespace AzFramework
             LSV_END_VARIABLE(-2);
             return 0;
         }
+
+        //=========================================================================
+        // IsScriptTableSetUp
+        // Returns true if the script table on top of the stack was already set up as a metatable by a previous
+        // instance, with property metamethods that don't reference any network binding table.
+        //=========================================================================
+        static bool IsScriptTableSetUp(lua_State* lua, const AZStd::string& propertyTableName)
+        {
+            LSV_BEGIN(lua, 0);
+
+            lua_pushliteral(lua, "__index");
+            lua_rawget(lua, -2);
+            const bool isIndexSet = lua_rawequal(lua, -1, -2) != 0;
+            lua_pop(lua, 1);
+            if (!isIndexSet)
+            {
+                return false;
+            }
+
+            bool isSetUp = true;
+            lua_pushlstring(lua, propertyTableName.c_str(), propertyTableName.length());
+            lua_rawget(lua, -2);
+            if (lua_istable(lua, -1))
+            {
+                lua_pushliteral(lua, "__index");
+                lua_rawget(lua, -2);
+                if (lua_tocfunction(lua, -1) == &Properties__Index && lua_getupvalue(lua, -1, 1))
+                {
+                    isSetUp = lua_touserdata(lua, -1) == nullptr;
+                    lua_pop(lua, 1); // pop the upvalue
+                }
+                else
+                {
+                    isSetUp = false;
+                }
+                lua_pop(lua, 1); // pop the property table __index
+            }
+            lua_pop(lua, 1); // pop the properties table (or the nil value)
+
+            return isSetUp;
+        }
     } // namespace Internal
 
     // The code will create a table with uniqueEntityName which has
@@ -506,6 +547,14 @@ namespace AzFramework
             return false;
         }
 
+        // The script table is shared by all instances of the script in this context, only the first instance
+        // has to set it up. Networked instances still do, their property metamethods capture their binding table.
+        if (!m_netBindingTable && Internal::IsScriptTableSetUp(lua, m_properties.m_name))
+        {
+            // Leave the script table on the stack for CreateEntityTable().
+            return true;
+        }
+
         // Point the __index of the Script table to itself
         // because it will be used as a metatable
         lua_pushliteral(lua, "__index");
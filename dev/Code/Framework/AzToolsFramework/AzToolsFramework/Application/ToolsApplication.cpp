@@ -77,6 +77,9 @@ namespace AzToolsFramework
 
         static const char* s_startupLogWindow = "Startup";
 
+        // serialized entity snapshots held by the undo stack beyond this are discarded oldest first
+        static const AZStd::size_t s_undoStackMemoryBudget = 256 * 1024 * 1024;
+
         template<typename IdContainerType>
         void DeleteEntities(const IdContainerType& entityIds)
         {
@@ -426,6 +429,7 @@ namespace AzToolsFramework
         Application::StartCommon(systemEntity);
 
         m_undoStack = new UndoSystem::UndoStack(10, nullptr);
+        m_undoStack->SetMemoryBudget(Internal::s_undoStackMemoryBudget);
     }
 
     void ToolsApplication::Stop()
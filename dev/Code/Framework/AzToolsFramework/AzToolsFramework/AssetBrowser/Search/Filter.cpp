@@ -96,9 +96,34 @@ namespace AzToolsFramework
         AssetBrowserEntryFilter::AssetBrowserEntryFilter()
             : m_direction(None)
         {
+            connect(this, &AssetBrowserEntryFilter::updatedSignal, this, &AssetBrowserEntryFilter::ClearMatchCache);
+        }
+
+        AssetBrowserEntryFilter::~AssetBrowserEntryFilter()
+        {
+            AssetBrowserModelNotificationBus::Handler::BusDisconnect();
         }
 
         bool AssetBrowserEntryFilter::Match(const AssetBrowserEntry* entry) const
+        {
+            if (m_matchCacheEnabled)
+            {
+                auto cached = m_matchCache.find(entry);
+                if (cached != m_matchCache.end())
+                {
+                    return cached->second;
+                }
+            }
+
+            bool result = MatchPropagated(entry);
+            if (m_matchCacheEnabled)
+            {
+                m_matchCache.emplace(entry, result);
+            }
+            return result;
+        }
+
+        bool AssetBrowserEntryFilter::MatchPropagated(const AssetBrowserEntry* entry) const
         {
             if (MatchInternal(entry))
             {
@@ -179,6 +204,46 @@ namespace AzToolsFramework
         void AssetBrowserEntryFilter::SetFilterPropagation(int direction)
         {
             m_direction = direction;
+            ClearMatchCache();
+        }
+
+        void AssetBrowserEntryFilter::SetMatchCacheEnabled(bool enabled)
+        {
+            m_matchCacheEnabled = enabled;
+            ClearMatchCache();
+
+            if (enabled)
+            {
+                AssetBrowserModelNotificationBus::Handler::BusConnect();
+            }
+            else
+            {
+                AssetBrowserModelNotificationBus::Handler::BusDisconnect();
+            }
+        }
+
+        void AssetBrowserEntryFilter::ClearMatchCache()
+        {
+            if (!m_matchCache.empty())
+            {
+                m_matchCache.clear();
+            }
+            if (!m_matchDownCache.empty())
+            {
+                m_matchDownCache.clear();
+            }
+        }
+
+        void AssetBrowserEntryFilter::EntryAdded(const AssetBrowserEntry* /*entry*/)
+        {
+            // a new descendant can change the propagated result of every ancestor
+            ClearMatchCache();
+        }
+
+        void AssetBrowserEntryFilter::EntryRemoved(const AssetBrowserEntry* /*entry*/)
+        {
+            // removed entries are deleted, so their addresses may be reused by new ones
+            ClearMatchCache();
         }
 
         void AssetBrowserEntryFilter::FilterInternal(AZStd::vector<const AssetBrowserEntry*>& result, const AssetBrowserEntry* entry) const
@@ -191,20 +256,35 @@ namespace AzToolsFramework
 
         bool AssetBrowserEntryFilter::MatchDown(const AssetBrowserEntry* entry) const
         {
-            if (MatchInternal(entry))
+            if (m_matchCacheEnabled)
             {
-                return true;
+                auto cached = m_matchDownCache.find(entry);
+                if (cached != m_matchDownCache.end())
+                {
+                    return cached->second;
+                }
             }
-            AZStd::vector<const AssetBrowserEntry*> children;
-            entry->GetChildren<AssetBrowserEntry>(children);
-            for (auto child : children)
+
+            bool result = MatchInternal(entry);
+            if (!result)
             {
-                if (MatchDown(child))
+                AZStd::vector<const AssetBrowserEntry*> children;
+                entry->GetChildren<AssetBrowserEntry>(children);
+                for (auto child : children)
                 {
-                    return true;
+                    if (MatchDown(child))
+                    {
+                        result = true;
+                        break;
+                    }
                 }
             }
-            return false;
+
+            if (m_matchCacheEnabled)
+            {
+                m_matchDownCache.emplace(entry, result);
+            }
+            return result;
         }
 
         void AssetBrowserEntryFilter::FilterDown(AZStd::vector<const AssetBrowserEntry*>& result, const AssetBrowserEntry* entry) const
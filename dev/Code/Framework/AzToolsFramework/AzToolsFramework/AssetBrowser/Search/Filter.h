@@ -12,6 +12,7 @@
 #pragma once
 
 #include <AzToolsFramework/AssetBrowser/Entries/AssetBrowserEntry.h>
+#include <AzToolsFramework/AssetBrowser/AssetBrowserBus.h>
 
 #include <QObject>
 #include <QString>
@@ -20,6 +21,7 @@
 
 #include <AzCore/Asset/AssetTypeInfoBus.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/algorithm.h>
 
 namespace AzToolsFramework
@@ -36,6 +38,7 @@ namespace AzToolsFramework
         //! They are also used for enforcing selection constraints for asset picking
         class AssetBrowserEntryFilter
             : public QObject
+            , private AssetBrowserModelNotificationBus::Handler
         {
             Q_OBJECT
         public:
@@ -55,7 +58,7 @@ namespace AzToolsFramework
             };
 
             AssetBrowserEntryFilter();
-            virtual ~AssetBrowserEntryFilter() =  default;
+            virtual ~AssetBrowserEntryFilter();
 
             //! Check if entry matches filter
             bool Match(const AssetBrowserEntry* entry) const;
@@ -73,6 +76,11 @@ namespace AzToolsFramework
 
             void SetFilterPropagation(int direction);
 
+            //! Remember Match results per entry, so propagated matches don't re-walk the same subtrees for every row.
+            //! Results are dropped when the filter is updated or entries are added to or removed from the asset browser;
+            //! only enable this on filters whose result depends on nothing but their settings and the entry tree.
+            void SetMatchCacheEnabled(bool enabled);
+
         Q_SIGNALS:
             //! Emitted every time a filter is updated, in case of composite filter, the signal is propagated to the top level filter so only one listener needs to connected
             void updatedSignal() const;
@@ -90,8 +98,21 @@ namespace AzToolsFramework
             QString m_tag;
             int m_direction;
 
+            bool MatchPropagated(const AssetBrowserEntry* entry) const;
             bool MatchDown(const AssetBrowserEntry* entry) const;
             void FilterDown(AZStd::vector<const AssetBrowserEntry*>& result, const AssetBrowserEntry* entry) const;
+
+            void ClearMatchCache();
+
+            //////////////////////////////////////////////////////////////////////////
+            // AssetBrowserModelNotificationBus
+            void EntryAdded(const AssetBrowserEntry* entry) override;
+            void EntryRemoved(const AssetBrowserEntry* entry) override;
+            //////////////////////////////////////////////////////////////////////////
+
+            bool m_matchCacheEnabled = false;
+            mutable AZStd::unordered_map<const AssetBrowserEntry*, bool> m_matchCache;
+            mutable AZStd::unordered_map<const AssetBrowserEntry*, bool> m_matchDownCache;
         };
 
 
@@ -92,6 +92,12 @@ namespace AzToolsFramework
             m_typesFilter->SetFilterPropagation(AssetBrowserEntryFilter::PropagateDirection::Down);
             m_typesFilter->SetTag("AssetTypes");
 
+            // every row of the view is matched against these, and with propagation that would otherwise
+            // re-walk the same subtrees once per ancestor
+            m_filter->SetMatchCacheEnabled(true);
+            m_stringFilter->SetMatchCacheEnabled(true);
+            m_typesFilter->SetMatchCacheEnabled(true);
+
             connect(this, &AzQtComponents::FilteredSearchWidget::TextFilterChanged, this,
                     [this](const QString& text)
             {
@@ -98,6 +98,9 @@ namespace AzToolsFramework
             {
                 AZ_Assert(false, "Unable to serialize entity for undo/redo. ObjectStream::Finalize() returned an error.");
             }
+
+            // the byte stream grows geometrically while writing; don't keep the slack alive for the lifetime of the undo stack
+            m_redoState.shrink_to_fit();
         }
 
         // If slice-owned, extract the data we need to restore it.
@@ -218,6 +221,11 @@ namespace AzToolsFramework
         EBUS_EVENT(ToolsApplicationRequests::Bus, SetSelectedEntities, selectedEntities);
     }
 
+    AZStd::size_t EntityStateCommand::GetMemoryFootprint() const
+    {
+        return UndoSystem::URSequencePoint::GetMemoryFootprint() + m_undoState.capacity() + m_redoState.capacity();
+    }
+
     void EntityStateCommand::Undo()
     {
         RestoreEntity(m_undoState.data(), m_undoState.size());
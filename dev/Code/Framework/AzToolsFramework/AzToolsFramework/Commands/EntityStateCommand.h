@@ -65,6 +65,7 @@ namespace AzToolsFramework
         AZ::EntityId GetEntityID() const { return m_entityID; }
 
         bool Changed() const override { return m_undoState != m_redoState; }
+        AZStd::size_t GetMemoryFootprint() const override;
 
     protected:
 
@@ -52,6 +52,7 @@ namespace AzToolsFramework
 
         Connection::Connection(void)
             : m_db(NULL)
+            , m_transactionDepth(0)
         {
         }
 
@@ -109,6 +110,7 @@ namespace AzToolsFramework
                 FinalizeAll();
                 sqlite3_close(m_db);
                 m_db = NULL;
+                m_transactionDepth = 0;
             }
         }
 
@@ -219,7 +221,15 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                ExecuteTransactionStatement("SAVEPOINT nested%d;");
+            }
+            ++m_transactionDepth;
         }
 
         void Connection::CommitTransaction()
@@ -229,7 +239,21 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+            AZ_Assert(m_transactionDepth > 0, "CommitTransaction:  No transaction is open!");
+            if (m_transactionDepth == 0)
+            {
+                return;
+            }
+
+            --m_transactionDepth;
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                ExecuteTransactionStatement("RELEASE nested%d;");
+            }
         }
 
         void Connection::RollbackTransaction()
@@ -239,7 +263,30 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            AZ_Assert(m_transactionDepth > 0, "RollbackTransaction:  No transaction is open!");
+            if (m_transactionDepth == 0)
+            {
+                return;
+            }
+
+            --m_transactionDepth;
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            }
+            else
+            {
+                // rolling back to a savepoint leaves it open, it still has to be released.
+                ExecuteTransactionStatement("ROLLBACK TO nested%d;");
+                ExecuteTransactionStatement("RELEASE nested%d;");
+            }
+        }
+
+        void Connection::ExecuteTransactionStatement(const char* format)
+        {
+            char statement[64];
+            azsnprintf(statement, AZ_ARRAY_SIZE(statement), format, m_transactionDepth);
+            sqlite3_exec(m_db, statement, NULL, NULL, NULL);
         }
 
         void Connection::Vacuum()
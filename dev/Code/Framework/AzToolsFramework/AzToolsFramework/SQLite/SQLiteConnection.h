@@ -50,6 +50,9 @@ namespace AzToolsFramework
             bool IsOpen() const;
 
             // ----- Transaction support -----
+            //! Transactions can be nested.  The outermost one is a real transaction, the ones inside it are savepoints,
+            //! so that committing an inner transaction does not end the outer one, and rolling it back only reverts
+            //! what was done since it began.
             void BeginTransaction();
             void CommitTransaction();
             void RollbackTransaction();
@@ -86,7 +89,10 @@ namespace AzToolsFramework
             bool DoesTableExist(const char* name);
 
         private:
+            void ExecuteTransactionStatement(const char* format);
+
             sqlite3* m_db;
+            int m_transactionDepth;
             typedef AZStd::unordered_map< AZStd::string, StatementPrototype* > StatementContainer;
             StatementContainer m_statementPrototypes;
         };
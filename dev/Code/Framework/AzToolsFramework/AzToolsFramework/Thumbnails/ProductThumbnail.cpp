@@ -11,9 +11,13 @@
 */
 
 #include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/IO/FileIO.h>
 #include <AssetBrowser/EBusFindAssetTypeByName.h>
 #include <Thumbnails/ProductThumbnail.h>
 
+#include <QImage>
+#include <QImageReader>
+
 namespace AzToolsFramework
 {
     namespace Thumbnailer
@@ -35,8 +39,11 @@ namespace AzToolsFramework
         const AZ::Data::AssetType& ProductThumbnailKey::GetAssetType() const { return m_assetType; }
 
         //////////////////////////////////////////////////////////////////////////
-        // ProductThumbnailKey
+        // ProductThumbnail
         //////////////////////////////////////////////////////////////////////////
+        static const char* THUMBNAIL_CACHE_FOLDER = "@user@/ThumbnailCache";
+        static const char* THUMBNAIL_CACHE_STAMP_KEY = "ProductStamp";
+
         ProductThumbnail::ProductThumbnail(SharedThumbnailKey key, int thumbnailSize)
             : Thumbnail(key, thumbnailSize)
         {
@@ -45,6 +52,27 @@ namespace AzToolsFramework
             m_assetId = assetIdThumbnailKey->GetAssetId();
             m_assetType = assetIdThumbnailKey->GetAssetType();
             BusConnect(m_assetId);
+
+            AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::Data::AssetInfo info;
+            AZ::Data::AssetCatalogRequestBus::BroadcastResult(info, &AZ::Data::AssetCatalogRequests::GetAssetInfoById, m_assetId);
+            if (fileIO && !info.m_relativePath.empty())
+            {
+                AZStd::string productPath = AZStd::string::format("@assets@/%s", info.m_relativePath.c_str());
+                AZ::u64 modTime = fileIO->ModificationTime(productPath.c_str());
+                if (modTime != 0)
+                {
+                    m_productStamp = AZStd::string::format("%llu:%llu", static_cast<unsigned long long>(info.m_sizeBytes), static_cast<unsigned long long>(modTime));
+
+                    char resolvedPath[AZ_MAX_PATH_LEN] = { 0 };
+                    AZStd::string cachePath = AZStd::string::format("%s/%s_%u_%d.png",
+                        THUMBNAIL_CACHE_FOLDER, m_assetId.m_guid.ToString<AZStd::string>(false, false).c_str(), m_assetId.m_subId, m_thumbnailSize);
+                    if (fileIO->ResolvePath(cachePath.c_str(), resolvedPath, AZ_MAX_PATH_LEN))
+                    {
+                        m_cachePath = resolvedPath;
+                    }
+                }
+            }
         }
 
         ProductThumbnail::~ProductThumbnail()
@@ -66,6 +94,11 @@ namespace AzToolsFramework
 
         void ProductThumbnail::LoadThread()
         {
+            if (LoadFromDiskCache())
+            {
+                return;
+            }
+
             bool installed = false;
             ThumbnailerRendererRequestBus::EventResult(installed, m_assetType, &ThumbnailerRendererRequests::Installed);
             if (installed)
@@ -73,6 +106,10 @@ namespace AzToolsFramework
                 ThumbnailerRendererRequestBus::QueueEvent(m_assetType, &ThumbnailerRendererRequests::RenderThumbnail, m_assetId, m_thumbnailSize);
                 // wait for response from thumbnail renderer
                 m_renderWait.acquire();
+                if (m_state != State::Failed)
+                {
+                    SaveToDiskCache();
+                }
             }
             else
             {
@@ -80,6 +117,56 @@ namespace AzToolsFramework
             }
         }
 
+        bool ProductThumbnail::LoadFromDiskCache()
+        {
+            if (m_cachePath.empty())
+            {
+                return false;
+            }
+
+            // the stamp lives in the PNG header, so stale entries are rejected without decoding the image
+            QImageReader reader(QString::fromUtf8(m_cachePath.c_str()), "png");
+            if (!reader.canRead() || reader.text(THUMBNAIL_CACHE_STAMP_KEY) != QString::fromUtf8(m_productStamp.c_str()))
+            {
+                return false;
+            }
+
+            QImage image;
+            if (!reader.read(&image))
+            {
+                return false;
+            }
+
+            m_pixmap = QPixmap::fromImage(image);
+            return true;
+        }
+
+        void ProductThumbnail::SaveToDiskCache() const
+        {
+            if (m_cachePath.empty() || m_pixmap.isNull())
+            {
+                return;
+            }
+
+            AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+            char resolvedFolder[AZ_MAX_PATH_LEN] = { 0 };
+            if (!fileIO || !fileIO->ResolvePath(THUMBNAIL_CACHE_FOLDER, resolvedFolder, AZ_MAX_PATH_LEN))
+            {
+                return;
+            }
+            if (!fileIO->Exists(resolvedFolder))
+            {
+                fileIO->CreatePath(resolvedFolder);
+            }
+
+            QImage image = m_pixmap.toImage();
+            image.setText(THUMBNAIL_CACHE_STAMP_KEY, QString::fromUtf8(m_productStamp.c_str()));
+            if (!image.save(QString::fromUtf8(m_cachePath.c_str()), "png"))
+            {
+                AZ_Warning("Thumbnailer", false, "Failed to write thumbnail cache file %s", m_cachePath.c_str());
+            }
+        }
+
         //////////////////////////////////////////////////////////////////////////
         // ProductThumbnailCache
         //////////////////////////////////////////////////////////////////////////
@@ -62,7 +62,14 @@ namespace AzToolsFramework
             void LoadThread() override;
 
         private:
+            //! Rendered thumbnails are kept under @user@ so they survive editor restarts.
+            //! Entries are stamped with the product's size and modification time and ignored once it changes.
+            bool LoadFromDiskCache();
+            void SaveToDiskCache() const;
+
             AZStd::binary_semaphore m_renderWait;
+            AZStd::string m_cachePath;
+            AZStd::string m_productStamp;
         };
 
         namespace
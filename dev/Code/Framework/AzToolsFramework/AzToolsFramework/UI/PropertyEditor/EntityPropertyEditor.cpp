@@ -546,7 +546,12 @@ namespace AzToolsFramework
     {
         if (IsEntitySelected(entityId))
         {
-            UpdateContents(); // immediately refresh
+            // Immediately drop every reference to the selection's components, then rebuild once after the current
+            // batch of destructions. A slice push or deleting thousands of selected entities would otherwise rebuild
+            // the whole inspector once per destroyed entity. ClearInstances() also empties m_selectedEntityIds, so
+            // the rest of the batch returns early here.
+            QueuePropertyRefresh();
+            ClearInstances(false);
         }
     }
 
@@ -110,6 +110,16 @@ namespace AzToolsFramework
             return false;
         }
 
+        AZStd::size_t URSequencePoint::GetMemoryFootprint() const
+        {
+            AZStd::size_t footprint = 0;
+            for (const URSequencePoint* child : m_children)
+            {
+                footprint += child->GetMemoryFootprint();
+            }
+            return footprint;
+        }
+
         void URSequencePoint::SetParent(URSequencePoint* parent)
         {
             if (m_parent != nullptr)
@@ -162,6 +172,8 @@ namespace AzToolsFramework
 
         UndoStack::UndoStack(IUndoNotify* notify)
             : m_SequencePointsBuffer()
+            , m_totalFootprint(0)
+            , m_memoryBudget(0)
         {
             m_notify = notify;
             reentryGuard = false;
@@ -191,8 +203,16 @@ namespace AzToolsFramework
             // any commands beyond the cursor are invalidated thereby
             Slice();
 
+            // the previous top may have grown after it was posted (resumed undo batches append to it)
+            RefreshTopFootprint();
+
+            const AZStd::size_t footprint = cmd->GetMemoryFootprint();
             m_SequencePointsBuffer.push_back(cmd);
+            m_SequencePointsFootprint.push_back(footprint);
+            m_totalFootprint += footprint;
             m_Cursor = int(m_SequencePointsBuffer.size()) - 1;
+
+            TrimToMemoryBudget();
 #ifdef _DEBUG
             CleanCheck();
 #endif
@@ -222,6 +242,8 @@ namespace AzToolsFramework
 
             URSequencePoint* returned = m_SequencePointsBuffer[m_Cursor];
             m_SequencePointsBuffer.pop_back();
+            m_totalFootprint -= m_SequencePointsFootprint.back();
+            m_SequencePointsFootprint.pop_back();
             returned->m_isPosted = false;
             m_Cursor = int(m_SequencePointsBuffer.size()) - 1;
 
@@ -257,6 +279,8 @@ namespace AzToolsFramework
                 }
             }
             m_SequencePointsBuffer.clear();
+            m_SequencePointsFootprint.clear();
+            m_totalFootprint = 0;
 
             if (m_notify)
             {
@@ -334,6 +358,8 @@ namespace AzToolsFramework
                 for (int idx = m_Cursor + 1; idx < int(m_SequencePointsBuffer.size()); )
                 {
                     m_SequencePointsBuffer.pop_back();
+                    m_totalFootprint -= m_SequencePointsFootprint.back();
+                    m_SequencePointsFootprint.pop_back();
                 }
 
                 if (m_CleanPoint > m_Cursor)
@@ -351,6 +377,60 @@ namespace AzToolsFramework
             }
         }
 
+        void UndoStack::SetMemoryBudget(AZStd::size_t budgetBytes)
+        {
+            m_memoryBudget = budgetBytes;
+
+            RefreshTopFootprint();
+            TrimToMemoryBudget();
+        }
+
+        void UndoStack::RefreshTopFootprint()
+        {
+            if (m_SequencePointsBuffer.empty())
+            {
+                return;
+            }
+
+            const AZStd::size_t footprint = m_SequencePointsBuffer.back()->GetMemoryFootprint();
+            m_totalFootprint = m_totalFootprint - m_SequencePointsFootprint.back() + footprint;
+            m_SequencePointsFootprint.back() = footprint;
+        }
+
+        void UndoStack::TrimToMemoryBudget()
+        {
+            if (m_memoryBudget == 0 || m_totalFootprint <= m_memoryBudget)
+            {
+                return;
+            }
+
+            // drop the oldest commands, but never the one at the cursor or anything that can still be redone
+            AZStd::size_t trimCount = 0;
+            while (m_totalFootprint > m_memoryBudget && int(trimCount) < m_Cursor)
+            {
+                m_totalFootprint -= m_SequencePointsFootprint[trimCount];
+                delete m_SequencePointsBuffer[trimCount];
+                m_SequencePointsBuffer[trimCount] = nullptr;
+                ++trimCount;
+            }
+
+            if (trimCount == 0)
+            {
+                return;
+            }
+
+            m_SequencePointsBuffer.erase(m_SequencePointsBuffer.begin(), m_SequencePointsBuffer.begin() + trimCount);
+            m_SequencePointsFootprint.erase(m_SequencePointsFootprint.begin(), m_SequencePointsFootprint.begin() + trimCount);
+            m_Cursor -= int(trimCount);
+
+            m_CleanPoint -= int(trimCount);
+            if (m_CleanPoint < -1)
+            {
+                // the clean state was discarded along with the trimmed commands, so it can't be reached again
+                m_CleanPoint = -2;
+            }
+        }
+
         URSequencePoint* UndoStack::Find(URCommandID id, const AZ::Uuid& typeOfCommand)
         {
             for (int idx = 0; idx < int(m_SequencePointsBuffer.size()); ++idx)
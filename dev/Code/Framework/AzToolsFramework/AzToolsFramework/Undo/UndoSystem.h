@@ -94,6 +94,12 @@ namespace AzToolsFramework
             const ChildVec& GetChildren() const { return m_children; }
             bool HasRealChildren() const;
 
+            /**
+            Usage: override to report the bytes of undo/redo state held by this command.
+            The base implementation sums the children; the undo stack uses it to enforce its memory budget.
+            */
+            virtual AZStd::size_t GetMemoryFootprint() const;
+
             /**
             Usage: pass a function callback that eats a URSequencePoint*
             this walks the child tree and applies the callback to each URSequencePoint
@@ -188,10 +194,20 @@ namespace AzToolsFramework
             */
             void Slice();
 
+            /**
+            Usage: bounds the bytes held by the stack; once exceeded, the oldest commands are discarded
+            until it fits again (the command at the cursor is always kept). 0 means unbounded.
+            */
+            void SetMemoryBudget(AZStd::size_t budgetBytes);
+            AZStd::size_t GetMemoryBudget() const { return m_memoryBudget; }
+            AZStd::size_t GetMemoryFootprint() const { return m_totalFootprint; }
+
         protected:
 #ifdef _DEBUG
             void CleanCheck();
 #endif
+            void RefreshTopFootprint();
+            void TrimToMemoryBudget();
 
             int m_Cursor;
             int m_CleanPoint;
@@ -199,6 +215,10 @@ namespace AzToolsFramework
             typedef AZStd::vector<URSequencePoint*> SequencePointBuffer;
 
             SequencePointBuffer m_SequencePointsBuffer;
+            // footprint of each entry in m_SequencePointsBuffer, cached when it was posted
+            AZStd::vector<AZStd::size_t> m_SequencePointsFootprint;
+            AZStd::size_t m_totalFootprint;
+            AZStd::size_t m_memoryBudget;
             IUndoNotify* m_notify;
 
         private:
@@ -538,4 +538,68 @@ namespace UnitTest
         EXPECT_EQ(numUndos, counter);
         EXPECT_EQ(tracker, numUndos);
     }
+
+    class UndoSizedIntSetter : public UndoIntSetter
+    {
+    public:
+        UndoSizedIntSetter(int* value, int newValue, AZStd::size_t footprint)
+            : UndoIntSetter(value, newValue)
+            , m_footprint(footprint)
+        {
+        }
+
+        AZStd::size_t GetMemoryFootprint() const override { return m_footprint; }
+
+    private:
+        AZStd::size_t m_footprint;
+    };
+
+    TEST(UndoStack, MemoryBudget_Exceeded_OldestCommandsDiscarded)
+    {
+        UndoStack undoStack(nullptr);
+        undoStack.SetMemoryBudget(300);
+
+        int tracker = 0;
+        for (int i = 0; i < 5; i++)
+        {
+            undoStack.Post(aznew UndoSizedIntSetter(&tracker, i + 1, 100));
+        }
+
+        EXPECT_EQ(undoStack.GetMemoryFootprint(), 300u);
+        EXPECT_EQ(tracker, 5);
+
+        int counter = 0;
+        while (undoStack.CanUndo())
+        {
+            undoStack.Undo();
+            counter++;
+        }
+
+        EXPECT_EQ(counter, 3);
+        EXPECT_EQ(tracker, 2);
+
+        while (undoStack.CanRedo())
+        {
+            undoStack.Redo();
+        }
+
+        EXPECT_EQ(tracker, 5);
+    }
+
+    TEST(UndoStack, MemoryBudget_CommandAtCursorLargerThanBudget_CommandKept)
+    {
+        UndoStack undoStack(nullptr);
+        undoStack.SetMemoryBudget(50);
+
+        int tracker = 0;
+        undoStack.Post(aznew UndoSizedIntSetter(&tracker, 1, 100));
+        undoStack.Post(aznew UndoSizedIntSetter(&tracker, 2, 100));
+
+        EXPECT_EQ(undoStack.GetMemoryFootprint(), 100u);
+        EXPECT_TRUE(undoStack.CanUndo());
+
+        undoStack.Undo();
+        EXPECT_EQ(tracker, 1);
+        EXPECT_FALSE(undoStack.CanUndo());
+    }
 }
\ No newline at end of file
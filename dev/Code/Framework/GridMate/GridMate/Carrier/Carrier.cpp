@@ -78,7 +78,8 @@ namespace GridMate
 #ifdef AZ_DEBUG_BUILD
             m_flagsFromPacket(0),
 #endif
-            m_data(nullptr)
+            m_data(nullptr),
+            m_dataBlock(nullptr)
 
         {}
         enum MessageFlags
@@ -102,6 +103,7 @@ namespace GridMate
         SequenceNumber  m_sequenceNumber;       ///< Message sequence number.
         SequenceNumber  m_sendReliableSeqNum;   ///< Reliable sequence number. Valid if the reliability is RELIABLE.
         void*           m_data;
+        void*           m_dataBlock;            ///< Shared data block m_data points into (a received datagram), null if m_data is its own block.
         AZ::u16         m_dataSize;
         bool            m_isConnecting;         ///< True if this message is generated while we are in connecting state, otherwise false.
         AZStd::unique_ptr<CarrierACKCallback> m_ackCallback;    ///< After receiving an ACK execute the callback
@@ -109,6 +111,22 @@ namespace GridMate
 
     typedef AZStd::intrusive_list<MessageData, AZStd::list_base_hook<MessageData> > MessageDataListType;
 
+    /**
+     * Header in front of each message data block, see CarrierThread::AllocateMessageData.
+     */
+    struct MessageDataBlockHeader
+    {
+        AZStd::atomic<unsigned int> m_refCount;
+    };
+
+    static const unsigned int k_messageDataBlockHeaderSize = 16; ///< Keeps the block payload aligned.
+    static_assert(sizeof(MessageDataBlockHeader) <= k_messageDataBlockHeaderSize, "MessageDataBlockHeader doesn't fit the reserved space");
+
+    AZ_FORCE_INLINE MessageDataBlockHeader* GetMessageDataBlockHeader(void* data)
+    {
+        return reinterpret_cast<MessageDataBlockHeader*>(reinterpret_cast<char*>(data) - k_messageDataBlockHeaderSize);
+    }
+
     /**
      * Carrier data gram. A group of \ref MessageData.
      */
@@ -597,11 +615,13 @@ namespace GridMate
             : m_code(mtm)
             , m_connection(NULL)
             , m_threadConnection(NULL)
+            , m_next(NULL)
         {}
         ThreadMessage(CarrierThreadMsg ctm)
             : m_code(ctm)
             , m_connection(NULL)
             , m_threadConnection(NULL)
+            , m_next(NULL)
         {}
 
         int                     m_code;
@@ -618,6 +638,77 @@ namespace GridMate
             SecurityError       m_securityError;
         }                       m_error;
         CarrierDisconnectReason m_disconnectReason;
+        ThreadMessage*          m_next;                         ///< Link in the ThreadMessageQueue.
+    };
+
+    /**
+     * Intrusive multiple producer, single consumer message queue.
+     * Producers push onto a lock-free stack, the consumer takes the whole stack with one exchange and reverses it
+     * into a private list it pops in order. Since nodes are never popped one by one from the shared stack, there is
+     * no ABA problem and no need for a special allocator.
+     */
+    class ThreadMessageQueue
+    {
+    public:
+        ThreadMessageQueue()
+            : m_pushed(NULL)
+            , m_ready(NULL)
+        {}
+
+        ~ThreadMessageQueue()
+        {
+            Clear();
+        }
+
+        /// Can be called from any thread.
+        void Push(ThreadMessage* msg)
+        {
+            ThreadMessage* head = m_pushed.load(AZStd::memory_order_relaxed);
+            do
+            {
+                msg->m_next = head;
+            } while (!m_pushed.compare_exchange_weak(head, msg, AZStd::memory_order_release, AZStd::memory_order_relaxed));
+        }
+
+        /// Must be called from the consumer thread only. Returns NULL if the queue is empty.
+        ThreadMessage* Pop()
+        {
+            if (m_ready == NULL)
+            {
+                ThreadMessage* msg = m_pushed.exchange(NULL, AZStd::memory_order_acquire);
+                // the stack is in reverse push order
+                while (msg)
+                {
+                    ThreadMessage* next = msg->m_next;
+                    msg->m_next = m_ready;
+                    m_ready = msg;
+                    msg = next;
+                }
+                if (m_ready == NULL)
+                {
+                    return NULL;
+                }
+            }
+
+            ThreadMessage* res = m_ready;
+            m_ready = res->m_next;
+            res->m_next = NULL;
+            return res;
+        }
+
+        /// Deletes all queued messages, no producer or consumer should be active.
+        void Clear()
+        {
+            ThreadMessage* msg;
+            while ((msg = Pop()) != NULL)
+            {
+                delete msg;
+            }
+        }
+
+    private:
+        AZStd::atomic<ThreadMessage*>   m_pushed;   ///< Pushed messages, newest first.
+        ThreadMessage*                  m_ready;    ///< Messages taken by the consumer, oldest first.
     };
 
     /**
@@ -674,7 +765,12 @@ namespace GridMate
         inline DatagramData&    AllocateDatagram();
         inline void             FreeDatagram(DatagramData& dgram);
 
+        /// Message data blocks are ref counted, so all messages of a received datagram can reference the datagram
+        /// block instead of copying their payload. AllocateMessageData returns a block with one reference.
         inline void*            AllocateMessageData(unsigned int size);
+        inline void             AddMessageDataRef(void* data);
+        inline bool             IsMessageDataShared(void* data) const;
+        /// Releases one reference, the block returns to the pool with the last one.
         inline void             FreeMessageData(void* data, unsigned int size);
 
         inline unsigned int GetDataGramHeaderSize();
@@ -690,14 +786,16 @@ namespace GridMate
         inline void WriteMessageHeader(WriteBuffer& writeBuffer, const MessageData& msg, bool isWriteSeqNumber, bool isWriteReliableSeqNum, bool isWriteChannel) const;
         inline bool ReadMessageHeader(ReadBuffer& readBuffer, MessageData& dgram, SequenceNumber* prevMsgSeqNum, SequenceNumber* prevReliableMsgSeqNum, unsigned char& channel) const;
 
-        inline void ProcessIncomingDataGram(ThreadConnection* connection, DatagramData& dgram, ReadBuffer& readBuffer);
+        inline void ProcessIncomingDataGram(ThreadConnection* connection, DatagramData& dgram, ReadBuffer& readBuffer, void* dataBlock);
         inline void InitOutgoingDatagram(ThreadConnection* connection, WriteBuffer& writeBuffer);
         inline void GenerateOutgoingDataGram(ThreadConnection* connection, DatagramData& dgram, WriteBuffer& writeBuffer, OutgoingDataGramContext& ctx, size_t maxDatagramSize);
         //inline void ResendDataGram(DatagramData& dgram, WriteBuffer& writeBuffer);
 
         // parameter recvDataGramSize is only used for recording the size of the original packet for data flow purposes, it is not used as a bounds on the readBuffer.
         // in situations where the data is decompressed before this call is made, this parameter is the original compressed size
-        void OnReceivedIncomingDataGram(ThreadConnection* from, ReadBuffer& readBuffer, unsigned int recvDataGramSize);
+        // dataBlock is the message data block readBuffer reads from, received messages will reference it instead of copying
+        // their payload. Pass null when readBuffer is a temporary buffer.
+        void OnReceivedIncomingDataGram(ThreadConnection* from, ReadBuffer& readBuffer, unsigned int recvDataGramSize, void* dataBlock);
 
         void SendSystemMessage(SystemMessageId id, WriteBuffer& wb, ThreadConnection* target);
 
@@ -775,50 +873,29 @@ namespace GridMate
         bool                        m_notifyRateUpdate;             ///< Report if connection rate changes
 
         //////////////////////////////////////////////////////////////////////////
-        // TODO profile this, we can use lockless queue (ABA can't happen) or we can use command buffer (ring buffer) with event.
         AZ_FORCE_INLINE void PushCarrierThreadMessage(ThreadMessage* msg)
         {
-            AZStd::lock_guard<AZStd::mutex> l(m_carrierMsgQueueLock);
-            m_carrierMsgQueue.push(msg);
+            m_carrierMsgQueue.Push(msg);
         }
 
         AZ_FORCE_INLINE void PushMainThreadMessage(ThreadMessage* msg)
         {
-            AZStd::lock_guard<AZStd::mutex> l(m_mainMsgQueueLock);
-            m_mainMsgQueue.push(msg);
+            m_mainMsgQueue.Push(msg);
         }
 
         AZ_FORCE_INLINE ThreadMessage* PopCarrierThreadMessage()
         {
-            AZStd::lock_guard<AZStd::mutex> l(m_carrierMsgQueueLock);
-            ThreadMessage* res = NULL;
-            if (!m_carrierMsgQueue.empty())
-            {
-                res = m_carrierMsgQueue.front();
-                m_carrierMsgQueue.pop();
-            }
-            return res;
+            return m_carrierMsgQueue.Pop();
         }
 
         AZ_FORCE_INLINE ThreadMessage* PopMainThreadMessage()
         {
-            AZStd::lock_guard<AZStd::mutex> l(m_mainMsgQueueLock);
-            ThreadMessage* res = NULL;
-            if (!m_mainMsgQueue.empty())
-            {
-                res = m_mainMsgQueue.front();
-                m_mainMsgQueue.pop();
-            }
-            return res;
+            return m_mainMsgQueue.Pop();
         }
         //////////////////////////////////////////////////////////////////////////
 
-        typedef queue<ThreadMessage*>    ThreadMessageQueueType;
-        AZStd::mutex                m_carrierMsgQueueLock;
-        ThreadMessageQueueType      m_carrierMsgQueue;          ///< Message queue for the carrier thread. Main Thread to Carrier Thread
-
-        AZStd::mutex                m_mainMsgQueueLock;
-        ThreadMessageQueueType      m_mainMsgQueue;             ///< Message queue for the main thread. Carrier Thread to Main Thread
+        ThreadMessageQueue          m_carrierMsgQueue;          ///< Message queue for the carrier thread. Main Thread to Carrier Thread
+        ThreadMessageQueue          m_mainMsgQueue;             ///< Message queue for the main thread. Carrier Thread to Main Thread
 
         typedef list<ThreadConnection*> ThreadConnectionList;
         ThreadConnectionList        m_threadConnections;        ///< Connections active on the carrier thread.
@@ -1252,7 +1329,7 @@ CarrierThread::CarrierThread(const CarrierDesc& desc, AZStd::shared_ptr<Compress
     if (m_driver == 0)
     {
         m_ownDriver = true;
-        m_driver = aznew SocketDriver(desc.m_driverIsFullPackets, desc.m_driverIsCrossPlatform);
+        m_driver = aznew SocketDriver(desc.m_driverIsFullPackets, desc.m_driverIsCrossPlatform, desc.m_driverIsHighPerformance);
     }
 
     Driver::ResultCode initResult = m_driver->Initialize(desc.m_familyType, desc.m_address, desc.m_port, false, desc.m_driverReceiveBufferSize, desc.m_driverSendBufferSize);
@@ -1342,22 +1419,8 @@ CarrierThread::~CarrierThread()
 {
     Quit();
 
-    {
-        AZStd::lock_guard<AZStd::mutex> l(m_carrierMsgQueueLock);
-        while (!m_carrierMsgQueue.empty())
-        {
-            delete m_carrierMsgQueue.front();
-            m_carrierMsgQueue.pop();
-        }
-    }
-    {
-        AZStd::lock_guard<AZStd::mutex> l(m_mainMsgQueueLock);
-        while (!m_mainMsgQueue.empty())
-        {
-            delete m_mainMsgQueue.front();
-            m_mainMsgQueue.pop();
-        }
-    }
+    m_carrierMsgQueue.Clear();
+    m_mainMsgQueue.Clear();
 
     {
         AZStd::lock_guard<AZStd::mutex> l(m_freeMessagesLock);
@@ -1383,9 +1446,9 @@ CarrierThread::~CarrierThread()
         AZStd::lock_guard<AZStd::mutex> l(m_freeDataBlocksLock);
         while (!m_freeDataBlocks.empty())
         {
-            void* data = m_freeDataBlocks.front();
+            char* data = reinterpret_cast<char*>(m_freeDataBlocks.front());
             m_freeDataBlocks.pop();
-            azfree(data, GridMateAllocatorMP);
+            azfree(data - k_messageDataBlockHeaderSize, GridMateAllocatorMP);
         }
     }
 
@@ -1632,6 +1695,13 @@ CarrierThread::UpdateReceive()
     // read all datagrams
     while (true)
     {
+        // messages of the previous datagram still reference the block, read into a new one
+        if (IsMessageDataShared(data))
+        {
+            FreeMessageData(data, m_maxDataGramSizeBytes);
+            data = reinterpret_cast<char*>(AllocateMessageData(m_maxDataGramSizeBytes));
+        }
+
         // read data from the driver layer or simulator
         recvDataGramSize = m_driver->Receive(data, m_maxDataGramSizeBytes, fromAddress, &resultCode);
 
@@ -1720,7 +1790,7 @@ CarrierThread::UpdateReceive()
                         ReadBuffer chunkRb(kCarrierEndian, reinterpret_cast<char*>(m_compressionMem.data()), uncompSize);
 
                         // this function is taking recvDataGramSize ONLY so it can save the original data size off in the datagram it allocates for flow control purposes, it does not use this as a boundary on the data.
-                        OnReceivedIncomingDataGram(conn, chunkRb, recvDataGramSize);
+                        OnReceivedIncomingDataGram(conn, chunkRb, recvDataGramSize, nullptr);
 
                         // since we technically read from a different buffer, we have to skip through the readBuffer explicitly
                         readBuffer.Skip(bytesConsumedFromReadBuffer);
@@ -1728,7 +1798,7 @@ CarrierThread::UpdateReceive()
                     else // we have a compressor but the sender indicates they chose NOT to compress the data
                     {
                         // this function is taking recvDataGramSize ONLY so it can save the original data size off in the datagram it allocates for flow control purposes, it does not use this as a boundary on the data.
-                        OnReceivedIncomingDataGram(conn, readBuffer, recvDataGramSize);
+                        OnReceivedIncomingDataGram(conn, readBuffer, recvDataGramSize, data);
                     }
                 } while (!readBuffer.IsEmpty() && !readBuffer.IsOverrun());
 
@@ -1737,7 +1807,7 @@ CarrierThread::UpdateReceive()
             {
                 if (!conn->m_isBadConnection && !conn->m_isBadPackets)  // don't bother receiving from bad connections
                 {
-                    OnReceivedIncomingDataGram(conn, readBuffer, recvDataGramSize);
+                    OnReceivedIncomingDataGram(conn, readBuffer, recvDataGramSize, data);
                 }
             }
         } // end if it's NOT a new connection
@@ -1771,7 +1841,7 @@ CarrierThread::UpdateReceive()
                     readBuffer.Skip(k_sizeOfCompressedHintHeader);
                 }
 
-                OnReceivedIncomingDataGram(conn, readBuffer, recvDataGramSize);
+                OnReceivedIncomingDataGram(conn, readBuffer, recvDataGramSize, data);
             }
         } // end else it's a new connection
     } // end while (true)
@@ -2466,7 +2536,13 @@ inline void
 CarrierThread::FreeMessage(MessageData& msg)
 {
     AZStd::lock_guard<AZStd::mutex> l(m_freeMessagesLock);
-    if (msg.m_data)
+    if (msg.m_dataBlock)
+    {
+        FreeMessageData(msg.m_dataBlock, msg.m_dataSize);
+        msg.m_dataBlock = nullptr;
+        msg.m_data = nullptr;
+    }
+    else if (msg.m_data)
     {
         FreeMessageData(msg.m_data, msg.m_dataSize);
         msg.m_data = nullptr;
@@ -2532,20 +2608,44 @@ CarrierThread::AllocateMessageData(unsigned int size)
 {
     (void)size;
     AZ_Assert(size <= m_maxDataGramSizeBytes, "The message size is too big to be one block!");
+    char* data = nullptr;
     if (!m_freeDataBlocks.empty())
     {
         AZStd::lock_guard<AZStd::mutex> l(m_freeDataBlocksLock);
         if (!m_freeDataBlocks.empty())
         {
-            void* front = m_freeDataBlocks.front();
+            data = reinterpret_cast<char*>(m_freeDataBlocks.front());
             m_freeDataBlocks.pop();
-            return front;
         }
     }
-    return azmalloc(m_maxDataGramSizeBytes, 1, GridMateAllocatorMP);
+    if (!data)
+    {
+        data = reinterpret_cast<char*>(azmalloc(m_maxDataGramSizeBytes + k_messageDataBlockHeaderSize, k_messageDataBlockHeaderSize, GridMateAllocatorMP)) + k_messageDataBlockHeaderSize;
+        new(data - k_messageDataBlockHeaderSize) MessageDataBlockHeader();
+    }
+    GetMessageDataBlockHeader(data)->m_refCount.store(1, AZStd::memory_order_relaxed);
+    return data;
     //return azmalloc(size,1,GridMateAllocatorMP);
 }
 
+//=========================================================================
+// AddMessageDataRef
+//=========================================================================
+inline void
+CarrierThread::AddMessageDataRef(void* data)
+{
+    GetMessageDataBlockHeader(data)->m_refCount.fetch_add(1, AZStd::memory_order_relaxed);
+}
+
+//=========================================================================
+// IsMessageDataShared
+//=========================================================================
+inline bool
+CarrierThread::IsMessageDataShared(void* data) const
+{
+    return GetMessageDataBlockHeader(data)->m_refCount.load(AZStd::memory_order_acquire) > 1;
+}
+
 //=========================================================================
 // FreeMessageData
 // [8/2/2012]
@@ -2554,6 +2654,10 @@ inline void
 CarrierThread::FreeMessageData(void* data, unsigned int size)
 {
     (void)size;
+    if (GetMessageDataBlockHeader(data)->m_refCount.fetch_sub(1, AZStd::memory_order_acq_rel) != 1)
+    {
+        return;
+    }
     AZStd::lock_guard<AZStd::mutex> l(m_freeDataBlocksLock);
     // if we have too many free them, delete some
     m_freeDataBlocks.push(data);
@@ -2923,7 +3027,7 @@ bool CarrierThread::IsConnectRequestDataGram(const char* data, size_t dataSize)
 // [10/7/2010]
 //=========================================================================
 inline void
-CarrierThread::ProcessIncomingDataGram(ThreadConnection* connection, DatagramData& dgram, ReadBuffer& readBuffer)
+CarrierThread::ProcessIncomingDataGram(ThreadConnection* connection, DatagramData& dgram, ReadBuffer& readBuffer, void* dataBlock)
 {
     if (connection->m_receivedDatagramsHistory.IsFull())  // if we are full make sure we don't miss to ack any packets (at least once)
     {
@@ -3114,9 +3218,19 @@ CarrierThread::ProcessIncomingDataGram(ThreadConnection* connection, DatagramDat
                 break;
             }
 
-            // Read the payload
-            msg.m_data = AllocateMessageData(msg.m_dataSize);
-            readBuffer.ReadRaw(msg.m_data, msg.m_dataSize);
+            // Read the payload, in place when the datagram block outlives this call
+            if (dataBlock && readBuffer.Read().GetAdditionalBits() == 0 && readBuffer.Left().GetBytes() >= msg.m_dataSize)
+            {
+                AddMessageDataRef(dataBlock);
+                msg.m_dataBlock = dataBlock;
+                msg.m_data = const_cast<char*>(readBuffer.GetCurrent());
+                readBuffer.Skip(msg.m_dataSize);
+            }
+            else
+            {
+                msg.m_data = AllocateMessageData(msg.m_dataSize);
+                readBuffer.ReadRaw(msg.m_data, msg.m_dataSize);
+            }
             if (msg.m_channel != k_systemChannel)
             {
                 dgram.m_flowControl.m_effectiveSize += msg.m_dataSize;
@@ -3271,7 +3385,7 @@ void CarrierThread::GenerateOutgoingDataGram(ThreadConnection* connection, Datag
     }
 }
 
-void CarrierThread::OnReceivedIncomingDataGram(ThreadConnection* from, ReadBuffer& readBuffer, unsigned int recvDataGramSize)
+void CarrierThread::OnReceivedIncomingDataGram(ThreadConnection* from, ReadBuffer& readBuffer, unsigned int recvDataGramSize, void* dataBlock)
 {
     DatagramData& dgram = AllocateDatagram();
 
@@ -3281,7 +3395,7 @@ void CarrierThread::OnReceivedIncomingDataGram(ThreadConnection* from, ReadBuffe
     dgram.m_flowControl.m_sequenceNumber = dgramSequenceNumber;
     dgram.m_flowControl.m_size = static_cast<unsigned short>(recvDataGramSize); // saving original datagram size before decompression for flow control and correct statistics
 
-    ProcessIncomingDataGram(from, dgram, readBuffer);
+    ProcessIncomingDataGram(from, dgram, readBuffer, dataBlock);
 
     m_trafficControl->OnReceived(from, dgram.m_flowControl);
     FreeDatagram(dgram);
@@ -3775,6 +3889,11 @@ CarrierImpl::Connect(const string& address)
     // Send timer and request to connect.
     SendSyncTime();  // send time sync first if we are the clock.
 
+    // both sides need the same compression settings, the type goes in front of the handshake data
+    if (m_thread->m_compressor)
+    {
+        handshake.m_payload.Write(m_thread->m_compressor->GetType());
+    }
     m_handshake->OnInitiate(conn, handshake.m_payload);
     AZ_Warning("GridMate", handshake.m_payload.Size() > 0, "You should provide initiatial handshake data! This is not only important for version check, but connect/disconnect issues!");
     SendSystemMessage(SM_CONNECT_REQUEST, handshake.m_payload, conn, SEND_UNRELIABLE);
@@ -4437,6 +4556,17 @@ CarrierImpl::ProcessSystemMessages()
                 {
                 case SM_CONNECT_REQUEST:
                 {
+                    if (m_thread->m_compressor)
+                    {
+                        CompressorType compressorType = 0;
+                        if (!rb.Read(compressorType) || compressorType != m_thread->m_compressor->GetType())
+                        {
+                            AZ_TracePrintf("GridMate", "Rejecting connection from peer with different compression settings.\n");
+                            DisconnectRequest(conn, CarrierDisconnectReason::DISCONNECT_VERSION_MISMATCH);
+                            break;
+                        }
+                    }
+
                     WriteBufferStatic<> wb(kCarrierEndian);
                     switch (conn->m_state)
                     {
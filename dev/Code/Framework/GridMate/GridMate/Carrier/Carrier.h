@@ -241,6 +241,7 @@ namespace GridMate
             , m_driverSendBufferSize(0)
             , m_driverIsFullPackets(false)
             , m_driverIsCrossPlatform(false)
+            , m_driverIsHighPerformance(false)
             , m_version(1)
             , m_securityData(nullptr)
             , m_enableDisconnectDetection(true)
@@ -274,6 +275,7 @@ namespace GridMate
         unsigned int                    m_driverSendBufferSize;     ///< Driver send buffer size (0 uses default buffer size). Used only if m_driver == null.
         bool                            m_driverIsFullPackets;      ///< Used only for sockets drivers and LAN. Normally an internet packet is ~1500 bytes. With full packets you will enable big packets (64 KB or less) packets (which will fail on internet, but usually ok locally).
         bool                            m_driverIsCrossPlatform;    ///< True if we will need communicate across platforms (need to make sure we use common platform features).
+        bool                            m_driverIsHighPerformance;  ///< Used only for the default socket driver. Uses the platform's high performance socket API (RIO on Windows, batched recvmmsg/sendmmsg with UDP GSO/GRO on Linux).
 
         VersionType                     m_version;                  ///< Carriers with mismatching version numbers are not allowed to connect to each other. Default is 1.
 
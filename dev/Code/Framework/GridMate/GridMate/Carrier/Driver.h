@@ -85,7 +85,9 @@ namespace GridMate
         virtual ~Driver() {}
 
         virtual void Update() {}
+        /// Called before the carrier drains the received datagrams with Receive.
         virtual void ProcessIncoming() {}
+        /// Called after the carrier's send pass. Drivers can queue the datagrams passed to Send and write them as a batch here.
         virtual void ProcessOutgoing() {}
 
         /// \todo Add QoS support
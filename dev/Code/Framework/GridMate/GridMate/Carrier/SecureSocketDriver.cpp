@@ -1580,6 +1580,7 @@ namespace GridMate
     void SecureSocketDriver::ProcessOutgoing()
     {
         FlushConnectionBuffersToSocket();
+        SocketDriver::ProcessOutgoing();
     }
 
     AZ::u32 SecureSocketDriver::Receive(char* data, AZ::u32 maxDataSize, AddrPtr& from, ResultCode* resultCode)
@@ -46,6 +46,16 @@
 
 #include <AzCore/std/bind/bind.h>
 
+#ifdef AZ_SOCKET_MMSG_SUPPORT
+#   include <netinet/udp.h>
+#   ifndef UDP_SEGMENT
+#       define UDP_SEGMENT 103  // linux/udp.h, kernel 4.18
+#   endif
+#   ifndef UDP_GRO
+#       define UDP_GRO 104      // linux/udp.h, kernel 5.0
+#   endif
+#endif
+
 #if defined(AZ_PLATFORM_WINDOWS)
 #   include <VersionHelpers.h>
 #   define SO_NBIO          FIONBIO
@@ -1034,6 +1044,15 @@ namespace GridMate
         {
             m_platformDriver = AZStd::make_unique<PlatformSocketDriver>(*this, m_socket);
     }
+#elif defined(AZ_SOCKET_MMSG_SUPPORT)
+        if (isHighPerformance && MMsgPlatformSocketDriver::isSupported())
+        {
+            m_platformDriver = AZStd::make_unique<MMsgPlatformSocketDriver>(*this, m_socket);
+        }
+        else
+        {
+            m_platformDriver = AZStd::make_unique<PlatformSocketDriver>(*this, m_socket);
+        }
 #else
         m_platformDriver = AZStd::make_unique<PlatformSocketDriver>(*this, m_socket);
 #endif
@@ -1410,6 +1429,15 @@ namespace GridMate
         return rc;
     }
 
+    //=========================================================================
+    // ProcessOutgoing
+    //=========================================================================
+    void
+    SocketDriverCommon::ProcessOutgoing()
+    {
+        m_platformDriver->ProcessOutgoing();
+    }
+
     //=========================================================================
     // Receive
     // [10/14/2010]
@@ -1780,6 +1808,313 @@ namespace GridMate
         return true;    //Generic driver always supported
     };
 
+#ifdef AZ_SOCKET_MMSG_SUPPORT
+    SocketDriverCommon::MMsgPlatformSocketDriver::MMsgPlatformSocketDriver(SocketDriverCommon &parent, SocketType &socket)
+        : PlatformSocketDriver(parent, socket)
+    {
+    }
+
+    SocketDriverCommon::MMsgPlatformSocketDriver::~MMsgPlatformSocketDriver()
+    {
+        if (IsValidSocket(m_socket))
+        {
+            FlushSends();
+        }
+    }
+
+    bool SocketDriverCommon::MMsgPlatformSocketDriver::isSupported()
+    {
+        return true;    // recvmmsg/sendmmsg are available since linux 3.0
+    }
+
+    Driver::ResultCode SocketDriverCommon::MMsgPlatformSocketDriver::Initialize(unsigned int /*receiveBufferSize*/, unsigned int /*sendBufferSize*/)
+    {
+        m_isBatching = m_parent.m_isDatagram;
+        if (!m_isBatching)
+        {
+            return EC_OK;
+        }
+
+        // probe the UDP offloads, older kernels reject the options
+        int gsoSize = 0;
+        m_isGsoEnabled = setsockopt(m_socket, IPPROTO_UDP, UDP_SEGMENT, &gsoSize, sizeof(gsoSize)) == 0;
+        int enableGro = 1;
+        m_isGroEnabled = setsockopt(m_socket, IPPROTO_UDP, UDP_GRO, &enableGro, sizeof(enableGro)) == 0;
+
+        m_sendSlotSize = m_parent.GetMaxSendSize();
+        m_receiveSlotSize = m_isGroEnabled ? k_groReceiveSlotSize : m_sendSlotSize;
+
+        m_receiveBuffer.resize(k_batchSize * m_receiveSlotSize);
+        m_receiveControl.resize(k_batchSize * k_controlSize);
+        m_receiveAddresses.resize(k_batchSize);
+        m_receiveIov.resize(k_batchSize);
+        m_receiveMessages.resize(k_batchSize);
+        for (unsigned int i = 0; i < k_batchSize; ++i)
+        {
+            m_receiveIov[i].iov_base = &m_receiveBuffer[i * m_receiveSlotSize];
+            m_receiveIov[i].iov_len = m_receiveSlotSize;
+        }
+
+        m_sendBuffer.resize(k_batchSize * m_sendSlotSize);
+        m_sendControl.resize(k_batchSize * k_controlSize);
+        m_sendSizes.resize(k_batchSize);
+        m_sendAddresses.resize(k_batchSize);
+        m_sendAddressSizes.resize(k_batchSize);
+        m_sendIov.resize(k_batchSize);
+        m_sendMessages.resize(k_batchSize);
+        m_sendMessageFirst.resize(k_batchSize + 1);
+
+        AZ_TracePrintf("GridMate", "SocketDriver: batching %u datagrams per call, GSO %s, GRO %s\n", k_batchSize, m_isGsoEnabled ? "on" : "off", m_isGroEnabled ? "on" : "off");
+        return EC_OK;
+    }
+
+    Driver::ResultCode SocketDriverCommon::MMsgPlatformSocketDriver::Send(const sockaddr* sockAddr, unsigned int addressSize, const char* data, unsigned int dataSize)
+    {
+        if (!m_isBatching || dataSize > m_sendSlotSize || addressSize > sizeof(sockaddr_storage))
+        {
+            ResultCode result = FlushSends(); // keep the datagrams in order
+            return result == EC_OK ? PlatformSocketDriver::Send(sockAddr, addressSize, data, dataSize) : result;
+        }
+
+        ResultCode result = m_sendResult;
+        m_sendResult = EC_OK;
+        if (m_sendCount == k_batchSize)
+        {
+            ResultCode flushResult = FlushSends();
+            result = result == EC_OK ? flushResult : result;
+        }
+
+        memcpy(&m_sendBuffer[m_sendCount * m_sendSlotSize], data, dataSize);
+        memcpy(&m_sendAddresses[m_sendCount], sockAddr, addressSize);
+        m_sendAddressSizes[m_sendCount] = static_cast<socklen_t>(addressSize);
+        m_sendSizes[m_sendCount] = dataSize;
+        ++m_sendCount;
+        return result;
+    }
+
+    void SocketDriverCommon::MMsgPlatformSocketDriver::ProcessOutgoing()
+    {
+        m_sendResult = FlushSends();
+    }
+
+    Driver::ResultCode SocketDriverCommon::MMsgPlatformSocketDriver::FlushSends()
+    {
+        ResultCode result = EC_OK;
+        unsigned int first = 0;
+        while (first < m_sendCount)
+        {
+            // build the messages, merging runs of datagrams to the same address into GSO messages: every segment but the last
+            // one must have the segment size, the last one can be shorter
+            unsigned int messageCount = 0;
+            for (unsigned int i = first; i < m_sendCount; ++messageCount)
+            {
+                const unsigned int segmentSize = m_sendSizes[i];
+                unsigned int end = i + 1;
+                if (m_isGsoEnabled)
+                {
+                    unsigned int messageSize = segmentSize;
+                    while (end < m_sendCount
+                        && end - i < k_maxGsoSegments
+                        && m_sendSizes[end - 1] == segmentSize
+                        && m_sendSizes[end] <= segmentSize
+                        && messageSize + m_sendSizes[end] <= k_maxGsoMessageSize
+                        && m_sendAddressSizes[end] == m_sendAddressSizes[i]
+                        && memcmp(&m_sendAddresses[end], &m_sendAddresses[i], m_sendAddressSizes[i]) == 0)
+                    {
+                        messageSize += m_sendSizes[end];
+                        ++end;
+                    }
+                }
+
+                for (unsigned int segment = i; segment < end; ++segment)
+                {
+                    m_sendIov[segment].iov_base = &m_sendBuffer[segment * m_sendSlotSize];
+                    m_sendIov[segment].iov_len = m_sendSizes[segment];
+                }
+
+                msghdr& header = m_sendMessages[messageCount].msg_hdr;
+                memset(&header, 0, sizeof(header));
+                header.msg_name = &m_sendAddresses[i];
+                header.msg_namelen = m_sendAddressSizes[i];
+                header.msg_iov = &m_sendIov[i];
+                header.msg_iovlen = end - i;
+                if (end - i > 1)
+                {
+                    char* control = &m_sendControl[messageCount * k_controlSize];
+                    memset(control, 0, k_controlSize);
+                    header.msg_control = control;
+                    header.msg_controllen = CMSG_SPACE(sizeof(AZ::u16));
+                    cmsghdr* cmsg = CMSG_FIRSTHDR(&header);
+                    cmsg->cmsg_level = IPPROTO_UDP;
+                    cmsg->cmsg_type = UDP_SEGMENT;
+                    cmsg->cmsg_len = CMSG_LEN(sizeof(AZ::u16));
+                    const AZ::u16 gsoSize = static_cast<AZ::u16>(segmentSize);
+                    memcpy(CMSG_DATA(cmsg), &gsoSize, sizeof(gsoSize));
+                }
+                m_sendMessageFirst[messageCount] = i;
+                i = end;
+            }
+            m_sendMessageFirst[messageCount] = m_sendCount;
+
+            int sent = sendmmsg(m_socket, m_sendMessages.data(), messageCount, 0);
+            if (sent > 0)
+            {
+                first = m_sendMessageFirst[sent];
+                continue;
+            }
+
+            int errorCode = GetSocketError();
+            if (errorCode == AZ_EWOULDBLOCK)
+            {
+                // If we run out of buffer just wait for some buffer to become available
+                fd_set fdwrite;
+                FD_ZERO(&fdwrite);
+                FD_SET(m_socket, &fdwrite);
+                select(FD_SETSIZE, 0, &fdwrite, 0, 0);
+                continue;
+            }
+
+            const bool isGsoMessage = m_sendMessageFirst[1] - m_sendMessageFirst[0] > 1;
+            if (isGsoMessage && (errorCode == EIO || errorCode == EINVAL))
+            {
+                // the device can't segment (e.g. no checksum offload), send the datagrams one by one from now on
+                AZ_TracePrintf("GridMate", "SocketDriver: UDP GSO failed with code %d, disabling it\n", errorCode);
+                m_isGsoEnabled = false;
+                continue;
+            }
+
+            AZ_Error("GridMate", false, "SocketDriver::Send - sendmmsg failed with code %d!", errorCode);
+            first = m_sendMessageFirst[1]; // drop the failed message, the rest is rebuilt on the next pass
+            result = EC_SEND;
+        }
+
+        m_sendCount = 0;
+        return result;
+    }
+
+    unsigned int SocketDriverCommon::MMsgPlatformSocketDriver::GetReceivedSegmentSize(const mmsghdr& message) const
+    {
+        if (m_isGroEnabled)
+        {
+            for (cmsghdr* cmsg = CMSG_FIRSTHDR(&message.msg_hdr); cmsg; cmsg = CMSG_NXTHDR(const_cast<msghdr*>(&message.msg_hdr), cmsg))
+            {
+                if (cmsg->cmsg_level == IPPROTO_UDP && cmsg->cmsg_type == UDP_GRO)
+                {
+                    int segmentSize = 0;
+                    memcpy(&segmentSize, CMSG_DATA(cmsg), sizeof(segmentSize));
+                    if (segmentSize > 0)
+                    {
+                        return static_cast<unsigned int>(segmentSize);
+                    }
+                }
+            }
+        }
+        return message.msg_len;
+    }
+
+    unsigned int SocketDriverCommon::MMsgPlatformSocketDriver::Receive(char* data, unsigned maxDataSize, sockaddr* sockAddr, socklen_t sockAddrLen, ResultCode* resultCode)
+    {
+        if (!m_isBatching)
+        {
+            return PlatformSocketDriver::Receive(data, maxDataSize, sockAddr, sockAddrLen, resultCode);
+        }
+
+        while (true)
+        {
+            if (m_receiveIndex >= m_receivedCount)
+            {
+                for (unsigned int i = 0; i < k_batchSize; ++i)
+                {
+                    msghdr& header = m_receiveMessages[i].msg_hdr;
+                    memset(&header, 0, sizeof(header));
+                    header.msg_name = &m_receiveAddresses[i];
+                    header.msg_namelen = sizeof(sockaddr_storage);
+                    header.msg_iov = &m_receiveIov[i];
+                    header.msg_iovlen = 1;
+                    if (m_isGroEnabled)
+                    {
+                        header.msg_control = &m_receiveControl[i * k_controlSize];
+                        header.msg_controllen = k_controlSize;
+                    }
+                }
+
+                m_receiveIndex = 0;
+                m_receiveOffset = 0;
+                m_receivedCount = 0;
+                int received = recvmmsg(m_socket, m_receiveMessages.data(), k_batchSize, 0, nullptr);
+                if (IsSocketError(received))
+                {
+                    int error = GetSocketError();
+                    if (error != AZ_EWOULDBLOCK)
+                    {
+                        AZ_TracePrintf("GridMate", "SocketDriver::Receive - recvmmsg failed with code %d\n", error);
+                    }
+                    if (resultCode)
+                    {
+                        *resultCode = error == AZ_EWOULDBLOCK ? EC_OK : EC_RECEIVE; // would block is normal for non blocking sockets
+                    }
+                    return 0;
+                }
+                m_receivedCount = static_cast<unsigned int>(received);
+                if (!m_receivedCount)
+                {
+                    if (resultCode)
+                    {
+                        *resultCode = EC_OK;
+                    }
+                    return 0;
+                }
+            }
+
+            const mmsghdr& message = m_receiveMessages[m_receiveIndex];
+            const unsigned int messageSize = message.msg_len;
+            const unsigned int segmentSize = GetReceivedSegmentSize(message);
+            const unsigned int size = AZStd::GetMin(segmentSize, messageSize - m_receiveOffset);
+            const char* segment = &m_receiveBuffer[m_receiveIndex * m_receiveSlotSize + m_receiveOffset];
+            const bool isTruncated = (message.msg_hdr.msg_flags & MSG_TRUNC) != 0;
+            const sockaddr_storage& from = m_receiveAddresses[m_receiveIndex];
+
+            m_receiveOffset += size;
+            if (m_receiveOffset >= messageSize)
+            {
+                ++m_receiveIndex;
+                m_receiveOffset = 0;
+            }
+
+            if (size == sizeof(AZ_SOCKET_WAKEUP_MSG_TYPE) && *reinterpret_cast<const AZ_SOCKET_WAKEUP_MSG_TYPE*>(segment) == AZ_SOCKET_WAKEUP_MSG_VALUE)
+            {
+                continue;  // internal wake up message
+            }
+
+            if (isTruncated || size > maxDataSize)
+            {
+                AZ_TracePrintf("GridMate", "SocketDriver::Receive - discarding datagram of %u bytes, buffer is %u bytes\n", size, maxDataSize);
+                continue;
+            }
+
+            memcpy(data, segment, size);
+            memcpy(sockAddr, &from, AZStd::GetMin(static_cast<size_t>(sockAddrLen), sizeof(from)));
+            if (resultCode)
+            {
+                *resultCode = EC_OK;
+            }
+            return size;
+        }
+    }
+
+    bool SocketDriverCommon::MMsgPlatformSocketDriver::WaitForData(AZStd::chrono::microseconds timeOut)
+    {
+        FlushSends(); // don't hold datagrams while sleeping
+
+        if (m_receiveIndex < m_receivedCount)
+        {
+            m_parent.m_isStoppedWaitForData = true;
+            return true;
+        }
+        return PlatformSocketDriver::WaitForData(timeOut);
+    }
+#endif // AZ_SOCKET_MMSG_SUPPORT
+
 #ifdef AZ_SOCKET_RIO_SUPPORT
     SocketDriverCommon::RIOPlatformSocketDriver::RIOPlatformSocketDriver(SocketDriverCommon &parent, SocketType &socket)
         : PlatformSocketDriver(parent, socket)
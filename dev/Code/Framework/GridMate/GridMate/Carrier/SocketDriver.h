@@ -21,6 +21,7 @@
 
 #include <AzCore/std/functional_basic.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 #include <GridMate/Carrier/Driver.h>
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -52,7 +53,12 @@
 #   if __ANDROID_API__ <= 19
 #       include <sys/socket.h> // wasn't included in the API 19 version of <netinet/in.h>
 #   endif
-#elif defined(AZ_PLATFORM_LINUX) || defined(AZ_PLATFORM_APPLE)
+#elif defined(AZ_PLATFORM_LINUX)
+#   include <netinet/in.h>
+#   include <sys/socket.h>
+#   include <sys/uio.h>
+#   define AZ_SOCKET_MMSG_SUPPORT   // recvmmsg/sendmmsg batching
+#elif defined(AZ_PLATFORM_APPLE)
 #   include <netinet/in.h>
 #else
 #error Platform not supported.
@@ -219,6 +225,9 @@ namespace GridMate
         /// Return true if WaitForData was interrupted before the timeOut expired, otherwise false.
         virtual bool WasStopeedWaitingForData()                 { return m_isStoppedWaitForData; }
 
+        /// Flushes the datagrams a batching platform driver queued during the send pass.
+        virtual void ProcessOutgoing();
+
         /// @{ Address conversion functionality. They MUST implemented thread safe. Generally this is not a problem since they just part local data.
         ///  Create address from ip and port. If ip == NULL we will assign a broadcast address.
         virtual string  IPPortToAddress(const char* ip, unsigned int port) const                        { return IPPortToAddressString(ip, port); }
@@ -256,12 +265,74 @@ namespace GridMate
             virtual unsigned int Receive(char* data, unsigned maxDataSize, sockaddr* sockAddr, socklen_t sockAddrLen, ResultCode* resultCode = 0);
             virtual bool WaitForData(AZStd::chrono::microseconds timeOut = AZStd::chrono::microseconds(0));
             virtual void StopWaitForData();
+            /// Called at the end of the carrier's send pass, drivers that queue datagrams in Send must flush them here.
+            virtual void ProcessOutgoing() {}
             static bool isSupported();
         protected:
             SocketDriverCommon &m_parent;
             SocketType         &m_socket;
 
         };
+#ifdef AZ_SOCKET_MMSG_SUPPORT
+        /**
+        * Datagram driver that moves batches of datagrams per system call.
+        * Receive drains the socket with a single recvmmsg and hands out the datagrams one by one, Send queues the datagrams
+        * until the batch is full, ProcessOutgoing or WaitForData, and writes them with a single sendmmsg.
+        * When the kernel supports it, consecutive equally sized datagrams to the same address are sent as one UDP GSO message
+        * and coalesced UDP GRO messages are split back into datagrams on receive.
+        */
+        class MMsgPlatformSocketDriver final : public PlatformSocketDriver
+        {
+        public:
+            GM_CLASS_ALLOCATOR(MMsgPlatformSocketDriver);
+            MMsgPlatformSocketDriver(SocketDriverCommon &parent, SocketType &socket);
+            ~MMsgPlatformSocketDriver();
+            static bool isSupported();
+            ResultCode Initialize(unsigned int receiveBufferSize, unsigned int sendBufferSize) override;
+            ResultCode Send(const sockaddr* sockAddr, unsigned int addressSize, const char* data, unsigned int dataSize) override;
+            unsigned int Receive(char* data, unsigned maxDataSize, sockaddr* sockAddr, socklen_t sockAddrLen, ResultCode* resultCode) override;
+            bool WaitForData(AZStd::chrono::microseconds timeOut) override;
+            void ProcessOutgoing() override;
+
+        private:
+            ResultCode FlushSends();
+            unsigned int GetReceivedSegmentSize(const mmsghdr& message) const;
+
+            static const unsigned int k_batchSize = 64;             ///< Datagrams per system call
+            static const unsigned int k_maxGsoSegments = 64;        ///< Kernel limit of segments in one UDP GSO message
+            static const unsigned int k_maxGsoMessageSize = 65000;  ///< Stay below the max IP payload
+            static const unsigned int k_groReceiveSlotSize = 65535;
+            static const size_t k_controlSize = 32;                 ///< Fits one cmsghdr with an int or u16 payload
+
+            bool m_isBatching = false;          ///< False for stream sockets, all calls go to the generic driver
+            bool m_isGsoEnabled = false;
+            bool m_isGroEnabled = false;
+
+            // receive batch
+            unsigned int m_receiveSlotSize = 0;
+            unsigned int m_receivedCount = 0;   ///< Messages returned by the last recvmmsg
+            unsigned int m_receiveIndex = 0;    ///< Next message to hand out
+            unsigned int m_receiveOffset = 0;   ///< Offset of the next segment in a coalesced message
+            AZStd::vector<char> m_receiveBuffer;
+            AZStd::vector<char> m_receiveControl;
+            AZStd::vector<sockaddr_storage> m_receiveAddresses;
+            AZStd::vector<iovec> m_receiveIov;
+            AZStd::vector<mmsghdr> m_receiveMessages;
+
+            // send queue
+            unsigned int m_sendSlotSize = 0;
+            unsigned int m_sendCount = 0;       ///< Queued datagrams
+            ResultCode m_sendResult = EC_OK;    ///< Error of the last flush, reported by the next Send
+            AZStd::vector<char> m_sendBuffer;
+            AZStd::vector<char> m_sendControl;
+            AZStd::vector<unsigned int> m_sendSizes;
+            AZStd::vector<sockaddr_storage> m_sendAddresses;
+            AZStd::vector<socklen_t> m_sendAddressSizes;
+            AZStd::vector<iovec> m_sendIov;
+            AZStd::vector<mmsghdr> m_sendMessages;
+            AZStd::vector<unsigned int> m_sendMessageFirst; ///< First queued datagram of every message
+        };
+#endif
 #ifdef AZ_SOCKET_RIO_SUPPORT
         class RIOPlatformSocketDriver final : public PlatformSocketDriver
         {
@@ -0,0 +1,158 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef AZ_UNITY_BUILD
+
+#include <GridMate/Carrier/ZLibCompressor.h>
+
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+using namespace GridMate;
+
+//=========================================================================
+// ZLibCompressor
+//=========================================================================
+ZLibCompressor::ZLibCompressor(unsigned int compressionLevel, const AZStd::shared_ptr<const Dictionary>& dictionary)
+    : m_zlib(&AZ::AllocatorInstance<GridMateAllocatorMP>::Get())
+    , m_compressionLevel(compressionLevel)
+    , m_dictionary(dictionary)
+{
+    AZ::Crc32 type("ZLibCompressor");
+    type.Add(&m_compressionLevel, sizeof(m_compressionLevel));
+    if (m_dictionary)
+    {
+        type.Add(m_dictionary->data(), m_dictionary->size());
+    }
+    m_type = static_cast<CompressorType>(type);
+}
+
+//=========================================================================
+// ~ZLibCompressor
+//=========================================================================
+ZLibCompressor::~ZLibCompressor()
+{
+}
+
+//=========================================================================
+// Init
+//=========================================================================
+bool ZLibCompressor::Init()
+{
+    if (!m_zlib.IsCompressorStarted())
+    {
+        m_zlib.StartRawCompressor(m_compressionLevel);
+    }
+    if (!m_zlib.IsDecompressorStarted())
+    {
+        m_zlib.StartRawDecompressor();
+    }
+    return true;
+}
+
+//=========================================================================
+// GetType
+//=========================================================================
+CompressorType ZLibCompressor::GetType() const
+{
+    return m_type;
+}
+
+//=========================================================================
+// GetMaxChunkSize
+//=========================================================================
+size_t ZLibCompressor::GetMaxChunkSize(size_t maxCompSize) const
+{
+    // inverse of the deflate bound of a raw stream, the worst case is data stored in uncompressed blocks
+    const size_t overhead = (maxCompSize >> 12) + (maxCompSize >> 14) + (maxCompSize >> 25) + 7;
+    return maxCompSize > overhead ? maxCompSize - overhead : 0;
+}
+
+//=========================================================================
+// GetMaxCompressedBufferSize
+//=========================================================================
+size_t ZLibCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+{
+    return uncompSize + (uncompSize >> 12) + (uncompSize >> 14) + (uncompSize >> 25) + 7;
+}
+
+//=========================================================================
+// Compress
+//=========================================================================
+CompressorError ZLibCompressor::Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize)
+{
+    AZ_Assert(m_zlib.IsCompressorStarted(), "Compressor is not initialized!");
+
+    // every datagram is a complete stream, since datagrams can be lost
+    m_zlib.ResetCompressor();
+    if (m_dictionary)
+    {
+        m_zlib.SetCompressorDictionary(m_dictionary->data(), static_cast<unsigned int>(m_dictionary->size()));
+    }
+
+    unsigned int dataLeft = static_cast<unsigned int>(uncompSize);
+    compSize = m_zlib.Compress(uncompData, dataLeft, compData, static_cast<unsigned int>(compDataSize), AZ::ZLib::FT_FINISH);
+    if (dataLeft != 0)
+    {
+        compSize = 0;
+        return CompressorError::InsufficientBuffer;
+    }
+    return CompressorError::Ok;
+}
+
+//=========================================================================
+// Decompress
+//=========================================================================
+CompressorError ZLibCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize)
+{
+    AZ_Assert(m_zlib.IsDecompressorStarted(), "Compressor is not initialized!");
+
+    m_zlib.ResetDecompressor();
+    if (m_dictionary)
+    {
+        m_zlib.SetDecompressorDictionary(m_dictionary->data(), static_cast<unsigned int>(m_dictionary->size()));
+    }
+
+    unsigned int outputLeft = static_cast<unsigned int>(uncompDataSize);
+    consumedSize = m_zlib.Decompress(compData, static_cast<unsigned int>(compDataSize), uncompData, outputLeft, AZ::ZLib::FT_FINISH);
+    uncompSize = uncompDataSize - outputLeft;
+    if (m_zlib.IsDecompressorFailed())
+    {
+        return CompressorError::CorruptData;
+    }
+    if (consumedSize != compDataSize)
+    {
+        return outputLeft == 0 ? CompressorError::InsufficientBuffer : CompressorError::CorruptData;
+    }
+    return CompressorError::Ok;
+}
+
+//=========================================================================
+// ZLibCompressorFactory
+//=========================================================================
+ZLibCompressorFactory::ZLibCompressorFactory(unsigned int compressionLevel, ZLibCompressor::Dictionary dictionary)
+    : m_compressionLevel(compressionLevel)
+{
+    if (!dictionary.empty())
+    {
+        m_dictionary = AZStd::make_shared<ZLibCompressor::Dictionary>(AZStd::move(dictionary));
+    }
+}
+
+//=========================================================================
+// CreateCompressor
+//=========================================================================
+AZStd::shared_ptr<Compressor> ZLibCompressorFactory::CreateCompressor()
+{
+    return AZStd::shared_ptr<Compressor>(aznew ZLibCompressor(m_compressionLevel, m_dictionary));
+}
+
+#endif // #ifndef AZ_UNITY_BUILD
@@ -0,0 +1,80 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef GM_ZLIB_COMPRESSOR_H
+#define GM_ZLIB_COMPRESSOR_H
+
+#include <GridMate/Carrier/Compressor.h>
+#include <GridMate/Containers/vector.h>
+#include <GridMate/Memory.h>
+
+#include <AzCore/Compression/Compression.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace GridMate
+{
+    /**
+     * Datagram compressor based on raw deflate streams, with an optional preset dictionary.
+     * Datagrams can be lost or reordered, so every datagram is compressed on its own. For small datagrams most of the
+     * gain then comes from the dictionary: deflate can reference the dictionary as if it was data sent right before
+     * the datagram. A good dictionary is a capture of typical replica traffic (for example datagram payloads recorded
+     * in a play session), with the most frequent content at the end. Keep it small, a few KB, since it is loaded for
+     * every datagram.
+     * Both peers must use the same compression settings and dictionary. The compressor type includes the dictionary
+     * checksum, and the carrier rejects connections from peers with a different compressor type.
+     */
+    class ZLibCompressor
+        : public Compressor
+    {
+    public:
+        GM_CLASS_ALLOCATOR(ZLibCompressor);
+
+        typedef vector<char> Dictionary;
+
+        /// \param compressionLevel [1 - fastest to 9 - best compression]
+        /// \param dictionary optional preset dictionary, shared between all compressors created by a factory.
+        ZLibCompressor(unsigned int compressionLevel, const AZStd::shared_ptr<const Dictionary>& dictionary);
+        ~ZLibCompressor() override;
+
+        bool Init() override;
+        CompressorType GetType() const override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+        CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+    private:
+        AZ::ZLib m_zlib;
+        unsigned int m_compressionLevel;
+        AZStd::shared_ptr<const Dictionary> m_dictionary;
+        CompressorType m_type;
+    };
+
+    /**
+     * Creates ZLibCompressor instances with the same settings, set it as CarrierDesc::m_compressionFactory.
+     */
+    class ZLibCompressorFactory
+        : public CompressionFactory
+    {
+    public:
+        GM_CLASS_ALLOCATOR(ZLibCompressorFactory);
+
+        explicit ZLibCompressorFactory(unsigned int compressionLevel = 1, ZLibCompressor::Dictionary dictionary = ZLibCompressor::Dictionary());
+
+        AZStd::shared_ptr<Compressor> CreateCompressor() override;
+
+    private:
+        unsigned int m_compressionLevel;
+        AZStd::shared_ptr<const ZLibCompressor::Dictionary> m_dictionary;
+    };
+}
+
+#endif // GM_ZLIB_COMPRESSOR_H
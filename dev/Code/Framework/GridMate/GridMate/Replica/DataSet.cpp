@@ -41,6 +41,12 @@ namespace GridMate
         return ReadBuffer(m_streamCache.GetEndianType(), m_streamCache.Get(), m_streamCache.GetExactSize());
     }
 
+    void DataSetBase::Marshal(MarshalContext& mc) const
+    {
+        ReadBuffer data = GetMarshalData();
+        mc.m_outBuffer->WriteRaw(data.Get(), data.Size());
+    }
+
     void DataSetBase::SetDirty()
     {
         m_isDefaultValue = false;
@@ -89,8 +89,16 @@ namespace GridMate
 
         virtual PrepareDataResult PrepareData(EndianType endianType, AZ::u32 marshalFlags) = 0;
         virtual void Unmarshal(UnmarshalContext& mc) = 0;
+        /// Writes the value prepared by PrepareData to mc.m_outBuffer. Called from several threads when a replica is
+        /// marshaled to several peers at once, so it must not modify the DataSet.
+        virtual void Marshal(MarshalContext& mc) const;
         virtual void ResetDirty() = 0;
+        /// Marks the DataSet as changed. The owning chunk only prepares DataSets that were marked since they
+        /// were last prepared, so a value changed without Set(), Modify() or SetDirty() is not sent.
         virtual void SetDirty();
+        /// Returns true if the DataSet has to be prepared again on the next marshal even if it doesn't change,
+        /// e.g. to repeat unreliable updates while ACK feedback is disabled.
+        virtual bool IsResendPending() const { return false; }
         virtual void DispatchChangedEvent(const TimeContext& tc) { (void)tc; }
         ReadBuffer GetMarshalData() const;
 
@@ -395,6 +403,11 @@ namespace GridMate
             m_idleTicks = m_maxIdleTicks;
         }
 
+        bool IsResendPending() const override
+        {
+            return !ReplicaTarget::IsAckEnabled() && m_idleTicks < m_maxIdleTicks;
+        }
+
         bool IsWithinToleranceThreshold()
         {
             return m_throttler.WithinThreshold(m_value);
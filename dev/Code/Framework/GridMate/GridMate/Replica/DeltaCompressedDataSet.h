@@ -146,10 +146,12 @@ namespace GridMate
 
         /**
             Constructs a DataSet.
+            Marshalers that need settings, like the quantized marshalers in CompressionMarshal.h, can be passed
+            in for both portions. The relative portion only has to cover +/- DeltaRange.
         **/
-        explicit DeltaCompressedDataSet(const char* debugName, const FieldType& value = FieldType())
-            : m_absolutePortion(debugName, value)
-            , m_relativePortion(debugName)
+        explicit DeltaCompressedDataSet(const char* debugName, const FieldType& value = FieldType(), const MarshalerType& marshaler = MarshalerType(), const DeltaMarshalerType& deltaMarshaler = DeltaMarshalerType())
+            : m_absolutePortion(debugName, value, marshaler)
+            , m_relativePortion(debugName, FieldType(), deltaMarshaler)
         {
             static_assert(DeltaRange > 0, "Delta range cannot be zero!");
 
@@ -217,7 +219,8 @@ namespace GridMate
         : public DeltaCompressedDataSet<FieldType, DeltaRange, MarshalerType, DeltaMarshalerType>
     {
     public:
-        explicit BindInterface(const char* debugName) : DeltaCompressedDataSet(debugName) { }
+        explicit BindInterface(const char* debugName, const FieldType& value = FieldType(), const MarshalerType& marshaler = MarshalerType(), const DeltaMarshalerType& deltaMarshaler = DeltaMarshalerType())
+            : DeltaCompressedDataSet(debugName, value, marshaler, deltaMarshaler) { }
 
     protected:
         void OnAbsolutePortionChanged(const GridMate::TimeContext& tc) override
@@ -197,6 +197,7 @@ namespace GridMate
 
                     rt->m_slotMask |= handler->m_slot;
                     rt->m_flags &= ~ReplicaTarget::TargetRemoved;
+                    rt->SetRelevance(GetRelevance(replica->GetRepId(), peerId, rt->m_slotMask));
                 }
             }
         }
@@ -228,6 +229,19 @@ namespace GridMate
         return false;
     }
 
+    float InterestManager::GetRelevance(ReplicaId replicaId, PeerId peerId, InterestHandlerSlot slotMask) const
+    {
+        float relevance = 0.f;
+        for (BaseRulesHandler* handler : m_handlers)
+        {
+            if (handler->m_slot & slotMask)
+            {
+                relevance = AZStd::GetMax(relevance, handler->GetRelevance(replicaId, peerId));
+            }
+        }
+        return relevance;
+    }
+
     InterestHandlerSlot InterestManager::GetNewSlot()
     {
         InterestHandlerSlot s = m_freeSlots;
@@ -85,6 +85,7 @@ namespace GridMate
         InterestHandlerSlot GetNewSlot();
         void FreeSlot(InterestHandlerSlot slot);
         bool ShouldForward(Replica* replica, ReplicaPeer* peer) const;
+        float GetRelevance(ReplicaId replicaId, PeerId peerId, InterestHandlerSlot slotMask) const; // highest relevance of the handlers in the mask
 
         ReplicaManager* m_rm;
         vector<BaseRulesHandler*> m_handlers;
@@ -59,6 +59,14 @@ namespace GridMate
         */
         virtual InterestManager* GetManager() = 0;
 
+        /**
+        *  Returns how relevant the replica is to the peer for a match of the last result (e.g. based on distance).
+        *  InterestManager applies the highest relevance of the handlers matching a replica to a peer to the replica's target,
+        *  where it scales the replica's send priority under bandwidth limits. To update the relevance of an existing match
+        *  include it in the next result again.
+        */
+        virtual float GetRelevance(ReplicaId replicaId, PeerId peerId) const { (void)replicaId; (void)peerId; return 1.f; }
+
     private:
         friend class InterestManager;
 
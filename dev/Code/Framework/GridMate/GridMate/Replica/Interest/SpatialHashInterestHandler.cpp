@@ -0,0 +1,681 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <GridMate/Replica/Interest/SpatialHashInterestHandler.h>
+
+#include <GridMate/Replica/Replica.h>
+#include <GridMate/Replica/ReplicaFunctions.h>
+#include <GridMate/Replica/ReplicaMgr.h>
+
+#include <GridMate/Replica/Interest/InterestManager.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/sort.h>
+
+#include <math.h>
+
+namespace GridMate
+{
+    namespace Internal
+    {
+        // 21 bits per axis in the cell key
+        static const int k_maxCellCoord = (1 << 20) - 1;
+
+        bool SpatialHashCellRange::operator==(const SpatialHashCellRange& other) const
+        {
+            if (m_isEmpty || other.m_isEmpty)
+            {
+                return m_isEmpty == other.m_isEmpty;
+            }
+
+            if (m_isOversized || other.m_isOversized)
+            {
+                return m_isOversized == other.m_isOversized;
+            }
+
+            for (int i = 0; i < 3; ++i)
+            {
+                if (m_min[i] != other.m_min[i] || m_max[i] != other.m_max[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    void SpatialHashInterestChunk::OnReplicaActivate(const ReplicaContext& rc)
+    {
+        m_interestHandler = static_cast<SpatialHashInterestHandler*>(rc.m_rm->GetUserContext(AZ_CRC("SpatialHashInterestHandler", 0x8c96dea6)));
+        AZ_Warning("GridMate", m_interestHandler, "No spatial hash interest handler in the user context");
+
+        if (m_interestHandler)
+        {
+            m_interestHandler->OnNewRulesChunk(this, rc.m_peer);
+        }
+    }
+
+    void SpatialHashInterestChunk::OnReplicaDeactivate(const ReplicaContext& rc)
+    {
+        if (rc.m_peer && m_interestHandler)
+        {
+            m_interestHandler->OnDeleteRulesChunk(this, rc.m_peer);
+        }
+    }
+
+    bool SpatialHashInterestChunk::AddRuleFn(RuleNetworkId netId, AZ::Aabb bbox, const RpcContext& ctx)
+    {
+        if (IsProxy())
+        {
+            auto rulePtr = m_interestHandler->CreateRule(ctx.m_sourcePeer);
+            rulePtr->Set(bbox);
+            m_rules.insert(AZStd::make_pair(netId, rulePtr));
+        }
+
+        return true;
+    }
+
+    bool SpatialHashInterestChunk::RemoveRuleFn(RuleNetworkId netId, const RpcContext&)
+    {
+        if (IsProxy())
+        {
+            m_rules.erase(netId);
+        }
+
+        return true;
+    }
+
+    bool SpatialHashInterestChunk::UpdateRuleFn(RuleNetworkId netId, AZ::Aabb bbox, const RpcContext&)
+    {
+        if (IsProxy())
+        {
+            auto it = m_rules.find(netId);
+            if (it != m_rules.end())
+            {
+                it->second->Set(bbox);
+            }
+        }
+
+        return true;
+    }
+
+    bool SpatialHashInterestChunk::AddRuleForPeerFn(RuleNetworkId netId, PeerId peerId, AZ::Aabb bbox, const RpcContext&)
+    {
+        SpatialHashInterestChunk* peerChunk = m_interestHandler->FindRulesChunkByPeerId(peerId);
+        if (peerChunk)
+        {
+            auto it = peerChunk->m_rules.find(netId);
+            if (it == peerChunk->m_rules.end())
+            {
+                auto rulePtr = m_interestHandler->CreateRule(peerId);
+                peerChunk->m_rules.insert(AZStd::make_pair(netId, rulePtr));
+                rulePtr->Set(bbox);
+            }
+        }
+        return false;
+    }
+    ///////////////////////////////////////////////////////////////////////////
+
+
+    /*
+    * SpatialHashInterest
+    */
+    SpatialHashInterest::SpatialHashInterest(SpatialHashInterestHandler* handler)
+        : m_handler(handler)
+        , m_bbox(AZ::Aabb::CreateNull())
+        , m_queryStamp(0)
+        , m_isDirty(false)
+    {
+        AZ_Assert(m_handler, "Invalid interest handler");
+    }
+    ///////////////////////////////////////////////////////////////////////////
+
+
+    /*
+    * SpatialHashInterestRule
+    */
+    void SpatialHashInterestRule::Set(const AZ::Aabb& bbox)
+    {
+        m_handler->UpdateRule(this, bbox);
+    }
+
+    void SpatialHashInterestRule::Destroy()
+    {
+        m_handler->DestroyRule(this);
+    }
+    ///////////////////////////////////////////////////////////////////////////
+
+
+    /*
+    * SpatialHashInterestAttribute
+    */
+    void SpatialHashInterestAttribute::Set(const AZ::Aabb& bbox)
+    {
+        m_handler->UpdateAttribute(this, bbox);
+    }
+
+    void SpatialHashInterestAttribute::Destroy()
+    {
+        m_handler->DestroyAttribute(this);
+    }
+    ///////////////////////////////////////////////////////////////////////////
+
+
+    /*
+    * SpatialHashInterestHandler
+    */
+    SpatialHashInterestHandler::SpatialHashInterestHandler(float cellSize)
+        : m_im(nullptr)
+        , m_rm(nullptr)
+        , m_lastRuleNetId(0)
+        , m_cellSize(cellSize)
+        , m_invCellSize(1.f / cellSize)
+        , m_queryStamp(0)
+        , m_rulesReplica(nullptr)
+    {
+        AZ_Assert(cellSize > 0.f, "Invalid cell size %f", cellSize);
+    }
+
+    SpatialHashInterestRule::Ptr SpatialHashInterestHandler::CreateRule(PeerId peerId)
+    {
+        SpatialHashInterestRule* rulePtr = aznew SpatialHashInterestRule(this, peerId, GetNewRuleNetId());
+        if (m_rm && peerId == m_rm->GetLocalPeerId())
+        {
+            m_rulesReplica->AddRuleRpc(rulePtr->GetNetworkId(), rulePtr->Get());
+        }
+
+        m_localRules.insert(rulePtr);
+
+        return rulePtr;
+    }
+
+    SpatialHashInterestAttribute::Ptr SpatialHashInterestHandler::CreateAttribute(ReplicaId replicaId)
+    {
+        auto newAttribute = aznew SpatialHashInterestAttribute(this, replicaId);
+        AZ_Assert(newAttribute, "Out of memory");
+
+        m_attributes.insert(newAttribute);
+
+        return newAttribute;
+    }
+
+    void SpatialHashInterestHandler::FreeRule(SpatialHashInterestRule* rule)
+    {
+        delete rule;
+    }
+
+    void SpatialHashInterestHandler::DestroyRule(SpatialHashInterestRule* rule)
+    {
+        if (m_rm && rule->GetPeerId() == m_rm->GetLocalPeerId())
+        {
+            m_rulesReplica->RemoveRuleRpc(rule->GetNetworkId());
+        }
+
+        MarkAttributesDirtyInBox(rule->m_bbox);
+
+        // kept alive until the next update, it might still be in the dirty list
+        rule->m_bbox = AZ::Aabb::CreateNull();
+        Rebin(rule, m_oversizedRules, &Cell::m_rules);
+        m_removedRules.push_back(rule);
+        m_localRules.erase(rule);
+    }
+
+    void SpatialHashInterestHandler::UpdateRule(SpatialHashInterestRule* rule, const AZ::Aabb& bbox)
+    {
+        if (m_rm && rule->GetPeerId() == m_rm->GetLocalPeerId())
+        {
+            m_rulesReplica->UpdateRuleRpc(rule->GetNetworkId(), bbox);
+        }
+
+        // attributes in the old bbox might lose the rule, the ones in the new bbox are marked on the next update
+        MarkAttributesDirtyInBox(rule->m_bbox);
+
+        rule->m_bbox = bbox;
+        Rebin(rule, m_oversizedRules, &Cell::m_rules);
+
+        if (!rule->m_isDirty)
+        {
+            rule->m_isDirty = true;
+            m_dirtyRules.push_back(rule);
+        }
+    }
+
+    void SpatialHashInterestHandler::FreeAttribute(SpatialHashInterestAttribute* attrib)
+    {
+        delete attrib;
+    }
+
+    void SpatialHashInterestHandler::DestroyAttribute(SpatialHashInterestAttribute* attrib)
+    {
+        // kept alive until the next update, it might still be in the dirty list
+        attrib->m_bbox = AZ::Aabb::CreateNull();
+        Rebin(attrib, m_oversizedAttributes, &Cell::m_attributes);
+
+        m_attributes.erase(attrib);
+        m_removedAttributes.push_back(attrib);
+    }
+
+    void SpatialHashInterestHandler::UpdateAttribute(SpatialHashInterestAttribute* attrib, const AZ::Aabb& bbox)
+    {
+        attrib->m_bbox = bbox;
+        Rebin(attrib, m_oversizedAttributes, &Cell::m_attributes);
+
+        MarkDirty(attrib);
+    }
+
+    void SpatialHashInterestHandler::OnNewRulesChunk(SpatialHashInterestChunk* chunk, ReplicaPeer* peer)
+    {
+        if (chunk != m_rulesReplica) // non-local
+        {
+            m_peerChunks.insert(AZStd::make_pair(peer->GetId(), chunk));
+
+            for (auto& rule : m_localRules)
+            {
+                chunk->AddRuleForPeerRpc(rule->GetNetworkId(), rule->GetPeerId(), rule->Get());
+            }
+        }
+    }
+
+    void SpatialHashInterestHandler::OnDeleteRulesChunk(SpatialHashInterestChunk* chunk, ReplicaPeer* peer)
+    {
+        (void)chunk;
+        m_peerChunks.erase(peer->GetId());
+    }
+
+    RuleNetworkId SpatialHashInterestHandler::GetNewRuleNetId()
+    {
+        ++m_lastRuleNetId;
+
+        if (m_rulesReplica)
+        {
+            return m_rulesReplica->GetReplicaId() | (static_cast<AZ::u64>(m_lastRuleNetId) << 32);
+        }
+
+        return (static_cast<AZ::u64>(m_lastRuleNetId) << 32);
+    }
+
+    SpatialHashInterestChunk* SpatialHashInterestHandler::FindRulesChunkByPeerId(PeerId peerId)
+    {
+        auto it = m_peerChunks.find(peerId);
+        if (it == m_peerChunks.end())
+        {
+            return nullptr;
+        }
+
+        return it->second;
+    }
+
+    const InterestMatchResult& SpatialHashInterestHandler::GetLastResult()
+    {
+        return m_resultCache;
+    }
+
+    Internal::SpatialHashCellRange SpatialHashInterestHandler::GetCellRange(const AZ::Aabb& bbox) const
+    {
+        Internal::SpatialHashCellRange range;
+        if (!bbox.IsValid())
+        {
+            return range;
+        }
+
+        const AZ::Vector3 bboxMin = bbox.GetMin();
+        const AZ::Vector3 bboxMax = bbox.GetMax();
+        const float mins[3] = { bboxMin.GetX(), bboxMin.GetY(), bboxMin.GetZ() };
+        const float maxs[3] = { bboxMax.GetX(), bboxMax.GetY(), bboxMax.GetZ() };
+
+        AZ::u64 numCells = 1;
+        for (int i = 0; i < 3; ++i)
+        {
+            const float cellMin = AZ::GetClamp(floorf(mins[i] * m_invCellSize), static_cast<float>(-Internal::k_maxCellCoord), static_cast<float>(Internal::k_maxCellCoord));
+            const float cellMax = AZ::GetClamp(floorf(maxs[i] * m_invCellSize), static_cast<float>(-Internal::k_maxCellCoord), static_cast<float>(Internal::k_maxCellCoord));
+            range.m_min[i] = static_cast<int>(cellMin);
+            range.m_max[i] = static_cast<int>(cellMax);
+            numCells *= static_cast<AZ::u64>(range.m_max[i] - range.m_min[i] + 1);
+        }
+
+        range.m_isEmpty = false;
+        range.m_isOversized = numCells > k_maxCellsPerInterest;
+        return range;
+    }
+
+    AZ::u64 SpatialHashInterestHandler::GetCellKey(int x, int y, int z)
+    {
+        const AZ::u64 mask = (1 << 21) - 1;
+        return (static_cast<AZ::u64>(x) & mask) | ((static_cast<AZ::u64>(y) & mask) << 21) | ((static_cast<AZ::u64>(z) & mask) << 42);
+    }
+
+    template<class Func>
+    void SpatialHashInterestHandler::ForEachCell(const Internal::SpatialHashCellRange& cells, Func func)
+    {
+        AZ_Assert(!cells.m_isEmpty && !cells.m_isOversized, "Range is not in the grid");
+        for (int z = cells.m_min[2]; z <= cells.m_max[2]; ++z)
+        {
+            for (int y = cells.m_min[1]; y <= cells.m_max[1]; ++y)
+            {
+                for (int x = cells.m_min[0]; x <= cells.m_max[0]; ++x)
+                {
+                    func(GetCellKey(x, y, z));
+                }
+            }
+        }
+    }
+
+    template<class T>
+    void SpatialHashInterestHandler::RemoveFromList(vector<T*>& list, T* item)
+    {
+        auto it = AZStd::find(list.begin(), list.end(), item);
+        if (it != list.end())
+        {
+            // order doesn't matter
+            *it = list.back();
+            list.pop_back();
+        }
+    }
+
+    template<class T>
+    void SpatialHashInterestHandler::Rebin(T* interest, vector<T*>& oversizedList, vector<T*> Cell::* cellList)
+    {
+        const Internal::SpatialHashCellRange cells = GetCellRange(interest->m_bbox);
+        if (cells == interest->m_cells)
+        {
+            return;
+        }
+
+        const Internal::SpatialHashCellRange& oldCells = interest->m_cells;
+        if (oldCells.m_isOversized)
+        {
+            RemoveFromList(oversizedList, interest);
+        }
+        else if (!oldCells.m_isEmpty)
+        {
+            ForEachCell(oldCells, [&](AZ::u64 key)
+            {
+                auto cellIt = m_cells.find(key);
+                AZ_Assert(cellIt != m_cells.end(), "Interest is not in its cell");
+                Cell& cell = cellIt->second;
+                RemoveFromList(cell.*cellList, interest);
+                if (cell.m_attributes.empty() && cell.m_rules.empty())
+                {
+                    m_cells.erase(cellIt);
+                }
+            });
+        }
+
+        if (cells.m_isOversized)
+        {
+            oversizedList.push_back(interest);
+        }
+        else if (!cells.m_isEmpty)
+        {
+            ForEachCell(cells, [&](AZ::u64 key)
+            {
+                (m_cells[key].*cellList).push_back(interest);
+            });
+        }
+
+        interest->m_cells = cells;
+    }
+
+    void SpatialHashInterestHandler::MarkDirty(SpatialHashInterestAttribute* attribute)
+    {
+        if (!attribute->m_isDirty)
+        {
+            attribute->m_isDirty = true;
+            m_dirtyAttributes.push_back(attribute);
+        }
+    }
+
+    void SpatialHashInterestHandler::MarkAttributesDirtyInBox(const AZ::Aabb& bbox)
+    {
+        const Internal::SpatialHashCellRange cells = GetCellRange(bbox);
+        if (cells.m_isEmpty)
+        {
+            return;
+        }
+
+        if (cells.m_isOversized)
+        {
+            for (SpatialHashInterestAttribute* attribute : m_attributes)
+            {
+                if (bbox.Overlaps(attribute->m_bbox))
+                {
+                    MarkDirty(attribute);
+                }
+            }
+            return;
+        }
+
+        // an attribute spanning several cells is found once per cell
+        ++m_queryStamp;
+        ForEachCell(cells, [&](AZ::u64 key)
+        {
+            auto cellIt = m_cells.find(key);
+            if (cellIt == m_cells.end())
+            {
+                return;
+            }
+
+            for (SpatialHashInterestAttribute* attribute : cellIt->second.m_attributes)
+            {
+                if (attribute->m_queryStamp != m_queryStamp)
+                {
+                    attribute->m_queryStamp = m_queryStamp;
+                    if (bbox.Overlaps(attribute->m_bbox))
+                    {
+                        MarkDirty(attribute);
+                    }
+                }
+            }
+        });
+
+        for (SpatialHashInterestAttribute* attribute : m_oversizedAttributes)
+        {
+            if (bbox.Overlaps(attribute->m_bbox))
+            {
+                MarkDirty(attribute);
+            }
+        }
+    }
+
+    void SpatialHashInterestHandler::EvaluateAttribute(SpatialHashInterestAttribute* attribute)
+    {
+        m_peersScratch.clear();
+
+        const AZ::Aabb& bbox = attribute->m_bbox;
+        const Internal::SpatialHashCellRange& cells = attribute->m_cells;
+        if (cells.m_isOversized)
+        {
+            for (SpatialHashInterestRule* rule : m_localRules)
+            {
+                if (bbox.Overlaps(rule->m_bbox))
+                {
+                    m_peersScratch.push_back(rule->GetPeerId());
+                }
+            }
+        }
+        else if (!cells.m_isEmpty)
+        {
+            ++m_queryStamp;
+            ForEachCell(cells, [&](AZ::u64 key)
+            {
+                auto cellIt = m_cells.find(key);
+                if (cellIt == m_cells.end())
+                {
+                    return;
+                }
+
+                for (SpatialHashInterestRule* rule : cellIt->second.m_rules)
+                {
+                    if (rule->m_queryStamp != m_queryStamp)
+                    {
+                        rule->m_queryStamp = m_queryStamp;
+                        if (bbox.Overlaps(rule->m_bbox))
+                        {
+                            m_peersScratch.push_back(rule->GetPeerId());
+                        }
+                    }
+                }
+            });
+
+            for (SpatialHashInterestRule* rule : m_oversizedRules)
+            {
+                if (bbox.Overlaps(rule->m_bbox))
+                {
+                    m_peersScratch.push_back(rule->GetPeerId());
+                }
+            }
+        }
+
+        // peers with several rules on the attribute are only listed once
+        AZStd::sort(m_peersScratch.begin(), m_peersScratch.end());
+        size_t numPeers = 0;
+        for (size_t i = 0; i < m_peersScratch.size(); ++i)
+        {
+            if (numPeers == 0 || m_peersScratch[numPeers - 1] != m_peersScratch[i])
+            {
+                m_peersScratch[numPeers++] = m_peersScratch[i];
+            }
+        }
+        m_peersScratch.resize(numPeers);
+
+        if (attribute->m_isMatched && m_peersScratch == attribute->m_peers)
+        {
+            return;
+        }
+
+        attribute->m_isMatched = true;
+        attribute->m_peers.assign(m_peersScratch.begin(), m_peersScratch.end());
+
+        auto resultIt = m_resultCache.insert(attribute->GetReplicaId());
+        InterestPeerSet& peers = resultIt.first->second;
+        peers.clear();
+        peers.insert(attribute->m_peers.begin(), attribute->m_peers.end());
+    }
+
+    void SpatialHashInterestHandler::Update()
+    {
+        /*
+         * Only returns the attributes that changed the set of peers they are matched to, either because:
+         * 1) they moved to or out of some rules
+         * 2) rules moved to or out of them
+         * Every other attribute keeps the peers it was matched to before.
+         */
+        m_resultCache.clear();
+
+        for (SpatialHashInterestRule* rule : m_dirtyRules)
+        {
+            MarkAttributesDirtyInBox(rule->m_bbox);
+            rule->m_isDirty = false;
+        }
+        m_dirtyRules.clear();
+
+        for (SpatialHashInterestRule* removedRule : m_removedRules)
+        {
+            FreeRule(removedRule);
+        }
+        m_removedRules.clear();
+
+        for (SpatialHashInterestAttribute* attribute : m_dirtyAttributes)
+        {
+            EvaluateAttribute(attribute);
+            attribute->m_isDirty = false;
+        }
+        m_dirtyAttributes.clear();
+
+        // mark removed attribute as having no peers
+        for (SpatialHashInterestAttribute* removedAttribute : m_removedAttributes)
+        {
+            auto resultIt = m_resultCache.insert(removedAttribute->GetReplicaId());
+            resultIt.first->second.clear();
+            FreeAttribute(removedAttribute);
+        }
+        m_removedAttributes.clear();
+    }
+
+    void SpatialHashInterestHandler::OnRulesHandlerRegistered(InterestManager* manager)
+    {
+        AZ_Assert(m_im == nullptr, "Handler is already registered with manager %p (%p)\n", m_im, manager);
+        AZ_Assert(m_rulesReplica == nullptr, "Rules replica is already created\n");
+        AZ_TracePrintf("GridMate", "Spatial hash interest handler is registered\n");
+        m_im = manager;
+        m_rm = m_im->GetReplicaManager();
+        m_rm->RegisterUserContext(AZ_CRC("SpatialHashInterestHandler", 0x8c96dea6), this);
+
+        auto replica = Replica::CreateReplica("SpatialHashInterestHandlerRules");
+        m_rulesReplica = CreateAndAttachReplicaChunk<SpatialHashInterestChunk>(replica);
+        m_rm->AddMaster(replica);
+    }
+
+    void SpatialHashInterestHandler::OnRulesHandlerUnregistered(InterestManager* manager)
+    {
+        (void)manager;
+        AZ_Assert(m_im == manager, "Handler was not registered with manager %p (%p)\n", manager, m_im);
+        AZ_TracePrintf("GridMate", "Spatial hash interest handler is unregistered\n");
+        m_rulesReplica = nullptr;
+        m_im = nullptr;
+        m_rm->UnregisterUserContext(AZ_CRC("SpatialHashInterestHandler", 0x8c96dea6));
+        m_rm = nullptr;
+
+        for (auto& chunk : m_peerChunks)
+        {
+            chunk.second->m_interestHandler = nullptr;
+        }
+        m_peerChunks.clear();
+
+        DestroyAll();
+
+        m_resultCache.clear();
+    }
+
+    void SpatialHashInterestHandler::DestroyAll()
+    {
+        m_dirtyRules.clear();
+        m_dirtyAttributes.clear();
+        m_oversizedRules.clear();
+        m_oversizedAttributes.clear();
+        m_cells.clear();
+
+        for (SpatialHashInterestRule* rule : m_localRules)
+        {
+            FreeRule(rule);
+        }
+        m_localRules.clear();
+
+        for (SpatialHashInterestAttribute* attr : m_attributes)
+        {
+            FreeAttribute(attr);
+        }
+        m_attributes.clear();
+
+        for (SpatialHashInterestRule* removedRule : m_removedRules)
+        {
+            FreeRule(removedRule);
+        }
+        m_removedRules.clear();
+
+        for (SpatialHashInterestAttribute* removedAttribute : m_removedAttributes)
+        {
+            FreeAttribute(removedAttribute);
+        }
+        m_removedAttributes.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    SpatialHashInterestHandler::~SpatialHashInterestHandler()
+    {
+        /*
+         * If a handler was registered with a InterestManager, then InterestManager ought to have called OnRulesHandlerUnregistered
+         * but this is a safety pre-caution.
+         */
+        DestroyAll();
+    }
+}
@@ -0,0 +1,325 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#ifndef GM_REPLICA_SPATIALHASHINTERESTHANDLER_H
+#define GM_REPLICA_SPATIALHASHINTERESTHANDLER_H
+
+#include <GridMate/Replica/RemoteProcedureCall.h>
+#include <GridMate/Replica/ReplicaChunk.h>
+#include <GridMate/Replica/Interest/RulesHandler.h>
+#include <GridMate/Serialize/UtilityMarshal.h>
+
+#include <GridMate/Containers/vector.h>
+#include <GridMate/Containers/unordered_map.h>
+#include <GridMate/Containers/unordered_set.h>
+
+#include <AzCore/Math/Aabb.h>
+
+namespace GridMate
+{
+    class SpatialHashInterestHandler;
+    class SpatialHashInterestRule;
+    class SpatialHashInterestAttribute;
+
+    namespace Internal
+    {
+        /*
+        * Range of grid cells a bounding box is registered in
+        */
+        struct SpatialHashCellRange
+        {
+            int m_min[3];
+            int m_max[3];
+            bool m_isEmpty = true;      ///< not in the grid, the bbox is null
+            bool m_isOversized = false; ///< covers too many cells, kept in a separate list instead of the grid
+
+            bool operator==(const SpatialHashCellRange& other) const;
+            bool operator!=(const SpatialHashCellRange& other) const { return !(*this == other); }
+        };
+    }
+
+    /*
+    * Base interest
+    */
+    class SpatialHashInterest
+    {
+        friend class SpatialHashInterestHandler;
+
+    public:
+        const AZ::Aabb& Get() const { return m_bbox; }
+
+    protected:
+        explicit SpatialHashInterest(SpatialHashInterestHandler* handler);
+
+        SpatialHashInterestHandler* m_handler;
+        AZ::Aabb m_bbox;
+        Internal::SpatialHashCellRange m_cells;
+        AZ::u32 m_queryStamp; ///< last query that visited this, a bbox is found in every cell it covers
+        bool m_isDirty;
+    };
+    ///////////////////////////////////////////////////////////////////////////
+
+
+    /*
+    * Spatial hash rule
+    */
+    class SpatialHashInterestRule
+        : public InterestRule
+        , public SpatialHashInterest
+    {
+        friend class SpatialHashInterestHandler;
+
+    public:
+        using Ptr = AZStd::intrusive_ptr<SpatialHashInterestRule>;
+
+        GM_CLASS_ALLOCATOR(SpatialHashInterestRule);
+
+        void Set(const AZ::Aabb& bbox);
+
+    private:
+
+        // Intrusive ptr
+        template<class T>
+        friend struct AZStd::IntrusivePtrCountPolicy;
+        unsigned int m_refCount = 0;
+        AZ_FORCE_INLINE void add_ref() { ++m_refCount; }
+        AZ_FORCE_INLINE void release() { --m_refCount; if (!m_refCount) Destroy(); }
+        AZ_FORCE_INLINE bool IsDeleted() const { return m_refCount == 0; }
+        ///////////////////////////////////////////////////////////////////////////
+
+        SpatialHashInterestRule(SpatialHashInterestHandler* handler, PeerId peerId, RuleNetworkId netId)
+            : InterestRule(peerId, netId)
+            , SpatialHashInterest(handler)
+        {}
+
+        void Destroy();
+    };
+    ///////////////////////////////////////////////////////////////////////////
+
+
+    /*
+    * Spatial hash attribute
+    */
+    class SpatialHashInterestAttribute
+        : public InterestAttribute
+        , public SpatialHashInterest
+    {
+        friend class SpatialHashInterestHandler;
+        template<class T> friend class InterestPtr;
+
+    public:
+        using Ptr = AZStd::intrusive_ptr<SpatialHashInterestAttribute>;
+
+        GM_CLASS_ALLOCATOR(SpatialHashInterestAttribute);
+
+        void Set(const AZ::Aabb& bbox);
+
+    private:
+
+        // Intrusive ptr
+        template<class T>
+        friend struct AZStd::IntrusivePtrCountPolicy;
+        unsigned int m_refCount = 0;
+        AZ_FORCE_INLINE void add_ref() { ++m_refCount; }
+        AZ_FORCE_INLINE void release() { --m_refCount; if (!m_refCount) Destroy(); }
+        AZ_FORCE_INLINE bool IsDeleted() const { return m_refCount == 0; }
+        ///////////////////////////////////////////////////////////////////////////
+
+        SpatialHashInterestAttribute(SpatialHashInterestHandler* handler, ReplicaId repId)
+            : InterestAttribute(repId)
+            , SpatialHashInterest(handler)
+            , m_isMatched(false)
+        {}
+
+        void Destroy();
+
+        vector<PeerId> m_peers; ///< sorted peers of the rules matched in the last update
+        bool m_isMatched;       ///< was reported in the results at least once
+    };
+    ///////////////////////////////////////////////////////////////////////////
+
+    class SpatialHashInterestChunk
+        : public ReplicaChunk
+    {
+    public:
+        GM_CLASS_ALLOCATOR(SpatialHashInterestChunk);
+
+        // ReplicaChunk
+        typedef AZStd::intrusive_ptr<SpatialHashInterestChunk> Ptr;
+        bool IsReplicaMigratable() override { return false; }
+        bool IsBroadcast() override { return true; }
+        static const char* GetChunkName() { return "SpatialHashInterestChunk"; }
+
+        SpatialHashInterestChunk()
+            : AddRuleRpc("AddRule")
+            , RemoveRuleRpc("RemoveRule")
+            , UpdateRuleRpc("UpdateRule")
+            , AddRuleForPeerRpc("AddRuleForPeerRpc")
+            , m_interestHandler(nullptr)
+        {
+        }
+
+        void OnReplicaActivate(const ReplicaContext& rc) override;
+        void OnReplicaDeactivate(const ReplicaContext& rc) override;
+
+        bool AddRuleFn(RuleNetworkId netId, AZ::Aabb bbox, const RpcContext& ctx);
+        bool RemoveRuleFn(RuleNetworkId netId, const RpcContext&);
+        bool UpdateRuleFn(RuleNetworkId netId, AZ::Aabb bbox, const RpcContext&);
+        bool AddRuleForPeerFn(RuleNetworkId netId, PeerId peerId, AZ::Aabb bbox, const RpcContext&);
+
+        Rpc<RpcArg<RuleNetworkId>, RpcArg<AZ::Aabb>>::BindInterface<SpatialHashInterestChunk, &SpatialHashInterestChunk::AddRuleFn> AddRuleRpc;
+        Rpc<RpcArg<RuleNetworkId>>::BindInterface<SpatialHashInterestChunk, &SpatialHashInterestChunk::RemoveRuleFn> RemoveRuleRpc;
+        Rpc<RpcArg<RuleNetworkId>, RpcArg<AZ::Aabb>>::BindInterface<SpatialHashInterestChunk, &SpatialHashInterestChunk::UpdateRuleFn> UpdateRuleRpc;
+
+        Rpc<RpcArg<RuleNetworkId>, RpcArg<PeerId>, RpcArg<AZ::Aabb>>::BindInterface<SpatialHashInterestChunk, &SpatialHashInterestChunk::AddRuleForPeerFn> AddRuleForPeerRpc;
+
+        unordered_map<RuleNetworkId, SpatialHashInterestRule::Ptr> m_rules;
+        SpatialHashInterestHandler* m_interestHandler;
+    };
+
+    /*
+    * Rules handler
+    * Matches the same bounding box rules and attributes as ProximityInterestHandler, for worlds with many moving
+    * attributes. Rules and attributes are registered in a uniform grid of cubic cells, hashed by cell coordinates,
+    * and only move between cells when their bbox does. An update only re-evaluates the attributes that moved, and the
+    * attributes inside the rules that moved, against the rules of the cells they cover. Every other match is kept from
+    * the previous update, so the cost follows the amount of movement instead of the size of the world.
+    * Pick a cell size around the size of a typical rule: smaller cells mean more cells per rule, larger cells more
+    * candidates per cell. Boxes that cover more than k_maxCellsPerInterest cells are checked against everything.
+    */
+    class SpatialHashInterestHandler
+        : public BaseRulesHandler
+    {
+        friend class SpatialHashInterestRule;
+        friend class SpatialHashInterestAttribute;
+        friend class SpatialHashInterestChunk;
+
+    public:
+
+        typedef unordered_set<SpatialHashInterestAttribute*> AttributeSet;
+        typedef unordered_set<SpatialHashInterestRule*> RuleSet;
+        typedef vector<SpatialHashInterestAttribute*> AttributeList;
+        typedef vector<SpatialHashInterestRule*> RuleList;
+
+        GM_CLASS_ALLOCATOR(SpatialHashInterestHandler);
+
+        static const int k_maxCellsPerInterest = 64;
+
+        explicit SpatialHashInterestHandler(float cellSize = 64.f);
+        ~SpatialHashInterestHandler();
+
+        /*
+         * Creates new spatial hash rule and binds it to the peer.
+         * Note: the lifetime of the created rule is tied to the lifetime of this handler.
+         */
+        SpatialHashInterestRule::Ptr CreateRule(PeerId peerId);
+
+        /*
+         * Creates new spatial hash attribute and binds it to the replica.
+         * Note: the lifetime of the created attribute is tied to the lifetime of this handler.
+         */
+        SpatialHashInterestAttribute::Ptr CreateAttribute(ReplicaId replicaId);
+
+        // Calculates rules and attributes matches
+        void Update() override;
+
+        // Returns last recalculated results
+        const InterestMatchResult& GetLastResult() override;
+
+        // Returns the manager it's bound to
+        InterestManager* GetManager() override { return m_im; }
+
+        // Rules that this handler is aware of
+        const RuleSet& GetLocalRules() const { return m_localRules; }
+
+        float GetCellSize() const { return m_cellSize; }
+
+    private:
+        struct Cell
+        {
+            AttributeList m_attributes;
+            RuleList m_rules;
+        };
+
+        typedef unordered_map<AZ::u64, Cell> CellMap;
+
+        // BaseRulesHandler
+        void OnRulesHandlerRegistered(InterestManager* manager) override;
+        void OnRulesHandlerUnregistered(InterestManager* manager) override;
+
+        void DestroyRule(SpatialHashInterestRule* rule);
+        void FreeRule(SpatialHashInterestRule* rule);
+        void UpdateRule(SpatialHashInterestRule* rule, const AZ::Aabb& bbox);
+
+        void DestroyAttribute(SpatialHashInterestAttribute* attrib);
+        void FreeAttribute(SpatialHashInterestAttribute* attrib);
+        void UpdateAttribute(SpatialHashInterestAttribute* attrib, const AZ::Aabb& bbox);
+
+        void OnNewRulesChunk(SpatialHashInterestChunk* chunk, ReplicaPeer* peer);
+        void OnDeleteRulesChunk(SpatialHashInterestChunk* chunk, ReplicaPeer* peer);
+
+        RuleNetworkId GetNewRuleNetId();
+
+        SpatialHashInterestChunk* FindRulesChunkByPeerId(PeerId peerId);
+
+        void DestroyAll();
+
+        ///////////////////////////////////////////////////////////////////////////////////////////////////
+        // internal processing helpers
+        Internal::SpatialHashCellRange GetCellRange(const AZ::Aabb& bbox) const;
+        static AZ::u64 GetCellKey(int x, int y, int z);
+
+        // Moves the interest to the cells of its current bbox
+        template<class T>
+        void Rebin(T* interest, vector<T*>& oversizedList, vector<T*> Cell::* cellList);
+
+        template<class T>
+        static void RemoveFromList(vector<T*>& list, T* item);
+        template<class Func>
+        static void ForEachCell(const Internal::SpatialHashCellRange& cells, Func func);
+
+        void MarkDirty(SpatialHashInterestAttribute* attribute);
+        void MarkAttributesDirtyInBox(const AZ::Aabb& bbox);
+        void EvaluateAttribute(SpatialHashInterestAttribute* attribute);
+
+        InterestManager* m_im;
+        ReplicaManager* m_rm;
+
+        AZ::u32 m_lastRuleNetId;
+
+        unordered_map<PeerId, SpatialHashInterestChunk*> m_peerChunks;
+
+        float m_cellSize;
+        float m_invCellSize;
+        CellMap m_cells;
+        AZ::u32 m_queryStamp;
+
+        RuleSet m_localRules;
+        RuleList m_removedRules;
+        RuleList m_dirtyRules;
+        RuleList m_oversizedRules;
+
+        AttributeSet m_attributes;
+        AttributeList m_removedAttributes;
+        AttributeList m_dirtyAttributes;
+        AttributeList m_oversizedAttributes;
+
+        SpatialHashInterestChunk* m_rulesReplica;
+
+        InterestMatchResult m_resultCache; ///< changes of the last update, reused between updates
+        vector<PeerId> m_peersScratch;
+        ///////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+    ///////////////////////////////////////////////////////////////////////////
+}
+
+#endif // GM_REPLICA_SPATIALHASHINTERESTHANDLER_H
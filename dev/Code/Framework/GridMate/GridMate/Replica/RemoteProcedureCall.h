@@ -25,6 +25,7 @@
 #include <GridMate/Replica/ReplicaDefs.h>
 
 #include <GridMate/Serialize/Buffer.h>
+#include <GridMate/Serialize/CompressionMarshal.h>
 #include <GridMate/Serialize/DataMarshal.h>
 
 namespace GridMate
@@ -34,6 +35,7 @@ namespace GridMate
     namespace Internal
     {
         struct RpcRequest;
+        struct RpcBatch;
         struct InterfaceResolver;
     }
 
@@ -44,6 +46,7 @@ namespace GridMate
         static const bool s_alwaysForwardSourcePeer = false;
         static const bool s_allowNonAuthoritativeRequests = true;
         static const bool s_allowNonAuthoritativeRequestRelay = true;
+        static const bool s_coalesceLatest = false; // Only the latest call matters: queued calls that were not sent yet are dropped when the RPC is called again
     };
 
     struct RpcAuthoritativeTraits : public RpcDefaultTraits
@@ -115,12 +118,13 @@ namespace GridMate
         virtual ~RpcBase() { }
 
     protected:
-        virtual void Marshal(WriteBuffer& wb, Internal::RpcRequest* request) = 0;
-        virtual Internal::RpcRequest* Unmarshal(ReadBuffer& rb) = 0;
+        virtual void Marshal(WriteBuffer& wb, Internal::RpcRequest* request, Internal::RpcBatch& batch) = 0;
+        virtual Internal::RpcRequest* Unmarshal(ReadBuffer& rb, Internal::RpcBatch& batch) = 0;
         virtual bool Invoke(Internal::RpcRequest* rpc) const = 0;
         virtual bool IsPostAttached() const = 0;                //Requires Data Sets updated before executing RPC
         virtual bool IsAllowNonAuthoritativeRequests() const = 0;
         virtual bool IsAllowNonAuthoritativeRequestsRelay() const = 0;
+        virtual bool IsCoalesceLatest() const = 0;
 
         PeerId GetSourcePeerId();
 
@@ -159,6 +163,42 @@ namespace GridMate
         };
         // ------------------------------------------------
 
+        // -- Batch of calls to the same RPC --------------
+        // Consecutive calls to the same RPC are sent together, after a single rpc index and call count. Only the first
+        // call of the batch carries the full request header, the following calls only send the difference of their
+        // timestamp to the previous call.
+        struct RpcBatch
+        {
+            RpcBatch()
+                : m_numCalls(0)
+                , m_timestamp(0)
+                , m_authoritative(false)
+            { }
+
+            AZ::u32 m_numCalls; // calls of the batch marshaled so far
+            AZ::u32 m_timestamp; // timestamp of the previous call
+            bool m_authoritative;
+        };
+
+        inline void MarshalRpcTimestampDelta(WriteBuffer& wb, AZ::u32 timestamp, AZ::u32 previous)
+        {
+            // zigzag encoding, so that small negative deltas stay small
+            AZ::s32 delta = static_cast<AZ::s32>(timestamp - previous);
+            wb.Write((static_cast<AZ::u32>(delta) << 1) ^ static_cast<AZ::u32>(delta >> 31), VlqU32Marshaler());
+        }
+
+        inline bool UnmarshalRpcTimestampDelta(ReadBuffer& rb, AZ::u32& timestamp, AZ::u32 previous)
+        {
+            AZ::u32 zigzag;
+            if (!rb.Read(zigzag, VlqU32Marshaler()))
+            {
+                return false;
+            }
+            timestamp = previous + ((zigzag >> 1) ^ (~(zigzag & 1) + 1));
+            return true;
+        }
+        // ------------------------------------------------
+
         struct InterfaceResolver
         {
             template<class C, class T>
@@ -360,6 +400,7 @@ namespace GridMate
             bool IsPostAttached() const override { return Traits::s_isPostAttached; }
             bool IsAllowNonAuthoritativeRequests() const override { return Traits::s_allowNonAuthoritativeRequests; }
             bool IsAllowNonAuthoritativeRequestsRelay() const override { return Traits::s_allowNonAuthoritativeRequestRelay; }
+            bool IsCoalesceLatest() const override { return Traits::s_coalesceLatest; }
 
             template<typename ... LocalArgs>
             void operator()(LocalArgs&& ... args)
@@ -400,12 +441,24 @@ namespace GridMate
             }
 
         protected:
-            void Marshal(WriteBuffer& wb, Internal::RpcRequest* request) override
+            void Marshal(WriteBuffer& wb, Internal::RpcRequest* request, Internal::RpcBatch& batch) override
             {
                 TypeTuple* storage = static_cast<TypeTuple*>(request);
 
-                wb.Write(storage->m_timestamp);
-                wb.Write(storage->m_authoritative);
+                if (batch.m_numCalls == 0)
+                {
+                    wb.Write(storage->m_timestamp);
+                    wb.Write(storage->m_authoritative);
+                    batch.m_authoritative = storage->m_authoritative;
+                }
+                else
+                {
+                    AZ_Assert(batch.m_authoritative == storage->m_authoritative, "All the calls of a batch must go the same way!");
+                    Internal::MarshalRpcTimestampDelta(wb, storage->m_timestamp, batch.m_timestamp);
+                }
+                batch.m_timestamp = storage->m_timestamp;
+                ++batch.m_numCalls;
+
                 if (Traits::s_alwaysForwardSourcePeer)
                 {
                     wb.Write(storage->m_sourcePeer);
@@ -415,12 +468,28 @@ namespace GridMate
                 storage->Marshal(wb, m_marshalers);
             }
 
-            Internal::RpcRequest* Unmarshal(ReadBuffer& rb) override
+            Internal::RpcRequest* Unmarshal(ReadBuffer& rb, Internal::RpcBatch& batch) override
             {
                 TypeTuple* storage = aznew TypeTuple(this);
 
-                rb.Read(storage->m_timestamp);
-                rb.Read(storage->m_authoritative);
+                if (batch.m_numCalls == 0)
+                {
+                    rb.Read(storage->m_timestamp);
+                    rb.Read(storage->m_authoritative);
+                    batch.m_authoritative = storage->m_authoritative;
+                }
+                else
+                {
+                    if (!Internal::UnmarshalRpcTimestampDelta(rb, storage->m_timestamp, batch.m_timestamp))
+                    {
+                        delete storage;
+                        return nullptr;
+                    }
+                    storage->m_authoritative = batch.m_authoritative;
+                }
+                batch.m_timestamp = storage->m_timestamp;
+                ++batch.m_numCalls;
+
                 if (Traits::s_alwaysForwardSourcePeer)
                 {
                     rb.Read(storage->m_sourcePeer);
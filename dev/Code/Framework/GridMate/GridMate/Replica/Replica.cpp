@@ -549,6 +549,34 @@ namespace GridMate
 
         mc.m_outBuffer = nullptr;
 
+        // Only authoritative payloads are shared, non authoritative marshaling marks the upstream rpcs as relayed.
+        // Drillers expect events for every dataset and rpc sent to every peer, so the cache is not used while one listens.
+        ReplicaMarshalCache* cache = mc.m_cache;
+        if (cache)
+        {
+            const bool canShare = (mc.m_marshalFlags & ReplicaMarshalFlags::Authoritative)
+                && (!ReplicaTarget::IsAckEnabled() || (mc.m_target && mc.m_callbackBuffer))
+                && !Debug::ReplicaDrillerBus::HasHandlers();
+            if (!canShare)
+            {
+                cache = nullptr;
+            }
+            else if (cache->m_marshalFlags != mc.m_marshalFlags || cache->m_peerLatestVersionAckd != mc.m_peerLatestVersionAckd || cache->m_chunks.size() != m_chunks.size())
+            {
+                if (cache->m_isReadOnly)
+                {
+                    cache = nullptr;
+                }
+                else
+                {
+                    cache->m_marshalFlags = mc.m_marshalFlags;
+                    cache->m_peerLatestVersionAckd = mc.m_peerLatestVersionAckd;
+                    cache->m_chunks.clear();
+                    cache->m_chunks.resize(m_chunks.size());
+                }
+            }
+        }
+
         AZStd::bitset<GM_MAX_CHUNKS_PER_REPLICA> chunkManifest;
 
         struct ChunkInfo
@@ -556,18 +584,21 @@ namespace GridMate
             ChunkInfo(EndianType endianness)
                 : m_length(endianness)
                 , m_payload(endianness, 0)
+                , m_cachedPayload(nullptr)
             {
             }
 
             WriteBufferStatic<5> m_length;  // length will never need more than 5 bytes.
             WriteBufferDynamic m_payload;
+            const ReplicaMarshalCache::ChunkPayload* m_cachedPayload; // written instead of m_payload when set
         };
 
         PackedSize payloadLen = 0;
         AZStd::fixed_vector<ChunkInfo, GM_MAX_CHUNKS_PER_REPLICA> chunkBuffers;
         for (size_t iChunk = 0; iChunk < m_chunks.size(); ++iChunk)
         {
-            ReplicaChunkPtr chunk = m_chunks[iChunk];
+            // raw pointer, the chunk ref count is not atomic and a replica can be marshaled to several peers at once
+            ReplicaChunkBase* chunk = m_chunks[iChunk].get();
 
             if (!chunk)
             {
@@ -597,27 +628,53 @@ namespace GridMate
             chunkManifest.set(iChunk);
             chunkBuffers.push_back(ChunkInfo(outBuffer->GetEndianType()));
             ChunkInfo& chunkInfo = chunkBuffers.back();
+
+            // Reuse the payload encoded for a previous peer
+            ReplicaMarshalCache::ChunkPayload* cachedPayload = cache ? &cache->m_chunks[iChunk] : nullptr;
+            if (cachedPayload && cachedPayload->m_isValid)
+            {
+                chunkInfo.m_cachedPayload = cachedPayload;
+                if (cachedPayload->m_wroteDataSet && ReplicaTarget::IsAckEnabled())
+                {
+                    mc.m_callbackBuffer->push_back(mc.m_target->CreateCallback(m_revision));
+                }
+
+                PackedSize chunkLen = cachedPayload->m_size;
+                chunkInfo.m_length.Write(chunkLen);
+                payloadLen += chunkLen + chunkInfo.m_length.GetExactSize();
+                continue;
+            }
+
             chunkInfo.m_payload.Init(128);
             mc.m_outBuffer = &chunkInfo.m_payload;
 
-            EBUS_EVENT(Debug::ReplicaDrillerBus, OnSendReplicaChunkBegin, chunk.get(), static_cast<AZ::u32>(iChunk), mc.m_rm->GetLocalPeerId(), mc.m_peer->GetId());
+            EBUS_EVENT(Debug::ReplicaDrillerBus, OnSendReplicaChunkBegin, chunk, static_cast<AZ::u32>(iChunk), mc.m_rm->GetLocalPeerId(), mc.m_peer->GetId());
             PackedSize writeOffset = mc.m_outBuffer->GetExactSize();
             // Write the ctor data if we need to
             if (mc.m_marshalFlags & ReplicaMarshalFlags::IncludeCtorData)
             {
                 mc.m_outBuffer->Write(chunk->GetDescriptor()->GetChunkTypeId());
-                chunk->GetDescriptor()->MarshalCtorData(chunk.get(), *mc.m_outBuffer);
+                chunk->GetDescriptor()->MarshalCtorData(chunk, *mc.m_outBuffer);
             }
 
             // Marshal the chunk data
+            const size_t callbackCount = mc.m_callbackBuffer ? mc.m_callbackBuffer->size() : 0;
             chunk->Marshal(mc, static_cast<AZ::u32>(iChunk));
-            EBUS_EVENT(Debug::ReplicaDrillerBus, OnSendReplicaChunkEnd, chunk.get(), static_cast<AZ::u32>(iChunk), mc.m_outBuffer->Get() + writeOffset.GetBytes(), mc.m_outBuffer->Size() - writeOffset.GetBytes());
+            EBUS_EVENT(Debug::ReplicaDrillerBus, OnSendReplicaChunkEnd, chunk, static_cast<AZ::u32>(iChunk), mc.m_outBuffer->Get() + writeOffset.GetBytes(), mc.m_outBuffer->Size() - writeOffset.GetBytes());
 
             // Precompute the chunk payload length and add to overall replica payload length
             PackedSize chunkLen = chunkInfo.m_payload.GetExactSize();
             chunkInfo.m_length.Write(chunkLen);
 
             payloadLen += chunkLen + chunkInfo.m_length.GetExactSize();
+
+            if (cachedPayload && !cache->m_isReadOnly)
+            {
+                cachedPayload->m_data.assign(chunkInfo.m_payload.Get(), chunkInfo.m_payload.Get() + chunkInfo.m_payload.Size());
+                cachedPayload->m_size = chunkLen;
+                cachedPayload->m_wroteDataSet = mc.m_callbackBuffer && mc.m_callbackBuffer->size() > callbackCount;
+                cachedPayload->m_isValid = true;
+            }
         }
 
         if (!chunkBuffers.empty())
@@ -637,7 +694,14 @@ namespace GridMate
             for (ChunkInfo& chunkInfo : chunkBuffers)
             {
                 mc.m_outBuffer->WriteRaw(chunkInfo.m_length.Get(), chunkInfo.m_length.GetExactSize());
-                mc.m_outBuffer->WriteRaw(chunkInfo.m_payload.Get(), chunkInfo.m_payload.GetExactSize());
+                if (chunkInfo.m_cachedPayload)
+                {
+                    mc.m_outBuffer->WriteRaw(chunkInfo.m_cachedPayload->m_data.data(), chunkInfo.m_cachedPayload->m_size);
+                }
+                else
+                {
+                    mc.m_outBuffer->WriteRaw(chunkInfo.m_payload.Get(), chunkInfo.m_payload.GetExactSize());
+                }
             }
         }
     }
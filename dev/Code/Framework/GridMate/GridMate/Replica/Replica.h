@@ -56,6 +56,8 @@ namespace GridMate
         friend class ReplicaMarshalZombieToPeerTask;
         friend class ReplicaMarshalZombieTask;
         friend class SendLimitProcessPolicy;
+        friend class BandwidthProcessPolicy;
+        friend class AccumulatedPriorityPolicy;
 
         friend class ReplicaMarshalNewTask;
 
@@ -0,0 +1,182 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef AZ_UNITY_BUILD
+
+#include <GridMate/Replica/ReplicaCapture.h>
+#include <GridMate/Serialize/UtilityMarshal.h>
+
+#include <AzCore/IO/GenericStreams.h>
+
+namespace GridMate
+{
+    //-----------------------------------------------------------------------------
+    // ReplicaCaptureWriter
+    //-----------------------------------------------------------------------------
+    ReplicaCaptureWriter::ReplicaCaptureWriter(AZ::IO::GenericStream* stream, PeerId localPeerId, bool isSyncHost)
+        : m_stream(stream)
+        , m_buffer(EndianType::BigEndian)
+        , m_nextConnection(0)
+    {
+        AZ_Assert(m_stream && m_stream->CanWrite(), "Invalid capture stream!");
+
+        m_buffer.Write(ReplicaCapture::k_magic);
+        m_buffer.Write(ReplicaCapture::k_version);
+        m_buffer.Write(localPeerId);
+        m_buffer.Write(static_cast<AZ::u8>(isSyncHost ? 1 : 0));
+        Flush();
+    }
+    //-----------------------------------------------------------------------------
+    void ReplicaCaptureWriter::OnAddPeer(ConnectionID connId, RemotePeerMode mode, AZ::u32 time)
+    {
+        AZ::u32 connection = m_nextConnection++;
+        m_connections[connId] = connection;
+
+        m_buffer.Write(static_cast<AZ::u8>(ReplicaCaptureRecord::Type_AddPeer));
+        m_buffer.Write(connection);
+        m_buffer.Write(time);
+        m_buffer.Write(static_cast<AZ::u8>(mode));
+        Flush();
+    }
+    //-----------------------------------------------------------------------------
+    void ReplicaCaptureWriter::OnRemovePeer(ConnectionID connId, AZ::u32 time)
+    {
+        auto it = m_connections.find(connId);
+        if (it == m_connections.end())
+        {
+            return;
+        }
+
+        m_buffer.Write(static_cast<AZ::u8>(ReplicaCaptureRecord::Type_RemovePeer));
+        m_buffer.Write(it->second);
+        m_buffer.Write(time);
+        Flush();
+
+        m_connections.erase(it);
+    }
+    //-----------------------------------------------------------------------------
+    void ReplicaCaptureWriter::OnMessage(ConnectionID connId, AZ::u32 time, const void* data, size_t size)
+    {
+        auto it = m_connections.find(connId);
+        if (it == m_connections.end())
+        {
+            // the peer was added before the capture started, its traffic can't be replayed
+            return;
+        }
+
+        m_buffer.Write(static_cast<AZ::u8>(ReplicaCaptureRecord::Type_Message));
+        m_buffer.Write(it->second);
+        m_buffer.Write(time);
+        m_buffer.Write(static_cast<AZ::u32>(size));
+        m_buffer.WriteRaw(data, size);
+        Flush();
+    }
+    //-----------------------------------------------------------------------------
+    void ReplicaCaptureWriter::Flush()
+    {
+        if (m_stream && m_stream->Write(m_buffer.Size(), m_buffer.Get()) != m_buffer.Size())
+        {
+            AZ_Warning("GridMate", false, "Failed to write to the replica capture stream, capture stopped!");
+            m_stream = nullptr;
+        }
+        m_buffer.Clear();
+    }
+    //-----------------------------------------------------------------------------
+
+    //-----------------------------------------------------------------------------
+    // ReplicaCapture
+    //-----------------------------------------------------------------------------
+    ReplicaCapture::ReplicaCapture()
+        : m_localPeerId(InvalidReplicaPeerId)
+        , m_isSyncHost(false)
+    {
+    }
+    //-----------------------------------------------------------------------------
+    bool ReplicaCapture::Load(AZ::IO::GenericStream& stream)
+    {
+        m_records.clear();
+
+        const size_t streamSize = static_cast<size_t>(stream.GetLength() - stream.GetCurPos());
+        vector<char> data(streamSize);
+        if (streamSize == 0 || stream.Read(streamSize, data.data()) != streamSize)
+        {
+            return false;
+        }
+
+        ReadBuffer rb(EndianType::BigEndian, data.data(), streamSize);
+
+        AZ::u32 magic = 0;
+        AZ::u16 version = 0;
+        AZ::u8 isSyncHost = 0;
+        if (!rb.Read(magic) || !rb.Read(version) || !rb.Read(m_localPeerId) || !rb.Read(isSyncHost))
+        {
+            return false;
+        }
+
+        if (magic != k_magic || version != k_version)
+        {
+            AZ_Warning("GridMate", false, "Not a replica capture, or a capture of an unsupported version (%u)!", version);
+            return false;
+        }
+        m_isSyncHost = isSyncHost != 0;
+
+        while (!rb.IsEmpty())
+        {
+            ReplicaCaptureRecord record;
+            AZ::u8 type = 0;
+            if (!rb.Read(type) || !rb.Read(record.m_connection) || !rb.Read(record.m_time))
+            {
+                break;
+            }
+
+            bool isComplete = true;
+            record.m_type = static_cast<ReplicaCaptureRecord::Type>(type);
+            switch (record.m_type)
+            {
+            case ReplicaCaptureRecord::Type_AddPeer:
+            {
+                AZ::u8 mode = 0;
+                isComplete = rb.Read(mode);
+                record.m_mode = static_cast<RemotePeerMode>(mode);
+                break;
+            }
+            case ReplicaCaptureRecord::Type_RemovePeer:
+                break;
+            case ReplicaCaptureRecord::Type_Message:
+            {
+                AZ::u32 size = 0;
+                isComplete = rb.Read(size) && PackedSize(size) <= rb.Left();
+                if (isComplete)
+                {
+                    record.m_data.resize(size);
+                    rb.ReadRaw(record.m_data.data(), size);
+                }
+                break;
+            }
+            default:
+                AZ_Warning("GridMate", false, "Unknown replica capture record type %u, the rest of the capture is ignored!", type);
+                isComplete = false;
+                break;
+            }
+
+            if (!isComplete)
+            {
+                break;
+            }
+            m_records.push_back(AZStd::move(record));
+        }
+
+        return true;
+    }
+    //-----------------------------------------------------------------------------
+} // namespace GridMate
+
+#endif // #ifndef AZ_UNITY_BUILD
@@ -0,0 +1,113 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef GM_REPLICA_CAPTURE_H
+#define GM_REPLICA_CAPTURE_H
+
+#include <GridMate/Replica/ReplicaMgr.h>
+#include <GridMate/Serialize/Buffer.h>
+#include <GridMate/Containers/unordered_map.h>
+#include <GridMate/Containers/vector.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        class GenericStream;
+    }
+}
+
+namespace GridMate
+{
+    /**
+     * Record of a replica traffic capture.
+     */
+    struct ReplicaCaptureRecord
+    {
+        enum Type : AZ::u8
+        {
+            Type_AddPeer,       ///< A peer was added to the replica manager
+            Type_RemovePeer,    ///< A peer was removed from the replica manager
+            Type_Message,       ///< A message was received from a peer
+        };
+
+        ReplicaCaptureRecord()
+            : m_type(Type_Message)
+            , m_connection(0)
+            , m_time(0)
+            , m_mode(Mode_Undefined)
+        { }
+
+        Type m_type;
+        AZ::u32 m_connection;   ///< Index of the connection, in the order the peers were added
+        AZ::u32 m_time;         ///< Carrier time of the record in milliseconds
+        RemotePeerMode m_mode;  ///< Type_AddPeer only
+        vector<char> m_data;    ///< Type_Message only
+    };
+
+    /**
+     * Writes the replica traffic received by a ReplicaManager to a stream, see ReplicaManager::StartCapture.
+     * Every record is written as soon as it happens, so the stream holds a complete capture at any point.
+     */
+    class ReplicaCaptureWriter
+    {
+    public:
+        GM_CLASS_ALLOCATOR(ReplicaCaptureWriter);
+
+        ReplicaCaptureWriter(AZ::IO::GenericStream* stream, PeerId localPeerId, bool isSyncHost);
+
+        void OnAddPeer(ConnectionID connId, RemotePeerMode mode, AZ::u32 time);
+        void OnRemovePeer(ConnectionID connId, AZ::u32 time);
+        void OnMessage(ConnectionID connId, AZ::u32 time, const void* data, size_t size);
+
+        /// Returns false once writing to the stream failed, nothing else is written after that.
+        bool IsValid() const { return m_stream != nullptr; }
+
+    private:
+        void Flush();
+
+        AZ::IO::GenericStream* m_stream;
+        WriteBufferDynamic m_buffer;
+        unordered_map<ConnectionID, AZ::u32> m_connections;
+        AZ::u32 m_nextConnection;
+    };
+
+    /**
+     * Replica traffic capture loaded from a stream, see ReplicaReplay.
+     */
+    class ReplicaCapture
+    {
+    public:
+        GM_CLASS_ALLOCATOR(ReplicaCapture);
+
+        typedef vector<ReplicaCaptureRecord> RecordList;
+
+        static const AZ::u32 k_magic = 0x474d5243; // "GMRC"
+        static const AZ::u16 k_version = 1;
+
+        ReplicaCapture();
+
+        /// Loads a capture from the stream, returns false if the stream doesn't hold a valid capture.
+        /// A capture that was cut short (for example by a crash) loads up to its last complete record.
+        bool Load(AZ::IO::GenericStream& stream);
+
+        PeerId GetLocalPeerId() const { return m_localPeerId; }
+        bool IsSyncHost() const { return m_isSyncHost; }
+        const RecordList& GetRecords() const { return m_records; }
+
+    private:
+        PeerId m_localPeerId;
+        bool m_isSyncHost;
+        RecordList m_records;
+    };
+} // namespace GridMate
+
+#endif // GM_REPLICA_CAPTURE_H
@@ -35,6 +35,7 @@ namespace GridMate
         , m_reliableDirtyBits()
         , m_unreliableDirtyBits()
         , m_nonDefaultValueBits()
+        , m_pendingDataSetBits()
         , m_nDownstreamReliableRPCs(0)
         , m_nDownstreamUnreliableRPCs(0)
         , m_nUpstreamReliableRPCs(0)
@@ -46,6 +47,7 @@ namespace GridMate
         ReplicaChunkInitContext* initContext = ReplicaChunkDescriptorTable::Get().GetCurrentReplicaChunkInitContext();
         AZ_Assert(initContext, "Replica's descriptor is NOT pushed on the stack! Call Replica::Desriptor::Push() before construction!");
         initContext->m_chunk = this;
+        m_pendingDataSetBits.set();
         EBUS_EVENT(Debug::ReplicaDrillerBus, OnCreateReplicaChunk, this);
     }
     //-----------------------------------------------------------------------------
@@ -195,10 +197,20 @@ namespace GridMate
         }
 
         // DataSets
+        // Only datasets that were changed (or still have resends pending) are prepared, unless the whole chunk is
+        // about to be written out. Preparing compares the value against the throttler baseline, which is wasted
+        // work for the many datasets that don't change on a given tick.
+        const bool prepareAllDataSets = !!(marshalFlags & (ReplicaMarshalFlags::ForceDirty | ReplicaMarshalFlags::OmitUnmodified))
+            || m_replica->IsNew() || m_replica->IsNewOwner();
         AZStd::bitset<GM_MAX_DATASETS_IN_CHUNK> dirtyDataSets;
         ReplicaChunkDescriptor* descriptor = GetDescriptor();
         for (size_t i = 0; i < descriptor->GetDataSetCount(); ++i)
         {
+            if (!prepareAllDataSets && !m_pendingDataSetBits[i])
+            {
+                continue;
+            }
+
             DataSetBase* dataSet = descriptor->GetDataSet(this, i);
             PrepareDataResult pdrDs = dataSet->PrepareData(endianType, marshalFlags);
             dirtyDataSets.set(i, pdrDs.m_isDownstreamReliableDirty | pdrDs.m_isDownstreamUnreliableDirty);
@@ -212,6 +224,8 @@ namespace GridMate
                 */
                 m_nonDefaultValueBits.set(i);
             }
+
+            m_pendingDataSetBits.set(i, dataSet->IsResendPending());
         }
 
         m_reliableDirtyBits.reset();
@@ -238,6 +252,7 @@ namespace GridMate
             {
                 descriptor->GetDataSet(this, i)->ResetDirty();
             }
+            m_pendingDataSetBits.reset();
         }
 
         return pdr;
@@ -360,8 +375,8 @@ namespace GridMate
                     continue;
                 }
 
-                ReadBuffer data = dataset->GetMarshalData();
-                mc.m_outBuffer->WriteRaw(data.Get(), data.Size());
+                const PackedSize writeOffset = mc.m_outBuffer->GetExactSize();
+                dataset->Marshal(mc);
                 wroteDataSet = true;
 
                 EBUS_EVENT(Debug::ReplicaDrillerBus, OnSendDataSet,
@@ -370,8 +385,8 @@ namespace GridMate
                     dataset,
                     mc.m_rm->GetLocalPeerId(),
                     mc.m_peer->GetId(),
-                    data.Get(),
-                    data.Size().GetSizeInBytesRoundUp());
+                    mc.m_outBuffer->Get() + writeOffset.GetBytes(),
+                    (mc.m_outBuffer->GetExactSize() - writeOffset).GetSizeInBytesRoundUp());
             }
         }
         if(wroteDataSet)
@@ -457,27 +472,58 @@ namespace GridMate
         AZ_Assert(rpcCount < GM_MAX_RPC_SEND_PER_REPLICA, "Attempting to send too many RPCs");
         mc.m_outBuffer->Write(rpcCount, VlqU32Marshaler());
 
-        AZ::u32 rpcsSent = 0;
-        for (Internal::RpcRequest* rpc : m_rpcQueue)
+        auto isSent = [isAuthoritative, isReliable, &mc](const Internal::RpcRequest* rpc)
         {
             if (rpc->m_relayed || rpc->m_authoritative != isAuthoritative)
             {
-                continue;
+                return false;
             }
+            return rpc->m_reliable == isReliable || (mc.m_marshalFlags & ReplicaMarshalFlags::ForceReliable) == ReplicaMarshalFlags::ForceReliable;
+        };
 
-            if (rpc->m_reliable != isReliable && (mc.m_marshalFlags & ReplicaMarshalFlags::ForceReliable) != ReplicaMarshalFlags::ForceReliable)
+        // Consecutive calls to the same rpc are written as one batch: rpc index and number of calls, then the calls
+        AZ::u32 rpcsSent = 0;
+        AZ::u32 batchCallsLeft = 0;
+        Internal::RpcBatch batch;
+        for (auto iRpc = m_rpcQueue.begin(); iRpc != m_rpcQueue.end(); ++iRpc)
+        {
+            Internal::RpcRequest* rpc = *iRpc;
+            if (!isSent(rpc))
             {
                 continue;
             }
 
-            AZ::u8 rpcIndex = static_cast<AZ::u8>(GetDescriptor()->GetRpcIndex(this, rpc->m_rpc));
+            AZ::u32 batchSize = 0;
+            if (batchCallsLeft == 0)
+            {
+                batchSize = 1;
+                for (auto iNext = AZStd::next(iRpc); iNext != m_rpcQueue.end(); ++iNext)
+                {
+                    if (isSent(*iNext))
+                    {
+                        if ((*iNext)->m_rpc != rpc->m_rpc)
+                        {
+                            break;
+                        }
+                        ++batchSize;
+                    }
+                }
+                batchCallsLeft = batchSize;
+                batch = Internal::RpcBatch();
+            }
+            --batchCallsLeft;
 
             auto bufferSize = mc.m_outBuffer->Size();
 
-            SafeGuardWrite(mc.m_outBuffer, [rpc, rpcIndex, &mc]()
+            SafeGuardWrite(mc.m_outBuffer, [this, rpc, batchSize, &batch, &mc]()
             {
-                mc.m_outBuffer->Write(rpcIndex);
-                rpc->m_rpc->Marshal(*mc.m_outBuffer, rpc);
+                if (batchSize)
+                {
+                    AZ::u8 rpcIndex = static_cast<AZ::u8>(GetDescriptor()->GetRpcIndex(this, rpc->m_rpc));
+                    mc.m_outBuffer->Write(rpcIndex);
+                    mc.m_outBuffer->Write(batchSize, VlqU32Marshaler());
+                }
+                rpc->m_rpc->Marshal(*mc.m_outBuffer, rpc, batch);
             });
 
             EBUS_EVENT(Debug::ReplicaDrillerBus, OnSendRpc,
@@ -488,7 +534,12 @@ namespace GridMate
                 mc.m_peer->GetId(),
                 mc.m_outBuffer->Get() + bufferSize,
                 mc.m_outBuffer->Size() - bufferSize);
-            rpc->m_relayed = !(mc.m_marshalFlags & ReplicaMarshalFlags::Authoritative); // marking upstream rpcs relayed, for downstream rpcs - replicamgr marks them relayed after marshaling is finished
+            // marking upstream rpcs relayed, for downstream rpcs - replicamgr marks them relayed after marshaling is finished.
+            // Downstream rpcs are not written, as the same rpc can be marshaled to several peers at once.
+            if (!isAuthoritative)
+            {
+                rpc->m_relayed = true;
+            }
             rpcsSent++;
         }
         AZ_Assert(rpcsSent == rpcCount, "We did not write the expected number of rpcs! sent=%u, expected=%u.", rpcsSent, rpcCount);
@@ -507,25 +558,40 @@ namespace GridMate
         AZ::u32 rpcCount;
         if (mc.m_iBuf->Read(rpcCount, VlqU32Marshaler()))
         {
+            RpcBase* rpc = nullptr;
+            AZ::u32 batchCallsLeft = 0;
+            Internal::RpcBatch batch;
             for (AZ::u32 rpcsRead = 0; rpcsRead < rpcCount; ++rpcsRead)
             {
-                SafeGuardRead(mc.m_iBuf, [this, &mc, &chunkIndex]()
+                SafeGuardRead(mc.m_iBuf, [this, &mc, &chunkIndex, &rpc, &batchCallsLeft, &batch]()
                 {
-                    unsigned char rpcIndex;
-                    if (!mc.m_iBuf->Read(rpcIndex))
+                    if (batchCallsLeft == 0)
                     {
-                        return;
-                    }
+                        unsigned char rpcIndex;
+                        if (!mc.m_iBuf->Read(rpcIndex))
+                        {
+                            return;
+                        }
 
-                    RpcBase* rpc = GetDescriptor()->GetRpc(this, rpcIndex);
-                    if (!rpc)
-                    {
-                        AZ_Assert(false, "Cannot find descriptor for rpcIndex %hhu!", rpcIndex);
-                        return;
+                        rpc = GetDescriptor()->GetRpc(this, rpcIndex);
+                        if (!rpc)
+                        {
+                            AZ_Assert(false, "Cannot find descriptor for rpcIndex %hhu!", rpcIndex);
+                            return;
+                        }
+
+                        if (!mc.m_iBuf->Read(batchCallsLeft, VlqU32Marshaler()) || batchCallsLeft == 0)
+                        {
+                            AZ_Assert(false, "Invalid batch of RPC <%s>!", GetDescriptor()->GetRpcName(this, rpc));
+                            batchCallsLeft = 0;
+                            return;
+                        }
+                        batch = Internal::RpcBatch();
                     }
+                    --batchCallsLeft;
 
                     const char* dataPtr = mc.m_iBuf->GetCurrent();
-                    Internal::RpcRequest* request = rpc->Unmarshal(*mc.m_iBuf);
+                    Internal::RpcRequest* request = rpc->Unmarshal(*mc.m_iBuf, batch);
                     if (!request)
                     {
                         AZ_Assert(false, "Failed to unmarshal RPC <%s>!", GetDescriptor()->GetRpcName(this, rpc));
@@ -607,12 +673,17 @@ namespace GridMate
         m_dirtiedDataSets = 0;
         m_flags &= ~RepChunk_Updated;
         ReplicaChunkDescriptor* descriptor = GetDescriptor();
-        for (size_t i = 0; i < descriptor->GetDataSetCount(); ++i)
+        if (eventbits.any())
         {
-            if (eventbits[i])
+            EBUS_EVENT(Debug::ReplicaDrillerBus, OnDispatchDataSetEventsBegin, this);
+            for (size_t i = 0; i < descriptor->GetDataSetCount(); ++i)
             {
-                descriptor->GetDataSet(this, i)->DispatchChangedEvent(rc);
+                if (eventbits[i])
+                {
+                    descriptor->GetDataSet(this, i)->DispatchChangedEvent(rc);
+                }
             }
+            EBUS_EVENT(Debug::ReplicaDrillerBus, OnDispatchDataSetEventsEnd, this);
         }
 
         UpdateFromChunk(rc);
@@ -651,6 +722,7 @@ namespace GridMate
                 request->m_realTime = rc.m_realTime;
                 request->m_localTime = rc.m_localTime;
                 bool ret = request->m_rpc->Invoke(request);
+                EBUS_EVENT(Debug::ReplicaDrillerBus, OnInvokeRpcEnd, this, request);
                 request->m_processed = true;
                 if (isMaster)
                 {
@@ -708,6 +780,26 @@ namespace GridMate
     //-----------------------------------------------------------------------------
     void ReplicaChunkBase::QueueRPCRequest(GridMate::Internal::RpcRequest* rpc)
     {
+        if (rpc->m_rpc->IsCoalesceLatest())
+        {
+            // Drop the previous calls that are still waiting to be sent the same way. The request ProcessRPCs may be
+            // invoking is never processed yet, while local calls of a master are, so it is never dropped from under it.
+            for (RPCQueue::iterator iRPC = m_rpcQueue.begin(); iRPC != m_rpcQueue.end(); )
+            {
+                Internal::RpcRequest* queued = *iRPC;
+                if (queued->m_rpc == rpc->m_rpc && !queued->m_relayed
+                    && queued->m_authoritative == rpc->m_authoritative && queued->m_processed == rpc->m_processed)
+                {
+                    iRPC = m_rpcQueue.erase(iRPC);
+                    delete queued;
+                }
+                else
+                {
+                    ++iRPC;
+                }
+            }
+        }
+
         m_rpcQueue.push_back(rpc);
 
         if (m_replica && m_replica->GetReplicaManager())
@@ -718,6 +810,8 @@ namespace GridMate
     //-----------------------------------------------------------------------------
     void ReplicaChunkBase::SignalDataSetChanged(const DataSetBase& dataset)
     {
+        m_pendingDataSetBits.set(GetDescriptor()->GetDataSetIndex(this, &dataset));
+
         OnDataSetChanged(dataset);
 
         EnqueueMarshalTask();
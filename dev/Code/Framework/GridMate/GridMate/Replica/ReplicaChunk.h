@@ -76,6 +76,8 @@ namespace GridMate
         friend DataSetBase;
         template<typename DataType, typename Marshaler, typename Throttle>
         friend class DataSet;
+        template<typename DataType, AZ::u8 HistorySize, typename Marshaler, typename Throttle>
+        friend class SnapshotDeltaDataSet;
 
         typedef list<Internal::RpcRequest*> RPCQueue;
 
@@ -198,6 +200,12 @@ namespace GridMate
          */
         AZStd::bitset<GM_MAX_DATASETS_IN_CHUNK> m_nonDefaultValueBits;
 
+        /*
+         * DataSets that have to be visited by the next PrepareData: set when a dataset is changed on the master node
+         * and kept while the dataset still has resends pending. All bits start set so every dataset is prepared once.
+         */
+        AZStd::bitset<GM_MAX_DATASETS_IN_CHUNK> m_pendingDataSetBits;
+
         AZ::u32 m_nDownstreamReliableRPCs;
         AZ::u32 m_nDownstreamUnreliableRPCs;
         AZ::u32 m_nUpstreamReliableRPCs;
@@ -15,6 +15,7 @@
 #include <GridMate/Types.h>
 #include <GridMate/Replica/ReplicaDefs.h>
 #include <GridMate/Serialize/Buffer.h>
+#include <GridMate/Containers/vector.h>
 
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
 #include <AzCore/std/smart_ptr/weak_ptr.h>
@@ -111,6 +112,32 @@ namespace GridMate
     using CallbackBuffer = AZStd::vector< AZStd::weak_ptr<TargetCallbackBase> >;
     class ReplicaTarget;
     //-----------------------------------------------------------------------------
+    /**
+    *  Chunk payloads encoded by Replica::Marshal, shared by the peers a replica is marshaled to.
+    *  Authoritative chunk payloads only depend on the marshal flags and the peer's acked revision, so when the same cache
+    *  is passed to marshal one replica to several peers, each chunk is encoded for the first peer and its bytes are
+    *  appended for the others. The cache is only valid while the replica is not modified.
+    */
+    struct ReplicaMarshalCache
+    {
+        struct ChunkPayload
+        {
+            vector<char> m_data;
+            PackedSize m_size;
+            bool m_isValid = false;
+            bool m_wroteDataSet = false; ///< The peers that get the payload need an ack callback
+        };
+
+        ReplicaMarshalCache() = default;
+        ReplicaMarshalCache(const ReplicaMarshalCache&) = delete;
+        ReplicaMarshalCache& operator=(const ReplicaMarshalCache&) = delete;
+
+        AZ::u32 m_marshalFlags = 0;
+        AZ::u64 m_peerLatestVersionAckd = 0;
+        bool m_isReadOnly = false; ///< Set when several threads marshal with the cache, payloads are then only read
+        vector<ChunkPayload> m_chunks;
+    };
+    //-----------------------------------------------------------------------------
     struct MarshalContext
         : public ReplicaContext
     {
@@ -119,6 +146,7 @@ namespace GridMate
         AZ::u64 m_peerLatestVersionAckd;
         CallbackBuffer*     m_callbackBuffer;
         ReplicaTarget*      m_target;
+        ReplicaMarshalCache* m_cache; ///< optional, chunk payloads shared with the other peers the replica is marshaled to
         explicit MarshalContext(AZ::u32 marshalFlags, WriteBuffer* writeBuffer, CallbackBuffer* callbackBuffer, const ReplicaContext& rc, AZ::u64 lastVersionAckd = 0, ReplicaTarget* target = nullptr)
             : ReplicaContext(rc)
             , m_marshalFlags(marshalFlags)
@@ -126,6 +154,7 @@ namespace GridMate
             , m_peerLatestVersionAckd(lastVersionAckd)
             , m_callbackBuffer(callbackBuffer)
             , m_target(target)
+            , m_cache(nullptr)
         { }
     };
 
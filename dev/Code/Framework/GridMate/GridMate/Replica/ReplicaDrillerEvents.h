@@ -95,6 +95,13 @@ namespace GridMate
             virtual void OnRequestRpc(ReplicaChunkBase* chunk, Internal::RpcRequest* rpc) { (void)chunk; (void)rpc; }
             //! Called when an rpc is invoked. RpcRequest pointer will be null if rpc is called on master replica.
             virtual void OnInvokeRpc(ReplicaChunkBase* chunk, Internal::RpcRequest* rpc) { (void)chunk; (void)rpc; }
+            //! Called when a queued rpc has been invoked, after its handler returned.
+            virtual void OnInvokeRpcEnd(ReplicaChunkBase* chunk, Internal::RpcRequest* rpc) { (void)chunk; (void)rpc; }
+
+            //! Called before the changed events of the chunk's received datasets are dispatched.
+            virtual void OnDispatchDataSetEventsBegin(ReplicaChunkBase* chunk) { (void)chunk; }
+            //! Called after the changed events of the chunk's received datasets are dispatched.
+            virtual void OnDispatchDataSetEventsEnd(ReplicaChunkBase* chunk) { (void)chunk; }
             //! Called every time an rpc is sent to a peer.
             virtual void OnSendRpc(ReplicaChunkBase* chunk, AZ::u32 chunkIndex, Internal::RpcRequest* rpc, PeerId from, PeerId to, const void* data, size_t len) { (void)chunk; (void)chunkIndex; (void)rpc; (void)from; (void)to; (void)data; (void)len; }
             //! Called when an rpc is received.
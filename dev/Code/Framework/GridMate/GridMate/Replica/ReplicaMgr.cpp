@@ -24,6 +24,7 @@
 #include <GridMate/Replica/Tasks/ReplicaUpdateTasks.h>
 #include <GridMate/Replica/ReplicaDrillerEvents.h>
 #include <GridMate/Replica/ReplicaChunkDescriptor.h>
+#include <GridMate/Replica/ReplicaCapture.h>
 #include <GridMate/Serialize/CompressionMarshal.h>
 
 #include <AzCore/Debug/Profiler.h>
@@ -62,6 +63,7 @@ namespace GridMate
         , m_peerId(InvalidReplicaPeerId)
         , m_connId(connId)
         , m_mode(mode)
+        , m_newTargetCount(0)
         , m_reliableOutBuffer(EndianType::IgnoreEndian)
         , m_unreliableOutBuffer(EndianType::IgnoreEndian)
         , m_zoneMask(ZoneMask_All)
@@ -70,6 +72,7 @@ namespace GridMate
         , m_avgSendRateBurst(0.f)
         , m_sentBytes(0)
         , m_sendBytesAllowed(0)
+        , m_sendLimit(0)
     {
         AZ_Assert(m_rm, "No replica manager specified");
         if (m_rm->IsInitialized())
@@ -258,6 +261,7 @@ namespace GridMate
         , m_peerUpdateTasks(&m_tasksAllocator)
         , m_latchedCarrierTime(0)
         , m_autoBroadcast(true)
+        , m_capture(nullptr)
     { }
     //-----------------------------------------------------------------------------
     void ReplicaManager::Init(const ReplicaMgrDesc& desc)
@@ -323,6 +327,8 @@ namespace GridMate
         }
         m_flags = Rm_Terminating;
 
+        StopCapture();
+
         for (auto& migration : m_activeMigrations)
         {
             delete migration.second;
@@ -495,6 +501,11 @@ namespace GridMate
         m_remotePeers.push_back(pPeer);
         m_mutexRemotePeers.unlock();
 
+        if (m_capture)
+        {
+            m_capture->OnAddPeer(connId, peerMode, m_cfg.m_carrier->GetTime());
+        }
+
         // immediate introduce ourselves to this peer (only if we are not the host)
         if (!IsSyncHost())
         {
@@ -502,6 +513,19 @@ namespace GridMate
         }
     }
     //-----------------------------------------------------------------------------
+    void ReplicaManager::StartCapture(AZ::IO::GenericStream* stream)
+    {
+        AZ_Assert(IsInitialized(), "ReplicaManager is not initialized!");
+        StopCapture();
+        m_capture = aznew ReplicaCaptureWriter(stream, GetLocalPeerId(), IsSyncHost());
+    }
+    //-----------------------------------------------------------------------------
+    void ReplicaManager::StopCapture()
+    {
+        delete m_capture;
+        m_capture = nullptr;
+    }
+    //-----------------------------------------------------------------------------
     void ReplicaManager::DiscardOrphans(PeerId orphanId)
     {
         if (IsSyncHost())
@@ -538,6 +562,11 @@ namespace GridMate
             return;
         }
         
+        if (m_capture)
+        {
+            m_capture->OnRemovePeer(connId, m_cfg.m_carrier->GetTime());
+        }
+
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_mutexRemotePeers);
 
         for (ReplicaPeerList::iterator iPeer = m_remotePeers.begin(); iPeer != m_remotePeers.end(); ++iPeer)
@@ -1336,6 +1365,11 @@ namespace GridMate
                         break;
                     }
 
+                    if (m_capture)
+                    {
+                        m_capture->OnMessage(conn, m_currentFrameTime.m_realTime, m_receiveBuffer.data(), result.m_numBytes);
+                    }
+
                     ReadBuffer rb(GetGridMate()->GetDefaultEndianType(), m_receiveBuffer.data(), result.m_numBytes);
                     EBUS_EVENT(Debug::ReplicaDrillerBus, OnReceive, peer->GetId(), rb.Get(), rb.Size().GetSizeInBytesRoundUp());
                     _Unmarshal(rb, peer);
@@ -26,8 +26,17 @@
 #include <AzCore/std/containers/intrusive_set.h>
 #include <AzCore/std/containers/map.h>
 
+namespace AZ
+{
+    namespace IO
+    {
+        class GenericStream;
+    }
+}
+
 namespace GridMate {
     class Carrier;
+    class ReplicaCaptureWriter;
     namespace ReplicaInternal
     {
         class SessionInfo;
@@ -92,6 +101,7 @@ namespace GridMate {
         friend class ReplicaUpdateTaskBase;
         friend class ReplicaTarget;
         friend class SendLimitProcessPolicy;
+        friend class BandwidthProcessPolicy;
         friend class ReplicaMarshalTaskBase;
         friend class ReplicaMarshalTask;
 
@@ -101,6 +111,7 @@ namespace GridMate {
         RemotePeerMode m_mode;
         ReplicaMap m_objectsMap;
         ReplicaTimeSet m_objectsTimeSort;
+        unsigned int m_newTargetCount; // number of targets whose replica was not sent to this peer yet (declared before m_targets, which destroys its targets)
         PeerTargetList m_targets;
         WriteBufferDynamic m_reliableOutBuffer;
         WriteBufferDynamic m_unreliableOutBuffer;
@@ -123,6 +134,7 @@ namespace GridMate {
         float m_avgSendRateBurst; // send rate averaged for >=1 seconds used for burst control
         int m_sentBytes; // number of bytes of replica data current sent
         int m_sendBytesAllowed; // number of bytes allowed to be sent current frame
+        unsigned int m_sendLimit; // bytes per second the current frame's budget is based on (0 - unlimited)
         ////
 
         void SetNew(bool b)
@@ -211,6 +223,20 @@ namespace GridMate {
         // that the application should read a config file or cvar to know when to set this value.
         AZ::s16 m_targetFixedTimeStepsPerSecond;
 
+        // replicas with at least this many peers to update are marshaled to the peers in parallel on the global AZ job context (0 - disabled).
+        // Only enable this if the chunks' ShouldSendToPeer() and the marshalers of their datasets and rpcs are safe to call from job threads.
+        unsigned int m_parallelMarshalMinPeers;
+
+        // limits the outgoing bandwidth to every peer to the rate its connection's traffic control can currently deliver (congestion window per round trip).
+        // Combined with m_targetSendLimitBytesPerSec the lower of the two limits is used. Replicas are sent in order of their accumulated priority,
+        // so under congestion the most relevant and stalest updates go out first.
+        bool m_sendLimitFromTrafficControl;
+
+        // scales the send limit of a peer while it still has replicas it hasn't received yet (typically a late joiner catching up
+        // with a populated session), so the initial state arrives in a short burst instead of at the steady state rate.
+        // Only m_targetSendLimitBytesPerSec is scaled, the rate measured by the traffic control is never exceeded (1 - disabled).
+        float m_initialStateSendLimitScale;
+
         ReplicaMgrDesc(const AZ::Crc32& myPeerId = AZ::Crc32()
             , Carrier* carrier = NULL
             , unsigned char commChannel = 0
@@ -225,6 +251,9 @@ namespace GridMate {
             , m_targetSendLimitBytesPerSec(targetSendLimitBytesPerSec)
             , m_targetSendLimitBurst(10.f)
             , m_targetFixedTimeStepsPerSecond(k_fixedTimeStepDisabled)
+            , m_parallelMarshalMinPeers(0)
+            , m_sendLimitFromTrafficControl(false)
+            , m_initialStateSendLimitScale(1.f)
         {
         }
     };
@@ -317,6 +346,7 @@ namespace GridMate {
         friend class ReplicaUpdateTaskBase;
         friend class ReplicaDestroyPeerTask;
         friend class SendLimitProcessPolicy;
+        friend class BandwidthProcessPolicy;
         friend class InterestManager;
 
         typedef unordered_map<int, void*> UserContextMapType;
@@ -380,7 +410,7 @@ namespace GridMate {
         typedef AZStd::intrusive_list<Replica, AZStd::list_member_hook<Replica, & Replica::m_dirtyHook> > DirtyReplicas;
         DirtyReplicas m_dirtyReplicas;
         AZ::PoolAllocator m_tasksAllocator;
-        ReplicaTaskManager<SendLimitProcessPolicy, SendPriorityPolicy> m_marshalingTasks;
+        ReplicaTaskManager<BandwidthProcessPolicy, AccumulatedPriorityPolicy> m_marshalingTasks;
         ReplicaTaskManager<NullProcessPolicy, NullPriorityPolicy> m_updateTasks;
         ReplicaTaskManager<NullProcessPolicy, NullPriorityPolicy> m_peerUpdateTasks;
 
@@ -389,6 +419,7 @@ namespace GridMate {
 
         ReplicationSecurityOptions m_securityOptions;
         bool m_autoBroadcast; ///< should replicas be automatically broadcast to every session member?
+        ReplicaCaptureWriter* m_capture; ///< records the received traffic while capturing
 
         // forbidding replica manager copying
         ReplicaManager(const ReplicaManager&) AZ_DELETE_METHOD;
@@ -575,6 +606,16 @@ namespace GridMate {
         void AddPeer(ConnectionID connId, RemotePeerMode peerMode);
         void RemovePeer(ConnectionID connId);
 
+        /*
+         * Traffic capture
+         * Records the peers and all the replica traffic received from them to the stream, until the capture is
+         * stopped or the manager shuts down. The stream must stay valid while capturing. Only peers added after the
+         * capture started are recorded, so start it before connecting to the session. See ReplicaReplay.
+         */
+        void StartCapture(AZ::IO::GenericStream* stream);
+        void StopCapture();
+        bool IsCapturing() const { return m_capture != nullptr; }
+
         /*
          * Replicas
          */
@@ -0,0 +1,323 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef AZ_UNITY_BUILD
+
+#include <GridMate/Replica/ReplicaReplay.h>
+#include <GridMate/Replica/ReplicaChunk.h>
+#include <GridMate/Replica/ReplicaChunkDescriptor.h>
+#include <GridMate/Carrier/Carrier.h>
+#include <GridMate/Containers/queue.h>
+
+namespace GridMate
+{
+    namespace ReplicaReplayInternal
+    {
+        //-----------------------------------------------------------------------------
+        // ReplayCarrier
+        // Carrier that delivers the captured messages queued for the current frame, and drops everything sent.
+        //-----------------------------------------------------------------------------
+        class ReplayCarrier
+            : public Carrier
+        {
+        public:
+            GM_CLASS_ALLOCATOR(ReplayCarrier);
+
+            explicit ReplayCarrier(IGridMate* gridMate)
+                : Carrier(gridMate)
+                , m_time(0)
+            {
+                m_maxSendRateMS = 0;
+                m_connectionRetryIntervalBase = 0;
+                m_connectionRetryIntervalMax = 0;
+                m_batchPacketCount = 0;
+            }
+
+            static ConnectionID GetConnectionId(AZ::u32 connection)
+            {
+                // any non-zero value works, connection ids are only compared
+                return reinterpret_cast<ConnectionID>(static_cast<size_t>(connection) + 1);
+            }
+
+            void SetTime(AZ::u32 time) { m_time = time; }
+
+            void QueueMessage(AZ::u32 connection, const vector<char>& data)
+            {
+                m_messages[GetConnectionId(connection)].push(&data);
+            }
+
+            void Shutdown() override {}
+            ConnectionID Connect(const char*, unsigned int) override { return InvalidConnectionID; }
+            ConnectionID Connect(const string&) override { return InvalidConnectionID; }
+            void Disconnect(ConnectionID) override {}
+            unsigned int GetPort() const override { return 0; }
+            unsigned int GetMessageMTU() override { return 64 * 1024; }
+            string ConnectionToAddress(ConnectionID) override { return string("replay"); }
+
+            void SendWithCallback(const char*, unsigned int, AZStd::unique_ptr<CarrierACKCallback>, ConnectionID, DataReliability, DataPriority, unsigned char) override {}
+            void Send(const char*, unsigned int, ConnectionID, DataReliability, DataPriority, unsigned char) override {}
+
+            ReceiveResult Receive(char* data, unsigned int maxDataSize, ConnectionID from, unsigned char channel) override
+            {
+                (void)channel;
+                ReceiveResult result;
+                result.m_state = ReceiveResult::NO_MESSAGE_TO_RECEIVE;
+                result.m_numBytes = 0;
+
+                auto it = m_messages.find(from);
+                if (it == m_messages.end() || it->second.empty())
+                {
+                    return result;
+                }
+
+                const vector<char>& message = *it->second.front();
+                result.m_numBytes = static_cast<unsigned int>(message.size());
+                if (!data || maxDataSize < message.size())
+                {
+                    result.m_state = ReceiveResult::UNSUFFICIENT_BUFFER_SIZE;
+                    return result;
+                }
+
+                memcpy(data, message.data(), message.size());
+                it->second.pop();
+                result.m_state = ReceiveResult::RECEIVED;
+                return result;
+            }
+
+            void Update() override {}
+            unsigned int GetNumConnections() const override { return static_cast<unsigned int>(m_messages.size()); }
+
+            ConnectionStates QueryStatistics(ConnectionID, TrafficControl::Statistics*, TrafficControl::Statistics*, TrafficControl::Statistics*, TrafficControl::Statistics*, FlowInformation*) override
+            {
+                return CST_CONNECTED;
+            }
+
+            ConnectionID DebugGetConnectionId(unsigned int index) const override { return GetConnectionId(index); }
+
+            void StartClockSync(unsigned int, bool) override {}
+            void StopClockSync() override {}
+            AZ::u32 GetTime() override { return m_time; }
+
+        private:
+            AZ::u32 m_time;
+            unordered_map<ConnectionID, queue<const vector<char>*> > m_messages;
+        };
+    } // namespace ReplicaReplayInternal
+
+    //-----------------------------------------------------------------------------
+    // ReplicaReplayReport
+    //-----------------------------------------------------------------------------
+    ReplicaReplayReport::ReplicaReplayReport()
+    {
+        Reset();
+    }
+    //-----------------------------------------------------------------------------
+    void ReplicaReplayReport::Reset()
+    {
+        m_numFrames = 0;
+        m_numMessages = 0;
+        m_numBytes = 0;
+        m_captureDurationMS = 0;
+        m_unmarshalTime = Duration::zero();
+        m_updateTime = Duration::zero();
+        m_dataSetEventTime = Duration::zero();
+        m_rpcDispatchTime = Duration::zero();
+        m_marshalTime = Duration::zero();
+        m_totalTime = Duration::zero();
+        m_chunkTypes.clear();
+    }
+    //-----------------------------------------------------------------------------
+    void ReplicaReplayReport::Print() const
+    {
+        AZ_TracePrintf("GridMate", "Replica replay: %u frames, %u messages, %llu bytes, %u ms captured, replayed in %.3f ms\n",
+            m_numFrames, m_numMessages, static_cast<unsigned long long>(m_numBytes), m_captureDurationMS, m_totalTime.count() / 1000.f);
+        AZ_TracePrintf("GridMate", "  Unmarshal:           %10.3f ms\n", m_unmarshalTime.count() / 1000.f);
+        AZ_TracePrintf("GridMate", "  UpdateFromReplicas:  %10.3f ms\n", m_updateTime.count() / 1000.f);
+        AZ_TracePrintf("GridMate", "    DataSet callbacks: %10.3f ms\n", m_dataSetEventTime.count() / 1000.f);
+        AZ_TracePrintf("GridMate", "    Rpc dispatch:      %10.3f ms\n", m_rpcDispatchTime.count() / 1000.f);
+        AZ_TracePrintf("GridMate", "  Update and marshal:  %10.3f ms\n", m_marshalTime.count() / 1000.f);
+
+        const float seconds = m_captureDurationMS > 0 ? m_captureDurationMS / 1000.f : 1.f;
+        for (const auto& chunkType : m_chunkTypes)
+        {
+            const ChunkTypeStats& stats = chunkType.second;
+            AZ_TracePrintf("GridMate", "  %s: %llu bytes (%.1f bytes/s), %llu in datasets, %llu in %u rpcs, %u updates\n",
+                chunkType.first.c_str(), static_cast<unsigned long long>(stats.m_bytes), stats.m_bytes / seconds,
+                static_cast<unsigned long long>(stats.m_dataSetBytes), static_cast<unsigned long long>(stats.m_rpcBytes), stats.m_numRpcs, stats.m_numUpdates);
+        }
+    }
+    //-----------------------------------------------------------------------------
+
+    //-----------------------------------------------------------------------------
+    // ReplicaReplay
+    //-----------------------------------------------------------------------------
+    ReplicaReplay::ReplicaReplay(IGridMate* gridMate)
+        : m_gridMate(gridMate)
+    {
+        AZ_Assert(m_gridMate, "Invalid GridMate instance!");
+    }
+    //-----------------------------------------------------------------------------
+    ReplicaReplay::~ReplicaReplay()
+    {
+        Debug::ReplicaDrillerBus::Handler::BusDisconnect();
+    }
+    //-----------------------------------------------------------------------------
+    const ReplicaReplayReport& ReplicaReplay::Run(const ReplicaCapture& capture)
+    {
+        using namespace ReplicaReplayInternal;
+        typedef ReplicaReplayReport::Duration Duration;
+
+        m_report.Reset();
+
+        const ReplicaCapture::RecordList& records = capture.GetRecords();
+        if (records.empty())
+        {
+            return m_report;
+        }
+        m_report.m_captureDurationMS = records.back().m_time - records.front().m_time;
+
+        ReplayCarrier carrier(m_gridMate);
+        carrier.SetTime(records.front().m_time);
+
+        ReplicaManager rm;
+        ReplicaMgrDesc desc(capture.GetLocalPeerId(), &carrier, 0, capture.IsSyncHost() ? ReplicaMgrDesc::Role_SyncHost : 0);
+        rm.Init(desc);
+
+        Debug::ReplicaDrillerBus::Handler::BusConnect();
+
+        const Clock::time_point replayStart = Clock::now();
+        for (size_t i = 0; i < records.size(); )
+        {
+            const ReplicaCaptureRecord& record = records[i];
+            carrier.SetTime(record.m_time);
+
+            if (record.m_type == ReplicaCaptureRecord::Type_AddPeer)
+            {
+                rm.AddPeer(ReplayCarrier::GetConnectionId(record.m_connection), record.m_mode);
+                ++i;
+                continue;
+            }
+
+            if (record.m_type == ReplicaCaptureRecord::Type_RemovePeer)
+            {
+                rm.RemovePeer(ReplayCarrier::GetConnectionId(record.m_connection));
+                ++i;
+                continue;
+            }
+
+            // all the messages received in the same frame
+            for (; i < records.size() && records[i].m_type == ReplicaCaptureRecord::Type_Message && records[i].m_time == record.m_time; ++i)
+            {
+                carrier.QueueMessage(records[i].m_connection, records[i].m_data);
+                ++m_report.m_numMessages;
+                m_report.m_numBytes += records[i].m_data.size();
+            }
+
+            const Clock::time_point frameStart = Clock::now();
+            rm.Unmarshal();
+            const Clock::time_point unmarshalEnd = Clock::now();
+            rm.UpdateFromReplicas();
+            const Clock::time_point updateEnd = Clock::now();
+            rm.UpdateReplicas();
+            rm.Marshal();
+            const Clock::time_point frameEnd = Clock::now();
+
+            m_report.m_unmarshalTime += AZStd::chrono::duration_cast<Duration>(unmarshalEnd - frameStart);
+            m_report.m_updateTime += AZStd::chrono::duration_cast<Duration>(updateEnd - unmarshalEnd);
+            m_report.m_marshalTime += AZStd::chrono::duration_cast<Duration>(frameEnd - updateEnd);
+            ++m_report.m_numFrames;
+        }
+        m_report.m_totalTime = AZStd::chrono::duration_cast<Duration>(Clock::now() - replayStart);
+
+        Debug::ReplicaDrillerBus::Handler::BusDisconnect();
+
+        rm.Shutdown();
+        return m_report;
+    }
+    //-----------------------------------------------------------------------------
+    ReplicaReplayReport::ChunkTypeStats* ReplicaReplay::GetChunkTypeStats(ReplicaChunkBase* chunk)
+    {
+        if (!chunk || !chunk->GetDescriptor())
+        {
+            return nullptr;
+        }
+        return &m_report.m_chunkTypes[string(chunk->GetDescriptor()->GetChunkName())];
+    }
+    //-----------------------------------------------------------------------------
+    void ReplicaReplay::OnReceiveReplicaChunkBegin(ReplicaChunkBase* chunk, AZ::u32 chunkIndex, PeerId from, PeerId to, const void* data, size_t len)
+    {
+        (void)chunkIndex;
+        (void)from;
+        (void)to;
+        (void)data;
+        if (ReplicaReplayReport::ChunkTypeStats* stats = GetChunkTypeStats(chunk))
+        {
+            stats->m_bytes += len;
+            ++stats->m_numUpdates;
+        }
+    }
+    //-----------------------------------------------------------------------------
+    void ReplicaReplay::OnReceiveDataSet(ReplicaChunkBase* chunk, AZ::u32 chunkIndex, DataSetBase* dataSet, PeerId from, PeerId to, const void* data, size_t len)
+    {
+        (void)chunkIndex;
+        (void)dataSet;
+        (void)from;
+        (void)to;
+        (void)data;
+        if (ReplicaReplayReport::ChunkTypeStats* stats = GetChunkTypeStats(chunk))
+        {
+            stats->m_dataSetBytes += len;
+        }
+    }
+    //-----------------------------------------------------------------------------
+    void ReplicaReplay::OnReceiveRpc(ReplicaChunkBase* chunk, AZ::u32 chunkIndex, Internal::RpcRequest* rpc, PeerId from, PeerId to, const void* data, size_t len)
+    {
+        (void)chunkIndex;
+        (void)rpc;
+        (void)from;
+        (void)to;
+        (void)data;
+        if (ReplicaReplayReport::ChunkTypeStats* stats = GetChunkTypeStats(chunk))
+        {
+            stats->m_rpcBytes += len;
+            ++stats->m_numRpcs;
+        }
+    }
+    //-----------------------------------------------------------------------------
+    void ReplicaReplay::OnInvokeRpc(ReplicaChunkBase* chunk, Internal::RpcRequest* rpc)
+    {
+        (void)chunk;
+        (void)rpc;
+        m_rpcStart = Clock::now();
+    }
+    //-----------------------------------------------------------------------------
+    void ReplicaReplay::OnInvokeRpcEnd(ReplicaChunkBase* chunk, Internal::RpcRequest* rpc)
+    {
+        (void)chunk;
+        (void)rpc;
+        m_report.m_rpcDispatchTime += AZStd::chrono::duration_cast<ReplicaReplayReport::Duration>(Clock::now() - m_rpcStart);
+    }
+    //-----------------------------------------------------------------------------
+    void ReplicaReplay::OnDispatchDataSetEventsBegin(ReplicaChunkBase* chunk)
+    {
+        (void)chunk;
+        m_dataSetEventsStart = Clock::now();
+    }
+    //-----------------------------------------------------------------------------
+    void ReplicaReplay::OnDispatchDataSetEventsEnd(ReplicaChunkBase* chunk)
+    {
+        (void)chunk;
+        m_report.m_dataSetEventTime += AZStd::chrono::duration_cast<ReplicaReplayReport::Duration>(Clock::now() - m_dataSetEventsStart);
+    }
+    //-----------------------------------------------------------------------------
+} // namespace GridMate
+
+#endif // #ifndef AZ_UNITY_BUILD
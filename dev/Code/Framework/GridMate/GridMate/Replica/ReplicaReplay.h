@@ -0,0 +1,115 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef GM_REPLICA_REPLAY_H
+#define GM_REPLICA_REPLAY_H
+
+#include <GridMate/Replica/ReplicaCapture.h>
+#include <GridMate/Replica/ReplicaDrillerEvents.h>
+#include <GridMate/String/string.h>
+
+#include <AzCore/std/chrono/clocks.h>
+
+namespace GridMate
+{
+    class IGridMate;
+
+    /**
+     * Results of a replica traffic replay.
+     */
+    struct ReplicaReplayReport
+    {
+        typedef AZStd::chrono::microseconds Duration;
+
+        /// Received traffic of one chunk type
+        struct ChunkTypeStats
+        {
+            ChunkTypeStats()
+                : m_bytes(0)
+                , m_dataSetBytes(0)
+                , m_rpcBytes(0)
+                , m_numUpdates(0)
+                , m_numRpcs(0)
+            { }
+
+            AZ::u64 m_bytes;        ///< All the chunk data, including chunk headers
+            AZ::u64 m_dataSetBytes;
+            AZ::u64 m_rpcBytes;
+            AZ::u32 m_numUpdates;   ///< Number of times chunk data was received
+            AZ::u32 m_numRpcs;
+        };
+
+        ReplicaReplayReport();
+
+        void Reset();
+        void Print() const;
+
+        AZ::u32 m_numFrames;
+        AZ::u32 m_numMessages;
+        AZ::u64 m_numBytes;
+        AZ::u32 m_captureDurationMS;    ///< Time between the first and the last record of the capture
+
+        Duration m_unmarshalTime;       ///< ReplicaManager::Unmarshal
+        Duration m_updateTime;          ///< ReplicaManager::UpdateFromReplicas, includes the DataSet callbacks and the rpc dispatch
+        Duration m_dataSetEventTime;    ///< DataSet changed callbacks
+        Duration m_rpcDispatchTime;     ///< Handlers of the received rpcs
+        Duration m_marshalTime;         ///< ReplicaManager::UpdateReplicas and ReplicaManager::Marshal
+        Duration m_totalTime;
+
+        unordered_map<string, ChunkTypeStats> m_chunkTypes;
+    };
+
+    /**
+     * Headless replay of a replica traffic capture (see ReplicaManager::StartCapture).
+     * Feeds the captured messages, frame by frame, to a new ReplicaManager as fast as possible, and measures the time
+     * spent in each stage of the replication along with the received bandwidth of every chunk type. The manager is set
+     * up as the capturing peer, on a carrier that plays back the capture: the carrier time follows the captured
+     * timestamps and everything sent is dropped. Replaying the same capture runs the same replication, so it can be
+     * used to benchmark changes to GridMate or to the game's chunks.
+     * All the chunk types of the capture must be registered, and their handlers behave as they would on the capturing
+     * peer. Traffic from the local game (masters created by the game, rpcs it calls) is not part of the capture.
+     */
+    class ReplicaReplay
+        : public Debug::ReplicaDrillerBus::Handler
+    {
+    public:
+        GM_CLASS_ALLOCATOR(ReplicaReplay);
+
+        explicit ReplicaReplay(IGridMate* gridMate);
+        ~ReplicaReplay() override;
+
+        /// Replays the capture and returns its report.
+        const ReplicaReplayReport& Run(const ReplicaCapture& capture);
+
+        const ReplicaReplayReport& GetReport() const { return m_report; }
+
+    protected:
+        typedef AZStd::chrono::system_clock Clock;
+
+        ReplicaReplayReport::ChunkTypeStats* GetChunkTypeStats(ReplicaChunkBase* chunk);
+
+        // ReplicaDrillerBus
+        void OnReceiveReplicaChunkBegin(ReplicaChunkBase* chunk, AZ::u32 chunkIndex, PeerId from, PeerId to, const void* data, size_t len) override;
+        void OnReceiveDataSet(ReplicaChunkBase* chunk, AZ::u32 chunkIndex, DataSetBase* dataSet, PeerId from, PeerId to, const void* data, size_t len) override;
+        void OnReceiveRpc(ReplicaChunkBase* chunk, AZ::u32 chunkIndex, Internal::RpcRequest* rpc, PeerId from, PeerId to, const void* data, size_t len) override;
+        void OnInvokeRpc(ReplicaChunkBase* chunk, Internal::RpcRequest* rpc) override;
+        void OnInvokeRpcEnd(ReplicaChunkBase* chunk, Internal::RpcRequest* rpc) override;
+        void OnDispatchDataSetEventsBegin(ReplicaChunkBase* chunk) override;
+        void OnDispatchDataSetEventsEnd(ReplicaChunkBase* chunk) override;
+
+        IGridMate* m_gridMate;
+        ReplicaReplayReport m_report;
+        Clock::time_point m_rpcStart;
+        Clock::time_point m_dataSetEventsStart;
+    };
+} // namespace GridMate
+
+#endif // GM_REPLICA_REPLAY_H
@@ -47,6 +47,8 @@ namespace GridMate
         : m_peer(nullptr)
         , m_flags(0)
         , m_slotMask(0)
+        , m_relevance(1.f)
+        , m_accumulatedPriority(0.f)
         , m_replicaRevision(0)
     {
         InitNode<ReplicaTarget>(m_replicaHook);
@@ -55,6 +57,7 @@ namespace GridMate
 
     ReplicaTarget::~ReplicaTarget()
     {
+        SetNew(false);
         UnlinkNode<ReplicaTarget, & ReplicaTarget::m_replicaHook>(m_replicaHook);
         UnlinkNode<ReplicaTarget, & ReplicaTarget::m_peerHook>(m_peerHook);
     }
@@ -71,6 +74,11 @@ namespace GridMate
 
     void ReplicaTarget::SetNew(bool isNew)
     {
+        if (isNew == IsNew())
+        {
+            return;
+        }
+
         if (isNew)
         {
             m_flags |= TargetNew;
@@ -79,6 +87,19 @@ namespace GridMate
         {
             m_flags &= ~TargetNew;
         }
+
+        if (m_peer)
+        {
+            AZ_Assert(isNew || m_peer->m_newTargetCount > 0, "Peer's new target count is out of sync");
+            if (isNew)
+            {
+                ++m_peer->m_newTargetCount;
+            }
+            else
+            {
+                --m_peer->m_newTargetCount;
+            }
+        }
     }
 
     bool ReplicaTarget::IsNew() const
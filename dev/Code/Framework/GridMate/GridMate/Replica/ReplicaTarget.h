@@ -51,6 +51,7 @@ namespace GridMate
     class ReplicaTarget
     {
         friend class InterestManager;
+        friend class AccumulatedPriorityPolicy;
 
     public:
         static ReplicaTarget* AddReplicaTarget(ReplicaPeer* peer, Replica* replica);
@@ -62,6 +63,11 @@ namespace GridMate
         // Returns ReplicaPeer associated with given replica
         ReplicaPeer* GetPeer() const;
 
+        // Relevance of the replica to the peer (e.g. based on distance), scales how fast the replica's send priority grows
+        // for this peer while its updates are postponed. Defaults to 1.
+        void SetRelevance(float relevance) { m_relevance = relevance; }
+        float GetRelevance() const { return m_relevance; }
+
         // Destroys current target. Target will be removed both from peer and replica
         void Destroy();
 
@@ -122,6 +128,9 @@ namespace GridMate
 
         AZ::u32                             m_slotMask;
 
+        float                               m_relevance;
+        float                               m_accumulatedPriority; ///< Priority gained while the replica's updates to the peer were postponed
+
         static bool                         k_enableAck;
         AZStd::shared_ptr<TargetCallback>   m_callback;
         AZ::u64                             m_replicaRevision; ///< Last ACK'd replica stamp; 0 means NULL
@@ -0,0 +1,98 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef AZ_UNITY_BUILD
+
+#include <GridMate/Replica/SnapshotDeltaDataSet.h>
+
+namespace GridMate
+{
+    namespace SnapshotDelta
+    {
+        static const size_t k_bytesPerMask = 8;
+
+        void WriteDelta(WriteBuffer& wb, const char* base, size_t baseSize, const char* data, size_t dataSize)
+        {
+            wb.Write(static_cast<AZ::u32>(dataSize), VlqU32Marshaler());
+
+            for (size_t groupStart = 0; groupStart < dataSize; groupStart += k_bytesPerMask)
+            {
+                const size_t groupSize = AZStd::GetMin(k_bytesPerMask, dataSize - groupStart);
+
+                AZ::u8 changedMask = 0;
+                for (size_t i = 0; i < groupSize; ++i)
+                {
+                    const size_t index = groupStart + i;
+                    const char baseByte = index < baseSize ? base[index] : 0;
+                    if (data[index] != baseByte)
+                    {
+                        changedMask |= static_cast<AZ::u8>(1 << i);
+                    }
+                }
+
+                wb.Write(changedMask);
+                for (size_t i = 0; i < groupSize; ++i)
+                {
+                    if (changedMask & (1 << i))
+                    {
+                        wb.WriteRaw(data + groupStart + i, 1);
+                    }
+                }
+            }
+        }
+
+        bool ReadDelta(ReadBuffer& rb, const char* base, size_t baseSize, vector<char>& data)
+        {
+            AZ::u32 dataSize = 0;
+            if (!rb.Read(dataSize, VlqU32Marshaler()))
+            {
+                return false;
+            }
+
+            // every group costs at least its mask byte, don't trust sizes the buffer can't hold
+            if ((dataSize + k_bytesPerMask - 1) / k_bytesPerMask > rb.Left().GetBytes())
+            {
+                return false;
+            }
+
+            data.resize(dataSize);
+            for (size_t groupStart = 0; groupStart < dataSize; groupStart += k_bytesPerMask)
+            {
+                const size_t groupSize = AZStd::GetMin(k_bytesPerMask, dataSize - groupStart);
+
+                AZ::u8 changedMask = 0;
+                if (!rb.Read(changedMask))
+                {
+                    return false;
+                }
+
+                for (size_t i = 0; i < groupSize; ++i)
+                {
+                    const size_t index = groupStart + i;
+                    if (changedMask & (1 << i))
+                    {
+                        if (!rb.ReadRaw(&data[index], 1))
+                        {
+                            return false;
+                        }
+                    }
+                    else
+                    {
+                        data[index] = (base && index < baseSize) ? base[index] : 0;
+                    }
+                }
+            }
+            return true;
+        }
+    }
+}
+
+#endif // #ifndef AZ_UNITY_BUILD
@@ -0,0 +1,262 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#ifndef GM_SNAPSHOTDELTA_DATASET_H
+#define GM_SNAPSHOTDELTA_DATASET_H
+
+#pragma once
+
+#include <GridMate/Replica/DataSet.h>
+#include <GridMate/Serialize/CompressionMarshal.h>
+
+namespace GridMate
+{
+    namespace SnapshotDelta
+    {
+        /**
+         * Writes data as a delta against base: the size of data, then for every 8 bytes a mask of the bytes that
+         * differ from base, followed by those bytes. Bytes past the end of base are compared against zero.
+         */
+        void WriteDelta(WriteBuffer& wb, const char* base, size_t baseSize, const char* data, size_t dataSize);
+
+        /**
+         * Reads a delta written by WriteDelta into data. The delta can be read without its base, pass a null base to
+         * skip it. Returns false if the buffer doesn't hold a complete delta.
+         */
+        bool ReadDelta(ReadBuffer& rb, const char* base, size_t baseSize, vector<char>& data);
+    }
+
+    /**
+     * \brief DataSet that sends each peer a delta against the last snapshot the peer acknowledged.
+     * The master keeps the marshaled values of its last HistorySize snapshots. When a peer has acknowledged one of
+     * them (tracked by ReplicaTarget through the ack callbacks of the sent datagrams) the update to that peer only
+     * carries the bytes that changed since that snapshot, otherwise the full value is sent. Proxies keep the snapshots
+     * they received, so they can rebuild the value from any baseline the master picks. After packet loss the acked
+     * snapshot simply stays older, and the deltas grow until a newer one is acknowledged.
+     * The delta is taken on the marshaled bytes, so this works with any marshaler, and pays off for compound values
+     * where only a few fields change at a time. Each update costs 2 extra bytes for the snapshot sequence and baseline.
+     * Without ack feedback (see ReplicaTarget::IsAckEnabled) every update carries the full value.
+     *
+     * \tparam DataType
+     * \tparam HistorySize number of snapshots kept on both ends, a power of two up to 128
+     * \tparam MarshalerType
+     * \tparam ThrottlerType
+     */
+    template<typename DataType, AZ::u8 HistorySize = 16, typename MarshalerType = Marshaler<DataType>, typename ThrottlerType = BasicThrottle<DataType>>
+    class SnapshotDeltaDataSet
+        : public DataSet<DataType, MarshalerType, ThrottlerType>
+    {
+        typedef DataSet<DataType, MarshalerType, ThrottlerType> BaseType;
+
+    public:
+        template<class C, void (C::* FuncPtr)(const DataType&, const TimeContext&)>
+        class BindInterface;
+
+        /**
+            Constructs a DataSet.
+        **/
+        SnapshotDeltaDataSet(const char* debugName, const DataType& value = DataType(), const MarshalerType& marshaler = MarshalerType(), const ThrottlerType& throttler = ThrottlerType())
+            : BaseType(debugName, value, marshaler, throttler)
+            , m_sequence(0)
+            , m_hasSnapshot(false)
+        {
+            static_assert(HistorySize > 1 && HistorySize <= 128 && (HistorySize & (HistorySize - 1)) == 0, "History size must be a power of two up to 128!");
+            static_assert(!AZStd::is_pointer<DataType>::value, "Pointer types are not supported!");
+        }
+
+    protected:
+        struct Snapshot
+        {
+            Snapshot()
+                : m_revision(0)
+                , m_sequence(0)
+                , m_isValid(false)
+            { }
+
+            AZ::u64 m_revision;     ///< Replica revision the snapshot was taken at on the master, 0 for received snapshots
+            AZ::u8 m_sequence;
+            bool m_isValid;
+            vector<char> m_data;    ///< Marshaled value
+        };
+
+        PrepareDataResult PrepareData(EndianType endianType, AZ::u32 marshalFlags) override
+        {
+            PrepareDataResult pdr = BaseType::PrepareData(endianType, marshalFlags);
+
+            // A new snapshot every time the stream cache gets a new value
+            if (pdr.m_isDownstreamReliableDirty || pdr.m_isDownstreamUnreliableDirty || (!m_hasSnapshot && this->m_streamCache.Size() > 0))
+            {
+                if (m_hasSnapshot)
+                {
+                    ++m_sequence;
+                }
+
+                Snapshot& snapshot = GetSnapshot(m_sequence);
+                snapshot.m_revision = this->m_revision;
+                snapshot.m_sequence = m_sequence;
+                snapshot.m_isValid = true;
+                snapshot.m_data.assign(this->m_streamCache.Get(), this->m_streamCache.Get() + this->m_streamCache.Size());
+                m_hasSnapshot = true;
+            }
+
+            return pdr;
+        }
+
+        void Marshal(MarshalContext& mc) const override
+        {
+            AZ_Assert(m_hasSnapshot, "The value was not prepared for marshaling!");
+
+            const Snapshot& snapshot = GetSnapshot(m_sequence);
+            const Snapshot* baseline = FindBaseline(mc.m_peerLatestVersionAckd);
+
+            mc.m_outBuffer->Write(snapshot.m_sequence);
+            if (baseline)
+            {
+                mc.m_outBuffer->Write(static_cast<AZ::u8>(snapshot.m_sequence - baseline->m_sequence));
+                SnapshotDelta::WriteDelta(*mc.m_outBuffer, baseline->m_data.data(), baseline->m_data.size(), snapshot.m_data.data(), snapshot.m_data.size());
+            }
+            else
+            {
+                mc.m_outBuffer->Write(static_cast<AZ::u8>(0));
+                mc.m_outBuffer->Write(static_cast<AZ::u32>(snapshot.m_data.size()), VlqU32Marshaler());
+                mc.m_outBuffer->WriteRaw(snapshot.m_data.data(), snapshot.m_data.size());
+            }
+        }
+
+        void Unmarshal(UnmarshalContext& mc) override
+        {
+            AZ::u8 sequence = 0;
+            AZ::u8 baselineAge = 0;
+            if (!mc.m_iBuf->Read(sequence) || !mc.m_iBuf->Read(baselineAge))
+            {
+                return;
+            }
+
+            // The baseline is less than HistorySize snapshots older, so it never shares a slot with the new snapshot
+            Snapshot& snapshot = GetSnapshot(sequence);
+            bool hasValue = true;
+            if (baselineAge == 0)
+            {
+                AZ::u32 size = 0;
+                if (!mc.m_iBuf->Read(size, VlqU32Marshaler()) || PackedSize(size) > mc.m_iBuf->Left())
+                {
+                    return;
+                }
+                snapshot.m_data.resize(size);
+                mc.m_iBuf->ReadRaw(snapshot.m_data.data(), size);
+            }
+            else
+            {
+                const AZ::u8 baselineSequence = static_cast<AZ::u8>(sequence - baselineAge);
+                const Snapshot& baseline = GetSnapshot(baselineSequence);
+                hasValue = baselineAge < HistorySize && baseline.m_isValid && baseline.m_sequence == baselineSequence;
+                if (!SnapshotDelta::ReadDelta(*mc.m_iBuf, hasValue ? baseline.m_data.data() : nullptr, hasValue ? baseline.m_data.size() : 0, snapshot.m_data))
+                {
+                    return;
+                }
+            }
+
+            snapshot.m_isValid = hasValue;
+            if (!hasValue)
+            {
+                AZ_TracePrintf("GridMate", "Received a delta for DataSet snapshot %u against the unknown snapshot %u, the update is dropped.\n", sequence, static_cast<AZ::u8>(sequence - baselineAge));
+                return;
+            }
+
+            snapshot.m_revision = 0;
+            snapshot.m_sequence = sequence;
+            m_sequence = sequence;
+            m_hasSnapshot = true;
+
+            ReadBuffer valueBuffer(mc.m_iBuf->GetEndianType(), snapshot.m_data.data(), snapshot.m_data.size());
+            UnmarshalContext valueContext(mc);
+            valueContext.m_iBuf = &valueBuffer;
+            if (MarshalerShim::Unmarshal(valueContext, this->m_marshaler, this->m_value, AZStd::false_type()))
+            {
+                this->m_lastUpdateTime = mc.m_timestamp;
+                this->m_replicaChunk->AddDataSetEvent(this);
+            }
+        }
+
+        Snapshot& GetSnapshot(AZ::u8 sequence) { return m_snapshots[sequence & (HistorySize - 1)]; }
+        const Snapshot& GetSnapshot(AZ::u8 sequence) const { return m_snapshots[sequence & (HistorySize - 1)]; }
+
+        /// Returns the newest snapshot, older than the current one, that the peer acknowledged
+        const Snapshot* FindBaseline(AZ::u64 peerLatestVersionAckd) const
+        {
+            if (!ReplicaTarget::IsAckEnabled() || peerLatestVersionAckd == 0)
+            {
+                return nullptr;
+            }
+
+            for (AZ::u8 age = 1; age < HistorySize; ++age)
+            {
+                const AZ::u8 sequence = static_cast<AZ::u8>(m_sequence - age);
+                const Snapshot& snapshot = GetSnapshot(sequence);
+                if (!snapshot.m_isValid || snapshot.m_sequence != sequence)
+                {
+                    break;
+                }
+
+                if (snapshot.m_revision != 0 && snapshot.m_revision <= peerLatestVersionAckd)
+                {
+                    return &snapshot;
+                }
+            }
+            return nullptr;
+        }
+
+        Snapshot m_snapshots[HistorySize];
+        AZ::u8 m_sequence;  ///< Sequence of the latest snapshot
+        bool m_hasSnapshot;
+    };
+
+    //-----------------------------------------------------------------------------
+
+    /**
+        Declares a SnapshotDeltaDataSet with an event handler that is called when the DataSet is changed.
+        Use BindInterface<Class, FuncPtr> to dispatch to a method on the ReplicaChunk's
+        ReplicaChunkInterface event handler instance.
+    **/
+    template<typename DataType, AZ::u8 HistorySize, typename MarshalerType, typename ThrottlerType>
+    template<class C, void (C::* FuncPtr)(const DataType&, const TimeContext&)>
+    class SnapshotDeltaDataSet<DataType, HistorySize, MarshalerType, ThrottlerType>::BindInterface
+        : public SnapshotDeltaDataSet<DataType, HistorySize, MarshalerType, ThrottlerType>
+    {
+    public:
+        BindInterface(const char* debugName,
+            const DataType& value = DataType(),
+            const MarshalerType& marshaler = MarshalerType(),
+            const ThrottlerType& throttler = ThrottlerType())
+            : SnapshotDeltaDataSet(debugName,
+                value,
+                marshaler,
+                throttler)
+        { }
+
+    protected:
+        void DispatchChangedEvent(const TimeContext& tc) override
+        {
+            C* c = static_cast<C*>(this->m_replicaChunk->GetHandler());
+            if (c)
+            {
+                TimeContext changeTime;
+                changeTime.m_realTime = this->m_lastUpdateTime;
+                changeTime.m_localTime = this->m_lastUpdateTime - (tc.m_realTime - tc.m_localTime);
+
+                (*c.*FuncPtr)(this->m_value, changeTime);
+            }
+        }
+    };
+    //-----------------------------------------------------------------------------
+} // namespace GridMate
+
+#endif // GM_SNAPSHOTDELTA_DATASET_H
@@ -12,6 +12,10 @@
 #ifndef AZ_UNITY_BUILD
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 
 #include <GridMate/Replica/SystemReplicas.h>
 #include <GridMate/Replica/Tasks/ReplicaMarshalTasks.h>
@@ -317,59 +321,6 @@ namespace GridMate
         return TaskStatus::Done;
     }
 
-    //-----------------------------------------------------------------------------
-    // ReplicaMarshalUpdateTask
-    //-----------------------------------------------------------------------------
-    class ReplicaMarshalUpdateTask
-        : public ReplicaMarshalTaskBase
-    {
-    public:
-        GM_CLASS_ALLOCATOR(ReplicaMarshalUpdateTask);
-        //-----------------------------------------------------------------------------
-        ReplicaMarshalUpdateTask(ReplicaPtr replica, ReplicaPeer* peer, const MarshalTaskContext& taskContext)
-            : ReplicaMarshalTaskBase(replica)
-            , m_peer(peer)
-            , m_taskContext(taskContext)
-        {
-        }
-        //-----------------------------------------------------------------------------
-        AZ_FORCE_INLINE void SendReplica(const RunContext& context, WriteBuffer& buffer, CallbackBuffer& callback, AZ::u32 flags, AZ::u64 peerLatestVersionAckd = 0)
-        {
-            OnSendReplicaBegin();
-
-            //Marshall the Replica
-            MarshalContext marshalContext(flags, &buffer, &callback, ReplicaContext(context.m_replicaManager, context.m_replicaManager->GetTime(), m_peer), peerLatestVersionAckd, &m_taskContext.m_target);
-            const size_t bufferOffsetStart = buffer.Size();
-            m_replica->Marshal(marshalContext);
-            const size_t bytesWritten = buffer.Size() - bufferOffsetStart;
-
-            OnSendReplicaEnd(m_peer, buffer.Get() + bufferOffsetStart, bytesWritten);
-        }
-        TaskStatus Run(const RunContext& context) override
-        {
-            if (m_peer->IsOrphan())
-            {
-                return TaskStatus::Done;
-            }
-
-            if (m_taskContext.m_pdr.m_isDownstreamReliableDirty)
-            {
-                SendReplica(context, m_peer->GetReliableOutBuffer(), m_peer->GetReliableCallbackBuffer(), ReplicaMarshalFlags::Authoritative | ReplicaMarshalFlags::Reliable | ReplicaMarshalFlags::IncludeDatasets);
-            }
-
-            if (m_taskContext.m_pdr.m_isDownstreamUnreliableDirty)
-            {
-                SendReplica(context, m_peer->GetUnreliableOutBuffer(), m_peer->GetUnreliableCallbackBuffer(), ReplicaMarshalFlags::Authoritative | ReplicaMarshalFlags::IncludeDatasets, m_taskContext.m_target.GetRevision());
-            }
-
-            return TaskStatus::Done;
-        }
-
-    private:
-        ReplicaPeer* m_peer;
-        MarshalTaskContext m_taskContext;
-    };
-
     //-----------------------------------------------------------------------------
     // ReplicaMarshalTask
     //-----------------------------------------------------------------------------
@@ -400,7 +351,9 @@ namespace GridMate
             }
             else if (isDownstreamDirty || targetNeedsCallback)
             {
-                WaitReplicaTask<ReplicaMarshalUpdateTask>(context, m_replica, dst.GetPeer(), MarshalTaskContext(pdr, dst));
+                // updates only touch the target's own peer, they are marshaled together after this loop
+                m_updateTargets.push_back(&dst);
+                continue;
             }
 
             dst.SetNew(false);
@@ -413,6 +366,22 @@ namespace GridMate
             }
         }
 
+        if (!m_updateTargets.empty())
+        {
+            MarshalUpdates(context, pdr);
+
+            for (ReplicaTarget* dst : m_updateTargets)
+            {
+                // If the unreliable buffer size is above the cutoff, flush it to avoid fragmentation.
+                // Note that the reliable buffer is also flushed to maintain correct ordering.
+                if (dst->GetPeer()->GetUnreliableOutBuffer().Size() > GM_REPLICA_MSG_CUTOFF)
+                {
+                    dst->GetPeer()->SendBuffer(context.m_replicaManager->m_cfg.m_carrier, context.m_replicaManager->m_cfg.m_commChannel, context.m_replicaManager->GetTimeForNetworkTimestamp());
+                }
+            }
+            m_updateTargets.clear();
+        }
+
         if (CanUpstream() && (pdr.m_isUpstreamReliableDirty || pdr.m_isUpstreamUnreliableDirty))
         {
             AZ::u8 reliabilityFlags = 0;
@@ -449,6 +418,85 @@ namespace GridMate
         TaskStatus result = pdr.m_isDownstreamUnreliableDirty ? TaskStatus::Repeat : TaskStatus::Done;
         return result;
     }
+    //-----------------------------------------------------------------------------
+    void ReplicaMarshalTask::MarshalUpdates(const RunContext& context, const PrepareDataResult& pdr)
+    {
+        // Every target has its own peer, so the updates only share the replica data, which was prepared above
+        // and is only read while marshaling. Driller events go through a locked bus.
+        // The chunk payloads are encoded once per send channel and copied into the stream of every other peer.
+        ReplicaMarshalCache reliableCache;
+        ReplicaMarshalCache unreliableCache;
+
+        const unsigned int minPeers = context.m_replicaManager->m_cfg.m_parallelMarshalMinPeers;
+        AZ::JobContext* jobContext = (minPeers > 0 && m_updateTargets.size() >= minPeers) ? AZ::JobContext::GetGlobalContext() : nullptr;
+        const size_t jobCount = jobContext ? AZStd::min<size_t>(jobContext->GetJobManager().GetNumWorkerThreads(), m_updateTargets.size()) : 0;
+        if (jobCount <= 1)
+        {
+            for (ReplicaTarget* dst : m_updateTargets)
+            {
+                MarshalUpdate(context, *dst, pdr, reliableCache, unreliableCache);
+            }
+            return;
+        }
+
+        AZ_PROFILE_TIMER("GridMate", __FUNCTION__);
+
+        // Fill the caches from the first target, the jobs only read them
+        MarshalUpdate(context, *m_updateTargets[0], pdr, reliableCache, unreliableCache);
+        reliableCache.m_isReadOnly = true;
+        unreliableCache.m_isReadOnly = true;
+
+        AZStd::atomic<size_t> nextTarget(1);
+        AZ::JobCompletion jobCompletion;
+        for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+        {
+            AZ::Job* job = AZ::CreateJobFunction([this, &context, &pdr, &nextTarget, &reliableCache, &unreliableCache]()
+            {
+                for (size_t index = nextTarget.fetch_add(1); index < m_updateTargets.size(); index = nextTarget.fetch_add(1))
+                {
+                    MarshalUpdate(context, *m_updateTargets[index], pdr, reliableCache, unreliableCache);
+                }
+            }, true, jobContext);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+
+        jobCompletion.StartAndWaitForCompletion();
+    }
+    //-----------------------------------------------------------------------------
+    void ReplicaMarshalTask::MarshalUpdate(const RunContext& context, ReplicaTarget& target, const PrepareDataResult& pdr, ReplicaMarshalCache& reliableCache, ReplicaMarshalCache& unreliableCache)
+    {
+        ReplicaPeer* peer = target.GetPeer();
+        if (peer->IsOrphan())
+        {
+            return;
+        }
+
+        if (pdr.m_isDownstreamReliableDirty)
+        {
+            SendUpdate(context, target, peer->GetReliableOutBuffer(), peer->GetReliableCallbackBuffer(), ReplicaMarshalFlags::Authoritative | ReplicaMarshalFlags::Reliable | ReplicaMarshalFlags::IncludeDatasets, reliableCache);
+        }
+
+        if (pdr.m_isDownstreamUnreliableDirty)
+        {
+            SendUpdate(context, target, peer->GetUnreliableOutBuffer(), peer->GetUnreliableCallbackBuffer(), ReplicaMarshalFlags::Authoritative | ReplicaMarshalFlags::IncludeDatasets, unreliableCache, target.GetRevision());
+        }
+    }
+    //-----------------------------------------------------------------------------
+    void ReplicaMarshalTask::SendUpdate(const RunContext& context, ReplicaTarget& target, WriteBuffer& buffer, CallbackBuffer& callback, AZ::u32 flags, ReplicaMarshalCache& cache, AZ::u64 peerLatestVersionAckd)
+    {
+        OnSendReplicaBegin();
+
+        //Marshall the Replica
+        MarshalContext marshalContext(flags, &buffer, &callback, ReplicaContext(context.m_replicaManager, context.m_replicaManager->GetTime(), target.GetPeer()), peerLatestVersionAckd, &target);
+        marshalContext.m_cache = &cache;
+        const size_t bufferOffsetStart = buffer.Size();
+        m_replica->Marshal(marshalContext);
+        const size_t bytesWritten = buffer.Size() - bufferOffsetStart;
+
+        OnSendReplicaEnd(target.GetPeer(), buffer.Get() + bufferOffsetStart, bytesWritten);
+    }
 } // namespace GridMate
 
 #endif // AZ_UNITY_BUILD
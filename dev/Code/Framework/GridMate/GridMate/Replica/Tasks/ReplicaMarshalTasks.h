@@ -55,6 +55,14 @@ namespace GridMate
         ReplicaMarshalTask(ReplicaPtr replica);
 
         TaskStatus Run(const RunContext& context) override;
+
+    private:
+        // Marshals the replica updates to every target in m_updateTargets, on jobs if there are enough of them
+        void MarshalUpdates(const RunContext& context, const PrepareDataResult& pdr);
+        void MarshalUpdate(const RunContext& context, ReplicaTarget& target, const PrepareDataResult& pdr, ReplicaMarshalCache& reliableCache, ReplicaMarshalCache& unreliableCache);
+        void SendUpdate(const RunContext& context, ReplicaTarget& target, WriteBuffer& buffer, CallbackBuffer& callback, AZ::u32 flags, ReplicaMarshalCache& cache, AZ::u64 peerLatestVersionAckd = 0);
+
+        vector<ReplicaTarget*> m_updateTargets;
     };
 
     /**
@@ -114,6 +114,54 @@ namespace GridMate
             task.SetPriority(pri);
         }
     };
+
+    /**
+    *  Priority policy used for bandwidth limited marshaling
+    *  Every target peer of a replica accumulates priority each frame the replica's task is postponed, proportionally to
+    *  the replica's user defined priority and the replica's relevance to the peer (see ReplicaTarget::SetRelevance).
+    *  The accumulated priority is dropped once the task is processed. The task is prioritized by its most starved target,
+    *  so relevant replicas that were not sent for a while go first. Real-time replicas always have the highest priority.
+    *  Arranges tasks in descending order, same as SendPriorityPolicy.
+    */
+    class AccumulatedPriorityPolicy
+    {
+    public:
+        typedef SendPriorityPolicy::Compare Compare;
+
+        static void UpdatePriority(ReplicaTask& task)
+        {
+            ReplicaPtr rep = task.GetReplica();
+
+            // queued or just processed tasks start over, postponed ones keep accumulating
+            const bool isPostponed = task.GetAge() > 0;
+            const float basePriority = static_cast<float>(rep->GetPriority()) + 1.f;
+            float taskPriority = 0.f;
+            for (ReplicaTarget& target : rep->m_targets)
+            {
+                if (!isPostponed)
+                {
+                    target.m_accumulatedPriority = 0.f;
+                }
+                target.m_accumulatedPriority += basePriority * target.GetRelevance();
+                taskPriority = AZStd::GetMax(taskPriority, target.m_accumulatedPriority);
+            }
+
+            if (rep->m_targets.begin() == rep->m_targets.end()) // only sending upstream
+            {
+                taskPriority = basePriority * (task.GetAge() + 1);
+            }
+
+            static const float k_maxAccumulatedPriority = static_cast<float>(0xffffff00u);
+            AZ::u32 accumulated = rep->GetPriority() == k_replicaPriorityRealTime ? 0xffffffffu : static_cast<AZ::u32>(AZStd::GetMin(taskPriority, k_maxAccumulatedPriority));
+
+            static_assert(sizeof(AZ::u32) == sizeof(rep->GetCreateTime()), "CreateTime cannot fit in 32 bits!");
+
+            AZ::u64 pri = static_cast<AZ::u32>(~rep->GetCreateTime()); // put creation time in lower bits
+            pri |= static_cast<AZ::u64>(accumulated) << 32; // put accumulated priority into the upper bits
+
+            task.SetPriority(pri);
+        }
+    };
 } // namespace GridMate
 
 #endif // GM_REPLICA_PRIORITY_POLICY_H
@@ -11,6 +11,7 @@
 */
 #include <GridMate/Replica/Tasks/ReplicaProcessPolicy.h>
 #include <GridMate/Replica/ReplicaMgr.h>
+#include <GridMate/Carrier/Carrier.h>
 
 #include <AzCore/Math/MathUtils.h>
 
@@ -98,4 +99,118 @@ namespace GridMate
 
         return shouldProcess;
     }
+
+    void BandwidthProcessPolicy::BeginFrame(ReplicaTask::RunContext& ctx)
+    {
+        ReplicaManager* rm = ctx.m_replicaManager;
+        AZStd::chrono::system_clock::time_point now(AZStd::chrono::system_clock::now());
+        float dt = AZStd::chrono::milliseconds(now - m_lastCheckTime).count() / k_secToMilli;
+        AZ_Assert(dt >= 0.0f, "Frame duration < 0 seconds.");
+
+        if (m_lastCheckTime.time_since_epoch() == AZStd::chrono::milliseconds::zero()) // clamping first frame
+        {
+            dt = k_initialDt;
+        }
+
+        m_lastCheckTime = now;
+
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(rm->m_mutexRemotePeers);
+
+        for (ReplicaPeer* peer : rm->m_remotePeers)
+        {
+            if (peer->GetConnectionId() == InvalidConnectionID)
+            {
+                continue;
+            }
+
+            // Updating averages
+            peer->m_dataSentLastSecond.Update(dt, peer->m_sentBytes);
+            peer->m_avgSendRateBurst += (peer->m_dataSentLastSecond.GetSum() - peer->m_avgSendRateBurst) * (dt / rm->GetSendLimitBurstRange());
+
+            peer->m_sendLimit = GetPeerSendLimit(rm, peer);
+            if (!peer->m_sendLimit)
+            {
+                peer->m_sendBytesAllowed = 0;
+            }
+            else if (dt >= 1.0f)
+            {
+                peer->m_sendBytesAllowed = static_cast<int>(peer->m_sendLimit); // frame processing took >= one second, so reset the budget
+            }
+            else
+            {
+                // carry over what was not used last frame, the budget never exceeds one second worth of data
+                const float carryOver = static_cast<float>(peer->m_sendBytesAllowed - peer->m_sentBytes);
+                const float allow = AZStd::GetMin(carryOver + peer->m_sendLimit * dt, static_cast<float>(peer->m_sendLimit));
+                peer->m_sendBytesAllowed = static_cast<int>(AZStd::GetMax(allow, 0.f));
+            }
+
+            peer->m_sentBytes = 0;
+        }
+    }
+
+    bool BandwidthProcessPolicy::ShouldProcess(ReplicaTask::RunContext& ctx, ReplicaTask& task)
+    {
+        ReplicaManager* rm = ctx.m_replicaManager;
+        if (!rm->GetSendLimit() && !rm->m_cfg.m_sendLimitFromTrafficControl) // no limiter set
+        {
+            return true;
+        }
+
+        const ReplicaPtr& replica = task.GetReplica();
+
+        if (replica->GetPriority() == k_replicaPriorityRealTime) // real-time traffic is never postponed
+        {
+            return true;
+        }
+
+        for (ReplicaTarget& target : replica->m_targets)
+        {
+            if (HasSendBudget(target.GetPeer()))
+            {
+                return true;
+            }
+        }
+
+        if (replica->m_upstreamHop && replica->m_upstreamHop != &rm->m_self)
+        {
+            return HasSendBudget(replica->m_upstreamHop);
+        }
+
+        return false;
+    }
+
+    unsigned int BandwidthProcessPolicy::GetPeerSendLimit(ReplicaManager* rm, ReplicaPeer* peer)
+    {
+        unsigned int sendLimit = rm->GetSendLimit();
+        if (sendLimit && peer->m_newTargetCount && rm->m_cfg.m_initialStateSendLimitScale > 1.f)
+        {
+            // the peer is still receiving its initial state, let it through faster than the steady state updates
+            const float scaledLimit = AZStd::GetMin(sendLimit * rm->m_cfg.m_initialStateSendLimitScale, static_cast<float>(0x7fffffff));
+            sendLimit = static_cast<unsigned int>(scaledLimit);
+        }
+
+        if (!rm->m_cfg.m_sendLimitFromTrafficControl || !rm->m_cfg.m_carrier)
+        {
+            return sendLimit;
+        }
+
+        TrafficControl::Statistics lifetime;
+        Carrier::FlowInformation flowInformation;
+        if (rm->m_cfg.m_carrier->QueryStatistics(peer->GetConnectionId(), nullptr, &lifetime, nullptr, nullptr, &flowInformation) != Carrier::CST_CONNECTED
+            || !flowInformation.m_congestionWindow)
+        {
+            return sendLimit; // the traffic control does not measure this connection
+        }
+
+        // same estimate the carrier uses for rate updates: a congestion window per round trip, with a conservative rtt until it is known
+        const float rtt = lifetime.m_rtt > 1.f ? lifetime.m_rtt : 100.f;
+        const float measuredRate = AZStd::GetMin(flowInformation.m_congestionWindow * k_secToMilli / rtt, static_cast<float>(0x7fffffff));
+        const unsigned int measuredLimit = AZStd::GetMax(static_cast<unsigned int>(measuredRate), 1u);
+        return sendLimit ? AZStd::GetMin(sendLimit, measuredLimit) : measuredLimit;
+    }
+
+    bool BandwidthProcessPolicy::HasSendBudget(const ReplicaPeer* peer)
+    {
+        return !peer->m_sendLimit || peer->m_sentBytes < peer->m_sendBytesAllowed;
+    }
 }
\ No newline at end of file
@@ -43,6 +43,27 @@ namespace GridMate
     private:
         AZStd::chrono::system_clock::time_point m_lastCheckTime;
     };
+
+    /**
+    *  Process policy that gives every peer a byte budget per frame and processes tasks while any of their target peers
+    *  (or the upstream peer) has budget left. The budget of a peer is derived from the send limit set on the replica manager
+    *  and, if ReplicaMgrDesc::m_sendLimitFromTrafficControl is set, from the bandwidth the traffic control measures for
+    *  the peer's connection, whichever is lower. Combined with a priority policy, the most important updates are sent first
+    *  when a connection is congested.
+    */
+    class BandwidthProcessPolicy
+    {
+    public:
+        void BeginFrame(ReplicaTask::RunContext& ctx);
+        void EndFrame(ReplicaTask::RunContext& ctx) { (void)ctx; }
+        bool ShouldProcess(ReplicaTask::RunContext& ctx, ReplicaTask& task);
+
+    private:
+        static unsigned int GetPeerSendLimit(ReplicaManager* rm, ReplicaPeer* peer);
+        static bool HasSendBudget(const ReplicaPeer* peer);
+
+        AZStd::chrono::system_clock::time_point m_lastCheckTime;
+    };
 } // namespace GridMate
 
 #endif // GM_REPLICA_PROCESS_POLICY_H
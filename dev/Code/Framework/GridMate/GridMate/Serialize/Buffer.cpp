@@ -54,7 +54,7 @@ namespace GridMate
         else
         {
             // The hard case - bit shift each byte of the stored data.
-            for (AZ::u64 i = 0; i < dataSize; ++i, m_read.IncrementBytes(1))
+            for (AZ::u64 i = 0; i < dataSize.GetBytes(); ++i, m_read.IncrementBytes(1))
             {
                 /*
                 * Given the first byte is D1[1234 5678] and next byte is D2[1234 5678] and the current bit offset is 3,
@@ -75,6 +75,20 @@ namespace GridMate
                 AZ::u8* outLocation = reinterpret_cast<AZ::u8*>(data) + i;
                 memcpy(outLocation, &combinedValue, 1);
             }
+
+            if (dataSize.GetAdditionalBits() > 0)
+            {
+                // The remaining bits, they only span the next byte when they don't fit in the current one.
+                AZ::u8 combinedValue = GetRawByte() >> GetBitOffset();
+                if (GetBitOffset() + dataSize.GetAdditionalBits() > CHAR_BIT)
+                {
+                    combinedValue |= GetNextRawByte() << (CHAR_BIT - GetBitOffset());
+                }
+
+                AZ::u8* outLocation = reinterpret_cast<AZ::u8*>(data) + dataSize.GetBytes();
+                memcpy(outLocation, &combinedValue, 1);
+                m_read.IncrementBits(dataSize.GetAdditionalBits());
+            }
         }
 
         if (dataSize.GetAdditionalBits() > 0)
@@ -178,7 +192,8 @@ namespace GridMate
                     part[0] = GetRawByte() | (inputByte << GetBitOffset()); // Do take into account the current value in the byte.
                     part[1] = (inputByte >> (CHAR_BIT - GetBitOffset())); // Grab the remaining most significant digits
 
-                    memcpy(GetRawBytePtr(), &part[0], sizeof(part) / sizeof(part[0]));
+                    // The second byte is only touched when the bits don't fit in the current one, it can be past the capacity otherwise.
+                    memcpy(GetRawBytePtr(), &part[0], GetBitOffset() + dataSize.GetAdditionalBits() > CHAR_BIT ? 2 : 1);
 
                     m_size.IncrementBits(dataSize.GetAdditionalBits());
                 }
@@ -541,6 +541,237 @@ void TransformCompressor::Unmarshal(AZ::Transform& value, ReadBuffer& rb) const
     value = xform;
 }
 
+namespace
+{
+    // bytes are passed least significant first, so the bit layout doesn't depend on the platform endianness
+    void WriteQuantizedBits(WriteBuffer& wb, AZ::u32 value, AZ::u8 numBits)
+    {
+        AZ::u8 bytes[4] = { static_cast<AZ::u8>(value), static_cast<AZ::u8>(value >> 8), static_cast<AZ::u8>(value >> 16), static_cast<AZ::u8>(value >> 24) };
+        wb.WriteRaw(bytes, PackedSize(0, numBits));
+    }
+
+    AZ::u32 ReadQuantizedBits(ReadBuffer& rb, AZ::u8 numBits)
+    {
+        AZ::u8 bytes[4] = { 0, 0, 0, 0 };
+        rb.ReadRaw(bytes, PackedSize(0, numBits));
+        return static_cast<AZ::u32>(bytes[0]) | (static_cast<AZ::u32>(bytes[1]) << 8) | (static_cast<AZ::u32>(bytes[2]) << 16) | (static_cast<AZ::u32>(bytes[3]) << 24);
+    }
+
+    const float k_smallestThreeRange = 0.7071068f; // 1/sqrt(2), the largest value a component other than the largest can have
+}
+
+//=========================================================================
+// QuantizedFloatMarshaler
+//=========================================================================
+QuantizedFloatMarshaler::QuantizedFloatMarshaler(float rangeMin, float rangeMax, AZ::u8 numBits)
+    : m_min(rangeMin)
+    , m_range(rangeMax - rangeMin)
+    , m_maxQuantized(static_cast<double>((static_cast<AZ::u64>(1) << numBits) - 1))
+    , m_numBits(numBits)
+{
+    AZ_Assert(rangeMax > rangeMin, "rangeMax MUST be > than rangeMin");
+    AZ_Assert(numBits > 0 && numBits <= 32, "Quantized values use 1 to 32 bits!");
+}
+
+//=========================================================================
+// QuantizedFloatMarshaler::Marshal
+//=========================================================================
+void
+QuantizedFloatMarshaler::Marshal(WriteBuffer& wb, float value) const
+{
+    double quantized = AZ::GetClamp(m_maxQuantized * (value - m_min) / m_range + 0.5, 0.0, m_maxQuantized);
+    WriteQuantizedBits(wb, static_cast<AZ::u32>(quantized), m_numBits);
+}
+
+//=========================================================================
+// QuantizedFloatMarshaler::Unmarshal
+//=========================================================================
+void
+QuantizedFloatMarshaler::Unmarshal(float& f, ReadBuffer& rb) const
+{
+    AZ::u32 quantized = ReadQuantizedBits(rb, m_numBits);
+    f = AZ::GetClamp(m_min + static_cast<float>(quantized / m_maxQuantized) * m_range, m_min, m_min + m_range);
+}
+
+//=========================================================================
+// QuantizedVec3Marshaler
+//=========================================================================
+QuantizedVec3Marshaler::QuantizedVec3Marshaler(const AZ::Vector3& rangeMin, const AZ::Vector3& rangeMax, AZ::u8 numBitsPerAxis)
+    : QuantizedVec3Marshaler(rangeMin, rangeMax, numBitsPerAxis, numBitsPerAxis, numBitsPerAxis)
+{
+}
+
+QuantizedVec3Marshaler::QuantizedVec3Marshaler(const AZ::Vector3& rangeMin, const AZ::Vector3& rangeMax, AZ::u8 numBitsX, AZ::u8 numBitsY, AZ::u8 numBitsZ)
+    : m_x(rangeMin.GetX(), rangeMax.GetX(), numBitsX)
+    , m_y(rangeMin.GetY(), rangeMax.GetY(), numBitsY)
+    , m_z(rangeMin.GetZ(), rangeMax.GetZ(), numBitsZ)
+{
+}
+
+//=========================================================================
+// QuantizedVec3Marshaler::Marshal
+//=========================================================================
+void
+QuantizedVec3Marshaler::Marshal(WriteBuffer& wb, const AZ::Vector3& vec) const
+{
+    m_x.Marshal(wb, vec.GetX());
+    m_y.Marshal(wb, vec.GetY());
+    m_z.Marshal(wb, vec.GetZ());
+}
+
+//=========================================================================
+// QuantizedVec3Marshaler::Unmarshal
+//=========================================================================
+void
+QuantizedVec3Marshaler::Unmarshal(AZ::Vector3& vec, ReadBuffer& rb) const
+{
+    float x, y, z;
+    m_x.Unmarshal(x, rb);
+    m_y.Unmarshal(y, rb);
+    m_z.Unmarshal(z, rb);
+    vec.Set(x, y, z);
+}
+
+//=========================================================================
+// QuatSmallestThreeMarshaler
+//=========================================================================
+QuatSmallestThreeMarshaler::QuatSmallestThreeMarshaler(AZ::u8 numBitsPerComponent)
+    : m_component(-k_smallestThreeRange, k_smallestThreeRange, numBitsPerComponent)
+{
+}
+
+//=========================================================================
+// QuatSmallestThreeMarshaler::Marshal
+//=========================================================================
+void
+QuatSmallestThreeMarshaler::Marshal(WriteBuffer& wb, const AZ::Quaternion& norQuat) const
+{
+    AZ_Assert(norQuat.GetLengthSq().IsClose(AZ::VectorFloat::CreateOne()), "Input quaternion is not normalized!");
+
+    float values[4];
+    norQuat.StoreToFloat4(values);
+
+    AZ::u32 largest = 0;
+    for (AZ::u32 i = 1; i < 4; ++i)
+    {
+        if (fabsf(values[i]) > fabsf(values[largest]))
+        {
+            largest = i;
+        }
+    }
+
+    // q and -q are the same rotation, flip so the dropped component is positive
+    const float sign = values[largest] < 0.0f ? -1.0f : 1.0f;
+
+    WriteQuantizedBits(wb, largest, 2);
+    for (AZ::u32 i = 0; i < 4; ++i)
+    {
+        if (i != largest)
+        {
+            m_component.Marshal(wb, values[i] * sign);
+        }
+    }
+}
+
+//=========================================================================
+// QuatSmallestThreeMarshaler::Unmarshal
+//=========================================================================
+void
+QuatSmallestThreeMarshaler::Unmarshal(AZ::Quaternion& quat, ReadBuffer& rb) const
+{
+    float values[4];
+    AZ::u32 largest = ReadQuantizedBits(rb, 2);
+    float sumOfSquares = 0.0f;
+    for (AZ::u32 i = 0; i < 4; ++i)
+    {
+        if (i != largest)
+        {
+            m_component.Unmarshal(values[i], rb);
+            sumOfSquares += values[i] * values[i];
+        }
+    }
+    values[largest] = sqrtf(AZ::GetMax(0.0f, 1.0f - sumOfSquares));
+
+    quat = AZ::Quaternion::CreateFromFloat4(values);
+    quat.Normalize();
+}
+
+//=========================================================================
+// QuantizedTransformMarshaler
+//=========================================================================
+QuantizedTransformMarshaler::QuantizedTransformMarshaler(const AZ::Vector3& positionMin, const AZ::Vector3& positionMax, AZ::u8 positionBitsPerAxis, AZ::u8 rotationBitsPerComponent)
+    : m_position(positionMin, positionMax, positionBitsPerAxis)
+    , m_rotation(rotationBitsPerComponent)
+{
+}
+
+//=========================================================================
+// QuantizedTransformMarshaler::Marshal
+//=========================================================================
+void
+QuantizedTransformMarshaler::Marshal(WriteBuffer& wb, const AZ::Transform& value) const
+{
+    AZ::Matrix3x3 m33 = AZ::Matrix3x3::CreateFromTransform(value);
+    AZ::Vector3 scale = m33.ExtractScale();
+    AZ::Quaternion rot = AZ::Quaternion::CreateFromMatrix3x3(m33.GetOrthogonalized());
+    AZ::Vector3 pos = value.GetTranslation();
+
+    const bool hasRot = !rot.IsIdentity();
+    const bool hasScale = !scale.GetX().IsClose(AZ::VectorFloat::CreateOne()) || !scale.GetY().IsClose(AZ::VectorFloat::CreateOne()) || !scale.GetZ().IsClose(AZ::VectorFloat::CreateOne());
+    const bool hasPos = !pos.IsZero();
+
+    wb.WriteRawBit(hasRot);
+    wb.WriteRawBit(hasScale);
+    wb.WriteRawBit(hasPos);
+    if (hasRot)
+    {
+        m_rotation.Marshal(wb, rot.GetNormalized());
+    }
+    if (hasScale)
+    {
+        wb.Write(scale, Vec3CompMarshaler());
+    }
+    if (hasPos)
+    {
+        m_position.Marshal(wb, pos);
+    }
+}
+
+//=========================================================================
+// QuantizedTransformMarshaler::Unmarshal
+//=========================================================================
+void
+QuantizedTransformMarshaler::Unmarshal(AZ::Transform& value, ReadBuffer& rb) const
+{
+    bool hasRot = false;
+    bool hasScale = false;
+    bool hasPos = false;
+    rb.ReadRawBit(hasRot);
+    rb.ReadRawBit(hasScale);
+    rb.ReadRawBit(hasPos);
+
+    AZ::Transform xform = AZ::Transform::CreateIdentity();
+    if (hasRot)
+    {
+        AZ::Quaternion rot;
+        m_rotation.Unmarshal(rot, rb);
+        xform.SetRotationPartFromQuaternion(rot);
+    }
+    if (hasScale)
+    {
+        AZ::Vector3 scale;
+        rb.Read(scale, Vec3CompMarshaler());
+        xform.MultiplyByScale(scale);
+    }
+    if (hasPos)
+    {
+        AZ::Vector3 pos;
+        m_position.Unmarshal(pos, rb);
+        xform.SetTranslation(pos);
+    }
+    value = xform;
+}
+
 //=========================================================================
 // Float16Marshaler::Marshal
 //=========================================================================
@@ -211,6 +211,95 @@ namespace GridMate
         void Unmarshal(AZ::Transform& value, ReadBuffer& rb) const;
     };
 
+    /**
+    * Quantizes a float in a range to a fixed point value of [1..32] bits.
+    * Values are written at bit granularity, so consecutive quantized values share bytes.
+    * The precision is (rangeMax - rangeMin) / (2^numBits - 1), for example 16 bits over 1000 meters
+    * is about 1.5cm. Values outside the range are clamped.
+    */
+    class QuantizedFloatMarshaler
+    {
+    public:
+        typedef float DataType;
+
+        QuantizedFloatMarshaler(float rangeMin, float rangeMax, AZ::u8 numBits);
+
+        void Marshal(WriteBuffer& wb, float value) const;
+        void Unmarshal(float& f, ReadBuffer& rb) const;
+
+        AZ::u8 GetNumBits() const { return m_numBits; }
+
+    private:
+        float m_min;
+        float m_range;
+        double m_maxQuantized;
+        AZ::u8 m_numBits;
+    };
+
+    /**
+    * Writes a vector quantized with \ref QuantizedFloatMarshaler, with a bounded range and precision per axis.
+    * Use it for positions within known world bounds.
+    */
+    class QuantizedVec3Marshaler
+    {
+    public:
+        typedef AZ::Vector3 DataType;
+
+        QuantizedVec3Marshaler(const AZ::Vector3& rangeMin, const AZ::Vector3& rangeMax, AZ::u8 numBitsPerAxis);
+        QuantizedVec3Marshaler(const AZ::Vector3& rangeMin, const AZ::Vector3& rangeMax, AZ::u8 numBitsX, AZ::u8 numBitsY, AZ::u8 numBitsZ);
+
+        void Marshal(WriteBuffer& wb, const AZ::Vector3& vec) const;
+        void Unmarshal(AZ::Vector3& vec, ReadBuffer& rb) const;
+
+    private:
+        QuantizedFloatMarshaler m_x;
+        QuantizedFloatMarshaler m_y;
+        QuantizedFloatMarshaler m_z;
+    };
+
+    /**
+    * Writes a normalized quaternion with the smallest three encoding.
+    * The largest component is dropped and rebuilt from the unit length, which leaves three components in
+    * [-1/sqrt(2), 1/sqrt(2)] that are quantized with numBitsPerComponent each, plus 2 bits for the index
+    * of the dropped component. The default 10 bits per component uses 32 bits in total, with a maximum error
+    * well under 0.1 degrees.
+    */
+    class QuatSmallestThreeMarshaler
+    {
+    public:
+        typedef AZ::Quaternion DataType;
+
+        explicit QuatSmallestThreeMarshaler(AZ::u8 numBitsPerComponent = 10);
+
+        void Marshal(WriteBuffer& wb, const AZ::Quaternion& norQuat) const;
+        void Unmarshal(AZ::Quaternion& quat, ReadBuffer& rb) const;
+
+    private:
+        QuantizedFloatMarshaler m_component;
+    };
+
+    /**
+    * Bit packed Transform marshaler.
+    * Uses 3 bits to describe marshaled components, like \ref TransformCompressor.
+    * If present, rotation uses \ref QuatSmallestThreeMarshaler.
+    * If present, scale uses 6 bytes.
+    * If present, position uses \ref QuantizedVec3Marshaler with the provided bounds.
+    */
+    class QuantizedTransformMarshaler
+    {
+    public:
+        typedef AZ::Transform DataType;
+
+        QuantizedTransformMarshaler(const AZ::Vector3& positionMin, const AZ::Vector3& positionMax, AZ::u8 positionBitsPerAxis, AZ::u8 rotationBitsPerComponent = 10);
+
+        void Marshal(WriteBuffer& wb, const AZ::Transform& value) const;
+        void Unmarshal(AZ::Transform& value, ReadBuffer& rb) const;
+
+    private:
+        QuantizedVec3Marshaler m_position;
+        QuatSmallestThreeMarshaler m_rotation;
+    };
+
     /**
     * Integer Quantizer to quantize an Integer value.
     * Uses unsigned 8, 16 or 32 bits to represent Quantized value.
@@ -23,13 +23,17 @@
 #include "Carrier/DefaultSimulator.cpp"
 #include "Carrier/DefaultTrafficControl.cpp"
 #include "Carrier/DefaultHandshake.cpp"
+#include "Carrier/ZLibCompressor.cpp"
 #include "Replica/DataSet.cpp"
 #include "Replica/Replica.cpp"
 #include "Replica/ReplicaChunk.cpp"
 #include "Replica/ReplicaChunkDescriptor.cpp"
+#include "Replica/ReplicaCapture.cpp"
 #include "Replica/ReplicaMgr.cpp"
+#include "Replica/ReplicaReplay.cpp"
 #include "Replica/ReplicaStatus.cpp"
 #include "Replica/ReplicaUtils.cpp"
+#include "Replica/SnapshotDeltaDataSet.cpp"
 #include "Replica/RemoteProcedureCall.cpp"
 #include "Replica/Tasks/ReplicaMarshalTasks.cpp"
 #include "Replica/Tasks/ReplicaUpdateTasks.cpp"
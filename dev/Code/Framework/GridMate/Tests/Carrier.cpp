@@ -16,6 +16,7 @@
 #include <GridMate/Carrier/SocketDriver.h>
 #include <GridMate/Carrier/SecureSocketDriver.h>
 #include <GridMate/Carrier/DefaultHandshake.h>
+#include <GridMate/Carrier/ZLibCompressor.h>
 #include <AzCore/std/string/memorytoascii.h>
 
 #if defined(AZ_PLATFORM_WINDOWS)
@@ -1544,6 +1545,55 @@ namespace UnitTest
         //AZStd::shared_ptr<ACKCallback> m_callback;
     };
 
+    class CarrierZLibCompressorTest
+        : public GridMateMPTestFixture
+    {
+    public:
+        void run()
+        {
+            const char payload[] = "ReplicaUpdate pos=1.0,2.0,3.0 rot=0,0,0,1 health=100 ReplicaUpdate pos=1.5,2.0,3.0 rot=0,0,0,1 health=100";
+            ZLibCompressor::Dictionary dictionary(&payload[0], &payload[0] + sizeof(payload));
+
+            ZLibCompressorFactory plainFactory(1);
+            ZLibCompressorFactory dictionaryFactory(1, dictionary);
+            AZStd::shared_ptr<Compressor> plain = plainFactory.CreateCompressor();
+            AZStd::shared_ptr<Compressor> withDictionary = dictionaryFactory.CreateCompressor();
+            AZStd::shared_ptr<Compressor> peer = dictionaryFactory.CreateCompressor();
+            AZ_TEST_ASSERT(plain->Init() && withDictionary->Init() && peer->Init());
+
+            // the dictionary is part of the settings that must match on both peers
+            AZ_TEST_ASSERT(plain->GetType() != withDictionary->GetType());
+            AZ_TEST_ASSERT(peer->GetType() == withDictionary->GetType());
+
+            char compressed[256];
+            char decompressed[256];
+            size_t plainSize = 0;
+            size_t dictionarySize = 0;
+            AZ_TEST_ASSERT(plain->GetMaxCompressedBufferSize(sizeof(payload)) <= sizeof(compressed));
+            AZ_TEST_ASSERT(plain->Compress(payload, sizeof(payload), compressed, sizeof(compressed), plainSize) == CompressorError::Ok);
+            AZ_TEST_ASSERT(withDictionary->Compress(payload, sizeof(payload), compressed, sizeof(compressed), dictionarySize) == CompressorError::Ok);
+            AZ_TEST_ASSERT(dictionarySize < plainSize);
+
+            // every datagram is decompressed on its own, so it can be repeated
+            for (int i = 0; i < 2; ++i)
+            {
+                size_t consumedSize = 0;
+                size_t uncompSize = 0;
+                AZ_TEST_ASSERT(peer->Decompress(compressed, dictionarySize, decompressed, sizeof(decompressed), consumedSize, uncompSize) == CompressorError::Ok);
+                AZ_TEST_ASSERT(consumedSize == dictionarySize);
+                AZ_TEST_ASSERT(uncompSize == sizeof(payload));
+                AZ_TEST_ASSERT(memcmp(payload, decompressed, sizeof(payload)) == 0);
+            }
+
+            // truncated datagrams are rejected
+            {
+                size_t consumedSize = 0;
+                size_t uncompSize = 0;
+                AZ_TEST_ASSERT(peer->Decompress(compressed, dictionarySize / 2, decompressed, sizeof(decompressed), consumedSize, uncompSize) != CompressorError::Ok);
+            }
+        }
+    };
+
     //Create specific tests
     using CarrierBasicTest = CarrierBasicTestTemplate<>;
     using CarrierTest = CarrierTestTemplate<>;
@@ -1692,6 +1742,7 @@ GM_TEST(Integ_CarrierMultiStressTest)
 GM_TEST(Integ_CarrierMultiChannelTest)
 GM_TEST(Integ_CarrierBackpressureTest)
 GM_TEST(Integ_CarrierACKTest)
+GM_TEST(CarrierZLibCompressorTest)
 
 
 #if defined(AZ_TESTS_ENABLED) && defined(TEST_WITH_SECURE_SOCKET_DRIVER)
@@ -573,6 +573,7 @@ namespace GridMate
 #else
 // Optimized spatial handler.
 #include "GridMate/Replica/Interest/ProximityInterestHandler.h"
+#include "GridMate/Replica/Interest/SpatialHashInterestHandler.h"
 #endif
 
 namespace UnitTest {
@@ -1814,10 +1815,257 @@ public:
     }
 };
 
+class SpatialHashHandlerTests
+    : public GridMateMPTestFixture
+{
+public:
+    static AZ::Aabb CreateBox(float x, float y, float z, float size)
+    {
+        const AZ::Vector3 min(x, y, z);
+        return AZ::Aabb::CreateFromMinMax(min, min + AZ::Vector3::CreateOne() * size);
+    }
+
+    static void run()
+    {
+        SimpleFirstUpdate();
+        SecondUpdateAfterNoChanges();
+        AttributeMovingAcrossCells();
+        RuleMovingAndAttributeIsOut();
+        RulesFromSamePeer();
+        OversizedRule();
+        RuleDestroyed();
+        AttributeDestroyed();
+    }
+
+    static void SimpleFirstUpdate()
+    {
+        AZStd::unique_ptr<SpatialHashInterestHandler> handler(aznew SpatialHashInterestHandler(16.f));
+
+        auto attribute1 = handler->CreateAttribute(1);
+        attribute1->Set(CreateBox(0, 0, 0, 10));
+
+        auto attribute2 = handler->CreateAttribute(2);
+        attribute2->Set(CreateBox(-1000, 0, 0, 10));
+
+        auto rule1 = handler->CreateRule(100);
+        rule1->Set(CreateBox(0, 0, 0, 40));
+
+        handler->Update();
+        InterestMatchResult results = handler->GetLastResult();
+
+        AZ_TEST_ASSERT(results.size() == 2);
+        AZ_TEST_ASSERT(results[1].size() == 1);
+        AZ_TEST_ASSERT(results[1].find(100) != results[1].end());
+        AZ_TEST_ASSERT(results[2].size() == 0);
+    }
+
+    static void SecondUpdateAfterNoChanges()
+    {
+        AZStd::unique_ptr<SpatialHashInterestHandler> handler(aznew SpatialHashInterestHandler(16.f));
+
+        auto attribute1 = handler->CreateAttribute(1);
+        attribute1->Set(CreateBox(0, 0, 0, 10));
+
+        auto rule1 = handler->CreateRule(100);
+        rule1->Set(CreateBox(0, 0, 0, 40));
+
+        handler->Update();
+        handler->Update();
+        AZ_TEST_ASSERT(handler->GetLastResult().size() == 0);
+
+        // setting the same values again doesn't change the match
+        attribute1->Set(CreateBox(0, 0, 0, 10));
+        rule1->Set(CreateBox(0, 0, 0, 40));
+        handler->Update();
+        AZ_TEST_ASSERT(handler->GetLastResult().size() == 0);
+    }
+
+    static void AttributeMovingAcrossCells()
+    {
+        AZStd::unique_ptr<SpatialHashInterestHandler> handler(aznew SpatialHashInterestHandler(16.f));
+
+        auto attribute1 = handler->CreateAttribute(1);
+        attribute1->Set(CreateBox(0, 0, 0, 4));
+
+        auto rule1 = handler->CreateRule(100);
+        rule1->Set(CreateBox(0, 0, 0, 40));
+
+        handler->Update();
+        InterestMatchResult results = handler->GetLastResult();
+        AZ_TEST_ASSERT(results[1].size() == 1);
+
+        // moves to other cells, still inside the rule
+        attribute1->Set(CreateBox(30, 30, 30, 4));
+        handler->Update();
+        AZ_TEST_ASSERT(handler->GetLastResult().size() == 0);
+
+        // in a cell the rule covers, but outside of the rule itself
+        attribute1->Set(CreateBox(44, 44, 44, 2));
+        handler->Update();
+        results = handler->GetLastResult();
+        AZ_TEST_ASSERT(results.size() == 1);
+        AZ_TEST_ASSERT(results[1].size() == 0);
+
+        // and back in, across negative coordinates
+        attribute1->Set(CreateBox(-10, -10, -10, 12));
+        handler->Update();
+        results = handler->GetLastResult();
+        AZ_TEST_ASSERT(results.size() == 1);
+        AZ_TEST_ASSERT(results[1].size() == 1);
+    }
+
+    static void RuleMovingAndAttributeIsOut()
+    {
+        AZStd::unique_ptr<SpatialHashInterestHandler> handler(aznew SpatialHashInterestHandler(16.f));
+
+        auto attribute1 = handler->CreateAttribute(1);
+        attribute1->Set(CreateBox(0, 0, 0, 10));
+
+        auto attribute2 = handler->CreateAttribute(2);
+        attribute2->Set(CreateBox(1000, 0, 0, 10));
+
+        auto rule1 = handler->CreateRule(100);
+        rule1->Set(CreateBox(0, 0, 0, 40));
+
+        handler->Update();
+        InterestMatchResult results = handler->GetLastResult();
+        AZ_TEST_ASSERT(results[1].size() == 1);
+        AZ_TEST_ASSERT(results[2].size() == 0);
+
+        // the rule moves from attribute1 to attribute2
+        rule1->Set(CreateBox(1000, 0, 0, 40));
+
+        handler->Update();
+        results = handler->GetLastResult();
+        AZ_TEST_ASSERT(results.size() == 2);
+        AZ_TEST_ASSERT(results[1].size() == 0);
+        AZ_TEST_ASSERT(results[2].size() == 1);
+        AZ_TEST_ASSERT(results[2].find(100) != results[2].end());
+    }
+
+    static void RulesFromSamePeer()
+    {
+        AZStd::unique_ptr<SpatialHashInterestHandler> handler(aznew SpatialHashInterestHandler(16.f));
+
+        auto attribute1 = handler->CreateAttribute(1);
+        attribute1->Set(CreateBox(0, 0, 0, 10));
+
+        auto rule1 = handler->CreateRule(100);
+        rule1->Set(CreateBox(0, 0, 0, 20));
+        auto rule2 = handler->CreateRule(100);
+        rule2->Set(CreateBox(5, 5, 5, 20));
+        auto rule3 = handler->CreateRule(200);
+        rule3->Set(CreateBox(-5, -5, -5, 20));
+
+        handler->Update();
+        InterestMatchResult results = handler->GetLastResult();
+        AZ_TEST_ASSERT(results[1].size() == 2);
+        AZ_TEST_ASSERT(results[1].find(100) != results[1].end());
+        AZ_TEST_ASSERT(results[1].find(200) != results[1].end());
+
+        // the peer is still interested through its other rule
+        rule1->Set(CreateBox(1000, 0, 0, 20));
+        handler->Update();
+        AZ_TEST_ASSERT(handler->GetLastResult().size() == 0);
+    }
+
+    static void OversizedRule()
+    {
+        AZStd::unique_ptr<SpatialHashInterestHandler> handler(aznew SpatialHashInterestHandler(1.f));
+
+        auto attribute1 = handler->CreateAttribute(1);
+        attribute1->Set(CreateBox(0, 0, 0, 1));
+
+        auto attribute2 = handler->CreateAttribute(2);
+        attribute2->Set(CreateBox(-500, -500, -500, 1000)); // oversized attribute
+
+        auto rule1 = handler->CreateRule(100);
+        rule1->Set(CreateBox(-100, -100, -100, 200)); // oversized rule
+
+        handler->Update();
+        InterestMatchResult results = handler->GetLastResult();
+        AZ_TEST_ASSERT(results[1].size() == 1);
+        AZ_TEST_ASSERT(results[2].size() == 1);
+
+        // back into the grid
+        rule1->Set(CreateBox(0, 0, 0, 2));
+        handler->Update();
+        AZ_TEST_ASSERT(handler->GetLastResult().size() == 0);
+
+        rule1->Set(CreateBox(600, 0, 0, 2));
+        handler->Update();
+        results = handler->GetLastResult();
+        AZ_TEST_ASSERT(results.size() == 2);
+        AZ_TEST_ASSERT(results[1].size() == 0);
+        AZ_TEST_ASSERT(results[2].size() == 0);
+    }
+
+    static void RuleDestroyed()
+    {
+        AZStd::unique_ptr<SpatialHashInterestHandler> handler(aznew SpatialHashInterestHandler(16.f));
+
+        auto attribute1 = handler->CreateAttribute(1);
+        attribute1->Set(CreateBox(0, 0, 0, 10));
+
+        {
+            auto rule1 = handler->CreateRule(100);
+            rule1->Set(CreateBox(0, 0, 0, 100));
+
+            handler->Update();
+
+            InterestMatchResult results = handler->GetLastResult();
+            AZ_TEST_ASSERT(results.size() == 1);
+            AZ_TEST_ASSERT(results[1].size() == 1);
+        }
+
+        // rule1 should have been destroyed by now
+        handler->Update();
+        InterestMatchResult results = handler->GetLastResult();
+
+        AZ_TEST_ASSERT(results.size() == 1);
+        AZ_TEST_ASSERT(results[1].size() == 0);
+        AZ_TEST_ASSERT(handler->GetLocalRules().empty());
+    }
+
+    static void AttributeDestroyed()
+    {
+        AZStd::unique_ptr<SpatialHashInterestHandler> handler(aznew SpatialHashInterestHandler(16.f));
+
+        auto rule1 = handler->CreateRule(100);
+        rule1->Set(CreateBox(0, 0, 0, 100));
+
+        {
+            auto attribute1 = handler->CreateAttribute(1);
+            attribute1->Set(CreateBox(0, 0, 0, 10));
+
+            handler->Update();
+
+            InterestMatchResult results = handler->GetLastResult();
+            AZ_TEST_ASSERT(results.size() == 1);
+            AZ_TEST_ASSERT(results[1].size() == 1);
+
+            // moved and destroyed in the same update
+            attribute1->Set(CreateBox(20, 0, 0, 10));
+        }
+
+        // attribute1 should have been destroyed by now, but it will show up once to remove it from affected peers
+        handler->Update();
+        InterestMatchResult results = handler->GetLastResult();
+
+        AZ_TEST_ASSERT(results.size() == 1);
+        AZ_TEST_ASSERT(results[1].size() == 0);
+
+        // and now attribute1 should not show up in the changes
+        handler->Update();
+        AZ_TEST_ASSERT(handler->GetLastResult().size() == 0);
+    }
+};
+
 }; // namespace UnitTest
 
 GM_TEST_SUITE(InterestSuite)
     GM_TEST(Integ_InterestTest);
     GM_TEST(LargeWorldTest);
     GM_TEST(ProximityHandlerTests);
+    GM_TEST(SpatialHashHandlerTests);
 GM_TEST_SUITE_END()
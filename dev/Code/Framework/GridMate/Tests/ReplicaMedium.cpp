@@ -82,6 +82,7 @@ public:
         , FromProxyBroadcast("FromProxyBroadcast")
         , FromProxyNotBroadcast("FromProxyNotBroadcast")
         , BroadcastInt("BroadcastInt")
+        , BroadcastLatestInt("BroadcastLatestInt")
     { }
 
     bool IsReplicaMigratable() override { return false; }
@@ -120,17 +121,31 @@ public:
         return true;
     }
 
+    bool BroadcastLatestIntFn(int val, const RpcContext&)
+    {
+        m_sentLatestData.push_back(val);
+        return true;
+    }
+
     int m_fromMasterBroadcast;
     int m_fromMasterNotBroadcast;
     int m_fromProxyBroadcast;
     int m_fromProxyNotBroadcast;
     AZStd::vector<int> m_sentData;
+    AZStd::vector<int> m_sentLatestData;
+
+    struct LatestTraits
+        : public RpcDefaultTraits
+    {
+        static const bool s_coalesceLatest = true;
+    };
 
     Rpc<>::BindInterface<RPCChunk, & RPCChunk::FromMasterBroadcastFn> FromMasterBroadcast;
     Rpc<>::BindInterface<RPCChunk, & RPCChunk::FromMasterNotBroadcastFn> FromMasterNotBroadcast;
     Rpc<>::BindInterface<RPCChunk, & RPCChunk::FromProxyBroadcastFn> FromProxyBroadcast;
     Rpc<>::BindInterface<RPCChunk, & RPCChunk::FromProxyNotBroadcastFn> FromProxyNotBroadcast;
     Rpc<RpcArg<int> >::BindInterface<RPCChunk, & RPCChunk::BroadcastIntFn> BroadcastInt;
+    Rpc<RpcArg<int> >::BindInterface<RPCChunk, & RPCChunk::BroadcastLatestIntFn, LatestTraits> BroadcastLatestInt;
 };
 
 class FullRPCChunk
@@ -1255,6 +1270,98 @@ TEST_F(Integ_ReplicaRPCValues, ReplicaRPCValues)
     });
 }
 
+class Integ_ReplicaRPCBatching
+    : public Integ_SimpleTest
+{
+public:
+    Integ_ReplicaRPCBatching()
+        : m_replica(nullptr)
+        , m_chunk(nullptr)
+        , m_replicaId(0)
+    {
+    }
+
+    enum
+    {
+        sHost,
+        s2,
+        nSessions
+    };
+
+    int GetNumSessions() override { return nSessions; }
+
+    void PreConnect() override
+    {
+        m_replica = Replica::CreateReplica(nullptr);
+        m_chunk = CreateAndAttachReplicaChunk<RPCChunk>(m_replica);
+        m_replicaId = m_sessions[sHost].GetReplicaMgr().AddMaster(m_replica);
+    }
+
+    ReplicaPtr m_replica;
+    RPCChunk::Ptr m_chunk;
+    ReplicaId m_replicaId;
+};
+
+TEST_F(Integ_ReplicaRPCBatching, ReplicaRPCBatching)
+{
+    RunTickLoop([this](int tick)-> TestStatus
+    {
+        auto rep = m_sessions[s2].GetReplicaMgr().FindReplica(m_replicaId);
+        RPCChunk::Ptr proxyChunk = rep ? rep->FindReplicaChunk<RPCChunk>() : nullptr;
+        if (tick == 20)
+        {
+            // Calls of several rpcs in the same frame, the calls in between split the batches
+            for (int i = 0; i < 10; ++i)
+            {
+                if (i == 5)
+                {
+                    m_chunk->FromMasterBroadcast();
+                }
+                m_chunk->BroadcastInt(i);
+                m_chunk->BroadcastLatestInt(i);
+                m_chunk->BroadcastInt(i + 100);
+            }
+            for (int i = 0; i < 10; ++i)
+            {
+                m_chunk->BroadcastLatestInt(i + 100);
+            }
+            AZ_TEST_ASSERT(m_chunk->m_sentData.size() == 20);
+            AZ_TEST_ASSERT(m_chunk->m_sentLatestData.size() == 20); // every call is executed on the master
+        }
+        else if (tick == 50)
+        {
+            AZ_TEST_ASSERT(proxyChunk);
+            AZ_TEST_ASSERT(proxyChunk->m_fromMasterBroadcast == 1);
+            AZ_TEST_ASSERT(proxyChunk->m_sentData.size() == 20);
+            for (int i = 0; i < 10; ++i)
+            {
+                AZ_TEST_ASSERT(proxyChunk->m_sentData[i * 2] == i);
+                AZ_TEST_ASSERT(proxyChunk->m_sentData[i * 2 + 1] == i + 100);
+            }
+
+            // Only the last call survives
+            AZ_TEST_ASSERT(proxyChunk->m_sentLatestData.size() == 1);
+            AZ_TEST_ASSERT(proxyChunk->m_sentLatestData.back() == 109);
+
+            // A coalesced call that was already sent is not dropped by the next one
+            m_chunk->BroadcastLatestInt(200);
+        }
+        else if (tick == 80)
+        {
+            m_chunk->BroadcastLatestInt(201);
+        }
+        else if (tick == 110)
+        {
+            AZ_TEST_ASSERT(proxyChunk);
+            AZ_TEST_ASSERT(proxyChunk->m_sentLatestData.size() == 3);
+            AZ_TEST_ASSERT(proxyChunk->m_sentLatestData[1] == 200);
+            AZ_TEST_ASSERT(proxyChunk->m_sentLatestData[2] == 201);
+            return TestStatus::Completed;
+        }
+        return TestStatus::Running;
+    });
+}
+
 class Integ_FullRPCValues
     : public Integ_SimpleTest
 {
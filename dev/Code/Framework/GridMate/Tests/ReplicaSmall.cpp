@@ -19,11 +19,15 @@
 
 #include <GridMate/Replica/Interpolators.h>
 #include <GridMate/Replica/Replica.h>
+#include <GridMate/Replica/ReplicaCapture.h>
 #include <GridMate/Replica/ReplicaFunctions.h>
 #include <GridMate/Replica/ReplicaMgr.h>
+#include <GridMate/Replica/ReplicaReplay.h>
 #include <GridMate/Replica/ReplicaStatus.h>
+#include <GridMate/Replica/SnapshotDeltaDataSet.h>
 
 #include <GridMate/Serialize/DataMarshal.h>
+#include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 using namespace GridMate;
@@ -525,6 +529,194 @@ public:
     }
 };
 
+class SnapshotDeltaDataSetTest
+    : public UnitTest::GridMateMPTestFixture
+{
+public:
+    GM_CLASS_ALLOCATOR(SnapshotDeltaDataSetTest);
+
+    class TestDataSet : public SnapshotDeltaDataSet<AZ::u64>
+    {
+    public:
+        TestDataSet() : SnapshotDeltaDataSet<AZ::u64>("Test", 0) {}
+
+        // Wrappers to call protected methods
+        PrepareDataResult PrepareData(EndianType endianType, AZ::u32 marshalFlags) override
+        {
+            return SnapshotDeltaDataSet<AZ::u64>::PrepareData(endianType, marshalFlags);
+        }
+
+        void Marshal(MarshalContext& mc) const override
+        {
+            SnapshotDeltaDataSet<AZ::u64>::Marshal(mc);
+        }
+
+        void Unmarshal(UnmarshalContext& mc) override
+        {
+            SnapshotDeltaDataSet<AZ::u64>::Unmarshal(mc);
+        }
+    };
+
+    class SnapshotDataSetChunk
+        : public ReplicaChunk
+    {
+    public:
+        GM_CLASS_ALLOCATOR(SnapshotDataSetChunk);
+
+        bool IsReplicaMigratable() override
+        {
+            return false;
+        }
+
+        static const char* GetChunkName()
+        {
+            static const char* name = "SnapshotDataSetChunk";
+            return name;
+        }
+
+        TestDataSet Data1;
+    };
+
+    void run()
+    {
+        AZ_TracePrintf("GridMate", "\n");
+
+        // Deltas only carry the changed bytes, and can be skipped without their base
+        {
+            const char base[] = "abcdefghijklmnopq";
+            const char data[] = "aXcdefghijklmnopY";
+            WriteBufferDynamic wb(EndianType::BigEndian, 0);
+            SnapshotDelta::WriteDelta(wb, base, sizeof(base) - 1, data, sizeof(data));
+            AZ_TEST_ASSERT(wb.Size() == 6); // size, 3 masks and 2 changed bytes
+
+            vector<char> result;
+            ReadBuffer rb(wb.GetEndianType(), wb.Get(), wb.GetExactSize());
+            AZ_TEST_ASSERT(SnapshotDelta::ReadDelta(rb, base, sizeof(base) - 1, result));
+            AZ_TEST_ASSERT(rb.IsEmpty());
+            AZ_TEST_ASSERT(result.size() == sizeof(data) && memcmp(result.data(), data, sizeof(data)) == 0);
+
+            ReadBuffer skipRb(wb.GetEndianType(), wb.Get(), wb.GetExactSize());
+            AZ_TEST_ASSERT(SnapshotDelta::ReadDelta(skipRb, nullptr, 0, result));
+            AZ_TEST_ASSERT(skipRb.IsEmpty());
+
+            ReadBuffer truncatedRb(wb.GetEndianType(), wb.Get(), wb.Size() - 1);
+            AZ_TEST_ASSERT(!SnapshotDelta::ReadDelta(truncatedRb, base, sizeof(base) - 1, result));
+        }
+
+        // Without an acked baseline the full value is sent
+        {
+            ReplicaManager rm;
+            ReplicaPeer peer(&rm);
+
+            ReplicaChunkDescriptorTable::Get().RegisterChunkType<SnapshotDataSetChunk>();
+            AZStd::unique_ptr<SnapshotDataSetChunk> master(CreateReplicaChunk<SnapshotDataSetChunk>());
+            AZStd::unique_ptr<SnapshotDataSetChunk> proxy(CreateReplicaChunk<SnapshotDataSetChunk>());
+
+            for (AZ::u64 value = 1; value < 4; ++value)
+            {
+                master->Data1.Set(value * 0x1234);
+                master->Data1.PrepareData(EndianType::BigEndian, 0);
+
+                WriteBufferDynamic wb(EndianType::BigEndian, 0);
+                MarshalContext mc(ReplicaMarshalFlags::IncludeDatasets, &wb, nullptr, ReplicaContext(&rm, TimeContext(), &peer));
+                master->Data1.Marshal(mc);
+                AZ_TEST_ASSERT(wb.Size() == 2 + 1 + sizeof(AZ::u64)); // sequence, baseline, size and value
+
+                ReadBuffer rb(wb.GetEndianType(), wb.Get(), wb.GetExactSize());
+                UnmarshalContext uc(ReplicaContext(&rm, TimeContext(), &peer));
+                uc.m_iBuf = &rb;
+                proxy->Data1.Unmarshal(uc);
+                AZ_TEST_ASSERT(rb.IsEmpty());
+                AZ_TEST_ASSERT(proxy->Data1.Get() == value * 0x1234);
+            }
+        }
+    }
+};
+
+class ReplicaCaptureTest
+    : public UnitTest::GridMateMPTestFixture
+{
+public:
+    GM_CLASS_ALLOCATOR(ReplicaCaptureTest);
+
+    void run()
+    {
+        const char message1[] = { 1, 2, 3, 4, 5 };
+        const char message2[] = { 6, 7 };
+        ConnectionID conn1 = reinterpret_cast<ConnectionID>(static_cast<size_t>(0x10));
+        ConnectionID conn2 = reinterpret_cast<ConnectionID>(static_cast<size_t>(0x20));
+        ConnectionID unknownConn = reinterpret_cast<ConnectionID>(static_cast<size_t>(0x30));
+
+        AZStd::vector<char> captureData;
+        {
+            AZ::IO::ByteContainerStream<AZStd::vector<char> > stream(&captureData);
+            ReplicaCaptureWriter writer(&stream, 0x1234, false);
+            writer.OnAddPeer(conn1, Mode_Peer, 100);
+            writer.OnAddPeer(conn2, Mode_Peer, 110);
+            writer.OnMessage(conn1, 120, message1, sizeof(message1));
+            writer.OnMessage(unknownConn, 120, message2, sizeof(message2)); // not recorded, peer was added before the capture
+            writer.OnMessage(conn2, 130, message2, sizeof(message2));
+            writer.OnRemovePeer(conn1, 140);
+            AZ_TEST_ASSERT(writer.IsValid());
+        }
+
+        {
+            AZ::IO::ByteContainerStream<AZStd::vector<char> > stream(&captureData);
+            ReplicaCapture capture;
+            AZ_TEST_ASSERT(capture.Load(stream));
+            AZ_TEST_ASSERT(capture.GetLocalPeerId() == 0x1234);
+            AZ_TEST_ASSERT(!capture.IsSyncHost());
+
+            const ReplicaCapture::RecordList& records = capture.GetRecords();
+            AZ_TEST_ASSERT(records.size() == 5);
+            AZ_TEST_ASSERT(records[0].m_type == ReplicaCaptureRecord::Type_AddPeer && records[0].m_connection == 0 && records[0].m_mode == Mode_Peer);
+            AZ_TEST_ASSERT(records[1].m_type == ReplicaCaptureRecord::Type_AddPeer && records[1].m_connection == 1);
+            AZ_TEST_ASSERT(records[2].m_type == ReplicaCaptureRecord::Type_Message && records[2].m_connection == 0 && records[2].m_time == 120);
+            AZ_TEST_ASSERT(records[2].m_data.size() == sizeof(message1) && memcmp(records[2].m_data.data(), message1, sizeof(message1)) == 0);
+            AZ_TEST_ASSERT(records[3].m_type == ReplicaCaptureRecord::Type_Message && records[3].m_connection == 1 && records[3].m_data.size() == sizeof(message2));
+            AZ_TEST_ASSERT(records[4].m_type == ReplicaCaptureRecord::Type_RemovePeer && records[4].m_connection == 0 && records[4].m_time == 140);
+        }
+
+        // a capture cut in the middle of a record loads up to the last complete record
+        {
+            AZStd::vector<char> truncatedData(captureData.begin(), captureData.end() - 4);
+            AZ::IO::ByteContainerStream<AZStd::vector<char> > stream(&truncatedData);
+            ReplicaCapture capture;
+            AZ_TEST_ASSERT(capture.Load(stream));
+            AZ_TEST_ASSERT(capture.GetRecords().size() == 4);
+        }
+
+        // not a capture
+        {
+            AZStd::vector<char> garbage(32, 'x');
+            AZ::IO::ByteContainerStream<AZStd::vector<char> > stream(&garbage);
+            ReplicaCapture capture;
+            AZ_TEST_ASSERT(!capture.Load(stream));
+        }
+
+        // peers without traffic replay without any frame
+        {
+            AZStd::vector<char> peersData;
+            AZ::IO::ByteContainerStream<AZStd::vector<char> > stream(&peersData);
+            {
+                ReplicaCaptureWriter writer(&stream, 0x1234, false);
+                writer.OnAddPeer(conn1, Mode_Peer, 100);
+                writer.OnRemovePeer(conn1, 140);
+            }
+
+            stream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+            ReplicaCapture capture;
+            AZ_TEST_ASSERT(capture.Load(stream));
+
+            ReplicaReplay replay(m_gridMate);
+            const ReplicaReplayReport& report = replay.Run(capture);
+            AZ_TEST_ASSERT(report.m_numFrames == 0);
+            AZ_TEST_ASSERT(report.m_numMessages == 0);
+            AZ_TEST_ASSERT(report.m_captureDurationMS == 40);
+        }
+    }
+};
+
 class RpcNullHandlerCrash_Test
     : public UnitTest::GridMateMPTestFixture
 {
@@ -595,5 +787,7 @@ GM_TEST(ChunkEvents);
 GM_TEST(OfflineModeTest);
 GM_TEST(DataSet_PrepareTest);
 GM_TEST(DataSet_ACKTest);
+GM_TEST(SnapshotDeltaDataSetTest);
+GM_TEST(ReplicaCaptureTest);
 GM_TEST(RpcNullHandlerCrash_Test);
 GM_TEST_SUITE_END()
@@ -794,6 +794,64 @@ namespace UnitTest
             rb = ReadBuffer(wb.GetEndianType(), wb.Get(), wb.Size());
             rb.Read(rq, QuatCompNormMarshaler());
             AZ_TEST_ASSERT(q.IsClose(rq, 0.03f));
+
+            // QuatSmallestThreeMarshaler, 2 bits for the index + 3 * 10 bits
+            wb.Clear();
+            wb.Write(q, QuatSmallestThreeMarshaler());
+            AZ_TEST_ASSERT(wb.GetExactSize() == PackedSize(4));
+
+            rb = ReadBuffer(wb.GetEndianType(), wb.Get(), wb.Size());
+            rb.Read(rq, QuatSmallestThreeMarshaler());
+            AZ_TEST_ASSERT(q.IsClose(rq, 0.002f));
+
+            // the dropped component is negative, q and -q are the same rotation
+            q.Set(0.1f, -0.2f, 0.3f, -0.9f);
+            q.Normalize();
+            wb.Clear();
+            wb.Write(q, QuatSmallestThreeMarshaler());
+            rb = ReadBuffer(wb.GetEndianType(), wb.Get(), wb.Size());
+            rb.Read(rq, QuatSmallestThreeMarshaler());
+            AZ_TEST_ASSERT(q.IsClose(rq, 0.002f) || q.IsClose(-rq, 0.002f));
+
+            //////////////////////////////////////////////////////////////////////////
+            // Quantized values are bit packed
+            //////////////////////////////////////////////////////////////////////////
+            {
+                const AZ::Vector3 worldMin(-1000.0f, -1000.0f, -50.0f);
+                const AZ::Vector3 worldMax(1000.0f, 1000.0f, 200.0f);
+                QuantizedVec3Marshaler posMarshaler(worldMin, worldMax, 20, 20, 14);
+                AZ::Vector3 pos(123.456f, -987.654f, 12.5f), rpos;
+                bool flag = true, rflag = false;
+
+                wb.Clear();
+                wb.Write(flag);
+                wb.Write(pos, posMarshaler);
+                AZ_TEST_ASSERT(wb.GetExactSize() == PackedSize(0, 1 + 20 + 20 + 14));
+
+                rb = ReadBuffer(wb.GetEndianType(), wb.Get(), wb.GetExactSize());
+                rb.Read(rflag);
+                rb.Read(rpos, posMarshaler);
+                AZ_TEST_ASSERT(rflag == flag);
+                AZ_TEST_ASSERT(pos.IsClose(rpos, 0.01f));
+                AZ_TEST_ASSERT(rb.IsEmpty());
+
+                // values outside of the range are clamped
+                wb.Clear();
+                wb.Write(AZ::Vector3(2000.0f, -2000.0f, 0.0f), posMarshaler);
+                rb = ReadBuffer(wb.GetEndianType(), wb.Get(), wb.GetExactSize());
+                rb.Read(rpos, posMarshaler);
+                AZ_TEST_ASSERT(rpos.GetX().IsClose(1000.0f) && rpos.GetY().IsClose(-1000.0f));
+
+                QuantizedTransformMarshaler xformMarshaler(worldMin, worldMax, 20);
+                AZ::Transform xform = AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationZ(1.0f), pos), rxform;
+                wb.Clear();
+                wb.Write(xform, xformMarshaler);
+                AZ_TEST_ASSERT(wb.GetExactSize() == PackedSize(0, 3 + 32 + 3 * 20));
+
+                rb = ReadBuffer(wb.GetEndianType(), wb.Get(), wb.GetExactSize());
+                rb.Read(rxform, xformMarshaler);
+                AZ_TEST_ASSERT(xform.IsClose(rxform, 0.01f));
+            }
         }
     };
 
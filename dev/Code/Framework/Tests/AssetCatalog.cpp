@@ -16,6 +16,8 @@
 #include <AzCore/Math/Uuid.h>
 #include <AzFramework/Asset/AssetCatalog.h>
 #include <AzFramework/Asset/AssetProcessorMessages.h>
+#include <AzFramework/Asset/AssetRegistry.h>
+#include <AzFramework/Asset/BinaryAssetRegistry.h>
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 
@@ -253,4 +255,83 @@ namespace UnitTest
     {
         EXPECT_EQ(m_firstAssetId, m_assetCatalog->GetAssetIdByPath("//AssetA.txt", AZ::Data::s_invalidAssetType, false));
     }
+
+    class BinaryAssetRegistryTest
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+
+            m_registry = aznew AzFramework::AssetRegistry();
+            for (AZ::u32 index = 0; index < 64; ++index)
+            {
+                AssetInfo assetInfo;
+                assetInfo.m_assetId = AssetId(AZ::Uuid::CreateRandom(), index % 3);
+                assetInfo.m_assetType = AZ::Uuid::CreateRandom();
+                assetInfo.m_relativePath = AZStd::string::format("Textures/Asset%u.dds", index);
+                assetInfo.m_sizeBytes = index + 1;
+                m_registry->RegisterAsset(assetInfo.m_assetId, assetInfo);
+                m_assetIds.push_back(assetInfo.m_assetId);
+            }
+
+            m_legacyAssetId = AssetId(AZ::Uuid::CreateRandom(), 0);
+            m_registry->RegisterLegacyAssetMapping(m_legacyAssetId, m_assetIds[1]);
+            m_registry->SetAssetDependencies(m_assetIds[2], { ProductDependency(m_assetIds[3], 1), ProductDependency(m_assetIds[4], 0) });
+            m_registry->SetAssetDependencies(m_assetIds[5], {});
+        }
+
+        void TearDown() override
+        {
+            m_assetIds.set_capacity(0);
+            delete m_registry;
+            AllocatorsFixture::TearDown();
+        }
+
+        AzFramework::AssetRegistry* m_registry;
+        AZStd::vector<AssetId> m_assetIds;
+        AssetId m_legacyAssetId;
+    };
+
+    TEST_F(BinaryAssetRegistryTest, WriteAndLoad_LookupsMatchRegistry)
+    {
+        AZStd::vector<char> image;
+        AzFramework::BinaryAssetRegistry::Write(*m_registry, image);
+        EXPECT_TRUE(AzFramework::BinaryAssetRegistry::IsBinaryRegistry(image.data(), image.size()));
+
+        AzFramework::BinaryAssetRegistry binaryRegistry;
+        ASSERT_TRUE(binaryRegistry.Load(AZStd::move(image)));
+        EXPECT_EQ(m_assetIds.size(), binaryRegistry.GetAssetCount());
+
+        for (const AssetId& assetId : m_assetIds)
+        {
+            const AssetInfo& expected = m_registry->m_assetIdToInfo[assetId];
+            AssetInfo assetInfo;
+            EXPECT_TRUE(binaryRegistry.FindAssetInfo(assetId, assetInfo));
+            EXPECT_EQ(assetId, assetInfo.m_assetId);
+            EXPECT_EQ(expected.m_assetType, assetInfo.m_assetType);
+            EXPECT_EQ(expected.m_sizeBytes, assetInfo.m_sizeBytes);
+            EXPECT_EQ(expected.m_relativePath, assetInfo.m_relativePath);
+            EXPECT_EQ(assetId, binaryRegistry.GetAssetIdByPath(expected.m_relativePath.c_str()));
+        }
+
+        AssetInfo missingInfo;
+        EXPECT_FALSE(binaryRegistry.FindAssetInfo(AssetId(AZ::Uuid::CreateRandom(), 0), missingInfo));
+        EXPECT_EQ(m_assetIds[0], binaryRegistry.GetAssetIdByPath("textures\\ASSET0.dds"));
+        EXPECT_FALSE(binaryRegistry.GetAssetIdByPath("Textures/Missing.dds").IsValid());
+        EXPECT_EQ(m_assetIds[1], binaryRegistry.GetAssetIdByLegacyAssetId(m_legacyAssetId));
+
+        AZStd::vector<ProductDependency> dependencies;
+        EXPECT_TRUE(binaryRegistry.GetDirectProductDependencies(m_assetIds[2], dependencies));
+        ASSERT_EQ(2u, dependencies.size());
+        EXPECT_EQ(m_assetIds[3], dependencies[0].m_assetId);
+        EXPECT_EQ(1u, dependencies[0].m_flags.to_ullong());
+        EXPECT_EQ(m_assetIds[4], dependencies[1].m_assetId);
+
+        dependencies.clear();
+        EXPECT_TRUE(binaryRegistry.GetDirectProductDependencies(m_assetIds[5], dependencies));
+        EXPECT_TRUE(dependencies.empty());
+        EXPECT_FALSE(binaryRegistry.GetDirectProductDependencies(m_assetIds[6], dependencies));
+    }
 }
@@ -113,6 +113,77 @@ namespace UnitTest
             app.Destroy();
         }
 
+        void runSliceInstancePool()
+        {
+            ComponentApplication app;
+            ComponentApplication::Descriptor desc;
+            desc.m_useExistingAllocator = true;
+            desc.m_enableDrilling = false;
+            AZ::Entity* systemEntity = app.Create(desc);
+
+            Data::AssetManager::Instance().RegisterHandler(aznew SliceAssetHandler(app.GetSerializeContext()), AZ::AzTypeInfo<AZ::SliceAsset>::Uuid());
+
+            EntityContext context(AZ::Uuid::CreateRandom(), app.GetSerializeContext());
+            context.InitContext();
+            context.GetRootSlice()->SetSerializeContext(app.GetSerializeContext());
+
+            EntityContextEventBus::Handler::BusConnect(context.GetContextId());
+
+            AZ::Entity* sliceEntity = aznew AZ::Entity();
+            AZ::SliceComponent* sliceComponent = sliceEntity->CreateComponent<AZ::SliceComponent>();
+            sliceComponent->SetSerializeContext(app.GetSerializeContext());
+            sliceComponent->AddEntity(aznew AZ::Entity());
+
+            Data::Asset<SliceAsset> sliceAssetHolder = Data::AssetManager::Instance().CreateAsset<SliceAsset>(Data::AssetId(Uuid::CreateRandom()));
+            sliceAssetHolder.Get()->SetData(sliceEntity, sliceComponent);
+
+            context.SetSliceInstancePoolSize(sliceAssetHolder, 2);
+            AZ::TickBus::ExecuteQueuedEvents();
+
+            SliceInstancePoolStats stats = context.GetSliceInstancePoolStats(sliceAssetHolder.GetId());
+            EXPECT_EQ(2, stats.m_poolSize);
+            EXPECT_EQ(2, stats.m_available);
+
+            // Served from the pool, the used instance is replaced on the next tick.
+            context.InstantiateSlice(sliceAssetHolder);
+            AZ::TickBus::ExecuteQueuedEvents();
+            stats = context.GetSliceInstancePoolStats(sliceAssetHolder.GetId());
+            EXPECT_EQ(1, stats.m_hits);
+            EXPECT_EQ(0, stats.m_misses);
+            EXPECT_EQ(1, m_prefabSuccesses);
+            ASSERT_EQ(1, prefabResults.size());
+            EXPECT_EQ(prefabResults[0], context.GetRootSlice()->FindEntity(prefabResults[0]->GetId()));
+
+            AZ::TickBus::ExecuteQueuedEvents();
+            EXPECT_EQ(2, context.GetSliceInstancePoolStats(sliceAssetHolder.GetId()).m_available);
+
+            // Requests with their own id mapping always clone the slice.
+            context.InstantiateSlice(sliceAssetHolder, 
+                [](const AZ::EntityId& originalId, bool replaceId, const AZ::IdUtils::Remapper<AZ::EntityId>::IdGenerator&)
+                {
+                    return replaceId ? AZ::Entity::MakeId() : originalId;
+                });
+            AZ::TickBus::ExecuteQueuedEvents();
+            stats = context.GetSliceInstancePoolStats(sliceAssetHolder.GetId());
+            EXPECT_EQ(1, stats.m_hits);
+            EXPECT_EQ(1, stats.m_misses);
+            EXPECT_EQ(2, stats.m_available);
+            EXPECT_EQ(2, m_prefabSuccesses);
+
+            AZ::SliceComponent::EntityList entities;
+            context.GetRootSlice()->GetEntities(entities);
+            EXPECT_EQ(2, entities.size());
+
+            context.ResetContext();
+            EXPECT_EQ(0, context.GetSliceInstancePoolStats(sliceAssetHolder.GetId()).m_poolSize);
+
+            EntityContextEventBus::Handler::BusDisconnect(context.GetContextId());
+
+            sliceAssetHolder = nullptr;
+            delete systemEntity;
+            app.Destroy();
+        }
+
         void OnEntityContextCreateEntity(AZ::Entity& entity) override
         {
             (void)entity;
@@ -150,4 +221,9 @@ namespace UnitTest
     {
         run();
     }
+
+    TEST_F(EntityContextBasicTest, SliceInstancePool_InstantiateSlice_UsesPooledInstances)
+    {
+        runSliceInstancePool();
+    }
 }
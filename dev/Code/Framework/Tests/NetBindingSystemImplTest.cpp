@@ -590,4 +590,47 @@ namespace UnitTest
 
         EBUS_EVENT(AZ::TickBus, OnTick, k_smallStep, AZ::ScriptTimePoint());
     }
+
+    TEST_F(NetBindingWithSlicesTest, QueuedMasterBindings_BoundOnNextTick_UnlessDeactivated)
+    {
+        auto createEntity = [](const EntityId& id, MockBindingComponent* binding)
+        {
+            auto mock = AZStd::make_unique<NiceMock<MockEntity>>();
+            mock->SetId(id);
+            mock->AddComponent(binding); // entity owns the component
+            ON_CALL(*mock, Init())
+                .WillByDefault(Invoke(mock.get(), &MockEntity::Base_Init));
+            ON_CALL(*mock, Activate())
+                .WillByDefault(Invoke(mock.get(), &MockEntity::Base_Activate));
+            ON_CALL(*mock, Deactivate())
+                .WillByDefault(Invoke(mock.get(), &MockEntity::Base_Deactivate));
+            mock->Init();
+            mock->Activate();
+            return mock;
+        };
+
+        auto binding1 = aznew NiceMock<MockBindingComponent>();
+        auto entity1 = createEntity(k_fakeEntityId_One, binding1);
+        auto binding2 = aznew NiceMock<MockBindingComponent>();
+        auto entity2 = createEntity(k_fakeEntityId_Two, binding2);
+
+        EBUS_EVENT(NetBindingSystemBus, QueueMasterBinding, k_fakeEntityId_One);
+        EBUS_EVENT(NetBindingSystemBus, QueueMasterBinding, k_fakeEntityId_Two);
+
+        // Deactivated in the same frame, it is never bound
+        entity2->Deactivate();
+
+        EXPECT_CALL(*binding1, BindToNetwork(_))
+            .Times(1);
+        EXPECT_CALL(*binding2, BindToNetwork(_))
+            .Times(0);
+
+        EBUS_EVENT(AZ::TickBus, OnTick, k_smallStep, AZ::ScriptTimePoint());
+
+        // Requests are consumed by the tick
+        EBUS_EVENT(AZ::TickBus, OnTick, k_smallStep, AZ::ScriptTimePoint());
+
+        entity1->Deactivate();
+        m_componentApplication->m_mockEntities.clear();
+    }
 }
@@ -19,6 +19,7 @@
 
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformPropagationBus.h>
 #include <AzFramework/Math/MathUtils.h>
 
 #include <AzToolsFramework/Application/ToolsApplication.h>
@@ -1081,6 +1082,158 @@ namespace UnitTest
         EXPECT_TRUE(defaultConfig == retrievedConfig);
     }
 
+    // Counts the OnTransformChanged notifications of one entity.
+    class TransformChangedCounter
+        : public TransformNotificationBus::Handler
+    {
+    public:
+        void OnTransformChanged(const Transform& /*local*/, const Transform& world) override
+        {
+            m_lastWorldTM = world;
+            m_count++;
+        }
+
+        Transform m_lastWorldTM = Transform::CreateIdentity();
+        int m_count = 0;
+    };
+
+    class TransformComponentDeferredPropagationTest
+        : public TransformComponentApplication
+    {
+    protected:
+        void SetUp() override
+        {
+            TransformComponentApplication::SetUp();
+
+            for (int i = 0; i < s_entityCount; ++i)
+            {
+                m_entities[i] = aznew Entity();
+                m_entities[i]->Init();
+                m_entities[i]->CreateComponent<TransformComponent>();
+                m_entities[i]->Activate();
+                m_ids[i] = m_entities[i]->GetId();
+                if (i > 0)
+                {
+                    // parent <- child <- grandchild
+                    TransformBus::Event(m_ids[i], &TransformBus::Events::SetParent, m_ids[i - 1]);
+                }
+                TransformBus::Event(m_ids[i], &TransformBus::Events::SetLocalTM, Transform::CreateTranslation(Vector3(1.0f, 0.0f, 0.0f)));
+                m_counters[i].BusConnect(m_ids[i]);
+            }
+
+            TransformPropagationRequestBus::Broadcast(&TransformPropagationRequestBus::Events::SetDeferredPropagationEnabled, true);
+        }
+
+        void TearDown() override
+        {
+            TransformPropagationRequestBus::Broadcast(&TransformPropagationRequestBus::Events::SetDeferredPropagationEnabled, false);
+
+            for (int i = s_entityCount - 1; i >= 0; --i)
+            {
+                m_counters[i].BusDisconnect();
+                delete m_entities[i];
+            }
+
+            TransformComponentApplication::TearDown();
+        }
+
+        Transform GetWorldTM(int index)
+        {
+            Transform worldTM = Transform::CreateIdentity();
+            TransformBus::EventResult(worldTM, m_ids[index], &TransformBus::Events::GetWorldTM);
+            return worldTM;
+        }
+
+        void FlushTransforms()
+        {
+            TransformPropagationRequestBus::Broadcast(&TransformPropagationRequestBus::Events::FlushTransforms);
+        }
+
+        static const int s_entityCount = 3;
+        Entity* m_entities[s_entityCount];
+        EntityId m_ids[s_entityCount];
+        TransformChangedCounter m_counters[s_entityCount];
+    };
+
+    TEST_F(TransformComponentDeferredPropagationTest, MoveParent_NotificationsDeferredUntilFlush)
+    {
+        for (int i = 1; i <= 3; ++i)
+        {
+            TransformBus::Event(m_ids[0], &TransformBus::Events::SetWorldTranslation, Vector3(0.0f, static_cast<float>(i), 0.0f));
+        }
+
+        for (int i = 0; i < s_entityCount; ++i)
+        {
+            EXPECT_EQ(0, m_counters[i].m_count);
+        }
+
+        FlushTransforms();
+
+        for (int i = 0; i < s_entityCount; ++i)
+        {
+            const Vector3 expectedTranslation(static_cast<float>(i), 3.0f, 0.0f);
+            EXPECT_EQ(1, m_counters[i].m_count);
+            EXPECT_TRUE(m_counters[i].m_lastWorldTM.GetTranslation().IsClose(expectedTranslation));
+        }
+
+        // nothing left to notify
+        FlushTransforms();
+        EXPECT_EQ(1, m_counters[2].m_count);
+    }
+
+    TEST_F(TransformComponentDeferredPropagationTest, MoveParent_DescendantWorldTMResolvedOnDemand)
+    {
+        TransformBus::Event(m_ids[0], &TransformBus::Events::SetLocalTM, Transform::CreateTranslation(Vector3(0.0f, 0.0f, 5.0f)));
+        TransformBus::Event(m_ids[1], &TransformBus::Events::SetLocalTM, Transform::CreateRotationZ(Constants::HalfPi));
+
+        EXPECT_TRUE(GetWorldTM(2).GetTranslation().IsClose(Vector3(0.0f, 1.0f, 5.0f)));
+        EXPECT_EQ(0, m_counters[2].m_count);
+
+        FlushTransforms();
+
+        EXPECT_EQ(1, m_counters[1].m_count);
+        EXPECT_EQ(1, m_counters[2].m_count);
+        EXPECT_TRUE(m_counters[2].m_lastWorldTM.IsClose(GetWorldTM(2)));
+    }
+
+    TEST_F(TransformComponentDeferredPropagationTest, MoveChild_ParentNotNotified)
+    {
+        TransformBus::Event(m_ids[1], &TransformBus::Events::SetWorldTranslation, Vector3(0.0f, 2.0f, 0.0f));
+        FlushTransforms();
+
+        EXPECT_EQ(0, m_counters[0].m_count);
+        EXPECT_EQ(1, m_counters[1].m_count);
+        EXPECT_EQ(1, m_counters[2].m_count);
+        EXPECT_TRUE(m_counters[2].m_lastWorldTM.GetTranslation().IsClose(Vector3(1.0f, 2.0f, 0.0f)));
+    }
+
+    TEST_F(TransformComponentDeferredPropagationTest, DisableDeferredPropagation_Flushes)
+    {
+        TransformBus::Event(m_ids[0], &TransformBus::Events::SetWorldTranslation, Vector3(0.0f, 1.0f, 0.0f));
+        TransformPropagationRequestBus::Broadcast(&TransformPropagationRequestBus::Events::SetDeferredPropagationEnabled, false);
+
+        EXPECT_EQ(1, m_counters[2].m_count);
+
+        // back to immediate notifications
+        TransformBus::Event(m_ids[0], &TransformBus::Events::SetWorldTranslation, Vector3(0.0f, 2.0f, 0.0f));
+        EXPECT_EQ(2, m_counters[2].m_count);
+        EXPECT_TRUE(m_counters[2].m_lastWorldTM.GetTranslation().IsClose(Vector3(2.0f, 2.0f, 0.0f)));
+    }
+
+    TEST_F(TransformComponentDeferredPropagationTest, DeactivatePendingEntities_DoesNotNotify)
+    {
+        TransformBus::Event(m_ids[0], &TransformBus::Events::SetWorldTranslation, Vector3(0.0f, 1.0f, 0.0f));
+        m_entities[1]->Deactivate();
+        m_entities[0]->Deactivate();
+        FlushTransforms();
+
+        EXPECT_EQ(0, m_counters[0].m_count);
+        EXPECT_EQ(0, m_counters[1].m_count);
+
+        // the grandchild lost its parent and still gets its single notification
+        EXPECT_EQ(1, m_counters[2].m_count);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // AzToolsFramework::Components::TransformComponent
 
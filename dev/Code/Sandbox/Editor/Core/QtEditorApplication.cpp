@@ -65,6 +65,18 @@ enum
     UninitializedFrequency = 9999,
 };
 
+//! Converts a frame rate cvar into an idle timer period in milliseconds, using fallbackPeriod when the cvar is unset or 0.
+static int GetIdlePeriodForFrameRate(const char* cvarName, int fallbackPeriod)
+{
+    ICVar* frameRateCVar = (gEnv && gEnv->pConsole) ? gEnv->pConsole->GetCVar(cvarName) : nullptr;
+    const int frameRate = frameRateCVar ? frameRateCVar->GetIVal() : 0;
+    if (frameRate <= 0)
+    {
+        return fallbackPeriod;
+    }
+    return AZStd::max(1, 1000 / frameRate);
+}
+
 #ifdef DEPRECATED_QML_SUPPORT
 
 // QML imports that go in the editor folder (relative to the project root)
@@ -278,6 +290,8 @@ namespace Editor
         , m_idleTimer(new QTimer(this))
     {
         m_idleTimer->setInterval(UninitializedFrequency);
+        m_idleTimer->setTimerType(Qt::PreciseTimer);
+        m_idleClock.start();
 
         setWindowIcon(QIcon(":/Application/res/editor_icon.ico"));
 
@@ -366,6 +380,26 @@ namespace Editor
                 winapp->OnIdle(0);
             }
         }
+
+        PaceIdleTimer();
+    }
+
+    void EditorQtApplication::PaceIdleTimer()
+    {
+        if (m_idlePeriod <= 0)
+        {
+            // game mode runs flat out
+            return;
+        }
+
+        // aim for the next deadline on the fixed cadence; if we overran it, start again from now rather than bursting to catch up
+        const qint64 now = m_idleClock.elapsed();
+        m_nextIdleTick += m_idlePeriod;
+        if (m_nextIdleTick < now)
+        {
+            m_nextIdleTick = now;
+        }
+        m_idleTimer->setInterval(static_cast<int>(m_nextIdleTick - now));
     }
 
     void EditorQtApplication::InstallQtLogHandler()
@@ -756,19 +790,30 @@ namespace Editor
         // Game mode takes precedence over anything else
         if (isInGameMode)
         {
-            m_idleTimer->setInterval(GameModeIdleFrequency);
+            m_idlePeriod = GameModeIdleFrequency;
         }
         else
         {
             if (applicationState() & Qt::ApplicationActive)
             {
-                m_idleTimer->setInterval(EditorModeIdleFrequency);
+                m_idlePeriod = GetIdlePeriodForFrameRate("ed_maxFrameRate", EditorModeIdleFrequency);
             }
             else
             {
-                m_idleTimer->setInterval(InactiveModeFrequency);
+                m_idlePeriod = GetIdlePeriodForFrameRate("ed_inactiveMaxFrameRate", InactiveModeFrequency);
             }
         }
+
+        m_idleTimer->setInterval(m_idlePeriod);
+        m_nextIdleTick = m_idleClock.elapsed() + m_idlePeriod;
+    }
+
+    void EditorQtApplication::RefreshIdleTimerInterval()
+    {
+        if (m_idleTimer->interval() != UninitializedFrequency)
+        {
+            ResetIdleTimerInterval();
+        }
     }
 
     bool EditorQtApplication::eventFilter(QObject* object, QEvent* event)
@@ -14,6 +14,7 @@
 #include <QApplication>
 #include <QAbstractNativeEventFilter>
 #include <QColor>
+#include <QElapsedTimer>
 #include <QMap>
 #include <QTranslator>
 #include <QSet>
@@ -99,6 +100,9 @@ namespace Editor
 
         void EnableOnIdle(bool enable = true);
 
+        //! Re-reads the ed_maxFrameRate / ed_inactiveMaxFrameRate limits and re-paces the idle timer.
+        void RefreshIdleTimerInterval();
+
         bool eventFilter(QObject* object, QEvent* event) override;
 
         QSet<int> pressedKeys() const { return m_pressedKeys; }
@@ -134,6 +138,7 @@ namespace Editor
         void InstallFilters();
         void UninstallFilters();
         void maybeProcessIdle();
+        void PaceIdleTimer();
 
         AzQtComponents::LumberyardStylesheet* m_stylesheet;
 
@@ -153,6 +158,11 @@ namespace Editor
         QTranslator* m_flowgraphTranslator = nullptr;
         QTranslator* m_assetBrowserTranslator = nullptr;
         QTimer* const m_idleTimer = nullptr;
+        // idle updates are scheduled against fixed deadlines so that time spent in
+        // OnIdle (or in other Qt work) doesn't stretch the frame period
+        QElapsedTimer m_idleClock;
+        qint64 m_nextIdleTick = 0;
+        int m_idlePeriod = 0;
         bool m_isMovingOrResizing = false;
 
         AZ::UserSettingsProvider m_localUserSettings;
@@ -13,6 +13,7 @@
 
 #include "StdAfx.h"
 #include "MainWindow.h"
+#include "Core/QtEditorApplication.h"
 
 #include "ISourceControl.h"
 
@@ -47,6 +48,14 @@ void ToolbarIconSizeChanged(ICVar* toolbarIconSize)
     MainWindow::instance()->AdjustToolBarIconSize();
 }
 
+void EditorFrameRateChanged(ICVar*)
+{
+    if (Editor::EditorQtApplication* app = Editor::EditorQtApplication::instance())
+    {
+        app->RefreshIdleTimerInterval();
+    }
+}
+
 class SettingsGroup
 {
 public:
@@ -1125,6 +1134,8 @@ void SEditorSettings::PostInitApply()
     REGISTER_CVAR2("ed_backgroundUpdatePeriod", &backgroundUpdatePeriod, backgroundUpdatePeriod, 0, "Delay between frame updates (ms) when window is out of focus but not minimized. 0 = disable background update");
     REGISTER_CVAR2("ed_showErrorDialogOnLoad", &showErrorDialogOnLoad, showErrorDialogOnLoad, 0, "Show error dialog on level load");
     REGISTER_CVAR2_CB("ed_keepEditorActive", &keepEditorActive, 0, VF_NULL, "Keep the editor active, even if no focus is set", KeepEditorActiveChanged);
+    gEnv->pConsole->RegisterInt("ed_maxFrameRate", 0, VF_NULL, "Maximum editor updates per second while the editor has focus. 0 = update as often as the event loop allows", EditorFrameRateChanged);
+    gEnv->pConsole->RegisterInt("ed_inactiveMaxFrameRate", 0, VF_NULL, "Maximum editor updates per second while the editor is unfocused but kept active. 0 = default (100)", EditorFrameRateChanged);
     REGISTER_CVAR2("g_TemporaryLevelName", &g_TemporaryLevelName, "temp_level", VF_NULL, "Temporary level named used for experimental levels.");
 
     gEnv->pConsole->RegisterInt("ed_showActorEntity", 0, VF_DUMPTODISK|VF_REQUIRE_APP_RESTART, "Change this to true to make the Actor Entity option appear (Legacy)");
@@ -1300,10 +1300,20 @@ void OutlinerListModel::QueueEntityUpdate(AZ::EntityId entityId)
 void OutlinerListModel::QueueAncestorUpdate(AZ::EntityId entityId)
 {
     //primarily needed for ancestors that reflect child state (selected, locked, hidden)
+    if (m_layoutResetQueued)
+    {
+        return;
+    }
+
     AZ::EntityId parentId;
     AzToolsFramework::EditorEntityInfoRequestBus::EventResult(parentId, entityId, &AzToolsFramework::EditorEntityInfoRequestBus::Events::GetParent);
     for (AZ::EntityId currentId = parentId; currentId.IsValid(); currentId = parentId)
     {
+        if (!m_ancestorUpdateQueue.insert(currentId).second)
+        {
+            // This ancestor and everything above it is already queued.
+            break;
+        }
         QueueEntityUpdate(currentId);
         parentId.SetInvalid();
         AzToolsFramework::EditorEntityInfoRequestBus::EventResult(parentId, currentId, &AzToolsFramework::EditorEntityInfoRequestBus::Events::GetParent);
@@ -1330,6 +1340,8 @@ void OutlinerListModel::ProcessEntityUpdates()
 {
     AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Editor);
     m_entityChangeQueued = false;
+    m_ancestorUpdateQueue.clear();
+    m_ancestorExpandQueue.clear();
     if (m_layoutResetQueued)
     {
         return;
@@ -1424,6 +1436,8 @@ void OutlinerListModel::ProcessEntityInfoResetEnd()
     m_layoutResetQueued = false;
     m_entityChangeQueued = false;
     m_entityChangeQueue.clear();
+    m_ancestorUpdateQueue.clear();
+    m_ancestorExpandQueue.clear();
     QueueEntityUpdate(AZ::EntityId());
     emit EnableSelectionUpdates(true);
 }
@@ -1717,7 +1731,7 @@ void OutlinerListModel::ExpandAncestors(const AZ::EntityId& entityId)
 {
     AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
     //typically to reveal selected entities, expand all parent entities
-    if (entityId.IsValid())
+    if (entityId.IsValid() && m_ancestorExpandQueue.insert(entityId).second)
     {
         AZ::EntityId parentId;
         AzToolsFramework::EditorEntityInfoRequestBus::EventResult(parentId, entityId, &AzToolsFramework::EditorEntityInfoRequestBus::Events::GetParent);
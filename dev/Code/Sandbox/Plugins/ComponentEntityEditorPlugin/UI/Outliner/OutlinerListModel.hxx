@@ -193,6 +193,10 @@ protected:
     AZStd::unordered_set<AZ::EntityId> m_entitySelectQueue;
     AZStd::unordered_set<AZ::EntityId> m_entityExpandQueue;
     AZStd::unordered_set<AZ::EntityId> m_entityChangeQueue;
+    // Entities whose whole ancestor chain was already queued for update/expansion since the last ProcessEntityUpdates,
+    // so selecting thousands of siblings walks their shared ancestors once instead of once per entity.
+    AZStd::unordered_set<AZ::EntityId> m_ancestorUpdateQueue;
+    AZStd::unordered_set<AZ::EntityId> m_ancestorExpandQueue;
     bool m_entityChangeQueued;
     bool m_entityLayoutQueued;
     bool m_dropOperationInProgress = false;
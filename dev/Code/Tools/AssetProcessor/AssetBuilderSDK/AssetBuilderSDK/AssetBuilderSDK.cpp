@@ -1102,13 +1102,14 @@ namespace AssetBuilderSDK
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<AssetBuilderDesc>()
-                ->Version(2)
+                ->Version(3)
                 ->Field("Flags", &AssetBuilderDesc::m_flags)
                 ->Field("Name", &AssetBuilderDesc::m_name)
                 ->Field("Patterns", &AssetBuilderDesc::m_patterns)
                 ->Field("BusId", &AssetBuilderDesc::m_busId)
                 ->Field("Version", &AssetBuilderDesc::m_version)
-                ->Field("AnalysisFingerprint", &AssetBuilderDesc::m_analysisFingerprint);
+                ->Field("AnalysisFingerprint", &AssetBuilderDesc::m_analysisFingerprint)
+                ->Field("MaxConcurrentJobs", &AssetBuilderDesc::m_maxConcurrentJobs);
         }
     }
 
@@ -277,6 +277,10 @@ namespace AssetBuilderSDK
         //! If you change your flags, bump the version number of your builder, too.
         AZ::u8 m_flags = 0;
 
+        //! The maximum number of jobs of this builder the asset processor will run at once, 0 for no limit.
+        //! Set this for builders whose jobs use a lot of memory, so that a full rebuild does not run many of them side by side.
+        AZ::u32 m_maxConcurrentJobs = 0;
+
         bool IsExternalBuilder() const;
 
         // Note that we don't serialize the function pointer fields as part of the registration since they should not be
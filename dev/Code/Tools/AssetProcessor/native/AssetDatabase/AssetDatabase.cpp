@@ -1121,6 +1121,22 @@ namespace AssetProcessor
         }
     }
 
+    void AssetDatabaseConnection::BeginWriteBatch()
+    {
+        if (m_databaseConnection)
+        {
+            m_databaseConnection->BeginTransaction();
+        }
+    }
+
+    void AssetDatabaseConnection::CommitWriteBatch()
+    {
+        if (m_databaseConnection)
+        {
+            m_databaseConnection->CommitTransaction();
+        }
+    }
+
     bool AssetDatabaseConnection::GetScanFolderByScanFolderID(AZ::s64 scanfolderID, ScanFolderDatabaseEntry& entry)
     {
         bool found = false;
@@ -48,6 +48,11 @@ namespace AssetProcessor
         } 
         void VacuumAndAnalyze();
 
+        //! Every write between BeginWriteBatch and CommitWriteBatch is committed to disk in one transaction.
+        //! The Set/Remove functions keep working as usual inside a batch.
+        void BeginWriteBatch();
+        void CommitWriteBatch();
+
     protected:
         void CreateStatements() override;
         bool PostOpenDatabase() override;
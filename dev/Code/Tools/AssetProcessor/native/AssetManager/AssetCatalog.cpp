@@ -25,6 +25,7 @@
 #include <AzCore/std/string/conversions.h>
 #include <AzFramework/API/ApplicationAPI.h>
 #include <AzFramework/Asset/AssetRegistry.h>
+#include <AzFramework/Asset/BinaryAssetRegistry.h>
 #include <AzFramework/Asset/AssetProcessorMessages.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
@@ -160,33 +161,19 @@ namespace AssetProcessor
         if (m_catalogIsDirty)
         {
             m_catalogIsDirty = false;
-            // Reflect registry for serialization.
-            AZ::SerializeContext* serializeContext = nullptr;
-            EBUS_EVENT_RESULT(serializeContext, AZ::ComponentApplicationBus, GetSerializeContext);
-            AZ_Assert(serializeContext, "Unable to retrieve serialize context.");
-            if (nullptr == serializeContext->FindClassData(AZ::AzTypeInfo<AzFramework::AssetRegistry>::Uuid()))
-            {
-                AzFramework::AssetRegistry::ReflectSerialize(serializeContext);
-            }
 
             // save out a catalog for each platform
             for (const QString& platform : m_platforms)
             {
-                // Serialize out the catalog to a memory buffer, and then dump that memory buffer to stream.
+                // Flatten the catalog into a memory buffer, and then dump that memory buffer to stream.
+                // The runtime uses the binary image as it is read, see AzFramework::BinaryAssetRegistry.
                 QElapsedTimer timer;
                 timer.start();
-                m_saveBuffer.clear();
-                // allow this to grow by up to 20mb at a time so as not to fragment.
-                // we re-use the save buffer each time to further reduce memory load.
-                AZ::IO::ByteContainerStream<AZStd::vector<char>> catalogFileStream(&m_saveBuffer, 1024 * 1024 * 20);
-
-                // these 3 lines are what writes the entire registry to the memory stream
-                AZ::ObjectStream* objStream = AZ::ObjectStream::Create(&catalogFileStream, *serializeContext, AZ::ObjectStream::ST_BINARY);
+                // we re-use the save buffer each time to reduce memory load.
                 {
                     QMutexLocker locker(&m_registriesMutex);
-                    objStream->WriteClass(&m_registries[platform]);
+                    AzFramework::BinaryAssetRegistry::Write(m_registries[platform], m_saveBuffer);
                 }
-                objStream->Finalize();
 
                 // now write the memory stream out to the temp folder
                 QString workSpace;
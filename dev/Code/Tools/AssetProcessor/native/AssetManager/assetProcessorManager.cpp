@@ -955,6 +955,9 @@ namespace AssetProcessor
             }
         }
 
+        // writing every row of every job as its own transaction makes the database the bottleneck when many jobs finish at once.
+        m_stateData->BeginWriteBatch();
+
         //process the asset list
         for (AssetProcessedEntry& processedAsset : m_assetProcessedList)
         {
@@ -1338,6 +1341,8 @@ namespace AssetProcessor
             }
         }
 
+        m_stateData->CommitWriteBatch();
+
         m_assetProcessedList.clear();
         // we know that things have changed at this point; ensure that we check for idle after we've finished processing all of our assets
         // and don't rely on the file watcher to check again.
@@ -1554,10 +1559,11 @@ namespace AssetProcessor
 
         m_assetProcessedList.push_back(AssetProcessedEntry(jobEntry, response));
 
+        // the jobs that finish before the queue is processed are recorded together, in a single database transaction.
         if (!m_processedQueued)
         {
             m_processedQueued = true;
-            AssetProcessed_Impl();
+            QMetaObject::invokeMethod(this, "AssetProcessed_Impl", Qt::QueuedConnection);
         }
     }
 
@@ -17,9 +17,33 @@
 #include <QFileInfo>
 #include <QFileInfoList>
 #include <QDateTime>
+#include <QRunnable>
+#include <QThreadPool>
 
 using namespace AssetProcessor;
 
+class AssetScannerWorker::ScanFolderTask
+    : public QRunnable
+{
+public:
+    ScanFolderTask(AssetScannerWorker* worker, const ScanFolderInfo& scanFolderInfo, QThreadPool* threadPool)
+        : m_worker(worker)
+        , m_scanFolderInfo(scanFolderInfo)
+        , m_threadPool(threadPool)
+    {
+    }
+
+    void run() override
+    {
+        m_worker->ScanForSourceFiles(m_scanFolderInfo, m_threadPool);
+    }
+
+private:
+    AssetScannerWorker* m_worker;
+    ScanFolderInfo m_scanFolderInfo;
+    QThreadPool* m_threadPool;
+};
+
 AssetScannerWorker::AssetScannerWorker(PlatformConfiguration* config, QObject* parent)
     : QObject(parent)
     , m_platformConfiguration(config)
@@ -40,10 +64,21 @@ void AssetScannerWorker::StartScan()
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Started);
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::InProgress);
 
-    for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
+    // walking the directory tree is bound by the latency of the file system rather than by the CPU,
+    // so every folder is listed as its own task and many of them are kept in flight at once.
+    // the pool is private to the scan so that it does not compete with the jobs in the global pool.
     {
-        ScanFolderInfo scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
-        ScanForSourceFiles(scanFolderInfo);
+        QThreadPool scanThreadPool;
+        scanThreadPool.setMaxThreadCount(qMax(QThread::idealThreadCount(), 1) * 2);
+
+        for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
+        {
+            ScanFolderInfo scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
+            scanThreadPool.start(new ScanFolderTask(this, scanFolderInfo, &scanThreadPool));
+        }
+
+        // tasks queue their sub folders before they finish, so this returns once the whole tree was visited
+        scanThreadPool.waitForDone();
     }
     // we want not to emit any signals until we're finished scanning
     // so that we don't interleave directory tree walking (IO access to the file table)
@@ -74,7 +109,7 @@ void AssetScannerWorker::StopScan()
     m_doScan = false;
 }
 
-void AssetScannerWorker::ScanForSourceFiles(ScanFolderInfo scanFolderInfo)
+void AssetScannerWorker::ScanForSourceFiles(ScanFolderInfo scanFolderInfo, QThreadPool* threadPool)
 {
     if (!m_doScan)
     {
@@ -95,6 +130,10 @@ void AssetScannerWorker::ScanForSourceFiles(ScanFolderInfo scanFolderInfo)
         entries = dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files);
     }
 
+    // collect locally and merge once, so that the tasks only contend on the lists once per folder
+    QSet<AssetFileInfo> fileList;
+    QSet<AssetFileInfo> folderList;
+
     for (const QFileInfo& entry : entries)
     {
         if (!m_doScan) // scan was cancelled!
@@ -115,9 +154,9 @@ void AssetScannerWorker::ScanForSourceFiles(ScanFolderInfo scanFolderInfo)
         {
             //Entry is a directory
             AZ::u64 modTime = entry.lastModified().toMSecsSinceEpoch();
-            m_folderList.insert(AssetFileInfo(absPath, modTime, isDirectory));
+            folderList.insert(AssetFileInfo(absPath, modTime, isDirectory));
             ScanFolderInfo tempScanFolderInfo(absPath, "", "", "", false, true);
-            ScanForSourceFiles(tempScanFolderInfo);
+            threadPool->start(new ScanFolderTask(this, tempScanFolderInfo, threadPool));
         }
         else
         {
@@ -142,9 +181,13 @@ void AssetScannerWorker::ScanForSourceFiles(ScanFolderInfo scanFolderInfo)
 
             //Entry is a file
             AZ::u64 modTime = entry.lastModified().toMSecsSinceEpoch();
-            m_fileList.insert(AssetFileInfo(absPath, modTime, isDirectory));
+            fileList.insert(AssetFileInfo(absPath, modTime, isDirectory));
         }
     }
+
+    QMutexLocker locker(&m_scanResultsMutex);
+    m_fileList.unite(fileList);
+    m_folderList.unite(folderList);
 }
 
 void AssetScannerWorker::EmitFiles()
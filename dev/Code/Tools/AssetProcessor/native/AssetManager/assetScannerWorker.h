@@ -16,6 +16,9 @@
 #include <QString>
 #include <QSet>
 #include <QObject>
+#include <QMutex>
+
+class QThreadPool;
 
 namespace AssetProcessor
 {
@@ -43,11 +46,16 @@ Q_SIGNALS:
         void StopScan();
 
     protected:
-        void ScanForSourceFiles(ScanFolderInfo scanFolderInfo);
+        //! Scans a single folder and queues its sub folders on the thread pool, so that scan folders and their
+        //! sub trees are walked in parallel.  Called from the threads of the pool.
+        void ScanForSourceFiles(ScanFolderInfo scanFolderInfo, QThreadPool* threadPool);
         void EmitFiles();
 
     private:
+        class ScanFolderTask;
+
         volatile bool m_doScan = true;
+        QMutex m_scanResultsMutex; // guards the two lists below while the scan is running
         QSet<AssetFileInfo> m_fileList; // note:  neither QSet nor QString are qobject-derived
         QSet<AssetFileInfo> m_folderList;
         PlatformConfiguration* m_platformConfiguration;
@@ -0,0 +1,253 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#include "FileWatcher.h"
+
+#include <AzCore/Debug/Trace.h>
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QHash>
+#include <QSet>
+
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace
+{
+    // Events we care about on every watched directory. IN_CLOSE_WRITE is included so that a file which is
+    // written in many small chunks is reported as modified again once the writer is done with it.
+    const uint32_t s_watchMask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_ONLYDIR;
+}
+
+struct FolderRootWatch::PlatformImplementation
+{
+    PlatformImplementation() : m_inotifyHandle(-1) { }
+
+    // Adds a watch for the folder and all its sub folders, inotify watches are not recursive.
+    // When reportExisting is set, files found in newly watched folders are reported as new since
+    // they may have been created before the watch was in place (e.g. a whole folder being copied in).
+    void AddWatchRecursive(FolderRootWatch* watcher, const QString& folder, bool reportExisting)
+    {
+        AddWatch(folder);
+
+        QDirIterator dirIter(folder, QDir::Dirs | QDir::Files | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+        while (dirIter.hasNext())
+        {
+            const QString path = QDir::cleanPath(dirIter.next());
+            const QFileInfo fileInfo = dirIter.fileInfo();
+            if (fileInfo.isDir() && !fileInfo.isSymLink())
+            {
+                AddWatch(path);
+            }
+            if (reportExisting)
+            {
+                watcher->ProcessNewFileEvent(path);
+            }
+        }
+    }
+
+    void AddWatch(const QString& folder)
+    {
+        int watchHandle = inotify_add_watch(m_inotifyHandle, folder.toUtf8().constData(), s_watchMask);
+        if (watchHandle < 0)
+        {
+            // ENOSPC means fs.inotify.max_user_watches is too low for this many folders
+            AZ_Warning("FileWatcher", false, "Unable to watch folder %s (%s). Changes in it will not be reported.", folder.toUtf8().constData(), strerror(errno));
+            return;
+        }
+        m_handleToFolderMap[watchHandle] = folder;
+    }
+
+    void RemoveWatch(int watchHandle)
+    {
+        // the kernel already dropped the watch when the folder was deleted or its file system unmounted
+        m_handleToFolderMap.remove(watchHandle);
+    }
+
+    int m_inotifyHandle;
+    QHash<int, QString> m_handleToFolderMap;
+};
+
+//////////////////////////////////////////////////////////////////////////////
+/// FolderWatchRoot
+FolderRootWatch::FolderRootWatch(const QString rootFolder)
+    : m_root(rootFolder)
+    , m_shutdownThreadSignal(false)
+    , m_fileWatcher(nullptr)
+    , m_platformImpl(new PlatformImplementation())
+{
+}
+
+FolderRootWatch::~FolderRootWatch()
+{
+    // Destructor is required in here since this file contains the definition of struct PlatformImplementation
+    Stop();
+
+    delete m_platformImpl;
+}
+
+bool FolderRootWatch::Start()
+{
+    m_shutdownThreadSignal = false;
+
+    m_platformImpl->m_inotifyHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    AZ_Error("FileWatcher", (m_platformImpl->m_inotifyHandle >= 0), "inotify_init1 failed (%s). No file events will be reported for %s", strerror(errno), m_root.toUtf8().constData());
+    if (m_platformImpl->m_inotifyHandle < 0)
+    {
+        return false;
+    }
+
+    // Watches are added before the thread starts so that nothing that happens after Start() returns is missed.
+    m_platformImpl->AddWatchRecursive(this, QDir::cleanPath(m_root), false);
+
+    m_thread = std::thread(std::bind(&FolderRootWatch::WatchFolderLoop, this));
+
+    return true;
+}
+
+void FolderRootWatch::Stop()
+{
+    m_shutdownThreadSignal = true;
+
+    if (m_thread.joinable())
+    {
+        m_thread.join(); // wait for the thread to finish
+        m_thread = std::thread(); //destroy
+    }
+
+    if (m_platformImpl->m_inotifyHandle >= 0)
+    {
+        // closing the handle removes all of its watches
+        close(m_platformImpl->m_inotifyHandle);
+        m_platformImpl->m_inotifyHandle = -1;
+    }
+    m_platformImpl->m_handleToFolderMap.clear();
+}
+
+void FolderRootWatch::WatchFolderLoop()
+{
+    // Use a half second timeout so that we can check if m_shutdownThreadSignal has been changed
+    static const int millisecondsToWait = 500;
+
+    // Large enough for a few hundred events in a single read, it must be aligned for inotify_event
+    alignas(inotify_event) char eventBuffer[64 * 1024];
+
+    pollfd pollInfo;
+    pollInfo.fd = m_platformImpl->m_inotifyHandle;
+    pollInfo.events = POLLIN;
+
+    // Modifications of the same file within one read are sent once, after all the other events of that read.
+    // Editors and tools often write a file in many chunks which would otherwise be reported for every chunk.
+    QStringList modifiedFiles;
+    QSet<QString> modifiedFilesSet;
+
+    while (!m_shutdownThreadSignal)
+    {
+        pollInfo.revents = 0;
+        int pollResult = poll(&pollInfo, 1, millisecondsToWait);
+        if (pollResult <= 0 || !(pollInfo.revents & POLLIN))
+        {
+            continue;
+        }
+
+        ssize_t bytesRead = read(m_platformImpl->m_inotifyHandle, eventBuffer, sizeof(eventBuffer));
+        if (bytesRead <= 0)
+        {
+            continue;
+        }
+
+        for (char* eventPos = eventBuffer; eventPos < eventBuffer + bytesRead; )
+        {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(eventPos);
+            eventPos += sizeof(inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW)
+            {
+                AZ_Warning("FileWatcher", false, "The inotify event queue overflowed, some file changes under %s were missed.", m_root.toUtf8().constData());
+                continue;
+            }
+
+            if (event->mask & (IN_DELETE_SELF | IN_IGNORED))
+            {
+                m_platformImpl->RemoveWatch(event->wd);
+                continue;
+            }
+
+            auto folderIter = m_platformImpl->m_handleToFolderMap.find(event->wd);
+            if (folderIter == m_platformImpl->m_handleToFolderMap.end() || event->len == 0)
+            {
+                continue;
+            }
+
+            const QString fileAndPath = QDir::cleanPath(folderIter.value() + QDir::separator() + QString::fromUtf8(event->name));
+
+            if (event->mask & (IN_CREATE | IN_MOVED_TO))
+            {
+                ProcessNewFileEvent(fileAndPath);
+
+                if (event->mask & IN_ISDIR)
+                {
+                    m_platformImpl->AddWatchRecursive(this, fileAndPath, true);
+                }
+            }
+
+            if (event->mask & (IN_MODIFY | IN_CLOSE_WRITE))
+            {
+                if (!modifiedFilesSet.contains(fileAndPath))
+                {
+                    modifiedFilesSet.insert(fileAndPath);
+                    modifiedFiles.append(fileAndPath);
+                }
+            }
+
+            if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+            {
+                // the kernel keeps watching a folder that was moved away, drop the watches of it and everything under
+                // it, if it was moved somewhere else under the root IN_MOVED_TO adds them again with the new paths
+                if ((event->mask & IN_MOVED_FROM) && (event->mask & IN_ISDIR))
+                {
+                    const QString movedFolderPrefix = fileAndPath + QDir::separator();
+                    for (auto handleIter = m_platformImpl->m_handleToFolderMap.begin(); handleIter != m_platformImpl->m_handleToFolderMap.end(); )
+                    {
+                        if (handleIter.value() == fileAndPath || handleIter.value().startsWith(movedFolderPrefix))
+                        {
+                            inotify_rm_watch(m_platformImpl->m_inotifyHandle, handleIter.key());
+                            handleIter = m_platformImpl->m_handleToFolderMap.erase(handleIter);
+                        }
+                        else
+                        {
+                            ++handleIter;
+                        }
+                    }
+                }
+
+                // a file deleted after being modified doesn't need the modification reported
+                if (modifiedFilesSet.remove(fileAndPath))
+                {
+                    modifiedFiles.removeOne(fileAndPath);
+                }
+                ProcessDeleteFileEvent(fileAndPath);
+            }
+        }
+
+        for (const QString& modifiedFile : modifiedFiles)
+        {
+            ProcessModifyFileEvent(modifiedFile);
+        }
+        modifiedFiles.clear();
+        modifiedFilesSet.clear();
+    }
+}
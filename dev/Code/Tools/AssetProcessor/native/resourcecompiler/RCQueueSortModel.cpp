@@ -15,9 +15,19 @@
 #include "rcjob.h"
 #include "native/assetprocessor.h"
 #include <AzToolsFramework/API/EditorAssetSystemAPI.h>
+#include <QHash>
+#include <QVector>
 
 namespace AssetProcessor
 {
+    namespace
+    {
+        // used for jobs whose builder has not completed a job yet
+        const qint64 s_defaultExpectedJobDurationMs = 1000;
+        // while jobs keep arriving, the critical paths are recomputed at most this often
+        const qint64 s_criticalPathUpdateIntervalMs = 1000;
+    }
+
     RCQueueSortModel::RCQueueSortModel(QObject* parent)
         : QSortFilterProxyModel(parent)
     {
@@ -47,6 +57,11 @@ namespace AssetProcessor
 
     RCJob* RCQueueSortModel::GetNextPendingJob()
     {
+        if (m_criticalPathsDirty && (!m_criticalPathsTimer.isValid() || m_criticalPathsTimer.elapsed() >= s_criticalPathUpdateIntervalMs))
+        {
+            UpdateCriticalPaths();
+        }
+
         if (m_dirtyNeedsResort)
         {
             setDynamicSortFilter(false);
@@ -61,6 +76,17 @@ namespace AssetProcessor
             RCJob* actualJob = m_sourceModel->getItem(parentIndex.row());
             if ((actualJob) && (actualJob->GetState() == RCJob::pending))
             {
+                const AZ::u32 maxConcurrentJobs = actualJob->GetMaxConcurrentJobs();
+                if (maxConcurrentJobs > 0 && !actualJob->IsAutoFail())
+                {
+                    auto inFlight = m_inFlightJobsPerBuilder.find(actualJob->GetBuilderGuid());
+                    if (inFlight != m_inFlightJobsPerBuilder.end() && inFlight->second >= maxConcurrentJobs)
+                    {
+                        // this builder is at its limit, let jobs of other builders through until one of its jobs finishes
+                        continue;
+                    }
+                }
+
                 bool canProcessJob = true;
                 for (const JobDependencyInternal& jobDepedencyInternal : actualJob->GetJobDependencies())
                 {
@@ -197,6 +223,16 @@ namespace AssetProcessor
         {
             return priorityLeft > priorityRight;
         }
+
+        // start the jobs that have the longest chain of work depending on them first, so slow jobs and the jobs
+        // waiting on them are not left as a long tail at the end of a rebuild
+        qint64 criticalPathLeft = GetCriticalPathCost(leftJob);
+        qint64 criticalPathRight = GetCriticalPathCost(rightJob);
+
+        if (criticalPathLeft != criticalPathRight)
+        {
+            return criticalPathLeft > criticalPathRight;
+        }
         
         // if we get all the way down here it means we're dealing with two assets which are not
         // in any compile groups, not a priority platform, not a priority type, priority platform, etc.
@@ -230,11 +266,151 @@ namespace AssetProcessor
     void RCQueueSortModel::AddJobIdEntry(AssetProcessor::RCJob* rcJob)
     {
         m_currentJobRunKeyToJobEntries[rcJob->GetJobEntry().m_jobRunKey] = rcJob;
+        m_criticalPathsDirty = true;
     }
 
     void RCQueueSortModel::RemoveJobIdEntry(AssetProcessor::RCJob* rcJob)
     {
         m_currentJobRunKeyToJobEntries.erase(rcJob->GetJobEntry().m_jobRunKey);
+        m_criticalPathCosts.erase(rcJob);
+    }
+
+    void RCQueueSortModel::OnJobStarted(AssetProcessor::RCJob* rcJob)
+    {
+        ++m_inFlightJobsPerBuilder[rcJob->GetBuilderGuid()];
+    }
+
+    void RCQueueSortModel::OnJobFinished(AssetProcessor::RCJob* rcJob)
+    {
+        auto inFlight = m_inFlightJobsPerBuilder.find(rcJob->GetBuilderGuid());
+        if (inFlight != m_inFlightJobsPerBuilder.end() && inFlight->second > 0)
+        {
+            --inFlight->second;
+        }
+
+        if (rcJob->GetState() == RCJob::completed && rcJob->GetTimeLaunched().isValid())
+        {
+            const qint64 duration = rcJob->GetTimeLaunched().msecsTo(QDateTime::currentDateTime());
+            auto found = m_builderAverageDurations.find(rcJob->GetBuilderGuid());
+            if (found == m_builderAverageDurations.end())
+            {
+                m_builderAverageDurations[rcJob->GetBuilderGuid()] = duration;
+            }
+            else
+            {
+                // moving average, recent jobs of a builder are the best guess for its next ones
+                found->second = (found->second * 3 + duration) / 4;
+            }
+        }
+    }
+
+    qint64 RCQueueSortModel::GetExpectedDuration(RCJob* rcJob) const
+    {
+        auto found = m_builderAverageDurations.find(rcJob->GetBuilderGuid());
+        return found != m_builderAverageDurations.end() ? AZStd::max<qint64>(found->second, 1) : s_defaultExpectedJobDurationMs;
+    }
+
+    qint64 RCQueueSortModel::GetCriticalPathCost(RCJob* rcJob) const
+    {
+        auto found = m_criticalPathCosts.find(rcJob);
+        return found != m_criticalPathCosts.end() ? found->second : GetExpectedDuration(rcJob);
+    }
+
+    void RCQueueSortModel::UpdateCriticalPaths()
+    {
+        m_criticalPathsDirty = false;
+        m_criticalPathsTimer.start();
+        m_criticalPathCosts.clear();
+
+        if (!m_sourceModel)
+        {
+            return;
+        }
+
+        QHash<QueueElementID, RCJob*> pendingJobs;
+        for (int idx = 0; idx < m_sourceModel->itemCount(); ++idx)
+        {
+            RCJob* rcJob = m_sourceModel->getItem(idx);
+            if (rcJob && rcJob->GetState() == RCJob::pending)
+            {
+                pendingJobs.insert(rcJob->GetElementID(), rcJob);
+            }
+        }
+
+        // invert the order dependencies, each pending job gets the pending jobs that wait for it
+        QHash<RCJob*, QVector<RCJob*>> dependents;
+        for (RCJob* rcJob : pendingJobs)
+        {
+            for (const JobDependencyInternal& jobDependencyInternal : rcJob->GetJobDependencies())
+            {
+                const AssetBuilderSDK::JobDependency& jobDependency = jobDependencyInternal.m_jobDependency;
+                if (jobDependency.m_type != AssetBuilderSDK::JobDependencyType::Order)
+                {
+                    continue;
+                }
+
+                QueueElementID elementId(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str(), jobDependency.m_platformIdentifier.c_str(), jobDependency.m_jobKey.c_str());
+                auto dependency = pendingJobs.find(elementId);
+                if (dependency != pendingJobs.end() && dependency.value() != rcJob)
+                {
+                    dependents[dependency.value()].push_back(rcJob);
+                }
+            }
+        }
+
+        // the cost of a job is its own expected duration plus the most expensive chain waiting on it.
+        // iterative depth first walk, dependency chains can be long. Jobs in a cycle count as already visited.
+        struct StackEntry
+        {
+            RCJob* m_job;
+            int m_nextDependent;
+        };
+        QVector<StackEntry> stack;
+        QSet<RCJob*> visiting;
+        for (RCJob* rootJob : pendingJobs)
+        {
+            if (m_criticalPathCosts.find(rootJob) != m_criticalPathCosts.end())
+            {
+                continue;
+            }
+
+            stack.push_back({ rootJob, 0 });
+            visiting.insert(rootJob);
+            while (!stack.isEmpty())
+            {
+                StackEntry& entry = stack.back();
+                auto jobDependents = dependents.constFind(entry.m_job);
+                if (jobDependents != dependents.constEnd() && entry.m_nextDependent < jobDependents.value().size())
+                {
+                    RCJob* dependent = jobDependents.value()[entry.m_nextDependent++];
+                    if (!visiting.contains(dependent) && m_criticalPathCosts.find(dependent) == m_criticalPathCosts.end())
+                    {
+                        visiting.insert(dependent);
+                        stack.push_back({ dependent, 0 });
+                    }
+                    continue;
+                }
+
+                qint64 longestDependentPath = 0;
+                if (jobDependents != dependents.constEnd())
+                {
+                    for (RCJob* dependent : jobDependents.value())
+                    {
+                        auto dependentCost = m_criticalPathCosts.find(dependent);
+                        if (dependentCost != m_criticalPathCosts.end())
+                        {
+                            longestDependentPath = AZStd::max(longestDependentPath, dependentCost->second);
+                        }
+                    }
+                }
+
+                m_criticalPathCosts[entry.m_job] = GetExpectedDuration(entry.m_job) + longestDependentPath;
+                visiting.remove(entry.m_job);
+                stack.pop_back();
+            }
+        }
+
+        m_dirtyNeedsResort = true;
     }
 
     void RCQueueSortModel::OnEscalateJobs(AssetProcessor::JobIdEscalationList jobIdEscalationList)
@@ -13,6 +13,7 @@
 #define ASSETPROCESSOR_RCQUEUESORTMODEL_H
 
 #include <QSortFilterProxyModel>
+#include <QElapsedTimer>
 #include <QSet>
 #include <QString>
 
@@ -35,7 +36,9 @@ namespace AssetProcessor
     //!  * Jobs in Sync Compile Requests for currently connected platforms (with most recent requests first)
     //!  * Jobs in Async Compile Lists for currently connected platforms
     //!  * Remaining jobs in currently connected platforms, in priority order
+    //!    then longest chain of dependent work first (using the durations observed for each builder)
     //!  (The same, repeated, for unconnected platforms).
+    //! Jobs whose builder already runs its maximum number of concurrent jobs are held back.
     class RCQueueSortModel
         : public QSortFilterProxyModel
         , protected AssetProcessorPlatformBus::Handler
@@ -51,6 +54,10 @@ namespace AssetProcessor
         void AddJobIdEntry(AssetProcessor::RCJob* rcJob);
         void RemoveJobIdEntry(AssetProcessor::RCJob* rcJob);
 
+        //! Keeps the per builder in flight counts and duration estimates up to date.
+        void OnJobStarted(AssetProcessor::RCJob* rcJob);
+        void OnJobFinished(AssetProcessor::RCJob* rcJob);
+
 
         // implement QSortFilteRProxyModel:
         bool filterAcceptsRow(int source_row, const QModelIndex& source_parent) const override;
@@ -69,6 +76,17 @@ namespace AssetProcessor
         QSet<QString> m_currentlyConnectedPlatforms;
         bool m_dirtyNeedsResort = false; // instead of constantly resorting, we resort only when someone wants to pull an element from us
 
+        //! Computes, for every pending job, the expected duration of the longest chain of pending jobs waiting on it.
+        void UpdateCriticalPaths();
+        qint64 GetExpectedDuration(RCJob* rcJob) const;
+        qint64 GetCriticalPathCost(RCJob* rcJob) const;
+
+        AZStd::unordered_map<AZ::Uuid, qint64> m_builderAverageDurations; // in milliseconds, from jobs completed this session
+        AZStd::unordered_map<AZ::Uuid, AZ::u32> m_inFlightJobsPerBuilder;
+        AZStd::unordered_map<const RCJob*, qint64> m_criticalPathCosts;
+        bool m_criticalPathsDirty = false;
+        QElapsedTimer m_criticalPathsTimer; // limits how often the critical paths are recomputed while jobs keep arriving
+
         // ---------------------------------------------------------
         // AssetProcessorPlatformBus::Handler
         void AssetProcessorPlatformConnected(const AZStd::string platform) override;
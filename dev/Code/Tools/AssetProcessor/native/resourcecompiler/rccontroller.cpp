@@ -88,6 +88,7 @@ namespace AssetProcessor
 
         // Mark as "being processed" by moving to Processing list
         m_RCJobListModel.markAsProcessing(rcJob);
+        m_RCQueueSortModel.OnJobStarted(rcJob);
         Q_EMIT JobStatusChanged(rcJob->GetJobEntry(), AzToolsFramework::AssetSystem::JobStatus::InProgress);
         rcJob->Start();
         Q_EMIT JobStarted(rcJob->GetJobEntry().m_pathRelativeToWatchFolder, QString::fromUtf8(rcJob->GetPlatformInfo().m_identifier.c_str()));
@@ -118,6 +119,7 @@ namespace AssetProcessor
 
     void RCController::FinishJob(RCJob* rcJob)
     {
+        m_RCQueueSortModel.OnJobFinished(rcJob);
         m_RCQueueSortModel.RemoveJobIdEntry(rcJob);
         QString platform = rcJob->GetPlatformInfo().m_identifier.c_str();
         auto found = m_jobsCountPerPlatform.find(platform);
@@ -279,6 +279,11 @@ namespace AssetProcessor
         return m_jobDetails.m_priority;
     }
 
+    AZ::u32 RCJob::GetMaxConcurrentJobs() const
+    {
+        return m_jobDetails.m_assetBuilderDesc.m_maxConcurrentJobs;
+    }
+
     const AZStd::vector<AssetProcessor::JobDependencyInternal>& RCJob::GetJobDependencies()
     {
         return m_jobDetails.m_jobDependencyList;
@@ -524,6 +529,7 @@ namespace AssetProcessor
                 if (!JobCancelListener.IsCancelled())
                 {
                     bool runProcessJob = true;
+                    bool storeProcessedJob = false;
                     if (m_jobDetails.m_checkServer)
                     {
                         QFileInfo fileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str());
@@ -567,6 +573,8 @@ namespace AssetProcessor
                             }
 
                             runProcessJob = !operationResult;
+                            // in a shared cache every client populates the server, not only the one running in server mode
+                            storeProcessedJob = runProcessJob && AssetUtilities::InSharedCacheMode();
                         }
                     }
 
@@ -574,6 +582,22 @@ namespace AssetProcessor
                     {
                         // sending process job command to the builder
                         builderParams.m_assetBuilderDesc.m_processJobFunction(builderParams.m_processJobRequest, result);
+
+                        if (storeProcessedJob && result.m_resultCode == AssetBuilderSDK::ProcessJobResult_Success && !JobCancelListener.IsCancelled())
+                        {
+                            bool operationResult = false;
+                            if (BeforeStoringJobResult(builderParams, result))
+                            {
+                                AssetProcessor::AssetServerBus::BroadcastResult(operationResult, &AssetProcessor::AssetServerBusTraits::StoreJobResult, builderParams);
+                            }
+
+                            if (!operationResult)
+                            {
+                                AZ_TracePrintf(AssetProcessor::DebugChannel, "Unable to share job (%s, %s, %s) with fingerprint (%u) with the server.\n",
+                                    builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+                                    builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
+                            }
+                        }
                     }
                 }
             }
@@ -200,6 +200,7 @@ namespace AssetProcessor
         bool IsCritical() const;
         bool IsAutoFail() const;
         int GetPriority() const;
+        AZ::u32 GetMaxConcurrentJobs() const;
         const AZStd::vector<JobDependencyInternal>& GetJobDependencies();
 
     protected:
@@ -17,6 +17,7 @@
 #include "native/resourcecompiler/rcjob.h"
 #include "native/resourcecompiler/rcjoblistmodel.h"
 #include "native/resourcecompiler/rccontroller.h"
+#include "native/resourcecompiler/RCQueueSortModel.h"
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
 
 TEST_F(RCcontrollerTest, CompileGroupCreatedWithUnknownStatusForFailedJobs)
@@ -164,6 +165,88 @@ TEST_F(RCcontrollerTest_Cancellation, JobSubmitted_DifferentFingerprint_CancelsT
     }
 }
 
+class RCcontrollerTest_Scheduling
+    : public RCcontrollerTest
+{
+public:
+    void SetUp() override
+    {
+        RCcontrollerTest::SetUp();
+        m_rcJobListModel.reset(new AssetProcessor::RCJobListModel());
+        m_rcQueueSortModel.reset(new AssetProcessor::RCQueueSortModel());
+        m_rcQueueSortModel->AttachToModel(m_rcJobListModel.get());
+    }
+
+    void TearDown() override
+    {
+        m_rcQueueSortModel->AttachToModel(nullptr);
+        m_rcQueueSortModel.reset();
+        m_rcJobListModel.reset();
+        RCcontrollerTest::TearDown();
+    }
+
+    AssetProcessor::RCJob* AddJob(const char* sourceName, AZ::s64 jobRunKey, const AZ::Uuid& builderGuid,
+        AZ::u32 maxConcurrentJobs = 0, const char* orderDependency = nullptr)
+    {
+        using namespace AssetProcessor;
+        RCJob* job = new RCJob(m_rcJobListModel.get());
+        JobDetails jobDetails;
+        jobDetails.m_jobEntry.m_pathRelativeToWatchFolder = jobDetails.m_jobEntry.m_databaseSourceName = sourceName;
+        jobDetails.m_jobEntry.m_platformInfo = { "pc",{ "desktop", "renderer" } };
+        jobDetails.m_jobEntry.m_jobRunKey = jobRunKey;
+        jobDetails.m_jobEntry.m_jobKey = "key";
+        jobDetails.m_jobEntry.m_builderGuid = builderGuid;
+        jobDetails.m_assetBuilderDesc.m_maxConcurrentJobs = maxConcurrentJobs;
+        if (orderDependency)
+        {
+            AssetBuilderSDK::SourceFileDependency sourceFileDependency;
+            sourceFileDependency.m_sourceFileDependencyPath = orderDependency;
+            AssetBuilderSDK::JobDependency jobDependency("key", "pc", AssetBuilderSDK::JobDependencyType::Order, sourceFileDependency);
+            jobDetails.m_jobDependencyList.push_back(JobDependencyInternal(jobDependency));
+        }
+        job->SetState(RCJob::JobState::pending);
+        job->Init(jobDetails);
+        m_rcJobListModel->addNewJob(job);
+        m_rcQueueSortModel->AddJobIdEntry(job);
+        return job;
+    }
+
+    AZStd::unique_ptr<AssetProcessor::RCJobListModel> m_rcJobListModel;
+    AZStd::unique_ptr<AssetProcessor::RCQueueSortModel> m_rcQueueSortModel;
+};
+
+TEST_F(RCcontrollerTest_Scheduling, GetNextPendingJob_JobWithDependents_ComesFirst)
+{
+    const AZ::Uuid builderGuid = AZ::Uuid::CreateRandom();
+    // lowest run key, would come first without dependency information
+    AddJob("somepath/unrelated.tif", 1, builderGuid);
+    AssetProcessor::RCJob* dependency = AddJob("somepath/dependency.tif", 2, builderGuid);
+    AddJob("somepath/dependent.tif", 3, builderGuid, 0, "somepath/dependency.tif");
+
+    EXPECT_EQ(m_rcQueueSortModel->GetNextPendingJob(), dependency);
+}
+
+TEST_F(RCcontrollerTest_Scheduling, GetNextPendingJob_BuilderAtConcurrencyLimit_JobHeldBack)
+{
+    const AZ::Uuid limitedBuilderGuid = AZ::Uuid::CreateRandom();
+    const AZ::Uuid otherBuilderGuid = AZ::Uuid::CreateRandom();
+    AssetProcessor::RCJob* runningJob = AddJob("somepath/running.fbx", 1, limitedBuilderGuid, 1);
+    AssetProcessor::RCJob* limitedJob = AddJob("somepath/limited.fbx", 2, limitedBuilderGuid, 1);
+    AssetProcessor::RCJob* otherJob = AddJob("somepath/other.tif", 3, otherBuilderGuid);
+
+    m_rcJobListModel->markAsProcessing(runningJob);
+    m_rcQueueSortModel->OnJobStarted(runningJob);
+    EXPECT_EQ(m_rcQueueSortModel->GetNextPendingJob(), otherJob);
+
+    m_rcJobListModel->markAsProcessing(otherJob);
+    m_rcQueueSortModel->OnJobStarted(otherJob);
+    EXPECT_EQ(m_rcQueueSortModel->GetNextPendingJob(), nullptr);
+
+    runningJob->SetState(AssetProcessor::RCJob::completed);
+    m_rcQueueSortModel->OnJobFinished(runningJob);
+    EXPECT_EQ(m_rcQueueSortModel->GetNextPendingJob(), limitedJob);
+}
+
 // makes sure to expose parts of RCJob to the unit test
 class TestRCJob : public AssetProcessor::RCJob
 {
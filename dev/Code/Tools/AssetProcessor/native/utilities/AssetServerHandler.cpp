@@ -110,9 +110,22 @@ namespace AssetProcessor
         AZ_TracePrintf(AssetProcessor::DebugChannel, " Creating archive for job (%s, %s, %s) with fingerprint (%u).\n",
             builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
             builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
-        AzToolsFramework::ArchiveCommands::Bus::BroadcastResult(success, &AzToolsFramework::ArchiveCommands::CreateArchiveBlocking, archiveAbsFilePath.toUtf8().data(), builderParams.GetTempJobDirectory());
+        // several clients can store the same job at once in a shared cache, and others can be extracting it meanwhile.
+        // the archive is written under a unique name next to its final location and renamed once it is complete,
+        // so a reader never sees a partially written archive.
+        QFileInfo archiveFileInfo(archiveAbsFilePath);
+        QString tempArchiveAbsFilePath = archiveFileInfo.dir().filePath(QString("%1_%2.tmp.zip").arg(archiveFileInfo.completeBaseName(), AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str()));
+        AzToolsFramework::ArchiveCommands::Bus::BroadcastResult(success, &AzToolsFramework::ArchiveCommands::CreateArchiveBlocking, tempArchiveAbsFilePath.toUtf8().data(), builderParams.GetTempJobDirectory());
         AZ_Warning(AssetProcessor::DebugChannel, success, "Creating archive operation failed.\n");
 
+        if (success && !QFile::rename(tempArchiveAbsFilePath, archiveAbsFilePath))
+        {
+            // another client stored the same job first, its archive is just as good as this one.
+            success = QFile::exists(archiveAbsFilePath);
+            AZ_Warning(AssetProcessor::DebugChannel, success, "Unable to move archive %s to %s.\n", tempArchiveAbsFilePath.toUtf8().data(), archiveAbsFilePath.toUtf8().data());
+        }
+        QFile::remove(tempArchiveAbsFilePath);
+
         return success;
     }
 
@@ -41,6 +41,11 @@ namespace AssetProcessor
 
     static const int s_MillisecondsInASecond = 1000;
 
+    //! Number of requests an AssetBuilder process handles before it is shut down and replaced by a fresh one.
+    // builders stay warm between jobs to avoid paying process and gem start up for every job, but memory held by
+    // builders (for example scene data and caches of 3rd party SDKs) keeps growing, so they are recycled now and then.
+    static const AZ::u32 s_MaximumRequestsPerBuilder = 500;
+
     static const char* s_buildersFolderName = "Builders";
 
     bool Builder::IsConnected() const
@@ -322,6 +327,7 @@ namespace AssetProcessor
         {
             AZ_Warning("BuilderRef", m_builder->m_busy, "Builder reference is valid but is already set to not busy");
 
+            ++m_builder->m_requestCount;
             m_builder->m_busy = false;
             m_builder = nullptr;
         }
@@ -460,7 +466,13 @@ namespace AssetProcessor
                 {
                     builder->PumpCommunicator();
 
-                    if (builder->IsValid())
+                    if (builder->m_requestCount >= s_MaximumRequestsPerBuilder)
+                    {
+                        AZ_TracePrintf(AssetProcessor::DebugChannel, "Recycling builder %s after %u requests\n", builder->UuidString().c_str(), builder->m_requestCount);
+                        builder->TerminateProcess(0);
+                        itr = m_builders.erase(itr);
+                    }
+                    else if (builder->IsValid())
                     {
                         return BuilderRef(builder);
                     }
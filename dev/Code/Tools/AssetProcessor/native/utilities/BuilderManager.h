@@ -111,6 +111,9 @@ namespace AssetProcessor
         //! Indicates if the builder is currently in use
         bool m_busy = false;
 
+        //! Number of requests the builder has finished, used to recycle long running builders
+        AZ::u32 m_requestCount = 0;
+
         AZ::u32 m_connectionId = 0;
 
         //! Signals the exe has successfully established a connection
@@ -566,6 +566,61 @@ to ensure that the address is correct. Asset Processor won't be running in serve
         return false;
     }
 
+    bool InSharedCacheMode()
+    {
+        static bool s_sharedCacheMode = CheckSharedCacheMode();
+        return s_sharedCacheMode;
+    }
+
+    bool CheckSharedCacheMode()
+    {
+        if (InServerMode())
+        {
+            // the server stores everything it processes already.
+            return false;
+        }
+
+        bool sharedCache = false;
+        QStringList args = QCoreApplication::arguments();
+        for (const QString& arg : args)
+        {
+            if (arg.contains("/sharedCache", Qt::CaseInsensitive) || arg.contains("--sharedCache", Qt::CaseInsensitive))
+            {
+                sharedCache = true;
+                break;
+            }
+        }
+
+        if (!sharedCache)
+        {
+            QDir engineRoot;
+            ComputeEngineRoot(engineRoot);
+            QString rootConfigFile = engineRoot.absoluteFilePath("AssetProcessorPlatformConfig.ini");
+            if (QFile::exists(rootConfigFile))
+            {
+                QSettings loader(rootConfigFile, QSettings::IniFormat);
+                loader.beginGroup("Server");
+                sharedCache = loader.value("sharedCache", false).toBool();
+                loader.endGroup();
+            }
+        }
+
+        if (sharedCache)
+        {
+            bool isValid = false;
+            AssetProcessor::AssetServerBus::BroadcastResult(isValid, &AssetProcessor::AssetServerBusTraits::IsServerAddressValid);
+            if (isValid)
+            {
+                AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Asset Processor is sharing the jobs it processes with the asset server.\n");
+                return true;
+            }
+
+            AZ_Warning(AssetProcessor::ConsoleChannel, false, "Invalid server address, please check the AssetProcessorPlatformConfig.ini file \
+to ensure that the address is correct. Asset Processor won't be sharing the jobs it processes.");
+        }
+
+        return false;
+    }
 
     QString ServerAddress()
     {
@@ -89,6 +89,13 @@ namespace AssetUtilities
     //! Checks the args for the server parameter, returns true if found otherwise false.
     bool CheckServerMode();
 
+    //! Checks to see if the asset processor shares the jobs it had to process locally with the asset server,
+    //! so that the other clients can retrieve them instead of processing them again.
+    bool InSharedCacheMode();
+
+    //! Checks the args for the sharedCache parameter, and the sharedCache setting of the config file.
+    bool CheckSharedCacheMode();
+
     //! Reads the server address from the config file.
     QString ServerAddress();
 
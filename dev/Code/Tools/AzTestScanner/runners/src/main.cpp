@@ -53,13 +53,15 @@ void usage(AZ::Test::Platform& platform)
         "Runs AZ unit and integration tests. Exit code is the result from GoogleTest.\n"
         "\n"
         "Usage:\n"
-        "   AzTestRunner.exe <lib> (AzRunUnitTests|AzRunIntegTests) [--integ] [--wait-for-debugger] [--pause-on-completion] [google-test-args]\n"
+        "   AzTestRunner.exe <lib> (AzRunUnitTests|AzRunIntegTests|AzRunBenchmarks) [--integ] [--wait-for-debugger] [--pause-on-completion] [google-test-args]\n"
         "\n"
         "Options:\n"
         "   <lib>: the module to test\n"
         "   <hook>: the name of the aztest hook function to run in the <lib>\n"
         "           'AzRunUnitTests' will hook into unit tests\n"
         "           'AzRunIntegTests' will hook into integration tests\n"
+        "           'AzRunBenchmarks' will run the Google Benchmark benchmarks (takes google-benchmark-args instead,\n"
+        "           e.g. --benchmark_filter=<regex> --benchmark_out=<file> --benchmark_out_format=json)\n"
         "   --integ: tells runner to bootstrap the engine, needed for integration tests\n"
         "            Note: you can run unit tests with a bootstrapped engine (AzRunUnitTests --integ),\n"
         "            but running integration tests without a bootstrapped engine (AzRunIntegTests w/ no --integ) might not work.\n"
@@ -70,6 +72,7 @@ void usage(AZ::Test::Platform& platform)
         "Example:\n"
         "   AzTestRunner.exe CrySystem.dll AzRunUnitTests --pause-on-completion\n"
         "   AzTestRunner.exe CrySystem.dll AzRunIntegTests --integ\n"
+        "   AzTestRunner.exe AzCoreTests.dll AzRunBenchmarks --benchmark_out=AzCoreBenchmarks.json --benchmark_out_format=json\n"
         "\n"
         "Exit Codes:\n"
         "   0 - all tests pass\n"
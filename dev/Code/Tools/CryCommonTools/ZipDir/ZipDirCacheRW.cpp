@@ -50,6 +50,7 @@ struct PackFileBatch
     int sourceMaxSize;
     int compressionMethod;
     int compressionLevel;
+    unsigned blockSize;
 
     PackFileBatch()
         : pool(0)
@@ -58,6 +59,7 @@ struct PackFileBatch
         , zipMaxSize(0)
         , compressionMethod(0)
         , compressionLevel(0)
+        , blockSize(0)
     {
     }
 };
@@ -493,6 +495,34 @@ static void PackFileFromMemory(PackFileJob* job)
         }
         break;
     }
+    case ZipFile::METHOD_LZ4_BLOCKS:
+    {
+        if (job->uncompressedSize > 0)
+        {
+            job->compressedSize = ZipDir::ZipBlockCompressBound(job->uncompressedSize, job->batch->blockSize);
+            job->compressedData = malloc(job->compressedSize);
+            int error = ZipDir::ZipBlockCompress(job->uncompressedData, &job->compressedSize, job->compressedData, job->uncompressedSize, job->batch->blockSize, job->batch->compressionLevel);
+            if (error == Z_OK)
+            {
+                job->status = PACKFILE_COMPRESSED;
+                job->zdError = ZipDir::ZD_ERROR_SUCCESS;
+            }
+            else
+            {
+                job->status = PACKFILE_FAILED;
+                job->zdError = ZipDir::ZD_ERROR_ZLIB_FAILED;
+            }
+        }
+        else
+        {
+            job->status = PACKFILE_COMPRESSED;
+            job->zdError = ZipDir::ZD_ERROR_SUCCESS;
+
+            job->compressedSize = 0;
+            job->compressedData = 0;
+        }
+        break;
+    }
     case ZipFile::METHOD_STORE:
         job->compressedData = job->uncompressedData;
         job->compressedSize = job->uncompressedSize;
@@ -852,7 +882,7 @@ static void PackFileFromDisc(PackFileJob* job)
 
 bool ZipDir::CacheRW::UpdateMultipleFiles(const char** realFilenames, const char** filenamesInZip, size_t fileCount,
     int compressionLevel, bool encryptContent, size_t zipMaxSize, int sourceMinSize, int sourceMaxSize,
-    unsigned numExtraThreads, ZipDir::IReporter* reporter, ZipDir::ISplitter* splitter)
+    unsigned numExtraThreads, ZipDir::IReporter* reporter, ZipDir::ISplitter* splitter, unsigned blockSize)
 {
     int compressionMethod = ZipFile::METHOD_DEFLATE;
     if (encryptContent)
@@ -863,6 +893,10 @@ bool ZipDir::CacheRW::UpdateMultipleFiles(const char** realFilenames, const char
     {
         compressionMethod = ZipFile::METHOD_STORE;
     }
+    else if (blockSize > 0)
+    {
+        compressionMethod = ZipFile::METHOD_LZ4_BLOCKS;
+    }
 
     uint64 totalSize = 0;
 
@@ -871,6 +905,7 @@ bool ZipDir::CacheRW::UpdateMultipleFiles(const char** realFilenames, const char
     PackFileBatch batch;
     batch.compressionLevel = compressionLevel;
     batch.compressionMethod = compressionMethod;
+    batch.blockSize = blockSize;
     batch.sourceMinSize = sourceMinSize;
     batch.sourceMaxSize = sourceMaxSize;
     batch.zipMaxSize = zipMaxSize;
@@ -908,7 +943,13 @@ bool ZipDir::CacheRW::UpdateMultipleFiles(const char** realFilenames, const char
                 job.uncompressedSizePreviously = entry->desc.lSizeUncompressed;
 
                 // Check if file with the same name, timestamp and size already exists in pak.
-                if (entry->CompareFileTimeNTFS(job.modTime) && fileSize == entry->desc.lSizeUncompressed)
+                // Files are recompressed when switching to or from block compression.
+                const bool sameBlockCompression = (entry->nMethod == ZipFile::METHOD_LZ4_BLOCKS) == (compressionMethod == ZipFile::METHOD_LZ4_BLOCKS);
+                if (!sameBlockCompression)
+                {
+                    job.existingCRC = 0;
+                }
+                else if (entry->CompareFileTimeNTFS(job.modTime) && fileSize == entry->desc.lSizeUncompressed)
                 {
                     if (reporter)
                     {
@@ -1403,7 +1444,14 @@ ZipDir::ErrorEnum ZipDir::CacheRW::ReadFile (FileEntry* pFileEntry, void* pCompr
         else
         {
             unsigned long nSizeUncompressed = pFileEntry->desc.lSizeUncompressed;
-            if (nSizeUncompressed > 0)
+            if (nSizeUncompressed > 0 && pFileEntry->nMethod == ZipFile::METHOD_LZ4_BLOCKS)
+            {
+                if (Z_OK != ZipBlockUncompress(pUncompressed, nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed))
+                {
+                    return ZD_ERROR_CORRUPTED_DATA;
+                }
+            }
+            else if (nSizeUncompressed > 0)
             {
                 if (Z_OK != ZipRawUncompress(pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed))
                 {
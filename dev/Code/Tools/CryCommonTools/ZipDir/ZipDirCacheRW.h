@@ -108,9 +108,10 @@ namespace ZipDir
         bool EncryptArchive(EncryptionChange change, IEncryptPredicate* encryptContentPredicate, int* numChanged, int* numSkipped);
 
         // Adds or updates a bunch of files. Creates directories if needed. Multithreaded when numExtraThreads > 0
+        // Files are compressed with METHOD_LZ4_BLOCKS in blocks of blockSize bytes when blockSize > 0, deflated otherwise
         bool UpdateMultipleFiles(const char** realFilenames, const char** filenamesInZip, size_t fileCount,
             int compressionLevel, bool encryptContent, size_t zipMaxSize, int sourceMinSize, int sourceMaxSize,
-            unsigned numExtraThreads, ZipDir::IReporter* reporter, ZipDir::ISplitter* splitter = nullptr);
+            unsigned numExtraThreads, ZipDir::IReporter* reporter, ZipDir::ISplitter* splitter = nullptr, unsigned blockSize = 0);
 
         //   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
         ErrorEnum StartContinuousFileUpdate(const char* szRelativePath, unsigned nSize);
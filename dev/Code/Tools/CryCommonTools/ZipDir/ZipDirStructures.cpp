@@ -14,6 +14,8 @@
 #include "StdAfx.h"
 #include "smartptr.h"
 #include <zlib.h>
+#include <lz4.h>
+#include <lz4hc.h>
 #include "ZipFileFormat.h"
 #include "zipdirstructures.h"
 #include <time.h>
@@ -119,6 +121,103 @@ int ZipDir::ZipRawCompress (const void* pUncompressed, unsigned long* pDestSize,
     return err;
 }
 
+// returns the size of the METHOD_LZ4_BLOCKS data of nSrcSize bytes at most, blocks that don't get smaller are stored
+unsigned long ZipDir::ZipBlockCompressBound (unsigned long nSrcSize, unsigned long nBlockSize)
+{
+    const unsigned long nBlockCount = (nSrcSize + nBlockSize - 1) / nBlockSize;
+    return sizeof(LZ4BlockHeader) + nBlockCount * sizeof(uint32) + nSrcSize;
+}
+
+// compresses the raw data into METHOD_LZ4_BLOCKS data, the pCompressed buffer must be at least ZipBlockCompressBound in size
+// returns one of the Z_* errors (Z_OK upon success), and the size in *pDestSize
+int ZipDir::ZipBlockCompress (const void* pUncompressed, unsigned long* pDestSize, void* pCompressed, unsigned long nSrcSize, unsigned long nBlockSize, int nLevel)
+{
+    if (nBlockSize == 0 || *pDestSize < ZipBlockCompressBound(nSrcSize, nBlockSize))
+    {
+        return Z_BUF_ERROR;
+    }
+
+    LZ4BlockHeader* pHeader = (LZ4BlockHeader*)pCompressed;
+    pHeader->lSignature = LZ4BlockHeader::SIGNATURE;
+    pHeader->nBlockSize = nBlockSize;
+    pHeader->nBlockCount = (nSrcSize + nBlockSize - 1) / nBlockSize;
+
+    uint32* pBlockEnds = (uint32*)(pHeader + 1);
+    char* pBlocks = (char*)(pBlockEnds + pHeader->nBlockCount);
+    const char* pSrc = (const char*)pUncompressed;
+
+    uint32 nBlocksSize = 0;
+    for (uint32 nBlock = 0; nBlock < pHeader->nBlockCount; ++nBlock)
+    {
+        const unsigned long nRemaining = nSrcSize - nBlock * nBlockSize;
+        const int nRawSize = (int)(nRemaining < nBlockSize ? nRemaining : nBlockSize);
+        char* pDst = pBlocks + nBlocksSize;
+
+        // limiting the output to one byte less than the input fails the compression of blocks that don't get smaller
+#if defined(LZ4_VERSION_NUMBER) && LZ4_VERSION_NUMBER >= 10700
+        int nCompressedSize = LZ4_compress_HC(pSrc, pDst, nRawSize, nRawSize - 1, nLevel);
+#else
+        int nCompressedSize = LZ4_compressHC2_limitedOutput(pSrc, pDst, nRawSize, nRawSize - 1, nLevel);
+#endif
+        if (nCompressedSize <= 0)
+        {
+            memcpy(pDst, pSrc, nRawSize);
+            nCompressedSize = nRawSize;
+        }
+
+        nBlocksSize += nCompressedSize;
+        pBlockEnds[nBlock] = nBlocksSize;
+        pSrc += nRawSize;
+    }
+
+    *pDestSize = (unsigned long)(pBlocks - (char*)pCompressed) + nBlocksSize;
+    return Z_OK;
+}
+
+// uncompresses METHOD_LZ4_BLOCKS data, the size of the uncompressed data must be known
+// returns one of the Z_* errors (Z_OK upon success)
+int ZipDir::ZipBlockUncompress (void* pUncompressed, unsigned long nDestSize, const void* pCompressed, unsigned long nSrcSize)
+{
+    const LZ4BlockHeader* pHeader = (const LZ4BlockHeader*)pCompressed;
+    if (nSrcSize < sizeof(LZ4BlockHeader) || pHeader->lSignature != LZ4BlockHeader::SIGNATURE || pHeader->nBlockSize == 0
+        || pHeader->nBlockCount != (nDestSize + pHeader->nBlockSize - 1) / pHeader->nBlockSize
+        || nSrcSize < sizeof(LZ4BlockHeader) + pHeader->nBlockCount * sizeof(uint32))
+    {
+        return Z_DATA_ERROR;
+    }
+
+    const uint32* pBlockEnds = (const uint32*)(pHeader + 1);
+    const char* pBlocks = (const char*)(pBlockEnds + pHeader->nBlockCount);
+    const unsigned long nBlocksSize = nSrcSize - (unsigned long)(pBlocks - (const char*)pCompressed);
+    char* pDst = (char*)pUncompressed;
+
+    uint32 nBlockStart = 0;
+    for (uint32 nBlock = 0; nBlock < pHeader->nBlockCount; ++nBlock)
+    {
+        const uint32 nBlockEnd = pBlockEnds[nBlock];
+        const unsigned long nRemaining = nDestSize - nBlock * pHeader->nBlockSize;
+        const int nRawSize = (int)(nRemaining < pHeader->nBlockSize ? nRemaining : pHeader->nBlockSize);
+        if (nBlockEnd < nBlockStart || nBlockEnd > nBlocksSize)
+        {
+            return Z_DATA_ERROR;
+        }
+
+        const int nCompressedSize = (int)(nBlockEnd - nBlockStart);
+        if (nCompressedSize == nRawSize)
+        {
+            memcpy(pDst, pBlocks + nBlockStart, nRawSize);
+        }
+        else if (LZ4_decompress_safe(pBlocks + nBlockStart, pDst, nCompressedSize, nRawSize) != nRawSize)
+        {
+            return Z_DATA_ERROR;
+        }
+
+        pDst += nRawSize;
+        nBlockStart = nBlockEnd;
+    }
+    return Z_OK;
+}
+
 // finds the subdirectory entry by the name, using the names from the name pool
 // assumes: all directories are sorted in alphabetical order.
 // case-sensitive (must be lower-case if case-insensitive search in Win32 is performed)
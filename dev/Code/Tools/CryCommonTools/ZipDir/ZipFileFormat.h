@@ -52,7 +52,8 @@ namespace ZipFile
         METHOD_DEFLATE  = 8, // The file is Deflated
         METHOD_DEFLATE64 = 9, // Enhanced Deflating using Deflate64(tm)
         METHOD_IMPLODE_PKWARE = 10, // PKWARE Date Compression Library Imploding
-        METHOD_DEFLATE_AND_ENCRYPT = 11 // Deflate + Custom encryption
+        METHOD_DEFLATE_AND_ENCRYPT = 11, // Deflate + Custom encryption
+        METHOD_LZ4_BLOCKS = 15 // The file is split into blocks that are compressed separately with LZ4 (see LZ4BlockHeader)
     };
 
     // version numbers
@@ -375,6 +376,21 @@ namespace ZipFile
 
         AUTO_STRUCT_INFO
     } PACK_GCC;
+
+    // The data of a METHOD_LZ4_BLOCKS entry starts with this header, followed by nBlockCount offsets (uint32) of the
+    // ends of the compressed blocks, relative to the end of the offset table, and then the blocks.
+    // Every block but the last holds nBlockSize bytes of the file and is compressed on its own, so the blocks can be
+    // decompressed in parallel or one at a time. A block whose compressed size is its uncompressed size is stored.
+    struct LZ4BlockHeader
+    {
+        enum
+        {
+            SIGNATURE = 0x42345a4c // "LZ4B"
+        };
+        ulong  lSignature;
+        ulong  nBlockSize;
+        ulong  nBlockCount;
+    } PACK_GCC;
 }
 
 #undef PACK_GCC
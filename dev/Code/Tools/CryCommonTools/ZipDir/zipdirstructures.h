@@ -200,6 +200,17 @@ namespace ZipDir
     // returns one of the Z_* errors (Z_OK upon success), and the size in *pDestSize. the pCompressed buffer must be at least nSrcSize*1.001+12 size
     extern int ZipRawCompress (const void* pUncompressed, unsigned long* pDestSize, void* pCompressed, unsigned long nSrcSize, int nLevel);
 
+    // returns the size of the buffer ZipBlockCompress needs for nSrcSize bytes of data
+    extern unsigned long ZipBlockCompressBound (unsigned long nSrcSize, unsigned long nBlockSize);
+
+    // compresses the raw data into blocks of nBlockSize that are compressed separately with LZ4 (method METHOD_LZ4_BLOCKS)
+    // returns one of the Z_* errors (Z_OK upon success), and the size in *pDestSize. nLevel is the LZ4 HC level
+    extern int ZipBlockCompress (const void* pUncompressed, unsigned long* pDestSize, void* pCompressed, unsigned long nSrcSize, unsigned long nBlockSize, int nLevel);
+
+    // uncompresses data compressed with method METHOD_LZ4_BLOCKS into nDestSize bytes
+    // returns one of the Z_* errors (Z_OK upon success)
+    extern int ZipBlockUncompress (void* pUncompressed, unsigned long nDestSize, const void* pCompressed, unsigned long nSrcSize);
+
     //////////////////////////////////////////////////////////////////////////
     struct SExtraZipFileData
     {
@@ -21,6 +21,7 @@
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/time.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
 
 enum EFileEntryHeaderFlags
 {
@@ -39,6 +40,7 @@ struct SFileEntryHeader
 #pragma pack(pop)
 
 static const int MAX_DATA_SIZE = 1024 * 1024;
+static const int IN_FLIGHT_POLL_TIME_MS = 10;
 
 CCrySimpleCache& CCrySimpleCache::Instance()
 {
@@ -142,6 +144,60 @@ void CCrySimpleCache::Add(const tdHash& rHash, const tdDataVector& rData)
     }
 }
 
+bool CCrySimpleCache::JoinInFlightCompile(const tdHash& rHash, tdDataVector& rData)
+{
+    SCrySimpleInFlightCompile* pCompile = nullptr;
+    {
+        CCrySimpleMutexAutoLock Lock(m_InFlightMutex);
+        tdInFlight::iterator it = m_InFlight.find(rHash);
+        if (it == m_InFlight.end())
+        {
+            m_InFlight[rHash] = new SCrySimpleInFlightCompile();
+            return false;
+        }
+        pCompile = it->second;
+        pCompile->m_Waiters++;
+    }
+
+    while (true)
+    {
+        {
+            CCrySimpleMutexAutoLock Lock(m_InFlightMutex);
+            if (pCompile->m_Done)
+            {
+                rData = pCompile->m_Data;
+                // The owner already removed it from the map, the last waiter cleans up.
+                if (--pCompile->m_Waiters == 0)
+                {
+                    delete pCompile;
+                }
+                return true;
+            }
+        }
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(IN_FLIGHT_POLL_TIME_MS));
+    }
+}
+
+void CCrySimpleCache::FinishInFlightCompile(const tdHash& rHash, const tdDataVector& rData)
+{
+    CCrySimpleMutexAutoLock Lock(m_InFlightMutex);
+    tdInFlight::iterator it = m_InFlight.find(rHash);
+    if (it == m_InFlight.end())
+    {
+        return;
+    }
+
+    SCrySimpleInFlightCompile* pCompile = it->second;
+    m_InFlight.erase(it);
+    if (pCompile->m_Waiters == 0)
+    {
+        delete pCompile;
+        return;
+    }
+    pCompile->m_Data = rData;
+    pCompile->m_Done = true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool CCrySimpleCache::LoadCacheFile(const std::string& filename)
 {
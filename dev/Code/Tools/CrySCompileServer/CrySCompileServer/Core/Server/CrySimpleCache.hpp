@@ -33,6 +33,16 @@ private:
 typedef std::map<tdHash, tdHash>             tdEntries;
 typedef std::map<tdHash, tdDataVector> tdData;
 
+// A compile that is currently running for a given hash. Jobs that request the
+// same hash while it runs wait for its result instead of compiling again.
+struct SCrySimpleInFlightCompile
+{
+    bool                                                m_Done = false;
+    uint32_t                                        m_Waiters = 0;
+    tdDataVector                                m_Data;
+};
+typedef std::map<tdHash, SCrySimpleInFlightCompile*> tdInFlight;
+
 class CCrySimpleCache
 {
     volatile bool                               m_CachingEnabled;
@@ -42,6 +52,8 @@ class CCrySimpleCache
     tdData                                          m_Data;
     CCrySimpleMutex                         m_Mutex;
     CCrySimpleMutex                         m_FileMutex;
+    tdInFlight                                  m_InFlight;
+    CCrySimpleMutex                         m_InFlightMutex;
 
     std::list<tdDataVector*>        m_PendingCacheEntries;
     std::string                                 CreateFileName(const tdHash& rHash) const;
@@ -51,6 +63,12 @@ public:
     bool                                                Find(const tdHash& rHash, tdDataVector& rData);
     void                                                Add(const tdHash& rHash, const tdDataVector& rData);
 
+    // Returns false if nobody is compiling rHash yet, the caller then owns the compile and must call
+    // FinishInFlightCompile. Otherwise blocks until the owner finishes and returns its result in rData,
+    // which is left empty if that compile failed.
+    bool                                                JoinInFlightCompile(const tdHash& rHash, tdDataVector& rData);
+    void                                                FinishInFlightCompile(const tdHash& rHash, const tdDataVector& rData);
+
     bool                                                LoadCacheFile(const std::string& filename);
     void                                                Finalize();
 
@@ -27,7 +27,12 @@ CCrySimpleJobCache::CCrySimpleJobCache(uint32_t requestIP)
 
 void CCrySimpleJobCache::CheckHashID(std::vector<uint8_t>& rVec, size_t Size)
 {
-    m_HashID = CSTLHelper::Hash(rVec, Size);
+    CheckHashID(CSTLHelper::Hash(rVec, Size), rVec);
+}
+
+void CCrySimpleJobCache::CheckHashID(const tdHash& rHash, std::vector<uint8_t>& rVec)
+{
+    m_HashID = rHash;
     if (CCrySimpleCache::Instance().Find(m_HashID, rVec))
     {
         State(ECSJS_CACHEHIT);
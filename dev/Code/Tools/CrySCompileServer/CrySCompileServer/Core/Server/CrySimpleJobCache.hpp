@@ -25,6 +25,7 @@ class CCrySimpleJobCache
 protected:
 
     void                            CheckHashID(std::vector<uint8_t>& rVec, size_t Size);
+    void                            CheckHashID(const tdHash& rHash, std::vector<uint8_t>& rVec);
 
 public:
     CCrySimpleJobCache(uint32_t requestIP);
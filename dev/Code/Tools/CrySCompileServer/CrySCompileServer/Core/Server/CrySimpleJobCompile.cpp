@@ -35,6 +35,8 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <map>
+#include <memory>
 
 #if defined(AZ_RESTRICTED_PLATFORM)
 #undef AZ_RESTRICTED_SECTION
@@ -71,6 +73,101 @@ struct STimer
 
 STimer g_Timer;
 
+namespace
+{
+    // Attributes that describe who asked for a shader rather than what gets compiled.
+    bool IsHashedAttribute(const char* pName)
+    {
+        static const char* s_IgnoredAttributes[] = { "JobType", "HashStop", "ShaderRequest", "Project", "Tags", "EmailCCs", "Caching" };
+        for (const char* pIgnored : s_IgnoredAttributes)
+        {
+            if (strcmp(pName, pIgnored) == 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Line endings and trailing whitespace don't change the compiled output, strip them so the same source sent
+    // from differently configured clients shares a cache entry. Line continuations are left untouched.
+    void NormalizeProgram(const char* pProgram, std::string& rOut)
+    {
+        rOut.reserve(rOut.size() + strlen(pProgram));
+        const size_t lineStart = rOut.size();
+        size_t currentLineStart = lineStart;
+        for (const char* pChar = pProgram; *pChar; ++pChar)
+        {
+            if (*pChar == '\r')
+            {
+                continue;
+            }
+            if (*pChar == '\n')
+            {
+                while (rOut.size() > currentLineStart && (rOut.back() == ' ' || rOut.back() == '\t'))
+                {
+                    rOut.pop_back();
+                }
+                rOut += '\n';
+                currentLineStart = rOut.size();
+                continue;
+            }
+            rOut += *pChar;
+        }
+    }
+
+    // Hash of everything that affects the compiled bytecode: protocol version, profile, entry point, flags,
+    // target platform/compiler/language and the normalized program text.
+    tdHash ContentHash(const TiXmlElement* pElement, EProtocolVersion version)
+    {
+        std::map<std::string, const char*> attributes;
+        for (const TiXmlAttribute* pAttribute = pElement->FirstAttribute(); pAttribute; pAttribute = pAttribute->Next())
+        {
+            if (IsHashedAttribute(pAttribute->Name()))
+            {
+                attributes[pAttribute->Name()] = pAttribute->Value();
+            }
+        }
+
+        std::string key = std::to_string(static_cast<int>(version));
+        for (const auto& attribute : attributes)
+        {
+            key += '\0';
+            key += attribute.first;
+            key += '=';
+            if (attribute.first == "Program")
+            {
+                NormalizeProgram(attribute.second, key);
+            }
+            else
+            {
+                key += attribute.second;
+            }
+        }
+        return CSTLHelper::Hash(key);
+    }
+
+    // Registers the job as the owner of an in-flight compile and publishes its result, or an empty one if it bails
+    // out early or throws, so jobs waiting on the same hash are always released.
+    class CInFlightCompileGuard
+    {
+    public:
+        CInFlightCompileGuard(const tdHash& rHash)
+            : m_Hash(rHash)
+        {
+        }
+        ~CInFlightCompileGuard()
+        {
+            CCrySimpleCache::Instance().FinishInFlightCompile(m_Hash, m_pResult ? *m_pResult : tdDataVector());
+        }
+        void SetResult(const tdDataVector& rResult) { m_pResult = &rResult; }
+
+    private:
+        tdHash m_Hash;
+        const tdDataVector* m_pResult = nullptr;
+    };
+}
+
 // This function validates executables up to version 21
 // because it's received within the compilation flags.
 bool ValidateExecutableStringLegacy(const AZStd::string& executableString)
@@ -142,9 +239,7 @@ bool CCrySimpleJobCompile::Execute(const TiXmlElement* pElement)
 {
     std::vector<uint8_t>& rVec = *m_pRVec;
 
-    size_t Size = SizeOf(rVec);
-
-    CheckHashID(rVec, Size);
+    CheckHashID(ContentHash(pElement, m_Version), rVec);
 
     if (State() == ECSJS_CACHEHIT)
     {
@@ -152,6 +247,26 @@ bool CCrySimpleJobCompile::Execute(const TiXmlElement* pElement)
         return true;
     }
 
+    // Editors launched together request the same shaders at the same time, let the first request compile and hand
+    // its result to the others. If it failed they compile themselves so each gets its own error report.
+    std::unique_ptr<CInFlightCompileGuard> inFlightGuard;
+    {
+        tdDataVector inFlightResult;
+        if (CCrySimpleCache::Instance().JoinInFlightCompile(HashID(), inFlightResult))
+        {
+            if (!inFlightResult.empty())
+            {
+                rVec.swap(inFlightResult);
+                State(ECSJS_DONE);
+                return true;
+            }
+        }
+        else
+        {
+            inFlightGuard = std::make_unique<CInFlightCompileGuard>(HashID());
+        }
+    }
+
     if (!SEnviropment::Instance().m_FallbackServer.empty() && m_GlobalCompileTasks > SEnviropment::Instance().m_FallbackTreshold)
     {
         tdEntryVec ServerVec;
@@ -214,6 +329,11 @@ bool CCrySimpleJobCompile::Execute(const TiXmlElement* pElement)
         CCrySimpleCache::Instance().Add(HashID(), rVec);
     }
 
+    if (inFlightGuard && State() == ECSJS_DONE)
+    {
+        inFlightGuard->SetResult(rVec);
+    }
+
     return true;
 }
 
@@ -409,6 +529,14 @@ bool CCrySimpleJobCompile::Compile(const TiXmlElement* pElement, std::vector<uin
         {
             command = AZStd::move(AZStd::string::format(commandStringToFormat.c_str(), pEntry, pProfile, TmpOut.c_str(), TmpIn.c_str()));
         }
+
+        // Let HLSLcc reuse translations of identical fxc bytecode coming from different requests.
+        if (compiler == SEnviropment::m_GLSL_HLSLcc || compiler == SEnviropment::m_METAL_HLSLcc)
+        {
+            const std::string translationCachePath = SEnviropment::Instance().m_CachePath + "HLSLcc";
+            AZ::IO::SystemFile::CreateDir(translationCachePath.c_str());
+            command += AZStd::string::format(" -cachedir=\"%s\"", translationCachePath.c_str());
+        }
     }
     else
     {
@@ -384,7 +384,9 @@ int main(int argc, char* argv[])
 
     AZ::JobManagerDesc jobManagerDescription;
 
-    int workers = AZStd::GetMin(AZStd::thread::hardware_concurrency(), static_cast<unsigned int>(8));
+    // Compiles run in child processes, so use one worker per hardware thread plus one for the tick thread job,
+    // which never returns.
+    int workers = AZStd::GetMax(AZStd::thread::hardware_concurrency(), 1u) + 1;
     for (int idx = 0; idx < workers; ++idx)
     {
         jobManagerDescription.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
@@ -11,6 +11,7 @@
 #include "hlslcc_bin.hpp"
 
 #include <algorithm>
+#include <vector>
 #include <cctype>
 
 #ifdef _WIN32
@@ -314,6 +315,8 @@ typedef struct
 
     int bUseFxc;
     std::string fxcCmdLine;
+
+    const char* cacheDir;
 } Options;
 
 void InitOptions(Options* psOptions)
@@ -325,6 +328,7 @@ void InitOptions(Options* psOptions)
     psOptions->shaderFile = NULL;
 
     psOptions->bUseFxc = 0;
+    psOptions->cacheDir = NULL;
 }
 
 void PrintHelp()
@@ -340,6 +344,7 @@ void PrintHelp()
     printf("\t-hashout=[dir/]out-file-name \t Output file name is a hash of 'out-file-name', put in the directory 'dir'.\n");
 
     printf("\t-fxc=\"CMD\" HLSL compiler command line. If specified the input shader will be first compiled through this command first and then the resulting bytecode translated.\n");
+    printf("\t-cachedir=X \t Directory used to reuse translations of identical fxc bytecode across runs. Ignored when -reflect is used.\n");
 
     printf("\n");
 }
@@ -441,6 +446,12 @@ int GetOptions(int argc, char** argv, Options* psOptions)
             psOptions->outputShaderFile = psOptions->cacheKey;
         }
 
+        option = strstr(argv[i], "-cachedir=");
+        if (option != NULL)
+        {
+            psOptions->cacheDir = option + strlen("-cachedir=");
+        }
+
         option = strstr(argv[i], "-fxc=");
         if (option != NULL)
         {
@@ -648,6 +659,77 @@ case _Name:                   \
 
 #endif
 
+// Translations are cached by a hash of the fxc bytecode together with the target language and flags, so
+// permutations that compile down to the same DXBC are only cross compiled once.
+bool ReadWholeFile(const char* path, std::vector<uint8_t>& data)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file)
+    {
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    data.resize(size > 0 ? size : 0);
+    bool result = size > 0 && fread(data.data(), 1, size, file) == (size_t)size;
+    fclose(file);
+    return result;
+}
+
+bool WriteWholeFile(const char* path, const std::vector<uint8_t>& data)
+{
+    FILE* file = fopen(path, "wb");
+    if (!file)
+    {
+        return false;
+    }
+
+    bool result = fwrite(data.data(), 1, data.size(), file) == data.size();
+    fclose(file);
+    return result;
+}
+
+bool GetTranslationCachePath(const Options& options, const char* dxbcFileName, char* cachePath, size_t cachePathSize)
+{
+    std::vector<uint8_t> dxbc;
+    if (!ReadWholeFile(dxbcFileName, dxbc))
+    {
+        return false;
+    }
+
+    const uint64_t settings = ((uint64_t)options.language << 32) | (uint32_t)options.flags;
+    const uint64_t hash = hash64(dxbc.data(), (uint32_t)dxbc.size(), settings);
+    sprintf_s(cachePath, cachePathSize, "%s/%016llX.hlslcc", options.cacheDir, (unsigned long long)hash);
+    return true;
+}
+
+bool LoadFromTranslationCache(const char* cachePath, const char* outputFileName)
+{
+    std::vector<uint8_t> data;
+    return ReadWholeFile(cachePath, data) && WriteWholeFile(outputFileName, data);
+}
+
+void StoreInTranslationCache(const char* cachePath, const char* outputFileName)
+{
+    std::vector<uint8_t> data;
+    if (!ReadWholeFile(outputFileName, data))
+    {
+        return;
+    }
+
+    // Several compiler processes can produce the same entry at once, write to a file named after this
+    // request and move it into place so readers never see a partial entry.
+    char tempPath[MAX_PATH_CHARS];
+    const uint64_t requestHash = hash64((const uint8_t*)outputFileName, (uint32_t)strlen(outputFileName), 0);
+    sprintf_s(tempPath, sizeof(tempPath), "%s.%016llX", cachePath, (unsigned long long)requestHash);
+    if (!WriteWholeFile(tempPath, data) || rename(tempPath, cachePath) != 0)
+    {
+        remove(tempPath);
+    }
+}
+
 const char* PatchHLSLShaderFile(const char* path)
 {
     // Need to transform "half" into "min16float" so FXC preserve min precision to the operands.
@@ -764,13 +846,25 @@ int main(int argc, char** argv)
 
         if (retValue == 0)
         {
-            GLSLShader shader;
-            retValue = !Run(dxbcFileName, glslFileName, options.language, options.flags, options.reflectPath, &shader, 1);
+            char cachePath[MAX_PATH_CHARS];
+            const bool useCache = options.cacheDir && !options.reflectPath &&
+                GetTranslationCachePath(options, dxbcFileName, cachePath, sizeof(cachePath));
 
-            if (retValue == 0)
+            if (!useCache || !LoadFromTranslationCache(cachePath, options.outputShaderFile))
             {
-                retValue = !CombineDXBCWithGLSL(dxbcFileName, options.outputShaderFile, &shader);
-                FreeGLSLShader(&shader);
+                GLSLShader shader;
+                retValue = !Run(dxbcFileName, glslFileName, options.language, options.flags, options.reflectPath, &shader, 1);
+
+                if (retValue == 0)
+                {
+                    retValue = !CombineDXBCWithGLSL(dxbcFileName, options.outputShaderFile, &shader);
+                    FreeGLSLShader(&shader);
+                }
+
+                if (retValue == 0 && useCache)
+                {
+                    StoreInTranslationCache(cachePath, options.outputShaderFile);
+                }
             }
         }
 
@@ -48,6 +48,8 @@ void PakManager::RegisterKeys(IResourceCompiler* pRC)
     pRC->RegisterKey("zip_encrypt_key", "Specifies a 128-bit key in hexadecimal format: 32-character string. Low endian format.");
     pRC->RegisterKey("zip_encrypt_content", "Encrypts files inside of zip. Works only when zip_encrypt enabled. Disabled by default.");
     pRC->RegisterKey("zip_compression", "Specify compression level for zipped files. [0-9] 0=no compression, 9=max compression. Default is 6.");
+    pRC->RegisterKey("zip_lz4_blocksize", "Compress files with LZ4 in separate blocks of this size in KB, so the engine can decompress them in parallel.\n"
+        "zip_compression is used as the LZ4 HC level. Default is 0: files are deflated.");
     pRC->RegisterKey("zip_sort", "Define sorting type when adding files to the pak, currently supported:\n"
         "nosort, size, streaming, suffix, alphabetically. Alphabetically is default.");
     pRC->RegisterKey("zip_split", "Define split type for distributing files into different paks automatically, currently supported:\n"
@@ -56,6 +58,7 @@ void PakManager::RegisterKeys(IResourceCompiler* pRC)
     pRC->RegisterKey("zip_sizesplit", "Split zip files automatically when the maximum compressed size (configured or supported) has been reached");
     pRC->RegisterKey("zip_alignment", "Alignment of files inside zip. Default is 1 byte.");
     pRC->RegisterKey("zip_new", "Forces creation of new zip file overwriting existing one");
+    pRC->RegisterKey("zip_prune", "When updating an existing zip file, remove the entries that are not in the list of files to add (see 'zip' command). Not supported together with zip_sizesplit");
     pRC->RegisterKey("FolderInZip", "Put source files into this specified folder inside of zip file (see 'zip' command)");
     pRC->RegisterKey("sourceminsize", "only copy or zip a source file if its size is greater or equal than the size specified. used with 'copyonly' and 'zip' commands.");
     pRC->RegisterKey("sourcemaxsize", "only copy or zip a source file if its size is less or equal than the size specified. used with 'copyonly' and 'zip' commands.");
@@ -229,6 +232,43 @@ PakManager::ECallResult PakManager::SynchronizePaks(
     return eCallResult_Succeeded;
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Removes every entry of the archive that isn't one of the given files. Together with the CRC check in
+// UpdateMultipleFiles this turns an update of an existing pak into the equivalent of rebuilding it: unchanged
+// entries are kept as they are, changed ones are appended and the archive is compacted when it's closed.
+size_t PakManager::PruneEntries(ZipDir::CacheRW* zip, const std::vector<const char*>& filenamesInZip, bool bVerbose)
+{
+    std::set<ZipDir::FileEntry*> requestedEntries;
+    for (const char* filenameInZip : filenamesInZip)
+    {
+        if (ZipDir::FileEntry* entry = zip->FindFile(filenameInZip))
+        {
+            requestedEntries.insert(entry);
+        }
+    }
+
+    std::vector<string> stalePaths;
+    ZipDir::FileRecordList records(zip->GetRoot());
+    for (const ZipDir::FileRecord& record : records)
+    {
+        if (requestedEntries.find(record.pFileEntry) == requestedEntries.end())
+        {
+            stalePaths.push_back(record.strPath);
+        }
+    }
+
+    for (const string& stalePath : stalePaths)
+    {
+        if (bVerbose)
+        {
+            RCLog("Zip [%s]: removed %s", zip->GetFilePath(), stalePath.c_str());
+        }
+        zip->RemoveFile(stalePath.c_str());
+    }
+
+    return stalePaths.size();
+}
+
 //////////////////////////////////////////////////////////////////////////
 PakManager::ECallResult PakManager::CreatePakFile(
     const IConfig* config,
@@ -334,11 +374,23 @@ PakManager::ECallResult PakManager::CreatePakFile(
     const int nMaxZipSize = config->GetAsInt("zip_maxsize", 0, 0) * 1024;
 
     const bool bSplitOnSizeOverflow = config->GetAsBool("zip_sizesplit", false, true);
+    const bool bPruneEntries = bUpdate && config->GetAsBool("zip_prune", false, true);
+    if (bPruneEntries && bSplitOnSizeOverflow)
+    {
+        RCLogError("zip_prune can't be used together with zip_sizesplit. Creating of pak failed.");
+        return eCallResult_BadArgs;
+    }
 
     const int nMaxSrcSize = config->GetAsInt("sourcemaxsize", -1, -1);
     const int nMinSrcSize = config->GetAsInt("sourceminsize", 0, 0);
 
     const int zipCompressionLevel = config->GetAsInt("zip_compression", 6, 6);
+    const int zipBlockSize = config->GetAsInt("zip_lz4_blocksize", 0, 0) * 1024;
+    if (zipBlockSize < 0)
+    {
+        RCLogError("Invalid zip_lz4_blocksize argument: %d. Creating of pak failed.", zipBlockSize / 1024);
+        return eCallResult_BadArgs;
+    }
 
     ECallResult bResult = eCallResult_Succeeded;
     for (std::map<string, std::vector<PakHelpers::PakEntry> >::iterator it = fileMap.begin(); it != fileMap.end(); ++it)
@@ -607,7 +659,7 @@ PakManager::ECallResult PakManager::CreatePakFile(
                 RCLog("Adding files into %s...", pakFilenameToWrite.c_str());
                 pPakFile->zip->UpdateMultipleFiles(&realFilenamePtrs[0], &filenameInZipPtrs[0], filenameCount,
                     zipCompressionLevel, zipEncrypt && zipEncryptContent, nMaxZipSize, nMinSrcSize, nMaxSrcSize,
-                    GetMaxThreads(), &errorReporter, bSplitOnSizeOverflow ? &sizeSplitter : nullptr);
+                    GetMaxThreads(), &errorReporter, bSplitOnSizeOverflow ? &sizeSplitter : nullptr, zipBlockSize);
 
                 // divide files in case it has overflown the maximum allowed file-size
                 if (bSplitOnSizeOverflow)
@@ -720,6 +772,12 @@ PakManager::ECallResult PakManager::CreatePakFile(
                 }
                 else
                 {
+                    if (bPruneEntries)
+                    {
+                        const size_t numFilesPruned = PruneEntries(pPakFile->zip, filenameInZipPtrs, iVerbose > 1);
+                        RCLog("Removed %u entries from %s that are no longer requested", numFilesPruned, pakFilenameToWrite.c_str());
+                    }
+
                     filenameCount = 0;
                     realFilenamePtrs.clear();
                     filenameInZipPtrs.clear();
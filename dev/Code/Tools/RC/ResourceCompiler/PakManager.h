@@ -69,6 +69,11 @@ private:
         const IConfig* config,
         const std::vector<string>& deletedTargetFiles);
 
+    size_t PruneEntries(
+        ZipDir::CacheRW* zip,
+        const std::vector<const char*>& filenamesInZip,
+        bool bVerbose);
+
     ECallResult UnzipPakFile(
         const IConfig* config,
         const std::vector<RcFile>& sourceFiles,
@@ -259,9 +259,13 @@ bool CharacterCompiler::ProcessWork(CLoaderCGF* cgfLoader, CContentCGF* pCGF, CC
         {
             bStorePositionsAsF16 = !pCGF->GetExportInfo()->bWantF32Vertices;
         }
+        else if (StringHelpers::EqualsIgnoreCase(s, "auto"))
+        {
+            bStorePositionsAsF16 = CStaticObjectCompiler::CanStorePositionsAsF16(pCGF, 0.001f);  // 1mm
+        }
         else
         {
-            RCLogError("Unknown value of '%s': '%s'. Valid values are: 'f32', 'f16', 'exporter'.", optionName, s.c_str());
+            RCLogError("Unknown value of '%s': '%s'. Valid values are: 'f32', 'f16', 'exporter', 'auto'.", optionName, s.c_str());
             return false;
         }
     }
@@ -720,7 +724,7 @@ CContentCGF* CharacterCompiler::MakeCompiledCGF(CContentCGF* pCGF)
             // Confetti: Nicholas Baldwin
             const bool DegenerateFacesAreErrors = m_CC.config->GetAsBool("DegenerateFacesAreErrors", false, false);
             int compileFlags = mesh_compiler::MESH_COMPILE_TANGENTS
-                | ((m_bOptimizePVRStripify) ? mesh_compiler::MESH_COMPILE_PVR_STRIPIFY : mesh_compiler::MESH_COMPILE_OPTIMIZE)
+                | ((m_bOptimizePVRStripify) ? mesh_compiler::MESH_COMPILE_PVR_STRIPIFY : (mesh_compiler::MESH_COMPILE_OPTIMIZE | mesh_compiler::MESH_COMPILE_OPTIMIZE_OVERDRAW))
                 | ((DegenerateFacesAreErrors) ? mesh_compiler::MESH_COMPILE_VALIDATE_FAIL_ON_DEGENERATE_FACES : 0)
                 | mesh_compiler::MESH_COMPILE_VALIDATE;
 
@@ -153,7 +153,8 @@ extern "C" DLL_EXPORT void __stdcall RegisterConvertors(IResourceCompiler* const
         "[CGF] Format of mesh vertex positions:\n"
         "f32 = 32-bit floating point (default)\n"
         "f16 = 16-bit floating point\n"
-        "exporter = format specified in exporter\n");
+        "exporter = format specified in exporter\n"
+        "auto = 16-bit floating point if it keeps positions within 1mm of the source, 32-bit otherwise\n");
 
     pRC->RegisterKey("vertexIndexFormat",
         "[CGF] Format of mesh vertex indices:\n"
@@ -875,9 +875,13 @@ bool CStatCGFCompiler::Process()
             {
                 bStorePositionsAsF16 = !pCGF->GetExportInfo()->bWantF32Vertices;
             }
+            else if (StringHelpers::EqualsIgnoreCase(s, "auto"))
+            {
+                bStorePositionsAsF16 = CStaticObjectCompiler::CanStorePositionsAsF16(pCGF, 0.001f);  // 1mm
+            }
             else
             {
-                RCLogError("Unknown value of '%s': '%s'. Valid values are: 'f32', 'f16', 'exporter'.", optionName, s.c_str());
+                RCLogError("Unknown value of '%s': '%s'. Valid values are: 'f32', 'f16', 'exporter', 'auto'.", optionName, s.c_str());
                 delete pCGF;
                 return false;
             }
@@ -433,7 +433,7 @@ bool CStaticObjectCompiler::CompileMeshes(CContentCGF* pCGF)
             if (!pNodeCGF->bPhysicsProxy)
             {
                 // Confetti: Nicholas Baldwin
-                nMeshCompileFlags |= (m_bOptimizePVRStripify) ? mesh_compiler::MESH_COMPILE_PVR_STRIPIFY : mesh_compiler::MESH_COMPILE_OPTIMIZE;
+                nMeshCompileFlags |= (m_bOptimizePVRStripify) ? mesh_compiler::MESH_COMPILE_PVR_STRIPIFY : (mesh_compiler::MESH_COMPILE_OPTIMIZE | mesh_compiler::MESH_COMPILE_OPTIMIZE_OVERDRAW);
             }
 
             if (!meshCompiler.Compile(*pNodeCGF->pMesh, nMeshCompileFlags))
@@ -2383,6 +2383,34 @@ int CStaticObjectCompiler::GetJointCount(const CContentCGF* pCGF)
     return jointCount;
 }
 
+//////////////////////////////////////////////////////////////////////////
+bool CStaticObjectCompiler::CanStorePositionsAsF16(const CContentCGF* pCGF, float maxError)
+{
+    float maxCoord = 0.0f;
+    if (pCGF)
+    {
+        const int nodeCount = pCGF->GetNodeCount();
+        for (int i = 0; i < nodeCount; ++i)
+        {
+            const CNodeCGF* const pNode = pCGF->GetNode(i);
+            if (pNode && pNode->pMesh && pNode->pMesh->m_pPositions)
+            {
+                const CMesh& mesh = *pNode->pMesh;
+                for (int v = 0, n = mesh.GetVertexCount(); v < n; ++v)
+                {
+                    const Vec3& p = mesh.m_pPositions[v];
+                    maxCoord = max(maxCoord, max(fabsf(p.x), max(fabsf(p.y), fabsf(p.z))));
+                }
+            }
+        }
+    }
+
+    // 16-bit float has 10 explicit mantissa bits, so the distance between neighbouring
+    // values around maxCoord is at most maxCoord / 2^10 and rounding error is half of that.
+    // Values beyond the f16 range (65504) can't be stored at all.
+    return maxCoord < 65504.0f && maxCoord * (0.5f / 1024.0f) <= maxError;
+}
+
 // Skinned Geometry (.CGF) export type (for touch bending vegetation)
 void CStaticObjectCompiler::BuildFoliageInfoFromSkinningInfo(SFoliageInfoCGF& foliageInfo, const CSkinningInfo* pSkinningInfo, CContentCGF* pCGF)
 {
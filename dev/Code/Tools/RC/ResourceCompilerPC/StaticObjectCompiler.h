@@ -43,6 +43,8 @@ public:
 
     static int GetSubMeshCount(const CContentCGF* pCGFLod0);
     static int GetJointCount(const CContentCGF* pCGF);
+    // Returns true if rounding positions of all meshes to 16-bit floats keeps them within maxError
+    static bool CanStorePositionsAsF16(const CContentCGF* pCGF, float maxError);
 
 private:
     bool ProcessCompiledCGF(CContentCGF* pCGF);
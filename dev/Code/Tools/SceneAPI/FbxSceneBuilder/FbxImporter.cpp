@@ -74,14 +74,13 @@ namespace AZ
                 }
                 m_sceneSystem->Set(*m_sceneWrapper);
 
-                if (ConvertFbxSceneContext(context.GetScene()))
-                {
-                    return Events::ProcessingResult::Success;
-                }
-                else
-                {
-                    return Events::ProcessingResult::Failure;
-                }
+                bool converted = ConvertFbxSceneContext(context.GetScene());
+
+                // All data has been copied into the scene graph, release the FBX SDK's copy of the scene now instead of
+                // keeping both alive until the loaders are destroyed. For large scenes this roughly halves peak memory.
+                m_sceneWrapper->Clear();
+
+                return converted ? Events::ProcessingResult::Success : Events::ProcessingResult::Failure;
             }
 
             bool FbxImporter::ConvertFbxSceneContext(Containers::Scene& scene) const
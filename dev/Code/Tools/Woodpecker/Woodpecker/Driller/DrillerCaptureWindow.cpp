@@ -34,6 +34,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 
 #include "QtGui/QPalette"
+#include <QElapsedTimer>
 #include "Annotations/AnnotationHeaderView.hxx"
 #include "Annotations/ConfigureAnnotationsWindow.hxx"
 
@@ -363,6 +364,7 @@ namespace Driller
         m_currentDataFilename = "";
         SetCaptureMode(CaptureMode::Configuration);
         OnCloseFile();
+        m_isLoadingFile = false;
         m_data->CloseCaptureData();
         m_data->CreateAggregators();
         UpdateLiveControls();
@@ -792,6 +794,7 @@ namespace Driller
         if (IsInCaptureMode(CaptureMode::Inspecting))
         {
             AZ_TracePrintf(drillerDebugName, "Close requested of file\n");
+            m_isLoadingFile = false;
             m_data->CloseCaptureData();
             this->close();
             deleteLater();
@@ -1400,31 +1403,70 @@ namespace Driller
     {
         if (m_data)
         {
-            QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
             m_AnnotationProvider.Clear();
 
             SetCaptureDirty(false);
             m_currentDataFilename = fileName;
 
+            // the file is read incrementally by OnLoadDrillerFileChunk, which shows the frames as they are loaded
             m_isLoadingFile = true;
-            m_data->LoadCaptureData(fileName.toUtf8().data());
-            m_isLoadingFile = false;
+            const bool isLoading = m_data->StartLoadingCaptureData(fileName.toUtf8().data());
 
             SetCaptureMode(CaptureMode::Inspecting);
-
             m_bForceNextScrub = true;
-            EndFrame(m_frameRangeEnd);
-            SetPlaybackLoopBegin(0);
-            SetPlaybackLoopEnd(m_frameRangeEnd);
 
-            OnQuantMenuFinal(m_visibleFrames);
+            if (isLoading)
+            {
+                QTimer::singleShot(0, this, SLOT(OnLoadDrillerFileChunk()));
+            }
+            else
+            {
+                OnLoadDrillerFileChunk();
+            }
+        }
+    }
 
-            UpdateLiveControls();
-            m_bForceNextScrub = true;
+    void DrillerCaptureWindow::OnLoadDrillerFileChunk()
+    {
+        if (!m_isLoadingFile || !m_data)
+        {
+            // the capture was closed while it was loading
+            return;
+        }
+
+        bool hasMoreData = m_data->IsLoadingCaptureData();
+        QElapsedTimer sliceTimer;
+        sliceTimer.start();
+        while (hasMoreData && sliceTimer.elapsed() < s_fileLoadSliceMilliseconds)
+        {
+            hasMoreData = m_data->LoadCaptureDataChunk();
+        }
+
+        m_isLoadingFile = false;
+
+        if (hasMoreData)
+        {
+            // show what has been loaded so far, the scrubber stays where the user put it
+            EndFrame(m_frameRangeEnd);
 
-            ScrubberToEnd();
-            QApplication::restoreOverrideCursor();
+            m_isLoadingFile = true;
+            QTimer::singleShot(0, this, SLOT(OnLoadDrillerFileChunk()));
+            return;
         }
+
+        m_data->StopLoadingCaptureData();
+
+        m_bForceNextScrub = true;
+        EndFrame(m_frameRangeEnd);
+        SetPlaybackLoopBegin(0);
+        SetPlaybackLoopEnd(m_frameRangeEnd);
+
+        OnQuantMenuFinal(m_visibleFrames);
+
+        UpdateLiveControls();
+        m_bForceNextScrub = true;
+
+        ScrubberToEnd();
     }
 
     void DrillerCaptureWindow::OnOpenDrillerFileForWorkspace(QString fileName, QString workspaceFileName)
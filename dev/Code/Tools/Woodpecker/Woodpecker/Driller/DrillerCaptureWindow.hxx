@@ -194,6 +194,8 @@ namespace Driller
         AnnotationsProvider m_AnnotationProvider;
 
         bool m_isLoadingFile;
+        // the capture is read in slices of this length, the frames loaded so far are shown in between so large files can be inspected while loading
+        static const int s_fileLoadSliceMilliseconds = 50;
 
         AnnotationHeaderView* m_ptrAnnotationsHeaderView;
         ConfigureAnnotationsWindow *m_ptrConfigureAnnotationsWindow;
@@ -235,6 +237,7 @@ namespace Driller
         void OnApplyWorkspaceFile(QString fileName);
         void OnSaveDrillerFile();        
         void OnSaveWorkspaceFile(QString fileName, bool automated = false);		
+        void OnLoadDrillerFileChunk();
 
         void PlaybackTick();
         void OnUpdateScrollSize();
@@ -265,16 +265,25 @@ namespace Driller
     }
 
     void DrillerDataContainer::LoadCaptureData(const char* fileName)
+    {
+        if (StartLoadingCaptureData(fileName))
+        {
+            while (LoadCaptureDataChunk())
+            {
+            }
+            StopLoadingCaptureData();
+        }
+    }
+
+    bool DrillerDataContainer::StartLoadingCaptureData(const char* fileName)
     {
         DrillerEvent::ResetGlobalEventId();
         // Reset data
         DestroyAggregators();
 
-        AZStd::string baseFilename( fileName );
-
         delete m_dataHandler;
         m_dataHandler = aznew DrillerDataHandler(m_identity, this);
-        AzFramework::DrillerRemoteSession::LoadCaptureData(fileName);
+        return AzFramework::DrillerRemoteSession::StartLoadingCaptureData(fileName);
     }
 
     void DrillerDataContainer::CloseCaptureData()
@@ -61,6 +61,7 @@ namespace Driller
 
         void  StartDrilling();
         void  LoadCaptureData(const char* fileName);
+        bool  StartLoadingCaptureData(const char* fileName);
         void  CloseCaptureData();
         void  CreateAggregators();
 
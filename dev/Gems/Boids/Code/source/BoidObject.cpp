@@ -386,16 +386,15 @@ void CBoidObject::CalcFlockBehavior(SBoidContext& bc, Vec3& vAlignment, Vec3& vC
     Vec3 avgNeighborsCenter(0, 0, 0);
     int numMates = 0;
 
-    int numBoids = m_flock->GetBoidsCount();
-    for (int i = 0; i < numBoids; i++)
+    // Only boids in the neighboring grid cells can be within the attract distance.
+    m_flock->ForEachBoidNeighbor(m_pos, bc.MaxAttractDistance, [&](const CFlock::SBoidNeighbor& neighbor)
     {
-        CBoidObject* boid = m_flock->GetBoid(i);
-        if (!boid || boid == this) // skip myself.
+        if (neighbor.boid == this) // skip myself.
         {
-            continue;
+            return;
         }
 
-        sight = boid->m_pos - m_pos;
+        sight = neighbor.pos - m_pos;
 
         float dist2 = Boid::Normalize_fast(sight);
 
@@ -414,12 +413,12 @@ void CBoidObject::CalcFlockBehavior(SBoidContext& bc, Vec3& vAlignment, Vec3& vC
             numMates++;
 
             // Alignment with boid direction.
-            avgAlignment += boid->m_heading * boid->m_speed;
+            avgAlignment += neighbor.velocity;
 
             // Calculate average center of all neighbor boids.
-            avgNeighborsCenter += boid->m_pos;
+            avgNeighborsCenter += neighbor.pos;
         }
-    }
+    });
     if (numMates > 0)
     {
         avgAlignment = avgAlignment * (1.0f / numMates);
@@ -98,6 +98,9 @@ CFlock::CFlock(IEntity* pEntity, EFlockType flockType)
 
     m_bEntityCreated = false;
     m_bAnyKilled = false;
+
+    m_neighborGridCellSize = 0.0f;
+    m_neighborGridInvCellSize = 0.0f;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -434,6 +437,7 @@ void CFlock::Update(CCamera* pCamera)
     //////////////////////////////////////////////////////////////////////////
 
     UpdateBoidCollisions();
+    UpdateNeighborGrid();
 
     Vec3 entityPos = m_pEntity->GetWorldPos();
     Matrix34 boidTM;
@@ -814,6 +818,9 @@ void CFlock::OnAIEvent(EAIStimulusType type, const Vec3& pos, float radius, floa
 void CFlock::GetMemoryUsage(ICrySizer* pSizer) const
 {
     pSizer->AddContainer(m_boids);
+    pSizer->AddContainer(m_neighborGridBoids);
+    pSizer->AddContainer(m_neighborGridBuckets);
+    pSizer->AddContainer(m_neighborGridBoidBuckets);
     pSizer->AddObject(m_model);
     pSizer->AddObject(m_boidEntityName);
     pSizer->AddObject(m_boidDefaultAnimName);
@@ -890,6 +897,56 @@ void CFlock::UpdateBoidCollisions()
     std::sort(m_BoidCollisionMap.begin(), m_BoidCollisionMap.end(), FSortBoidByTime());
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CFlock::UpdateNeighborGrid()
+{
+    FUNCTION_PROFILER(GetISystem(), PROFILE_ENTITY);
+
+    const uint32 numBoids = (uint32)m_boids.size();
+    uint32 numBuckets = 1;
+    while (numBuckets < numBoids * 2)
+    {
+        numBuckets <<= 1;
+    }
+
+    m_neighborGridCellSize = max(m_bc.MaxAttractDistance, 0.01f);
+    m_neighborGridInvCellSize = 1.0f / m_neighborGridCellSize;
+
+    // Counting sort of the boids by bucket, the vectors keep their memory between updates.
+    m_neighborGridBuckets.assign(numBuckets + 1, 0);
+    m_neighborGridBoidBuckets.resize(numBoids);
+    for (uint32 i = 0; i < numBoids; ++i)
+    {
+        const CBoidObject* boid = m_boids[i];
+        if (boid)
+        {
+            const uint32 bucket = GetNeighborGridBucket(GetNeighborGridCell(boid->m_pos.x), GetNeighborGridCell(boid->m_pos.y), GetNeighborGridCell(boid->m_pos.z));
+            m_neighborGridBoidBuckets[i] = bucket;
+            ++m_neighborGridBuckets[bucket];
+        }
+    }
+    // Bucket ends for now, turned into bucket starts while filling.
+    for (uint32 bucket = 1; bucket < numBuckets; ++bucket)
+    {
+        m_neighborGridBuckets[bucket] += m_neighborGridBuckets[bucket - 1];
+    }
+    m_neighborGridBuckets[numBuckets] = m_neighborGridBuckets[numBuckets - 1];
+
+    m_neighborGridBoids.resize(m_neighborGridBuckets[numBuckets]);
+    for (uint32 i = 0; i < numBoids; ++i)
+    {
+        const CBoidObject* boid = m_boids[i];
+        if (boid)
+        {
+            const uint32 index = --m_neighborGridBuckets[m_neighborGridBoidBuckets[i]];
+            SBoidNeighbor& neighbor = m_neighborGridBoids[index];
+            neighbor.pos = boid->m_pos;
+            neighbor.velocity = boid->m_heading * boid->m_speed;
+            neighbor.boid = boid;
+        }
+    }
+}
+
 //////////////////////////////////////////////////////////////////
 
 /*
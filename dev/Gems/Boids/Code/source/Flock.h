@@ -148,9 +148,75 @@ public:
 
     inline const Vec3& GetAvgBoidPos() const { return m_avgBoidPos; }
 
+    //! Boid state captured at the start of the flock update, for neighbor queries.
+    struct SBoidNeighbor
+    {
+        Vec3 pos;
+        Vec3 velocity; //!< Heading scaled by speed.
+        const CBoidObject* boid;
+    };
+
+    //! Calls func(const SBoidNeighbor&) for the boids in the neighbor grid cells around pos.
+    //! All boids closer than radius are visited, callers have to filter out the ones further away.
+    template<typename Func>
+    void ForEachBoidNeighbor(const Vec3& pos, float radius, Func func) const
+    {
+        if (radius > m_neighborGridCellSize)
+        {
+            // Range doesn't fit the grid (settings changed since the update), visit all boids.
+            for (const SBoidNeighbor& neighbor : m_neighborGridBoids)
+            {
+                func(neighbor);
+            }
+            return;
+        }
+
+        const int cellX = GetNeighborGridCell(pos.x);
+        const int cellY = GetNeighborGridCell(pos.y);
+        const int cellZ = GetNeighborGridCell(pos.z);
+
+        // Different cells can share a bucket, each bucket must only be visited once.
+        uint32 visitedBuckets[27];
+        int numVisitedBuckets = 0;
+        for (int z = cellZ - 1; z <= cellZ + 1; ++z)
+        {
+            for (int y = cellY - 1; y <= cellY + 1; ++y)
+            {
+                for (int x = cellX - 1; x <= cellX + 1; ++x)
+                {
+                    const uint32 bucket = GetNeighborGridBucket(x, y, z);
+                    if (std::find(visitedBuckets, visitedBuckets + numVisitedBuckets, bucket) != visitedBuckets + numVisitedBuckets)
+                    {
+                        continue;
+                    }
+                    visitedBuckets[numVisitedBuckets++] = bucket;
+
+                    for (uint32 i = m_neighborGridBuckets[bucket], end = m_neighborGridBuckets[bucket + 1]; i < end; ++i)
+                    {
+                        func(m_neighborGridBoids[i]);
+                    }
+                }
+            }
+        }
+    }
+
 protected:
     void UpdateAvgBoidPos(float dt);
     virtual void UpdateBoidCollisions();
+    void UpdateNeighborGrid();
+
+    int GetNeighborGridCell(float coord) const
+    {
+        return (int)floorf(coord * m_neighborGridInvCellSize);
+    }
+
+    uint32 GetNeighborGridBucket(int x, int y, int z) const
+    {
+        // Spatial hash from "Optimized Spatial Hashing for Collision Detection of Deformable Objects" (Teschner et al.),
+        // the number of buckets is a power of two.
+        const uint32 mask = (uint32)m_neighborGridBuckets.size() - 2;
+        return (((uint32)x * 73856093u) ^ ((uint32)y * 19349663u) ^ ((uint32)z * 83492791u)) & mask;
+    }
 
 public:
     static int m_e_flocks;
@@ -227,6 +293,14 @@ protected:
     float m_lastUpdatePosTimePassed;
 
     TTimeBoidMap m_BoidCollisionMap;
+
+    //! Hashed uniform grid over the boids with a cell size of MaxAttractDistance, rebuilt on every update.
+    //! Boids are stored sorted by bucket, bucket i owns m_neighborGridBoids[m_neighborGridBuckets[i], m_neighborGridBuckets[i + 1]).
+    std::vector<SBoidNeighbor> m_neighborGridBoids;
+    std::vector<uint32> m_neighborGridBuckets;
+    std::vector<uint32> m_neighborGridBoidBuckets;
+    float m_neighborGridCellSize;
+    float m_neighborGridInvCellSize;
 };
 
 #endif // CRYINCLUDE_GAMEDLL_BOIDS_FLOCK_H
@@ -13,6 +13,7 @@
 
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace CloudCanvas
 {
@@ -28,6 +29,9 @@ namespace CloudCanvas
         AZStd::string ResolvePath(const char* dirName, bool returnDirOnFailure = false);
         AZStd::string CalculateMD5(const char* relativeFile, bool useDirectAccess = true);
         AZStd::vector<unsigned char> GetMD5Buffer(const char* relativeFile, bool useDirectAccess = false);
+        // Record the MD5 of a file whose contents were hashed as they were written, later GetMD5Buffer calls return it without reading the file again
+        // for as long as the file's size and modification time are unchanged
+        void StoreMD5Buffer(const char* relativeFile, const AZStd::vector<unsigned char>& hashBuffer);
         bool IsPak(const AZStd::string& localFileName);
         bool IsManifest(const AZStd::string& localFileName);
     }
@@ -13,6 +13,9 @@
 #include <FileTransferSupport/FileTransferSupport.h>
 
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/lock.h>
 #include <AzFramework/IO/LocalFileIO.h>
 
 #include <platform.h>
@@ -22,6 +25,29 @@ namespace CloudCanvas
 {
     namespace FileTransferSupport
     {
+        namespace
+        {
+            struct StoredMD5
+            {
+                AZ::u64 m_fileSize{ 0 };
+                AZ::u64 m_modificationTime{ 0 };
+                AZStd::vector<unsigned char> m_hashBuffer;
+            };
+
+            struct StoredMD5Cache
+            {
+                AZStd::mutex m_mutex;
+                AZStd::unordered_map<AZStd::string, StoredMD5> m_storedMD5s;
+            };
+
+            // Kept in the environment so downloads in one module and hash checks in another share the same entries
+            AZ::EnvironmentVariable<StoredMD5Cache>& GetStoredMD5Cache()
+            {
+                static AZ::EnvironmentVariable<StoredMD5Cache> storedMD5Cache = AZ::Environment::CreateVariable<StoredMD5Cache>("CloudCanvasStoredMD5Cache");
+                return storedMD5Cache;
+            }
+        }
+
         // Assumes files which aren't there could be created
         bool CanWriteToFile(const AZStd::string& localFileName)
         {
@@ -104,6 +130,23 @@ namespace CloudCanvas
         {
             AZStd::string sanitizedString = ResolvePath(relativeFile);
 
+            {
+                AZ::EnvironmentVariable<StoredMD5Cache>& storedMD5Cache = GetStoredMD5Cache();
+                AZStd::lock_guard<AZStd::mutex> storedLock(storedMD5Cache->m_mutex);
+                auto& storedMap = storedMD5Cache->m_storedMD5s;
+                auto storedIter = storedMap.find(sanitizedString);
+                if (storedIter != storedMap.end())
+                {
+                    if (storedIter->second.m_fileSize == AZ::IO::SystemFile::Length(sanitizedString.c_str()) &&
+                        storedIter->second.m_modificationTime == AZ::IO::SystemFile::ModificationTime(sanitizedString.c_str()))
+                    {
+                        return storedIter->second.m_hashBuffer;
+                    }
+                    // The file was changed since it was hashed
+                    storedMap.erase(storedIter);
+                }
+            }
+
             // MD5 calculation requires 16 bytes in the dest string
             static const int hashLength = 16;
             AZStd::vector<unsigned char> hashVec;
@@ -115,6 +158,24 @@ namespace CloudCanvas
             return hashVec;
         }
 
+        void StoreMD5Buffer(const char* relativeFile, const AZStd::vector<unsigned char>& hashBuffer)
+        {
+            AZStd::string sanitizedString = ResolvePath(relativeFile);
+            if (!AZ::IO::SystemFile::Exists(sanitizedString.c_str()))
+            {
+                return;
+            }
+
+            StoredMD5 storedMD5;
+            storedMD5.m_fileSize = AZ::IO::SystemFile::Length(sanitizedString.c_str());
+            storedMD5.m_modificationTime = AZ::IO::SystemFile::ModificationTime(sanitizedString.c_str());
+            storedMD5.m_hashBuffer = hashBuffer;
+
+            AZ::EnvironmentVariable<StoredMD5Cache>& storedMD5Cache = GetStoredMD5Cache();
+            AZStd::lock_guard<AZStd::mutex> storedLock(storedMD5Cache->m_mutex);
+            storedMD5Cache->m_storedMD5s[sanitizedString] = AZStd::move(storedMD5);
+        }
+
         bool IsPak(const AZStd::string& someString)
         {
             return (azstricmp(PathUtil::GetExt(someString.c_str()), "pak") == 0);
@@ -33,10 +33,161 @@
 
 #include <CloudCanvasCommon/CloudCanvasCommonBus.h>
 
+#include <ISystem.h>
+#include <IZLibCompressor.h>
+
 #include <fstream>
 
 namespace CloudCanvas
 {
+#if defined(PLATFORM_SUPPORTS_AWS_NATIVE_SDK)
+    namespace
+    {
+        // Stream buffer which digests everything written through it before passing it on to a file, so a downloaded file's MD5 is known without reading it back
+        class MD5FileBuf
+            : public std::streambuf
+        {
+        public:
+            MD5FileBuf()
+            {
+                m_compressor = gEnv && gEnv->pSystem ? gEnv->pSystem->GetIZLibCompressor() : nullptr;
+                if (m_compressor)
+                {
+                    m_compressor->MD5Init(&m_context);
+                }
+                setp(m_writeBuffer, m_writeBuffer + sizeof(m_writeBuffer));
+            }
+
+            ~MD5FileBuf() override
+            {
+                FlushWriteBuffer();
+            }
+
+            bool Open(const char* fileName)
+            {
+                return m_file.open(fileName, std::ios_base::out | std::ios_base::in | std::ios_base::binary | std::ios_base::trunc) != nullptr;
+            }
+
+            // Flushes and closes the file, returns false if no digest could be produced
+            bool Finish(AZStd::vector<unsigned char>& hashBuffer)
+            {
+                const bool flushed = FlushWriteBuffer();
+                m_file.close();
+                if (!flushed || !m_compressor || !m_valid)
+                {
+                    return false;
+                }
+
+                // MD5 calculation requires 16 bytes in the dest string
+                char digest[16];
+                m_compressor->MD5Final(&m_context, digest);
+                hashBuffer.assign(reinterpret_cast<unsigned char*>(digest), reinterpret_cast<unsigned char*>(digest) + sizeof(digest));
+                return true;
+            }
+
+        protected:
+            int_type overflow(int_type ch) override
+            {
+                if (!FlushWriteBuffer())
+                {
+                    return traits_type::eof();
+                }
+                if (!traits_type::eq_int_type(ch, traits_type::eof()))
+                {
+                    *pptr() = traits_type::to_char_type(ch);
+                    pbump(1);
+                }
+                return traits_type::not_eof(ch);
+            }
+
+            int sync() override
+            {
+                return FlushWriteBuffer() ? m_file.pubsync() : -1;
+            }
+
+            int_type underflow() override
+            {
+                FlushWriteBuffer();
+                const int_type ch = m_file.sbumpc();
+                if (traits_type::eq_int_type(ch, traits_type::eof()))
+                {
+                    return ch;
+                }
+                m_readChar = traits_type::to_char_type(ch);
+                setg(&m_readChar, &m_readChar, &m_readChar + 1);
+                return ch;
+            }
+
+            pos_type seekoff(off_type off, std::ios_base::seekdir way, std::ios_base::openmode which) override
+            {
+                FlushWriteBuffer();
+                // Anything other than a position query means the bytes are no longer written in order
+                if (off != 0 || way != std::ios_base::cur)
+                {
+                    m_valid = false;
+                }
+                return m_file.pubseekoff(off, way, which);
+            }
+
+            pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+            {
+                FlushWriteBuffer();
+                m_valid = false;
+                return m_file.pubseekpos(pos, which);
+            }
+
+        private:
+            bool FlushWriteBuffer()
+            {
+                const std::streamsize count = pptr() - pbase();
+                if (count > 0)
+                {
+                    if (m_compressor && m_valid)
+                    {
+                        m_compressor->MD5Update(&m_context, pbase(), static_cast<unsigned int>(count));
+                    }
+                    if (m_file.sputn(pbase(), count) != count)
+                    {
+                        m_valid = false;
+                        setp(m_writeBuffer, m_writeBuffer + sizeof(m_writeBuffer));
+                        return false;
+                    }
+                }
+                setp(m_writeBuffer, m_writeBuffer + sizeof(m_writeBuffer));
+                return true;
+            }
+
+            std::filebuf m_file;
+            IZLibCompressor* m_compressor{ nullptr };
+            SMD5Context m_context;
+            bool m_valid{ true };
+            char m_readChar{ 0 };
+            char m_writeBuffer[64 * 1024];
+        };
+
+        class MD5FileStream
+            : public Aws::IOStream
+        {
+        public:
+            explicit MD5FileStream(const char* fileName)
+                : Aws::IOStream(&m_fileBuf)
+            {
+                if (!m_fileBuf.Open(fileName))
+                {
+                    setstate(std::ios_base::failbit);
+                }
+            }
+
+            bool Finish(AZStd::vector<unsigned char>& hashBuffer)
+            {
+                return m_fileBuf.Finish(hashBuffer);
+            }
+
+        private:
+            MD5FileBuf m_fileBuf;
+        };
+    }
+#endif
 
     PresignedURLManager::PresignedURLManager()
     {
@@ -109,7 +260,13 @@ namespace CloudCanvas
             Aws::String requestURL{ signedURL.c_str() };
             auto httpRequest(Aws::Http::CreateHttpRequest(requestURL, Aws::Http::HttpMethod::HTTP_GET, nullptr));
 
-            httpRequest->SetResponseStreamFactory([outputFile]() { return Aws::New<Aws::FStream>("TRANSFER", outputFile.c_str(), std::ios_base::out | std::ios_base::in | std::ios_base::binary | std::ios_base::trunc); });
+            // The body is digested as it is written so the caller's MD5 check of the downloaded file doesn't have to read it back from disk
+            MD5FileStream* downloadStream{ nullptr };
+            httpRequest->SetResponseStreamFactory([outputFile, &downloadStream]()
+            {
+                downloadStream = Aws::New<MD5FileStream>("TRANSFER", outputFile.c_str());
+                return downloadStream;
+            });
 
             auto httpResponse = httpClient->MakeRequest(*httpRequest, nullptr);
 
@@ -140,6 +297,12 @@ namespace CloudCanvas
             else
             {
                 AZ_TracePrintf("CloudCanvas", "PresignedURL downloaded: %s", outputFile.c_str());
+
+                AZStd::vector<unsigned char> hashBuffer;
+                if (downloadStream && downloadStream->Finish(hashBuffer))
+                {
+                    FileTransferSupport::StoreMD5Buffer(outputFile.c_str(), hashBuffer);
+                }
             }
             if (!id.IsValid())
             {
@@ -87,8 +87,11 @@ namespace CloudGemMetric
         bool FlushMetricsToFileAsync(const MetricsSettings::Settings& settings, SendMetricsMode sendMetricsMode);
         bool FlushMetricsToFile(AZStd::shared_ptr<MetricsQueue> metricsToFlush, SendMetricsMode sendMetricsMode, const MetricsSettings::Settings& settings);
         bool FlushLiveUpdateMetricsConfigsToFile();
-        bool StartFlushMetricsToFileJob(AZStd::shared_ptr<MetricsQueue> metrics, const MetricsSettings::Settings& settings, SendMetricsMode sendMetricsMode);
-        AZ::Job* CreateFlushMetricsToFileJob(AZStd::shared_ptr<MetricsQueue> metrics, const MetricsSettings::Settings& settings, SendMetricsMode sendMetricsMode);
+        // hand metrics off to the background flush job, at most one flush job is queued at a time and later hand-offs are batched into it
+        bool QueueMetricsForFlush(MetricsQueue& metrics, const MetricsSettings::Settings& settings, SendMetricsMode sendMetricsMode);
+        void FlushPendingMetrics();
+        bool StartFlushMetricsToFileJob();
+        AZ::Job* CreateFlushMetricsToFileJob();
 
         bool CreateMetricsDirIfNotExists();
         const char* GetMetricsDir() const;
@@ -114,6 +117,15 @@ namespace CloudGemMetric
                 
         AZStd::mutex m_metricsFileMutex;        
 
+        ////////////////////////////////////////////
+        // these data are protected by m_pendingFlushMutex
+        AZStd::mutex m_pendingFlushMutex;
+        MetricsQueue m_pendingFlushQueue;
+        MetricsSettings::Settings m_pendingFlushSettings;
+        SendMetricsMode m_pendingFlushMode{SendMetricsMode::NO};
+        bool m_flushJobPending{false};
+        ////////////////////////////////////////////
+
         AZStd::unique_ptr<DefaultAttributesGenerator> m_defaultAttributesGenerator;
 
         ////////////////////////////////////////////
@@ -132,9 +132,9 @@ namespace CloudGemMetric
         return fileIO;
     }
 
-    bool MetricManager::StartFlushMetricsToFileJob(AZStd::shared_ptr<MetricsQueue> metricsToFlush, const MetricsSettings::Settings& settings, SendMetricsMode sendMetricsMode)
+    bool MetricManager::StartFlushMetricsToFileJob()
     {
-        AZ::Job* job = CreateFlushMetricsToFileJob(metricsToFlush, settings, sendMetricsMode);
+        AZ::Job* job = CreateFlushMetricsToFileJob();
         if (job)
         {
             job->Start();
@@ -146,6 +146,59 @@ namespace CloudGemMetric
         }
     }
 
+    bool MetricManager::QueueMetricsForFlush(MetricsQueue& metrics, const MetricsSettings::Settings& settings, SendMetricsMode sendMetricsMode)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingFlushMutex);
+
+            m_pendingFlushQueue.MoveMetrics(metrics);
+            m_pendingFlushSettings = settings;
+
+            // a forced send wins over an elligible one, which wins over a plain write to file
+            if (sendMetricsMode == SendMetricsMode::FORCE ||
+                (sendMetricsMode == SendMetricsMode::ELLIGIBLE && m_pendingFlushMode == SendMetricsMode::NO))
+            {
+                m_pendingFlushMode = sendMetricsMode;
+            }
+
+            if (m_flushJobPending)
+            {
+                // the queued job has not picked up its batch yet, it will take these metrics along
+                return true;
+            }
+
+            m_flushJobPending = true;
+        }
+
+        if (!StartFlushMetricsToFileJob())
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingFlushMutex);
+            m_flushJobPending = false;
+            return false;
+        }
+
+        return true;
+    }
+
+    void MetricManager::FlushPendingMetrics()
+    {
+        auto metricsToFlush = AZStd::make_shared<MetricsQueue>();
+        MetricsSettings::Settings settings;
+        SendMetricsMode sendMetricsMode;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingFlushMutex);
+
+            metricsToFlush->MoveMetrics(m_pendingFlushQueue);
+            settings = m_pendingFlushSettings;
+            sendMetricsMode = m_pendingFlushMode;
+
+            m_pendingFlushMode = SendMetricsMode::NO;
+            m_flushJobPending = false;
+        }
+
+        FlushMetricsToFile(metricsToFlush, sendMetricsMode, settings);
+    }
+
     void MetricManager::SendBufferedMetrics()
     {
         AZStd::lock_guard<AZStd::mutex> lock(m_metricsMutex);
@@ -293,16 +346,16 @@ namespace CloudGemMetric
         }
     }
 
-    AZ::Job* MetricManager::CreateFlushMetricsToFileJob(AZStd::shared_ptr<MetricsQueue> metricsToFlush, const MetricsSettings::Settings& settings, SendMetricsMode sendMetricsMode)
+    AZ::Job* MetricManager::CreateFlushMetricsToFileJob()
     {
         AZ::JobContext* jobContext{ nullptr };
         EBUS_EVENT_RESULT(jobContext, CloudCanvasCommon::CloudCanvasCommonRequestBus, GetDefaultJobContext);
 
         AZ::Job* job{ nullptr };
 
-        job = AZ::CreateJobFunction([this, metricsToFlush, sendMetricsMode, settings]()
+        job = AZ::CreateJobFunction([this]()
         {            
-            FlushMetricsToFile(metricsToFlush, sendMetricsMode, settings);
+            FlushPendingMetrics();
         }, true, jobContext);
 
         return job;
@@ -377,8 +430,10 @@ namespace CloudGemMetric
                 },
                     [this, metrics, settings](ServiceAPI::SendMetricToSQSRequestJob* job)
                 {
-                    // failed to send, write these metrics to file and wait for next try
-                    FlushMetricsToFile(metrics, SendMetricsMode::NO, settings);
+                    // failed to send, hand these metrics back to the flush job so they are written to file with any other pending batch and wait for next try
+                    // the file lock keeps us from draining the queue while it is still being serialized
+                    AZStd::lock_guard<AZStd::mutex> lock(m_metricsFileMutex);
+                    QueueMetricsForFlush(*metrics, settings, SendMetricsMode::NO);
                 }
                 );                    
                 MetricManager::SetEventParameters(job->parameters, metricsParameters);
@@ -422,10 +477,7 @@ namespace CloudGemMetric
             return false;
         }
 
-        auto metricsToFlush = AZStd::make_shared<MetricsQueue>();
-        metricsToFlush->MoveMetrics(m_metricsQueue);
-
-        return StartFlushMetricsToFileJob(metricsToFlush, settings, sendMetricsMode);
+        return QueueMetricsForFlush(m_metricsQueue, settings, sendMetricsMode);
     }
 
     bool MetricManager::CreateMetricsDirIfNotExists()
@@ -125,7 +125,7 @@ namespace CloudGemMetric
         }        
         else
         {
-            m_metrics.insert(m_metrics.end(), metricsQueue.m_metrics.begin(), metricsQueue.m_metrics.end());
+            m_metrics.insert(m_metrics.end(), AZStd::make_move_iterator(metricsQueue.m_metrics.begin()), AZStd::make_move_iterator(metricsQueue.m_metrics.end()));
             metricsQueue.m_metrics.clear();
 
             m_sizeInBytes += metricsQueue.m_sizeInBytes;
@@ -61,7 +61,6 @@ namespace CloudsGem
 
         static int pp[B + B + 2];
         static double g3[B + B + 2][3];
-        static int start = 1;
 
         void Init()
         {
@@ -100,11 +99,9 @@ namespace CloudsGem
             double rx0, rx1, ry0, ry1, rz0, rz1, *q, sy, sz, a, b, c, d, t, u, v;
             int i, j;
 
-            if (start)
-            {
-                start = 0;
-                Init();
-            }
+            // the tables are built once, thread safe since the volume is voxelized on several jobs
+            static const bool s_initialized = (Init(), true);
+            (void)s_initialized;
 
             setup(0, bx0, bx1, rx0, rx1);
             setup(1, by0, by1, ry0, ry1);
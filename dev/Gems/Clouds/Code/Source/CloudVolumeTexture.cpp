@@ -73,7 +73,7 @@ namespace CloudsGem
     {
         if (CTexture::IsTextureExist(m_texture))
         {
-            m_frameIndex ^= m_frameIndex;
+            m_frameIndex ^= 1;
 
 #if !defined(DEDICATED_SERVER)
             uint8_t* stagingData = GetCurrentStagingData();
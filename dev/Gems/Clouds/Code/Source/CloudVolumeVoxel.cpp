@@ -19,6 +19,12 @@
 #include "CloudVolumePerlinNoise.h"
 #include "CloudVolumeRenderElement.h"
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/parallel/atomic.h>
+
 namespace CloudsGem
 {
     static const int s_volumeShadowSize = 32;
@@ -301,12 +307,13 @@ namespace CloudsGem
             const uint8 bias = (uint8)(origBias * 256.0f);
             const uint32 biasNorm = (uint32)(256.0f * 256.0f * (origFillDens / (1.0f - origBias)));
 
-            size_t idx = 0;
-
-            float nz = 0;
-            float gz = 0;
-            for (uint32 z = 0; z < trg.m_depth; ++z, nz += 1.0f, gz += stepGz)
+            // each slice only reads tmp and writes its own part of trg, so slices are perturbed in parallel
+            auto perturbSlice = [&](uint32 z)
             {
+                const float nz = (float)z;
+                const float gz = stepGz * (float)z;
+                size_t idx = trg.Idx(0, 0, z);
+
                 float ny = 0;
                 float gy = 0;
                 for (uint32 y = 0; y < trg.m_height; ++y, ny += 1.0f, gy += stepGy)
@@ -323,6 +330,38 @@ namespace CloudsGem
                         trg[idx] = Saturate(Saturate(val - bias) * biasNorm >> 16);
                     }
                 }
+            };
+
+            AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+            const size_t workerCount = jobContext ? jobContext->GetJobManager().GetNumWorkerThreads() : 0;
+            const size_t jobCount = AZStd::min(workerCount, static_cast<size_t>(trg.m_depth));
+            if (jobCount <= 1)
+            {
+                for (uint32 z = 0; z < trg.m_depth; ++z)
+                {
+                    perturbSlice(z);
+                }
+            }
+            else
+            {
+                // each job pulls the next unprocessed slice
+                AZStd::atomic<uint32> nextSlice(0);
+                AZ::JobCompletion jobCompletion;
+                for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+                {
+                    AZ::Job* job = AZ::CreateJobFunction([&trg, &nextSlice, &perturbSlice]()
+                    {
+                        for (uint32 z = nextSlice.fetch_add(1); z < trg.m_depth; z = nextSlice.fetch_add(1))
+                        {
+                            perturbSlice(z);
+                        }
+                    }, true, jobContext);
+
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+
+                jobCompletion.StartAndWaitForCompletion();
             }
         }
 #endif
@@ -11,6 +11,7 @@
 */
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzFramework/StringFunc/StringFunc.h>
@@ -2238,8 +2239,11 @@ namespace EMotionFX
         IncreaseInputRefCounts(animGraphInstance);
         IncreaseInputRefDataRefCounts(animGraphInstance);
 
-        // perform the actual node update
-        Update(animGraphInstance, timePassedInSeconds);
+        // perform the actual node update, profiled per node so the cost of individual nodes shows up in the profiler
+        {
+            AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::Animation, "AnimGraphNode::Update (%s: %s)", GetPaletteName(), GetName());
+            Update(animGraphInstance, timePassedInSeconds);
+        }
 
         // mark as output
         animGraphInstance->EnableObjectFlags(mObjectIndex, AnimGraphInstance::OBJECTFLAGS_UPDATE_READY);
@@ -2256,7 +2260,10 @@ namespace EMotionFX
         }
 
         // perform the output
-        Output(animGraphInstance);
+        {
+            AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::Animation, "AnimGraphNode::Output (%s: %s)", GetPaletteName(), GetName());
+            Output(animGraphInstance);
+        }
 
         // now decrease ref counts of all input nodes as we do not need the poses of this input node anymore for this node
         // once the pose ref count of a node reaches zero it will automatically release the poses back to the pool so they can be reused again by others
@@ -66,6 +66,8 @@ namespace EMotionFX
         mCustomData             = nullptr;
         mID                     = MCore::GetIDGenerator().GenerateID();
         mCachedKeys             = nullptr;
+        mCachedPosKeys          = nullptr;
+        mCachedScaleKeys        = nullptr;
         mMotionGroup            = nullptr;
         mSubPool                = nullptr;
 
@@ -228,23 +230,22 @@ namespace EMotionFX
         // resize the number of motion links array to the number of nodes in the actor
         const uint32 numNodes = mActorInstance->GetActor()->GetNumNodes();
 
-        // init the cached keys
+        // init the cached keys, one block of numNodes entries for each of the rotation, position and scale tracks
         if (!mCachedKeys)
         {
-            mCachedKeys = (uint32*)MCore::Allocate(sizeof(uint32) * numNodes, EMFX_MEMCATEGORY_MOTIONS_MOTIONINSTANCES);
-            for (uint32 i = 0; i < numNodes; ++i)
-            {
-                mCachedKeys[i] = MCORE_INVALIDINDEX32;
-            }
+            mCachedKeys = (uint32*)MCore::Allocate(sizeof(uint32) * numNodes * 3, EMFX_MEMCATEGORY_MOTIONS_MOTIONINSTANCES);
         }
         else
         {
-            mCachedKeys = (uint32*)MCore::Realloc(mCachedKeys, sizeof(uint32) * numNodes, EMFX_MEMCATEGORY_MOTIONS_MOTIONINSTANCES);
-            for (uint32 i = 0; i < numNodes; ++i)
-            {
-                mCachedKeys[i] = MCORE_INVALIDINDEX32;
-            }
+            mCachedKeys = (uint32*)MCore::Realloc(mCachedKeys, sizeof(uint32) * numNodes * 3, EMFX_MEMCATEGORY_MOTIONS_MOTIONINSTANCES);
+        }
+
+        for (uint32 i = 0; i < numNodes * 3; ++i)
+        {
+            mCachedKeys[i] = MCORE_INVALIDINDEX32;
         }
+        mCachedPosKeys      = mCachedKeys + numNodes;
+        mCachedScaleKeys    = mCachedKeys + numNodes * 2;
 
         // create the motion links
         mMotionLinks.Resize(numNodes);
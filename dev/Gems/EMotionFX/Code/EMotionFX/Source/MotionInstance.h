@@ -774,6 +774,34 @@ namespace EMotionFX
          */
         MCORE_INLINE uint32 GetCachedKey(uint32 nodeIndex) const                { return mCachedKeys[nodeIndex]; }
 
+        /**
+         * Set the cached position key index for a given node.
+         * @param nodeIndex The node index we want to store the cached key for.
+         * @param keyIndex The cached key index value.
+         */
+        MCORE_INLINE void SetCachedPosKey(uint32 nodeIndex, uint32 keyIndex)    { mCachedPosKeys[nodeIndex] = keyIndex; }
+
+        /**
+         * Get the cached position key index for a given node.
+         * @param nodeIndex The node index to get the cached key value for.
+         * @result The cached position key value for the given node.
+         */
+        MCORE_INLINE uint32 GetCachedPosKey(uint32 nodeIndex) const             { return mCachedPosKeys[nodeIndex]; }
+
+        /**
+         * Set the cached scale key index for a given node.
+         * @param nodeIndex The node index we want to store the cached key for.
+         * @param keyIndex The cached key index value.
+         */
+        MCORE_INLINE void SetCachedScaleKey(uint32 nodeIndex, uint32 keyIndex)  { mCachedScaleKeys[nodeIndex] = keyIndex; }
+
+        /**
+         * Get the cached scale key index for a given node.
+         * @param nodeIndex The node index to get the cached key value for.
+         * @result The cached scale key value for the given node.
+         */
+        MCORE_INLINE uint32 GetCachedScaleKey(uint32 nodeIndex) const           { return mCachedScaleKeys[nodeIndex]; }
+
         /**
          * Reset the cache hit and misses counters.
          */
@@ -1006,7 +1034,9 @@ namespace EMotionFX
 
     private:
         MCore::Array<MotionLink>    mMotionLinks;   /**< The motion links, one for each node. */
-        uint32*             mCachedKeys;            /**< The cached rotation keyframe indices. */
+        uint32*             mCachedKeys;            /**< The cached rotation keyframe indices. This allocation also holds the position and scale caches. */
+        uint32*             mCachedPosKeys;         /**< The cached position keyframe indices, pointing into the mCachedKeys allocation. */
+        uint32*             mCachedScaleKeys;       /**< The cached scale keyframe indices, pointing into the mCachedKeys allocation. */
         float               mCurrentTime;           /**< The current playtime. */
         float               mClipStartTime;         /**< The start playback position of the motion, as well as the start of the loop point. */
         float               mClipEndTime;           /**< The end of the motion and loop point. When set to zero or below, the duration of the motion is used internally. */
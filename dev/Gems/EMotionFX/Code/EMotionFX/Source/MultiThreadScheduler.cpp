@@ -152,68 +152,84 @@ namespace EMotionFX
         mNumVisible.SetValue(0);
         mNumSampled.SetValue(0);
 
+        // Start a job for every root actor instance in the schedule. Each job starts the jobs of its attachments after
+        // updating, so the only ordering enforced is an attachment waiting on its parent, instead of every actor instance
+        // waiting on the whole previous schedule step.
+        AZ::JobCompletion jobCompletion;
         for (uint32 s = 0; s < numSteps; ++s)
         {
             const ScheduleStep& currentStep = mSteps[s];
-
-            // skip empty steps
             const uint32 numStepEntries = currentStep.mActorInstances.GetLength();
-            if (numStepEntries == 0)
-            {
-                continue;
-            }
-
-            // process the actor instances in the current step in parallel
-            AZ::JobCompletion jobCompletion;           
             for (uint32 c = 0; c < numStepEntries; ++c)
             {
                 ActorInstance* actorInstance = currentStep.mActorInstances[c];
-                if (actorInstance->GetIsEnabled() == false)
+                if (actorInstance->GetAttachedTo())
                 {
-                    continue;
+                    continue; // started by the job of the actor instance it is attached to
                 }
 
-                AZ::JobContext* jobContext = nullptr;
-                AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, actorInstance]()
+                StartActorInstanceUpdateJob(actorInstance, timePassedInSeconds, &jobCompletion);
+            }
+        }
+
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+
+    void MultiThreadScheduler::StartActorInstanceUpdateJob(ActorInstance* actorInstance, float timePassedInSeconds, AZ::JobCompletion* jobCompletion)
+    {
+        AZ::JobContext* jobContext = nullptr;
+        AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, actorInstance, jobCompletion]()
+        {
+            AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
+
+            if (actorInstance->GetIsEnabled())
+            {
+                const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();
+                actorInstance->SetThreadIndex(threadIndex);
+
+                const bool isVisible = actorInstance->GetIsVisible();
+                if (isVisible)
                 {
-                    AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
+                    mNumVisible.Increment();
+                }
 
-                    const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();                    
-                    actorInstance->SetThreadIndex(threadIndex);
+                // check if we want to sample motions
+                bool sampleMotions = false;
+                actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+                if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+                {
+                    sampleMotions = true;
+                    actorInstance->SetMotionSamplingTimer(0.0f);
 
-                    const bool isVisible = actorInstance->GetIsVisible();
                     if (isVisible)
                     {
-                        mNumVisible.Increment();
-                    }
-
-                    // check if we want to sample motions
-                    bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-                    if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
-                    {
-                        sampleMotions = true;
-                        actorInstance->SetMotionSamplingTimer(0.0f);
-
-                        if (isVisible)
-                        {
-                            mNumSampled.Increment();
-                        }
+                        mNumSampled.Increment();
                     }
+                }
 
-                    // update the actor instance
-                    actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
-                    GetWaveletCache().Shrink();
-                }, true, jobContext);
-
-                job->SetDependent(&jobCompletion);               
-                job->Start();
+                // update the actor instance
+                actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+                GetWaveletCache().Shrink();
 
                 mNumUpdated.Increment();
             }
 
-            jobCompletion.StartAndWaitForCompletion();
-        } // for all steps
+            // now that the actor instance is updated its attachments can be updated
+            // this job is still running, so the completion can't be reached before the attachment jobs are added to it
+            const uint32 numAttachments = actorInstance->GetNumAttachments();
+            for (uint32 i = 0; i < numAttachments; ++i)
+            {
+                ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+                if (attachment)
+                {
+                    StartActorInstanceUpdateJob(attachment, timePassedInSeconds, jobCompletion);
+                }
+            }
+        }, true, jobContext);
+
+        job->SetDependent(jobCompletion);
+        job->Start();
     }
 
 
@@ -18,6 +18,11 @@
 #include "Actor.h"
 #include <MCore/Source/MultiThreadManager.h>
 
+namespace AZ
+{
+    class JobCompletion;
+}
+
 namespace EMotionFX
 {
     // forward declarations
@@ -175,5 +180,15 @@ namespace EMotionFX
          * @param outStep The scheduler step to add the dependencies to.
          */
         void AddDependenciesToStep(ActorInstance* instance, ScheduleStep* outStep);
+
+        /**
+         * Start the update job of a given actor instance.
+         * Once the actor instance has been updated the job starts the update jobs of its attachments, so that attachments
+         * are always updated after the actor instance they are attached to, without waiting on any other actor instances.
+         * @param actorInstance The actor instance to update.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         * @param jobCompletion The completion that all update jobs of this frame are dependent on.
+         */
+        void StartActorInstanceUpdateJob(ActorInstance* actorInstance, float timePassedInSeconds, AZ::JobCompletion* jobCompletion);
     };
 }   // namespace EMotionFX
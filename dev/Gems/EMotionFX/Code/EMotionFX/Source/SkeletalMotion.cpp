@@ -386,7 +386,9 @@ namespace EMotionFX
                 auto* posTrack = subMotion->GetPosTrack();
                 if (posTrack)
                 {
-                    outTransform.mPosition = AZ::Vector3(posTrack->GetValueAtTime(timeValue));
+                    uint32 cachedKeyIndex = instance->GetCachedPosKey(nodeNumber);
+                    outTransform.mPosition = AZ::Vector3(posTrack->GetValueAtTime(timeValue, &cachedKeyIndex));
+                    instance->SetCachedPosKey(nodeNumber, cachedKeyIndex);
                 }
                 else
                 {
@@ -414,7 +416,9 @@ namespace EMotionFX
                 auto* scaleTrack = subMotion->GetScaleTrack();
                 if (scaleTrack)
                 {
-                    outTransform.mScale = AZ::Vector3(scaleTrack->GetValueAtTime(timeValue));
+                    uint32 cachedKeyIndex = instance->GetCachedScaleKey(nodeNumber);
+                    outTransform.mScale = AZ::Vector3(scaleTrack->GetValueAtTime(timeValue, &cachedKeyIndex));
+                    instance->SetCachedScaleKey(nodeNumber, cachedKeyIndex);
                 }
                 else
                 {
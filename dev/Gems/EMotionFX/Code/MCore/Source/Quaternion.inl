@@ -11,11 +11,14 @@
 */
 
 // multiply a vector by a quaternion
+// this is the expanded form of (q * p * q.Conjugated()), which avoids the two full quaternion products and
+// uses the SIMD vector math, as it is called for every joint when concatenating transforms
 MCORE_INLINE AZ::Vector3 Quaternion::operator * (const AZ::Vector3& p) const
 {
-    Quaternion v(p.GetX(), p.GetY(), p.GetZ(), 0.0f);
-    v = *this* v* this->Conjugated();
-    return AZ::Vector3(v.x, v.y, v.z);
+    const AZ::Vector3 u(x, y, z);
+    const float uDotU = u.Dot(u);
+    const float uDotP = u.Dot(p);
+    return p * (w * w - uDotU) + u * (2.0f * uDotP) + u.Cross(p) * (2.0f * w);
 }
 
 
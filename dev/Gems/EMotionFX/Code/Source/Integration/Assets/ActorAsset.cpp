@@ -344,7 +344,12 @@ namespace EMotionFX
             ActorAsset::MeshLOD* meshLOD = data->GetMeshLOD(useLodIndex);
             if (meshLOD)
             {
-                if (meshLOD->m_hasDynamicMeshes)
+                // Skinning happens in the vertex shader, only morph targets deform the mesh on the CPU. The morphed
+                // vertices are copied into this instance's render meshes below, so when none of the morph target
+                // weights changed those are still valid and the deformers don't need to run again (Render is
+                // called for every pass the actor is visible in, including shadow passes).
+                const bool morphsUpdated = MorphTargetWeightsWereUpdated(useLodIndex);
+                if (meshLOD->m_hasDynamicMeshes && morphsUpdated)
                 {
                     m_actorInstance->UpdateMorphMeshDeformers(0.0f);
                 }
@@ -364,7 +369,6 @@ namespace EMotionFX
                     pMaterial = gEnv->p3DEngine->GetMaterialManager()->GetDefaultMaterial();
                 }
 
-                const bool morphsUpdated = MorphTargetWeightsWereUpdated(useLodIndex);
                 const size_t numPrimitives = meshLOD->m_primitives.size();
                 for (size_t prim = 0; prim < numPrimitives; ++prim)
                 {
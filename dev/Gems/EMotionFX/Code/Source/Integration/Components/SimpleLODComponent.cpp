@@ -35,8 +35,10 @@ namespace EMotionFX
             if (serializeContext)
             {
                 serializeContext->Class<Configuration>()
-                    ->Version(1)
+                    ->Version(2)
                     ->Field("LODDistances", &Configuration::m_lodDistances)
+                    ->Field("EnableLODSampling", &Configuration::m_enableLodSampling)
+                    ->Field("LODSampleRates", &Configuration::m_lodSampleRates)
                     ;
             }
         }
@@ -110,7 +112,7 @@ namespace EMotionFX
 
         void SimpleLODComponent::OnTick(float deltaTime, AZ::ScriptTimePoint time)
         {
-            UpdateLODLevelByDistance(m_actorInstance, m_configuration.m_lodDistances, GetEntityId());
+            UpdateLODLevelByDistance(m_actorInstance, m_configuration, GetEntityId());
         }
 
         AZ::u32 SimpleLODComponent::GetLODByDistance(const AZStd::vector<float>& distances, float distance)
@@ -128,7 +130,7 @@ namespace EMotionFX
             return max - 1;
         }
 
-        void SimpleLODComponent::UpdateLODLevelByDistance(EMotionFX::ActorInstance * actorInstance, const AZStd::vector<float>& distances, AZ::EntityId entityId)
+        void SimpleLODComponent::UpdateLODLevelByDistance(EMotionFX::ActorInstance * actorInstance, const Configuration& configuration, AZ::EntityId entityId)
         {
             if (actorInstance)
             {
@@ -142,8 +144,17 @@ namespace EMotionFX
                     const CCamera& camera = gEnv->pSystem->GetViewCamera();
                     const AZ::Vector3& cameraPos = LYVec3ToAZVec3(camera.GetPosition());
                     const AZ::VectorFloat distance = cameraPos.GetDistance(worldPos);
-                    const AZ::u32 lodByDistance = GetLODByDistance(distances, distance);
+                    const AZ::u32 lodByDistance = GetLODByDistance(configuration.m_lodDistances, distance);
                     actorInstance->SetLODLevel(lodByDistance);
+
+                    // Distant actors don't need their motions sampled every frame. The scheduler skips sampling until
+                    // the sampling rate has passed, the anim graph and motion times still advance every frame.
+                    if (configuration.m_enableLodSampling)
+                    {
+                        const float sampleRate = lodByDistance < configuration.m_lodSampleRates.size() ? configuration.m_lodSampleRates[lodByDistance] : 0.0f;
+                        const float updateRateInSeconds = sampleRate > 0.0f ? 1.0f / sampleRate : 0.0f;
+                        actorInstance->SetMotionSamplingRate(updateRateInSeconds);
+                    }
                 }
             }
         }
@@ -47,6 +47,8 @@ namespace EMotionFX
                 Configuration();
 
                 AZStd::vector<float> m_lodDistances;         // Lod distances that decide which lod the actor should choose.
+                AZStd::vector<float> m_lodSampleRates;       // Motion sampling rate (in Hz) for each lod, 0 means sampling every frame.
+                bool m_enableLodSampling = false;            // Whether the motion sampling rate follows the lod.
 
                 static void Reflect(AZ::ReflectContext* context);
             };
@@ -85,7 +87,7 @@ namespace EMotionFX
             void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
 
             static AZ::u32 GetLODByDistance(const AZStd::vector<float>& distances, float distance);
-            static void UpdateLODLevelByDistance(EMotionFX::ActorInstance* actorInstance, const AZStd::vector<float>& distances, AZ::EntityId entityId);
+            static void UpdateLODLevelByDistance(EMotionFX::ActorInstance* actorInstance, const Configuration& configuration, AZ::EntityId entityId);
 
             Configuration                               m_configuration;        // Component configuration.
             EMotionFX::ActorInstance*                   m_actorInstance;        // Associated actor instance (retrieved from Actor Component).
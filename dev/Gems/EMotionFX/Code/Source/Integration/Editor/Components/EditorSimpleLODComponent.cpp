@@ -34,8 +34,10 @@ namespace EMotionFX
             if (serializeContext)
             {
                 serializeContext->Class<EditorSimpleLODComponent, AzToolsFramework::Components::EditorComponentBase>()
-                    ->Version(1)
+                    ->Version(2)
                     ->Field("LODDistances", &EditorSimpleLODComponent::m_lodDistances)
+                    ->Field("EnableLODSampling", &EditorSimpleLODComponent::m_enableLodSampling)
+                    ->Field("LODSampleRates", &EditorSimpleLODComponent::m_lodSampleRates)
                     ;
 
                 AZ::EditContext* editContext = serializeContext->GetEditContext();
@@ -54,7 +56,18 @@ namespace EMotionFX
                         ->Attribute(AZ::Edit::Attributes::ContainerCanBeModified, false)
                         ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
                         ->ElementAttribute(AZ::Edit::Attributes::Step, 0.01f)
-                        ->ElementAttribute(AZ::Edit::Attributes::Suffix, " m");
+                        ->ElementAttribute(AZ::Edit::Attributes::Suffix, " m")
+                        ->DataElement(0, &EditorSimpleLODComponent::m_enableLodSampling,
+                            "Enable LOD motion sampling", "Lower the motion sampling rate of the actor as its LOD level increases.")
+                        ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
+                        ->DataElement(0, &EditorSimpleLODComponent::m_lodSampleRates,
+                            "LOD motion sample rate", "The number of times per second the motions are sampled at this LOD. 0 samples every frame.")
+                        ->Attribute(AZ::Edit::Attributes::Visibility, &EditorSimpleLODComponent::m_enableLodSampling)
+                        ->Attribute(AZ::Edit::Attributes::ContainerCanBeModified, false)
+                        ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                        ->ElementAttribute(AZ::Edit::Attributes::Min, 0.0f)
+                        ->ElementAttribute(AZ::Edit::Attributes::Step, 1.0f)
+                        ->ElementAttribute(AZ::Edit::Attributes::Suffix, " Hz");
                 }
             }
 
@@ -85,6 +98,10 @@ namespace EMotionFX
                 {
                     GenerateDefaultDistances(numLODs);
                 }
+                if (numLODs != m_lodSampleRates.size())
+                {
+                    GenerateDefaultSampleRates(numLODs);
+                }
             }
             else
             {
@@ -111,6 +128,10 @@ namespace EMotionFX
                 {
                     GenerateDefaultDistances(numLODs);
                 }
+                if (numLODs != m_lodSampleRates.size())
+                {
+                    GenerateDefaultSampleRates(numLODs);
+                }
             }
         }
 
@@ -118,11 +139,12 @@ namespace EMotionFX
         {
             m_actorInstance = nullptr;
             m_lodDistances.clear();
+            m_lodSampleRates.clear();
         }
 
         void EditorSimpleLODComponent::OnTick(float deltaTime, AZ::ScriptTimePoint time)
         {
-            SimpleLODComponent::UpdateLODLevelByDistance(m_actorInstance, m_lodDistances, GetEntityId());
+            SimpleLODComponent::UpdateLODLevelByDistance(m_actorInstance, GetConfiguration(), GetEntityId());
         }
 
         void EditorSimpleLODComponent::GenerateDefaultDistances(AZ::u32 numLodLevels)
@@ -135,10 +157,28 @@ namespace EMotionFX
             }
         }
 
-        void EditorSimpleLODComponent::BuildGameEntity(AZ::Entity* gameEntity)
+        void EditorSimpleLODComponent::GenerateDefaultSampleRates(AZ::u32 numLodLevels)
+        {
+            // Sample every frame at LOD 0, then 30, 20, 15, 12... times per second
+            m_lodSampleRates.resize(numLodLevels);
+            for (AZ::u32 i = 0; i < numLodLevels; ++i)
+            {
+                m_lodSampleRates[i] = i == 0 ? 0.0f : 60.0f / (i + 1);
+            }
+        }
+
+        SimpleLODComponent::Configuration EditorSimpleLODComponent::GetConfiguration() const
         {
             SimpleLODComponent::Configuration cfg;
             cfg.m_lodDistances = m_lodDistances;
+            cfg.m_lodSampleRates = m_lodSampleRates;
+            cfg.m_enableLodSampling = m_enableLodSampling;
+            return cfg;
+        }
+
+        void EditorSimpleLODComponent::BuildGameEntity(AZ::Entity* gameEntity)
+        {
+            SimpleLODComponent::Configuration cfg = GetConfiguration();
 
             gameEntity->AddComponent(aznew SimpleLODComponent(&cfg));
         }
@@ -76,9 +76,13 @@ namespace EMotionFX
             void BuildGameEntity(AZ::Entity* gameEntity) override;
 
             void GenerateDefaultDistances(AZ::u32 numLodLevels);
+            void GenerateDefaultSampleRates(AZ::u32 numLodLevels);
+            SimpleLODComponent::Configuration GetConfiguration() const;
 
             EMotionFX::ActorInstance*                   m_actorInstance;        // Associated actor instance (retrieved from Actor Component).
             AZStd::vector<float>                        m_lodDistances;         // Lod distances that decide which lod the actor should choose.
+            AZStd::vector<float>                        m_lodSampleRates;       // Motion sampling rate (in Hz) for each lod, 0 means sampling every frame.
+            bool                                        m_enableLodSampling = false; // Whether the motion sampling rate follows the lod.
         };
     }
 }
\ No newline at end of file
@@ -306,6 +306,24 @@ TEST_F(EmotionFXMathLibTests, AZEMQuaternion_NormalizedQuaternionRotationTest3DA
 }
 
 
+// MCore::Quaternion vector rotation must match the full quaternion product, also for non unit quaternions
+TEST_F(EmotionFXMathLibTests, EMQuaternion_RotateVectorMatchesQuaternionProduct_Success)
+{
+    const AZ::Vector3 vertexIn(0.1f, -0.2f, 0.3f);
+    const MCore::Quaternion quaternions[] =
+    {
+        MCore::Quaternion(m_azNormalizedVector3_a, s_angle_a),
+        MCore::Quaternion(0.1f, 0.2f, 0.3f, 0.4f)
+    };
+
+    for (const MCore::Quaternion& quaternion : quaternions)
+    {
+        MCore::Quaternion product = quaternion * MCore::Quaternion(vertexIn.GetX(), vertexIn.GetY(), vertexIn.GetZ(), 0.0f) * quaternion.Conjugated();
+        const AZ::Vector3 vertexOut = quaternion * vertexIn;
+        ASSERT_TRUE(AZVector3CompareClose(vertexOut, product.x, product.y, product.z, s_toleranceLow));
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Euler  AZ
 ///////////////////////////////////////////////////////////////////////////////
@@ -320,6 +320,36 @@ namespace FastNoiseGem
         return 0.0f;
     }
 
+    void FastNoiseGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "Input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        // Default to passing positions straight through to match GetValue() when there's no transform handler
+        AZStd::vector<AZ::Vector3> uvws(positions);
+        AZStd::vector<bool> wasPointRejected(positions.size(), false);
+        const bool shouldNormalizeOutput = false;
+        GradientSignal::GradientTransformRequestBus::Event(
+            GetEntityId(), &GradientSignal::GradientTransformRequestBus::Events::TransformPositionsToUVW, positions, uvws, shouldNormalizeOutput, wasPointRejected);
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            if (wasPointRejected[index])
+            {
+                outValues[index] = 0.0f;
+            }
+            else
+            {
+                // Generator returns a range between [-1, 1], map that to [0, 1]
+                const AZ::Vector3& uvw = uvws[index];
+                outValues[index] = AZ::GetClamp((m_generator.GetNoise(uvw.GetX(), uvw.GetY(), uvw.GetZ()) + 1.0f) / 2.0f, 0.0f, 1.0f);
+            }
+        }
+    }
+
     template <typename TValueType, TValueType FastNoiseGradientConfig::*TConfigMember, void (FastNoise::*TMethod)(TValueType)>
     void FastNoiseGradientComponent::SetConfigValue(TValueType value)
     {
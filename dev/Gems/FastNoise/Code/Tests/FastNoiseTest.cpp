@@ -249,6 +249,34 @@ TEST_F(FastNoiseTestApp, FastNoise_ComponentEbus)
     ASSERT_TRUE(sample <= 1.0f);
 }
 
+TEST_F(FastNoiseTestApp, FastNoise_ComponentBatchedValuesMatchSingleValues)
+{
+    AZ::Entity* noiseEntity = aznew AZ::Entity("noise_entity");
+    ASSERT_TRUE(noiseEntity != nullptr);
+    noiseEntity->CreateComponent<FastNoiseGem::FastNoiseGradientComponent>();
+    noiseEntity->CreateComponent<MockGradientTransformComponent>();
+
+    noiseEntity->Init();
+    noiseEntity->Activate();
+
+    AZStd::vector<AZ::Vector3> positions;
+    for (int index = 0; index < 10; ++index)
+    {
+        positions.emplace_back(static_cast<float>(index) * 1.5f, static_cast<float>(index) * -0.5f, 0.0f);
+    }
+
+    AZStd::vector<float> batchedValues(positions.size(), -1.0f);
+    GradientSignal::GradientRequestBus::Event(noiseEntity->GetId(), &GradientSignal::GradientRequestBus::Events::GetValues, positions, batchedValues);
+
+    for (size_t index = 0; index < positions.size(); ++index)
+    {
+        GradientSignal::GradientSampleParams params(positions[index]);
+        float sample = -1.0f;
+        GradientSignal::GradientRequestBus::EventResult(sample, noiseEntity->GetId(), &GradientSignal::GradientRequestBus::Events::GetValue, params);
+        ASSERT_FLOAT_EQ(batchedValues[index], sample);
+    }
+}
+
 TEST_F(FastNoiseTestApp, FastNoise_ComponentMatchesConfiguration)
 {
     AZ::Entity* noiseEntity = aznew AZ::Entity("noise_entity");
@@ -14,6 +14,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace GradientSignal
 {
@@ -53,6 +54,29 @@ namespace GradientSignal
         */
         virtual float GetValue(const GradientSampleParams& sampleParams) const = 0;
 
+        /**
+        * Given a list of positions, generate a value for each one.  This has the same thread-safety requirements as GetValue().
+        * Gradients that can evaluate a whole set of positions more efficiently than one at a time (for example, by making a
+        * single request to their input gradients) should override this.  The default implementation calls GetValue() per point.
+        * @param positions The input list of positions to query.
+        * @param outValues The output list of values.  This list is expected to be the same size as the positions list.
+        */
+        virtual void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+        {
+            if (positions.size() != outValues.size())
+            {
+                AZ_Assert(false, "Input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+                return;
+            }
+
+            GradientSampleParams sampleParams;
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                sampleParams.m_position = positions[index];
+                outValues[index] = GetValue(sampleParams);
+            }
+        }
+
         /**
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
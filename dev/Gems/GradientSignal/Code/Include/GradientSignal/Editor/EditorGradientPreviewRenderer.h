@@ -13,7 +13,12 @@
 #pragma once
 
 // AZ
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
 
 // Qt
 #include <QImage>
@@ -27,6 +32,11 @@
 
 namespace GradientSignal
 {
+    /**
+     * Renders gradient previews on a job, coarse to fine, so deep gradient stacks don't stall the UI.
+     * Each refinement pass replaces the preview image once it's done, and queuing a new update cancels
+     * the render in progress.
+     */
     class EditorGradientPreviewRenderer
         : public QObject
     {
@@ -36,11 +46,26 @@ namespace GradientSignal
         EditorGradientPreviewRenderer()
             : QObject()
             , m_updateTimer(new QTimer(this))
+            , m_resultTimer(new QTimer(this))
         {
             // Defer updates by one tick to avoid sampling gradients before they're ready
             m_updateTimer->setSingleShot(true);
             m_updateTimer->setInterval(0);
             QObject::connect(m_updateTimer, &QTimer::timeout, this, [this]() { OnUpdate(); });
+
+            // Picks up the passes finished by the render job
+            m_resultTimer->setInterval(ResultPollIntervalMs);
+            QObject::connect(m_resultTimer, &QTimer::timeout, this, [this]() { OnRenderResult(); });
+        }
+
+        ~EditorGradientPreviewRenderer() override
+        {
+            // the render job uses this object until it's done, it stops at the next row once cancelled
+            ++m_renderGeneration;
+            while (m_activeRenderJobs > 0)
+            {
+                AZStd::this_thread::yield();
+            }
         }
 
         void SetGradientSampler(const GradientSampler& sampler)
@@ -68,47 +93,128 @@ namespace GradientSignal
          */
         virtual void OnUpdate() = 0;
 
+        /**
+         * Starts rendering the preview for the given resolution, cancelling any render in progress.
+         * m_previewImage keeps the previous preview until the first pass of the new one is done.
+         */
         void Render(const QSize& imageResolution)
         {
+            const AZ::u32 generation = ++m_renderGeneration;
+            {
+                // drop a pass of the cancelled render that wasn't picked up yet
+                AZStd::lock_guard<AZStd::mutex> lock(m_resultMutex);
+                m_renderedImage = QImage();
+                m_hasRenderedImage = false;
+            }
+
             if (m_previewImage.size() != imageResolution)
             {
                 m_previewImage = QImage(imageResolution, QImage::Format_Grayscale8);
+                m_previewImage.fill(QColor(0, 0, 0));
             }
 
-            m_previewImage.fill(QColor(0, 0, 0));
             if (!m_sampler.m_gradientId.IsValid())
             {
+                m_previewImage.fill(QColor(0, 0, 0));
                 return;
             }
 
+            RenderSettings settings;
+            settings.m_sampler = m_sampler;
+            settings.m_filterFunc = m_filterFunc;
+            settings.m_imageResolution = imageResolution;
+
             bool constrainToShape = false;
             GradientPreviewContextRequestBus::EventResult(constrainToShape, m_sampler.m_ownerEntityId, &GradientPreviewContextRequestBus::Events::GetConstrainToShape);
 
             AZ::Aabb previewBounds = AZ::Aabb::CreateNull();
             GradientPreviewContextRequestBus::EventResult(previewBounds, m_sampler.m_ownerEntityId, &GradientPreviewContextRequestBus::Events::GetPreviewBounds);
 
-            AZ::EntityId previewEntityId;
-            GradientPreviewContextRequestBus::EventResult(previewEntityId, m_sampler.m_ownerEntityId, &GradientPreviewContextRequestBus::Events::GetPreviewEntity);
+            GradientPreviewContextRequestBus::EventResult(settings.m_previewEntityId, m_sampler.m_ownerEntityId, &GradientPreviewContextRequestBus::Events::GetPreviewEntity);
 
-            constrainToShape = constrainToShape && previewEntityId.IsValid();
+            settings.m_constrainToShape = constrainToShape && settings.m_previewEntityId.IsValid();
 
             if (!previewBounds.IsValid())
             {
+                m_previewImage.fill(QColor(0, 0, 0));
                 return;
             }
 
             const AZ::Vector3 previewBoundsCenter = previewBounds.GetCenter();
             const AZ::Vector3 previewBoundsExtentsOld = previewBounds.GetExtents();
-            previewBounds = AZ::Aabb::CreateCenterRadius(previewBoundsCenter, AZ::GetMax(previewBoundsExtentsOld.GetX(), previewBoundsExtentsOld.GetY()) / 2.0f);
+            settings.m_previewBounds = AZ::Aabb::CreateCenterRadius(previewBoundsCenter, AZ::GetMax(previewBoundsExtentsOld.GetX(), previewBoundsExtentsOld.GetY()) / 2.0f);
+
+            ++m_activeRenderJobs;
+            AZ::Job* job = AZ::CreateJobFunction([this, settings, generation]()
+            {
+                RenderPasses(settings, generation);
+                --m_activeRenderJobs;
+            }, true);
+            job->Start();
+
+            m_resultTimer->start();
+        }
 
-            const AZ::Vector3 previewBoundsStart = AZ::Vector3(previewBounds.GetMin().GetX(), previewBounds.GetMin().GetY(), previewBoundsCenter.GetZ());
-            const AZ::Vector3 previewBoundsExtents = previewBounds.GetExtents();
+        GradientSampler m_sampler;
+        SampleFilterFunc m_filterFunc;
+        QImage m_previewImage;
+        QTimer* m_updateTimer;
+        bool m_dirty = true;
+
+    private:
+        static constexpr int ResultPollIntervalMs = 30;
+        //! Size in pixels of the blocks sampled by the first pass, each pass halves it until every pixel is sampled.
+        static constexpr int CoarsestBlockSize = 8;
+
+        struct RenderSettings
+        {
+            GradientSampler m_sampler;
+            SampleFilterFunc m_filterFunc;
+            QSize m_imageResolution;
+            AZ::Aabb m_previewBounds = AZ::Aabb::CreateNull();
+            AZ::EntityId m_previewEntityId;
+            bool m_constrainToShape = false;
+        };
+
+        void OnRenderResult()
+        {
+            bool hasResult = false;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_resultMutex);
+                if (m_hasRenderedImage)
+                {
+                    m_previewImage = m_renderedImage;
+                    m_renderedImage = QImage();
+                    m_hasRenderedImage = false;
+                    hasResult = true;
+                }
+            }
+
+            if (hasResult)
+            {
+                OnUpdate();
+            }
+            else if (m_activeRenderJobs == 0)
+            {
+                m_resultTimer->stop();
+            }
+        }
+
+        // Runs on a job
+        void RenderPasses(const RenderSettings& settings, AZ::u32 generation)
+        {
+            QImage image(settings.m_imageResolution, QImage::Format_Grayscale8);
+            image.fill(QColor(0, 0, 0));
+
+            const AZ::Vector3 previewBoundsCenter = settings.m_previewBounds.GetCenter();
+            const AZ::Vector3 previewBoundsStart = AZ::Vector3(settings.m_previewBounds.GetMin().GetX(), settings.m_previewBounds.GetMin().GetY(), previewBoundsCenter.GetZ());
+            const AZ::Vector3 previewBoundsExtents = settings.m_previewBounds.GetExtents();
             const float previewBoundsExtentsX = previewBoundsExtents.GetX();
             const float previewBoundsExtentsY = previewBoundsExtents.GetY();
 
             // Get the actual resolution of our preview image.  Note that this might be non-square, depending on how the window is sized.
-            const int imageResolutionX = imageResolution.width();
-            const int imageResolutionY = imageResolution.height();
+            const int imageResolutionX = settings.m_imageResolution.width();
+            const int imageResolutionY = settings.m_imageResolution.height();
 
             // Get the largest square size that fits into our window bounds.
             const int imageBoundsX = AZStd::min(imageResolutionX, imageResolutionY);
@@ -120,11 +226,11 @@ namespace GradientSignal
             const int centeringOffsetX = (imageResolutionX - imageBoundsX) / 2;
             const int centeringOffsetY = (imageResolutionY - imageBoundsY) / 2;
 
-            AZ::u8* buffer = static_cast<AZ::u8*>(m_previewImage.bits());
+            AZ::u8* buffer = static_cast<AZ::u8*>(image.bits());
 
             // This is the "striding value".  When walking directly through our preview image bits() buffer, there might be
             // extra pad bytes for each line due to alignment.  We use this to make sure we start writing each line at the right byte offset.
-            const int imageBytesPerLine = m_previewImage.bytesPerLine();
+            const int imageBytesPerLine = image.bytesPerLine();
 
             // When sampling the gradient, we can choose to either do it at the corners of each texel area we're sampling, or at the center.
             // They're both correct choices in different ways.  We're currently choosing to do the corners, which makes scaledTexelOffset = 0,
@@ -137,38 +243,90 @@ namespace GradientSignal
             const AZ::Vector3 pixelToBoundsScale(previewBoundsExtentsX / static_cast<float>(imageBoundsX), 
                                                  previewBoundsExtentsY / static_cast<float>(imageBoundsY), 0.0f);
 
-            for (int y = 0; y < imageBoundsY; ++y)
+            AZStd::vector<int> pixelsX;
+            AZStd::vector<AZ::Vector3> positions;
+            AZStd::vector<float> samples;
+
+            for (int blockSize = CoarsestBlockSize; blockSize >= 1; blockSize /= 2)
             {
-                for (int x = 0; x < imageBoundsX; ++x)
+                // pixels on the grid of the previous pass already have their value
+                const int previousBlockSize = (blockSize < CoarsestBlockSize) ? blockSize * 2 : 0;
+
+                for (int y = 0; y < imageBoundsY; y += blockSize)
                 {
-                    // Invert world y to match axis.  (We use "imageBoundsY- 1" to invert because our loop doesn't go all the way to imageBoundsY)
-                    AZ::Vector3 uvw(static_cast<float>(x), static_cast<float>((imageBoundsY - 1) - y), 0.0f);
+                    if (m_renderGeneration != generation)
+                    {
+                        return;
+                    }
 
-                    GradientSampleParams sampleParams;
-                    sampleParams.m_position = previewBoundsStart + (uvw * pixelToBoundsScale) + scaledTexelOffset;
+                    const bool isPreviousPassRow = previousBlockSize && (y % previousBlockSize) == 0;
 
-                    bool inBounds = true;
-                    if (constrainToShape)
+                    pixelsX.clear();
+                    positions.clear();
+                    for (int x = 0; x < imageBoundsX; x += blockSize)
                     {
-                        LmbrCentral::ShapeComponentRequestsBus::EventResult(inBounds, previewEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, sampleParams.m_position);
+                        if (isPreviousPassRow && (x % previousBlockSize) == 0)
+                        {
+                            continue;
+                        }
+
+                        // Invert world y to match axis.  (We use "imageBoundsY- 1" to invert because our loop doesn't go all the way to imageBoundsY)
+                        AZ::Vector3 uvw(static_cast<float>(x), static_cast<float>((imageBoundsY - 1) - y), 0.0f);
+                        pixelsX.push_back(x);
+                        positions.push_back(previewBoundsStart + (uvw * pixelToBoundsScale) + scaledTexelOffset);
                     }
 
-                    float sample = inBounds ? m_sampler.GetValue(sampleParams) : 0.0f;
+                    samples.resize(positions.size());
+                    settings.m_sampler.GetValues(positions, samples);
 
-                    if (m_filterFunc)
+                    const int blockEndY = AZStd::min(y + blockSize, imageBoundsY);
+                    for (size_t i = 0; i < positions.size(); ++i)
                     {
-                        sample = m_filterFunc(sample);
+                        float sample = samples[i];
+                        if (settings.m_constrainToShape)
+                        {
+                            bool inBounds = true;
+                            LmbrCentral::ShapeComponentRequestsBus::EventResult(inBounds, settings.m_previewEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, positions[i]);
+                            sample = inBounds ? sample : 0.0f;
+                        }
+
+                        if (settings.m_filterFunc)
+                        {
+                            sample = settings.m_filterFunc(sample);
+                        }
+
+                        // Coarse passes fill the whole block, finer passes overwrite the parts they sample
+                        const AZ::u8 value = static_cast<AZ::u8>(sample * 255);
+                        const int blockEndX = AZStd::min(pixelsX[i] + blockSize, imageBoundsX);
+                        for (int blockY = y; blockY < blockEndY; ++blockY)
+                        {
+                            AZ::u8* line = buffer + ((centeringOffsetY + blockY) * imageBytesPerLine) + centeringOffsetX;
+                            for (int blockX = pixelsX[i]; blockX < blockEndX; ++blockX)
+                            {
+                                line[blockX] = value;
+                            }
+                        }
                     }
+                }
 
-                    buffer[((centeringOffsetY + y) * imageBytesPerLine) + (centeringOffsetX + x)] = static_cast<AZ::u8>(sample * 255);
+                AZStd::lock_guard<AZStd::mutex> lock(m_resultMutex);
+                if (m_renderGeneration != generation)
+                {
+                    return;
                 }
+                // deep copy, the next pass keeps writing into image
+                m_renderedImage = image.copy();
+                m_hasRenderedImage = true;
             }
         }
 
-        GradientSampler m_sampler;
-        SampleFilterFunc m_filterFunc;
-        QImage m_previewImage;
-        QTimer* m_updateTimer;
-        bool m_dirty = true;
+        QTimer* m_resultTimer;
+
+        AZStd::atomic<AZ::u32> m_renderGeneration{ 0 };
+        AZStd::atomic_int m_activeRenderJobs{ 0 };
+
+        AZStd::mutex m_resultMutex;
+        QImage m_renderedImage;
+        bool m_hasRenderedImage = false;
     };
 } //namespace GradientSignal
@@ -37,6 +37,10 @@ namespace GradientSignal
 
         inline float GetValue(const GradientSampleParams& sampleParams) const;
 
+        //! Batched version of GetValue, outValues is expected to be the same size as positions.
+        //! The input gradient is queried with a single request for the whole list of positions.
+        inline void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const;
+
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const;
 
         AZ::EntityId m_gradientId;
@@ -138,4 +142,74 @@ namespace GradientSignal
 
         return output * m_opacity;
     }
+
+    inline void GradientSampler::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "Input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        // Handlers don't write anything if they aren't connected, so start from the same default that GetValue() returns
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+
+        if (m_opacity <= 0.0f || !m_gradientId.IsValid())
+        {
+            return;
+        }
+
+        AZ_ErrorOnce("GradientSignal", !m_isRequestInProgress, "Detected cyclic dependences with gradient entity references");
+
+        if (!m_isRequestInProgress)
+        {
+            m_isRequestInProgress = true;
+
+            auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
+            typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex); // block other threads from accessing the surface data bus while we are in GetValues (which may call into the SurfaceData bus)
+
+            //apply transform if set
+            if (m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(*this))
+            {
+                const AZ::Transform transform =
+                    AZ::Transform::CreateTranslation(m_translate) *
+                    AZ::ConvertEulerDegreesToTransform(m_rotate) *
+                    AZ::Transform::CreateScale(m_scale);
+
+                AZStd::vector<AZ::Vector3> transformedPositions;
+                transformedPositions.reserve(positions.size());
+                for (const AZ::Vector3& position : positions)
+                {
+                    transformedPositions.emplace_back(transform * position);
+                }
+
+                GradientRequestBus::Event(m_gradientId, &GradientRequestBus::Events::GetValues, transformedPositions, outValues);
+            }
+            else
+            {
+                GradientRequestBus::Event(m_gradientId, &GradientRequestBus::Events::GetValues, positions, outValues);
+            }
+
+            const bool applyLevels = m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this);
+            for (float& output : outValues)
+            {
+                if (m_invertInput)
+                {
+                    output = 1.0f - output;
+                }
+
+                //apply levels if set
+                if (applyLevels)
+                {
+                    output = GetLevels(output, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+                }
+
+                output *= m_opacity;
+            }
+
+            m_isRequestInProgress = false;
+        }
+    }
 }
\ No newline at end of file
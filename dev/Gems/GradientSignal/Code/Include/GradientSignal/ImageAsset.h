@@ -25,6 +25,17 @@ namespace GradientSignal
 {
     constexpr const char* s_gradientImageExtension = "gradimage";
 
+    //! Type of the single channel stored in ImageAsset::m_imageData.
+    enum class ImageAssetFormat : AZ::u32
+    {
+        R8 = 0,     //!< 8 bit unsigned normalized, what assets built before typed storage contain.
+        R16 = 1,    //!< 16 bit unsigned normalized, host byte order.
+        R32F = 2,   //!< 32 bit float, host byte order.
+    };
+
+    //! Returns the size of one pixel in bytes, 0 for unknown formats.
+    AZ::u32 GetImageAssetFormatPixelSize(AZ::u32 imageFormat);
+
     /**
       * An asset that represents image data used for sampling a gradient signal image
       */      
@@ -38,8 +49,8 @@ namespace GradientSignal
 
         AZ::u32 m_imageWidth = 0;
         AZ::u32 m_imageHeight = 0;
-        AZ::u32 m_imageFormat = 0;
-        AZStd::vector<AZ::u8> m_imageData;
+        AZ::u32 m_imageFormat = static_cast<AZ::u32>(ImageAssetFormat::R8);  //!< One of ImageAssetFormat.
+        AZStd::vector<AZ::u8> m_imageData;  //!< Rows of pixels in m_imageFormat, stored top row first.
     };
 
     class ImageAssetHandler
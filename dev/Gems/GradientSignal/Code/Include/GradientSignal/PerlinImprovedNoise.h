@@ -12,6 +12,8 @@
 #pragma once
 
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/Math/Vector3.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h>
 
@@ -36,6 +38,12 @@ namespace GradientSignal
         */
         float GenerateOctaveNoise(float x, float y, float z, int octaves, float persistence, float initialFrequency = 1.0f);
 
+        /**
+        * Batched version of GenerateOctaveNoise, outValues is expected to be the same size as positions.
+        * On platforms with SIMD support the positions are evaluated 4 at a time, with results that match the scalar version.
+        */
+        void GenerateOctaveNoise(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues, int octaves, float persistence, float initialFrequency = 1.0f);
+
         /**
         * Creates a Perlin noise factor value based on a position
         */
@@ -267,6 +267,56 @@ namespace GradientSignal
         return value > d ? 1.0f : 0.0f;
     }
 
+    void DitherGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "Input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        float pointsPerUnit = m_configuration.m_pointsPerUnit;
+        if (m_configuration.m_useSystemPointsPerUnit)
+        {
+            SectorDataRequestBus::Broadcast(&SectorDataRequestBus::Events::GetPointsPerMeter, pointsPerUnit);
+        }
+        pointsPerUnit = AZ::GetMax(pointsPerUnit, 0.0001f);
+
+        AZStd::vector<AZ::Vector3> flooredPositions;
+        flooredPositions.reserve(positions.size());
+        for (const AZ::Vector3& position : positions)
+        {
+            const AZ::Vector3 scaledCoordinate = position * pointsPerUnit;
+            flooredPositions.emplace_back(
+                std::floor(scaledCoordinate.GetX()) / pointsPerUnit,
+                std::floor(scaledCoordinate.GetY()) / pointsPerUnit,
+                std::floor(scaledCoordinate.GetZ()) / pointsPerUnit);
+        }
+
+        m_configuration.m_gradientSampler.GetValues(flooredPositions, outValues);
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            const AZ::Vector3 scaledCoordinate = positions[index] * pointsPerUnit;
+
+            float d = 0.0f;
+            switch (m_configuration.m_patternType)
+            {
+            default:
+            case DitherGradientConfig::BayerPatternType::PATTERN_SIZE_4x4:
+                d = GetDitherValue4x4((scaledCoordinate) + m_configuration.m_patternOffset);
+                break;
+            case DitherGradientConfig::BayerPatternType::PATTERN_SIZE_8x8:
+                d = GetDitherValue8x8((scaledCoordinate) + m_configuration.m_patternOffset);
+                break;
+            }
+
+            outValues[index] = outValues[index] > d ? 1.0f : 0.0f;
+        }
+    }
+
     bool DitherGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -334,7 +334,32 @@ namespace GradientSignal
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
         AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+        TransformPositionToUVWInternal(inPosition, outUVW, shouldNormalizeOutput, wasPointRejected);
+    }
+
+    void GradientTransformComponent::TransformPositionsToUVW(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<AZ::Vector3>& outUVWs, const bool shouldNormalizeOutput, AZStd::vector<bool>& wasPointRejected) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        if ((inPositions.size() != outUVWs.size()) || (inPositions.size() != wasPointRejected.size()))
+        {
+            AZ_Assert(false, "Input and output lists are different sizes (%zu vs %zu vs %zu).", inPositions.size(), outUVWs.size(), wasPointRejected.size());
+            return;
+        }
 
+        // Take the lock once for the whole batch instead of once per point
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        for (size_t index = 0; index < inPositions.size(); ++index)
+        {
+            bool rejected = false;
+            TransformPositionToUVWInternal(inPositions[index], outUVWs[index], shouldNormalizeOutput, rejected);
+            wasPointRejected[index] = rejected;
+        }
+    }
+
+    void GradientTransformComponent::TransformPositionToUVWInternal(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, const bool shouldNormalizeOutput, bool& wasPointRejected) const
+    {
         //transforming coordinate into "local" relative space of shape bounds
         outUVW = m_shapeTransformInverse * inPosition;
 
@@ -19,6 +19,50 @@
 
 namespace GradientSignal
 {
+    namespace
+    {
+        // Combines the current layer value with the accumulated result, note that Initialize resets the accumulated result
+        float GetMixedValue(MixedGradientLayer::MixingOperation operation, float& result, float currentUnpremultiplied)
+        {
+            float operationResult = 0.0f;
+
+            switch (operation)
+            {
+            default:
+            case MixedGradientLayer::MixingOperation::Initialize:
+                //reset the result of the mixed/combined layers to the current value
+                result = 0.0f;
+                operationResult = currentUnpremultiplied;
+                break;
+            case MixedGradientLayer::MixingOperation::Multiply:
+                operationResult = result * currentUnpremultiplied;
+                break;
+            case MixedGradientLayer::MixingOperation::Add:
+                operationResult = result + currentUnpremultiplied;
+                break;
+            case MixedGradientLayer::MixingOperation::Subtract:
+                operationResult = result - currentUnpremultiplied;
+                break;
+            case MixedGradientLayer::MixingOperation::Min:
+                operationResult = AZStd::min(currentUnpremultiplied, result);
+                break;
+            case MixedGradientLayer::MixingOperation::Max:
+                operationResult = AZStd::max(currentUnpremultiplied, result);
+                break;
+            case MixedGradientLayer::MixingOperation::Average:
+                operationResult = (result + currentUnpremultiplied) / 2.0f;
+                break;
+            case MixedGradientLayer::MixingOperation::Normal:
+                operationResult = currentUnpremultiplied;
+                break;
+            case MixedGradientLayer::MixingOperation::Overlay:
+                operationResult = (result >= 0.5f) ? (1.0f - (2.0f * (1.0f - result) * (1.0f - currentUnpremultiplied))) : (2.0f * result * currentUnpremultiplied);
+                break;
+            }
+            return operationResult;
+        }
+    }
+
     void MixedGradientLayer::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context);
@@ -280,39 +324,7 @@ namespace GradientSignal
                 float current = layer.m_gradientSampler.GetValue(sampleParams);
                 // unpremultiplied alpha (we clamp the end result)
                 float currentUnpremultiplied = current / layer.m_gradientSampler.m_opacity;
-                switch (layer.m_operation)
-                {
-                default:
-                case MixedGradientLayer::MixingOperation::Initialize:
-                    //reset the result of the mixed/combined layers to the current value
-                    result = 0.0f;
-                    operationResult = currentUnpremultiplied;
-                    break;
-                case MixedGradientLayer::MixingOperation::Multiply:
-                    operationResult = result * currentUnpremultiplied;
-                    break;
-                case MixedGradientLayer::MixingOperation::Add:
-                    operationResult = result + currentUnpremultiplied;
-                    break;
-                case MixedGradientLayer::MixingOperation::Subtract:
-                    operationResult = result - currentUnpremultiplied;
-                    break;
-                case MixedGradientLayer::MixingOperation::Min:
-                    operationResult = AZStd::min(currentUnpremultiplied, result);
-                    break;
-                case MixedGradientLayer::MixingOperation::Max:
-                    operationResult = AZStd::max(currentUnpremultiplied, result);
-                    break;
-                case MixedGradientLayer::MixingOperation::Average:
-                    operationResult = (result + currentUnpremultiplied) / 2.0f;
-                    break;
-                case MixedGradientLayer::MixingOperation::Normal:
-                    operationResult = currentUnpremultiplied;
-                    break;
-                case MixedGradientLayer::MixingOperation::Overlay:
-                    operationResult = (result >= 0.5f) ? (1.0f - (2.0f * (1.0f - result) * (1.0f - currentUnpremultiplied))) : (2.0f * result * currentUnpremultiplied);
-                    break;
-                }
+                operationResult = GetMixedValue(layer.m_operation, result, currentUnpremultiplied);
                 // blend layers (re-applying opacity, which is why we needed to use unpremultiplied)
                 result = (result * (1.0f - layer.m_gradientSampler.m_opacity)) + (operationResult * layer.m_gradientSampler.m_opacity);
             }
@@ -321,6 +333,46 @@ namespace GradientSignal
         return AZ::GetClamp(result, 0.0f, 1.0f);
     }
 
+    void MixedGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "Input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        //accumulate the mixed/combined result of all layers and operations, one whole batch of positions per layer
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+        AZStd::vector<float> layerValues(positions.size());
+
+        for (const auto& layer : m_configuration.m_layers)
+        {
+            // added check to prevent opacity of 0.0, which will bust when we unpremultiply the alpha out
+            if (layer.m_enabled && layer.m_gradientSampler.m_opacity != 0.0f)
+            {
+                // this includes leveling and opacity result, we need unpremultiplied opacity to combine properly
+                layer.m_gradientSampler.GetValues(positions, layerValues);
+
+                for (size_t index = 0; index < positions.size(); ++index)
+                {
+                    float& result = outValues[index];
+                    // unpremultiplied alpha (we clamp the end result)
+                    const float currentUnpremultiplied = layerValues[index] / layer.m_gradientSampler.m_opacity;
+                    const float operationResult = GetMixedValue(layer.m_operation, result, currentUnpremultiplied);
+                    // blend layers (re-applying opacity, which is why we needed to use unpremultiplied)
+                    result = (result * (1.0f - layer.m_gradientSampler.m_opacity)) + (operationResult * layer.m_gradientSampler.m_opacity);
+                }
+            }
+        }
+
+        for (float& outValue : outValues)
+        {
+            outValue = AZ::GetClamp(outValue, 0.0f, 1.0f);
+        }
+    }
+
     bool MixedGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         for (const auto& layer : m_configuration.m_layers)
@@ -199,6 +199,41 @@ namespace GradientSignal
         return 0.0f;
     }
 
+    void PerlinGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "Input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        if (!m_perlinImprovedNoise)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+        }
+        else
+        {
+            // Default to passing positions straight through to match GetValue() when there's no transform handler
+            AZStd::vector<AZ::Vector3> uvws(positions);
+            AZStd::vector<bool> wasPointRejected(positions.size(), false);
+            const bool shouldNormalizeOutput = false;
+            GradientTransformRequestBus::Event(
+                GetEntityId(), &GradientTransformRequestBus::Events::TransformPositionsToUVW, positions, uvws, shouldNormalizeOutput, wasPointRejected);
+
+            m_perlinImprovedNoise->GenerateOctaveNoise(uvws, outValues, m_configuration.m_octave, m_configuration.m_amplitude, m_configuration.m_frequency);
+
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                if (wasPointRejected[index])
+                {
+                    outValues[index] = 0.0f;
+                }
+            }
+        }
+    }
+
     int PerlinGradientComponent::GetRandomSeed() const
     {
         return m_configuration.m_randomSeed;
@@ -19,6 +19,40 @@
 
 namespace GradientSignal
 {
+    namespace
+    {
+        float PosterizeValue(float input, float bands, PosterizeGradientConfig::ModeType mode)
+        {
+            float output = 0.0f;
+
+            // "quantize" the input down to a number that goes from 0 to (bands-1)
+            const float band = AZ::GetClamp(floorf(input * bands), 0.0f, bands - 1.0f);
+
+            // Given our quantized band, produce the right output for that band range.
+            switch (mode)
+            {
+                default:
+                case PosterizeGradientConfig::ModeType::Floor:
+                    // Floor:  the output range should be the lowest value of each band, or (0 to bands-1) / bands
+                    output = (band + 0.0f) / bands;
+                    break;
+                case PosterizeGradientConfig::ModeType::Round:
+                    // Round:  the output range should be the midpoint of each band, or (0.5 to bands-0.5) / bands
+                    output = (band + 0.5f) / bands;
+                    break;
+                case PosterizeGradientConfig::ModeType::Ceiling:
+                    // Ceiling:  the output range should be the highest value of each band, or (1 to bands) / bands
+                    output = (band + 1.0f) / bands;
+                    break;
+                case PosterizeGradientConfig::ModeType::Ps:
+                    // Ps:  the output range should be equally distributed from 0-1, or (0 to bands-1) / (bands-1)
+                    output = band / (bands - 1.0f);
+                    break;
+            }
+            return AZ::GetClamp(output, 0.0f, 1.0f);
+        }
+    }
+
     void PosterizeGradientConfig::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context);
@@ -159,33 +193,25 @@ namespace GradientSignal
     {
         const float bands = AZ::GetMax(static_cast<float>(m_configuration.m_bands), 2.0f);
         const float input = AZ::GetClamp(m_configuration.m_gradientSampler.GetValue(sampleParams), 0.0f, 1.0f);
-        float output = 0.0f;
 
-        // "quantize" the input down to a number that goes from 0 to (bands-1)
-        const float band = AZ::GetClamp(floorf(input * bands), 0.0f, bands - 1.0f);
+        return PosterizeValue(input, bands, m_configuration.m_mode);
+    }
+
+    void PosterizeGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "Input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        m_configuration.m_gradientSampler.GetValues(positions, outValues);
 
-        // Given our quantized band, produce the right output for that band range.
-        switch (m_configuration.m_mode)
+        const float bands = AZ::GetMax(static_cast<float>(m_configuration.m_bands), 2.0f);
+        for (float& outValue : outValues)
         {
-            default:
-            case PosterizeGradientConfig::ModeType::Floor:
-                // Floor:  the output range should be the lowest value of each band, or (0 to bands-1) / bands
-                output = (band + 0.0f) / bands;
-                break;
-            case PosterizeGradientConfig::ModeType::Round:
-                // Round:  the output range should be the midpoint of each band, or (0.5 to bands-0.5) / bands
-                output = (band + 0.5f) / bands;
-                break;
-            case PosterizeGradientConfig::ModeType::Ceiling:
-                // Ceiling:  the output range should be the highest value of each band, or (1 to bands) / bands
-                output = (band + 1.0f) / bands;
-                break;
-            case PosterizeGradientConfig::ModeType::Ps:
-                // Ps:  the output range should be equally distributed from 0-1, or (0 to bands-1) / (bands-1)
-                output = band / (bands - 1.0f);
-                break;
+            outValue = PosterizeValue(AZ::GetClamp(outValue, 0.0f, 1.0f), bands, m_configuration.m_mode);
         }
-        return AZ::GetClamp(output, 0.0f, 1.0f);
     }
 
     bool PosterizeGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
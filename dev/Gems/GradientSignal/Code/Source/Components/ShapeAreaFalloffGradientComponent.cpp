@@ -181,6 +181,37 @@ namespace GradientSignal
         return GetRatio(m_configuration.m_falloffWidth, 0.0f, distance);
     }
 
+    void ShapeAreaFalloffGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "Input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        // Look up the shape handler once and query it directly for every point, rather than dispatching through the bus per point.
+        bool shapeConnected = false;
+        LmbrCentral::ShapeComponentRequestsBus::EventResult(shapeConnected, m_configuration.m_shapeEntityId, [&](LmbrCentral::ShapeComponentRequests* shapeRequests)
+        {
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                const float distance = shapeRequests->DistanceFromPoint(positions[index]);
+
+                // Same rules as GetValue(): a falloff of 0 is a hard edge at the shape boundary, otherwise ramp from 1 to 0 across the falloff.
+                outValues[index] = (m_configuration.m_falloffWidth == 0.0f) ? ((distance > 0.0f) ? 0.0f : 1.0f) : GetRatio(m_configuration.m_falloffWidth, 0.0f, distance);
+            }
+            return true;
+        });
+
+        if (!shapeConnected)
+        {
+            // With no shape, every point is treated as 0 distance to match GetValue()
+            AZStd::fill(outValues.begin(), outValues.end(), 1.0f);
+        }
+    }
+
     AZ::EntityId ShapeAreaFalloffGradientComponent::GetShapeEntityId() const
     {
         return m_configuration.m_shapeEntityId;
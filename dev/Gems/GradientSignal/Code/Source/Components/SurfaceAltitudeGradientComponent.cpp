@@ -224,6 +224,29 @@ namespace GradientSignal
         return GetRatio(m_configuration.m_altitudeMin, m_configuration.m_altitudeMax, position.GetZ());
     }
 
+    void SurfaceAltitudeGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "Input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        // Reuse a single point list across the batch to avoid reallocating it for every position
+        SurfaceData::SurfacePointList points;
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            points.clear();
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePoints,
+                positions[index], m_configuration.m_surfaceTagsToSample, points);
+
+            outValues[index] = points.empty() ? 0.0f :
+                GetRatio(m_configuration.m_altitudeMin, m_configuration.m_altitudeMax, points.front().m_position.GetZ());
+        }
+    }
+
     void SurfaceAltitudeGradientComponent::OnCompositionChanged()
     {
         m_dirty = true;
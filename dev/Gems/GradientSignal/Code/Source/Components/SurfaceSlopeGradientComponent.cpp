@@ -210,21 +210,12 @@ namespace GradientSignal
         return false;
     }
 
-    float SurfaceSlopeGradientComponent::GetValue(const GradientSampleParams& sampleParams) const
+    float SurfaceSlopeGradientComponent::GetSlopeRatio(const AZ::Vector3& normal) const
     {
-        SurfaceData::SurfacePointList points;
-        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePoints,
-            sampleParams.m_position, m_configuration.m_surfaceTagsToSample, points);
-
-        if (points.empty())
-        {
-            return 0.0f;
-        }
-
         // Assuming our surface normal vector is actually normalized, we can get the slope
         // by just grabbing the Z value.  It's the same thing as normal.Dot(AZ::Vector3::CreateAxisZ()).
-        AZ_Assert(points.front().m_normal.GetNormalized().IsClose(points.front().m_normal), "Surface normals are expected to be normalized");
-        const float slope = points.front().m_normal.GetZ();
+        AZ_Assert(normal.GetNormalized().IsClose(normal), "Surface normals are expected to be normalized");
+        const float slope = normal.GetZ();
         // Convert slope back to an angle so that we can lerp in "angular space", not "slope value space".
         // (We want our 0-1 range to be linear across the range of angles)
         const float slopeAngle = acosf(slope);
@@ -246,6 +237,40 @@ namespace GradientSignal
         }
     }
 
+    float SurfaceSlopeGradientComponent::GetValue(const GradientSampleParams& sampleParams) const
+    {
+        SurfaceData::SurfacePointList points;
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePoints,
+            sampleParams.m_position, m_configuration.m_surfaceTagsToSample, points);
+
+        if (points.empty())
+        {
+            return 0.0f;
+        }
+
+        return GetSlopeRatio(points.front().m_normal);
+    }
+
+    void SurfaceSlopeGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "Input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        // Reuse a single point list across the batch to avoid reallocating it for every position
+        SurfaceData::SurfacePointList points;
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            points.clear();
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePoints,
+                positions[index], m_configuration.m_surfaceTagsToSample, points);
+
+            outValues[index] = points.empty() ? 0.0f : GetSlopeRatio(points.front().m_normal);
+        }
+    }
+
     float SurfaceSlopeGradientComponent::GetSlopeMin() const
     {
         return m_configuration.m_slopeMin;
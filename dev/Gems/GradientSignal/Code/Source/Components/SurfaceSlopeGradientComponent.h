@@ -95,6 +95,7 @@ namespace GradientSignal
         //////////////////////////////////////////////////////////////////////////
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
+        void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -125,6 +126,9 @@ namespace GradientSignal
         void SetFallOffMidpoint(float midpoint) override;
 
     private:
+        //! Converts a surface normal into the configured 0-1 slope ramp value
+        float GetSlopeRatio(const AZ::Vector3& normal) const;
+
         SurfaceSlopeGradientConfig m_configuration;
     };
 }
\ No newline at end of file
@@ -50,6 +50,7 @@ namespace GradientSignal
         // Since we want to register our builder, we do that here:
         AssetBuilderSDK::AssetBuilderDesc builderDescriptor;
         builderDescriptor.m_name = "Gradient Image Builder";
+        builderDescriptor.m_version = 1; // binary products, 16 bit sources keep their precision
 
         builderDescriptor.m_patterns.push_back(AssetBuilderSDK::AssetBuilderPattern("*.tif", AssetBuilderSDK::AssetBuilderPattern::PatternType::Wildcard));
         builderDescriptor.m_patterns.push_back(AssetBuilderSDK::AssetBuilderPattern("*.tiff", AssetBuilderSDK::AssetBuilderPattern::PatternType::Wildcard));
@@ -201,9 +202,12 @@ namespace GradientSignal
             return;
         }
 
+        // 16 bit sources (typically heightmaps or splat maps exported from terrain tools) keep their precision,
+        // everything else is stored as 8 bit
+        const bool isHighPrecision = qimage.depth() > 32;
+
         //convert to compatible pixel format
-        QImage::Format format = qimage.format();
-        if (qimage.format() != QImage::Format_Grayscale8)
+        if (!isHighPrecision && qimage.format() != QImage::Format_Grayscale8)
         {
             qimage = qimage.convertToFormat(QImage::Format_Grayscale8);
         }
@@ -224,22 +228,34 @@ namespace GradientSignal
 
         //create a new image asset
         ImageAsset imageAsset;
-        imageAsset.m_imageFormat = 0;
+        imageAsset.m_imageFormat = static_cast<AZ::u32>(isHighPrecision ? ImageAssetFormat::R16 : ImageAssetFormat::R8);
         imageAsset.m_imageWidth = qimage.width();
         imageAsset.m_imageHeight = qimage.height();
-        imageAsset.m_imageData = AZStd::vector<AZ::u8>(imageAsset.m_imageWidth * imageAsset.m_imageHeight, 0);
+        imageAsset.m_imageData = AZStd::vector<AZ::u8>(imageAsset.m_imageWidth * imageAsset.m_imageHeight * GetImageAssetFormatPixelSize(imageAsset.m_imageFormat), 0);
 
         //copy image data
-        for (AZ::u32 y = 0; y < imageAsset.m_imageHeight; ++y)
+        if (isHighPrecision)
+        {
+            AZ::u16* imageData = reinterpret_cast<AZ::u16*>(imageAsset.m_imageData.data());
+            for (AZ::u32 y = 0; y < imageAsset.m_imageHeight; ++y)
+            {
+                for (AZ::u32 x = 0; x < imageAsset.m_imageWidth; ++x)
+                {
+                    imageData[y * imageAsset.m_imageWidth + x] = qimage.pixelColor(x, y).rgba64().red();
+                }
+            }
+        }
+        else
         {
-            for (AZ::u32 x = 0; x < imageAsset.m_imageWidth; ++x)
+            for (AZ::u32 y = 0; y < imageAsset.m_imageHeight; ++y)
             {
-                imageAsset.m_imageData[y * imageAsset.m_imageWidth + x] = qimage.pixelColor(x, y).red();
+                const uchar* line = qimage.constScanLine(y);
+                memcpy(&imageAsset.m_imageData[y * imageAsset.m_imageWidth], line, imageAsset.m_imageWidth);
             }
         }
 
-        //save asset
-        if (!AZ::Utils::SaveObjectToFile(outputPath, AZ::DataStream::ST_XML, &imageAsset))
+        //save asset, binary since the data is one element per byte and would be very large as xml
+        if (!AZ::Utils::SaveObjectToFile(outputPath, AZ::DataStream::ST_BINARY, &imageAsset))
         {
             AZ_TracePrintf(AssetBuilderSDK::ErrorWindow, "Failed gradient image conversion job for %s.\nFailed saving output file %s.\n", request.m_fullPath.data(), outputPath.data());
             response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
@@ -15,6 +15,7 @@
 
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/Debug/Profiler.h>
@@ -50,6 +51,21 @@ namespace GradientSignal
         }
     }
 
+    AZ::u32 GetImageAssetFormatPixelSize(AZ::u32 imageFormat)
+    {
+        switch (static_cast<ImageAssetFormat>(imageFormat))
+        {
+        case ImageAssetFormat::R8:
+            return sizeof(AZ::u8);
+        case ImageAssetFormat::R16:
+            return sizeof(AZ::u16);
+        case ImageAssetFormat::R32F:
+            return sizeof(float);
+        default:
+            return 0;
+        }
+    }
+
     float GetValueFromImageAsset(const AZ::Data::Asset<ImageAsset>& imageAsset, const AZ::Vector3& uvw, float tilingX, float tilingY, float defaultValue)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
@@ -57,9 +73,11 @@ namespace GradientSignal
         if (imageAsset.IsReady())
         {
             const auto& image = imageAsset.Get();
+            const AZ::u32 pixelSize = GetImageAssetFormatPixelSize(image->m_imageFormat);
             if (image->m_imageWidth > 0 &&
                 image->m_imageHeight > 0 &&
-                image->m_imageData.size() == image->m_imageWidth * image->m_imageHeight)
+                pixelSize > 0 &&
+                image->m_imageData.size() == image->m_imageWidth * image->m_imageHeight * pixelSize)
             {
                 // When "rasterizing" from uvs, a range of 0-1 has slightly different meanings depending on the sampler state.
                 // For repeating states (Unbounded/None, Repeat), a uv value of 1 should wrap around back to our 0th pixel.
@@ -98,7 +116,15 @@ namespace GradientSignal
                 // Flip the y because images are stored in reverse of our world axes
                 size_t index = ((image->m_imageHeight - 1) - y) * image->m_imageWidth + x;
 
-                return image->m_imageData[index] / 255.0f;
+                switch (static_cast<ImageAssetFormat>(image->m_imageFormat))
+                {
+                case ImageAssetFormat::R16:
+                    return reinterpret_cast<const AZ::u16*>(image->m_imageData.data())[index] / 65535.0f;
+                case ImageAssetFormat::R32F:
+                    return AZ::GetClamp(reinterpret_cast<const float*>(image->m_imageData.data())[index], 0.0f, 1.0f);
+                default:
+                    return image->m_imageData[index] / 255.0f;
+                }
             }
         }
         return defaultValue;
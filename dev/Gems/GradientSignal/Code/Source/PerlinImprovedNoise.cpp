@@ -13,6 +13,11 @@
 #include "GradientSignal_precompiled.h"
 
 #include <GradientSignal/PerlinImprovedNoise.h>
+#include <AzCore/Math/Internal/MathTypes.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD
+#include <emmintrin.h>
+#endif
 
 #include <numeric>
 #include <random> // std::mt19937 std::random_device
@@ -65,6 +70,113 @@ namespace GradientSignal
         {
             return a + x * (b - a);
         }
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD
+        // 4-wide versions of the helpers above.  These perform the same operations in the same order as the scalar
+        // versions so that the batched noise matches GenerateNoise() exactly.
+
+        AZ_FORCE_INLINE __m128 FadeSimd(__m128 t)
+        {
+            const __m128 t3 = _mm_mul_ps(_mm_mul_ps(t, t), t);
+            const __m128 inner = _mm_add_ps(_mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f))), _mm_set1_ps(10.0f));
+            return _mm_mul_ps(t3, inner);
+        }
+
+        AZ_FORCE_INLINE __m128 LerpSimd(__m128 a, __m128 b, __m128 x)
+        {
+            return _mm_add_ps(a, _mm_mul_ps(x, _mm_sub_ps(b, a)));
+        }
+
+        AZ_FORCE_INLINE __m128 SelectSimd(__m128i mask, __m128 ifTrue, __m128 ifFalse)
+        {
+            const __m128 maskf = _mm_castsi128_ps(mask);
+            return _mm_or_ps(_mm_and_ps(maskf, ifTrue), _mm_andnot_ps(maskf, ifFalse));
+        }
+
+        // Branchless form of Gradient(): the low 4 bits of the hash pick two of the three components and their signs
+        AZ_FORCE_INLINE __m128 GradientSimd(__m128i hash, __m128 x, __m128 y, __m128 z)
+        {
+            const __m128i h = _mm_and_si128(hash, _mm_set1_epi32(0xF));
+            const __m128 u = SelectSimd(_mm_cmplt_epi32(h, _mm_set1_epi32(8)), x, y);
+            const __m128i useX = _mm_or_si128(_mm_cmpeq_epi32(h, _mm_set1_epi32(12)), _mm_cmpeq_epi32(h, _mm_set1_epi32(14)));
+            const __m128 v = SelectSimd(_mm_cmplt_epi32(h, _mm_set1_epi32(4)), y, SelectSimd(useX, x, z));
+            const __m128 uSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(1)), 31));
+            const __m128 vSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(2)), 30));
+            return _mm_add_ps(_mm_xor_ps(u, uSign), _mm_xor_ps(v, vSign));
+        }
+
+        // SSE2 has no floor instruction, so truncate and step down for negative non-integral values
+        AZ_FORCE_INLINE __m128i FloorToIntSimd(__m128 value)
+        {
+            const __m128i truncated = _mm_cvttps_epi32(value);
+            const __m128 needsAdjust = _mm_cmpgt_ps(_mm_cvtepi32_ps(truncated), value);
+            return _mm_add_epi32(truncated, _mm_castps_si128(needsAdjust)); // mask is -1 where we need to step down
+        }
+
+        AZ_FORCE_INLINE __m128 GenerateNoiseSimd(const AZStd::array<int, 512>& p, __m128 x, __m128 y, __m128 z)
+        {
+            const __m128i fx = FloorToIntSimd(x);
+            const __m128i fy = FloorToIntSimd(y);
+            const __m128i fz = FloorToIntSimd(z);
+            const __m128 xf = _mm_sub_ps(x, _mm_cvtepi32_ps(fx));
+            const __m128 yf = _mm_sub_ps(y, _mm_cvtepi32_ps(fy));
+            const __m128 zf = _mm_sub_ps(z, _mm_cvtepi32_ps(fz));
+            const __m128i mask255 = _mm_set1_epi32(255);
+
+            AZ_ALIGN(int xi0[4], 16);
+            AZ_ALIGN(int yi0[4], 16);
+            AZ_ALIGN(int zi0[4], 16);
+            _mm_store_si128(reinterpret_cast<__m128i*>(xi0), _mm_and_si128(fx, mask255));
+            _mm_store_si128(reinterpret_cast<__m128i*>(yi0), _mm_and_si128(fy, mask255));
+            _mm_store_si128(reinterpret_cast<__m128i*>(zi0), _mm_and_si128(fz, mask255));
+
+            // The permutation table lookups are a gather, which SSE doesn't have, so do those per lane
+            AZ_ALIGN(int aaa[4], 16);
+            AZ_ALIGN(int aba[4], 16);
+            AZ_ALIGN(int aab[4], 16);
+            AZ_ALIGN(int abb[4], 16);
+            AZ_ALIGN(int baa[4], 16);
+            AZ_ALIGN(int bba[4], 16);
+            AZ_ALIGN(int bab[4], 16);
+            AZ_ALIGN(int bbb[4], 16);
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                const int x0 = xi0[lane];
+                const int y0 = yi0[lane];
+                const int z0 = zi0[lane];
+                const int x1 = x0 + 1;
+                const int y1 = y0 + 1;
+                const int z1 = z0 + 1;
+                aaa[lane] = p[p[p[x0] + y0] + z0];
+                aba[lane] = p[p[p[x0] + y1] + z0];
+                aab[lane] = p[p[p[x0] + y0] + z1];
+                abb[lane] = p[p[p[x0] + y1] + z1];
+                baa[lane] = p[p[p[x1] + y0] + z0];
+                bba[lane] = p[p[p[x1] + y1] + z0];
+                bab[lane] = p[p[p[x1] + y0] + z1];
+                bbb[lane] = p[p[p[x1] + y1] + z1];
+            }
+
+            const __m128 u = FadeSimd(xf);
+            const __m128 v = FadeSimd(yf);
+            const __m128 w = FadeSimd(zf);
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 xf1 = _mm_sub_ps(xf, one);
+            const __m128 yf1 = _mm_sub_ps(yf, one);
+            const __m128 zf1 = _mm_sub_ps(zf, one);
+
+            auto load = [](const int* values) { return _mm_load_si128(reinterpret_cast<const __m128i*>(values)); };
+
+            __m128 x1 = LerpSimd(GradientSimd(load(aaa), xf, yf, zf), GradientSimd(load(baa), xf1, yf, zf), u);
+            __m128 x2 = LerpSimd(GradientSimd(load(aba), xf, yf1, zf), GradientSimd(load(bba), xf1, yf1, zf), u);
+            const __m128 y1 = LerpSimd(x1, x2, v);
+            x1 = LerpSimd(GradientSimd(load(aab), xf, yf, zf1), GradientSimd(load(bab), xf1, yf, zf1), u);
+            x2 = LerpSimd(GradientSimd(load(abb), xf, yf1, zf1), GradientSimd(load(bbb), xf1, yf1, zf1), u);
+            const __m128 y2 = LerpSimd(x1, x2, v);
+
+            return _mm_div_ps(_mm_add_ps(LerpSimd(y1, y2, w), one), _mm_set1_ps(2.0f));
+        }
+#endif
     }
 
     PerlinImprovedNoise::PerlinImprovedNoise(int seed)
@@ -92,6 +204,64 @@ namespace GradientSignal
         return total / maxValue;
     }
 
+    void PerlinImprovedNoise::GenerateOctaveNoise(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues, int octaves, float persistence, float initialFrequency)
+    {
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "Input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        size_t index = 0;
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD
+        float maxValue = 0.0f;
+        {
+            float amplitude = 1.0f;
+            for (int i = 0; i < octaves; ++i)
+            {
+                maxValue += amplitude;
+                amplitude *= persistence;
+            }
+        }
+
+        if (maxValue <= 0.0f)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        const size_t simdCount = positions.size() & ~static_cast<size_t>(3);
+        for (; index < simdCount; index += 4)
+        {
+            const __m128 x = _mm_setr_ps(positions[index].GetX(), positions[index + 1].GetX(), positions[index + 2].GetX(), positions[index + 3].GetX());
+            const __m128 y = _mm_setr_ps(positions[index].GetY(), positions[index + 1].GetY(), positions[index + 2].GetY(), positions[index + 3].GetY());
+            const __m128 z = _mm_setr_ps(positions[index].GetZ(), positions[index + 1].GetZ(), positions[index + 2].GetZ(), positions[index + 3].GetZ());
+
+            __m128 total = _mm_setzero_ps();
+            float frequency = initialFrequency;
+            float amplitude = 1.0f;
+            for (int i = 0; i < octaves; ++i)
+            {
+                const __m128 frequency4 = _mm_set1_ps(frequency);
+                const __m128 noise = PerlinImprovedNoiseDetails::GenerateNoiseSimd(m_permutationTable,
+                    _mm_mul_ps(x, frequency4), _mm_mul_ps(y, frequency4), _mm_mul_ps(z, frequency4));
+                total = _mm_add_ps(total, _mm_mul_ps(noise, _mm_set1_ps(amplitude)));
+                amplitude *= persistence;
+                frequency *= 2.0f;
+            }
+
+            _mm_storeu_ps(&outValues[index], _mm_div_ps(total, _mm_set1_ps(maxValue)));
+        }
+#endif
+
+        // Remaining positions, or all of them on platforms without SIMD support
+        for (; index < positions.size(); ++index)
+        {
+            outValues[index] = GenerateOctaveNoise(positions[index].GetX(), positions[index].GetY(), positions[index].GetZ(), octaves, persistence, initialFrequency);
+        }
+    }
+
     float PerlinImprovedNoise::GenerateNoise(float x, float y, float z)
     {
         const int fx = (int)std::floor(x);
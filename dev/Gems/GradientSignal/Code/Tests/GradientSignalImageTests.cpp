@@ -416,6 +416,38 @@ namespace UnitTest
     }
 
 
+    TEST_F(GradientSignalImageTestsFixture, ImageAsset_TypedFormats_ReturnNormalizedValues)
+    {
+        // 2 x 1 image, the y flip doesn't matter with a single row
+        m_imageData = aznew GradientSignal::ImageAsset();
+        m_imageData->m_imageWidth = 2;
+        m_imageData->m_imageHeight = 1;
+        reinterpret_cast<AssignIdToAsset*>(m_imageData)->MakeReady();
+        AZ::Data::Asset<GradientSignal::ImageAsset> asset(m_imageData);
+
+        const AZ::Vector3 firstPixel(0.0f, 0.0f, 0.0f);
+        const AZ::Vector3 secondPixel(0.5f, 0.0f, 0.0f);
+
+        const AZ::u16 values16[] = { 0, 32768 };
+        m_imageData->m_imageFormat = static_cast<AZ::u32>(GradientSignal::ImageAssetFormat::R16);
+        m_imageData->m_imageData.resize(sizeof(values16));
+        memcpy(m_imageData->m_imageData.data(), values16, sizeof(values16));
+        EXPECT_FLOAT_EQ(0.0f, GradientSignal::GetValueFromImageAsset(asset, firstPixel, 1.0f, 1.0f, -1.0f));
+        EXPECT_FLOAT_EQ(32768.0f / 65535.0f, GradientSignal::GetValueFromImageAsset(asset, secondPixel, 1.0f, 1.0f, -1.0f));
+
+        // float values are clamped to the gradient range
+        const float valuesFloat[] = { 0.25f, 2.0f };
+        m_imageData->m_imageFormat = static_cast<AZ::u32>(GradientSignal::ImageAssetFormat::R32F);
+        m_imageData->m_imageData.resize(sizeof(valuesFloat));
+        memcpy(m_imageData->m_imageData.data(), valuesFloat, sizeof(valuesFloat));
+        EXPECT_FLOAT_EQ(0.25f, GradientSignal::GetValueFromImageAsset(asset, firstPixel, 1.0f, 1.0f, -1.0f));
+        EXPECT_FLOAT_EQ(1.0f, GradientSignal::GetValueFromImageAsset(asset, secondPixel, 1.0f, 1.0f, -1.0f));
+
+        // data that doesn't match the format returns the default value
+        m_imageData->m_imageData.resize(3);
+        EXPECT_FLOAT_EQ(-1.0f, GradientSignal::GetValueFromImageAsset(asset, firstPixel, 1.0f, 1.0f, -1.0f));
+    }
+
     TEST_F(GradientSignalImageTestsFixture, GradientTransformComponent_TransformTypes)
     {
         // Verify that each transform type for the transform component works correctly.
@@ -180,6 +180,35 @@ namespace UnitTest
         TestFixedDataSampler(expectedOutput, dataSize, entity->GetId());
     }
 
+    TEST_F(GradientSignalTestGeneratorFixture, PerlinImprovedNoise_BatchedMatchesScalar)
+    {
+        // Make sure the batched (and possibly SIMD) noise path produces the same values as the scalar path,
+        // including negative and non-integral coordinates and a count that isn't a multiple of the SIMD width.
+
+        GradientSignal::PerlinImprovedNoise perlinNoise(1234);
+
+        AZStd::vector<AZ::Vector3> positions;
+        for (int index = 0; index < 37; ++index)
+        {
+            const float offset = static_cast<float>(index);
+            positions.emplace_back(offset * 0.37f - 5.0f, offset * -1.13f + 2.5f, offset * 0.071f);
+        }
+
+        const int octaves = 4;
+        const float persistence = 0.75f;
+        const float frequency = 1.7f;
+
+        AZStd::vector<float> batchedValues(positions.size());
+        perlinNoise.GenerateOctaveNoise(positions, batchedValues, octaves, persistence, frequency);
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            const AZ::Vector3& position = positions[index];
+            const float scalarValue = perlinNoise.GenerateOctaveNoise(position.GetX(), position.GetY(), position.GetZ(), octaves, persistence, frequency);
+            EXPECT_NEAR(batchedValues[index], scalarValue, 0.0001f);
+        }
+    }
+
     TEST_F(GradientSignalTestGeneratorFixture, RandomGradientComponent_GoldenMasterTest)
     {
         // Make sure RandomGradientComponent returns back a "golden master" set
@@ -17,6 +17,8 @@
 #include <aws/core/http/HttpResponse.h>
 #include <aws/core/client/ClientConfiguration.h>
 
+#include <AzCore/std/algorithm.h>
+
 #include <AWSNativeSDKInit/AWSNativeSDKInit.h>
 
 #include "HttpRequestManager.h"
@@ -25,16 +27,28 @@ namespace HttpRequestor
 {
     const char* Manager::s_loggingName = "GemHttpRequestManager";
 
-    Manager::Manager()
+    Manager::Manager(unsigned int workerThreadCount)
     {
-        AZStd::thread_desc desc;
-        desc.m_name = s_loggingName;
-        desc.m_cpuId = AFFINITY_MASK_USERTHREADS;
         m_runThread = true;
         // Shutdown will be handled by the InitializationManager - no need to call in the destructor
         AWSNativeSDKInit::InitializationManager::InitAwsApi();
-        auto function = AZStd::bind(&Manager::ThreadFunction, this);
-        m_thread = AZStd::thread(function, &desc);
+
+        workerThreadCount = AZStd::max(workerThreadCount, 1u);
+
+        // One client for all workers: the client keeps a pool of connections per host, so requests to the same backend reuse an open connection
+        Aws::Client::ClientConfiguration clientConfiguration;
+        clientConfiguration.maxConnections = workerThreadCount;
+        m_httpClient = Aws::Http::CreateHttpClient(clientConfiguration);
+
+        m_threads.reserve(workerThreadCount);
+        for (unsigned int i = 0; i < workerThreadCount; ++i)
+        {
+            AZStd::thread_desc desc;
+            desc.m_name = s_loggingName;
+            desc.m_cpuId = AFFINITY_MASK_USERTHREADS;
+            auto function = AZStd::bind(&Manager::ThreadFunction, this);
+            m_threads.emplace_back(function, &desc);
+        }
     }
 
     Manager::~Manager()
@@ -42,11 +56,15 @@ namespace HttpRequestor
         // NativeSDK Shutdown does not need to be called here - will be taken care of by the InitializationManager
         m_runThread = false;
         m_requestConditionVar.notify_all();
-        if (m_thread.joinable())
+        for (AZStd::thread& thread : m_threads)
         {
-            m_thread.join();
+            if (thread.joinable())
+            {
+                thread.join();
+            }
         }
 
+        m_httpClient.reset();
     }
 
     void Manager::AddRequest(Parameters && httpRequestParameters)
@@ -55,7 +73,7 @@ namespace HttpRequestor
             AZStd::lock_guard<AZStd::mutex> lock(m_requestMutex);
             m_requestsToHandle.push(AZStd::move(httpRequestParameters));
         }
-        m_requestConditionVar.notify_all();
+        m_requestConditionVar.notify_one();
     }
 
     void Manager::AddTextRequest(TextParameters && httpTextRequestParameters)
@@ -64,52 +82,53 @@ namespace HttpRequestor
             AZStd::lock_guard<AZStd::mutex> lock(m_requestMutex);
             m_textRequestsToHandle.push(AZStd::move(httpTextRequestParameters));
         }
-        m_requestConditionVar.notify_all();
+        m_requestConditionVar.notify_one();
     }
 
     void Manager::ThreadFunction()
     {
         // Run the thread as long as directed
-        while (m_runThread)
+        while (HandleNextRequest())
         {
-            HandleRequestBatch();
         }
     }
 
-    void Manager::HandleRequestBatch()
+    bool Manager::HandleNextRequest()
     {
         // Lock mutex and wait for work to be signalled via the condition variable
         AZStd::unique_lock<AZStd::mutex> lock(m_requestMutex);
         m_requestConditionVar.wait(lock, [&] { return !m_runThread || !m_requestsToHandle.empty() || !m_textRequestsToHandle.empty(); });
 
-        // Swap queues
-        AZStd::queue<Parameters> requestsToHandle;
-        requestsToHandle.swap(m_requestsToHandle);
-
-        AZStd::queue<TextParameters> textRequestsToHandle;
-        textRequestsToHandle.swap(m_textRequestsToHandle);
+        // Requests still queued at shutdown are handled before the workers exit, so every callback is called
+        if (!m_requestsToHandle.empty())
+        {
+            Parameters httpRequestParameters = AZStd::move(m_requestsToHandle.front());
+            m_requestsToHandle.pop();
 
-        // Release lock
-        lock.unlock();
+            // Release lock
+            lock.unlock();
 
-        // Handle requests
-        while (!requestsToHandle.empty())
-        {
-            HandleRequest(requestsToHandle.front());
-            requestsToHandle.pop();
+            HandleRequest(httpRequestParameters);
+            return true;
         }
 
-        while (!textRequestsToHandle.empty())
+        if (!m_textRequestsToHandle.empty())
         {
-            HandleTextRequest(textRequestsToHandle.front());
-            textRequestsToHandle.pop();
+            TextParameters httpTextRequestParameters = AZStd::move(m_textRequestsToHandle.front());
+            m_textRequestsToHandle.pop();
+
+            // Release lock
+            lock.unlock();
+
+            HandleTextRequest(httpTextRequestParameters);
+            return true;
         }
+
+        return m_runThread;
     }
 
     void Manager::HandleRequest(const Parameters& httpRequestParameters)
     {
-        std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(Aws::Client::ClientConfiguration());
-
         auto httpRequest = Aws::Http::CreateHttpRequest(httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
 
         for (const auto & it : httpRequestParameters.GetHeaders())
@@ -122,7 +141,7 @@ namespace HttpRequestor
             httpRequest->AddContentBody(httpRequestParameters.GetBodyStream());
         }
         
-        auto httpResponse = httpClient->MakeRequest(*httpRequest);
+        auto httpResponse = m_httpClient->MakeRequest(*httpRequest);
 
         if (!httpResponse)
         {
@@ -149,8 +168,6 @@ namespace HttpRequestor
 
     void Manager::HandleTextRequest(const TextParameters & httpRequestParameters)
     {
-        std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(Aws::Client::ClientConfiguration());
-
         auto httpRequest = Aws::Http::CreateHttpRequest(httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
         
         for (const auto & it : httpRequestParameters.GetHeaders())
@@ -163,7 +180,7 @@ namespace HttpRequestor
             httpRequest->AddContentBody(httpRequestParameters.GetBodyStream());
         }
 
-        auto httpResponse = httpClient->MakeRequest(*httpRequest);
+        auto httpResponse = m_httpClient->MakeRequest(*httpRequest);
 
         if (!httpResponse)
         {
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -22,12 +23,23 @@
 #include "Include/HttpRequestor/HttpRequestParameters.h"
 #include "Include/HttpRequestor/HttpTextRequestParameters.h"
 
+namespace Aws
+{
+    namespace Http
+    {
+        class HttpClient;
+    }
+}
+
 namespace HttpRequestor
 {
     class Manager
     {
     public:
-        Manager();
+        // Number of worker threads used when none is given, requests are made concurrently up to this many at a time
+        static const unsigned int s_defaultWorkerThreadCount = 4;
+
+        explicit Manager(unsigned int workerThreadCount = s_defaultWorkerThreadCount);
         virtual ~Manager();
 
         // Add these parameters to a queue of request parameters to send off as an HTTP request as soon as they reach the head of the queue
@@ -37,11 +49,11 @@ namespace HttpRequestor
         void AddTextRequest(TextParameters && httpTextRequestParameters);
 
     private:
-        // RequestManager thread loop.
+        // RequestManager worker thread loop. Each worker takes the next queued request and runs it until the manager is stopped and the queues are empty.
         void ThreadFunction();
 
-        // Called by ThreadFunction. Waits for timeout or until notified and processes any requests queued up.
-        void HandleRequestBatch();
+        // Called by ThreadFunction. Waits until notified and processes the request at the head of the queues. Returns false once the worker should exit.
+        bool HandleNextRequest();
 
         // Perform an HTTP request, block until a response is received, then give the returned JSON to the callback to parse. Returns the HTTPResponseCode to the callback to handle any errors.
         void HandleRequest(const Parameters & httpRequestParameters);
@@ -54,8 +66,9 @@ namespace HttpRequestor
         AZStd::queue<TextParameters>            m_textRequestsToHandle;             // Queue of requests for TEXT blobs that will be made in order of time received
         AZStd::mutex                            m_requestMutex;                     // Member variables for synchronization
         AZStd::condition_variable               m_requestConditionVar;
-        AZStd::atomic<bool>                     m_runThread;                        // Run flag used to signal the worker thread
-        AZStd::thread                           m_thread;                           // This is the thread that will be used for all async operations
+        AZStd::atomic<bool>                     m_runThread;                        // Run flag used to signal the worker threads
+        AZStd::vector<AZStd::thread>            m_threads;                          // These are the threads that will be used for all async operations
+        std::shared_ptr<Aws::Http::HttpClient>  m_httpClient;                       // Client shared by all workers so its pooled connections are kept alive between requests
         static const char*                      s_loggingName;                      // Name to use for log messages etc...
     };
 
@@ -26,6 +26,7 @@ namespace ImageProcessing
                 ->Field("GlossBias", &BuilderSettings::m_brdfGlossBias)
                 ->Field("Streaming", &BuilderSettings::m_enableStreaming)
                 ->Field("Enable", &BuilderSettings::m_enablePlatform)
+                ->Field("MaxCompressionJobs", &BuilderSettings::m_maxCompressionJobs)
                 ->Field("Presets", &BuilderSettings::m_presets);
         }
     }
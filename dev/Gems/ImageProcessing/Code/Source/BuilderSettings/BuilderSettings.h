@@ -28,6 +28,9 @@ namespace ImageProcessing
         float m_brdfGlossBias = 0.0f;
         bool m_enableStreaming = true;
         bool m_enablePlatform = true;
+        //upper bound on the number of jobs used to compress one image. AP schedules one thread per builder job, so only
+        //raise it when fewer textures than cores are processed at a time, for example after a full content rebuild
+        AZ::u32 m_maxCompressionJobs = 1;
         AZStd::map<AZ::Uuid, PresetSettings> m_presets;
     };
 } // namespace ImageProcessing
\ No newline at end of file
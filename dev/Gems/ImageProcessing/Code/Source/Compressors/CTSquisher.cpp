@@ -32,10 +32,9 @@ namespace ImageProcessing
     {
         CrySquisherCallbackUserData* const pUserData = (CrySquisherCallbackUserData*)compress.userPtr;
 
+        // may be called from several compression jobs at once, each block is written to its own location
         AZ::u32 stride = (compress.width + 3) >> 2;
-        AZ::u32 blocks = (compress.height + 3) >> 2;
         memcpy(pUserData->m_dstMem + size * (stride * oy + ox), data, size);
-        pUserData->m_dstOffset = size * (stride * blocks);
     }
 
     void CrySquisherInputCallback(const CryTextureSquisher::DecompressorParameters& decompress, void* data, AZ::u32 size, AZ::u32 oy, AZ::u32 ox)
@@ -283,10 +282,12 @@ namespace ImageProcessing
         //passing compress option
         ICompressor::EQuality quality = ICompressor::eQuality_Normal;
         AZ::Vector3 weights = AZ::Vector3(0.3333f, 0.3334f, 0.3333f);
+        AZ::u32 maxJobs = 1;
         if (compressOption)
         {
             quality = compressOption->compressQuality;
             weights = compressOption->rgbWeight;
+            maxJobs = compressOption->maxJobs;
         }
 
         //do some clamp for float
@@ -376,6 +377,7 @@ namespace ImageProcessing
                 compress.userPtr = &userData;
                 compress.userOutputFunction = CrySquisherOutputCallback;
                 compress.preset = GetCompressPreset(fmtDst, fmtSrc);
+                compress.maxJobs = maxJobs;
 
                 CryTextureSquisher::Compress(compress);
             }
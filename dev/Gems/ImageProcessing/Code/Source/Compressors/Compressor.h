@@ -39,6 +39,8 @@ namespace ImageProcessing
             EQuality compressQuality = eQuality_Normal;
             //required for CTSquisher
             AZ::Vector3 rgbWeight = AZ::Vector3(0.3333f, 0.3334f, 0.3333f);
+            //upper bound on the number of jobs a compressor may split an image across
+            AZ::u32 maxJobs = 1;
         };
 
     public:
@@ -18,6 +18,9 @@
 #include "ColorBlockRGBA4x4f.h"
 #include "CryTextureSquisher.h"
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/parallel/mutex.h>
 
 // preserve the ability to link with the old squish (which is in NvTT)
@@ -337,6 +340,42 @@ namespace ImageProcessing
     /* -------------------------------------------------------------------------------------------------------------
      * compression functions
      */
+    // Splits the rows of 4x4 blocks into bands and compresses the bands on the job threads. Each band writes its own
+    // blocks, so the only shared state is the squish weights which the caller keeps locked for the whole image.
+    template<typename CompressRowsFunction>
+    static void CompressBlockRows(unsigned int height, unsigned int maxJobs, const CompressRowsFunction& compressRows)
+    {
+        static const unsigned int minRowsPerJob = 16U;
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const unsigned int numBands = maxJobs > 1 && jobContext
+            ? AZ::GetMin(maxJobs, AZ::GetMax(1U, height / minRowsPerJob))
+            : 1U;
+        if (numBands <= 1)
+        {
+            compressRows(0U, height);
+            return;
+        }
+
+        // bands start on block boundaries
+        const unsigned int rowsPerBand = ((height / numBands) + 3U) & ~3U;
+
+        AZ::JobCompletion jobCompletion;
+        for (unsigned int rowBegin = 0U; rowBegin < height; rowBegin += rowsPerBand)
+        {
+            const unsigned int rowEnd = AZ::GetMin(rowBegin + rowsPerBand, height);
+            AZ::Job* job = AZ::CreateJobFunction([&compressRows, rowBegin, rowEnd]()
+            {
+                compressRows(rowBegin, rowEnd);
+            }, true, jobContext);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
     void CryTextureSquisher::Compress(const CryTextureSquisher::CompressorParameters& compress)
     {
         const unsigned int w = compress.width;
@@ -394,33 +433,36 @@ namespace ImageProcessing
         case eBufferType_uint8:
         case eBufferType_sint8:
         {
-            for (unsigned int y = 0U; y < h; y += 4U)
+            CompressBlockRows(h, compress.maxJobs, [&](unsigned int rowBegin, unsigned int rowEnd)
             {
-                ColorBlockRGBA4x4c srcBlock;
-                uint8 dstBlock[BLOCKSIZE_LIMIT];
-
-                uint8* const targetBlock = dstBlock;
-                const uint8* const sourceRgba = (const uint8*)srcBlock.colors() + offset;
-
-                for (unsigned int x = 0U; x < w; x += 4U)
+                for (unsigned int y = rowBegin; y < rowEnd; y += 4U)
                 {
-                    if (!bAlphaOnly)
-                    {
-                        srcBlock.setRGBA8(compress.srcBuffer, w, h, compress.pitch, x, y);
-                    }
-                    else
-                    {
-                        srcBlock.setA8(compress.srcBuffer, w, h, compress.pitch, x, y);
-                    }
+                    ColorBlockRGBA4x4c srcBlock;
+                    uint8 dstBlock[BLOCKSIZE_LIMIT];
 
-                    sqio.encoder(sourceRgba, 0xFFFF, targetBlock, sqio.flags);
+                    uint8* const targetBlock = dstBlock;
+                    const uint8* const sourceRgba = (const uint8*)srcBlock.colors() + offset;
 
-                    if (compress.userOutputFunction)
+                    for (unsigned int x = 0U; x < w; x += 4U)
                     {
-                        compress.userOutputFunction(compress, targetBlock, sqio.blocksize, y >> 2, x >> 2);
+                        if (!bAlphaOnly)
+                        {
+                            srcBlock.setRGBA8(compress.srcBuffer, w, h, compress.pitch, x, y);
+                        }
+                        else
+                        {
+                            srcBlock.setA8(compress.srcBuffer, w, h, compress.pitch, x, y);
+                        }
+
+                        sqio.encoder(sourceRgba, 0xFFFF, targetBlock, sqio.flags);
+
+                        if (compress.userOutputFunction)
+                        {
+                            compress.userOutputFunction(compress, targetBlock, sqio.blocksize, y >> 2, x >> 2);
+                        }
                     }
                 }
-            }
+            });
         }
         break;
         // compress an unsigned 16bit texture -------------------------------------------------
@@ -428,33 +470,36 @@ namespace ImageProcessing
         case eBufferType_uint16:
         case eBufferType_sint16:
         {
-            for (unsigned int y = 0U; y < h; y += 4U)
+            CompressBlockRows(h, compress.maxJobs, [&](unsigned int rowBegin, unsigned int rowEnd)
             {
-                ColorBlockRGBA4x4s srcBlock;
-                uint8 dstBlock[BLOCKSIZE_LIMIT];
-
-                uint8* const targetBlock = dstBlock;
-                const float* const sourceRgba = (const float*)srcBlock.colors() + offset;
-
-                for (unsigned int x = 0U; x < w; x += 4U)
+                for (unsigned int y = rowBegin; y < rowEnd; y += 4U)
                 {
-                    if (!bAlphaOnly)
-                    {
-                        srcBlock.setRGBA16(compress.srcBuffer, w, h, compress.pitch, x, y);
-                    }
-                    else
-                    {
-                        srcBlock.setA16(compress.srcBuffer, w, h, compress.pitch, x, y);
-                    }
+                    ColorBlockRGBA4x4s srcBlock;
+                    uint8 dstBlock[BLOCKSIZE_LIMIT];
 
-                    sqio.encoder(sourceRgba, 0xFFFF, targetBlock, sqio.flags);
+                    uint8* const targetBlock = dstBlock;
+                    const float* const sourceRgba = (const float*)srcBlock.colors() + offset;
 
-                    if (compress.userOutputFunction)
+                    for (unsigned int x = 0U; x < w; x += 4U)
                     {
-                        compress.userOutputFunction(compress, targetBlock, sqio.blocksize, y >> 2, x >> 2);
+                        if (!bAlphaOnly)
+                        {
+                            srcBlock.setRGBA16(compress.srcBuffer, w, h, compress.pitch, x, y);
+                        }
+                        else
+                        {
+                            srcBlock.setA16(compress.srcBuffer, w, h, compress.pitch, x, y);
+                        }
+
+                        sqio.encoder(sourceRgba, 0xFFFF, targetBlock, sqio.flags);
+
+                        if (compress.userOutputFunction)
+                        {
+                            compress.userOutputFunction(compress, targetBlock, sqio.blocksize, y >> 2, x >> 2);
+                        }
                     }
                 }
-            }
+            });
         }
         break;
         // compress an unsigned floating point texture ----------------------------------------
@@ -462,33 +507,36 @@ namespace ImageProcessing
         case eBufferType_ufloat:
         case eBufferType_sfloat:
         {
-            for (unsigned int y = 0U; y < h; y += 4U)
+            CompressBlockRows(h, compress.maxJobs, [&](unsigned int rowBegin, unsigned int rowEnd)
             {
-                ColorBlockRGBA4x4f srcBlock;
-                uint8 dstBlock[BLOCKSIZE_LIMIT];
-
-                uint8* const targetBlock = dstBlock;
-                const float* const sourceRgba = (const float*)srcBlock.colors() + offset;
-
-                for (unsigned int x = 0U; x < w; x += 4U)
+                for (unsigned int y = rowBegin; y < rowEnd; y += 4U)
                 {
-                    if (!bAlphaOnly)
-                    {
-                        srcBlock.setRGBAf(compress.srcBuffer, w, h, compress.pitch, x, y);
-                    }
-                    else
-                    {
-                        srcBlock.setAf(compress.srcBuffer, w, h, compress.pitch, x, y);
-                    }
+                    ColorBlockRGBA4x4f srcBlock;
+                    uint8 dstBlock[BLOCKSIZE_LIMIT];
 
-                    sqio.encoder(sourceRgba, 0xFFFF, targetBlock, sqio.flags);
+                    uint8* const targetBlock = dstBlock;
+                    const float* const sourceRgba = (const float*)srcBlock.colors() + offset;
 
-                    if (compress.userOutputFunction)
+                    for (unsigned int x = 0U; x < w; x += 4U)
                     {
-                        compress.userOutputFunction(compress, targetBlock, sqio.blocksize, y >> 2, x >> 2);
+                        if (!bAlphaOnly)
+                        {
+                            srcBlock.setRGBAf(compress.srcBuffer, w, h, compress.pitch, x, y);
+                        }
+                        else
+                        {
+                            srcBlock.setAf(compress.srcBuffer, w, h, compress.pitch, x, y);
+                        }
+
+                        sqio.encoder(sourceRgba, 0xFFFF, targetBlock, sqio.flags);
+
+                        if (compress.userOutputFunction)
+                        {
+                            compress.userOutputFunction(compress, targetBlock, sqio.blocksize, y >> 2, x >> 2);
+                        }
                     }
                 }
-            }
+            });
         }
         break;
         default:
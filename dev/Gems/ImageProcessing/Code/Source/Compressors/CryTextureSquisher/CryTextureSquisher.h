@@ -103,6 +103,9 @@ namespace ImageProcessing
             int userInt;
 
             void(*userOutputFunction)(const CompressorParameters& compress, const void* compressedData, unsigned int compressedSize, unsigned int oy, unsigned int ox);
+
+            // upper bound on the number of jobs the image may be split across, userOutputFunction must then be thread safe
+            unsigned int maxJobs = 1;
         };
 
         struct DecompressorParameters
@@ -24,8 +24,7 @@
 
 namespace ImageProcessing
 {
-    //limited to 1 thread because AP requires so. We may change to n when AP allocate n thread to a job in the furture
-    static const int  MAX_COMP_JOBS = 1;
+    //limited to 1 thread by default because AP requires so, BuilderSettings::m_maxCompressionJobs raises the limit
     static const int MIN_COMP_JOBS = 1;
     static const float  ETC_LOW_EFFORT_LEVEL = 25.0f;
     static const float  ETC_MED_EFFORT_LEVEL = 40.0f;
@@ -127,10 +126,12 @@ namespace ImageProcessing
 
         //determinate compression quality
         ICompressor::EQuality quality = ICompressor::eQuality_Normal;
+        int maxCompJobs = MIN_COMP_JOBS;
         //get setting from compression option
         if (compressOption)
         {
             quality = compressOption->compressQuality;
+            maxCompJobs = AZ::GetMax(MIN_COMP_JOBS, static_cast<int>(compressOption->maxJobs));
         }
 
         float qualityEffort = 0.0f;
@@ -202,7 +203,7 @@ namespace ImageProcessing
                 errMetric,
                 qualityEffort,
                 MIN_COMP_JOBS,
-                MAX_COMP_JOBS,
+                maxCompJobs,
                 &paucEncodingBits, &uiEncodingBitsBytes,
                 &uiExtendedWidth, &uiExtendedHeight,
                 &iEncodingTime_ms);
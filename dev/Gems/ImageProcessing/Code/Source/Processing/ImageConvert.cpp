@@ -510,6 +510,10 @@ namespace ImageProcessing
         }
         m_image->GetCompressOption().compressQuality = quality;
         m_image->GetCompressOption().rgbWeight = m_presetSetting.GetColorWeight();
+        if (const BuilderSettings* builderSettings = BuilderSettingManager::Instance()->GetBuilderSetting(m_platformId))
+        {
+            m_image->GetCompressOption().maxJobs = builderSettings->m_maxCompressionJobs;
+        }
         m_image->ConvertFormat(m_presetSetting.m_pixelFormat);
         return true;
     }    
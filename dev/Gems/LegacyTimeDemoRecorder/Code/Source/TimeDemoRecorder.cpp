@@ -29,6 +29,8 @@
 #include <AzFramework/IO/FileOperations.h>
 #include <HMDBus.h>
 
+#include <numeric>
+
 #if defined(WIN32)
 #include <CryWindows.h>
 #endif
@@ -519,6 +521,12 @@ CTimeDemoRecorder::CTimeDemoRecorder()
     m_demo_noinfo   = 0;
     m_demo_save_every_frame = 0;
     m_demo_use_hmd_rotation = 0;
+    m_demo_perf_report = 0;
+    m_demo_perf_threshold = 10.0f;
+    m_demo_perf_baseline = 0;
+
+    m_perfLevelLoadTime = -1.0f;
+    ResetPerfStats();
 
     m_nCurrentDemoLevel = 0;
     m_countDownPlay = 0;
@@ -573,6 +581,11 @@ CTimeDemoRecorder::CTimeDemoRecorder()
 
     REGISTER_STRING("demo_finish_cmd", "", 0, "Console command to run when demo is finished");
 
+    REGISTER_CVAR2("demo_perf_report", &m_demo_perf_report, 0, 0, "Write frame time, GPU time, subsystem time, memory and load time statistics of each played level to " TIMEDEMO_RESULTS_DIR "/PerformanceReport.xml");
+    m_demo_perf_baseline = REGISTER_STRING("demo_perf_baseline", "", 0, "PerformanceReport.xml of a previous run to compare the demo_perf_report results with.\n"
+        "Levels with regressions are listed in the report and marked as failed in the chainloading JUnit results");
+    REGISTER_CVAR2("demo_perf_threshold", &m_demo_perf_threshold, 10.0f, 0, "Increase in percent over a demo_perf_baseline value which is reported as a regression");
+
     REGISTER_CVAR2_CB("demo_num_orientations", &m_numOrientations, 1, 0, "Number of horizontal orientations to play the demo using\n"
         "e.g. 3 will play: looking ahead, 120deg left, 120deg right\n"
         "default/min: 1",
@@ -762,6 +775,7 @@ void CTimeDemoRecorder::Play(bool bEnable)
 
         // Start demo playback.
         m_lastPlayedTotalTime = 0;
+        ResetPerfStats();
         StartSession();
     }
     else
@@ -773,6 +787,13 @@ void CTimeDemoRecorder::Play(bool bEnable)
         // End demo playback.
         m_lastPlayedTotalTime = m_totalDemoTime.GetSeconds();
         StopSession();
+
+        if (m_demo_perf_report)
+        {
+            FinishPerfResult();
+            SavePerfReport();
+        }
+        m_perfLevelLoadTime = -1.0f;
     }
     m_bRecording = false;
     m_currentFrame = 0;
@@ -1755,6 +1776,11 @@ bool CTimeDemoRecorder::PlayFrame()
 
         m_fpsCounter = 0;
         m_lastFpsTimeRecorded = time;
+
+        if (m_demo_perf_report)
+        {
+            SamplePerfMemory();
+        }
     }
     else
     {
@@ -1778,6 +1804,11 @@ bool CTimeDemoRecorder::PlayFrame()
             m_minFPS_Frame = m_currentFrame;
             m_minFPS = m_currFPS;
         }
+
+        if (m_demo_perf_report)
+        {
+            AddPerfFrameSample(deltaFrameTime.GetSeconds());
+        }
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -2247,6 +2278,214 @@ void CTimeDemoRecorder::LogEndOfLoop()
     }
 }
 
+//////////////////////////////////////////////////////////////////////////
+void CTimeDemoRecorder::ResetPerfStats()
+{
+    m_perfFrameTimes.clear();
+    m_perfGpuTimes.clear();
+    m_perfRenderThreadTimeSum = 0;
+    memset(m_perfSubsystemTimeSum, 0, sizeof(m_perfSubsystemTimeSum));
+    m_perfPeakWorkingSet = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CTimeDemoRecorder::AddPerfFrameSample(float frameTime)
+{
+    m_perfFrameTimes.push_back(frameTime * 1000.0f);
+
+    if (gEnv->pRenderer)
+    {
+        m_perfGpuTimes.push_back(gEnv->pRenderer->GetGPUFrameTime() * 1000.0f);
+
+        IRenderer::SRenderTimes renderTimes;
+        gEnv->pRenderer->GetRenderTimes(renderTimes);
+        m_perfRenderThreadTimeSum += renderTimes.fTimeProcessedRT * 1000.0f;
+    }
+
+    // Self times of the last completed frame, only available while the frame profiler collects (demo_profile).
+    IFrameProfileSystem* pProfileSystem = gEnv->pFrameProfileSystem;
+    if (pProfileSystem && pProfileSystem->IsProfiling())
+    {
+        for (int i = 0, count = pProfileSystem->GetProfilerCount(); i < count; ++i)
+        {
+            CFrameProfiler* pProfiler = pProfileSystem->GetProfiler(i);
+            if (pProfiler && pProfiler->m_subsystem < PROFILE_LAST_SUBSYSTEM)
+            {
+                m_perfSubsystemTimeSum[pProfiler->m_subsystem] += pProfiler->m_selfTimeHistory.GetLast();
+            }
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CTimeDemoRecorder::SamplePerfMemory()
+{
+    IMemoryManager::SProcessMemInfo meminfo;
+    if (GetISystem()->GetIMemoryManager()->GetProcessMemInfo(meminfo))
+    {
+        m_perfPeakWorkingSet = max(m_perfPeakWorkingSet, (uint64)meminfo.WorkingSetSize);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CTimeDemoRecorder::FinishPerfResult()
+{
+    SamplePerfMemory();
+
+    SPerfResult result;
+    result.level = GetCurrentLevelName();
+    result.numFrames = (int)m_perfFrameTimes.size();
+    result.loadTime = m_perfLevelLoadTime;
+    result.peakMemoryMB = (float)m_perfPeakWorkingSet / (1024.0f * 1024.0f);
+
+    // Percentile of the samples, reorders the vector.
+    auto percentile = [](std::vector<float>& samples, float fraction) -> float
+    {
+        if (samples.empty())
+        {
+            return 0.0f;
+        }
+        std::vector<float>::iterator it = samples.begin() + min((size_t)(fraction * samples.size()), samples.size() - 1);
+        std::nth_element(samples.begin(), it, samples.end());
+        return *it;
+    };
+    auto average = [](const std::vector<float>& samples) -> float
+    {
+        return samples.empty() ? 0.0f : std::accumulate(samples.begin(), samples.end(), 0.0f) / samples.size();
+    };
+
+    const float invNumFrames = result.numFrames ? 1.0f / result.numFrames : 0.0f;
+    result.avgFrameTimeMs = average(m_perfFrameTimes);
+    result.maxFrameTimeMs = m_perfFrameTimes.empty() ? 0.0f : *std::max_element(m_perfFrameTimes.begin(), m_perfFrameTimes.end());
+    result.p50FrameTimeMs = percentile(m_perfFrameTimes, 0.50f);
+    result.p95FrameTimeMs = percentile(m_perfFrameTimes, 0.95f);
+    result.p99FrameTimeMs = percentile(m_perfFrameTimes, 0.99f);
+    result.avgGpuTimeMs = average(m_perfGpuTimes);
+    result.p95GpuTimeMs = percentile(m_perfGpuTimes, 0.95f);
+    result.avgRenderThreadTimeMs = m_perfRenderThreadTimeSum * invNumFrames;
+    for (int i = 0; i < PROFILE_LAST_SUBSYSTEM; ++i)
+    {
+        result.subsystemTimeMs[i] = m_perfSubsystemTimeSum[i] * invNumFrames;
+    }
+
+    CompareWithPerfBaseline(result);
+
+    LogInfo("    Performance: Frame Time avg %.2fms, p95 %.2fms, p99 %.2fms, GPU avg %.2fms, Peak Memory %.0fMb, Load Time %.2fs",
+        result.avgFrameTimeMs, result.p95FrameTimeMs, result.p99FrameTimeMs, result.avgGpuTimeMs, result.peakMemoryMB, result.loadTime);
+    for (const string& regression : result.regressions)
+    {
+        LogInfo("    Performance Regression: %s", regression.c_str());
+    }
+
+    if (m_nCurrentDemoLevel > 0 && m_nCurrentDemoLevel <= m_demoLevels.size())
+    {
+        m_demoLevels[m_nCurrentDemoLevel - 1].perfRegressions = result.regressions;
+    }
+
+    m_perfResults.push_back(result);
+    ResetPerfStats();
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CTimeDemoRecorder::CompareWithPerfBaseline(SPerfResult& result)
+{
+    const char* szBaselineFile = m_demo_perf_baseline ? m_demo_perf_baseline->GetString() : "";
+    if (!szBaselineFile || !*szBaselineFile)
+    {
+        return;
+    }
+
+    XmlNodeRef baseline = GetISystem()->LoadXmlFromFile(szBaselineFile);
+    if (!baseline)
+    {
+        CryWarning(VALIDATOR_MODULE_GAME, VALIDATOR_WARNING, "Failed to load performance baseline: %s", szBaselineFile);
+        return;
+    }
+
+    XmlNodeRef baselineLevel;
+    for (int i = 0; i < baseline->getChildCount(); ++i)
+    {
+        XmlNodeRef node = baseline->getChild(i);
+        if (node->isTag("Level") && result.level.compareNoCase(node->getAttr("name")) == 0)
+        {
+            baselineLevel = node;
+            break;
+        }
+    }
+    if (!baselineLevel)
+    {
+        LogInfo("    Performance: Level %s not found in baseline %s", result.level.c_str(), szBaselineFile);
+        return;
+    }
+
+    const float scale = 1.0f + m_demo_perf_threshold * 0.01f;
+    auto compare = [&](const char* szMetric, float value)
+    {
+        float baselineValue = 0.0f;
+        if (baselineLevel->getAttr(szMetric, baselineValue) && baselineValue > 0.0f && value > baselineValue * scale)
+        {
+            string regression;
+            regression.Format("%s %.2f, baseline %.2f (+%.1f%%)", szMetric, value, baselineValue, (value / baselineValue - 1.0f) * 100.0f);
+            result.regressions.push_back(regression);
+        }
+    };
+    compare("avgFrameTimeMs", result.avgFrameTimeMs);
+    compare("p95FrameTimeMs", result.p95FrameTimeMs);
+    compare("p99FrameTimeMs", result.p99FrameTimeMs);
+    compare("avgGpuTimeMs", result.avgGpuTimeMs);
+    compare("peakMemoryMB", result.peakMemoryMB);
+    compare("loadTime", result.loadTime);
+}
+
+//////////////////////////////////////////////////////////////////////////
+void CTimeDemoRecorder::SavePerfReport()
+{
+    XmlNodeRef report = GetISystem()->CreateXmlNode("PerformanceReport");
+    const char* szBaselineFile = m_demo_perf_baseline ? m_demo_perf_baseline->GetString() : "";
+    if (szBaselineFile && *szBaselineFile)
+    {
+        report->setAttr("baseline", szBaselineFile);
+        report->setAttr("threshold", m_demo_perf_threshold);
+    }
+
+    for (const SPerfResult& result : m_perfResults)
+    {
+        XmlNodeRef level = report->newChild("Level");
+        level->setAttr("name", result.level.c_str());
+        level->setAttr("frames", result.numFrames);
+        level->setAttr("loadTime", result.loadTime);
+        level->setAttr("avgFrameTimeMs", result.avgFrameTimeMs);
+        level->setAttr("p50FrameTimeMs", result.p50FrameTimeMs);
+        level->setAttr("p95FrameTimeMs", result.p95FrameTimeMs);
+        level->setAttr("p99FrameTimeMs", result.p99FrameTimeMs);
+        level->setAttr("maxFrameTimeMs", result.maxFrameTimeMs);
+        level->setAttr("avgGpuTimeMs", result.avgGpuTimeMs);
+        level->setAttr("p95GpuTimeMs", result.p95GpuTimeMs);
+        level->setAttr("avgRenderThreadTimeMs", result.avgRenderThreadTimeMs);
+        level->setAttr("peakMemoryMB", result.peakMemoryMB);
+
+        for (int i = 0; i < PROFILE_LAST_SUBSYSTEM; ++i)
+        {
+            if (result.subsystemTimeMs[i] > 0.0f)
+            {
+                XmlNodeRef subsystem = level->newChild("Subsystem");
+                subsystem->setAttr("name", GetProfiledSubsystemName((EProfiledSubsystem)i));
+                subsystem->setAttr("avgTimeMs", result.subsystemTimeMs[i]);
+            }
+        }
+
+        for (const string& regression : result.regressions)
+        {
+            XmlNodeRef node = level->newChild("Regression");
+            node->setContent(regression.c_str());
+        }
+    }
+
+    gEnv->pCryPak->MakeDir(TIMEDEMO_RESULTS_DIR);
+    report->saveToFile(TIMEDEMO_RESULTS_DIR "/PerformanceReport.xml");
+}
+
+//////////////////////////////////////////////////////////////////////////
 void CTimeDemoRecorder::GetMemoryStatistics(ICrySizer* s) const
 {
     SIZER_SUBCOMPONENT_NAME(s, "TimeDemoRecorder");
@@ -2500,6 +2739,7 @@ void CTimeDemoRecorder::StartChainDemo(const char* levelsListFilename, bool bAut
     m_bChainloadingDemo = true;
     EraseLogFile();
     m_demoLevels.clear();
+    m_perfResults.clear();
     if (levelsListFilename && *levelsListFilename)
     {
         // Open file with list of levels for autotest.
@@ -2558,6 +2798,7 @@ void CTimeDemoRecorder::StartDemoLevel(const char** levelNames, int levelCount)
     m_bChainloadingDemo = true;
     EraseLogFile();
     m_demoLevels.clear();
+    m_perfResults.clear();
 
     if (levelNames && levelCount > 0)
     {
@@ -2613,7 +2854,10 @@ void CTimeDemoRecorder::StartNextChainedLevel()
         {
             CryStackStringT<char, 256> mapCmd("map ");
             mapCmd += m_demoLevels[m_nCurrentDemoLevel].level;
+            // The map command loads the level synchronously.
+            const CTimeValue loadStartTime = GetTime();
             gEnv->pConsole->ExecuteString(mapCmd);
+            m_perfLevelLoadTime = (GetTime() - loadStartTime).GetSeconds();
             StartDemoDelayed(50);
             m_nCurrentDemoLevel++;
             return;
@@ -2666,7 +2910,19 @@ void CTimeDemoRecorder::SaveChainloadingJUnitResults()
         XmlNodeRef testcase = testsuit->newChild("testcase");
         testcase->setAttr("name", m_demoLevels[i].level.c_str());
         testcase->setAttr("time", nSeconds);
-        if (!m_demoLevels[i].bSuccess)
+        if (m_demoLevels[i].bSuccess && !m_demoLevels[i].perfRegressions.empty())
+        {
+            string message;
+            for (const string& regression : m_demoLevels[i].perfRegressions)
+            {
+                message += regression;
+                message += "\n";
+            }
+            XmlNodeRef failure = testcase->newChild("failure");
+            failure->setAttr("type", "Performance Regression");
+            failure->setAttr("message", message.c_str());
+        }
+        else if (!m_demoLevels[i].bSuccess)
         {
             XmlNodeRef failure = testcase->newChild("failure");
             if (!m_demoLevels[i].bRun)
@@ -168,6 +168,25 @@ private:
         void GetMemoryUsage(ICrySizer* pSizer) const{}
     };
 
+    //! Performance results of one played level, written to the performance report and compared with the baseline.
+    struct SPerfResult
+    {
+        string level;
+        int numFrames;
+        float loadTime;           // Seconds, negative if the level wasn't loaded by the demo chain.
+        float avgFrameTimeMs;
+        float p50FrameTimeMs;
+        float p95FrameTimeMs;
+        float p99FrameTimeMs;
+        float maxFrameTimeMs;
+        float avgGpuTimeMs;
+        float p95GpuTimeMs;
+        float avgRenderThreadTimeMs;
+        float peakMemoryMB;       // Working set high-water mark.
+        float subsystemTimeMs[PROFILE_LAST_SUBSYSTEM]; // Average profiled self time per frame.
+        std::vector<string> regressions;
+    };
+
 private:
     void StartSession();
     void StopSession();
@@ -229,6 +248,13 @@ private:
     void ReplayGameState(struct FrameRecord& rec);
     void SaveDemoFinishedLog();
 
+    void ResetPerfStats();
+    void AddPerfFrameSample(float frameTime);
+    void SamplePerfMemory();
+    void FinishPerfResult();
+    void CompareWithPerfBaseline(SPerfResult& result);
+    void SavePerfReport();
+
     void AddFrameRecord(const FrameRecord& rec);
 
     void SignalPlayback(bool bEnable);
@@ -317,6 +343,15 @@ private:
 
     struct STimeDemoInfo* m_pTimeDemoInfo;
 
+    //! Per frame samples of the current level (all loops), summarized by FinishPerfResult().
+    std::vector<float> m_perfFrameTimes;
+    std::vector<float> m_perfGpuTimes;
+    float m_perfRenderThreadTimeSum;
+    float m_perfSubsystemTimeSum[PROFILE_LAST_SUBSYSTEM];
+    uint64 m_perfPeakWorkingSet;
+    float m_perfLevelLoadTime;
+    std::vector<SPerfResult> m_perfResults;
+
 public:
     static ICVar* s_timedemo_file;
     static CTimeDemoRecorder* s_pTimeDemoRecorder;
@@ -341,6 +376,9 @@ public:
     int m_demo_noinfo;
     int m_demo_save_every_frame;
     int m_demo_use_hmd_rotation;
+    int m_demo_perf_report;
+    float m_demo_perf_threshold;
+    ICVar* m_demo_perf_baseline;
 
     bool m_bAIEnabled;
 
@@ -353,6 +391,7 @@ public:
         float time;     // Time of test in seconds
         bool bSuccess; // If test was successful.
         bool bRun;     // If test was successful.
+        std::vector<string> perfRegressions; // Metrics that got worse than the performance baseline.
     };
     std::vector<SChainDemoLevel> m_demoLevels;
     int m_nCurrentDemoLevel;
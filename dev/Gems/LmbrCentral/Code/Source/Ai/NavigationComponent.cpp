@@ -196,6 +196,15 @@ namespace LmbrCentral
             if (delta > m_navigationComponent->m_repathThreshold)
             {
                 m_currentDestination = world.GetPosition();
+
+                // The result of the previous request would be ignored anyway, so take it out of the pathfinder's
+                // queue instead of letting it compete with the new one (and with every other agent re-pathing)
+                if (gEnv->pAISystem && GetPathfinderRequestId() != MNM::Constants::eQueuedPathID_InvalidID)
+                {
+                    IMNMPathfinder* pathFinder = gEnv->pAISystem->GetMNMPathfinder();
+                    pathFinder->CancelPathRequest(GetPathfinderRequestId());
+                }
+
                 SetPathfinderRequestId(m_navigationComponent->RequestPath());
             }
         }
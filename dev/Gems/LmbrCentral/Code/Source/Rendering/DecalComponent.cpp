@@ -105,7 +105,11 @@ namespace LmbrCentral
 
         SDecalProperties decalProperties = m_configuration.GetDecalProperties(transform);
 
-        m_decalRenderNode = static_cast<IDecalRenderNode*>(gEnv->p3DEngine->CreateRenderNode(eERType_Decal));
+        // decals are purely visual, dedicated servers don't create the render node (or load its material)
+        if (!gEnv->IsDedicated())
+        {
+            m_decalRenderNode = static_cast<IDecalRenderNode*>(gEnv->p3DEngine->CreateRenderNode(eERType_Decal));
+        }
         if (m_decalRenderNode)
         {
             m_decalRenderNode->SetRndFlags(m_decalRenderNode->GetRndFlags() | ERF_COMPONENT_ENTITY);
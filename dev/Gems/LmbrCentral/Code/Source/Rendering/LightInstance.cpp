@@ -403,7 +403,8 @@ namespace LmbrCentral
     template <typename ConfigurationType, typename ConfigToLightParamsFunc>
     void LightInstance::CreateRenderLightInternal(const ConfigurationType& configuration, ConfigToLightParamsFunc configToLightParams)
     {
-        if (m_renderLight || !configuration.m_visible)
+        // dedicated servers never render, so they don't need the light source or its material
+        if (m_renderLight || !configuration.m_visible || gEnv->IsDedicated())
         {
             return;
         }
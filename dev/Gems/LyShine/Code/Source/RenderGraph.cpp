@@ -855,6 +855,12 @@ namespace LyShine
         m_isRenderingToMask = isRenderingToMask;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool RenderGraph::IsRenderingToRenderTarget() const
+    {
+        return m_renderTargetNestLevel > 0;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     void RenderGraph::PushAlphaFade(float alphaFadeValue)
     {
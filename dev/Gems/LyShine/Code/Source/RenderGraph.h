@@ -261,6 +261,8 @@ namespace LyShine
         bool IsRenderingToMask() const override;
         void SetIsRenderingToMask(bool isRenderingToMask) override;
 
+        bool IsRenderingToRenderTarget() const override;
+
         void PushAlphaFade(float alphaFadeValue) override;
         void PushOverrideAlphaFade(float alphaFadeValue) override;
         void PopAlphaFade() override;
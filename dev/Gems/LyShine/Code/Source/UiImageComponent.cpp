@@ -320,7 +320,10 @@ void UiImageComponent::SetOverrideColor(const AZ::Color& color)
     m_overrideColor.Set(color.GetAsVector3());
 
     m_isColorOverridden = true;
-    MarkRenderCacheDirty();
+    if (!UpdateCachedVertexColorsInPlace())
+    {
+        MarkRenderCacheDirty();
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -329,7 +332,10 @@ void UiImageComponent::SetOverrideAlpha(float alpha)
     m_overrideAlpha = alpha;
 
     m_isAlphaOverridden = true;
-    MarkRenderCacheDirty();
+    if (!UpdateCachedVertexColorsInPlace())
+    {
+        MarkRenderCacheDirty();
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -357,18 +363,15 @@ void UiImageComponent::Render(LyShine::IRenderGraph* renderGraph)
 
     ISprite* sprite = (m_overrideSprite) ? m_overrideSprite : m_sprite;
 
+    // until the primitive is added below the graph does not reference the cached vertices
+    m_isCachedPrimitiveInRenderGraph = false;
+    m_renderGraphAlphaFade = fade;
+
     if (m_isRenderCacheDirty)
     {
         int cellIndex = (m_overrideSprite) ? m_overrideSpriteCellIndex : m_spriteSheetCellIndex;
 
-        bool isTextureSRGB = IsSpriteTypeRenderTarget() && m_isRenderTargetSRGB;
-
-        AZ::Color color = AZ::Color::CreateFromVector3AndFloat(m_overrideColor.GetAsVector3(), 1.0f);
-        if (!isTextureSRGB)
-        {
-            color = color.GammaToLinear();   // the colors are specified in sRGB but we want linear colors in the shader
-        }
-        uint32 packedColor = (desiredPackedAlpha << 24) | (color.GetR8() << 16) | (color.GetG8() << 8) | color.GetB8();
+        uint32 packedColor = ComputePackedColor(desiredPackedAlpha);
 
         ImageType imageType = m_imageType;
 
@@ -460,6 +463,9 @@ void UiImageComponent::Render(LyShine::IRenderGraph* renderGraph)
         bool isTexturePremultipliedAlpha = false; // we are not rendering from a render target with alpha in it
 
         renderGraph->AddPrimitive(&m_cachedPrimitive, texture, isClampTextureMode, isTextureSRGB, isTexturePremultipliedAlpha, m_blendMode);
+
+        // render targets are only rendered when the graph is rebuilt so color changes can't be applied in place
+        m_isCachedPrimitiveInRenderGraph = !renderGraph->IsRenderingToRenderTarget();
     }
 }
 
@@ -487,14 +493,21 @@ void UiImageComponent::SetColor(const AZ::Color& color)
         m_overrideAlpha = m_alpha;
     }
 
-    if (oldOverrideColor != m_overrideColor)
-    {
-        MarkRenderCacheDirty();
-    }
-    else if (oldOverrideAlpha != m_overrideAlpha)
+    if (oldOverrideColor != m_overrideColor || oldOverrideAlpha != m_overrideAlpha)
     {
-        // alpha changed so we need RenderGraph to be rebuilt but not render cache
-        MarkRenderGraphDirty();
+        if (UpdateCachedVertexColorsInPlace())
+        {
+            // the primitive in the render graph has been updated so the graph can be kept
+        }
+        else if (oldOverrideColor != m_overrideColor)
+        {
+            MarkRenderCacheDirty();
+        }
+        else
+        {
+            // alpha changed so we need RenderGraph to be rebuilt but not render cache
+            MarkRenderGraphDirty();
+        }
     }
 }
 
@@ -2348,10 +2361,52 @@ void UiImageComponent::ClearCachedIndices()
     m_cachedPrimitive.m_numIndices = 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32 UiImageComponent::ComputePackedColor(uint8 packedAlpha)
+{
+    bool isTextureSRGB = IsSpriteTypeRenderTarget() && m_isRenderTargetSRGB;
+
+    AZ::Color color = AZ::Color::CreateFromVector3AndFloat(m_overrideColor.GetAsVector3(), 1.0f);
+    if (!isTextureSRGB)
+    {
+        color = color.GammaToLinear();   // the colors are specified in sRGB but we want linear colors in the shader
+    }
+    return (packedAlpha << 24) | (color.GetR8() << 16) | (color.GetG8() << 8) | color.GetB8();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UiImageComponent::UpdateCachedVertexColorsInPlace()
+{
+    // The render graph links to m_cachedPrimitive rather than copying it. So if the current graph was
+    // built with our valid cached vertices then a color or alpha change only needs the vertex colors
+    // rewritten, the graph and the other elements on the canvas do not need to be rebuilt.
+    if (m_isRenderCacheDirty || !m_isCachedPrimitiveInRenderGraph || m_cachedPrimitive.m_numVertices == 0)
+    {
+        return false;
+    }
+
+    uint8 desiredPackedAlpha = static_cast<uint8>(m_overrideAlpha * m_renderGraphAlphaFade * 255.0f);
+    if (desiredPackedAlpha == 0)
+    {
+        // Render skips adding fully transparent primitives so let the graph be rebuilt without it
+        return false;
+    }
+
+    UCol desiredPackedColor;
+    desiredPackedColor.dcolor = ComputePackedColor(desiredPackedAlpha);
+    for (int i = 0; i < m_cachedPrimitive.m_numVertices; ++i)
+    {
+        m_cachedPrimitive.m_vertices[i].color = desiredPackedColor;
+    }
+
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiImageComponent::MarkRenderCacheDirty()
 {
     m_isRenderCacheDirty = true;
+    m_isCachedPrimitiveInRenderGraph = false;
 
     MarkRenderGraphDirty();
 }
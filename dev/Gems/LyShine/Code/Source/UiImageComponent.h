@@ -218,6 +218,8 @@ private: // member functions
     void RenderTriangleList(const SVF_P2F_C4B_T2F_F4B* vertices, const uint16* indices, int numVertices, int numIndices);
     void ClearCachedVertices();
     void ClearCachedIndices();
+    uint32 ComputePackedColor(uint8 packedAlpha);
+    bool UpdateCachedVertexColorsInPlace();
     void MarkRenderCacheDirty();
     void MarkRenderGraphDirty();
 
@@ -306,4 +308,6 @@ private: // data
     // cached rendering data for performance optimization
     IRenderer::DynUiPrimitive m_cachedPrimitive;
     bool m_isRenderCacheDirty = true;
+    bool m_isCachedPrimitiveInRenderGraph = false;  //!< true if the current render graph renders m_cachedPrimitive directly
+    float m_renderGraphAlphaFade = 1.0f;            //!< the parent alpha fade when the current render graph was built
 };
@@ -125,43 +125,43 @@ void UiLayoutManager::ComputeLayoutForElementAndDescendants(AZ::EntityId entityI
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiLayoutManager::AddToRecomputeLayoutList(AZ::EntityId entityId)
 {
-    // Check if element is already in the list
-    auto iter = AZStd::find(m_elementsToRecomputeLayout.begin(), m_elementsToRecomputeLayout.end(), entityId);
-    if (iter == m_elementsToRecomputeLayout.end())
+    // Gather the element's ancestors once so that checking each marked element against them doesn't
+    // need any more bus calls
+    AZStd::vector<AZ::EntityId> ancestors;
+    AZ::EntityId parent;
+    EBUS_EVENT_ID_RESULT(parent, entityId, UiElementBus, GetParentEntityId);
+    while (parent.IsValid())
     {
-        // Check if element's parent is already in the list
-        for (iter = m_elementsToRecomputeLayout.begin(); iter != m_elementsToRecomputeLayout.end(); ++iter)
+        ancestors.push_back(parent);
+
+        AZ::EntityId newParent = parent;
+        parent.SetInvalid();
+        EBUS_EVENT_ID_RESULT(parent, newParent, UiElementBus, GetParentEntityId);
+    }
+
+    // Check if element or element's parent is already in the list
+    for (const AZ::EntityId& markedElement : m_elementsToRecomputeLayout)
+    {
+        if (markedElement == entityId
+            || AZStd::find(ancestors.begin(), ancestors.end(), markedElement) != ancestors.end())
         {
-            if (IsParentOfElement(*iter, entityId))
-            {
-                // Don't need to add this element
-                return;
-            }
+            // Don't need to add this element
+            return;
         }
-
-        // Remove element's children from the list
-        LyShine::EntityArray descendants;
-        EBUS_EVENT_ID(entityId, UiElementBus, FindDescendantElements,
-            [](const AZ::Entity* entity) { return true; },
-            descendants);
-
-        m_elementsToRecomputeLayout.remove_if(
-            [descendants](const AZ::EntityId& e)
-            {
-                for (auto descendant : descendants)
-                {
-                    if (descendant->GetId() == e)
-                    {
-                        return true;
-                    }
-                }
-                return false;
-            }
-            );
-
-        // Add element to list
-        m_elementsToRecomputeLayout.push_back(entityId);
     }
+
+    // Remove element's children from the list. Walking up from each marked element is much cheaper
+    // than finding all the descendants of this element when it has a large hierarchy below it
+    // (e.g. a scroll box content element with many items)
+    m_elementsToRecomputeLayout.remove_if(
+        [this, entityId](const AZ::EntityId& e)
+        {
+            return IsParentOfElement(entityId, e);
+        }
+        );
+
+    // Add element to list
+    m_elementsToRecomputeLayout.push_back(entityId);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
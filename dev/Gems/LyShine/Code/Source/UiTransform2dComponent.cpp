@@ -727,16 +727,6 @@ void UiTransform2dComponent::SetRecomputeFlags(Recompute recompute)
         recompute = Recompute::RectAndTransform;
     }
 
-    int numChildren = GetElementComponent()->GetNumChildElements();
-    for (int i = 0; i < numChildren; i++)
-    {
-        UiTransform2dComponent* childTransformComponent = GetChildTransformComponent(i);
-        if (childTransformComponent)
-        {
-            childTransformComponent->SetRecomputeFlags(recompute);
-        }
-    }
-
     switch (recompute)
     {
     case Recompute::RectOnly:
@@ -756,8 +746,21 @@ void UiTransform2dComponent::SetRecomputeFlags(Recompute recompute)
         break;
     }
 
-    // Tell the canvas that this element needs a recompute
+    // Tell the canvas that this element needs a recompute. This is done before marking the children so
+    // that the canvas processes the scheduled elements top down: a parent's transforms are recomputed and
+    // its rect change handlers run before its children are recomputed, rather than the children pulling
+    // in the parent's transforms and then having to be recomputed again if those handlers change them.
     GetCanvasComponent()->ScheduleElementForTransformRecompute(GetElementComponent());
+
+    int numChildren = GetElementComponent()->GetNumChildElements();
+    for (int i = 0; i < numChildren; i++)
+    {
+        UiTransform2dComponent* childTransformComponent = GetChildTransformComponent(i);
+        if (childTransformComponent)
+        {
+            childTransformComponent->SetRecomputeFlags(recompute);
+        }
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -626,43 +626,46 @@ inline int TAnimTrack<KeyType>::GetActiveKey(float time, KeyType* key)
         m_currKey = 0;
     }
 
-    // Start from current key.
-    int i;
-    for (i = m_currKey; i < nkeys; i++)
+    // Start from current key, sequential playback stays on it or moves to the next one.
+    int first = 0;
+    if (m_currKey < nkeys && time >= m_keys[m_currKey].time)
     {
-        if (time >= m_keys[i].time)
+        for (int i = m_currKey; i < nkeys && i <= m_currKey + 1; i++)
         {
-            if ((i >= nkeys - 1) || (time < m_keys[i + 1].time))
+            if (time >= m_keys[i].time)
             {
-                m_currKey = i;
-                *key = m_keys[m_currKey];
-                return m_currKey;
+                if ((i >= nkeys - 1) || (time < m_keys[i + 1].time))
+                {
+                    m_currKey = i;
+                    *key = m_keys[m_currKey];
+                    return m_currKey;
+                }
+            }
+            else
+            {
+                break;
             }
         }
-        else
-        {
-            break;
-        }
+        first = m_currKey;
     }
 
-    // Start from begining.
-    for (i = 0; i < nkeys; i++)
+    // Jumped or went backwards, binary search the sorted keys for the last key at or before time.
+    int lo = first + 1;
+    int hi = nkeys;
+    while (lo < hi)
     {
-        if (time >= m_keys[i].time)
+        const int mid = (lo + hi) / 2;
+        if (time >= m_keys[mid].time)
         {
-            if ((i >= nkeys - 1) || (time < m_keys[i + 1].time))
-            {
-                m_currKey = i;
-                *key = m_keys[m_currKey];
-                return m_currKey;
-            }
+            lo = mid + 1;
         }
         else
         {
-            break;
+            hi = mid;
         }
     }
-    m_currKey = -1;
+    m_currKey = lo - 1;
+    *key = m_keys[m_currKey];
     return m_currKey;
 }
 
@@ -401,4 +401,21 @@ namespace AnimTrackTest
         int i = m_testTrackA.GetActiveKey(6.0f, &tempKey);
         EXPECT_EQ(i, 2);
     }
+
+    TEST_F(TAnimTrackTest, GetActiveKey_TimeJumpsForwardAndBack_ExpectValid)
+    {
+        ITestKey tempKey;
+        int i = m_testTrackA.GetActiveKey(1.0f, &tempKey);
+        EXPECT_EQ(i, 0);
+
+        // Skip past more than one key from the current one.
+        i = m_testTrackA.GetActiveKey(5.5f, &tempKey);
+        EXPECT_EQ(i, 2);
+        EXPECT_EQ(tempKey.time, 5.0f);
+
+        // Step back to exactly a key time.
+        i = m_testTrackA.GetActiveKey(2.0f, &tempKey);
+        EXPECT_EQ(i, 1);
+        EXPECT_EQ(tempKey.time, 2.0f);
+    }
 } //namespace AnimTrackTest
\ No newline at end of file
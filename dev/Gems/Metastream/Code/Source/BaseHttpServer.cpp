@@ -13,6 +13,7 @@
 #include "BaseHttpServer.h"
 #include "DataCache.h"
 
+#include <cstdlib>
 #include <sstream>
 
 using namespace Metastream;
@@ -65,6 +66,46 @@ Metastream::HttpResponse Metastream::BaseHttpServer::GetDataValues(const std::st
     return response;
 }
 
+HttpResponse BaseHttpServer::GetDataChanges(const std::string& tableName, const std::string& sinceVersion) const
+{
+    int code = 404;
+    std::string body(m_cache->GetTableChangesJSON(tableName, std::strtoull(sinceVersion.c_str(), nullptr, 10)));
+
+    if (!body.empty())
+    {
+        code = 200;
+    }
+
+    HttpResponse response;
+    response.code = code;
+    response.body = body.c_str();
+    return response;
+}
+
+HttpResponse BaseHttpServer::HandleQuery(const std::map<std::string, std::string>& filters) const
+{
+    auto table = filters.find("table");
+    if (table == filters.end())
+    {
+        return GetDataTables();
+    }
+
+    auto since = filters.find("since");
+    if (since != filters.end())
+    {
+        return GetDataChanges(table->second, since->second);
+    }
+
+    auto key = filters.find("key");
+    if (key != filters.end())
+    {
+        std::vector<std::string> keyList = SplitValueList(key->second, ',');
+        return GetDataValues(table->second, keyList);
+    }
+
+    return GetDataKeys(table->second);
+}
+
 std::map<std::string, std::string> BaseHttpServer::TokenizeQuery(const char* queryString)
 {
     std::map<std::string, std::string> queryMap;
@@ -64,6 +64,12 @@ namespace Metastream
         // Return a JSON object containing a set of values.
         HttpResponse GetDataValues(const std::string& tableName, const std::vector<std::string>& keys) const;
 
+        // Return a JSON object containing the values changed after a version, and the version to ask for next time.
+        HttpResponse GetDataChanges(const std::string& tableName, const std::string& sinceVersion) const;
+
+        // Build the response for a tokenized query, shared by the HTTP and websocket handlers.
+        HttpResponse HandleQuery(const std::map<std::string, std::string>& filters) const;
+
         //---------------------------------------------------------------------
         // Helper functions
 
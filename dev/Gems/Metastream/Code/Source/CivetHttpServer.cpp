@@ -38,26 +38,7 @@ public:
             filters = BaseHttpServer::TokenizeQuery(request->query_string);
         }
                 
-        HttpResponse response;
-
-        auto table = filters.find("table");
-        if (table != filters.end())
-        {
-            auto key = filters.find("key");
-            if (key != filters.end())
-            {
-                std::vector<std::string> keyList = BaseHttpServer::SplitValueList(key->second, ',');
-                response = m_parent->GetDataValues(table->second, keyList);
-            }
-            else
-            {
-                response = m_parent->GetDataKeys(table->second);
-            }
-        }
-        else
-        {
-            response = m_parent->GetDataTables();
-        }
+        HttpResponse response = m_parent->HandleQuery(filters);
 
         mg_printf(conn, BaseHttpServer::HttpStatus(response.code).c_str());
         mg_printf(conn, BaseHttpServer::SerializeHeaders(response.headers).c_str());
@@ -105,26 +86,7 @@ public:
                     filters = BaseHttpServer::TokenizeQuery(std::string(data, data_len).c_str());
                 }
 
-                HttpResponse response;
-
-                auto table = filters.find("table");
-                if (table != filters.end())
-                {
-                    auto key = filters.find("key");
-                    if (key != filters.end())
-                    {
-                        std::vector<std::string> keyList = BaseHttpServer::SplitValueList(key->second, ',');
-                        response = m_parent->GetDataValues(table->second, keyList);
-                    }
-                    else
-                    {
-                        response = m_parent->GetDataKeys(table->second);
-                    }
-                }
-                else
-                {
-                    response = m_parent->GetDataTables();
-                }
+                HttpResponse response = m_parent->HandleQuery(filters);
                 std::string payload(response.body);
                 mg_websocket_write(conn, WEBSOCKET_OPCODE_TEXT, payload.c_str(), payload.size() + 1);
                 break;
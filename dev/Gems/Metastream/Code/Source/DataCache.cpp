@@ -250,6 +250,20 @@ std::string DataCache::GetTableKeyValuesJSON(const std::string& tableName, const
     return json;
 }
 
+std::string DataCache::GetTableChangesJSON(const std::string& tableName, AZ::u64 sinceVersion) const
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutexDatabase);
+    std::string json;
+
+    auto it = m_database.find(tableName);
+
+    if (it != m_database.end())
+    {
+        json = it->second->GetChangesJSON(sinceVersion);
+    }
+
+    return json;
+}
 
 void DataCache::ClearCache()
 {
@@ -266,7 +280,7 @@ DataCache::DocumentPtr DataCache::FindDoc(const std::string & tableName)
     auto docItr = m_database.find(tableName);
     if (docItr == m_database.end())
     {
-        doc = std::make_shared<Document>();
+        doc = std::make_shared<Document>(m_version);
         m_database[tableName] = doc;
     }
     else
@@ -278,9 +292,11 @@ DataCache::DocumentPtr DataCache::FindDoc(const std::string & tableName)
 }
 
 
-DataCache::Document::Document() 
+DataCache::Document::Document(AZStd::atomic<AZ::u64>& version) 
     : m_jsonDoc()
     , m_allocator( m_jsonDoc.GetAllocator() )
+    , m_version( version )
+    , m_jsonSnapshotValid( false )
 {
     m_jsonDoc.SetObject();
 }
@@ -320,52 +336,98 @@ std::string DataCache::Document::GetKeyValuesJSON(const std::vector<std::string>
 {
     AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
 
+    if ((keyList.size() == 1) && (keyList[0] == "*"))
+    {
+        // the whole table is only serialized again once it has changed
+        return GetJSONSnapshot();
+    }
+
     rapidjson::StringBuffer buffer;
     buffer.Clear();
     rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
 
-    if ((keyList.size() == 1) && (keyList[0] == "*"))
-    {
-        m_jsonDoc.Accept(writer);
-    }
-    else
-    {
-        rapidjson::Document jsonDoc;
-        jsonDoc.SetObject();
+    rapidjson::Document jsonDoc;
+    jsonDoc.SetObject();
 
-        for (rapidjson::Value::ConstMemberIterator itr = m_jsonDoc.MemberBegin(); itr != m_jsonDoc.MemberEnd(); ++itr)
+    for (rapidjson::Value::ConstMemberIterator itr = m_jsonDoc.MemberBegin(); itr != m_jsonDoc.MemberEnd(); ++itr)
+    {
+        std::string keyName(itr->name.GetString());
+        if (std::find(keyList.cbegin(), keyList.cend(), keyName) != keyList.cend())
         {
-            std::string keyName(itr->name.GetString());
-            if (std::find(keyList.cbegin(), keyList.cend(), keyName) != keyList.cend())
-            {
-                // do a deep copy for this key...
-                rapidjson::Value v;
+            // do a deep copy for this key...
+            rapidjson::Value v;
 
-                v.CopyFrom(itr->value, jsonDoc.GetAllocator());
+            v.CopyFrom(itr->value, jsonDoc.GetAllocator());
 
-                jsonDoc.AddMember(rapidjson::Value().SetString(itr->name.GetString(), jsonDoc.GetAllocator()), v, jsonDoc.GetAllocator());
-            }
+            jsonDoc.AddMember(rapidjson::Value().SetString(itr->name.GetString(), jsonDoc.GetAllocator()), v, jsonDoc.GetAllocator());
         }
-
-        jsonDoc.Accept(writer);
     }
 
+    jsonDoc.Accept(writer);
+
     return std::string(buffer.GetString());
 }
 
-std::string DataCache::Document::GetJSON() const
+std::string DataCache::Document::GetChangesJSON(AZ::u64 sinceVersion) const
 {
     AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
 
+    rapidjson::Document jsonDoc;
+    jsonDoc.SetObject();
+    rapidjson::Value values(rapidjson::kObjectType);
+
+    for (rapidjson::Value::ConstMemberIterator itr = m_jsonDoc.MemberBegin(); itr != m_jsonDoc.MemberEnd(); ++itr)
+    {
+        auto keyVersion = m_keyVersions.find(itr->name.GetString());
+        if (keyVersion != m_keyVersions.end() && keyVersion->second > sinceVersion)
+        {
+            // do a deep copy for this key...
+            rapidjson::Value v;
+
+            v.CopyFrom(itr->value, jsonDoc.GetAllocator());
+
+            values.AddMember(rapidjson::Value().SetString(itr->name.GetString(), jsonDoc.GetAllocator()), v, jsonDoc.GetAllocator());
+        }
+    }
+
+    // Every later change to this table is made under m_mutex and gets a higher version than this one
+    uint64_t version = m_version.load();
+    jsonDoc.AddMember("version", rapidjson::Value(version), jsonDoc.GetAllocator());
+    jsonDoc.AddMember("values", values, jsonDoc.GetAllocator());
+
     rapidjson::StringBuffer buffer;
     buffer.Clear();
 
     rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-    m_jsonDoc.Accept(writer);
+    jsonDoc.Accept(writer);
 
     return std::string(buffer.GetString());
 }
 
+std::string DataCache::Document::GetJSON() const
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+    return GetJSONSnapshot();
+}
+
+const std::string& DataCache::Document::GetJSONSnapshot() const
+{
+    if (!m_jsonSnapshotValid)
+    {
+        rapidjson::StringBuffer buffer;
+        buffer.Clear();
+
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        m_jsonDoc.Accept(writer);
+
+        m_jsonSnapshot.assign(buffer.GetString(), buffer.GetSize());
+        m_jsonSnapshotValid = true;
+    }
+
+    return m_jsonSnapshot;
+}
+
 void DataCache::Document::Add(const std::string & key, rapidjson::Value & value)
 {
     AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
@@ -374,6 +436,9 @@ void DataCache::Document::Add(const std::string & key, rapidjson::Value & value)
         m_jsonDoc.RemoveMember(ToJson(key));
 
     m_jsonDoc.AddMember(ToJson(key), value, m_allocator);
+
+    m_keyVersions[key] = ++m_version;
+    m_jsonSnapshotValid = false;
 }
 
 void DataCache::Document::AddToArray(const std::string & arrayName, rapidjson::Value & value)
@@ -13,13 +13,14 @@
 
 #include <AzCore/JSON/rapidjson.h>
 #include <AzCore/JSON/document.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace Metastream
 {
     class DataCache
     {
     public:
-        DataCache() {}
+        DataCache() : m_version(0) {}
         void AddToCache(const std::string & tableName, const std::string & key, const char *value);
         void AddToCache(const std::string & tableName, const std::string & key, bool value);
         void AddToCache(const std::string & tableName, const std::string & key, const Vec3 &value);
@@ -48,6 +49,8 @@ namespace Metastream
         std::string GetDatabasesJSON() const;
         std::string GetTableKeysJSON(const std::string& tableName) const;
         std::string GetTableKeyValuesJSON(const std::string& tableName, const std::vector<std::string>& keyList) const;
+        // Returns the keys of a table that changed after sinceVersion along with the version to pass on the next call, e.g. {"version":12,"values":{...}}
+        std::string GetTableChangesJSON(const std::string& tableName, AZ::u64 sinceVersion) const;
         
         void ClearCache();
     
@@ -55,11 +58,12 @@ namespace Metastream
         class Document
         {
             public:
-                Document();
+                Document(AZStd::atomic<AZ::u64>& version);
                 virtual ~Document();
 
                 std::string GetKeysJSON() const;
                 std::string GetKeyValuesJSON(const std::vector<std::string>& keyList) const;
+                std::string GetChangesJSON(AZ::u64 sinceVersion) const;
                 std::string GetJSON() const;
                 
                 void Add(const std::string & key, rapidjson::Value & value);
@@ -85,6 +89,8 @@ namespace Metastream
                 enum class ValueType {Array, Object};
                 rapidJsonValuePtr FindValue(const std::string & name, ValueType type);
                 void RemoveValue(const std::string &objectName, ValueType type);
+                // Must be called with m_mutex held
+                const std::string& GetJSONSnapshot() const;
         
             private:
                 mutable AZStd::mutex                    m_mutex;
@@ -92,6 +98,12 @@ namespace Metastream
                 rapidjson::Document                     m_jsonDoc;
                 rapidjson::Document::AllocatorType &    m_allocator;
                 JsonValueMap                            m_jsonValues;
+
+                // these data are protected by m_mutex
+                AZStd::atomic<AZ::u64> &                m_version;              // Shared by all tables of the cache, so versions keep increasing across ClearCache
+                std::map<std::string, AZ::u64>          m_keyVersions;          // Version at which each key was last set
+                mutable std::string                     m_jsonSnapshot;         // Whole table serialized, reused by every poll until the table changes
+                mutable bool                            m_jsonSnapshotValid;
         };
 
         typedef std::shared_ptr<Document> DocumentPtr;
@@ -102,6 +114,7 @@ namespace Metastream
     private:
         mutable AZStd::mutex    m_mutexDatabase;
         Database                m_database;
+        AZStd::atomic<AZ::u64>  m_version;
     };
 
 } // namespace Metastream
\ No newline at end of file
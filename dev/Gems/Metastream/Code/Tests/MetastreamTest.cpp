@@ -13,6 +13,8 @@
 
 #include <AzTest/AzTest.h>
 
+#include "DataCache.h"
+
 class MetastreamTest : public ::testing::Test
 {
 protected:
@@ -32,4 +34,42 @@ TEST_F(MetastreamTest, ExampleTest)
     ASSERT_TRUE(true);
 }
 
+TEST_F(MetastreamTest, DataCache_TableChanges_OnlyReturnsKeysChangedSinceVersion)
+{
+    Metastream::DataCache cache;
+    cache.AddToCache("table", "first", true);
+    cache.AddToCache("table", "second", AZ::s64(2));
+
+    rapidjson::Document allChanges;
+    allChanges.Parse(cache.GetTableChangesJSON("table", 0).c_str());
+    ASSERT_TRUE(allChanges.IsObject());
+    EXPECT_TRUE(allChanges["values"].HasMember("first"));
+    EXPECT_TRUE(allChanges["values"].HasMember("second"));
+
+    const AZ::u64 version = allChanges["version"].GetUint64();
+    cache.AddToCache("table", "second", AZ::s64(3));
+
+    rapidjson::Document newChanges;
+    newChanges.Parse(cache.GetTableChangesJSON("table", version).c_str());
+    ASSERT_TRUE(newChanges.IsObject());
+    EXPECT_FALSE(newChanges["values"].HasMember("first"));
+    ASSERT_TRUE(newChanges["values"].HasMember("second"));
+    EXPECT_EQ(3, newChanges["values"]["second"].GetInt64());
+    EXPECT_GT(newChanges["version"].GetUint64(), version);
+
+    EXPECT_TRUE(cache.GetTableChangesJSON("missing", 0).empty());
+}
+
+TEST_F(MetastreamTest, DataCache_AllKeyValues_ReflectsChangesAfterSnapshot)
+{
+    Metastream::DataCache cache;
+    cache.AddToCache("table", "value", AZ::s64(1));
+
+    const std::vector<std::string> allKeys{ "*" };
+    EXPECT_EQ(std::string("{\"value\":1}"), cache.GetTableKeyValuesJSON("table", allKeys));
+
+    cache.AddToCache("table", "value", AZ::s64(2));
+    EXPECT_EQ(std::string("{\"value\":2}"), cache.GetTableKeyValuesJSON("table", allKeys));
+}
+
 AZ_UNIT_TEST_HOOK();
\ No newline at end of file
@@ -48,6 +48,7 @@ namespace PhysX
         AZStd::string m_pvdFileName = "physxDebugInfo.pxd2"; ///< PhysX Visual Debugger output filename.
         PvdAutoConnectMode m_pvdAutoConnectMode = PvdAutoConnectMode::Disabled; ///< PVD auto connect preference.
         bool m_pvdReconnect = true; ///< Reconnect when switching between game and edit mode automatically (Editor mode only).
+        int m_taskAffinityDomain = -1; ///< Job steal domain PhysX simulation tasks are hinted to run on, -1 means no preference.
 
         struct ColliderProximityVisualization
         {
@@ -29,9 +29,32 @@ namespace PhysX
         return aznew AzPhysXCpuDispatcher();
     }
 
+    void AzPhysXCpuDispatcher::SetTaskPriority(AZ::JobPriority priority)
+    {
+        m_taskPriority = priority;
+    }
+
+    AZ::JobPriority AzPhysXCpuDispatcher::GetTaskPriority() const
+    {
+        return m_taskPriority;
+    }
+
+    void AzPhysXCpuDispatcher::SetTaskAffinityDomain(int domain)
+    {
+        m_taskAffinityDomain = domain;
+    }
+
+    int AzPhysXCpuDispatcher::GetTaskAffinityDomain() const
+    {
+        return m_taskAffinityDomain;
+    }
+
     void AzPhysXCpuDispatcher::submitTask(physx::PxBaseTask& task)
     {
+        // The job wrapper comes from the thread pool allocator, so submitting a task does not hit the system heap
         auto azJob = aznew PhysX::AzPhysXJob(task);
+        azJob->SetPriority(m_taskPriority);
+        azJob->SetAffinityDomain(m_taskAffinityDomain);
         azJob->Start();
     }
 
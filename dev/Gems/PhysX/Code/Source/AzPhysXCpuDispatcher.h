@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <AzCore/Jobs/JobContext.h>
 #include <Source/SystemComponent.h>
 
 namespace PhysX
@@ -25,11 +26,22 @@ namespace PhysX
 
         AzPhysXCpuDispatcher();
         ~AzPhysXCpuDispatcher();
-        
+
+        /// Priority lane of the jobs running PhysX tasks, simulation is frame critical so this defaults to JobPriority::Critical.
+        void SetTaskPriority(AZ::JobPriority priority);
+        AZ::JobPriority GetTaskPriority() const;
+
+        /// Steal domain hint for the jobs running PhysX tasks (see AZ::Job::SetAffinityDomain), -1 means no preference (default).
+        void SetTaskAffinityDomain(int domain);
+        int GetTaskAffinityDomain() const;
+
     private:
         // PxCpuDispatcher implementation
         virtual void submitTask(physx::PxBaseTask& task);
         physx::PxU32 getWorkerCount() const override;
+
+        AZ::JobPriority m_taskPriority = AZ::JobPriority::Critical;
+        int m_taskAffinityDomain = -1;
     };
 
     /// Creates a CPU dispatcher which directs tasks submitted by PhysX to the Lumberyard scheduling system.
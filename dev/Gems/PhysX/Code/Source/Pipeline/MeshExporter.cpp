@@ -12,6 +12,12 @@
 
 #include <PhysX_precompiled.h>
 
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Math/Sha1.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <AzToolsFramework/Debug/TraceContext.h>
 #include <SceneAPI/SceneCore/Containers/Utilities/Filters.h>
@@ -342,6 +348,162 @@ namespace PhysX
             return cookingSuccessful;
         }
 
+        namespace CookingCache
+        {
+            static const char* s_cacheFolder = "PhysX/CookingCache";
+            static const char* s_cacheFileExtension = "pxcooked";
+
+            template<typename T>
+            static void HashValue(AZ::Sha1& sha, const T& value)
+            {
+                sha.ProcessBytes(&value, sizeof(T));
+            }
+
+            template<typename T>
+            static void HashVector(AZ::Sha1& sha, const AZStd::vector<T>& values)
+            {
+                HashValue(sha, values.size());
+                if (!values.empty())
+                {
+                    sha.ProcessBytes(values.data(), values.size() * sizeof(T));
+                }
+            }
+
+            /// Builds the cache key from everything that affects the cooked output: the PhysX version, the cooking settings
+            /// of the mesh group and the mesh data itself.
+            static AZStd::string CreateKey(
+                const AZStd::vector<Vec3>& vertices,
+                const AZStd::vector<AZ::u32>& indices,
+                const AZStd::vector<AZ::u16>& faceMaterials,
+                const MeshGroup& meshGroup)
+            {
+                AZ::Sha1 sha;
+                HashValue(sha, static_cast<AZ::u32>(PX_PHYSICS_VERSION));
+
+                HashValue(sha, meshGroup.GetExportAsConvex());
+                HashValue(sha, meshGroup.GetBuildGPUData());
+                HashValue(sha, meshGroup.GetAreaTestEpsilon());
+                HashValue(sha, meshGroup.GetPlaneTolerance());
+                HashValue(sha, meshGroup.GetUse16bitIndices());
+                HashValue(sha, meshGroup.GetCheckZeroAreaTriangles());
+                HashValue(sha, meshGroup.GetQuantizeInput());
+                HashValue(sha, meshGroup.GetUsePlaneShifting());
+                HashValue(sha, meshGroup.GetShiftVertices());
+                HashValue(sha, meshGroup.GetGaussMapLimit());
+                HashValue(sha, meshGroup.GetWeldVertices());
+                HashValue(sha, meshGroup.GetDisableCleanMesh());
+                HashValue(sha, meshGroup.GetForce32BitIndices());
+                HashValue(sha, meshGroup.GetSuppressTriangleMeshRemapTable());
+                HashValue(sha, meshGroup.GetBuildTriangleAdjacencies());
+                HashValue(sha, meshGroup.GetMeshWeldTolerance());
+                HashValue(sha, meshGroup.GetNumTrisPerLeaf());
+
+                HashVector(sha, vertices);
+                HashVector(sha, indices);
+                HashVector(sha, faceMaterials);
+
+                AZ::u32 digest[5];
+                sha.GetDigest(digest);
+                return AZStd::string::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+            }
+
+            /// Returns the cache file for the key, empty if there is no user cache to keep cooked meshes in.
+            static AZStd::string GetFilePath(const AZStd::string& key)
+            {
+                AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+                const char* userCachePath = fileIO ? fileIO->GetAlias("@usercache@") : nullptr;
+                if (!userCachePath)
+                {
+                    return AZStd::string();
+                }
+
+                return AZStd::string::format("%s/%s/%s.%s", userCachePath, s_cacheFolder, key.c_str(), s_cacheFileExtension);
+            }
+
+            static bool Read(const AZStd::string& filePath, AZStd::vector<AZ::u8>& output)
+            {
+                AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+                AZ::u64 fileSize = 0;
+                if (filePath.empty() || !fileIO->Size(filePath.c_str(), fileSize) || fileSize == 0)
+                {
+                    return false;
+                }
+
+                AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+                if (!fileIO->Open(filePath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, fileHandle))
+                {
+                    return false;
+                }
+
+                output.resize_no_construct(static_cast<size_t>(fileSize));
+                const bool isRead = fileIO->Read(fileHandle, output.data(), fileSize, true);
+                fileIO->Close(fileHandle);
+
+                if (!isRead)
+                {
+                    output.clear();
+                }
+                return isRead;
+            }
+
+            static void Write(const AZStd::string& filePath, const AZStd::vector<AZ::u8>& cookedData)
+            {
+                if (filePath.empty() || !SceneUtil::FileUtilities::EnsureTargetFolderExists(filePath))
+                {
+                    return;
+                }
+
+                // write to a temporary file first, so a builder running in parallel never reads a partial entry
+                AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+                const AZStd::string tempFilePath = AZStd::string::format("%s.%s.tmp", filePath.c_str(), AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str());
+                AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+                if (!fileIO->Open(tempFilePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary, fileHandle))
+                {
+                    return;
+                }
+
+                const bool isWritten = fileIO->Write(fileHandle, cookedData.data(), cookedData.size());
+                fileIO->Close(fileHandle);
+
+                if (!isWritten || !fileIO->Rename(tempFilePath.c_str(), filePath.c_str()))
+                {
+                    fileIO->Remove(tempFilePath.c_str());
+                }
+            }
+        }
+
+        /// Cooks the mesh, unless the same mesh was cooked with the same settings before and is in the cooking cache.
+        static bool CookPhysxTriangleMeshCached(
+            const AZStd::vector<Vec3>& vertices,
+            const AZStd::vector<AZ::u32>& indices,
+            const AZStd::vector<AZ::u16>& faceMaterials,
+            AZStd::vector<AZ::u8>* output,
+            const MeshGroup& meshGroup)
+        {
+            const AZStd::string cacheFilePath = CookingCache::GetFilePath(CookingCache::CreateKey(vertices, indices, faceMaterials, meshGroup));
+
+            AZStd::vector<AZ::u8> cachedData;
+            const bool isCachedDataValid = CookingCache::Read(cacheFilePath, cachedData)
+                && (meshGroup.GetExportAsConvex()
+                    ? Utils::ValidateCookedConvexMesh(cachedData.data(), static_cast<AZ::u32>(cachedData.size()))
+                    : Utils::ValidateCookedTriangleMesh(cachedData.data(), static_cast<AZ::u32>(cachedData.size())));
+            if (isCachedDataValid)
+            {
+                output->insert(output->end(), cachedData.begin(), cachedData.end());
+                return true;
+            }
+
+            AZStd::vector<AZ::u8> cookedData;
+            if (!CookPhysxTriangleMesh(vertices, indices, faceMaterials, &cookedData, meshGroup))
+            {
+                return false;
+            }
+
+            CookingCache::Write(cacheFilePath, cookedData);
+            output->insert(output->end(), cookedData.begin(), cookedData.end());
+            return true;
+        }
+
         static AZ::SceneAPI::Events::ProcessingResult WritePhysx(
             AZ::SceneAPI::Events::ExportEventContext& context,
             const AZStd::vector<AZ::u8>& cookedMeshData,
@@ -429,12 +591,23 @@ namespace PhysX
             SceneContainers::SceneManifest::ValueStorageConstData valueStorage = manifest.GetValueStorage();
             auto view = SceneContainers::MakeExactFilterView<MeshGroup>(valueStorage);
 
+            struct MeshGroupCookingData
+            {
+                const MeshGroup* m_meshGroup = nullptr;
+                AZStd::vector<Vec3> m_vertices;
+                AZStd::vector<vtx_idx> m_indices;
+                AZStd::vector<AZ::u16> m_faceMaterialIndices;
+                AZStd::vector<Physics::MaterialConfiguration> m_materialConfigurations;
+                AZStd::vector<AZ::u8> m_physxData;
+                bool m_isCooked = false;
+            };
+
+            AZStd::vector<MeshGroupCookingData> cookingGroups;
+
             for (const MeshGroup& pxMeshGroup : view)
             {
-                AZStd::vector<Vec3> accumulatedVertices;
-                AZStd::vector<vtx_idx> accumulatedIndices;
-                AZStd::vector<AZ::u16> accumulatedFaceMaterialIndicies;
-                AZStd::vector<Physics::MaterialConfiguration> accumulatedMaterialConfigurations;
+                MeshGroupCookingData cookingGroup;
+                cookingGroup.m_meshGroup = &pxMeshGroup;
 
                 AZStd::string groupName = pxMeshGroup.GetName();
 
@@ -458,28 +631,67 @@ namespace PhysX
                             nodeMesh,
                             worldTransform,
                             localFbxMaterialsList,
-                            accumulatedVertices,
-                            accumulatedIndices,
-                            accumulatedFaceMaterialIndicies,
-                            accumulatedMaterialConfigurations
+                            cookingGroup.m_vertices,
+                            cookingGroup.m_indices,
+                            cookingGroup.m_faceMaterialIndices,
+                            cookingGroup.m_materialConfigurations
                         );
                     }
                 }
 
-                if (accumulatedVertices.size())
+                if (cookingGroup.m_vertices.size())
                 {
-                    AZStd::vector<AZ::u8> physxData;
-                    bool success = CookPhysxTriangleMesh(accumulatedVertices, accumulatedIndices, accumulatedFaceMaterialIndicies, &physxData, pxMeshGroup);
-                    if (success)
-                    {
-                        result += WritePxmesh(context, physxData, accumulatedMaterialConfigurations, pxMeshGroup);
-                        result += WritePhysx(context, physxData, accumulatedMaterialConfigurations, pxMeshGroup);
-                    }
-                    else
+                    cookingGroups.emplace_back(AZStd::move(cookingGroup));
+                }
+            }
+
+            // Cooking is independent per group, so the groups are cooked in parallel when there are worker threads for it
+            auto cookGroup = [](MeshGroupCookingData& cookingGroup)
+            {
+                AZ_TraceContext("Group Name", cookingGroup.m_meshGroup->GetName());
+                cookingGroup.m_isCooked = CookPhysxTriangleMeshCached(cookingGroup.m_vertices, cookingGroup.m_indices,
+                    cookingGroup.m_faceMaterialIndices, &cookingGroup.m_physxData, *cookingGroup.m_meshGroup);
+            };
+
+            AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+            if (jobContext && cookingGroups.size() > 1 && jobContext->GetJobManager().GetNumWorkerThreads() > 1)
+            {
+                AZ::JobCompletion jobCompletion;
+                for (MeshGroupCookingData& cookingGroup : cookingGroups)
+                {
+                    AZ::Job* job = AZ::CreateJobFunction([&cookGroup, &cookingGroup]()
                     {
-                        result = SceneEvents::ProcessingResult::Failure;
-                        AZ_TracePrintf(AZ::SceneAPI::Utilities::ErrorWindow, "PhysX Mesh group didn't have any vertices to cook");
-                    }
+                        cookGroup(cookingGroup);
+                    }, true, jobContext);
+
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+
+                jobCompletion.StartAndWaitForCompletion();
+            }
+            else
+            {
+                for (MeshGroupCookingData& cookingGroup : cookingGroups)
+                {
+                    cookGroup(cookingGroup);
+                }
+            }
+
+            // Products are written in manifest order
+            for (const MeshGroupCookingData& cookingGroup : cookingGroups)
+            {
+                AZ_TraceContext("Group Name", cookingGroup.m_meshGroup->GetName());
+
+                if (cookingGroup.m_isCooked)
+                {
+                    result += WritePxmesh(context, cookingGroup.m_physxData, cookingGroup.m_materialConfigurations, *cookingGroup.m_meshGroup);
+                    result += WritePhysx(context, cookingGroup.m_physxData, cookingGroup.m_materialConfigurations, *cookingGroup.m_meshGroup);
+                }
+                else
+                {
+                    result = SceneEvents::ProcessingResult::Failure;
+                    AZ_TracePrintf(AZ::SceneAPI::Utilities::ErrorWindow, "PhysX Mesh group didn't have any vertices to cook");
                 }
             }
 
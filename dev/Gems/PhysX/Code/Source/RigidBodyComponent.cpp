@@ -209,8 +209,6 @@ namespace PhysX
                 AZ::Transform transform = m_rigidBody->GetTransform();
 
                 // Maintain scale (this must be precise).
-                AZ::Transform entityTransform = AZ::Transform::Identity();
-                AZ::TransformBus::EventResult(entityTransform, GetEntityId(), &AZ::TransformInterface::GetWorldTM);
                 transform.MultiplyByScale(m_initialScale);
 
                 AZ::TransformBus::Event(GetEntityId(), &AZ::TransformInterface::SetWorldTM, transform);
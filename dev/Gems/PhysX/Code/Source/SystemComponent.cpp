@@ -91,7 +91,7 @@ namespace PhysX
             ;
 
             serialize->Class<Settings>()
-                ->Version(2, &VersionConverter)
+                ->Version(3, &VersionConverter)
                 ->Field("PvdHost", &Settings::m_pvdHost)
                 ->Field("PvdPort", &Settings::m_pvdPort)
                 ->Field("PvdTimeout", &Settings::m_pvdTimeoutInMilliseconds)
@@ -100,6 +100,7 @@ namespace PhysX
                 ->Field("PvdAutoConnectMode", &Settings::m_pvdAutoConnectMode)
                 ->Field("PvdReconnect", &Settings::m_pvdReconnect)
                 ->Field("ColliderProximityVisualization", &Settings::m_colliderProximityVisualization)
+                ->Field("TaskAffinityDomain", &Settings::m_taskAffinityDomain)
             ;
 
             serialize->Class<EditorConfiguration>()
@@ -682,6 +683,7 @@ namespace PhysX
         bool loaded = AZ::Utils::LoadObjectFromFileInPlace<Configuration>(fullPath.c_str(), m_configuration);
         if (loaded)
         {
+            ApplyDispatcherSettings();
             PhysX::ConfigurationNotificationBus::Broadcast(&PhysX::ConfigurationNotificationBus::Events::OnConfigurationLoaded);
         }
         else
@@ -690,6 +692,14 @@ namespace PhysX
         }
     }
 
+    void SystemComponent::ApplyDispatcherSettings()
+    {
+        if (m_cpuDispatcher)
+        {
+            m_cpuDispatcher->SetTaskAffinityDomain(m_configuration.m_settings.m_taskAffinityDomain);
+        }
+    }
+
     void SystemComponent::SaveConfiguration()
     {
         // Save configuration to source folder when in edit mode.
@@ -780,6 +790,7 @@ namespace PhysX
             m_configuration.m_worldConfiguration.m_gravity != configuration.m_worldConfiguration.m_gravity;
 
         m_configuration = configuration;
+        ApplyDispatcherSettings();
 
         if (gravityChanged)
         {
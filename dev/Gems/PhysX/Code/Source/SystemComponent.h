@@ -239,6 +239,7 @@ namespace PhysX
         Configuration CreateDefaultConfiguration() const;
         void LoadConfiguration();
         void SaveConfiguration();
+        void ApplyDispatcherSettings();
         void CheckoutConfiguration();
 
         // Assets related data
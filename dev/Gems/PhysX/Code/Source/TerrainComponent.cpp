@@ -16,12 +16,17 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 
 #include <AzFramework/Physics/Utils.h>
 #include <AzFramework/Physics/Material.h>
 #include <AzFramework/Physics/World.h>
 
 #include <PhysX/ConfigurationBus.h>
+#include <PhysX/SystemComponentBus.h>
 
 #include <Source/RigidBodyStatic.h>
 #include <Source/Utils.h>
@@ -36,13 +41,14 @@ namespace PhysX
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<TerrainConfiguration>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("CollisionLayer", &TerrainConfiguration::m_collisionLayer)
                 ->Field("CollisionGroup", &TerrainConfiguration::m_collisionGroup)
                 ->Field("MaterialMapping", &TerrainConfiguration::m_terrainSurfaceIdIndexMapping)
                 ->Field("Scale", &TerrainConfiguration::m_scale)
                 ->Field("HeightField", &TerrainConfiguration::m_heightFieldAsset)
                 ->Field("TerrainMaterials", &TerrainConfiguration::m_terrainMaterialsToSurfaceIds)
+                ->Field("TileSize", &TerrainConfiguration::m_tileSize)
                 ;
 
             if (auto editContext = serializeContext->GetEditContext())
@@ -54,6 +60,9 @@ namespace PhysX
                     ->DataElement(AZ::Edit::UIHandlers::Default, &TerrainConfiguration::m_collisionGroup, "Collision Group", "Collision group assigned to the terrain")
                     ->DataElement(AZ::Edit::UIHandlers::Default, &TerrainConfiguration::m_heightFieldAsset, "HeightField Asset", "Height field asset")
                     ->Attribute(AZ::Edit::Attributes::ReadOnly, true)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &TerrainConfiguration::m_tileSize, "Tile Size",
+                        "Number of heightfield cells along each side of a collision tile. "
+                        "Separate tiles outside the active regions of the world can hibernate. 0 uses a single heightfield.")
                     ;
             }
         }
@@ -114,12 +123,18 @@ namespace PhysX
 
     float TerrainComponent::GetHeight(float x, float y)
     {
-        auto physxGenericShape = static_cast<PhysX::Shape*>(m_terrainTiles[0]->GetShape(0).get());
+        const float row = x / m_configuration.m_scale.GetX();
+        const float column = y / m_configuration.m_scale.GetY();
+        const AZ::u32 tileIndex = GetTileIndex(row, column);
+        const float tileRowOffset = static_cast<float>((tileIndex / m_tileColumnCount) * m_configuration.m_tileSize);
+        const float tileColumnOffset = static_cast<float>((tileIndex % m_tileColumnCount) * m_configuration.m_tileSize);
+
+        auto physxGenericShape = static_cast<PhysX::Shape*>(m_terrainTiles[tileIndex]->GetShape(0).get());
         physx::PxShape* pxShape = physxGenericShape->GetPxShape();
         physx::PxHeightFieldGeometry geometry;
         if (pxShape->getHeightFieldGeometry(geometry))
         {
-            return geometry.heightField->getHeight(x / m_configuration.m_scale.GetX(), y / m_configuration.m_scale.GetY()) * m_configuration.m_scale.GetZ();
+            return geometry.heightField->getHeight(row - tileRowOffset, column - tileColumnOffset) * m_configuration.m_scale.GetZ();
         }
         else
         {
@@ -132,24 +147,186 @@ namespace PhysX
     {
         if (!m_terrainTiles.empty())
         {
-            return m_terrainTiles[0].get();
+            // heightfield rows run along the world y axis and columns along x, see the shape pose in Utils::CreateTerrainTile
+            return m_terrainTiles[GetTileIndex(y / m_configuration.m_scale.GetX(), x / m_configuration.m_scale.GetY())].get();
         }
         return nullptr;
     }
 
+    AZ::u32 TerrainComponent::GetTileIndex(float row, float column) const
+    {
+        if (m_tileRowCount * m_tileColumnCount <= 1)
+        {
+            return 0;
+        }
+
+        const float tileSize = static_cast<float>(m_configuration.m_tileSize);
+        const AZ::u32 tileRow = static_cast<AZ::u32>(AZ::GetClamp(row / tileSize, 0.0f, static_cast<float>(m_tileRowCount - 1)));
+        const AZ::u32 tileColumn = static_cast<AZ::u32>(AZ::GetClamp(column / tileSize, 0.0f, static_cast<float>(m_tileColumnCount - 1)));
+        return tileRow * m_tileColumnCount + tileColumn;
+    }
+
+    AZStd::vector<physx::PxHeightField*> TerrainComponent::CreateHeightFieldTiles(const physx::PxHeightField& heightField)
+    {
+        AZStd::vector<physx::PxHeightField*> tiles;
+
+        const AZ::u32 tileSize = m_configuration.m_tileSize;
+        const AZ::u32 numRows = heightField.getNbRows();
+        const AZ::u32 numColumns = heightField.getNbColumns();
+        if (tileSize == 0 || numRows < 2 || numColumns < 2 || (numRows - 1 <= tileSize && numColumns - 1 <= tileSize))
+        {
+            return tiles;
+        }
+
+        physx::PxCooking* cooking = nullptr;
+        SystemRequestsBus::BroadcastResult(cooking, &SystemRequests::GetCooking);
+        if (!cooking)
+        {
+            return tiles;
+        }
+
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        AZStd::vector<physx::PxHeightFieldSample> samples(numRows * numColumns);
+        heightField.saveCells(samples.data(), static_cast<physx::PxU32>(samples.size() * sizeof(physx::PxHeightFieldSample)));
+
+        const AZ::u32 tileRowCount = (numRows - 2) / tileSize + 1;
+        const AZ::u32 tileColumnCount = (numColumns - 2) / tileSize + 1;
+        tiles.resize(tileRowCount * tileColumnCount, nullptr);
+
+        // neighbouring tiles share their border samples so the tiled surface stays seamless
+        auto createTile = [&](AZ::u32 tileIndex)
+        {
+            const AZ::u32 rowBegin = (tileIndex / tileColumnCount) * tileSize;
+            const AZ::u32 columnBegin = (tileIndex % tileColumnCount) * tileSize;
+            const AZ::u32 tileRows = AZ::GetMin(rowBegin + tileSize, numRows - 1) - rowBegin + 1;
+            const AZ::u32 tileColumns = AZ::GetMin(columnBegin + tileSize, numColumns - 1) - columnBegin + 1;
+
+            AZStd::vector<physx::PxHeightFieldSample> tileSamples;
+            tileSamples.reserve(tileRows * tileColumns);
+            for (AZ::u32 row = rowBegin; row < rowBegin + tileRows; ++row)
+            {
+                const physx::PxHeightFieldSample* rowSamples = samples.data() + row * numColumns + columnBegin;
+                tileSamples.insert(tileSamples.end(), rowSamples, rowSamples + tileColumns);
+            }
+
+            physx::PxHeightFieldDesc tileDesc;
+            tileDesc.format = heightField.getFormat();
+            tileDesc.nbRows = tileRows;
+            tileDesc.nbColumns = tileColumns;
+            tileDesc.convexEdgeThreshold = heightField.getConvexEdgeThreshold();
+            tileDesc.flags = heightField.getFlags();
+            tileDesc.samples.data = tileSamples.data();
+            tileDesc.samples.stride = sizeof(physx::PxHeightFieldSample);
+
+            tiles[tileIndex] = cooking->createHeightField(tileDesc, PxGetPhysics().getPhysicsInsertionCallback());
+        };
+
+        // tiles are independent, build them on the job threads when there are any
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (jobContext && jobContext->GetJobManager().GetNumWorkerThreads() > 1)
+        {
+            AZ::JobCompletion jobCompletion;
+            for (AZ::u32 tileIndex = 0; tileIndex < tiles.size(); ++tileIndex)
+            {
+                AZ::Job* job = AZ::CreateJobFunction([&createTile, tileIndex]()
+                {
+                    createTile(tileIndex);
+                }, true, jobContext);
+
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (AZ::u32 tileIndex = 0; tileIndex < tiles.size(); ++tileIndex)
+            {
+                createTile(tileIndex);
+            }
+        }
+
+        if (AZStd::find(tiles.begin(), tiles.end(), nullptr) != tiles.end())
+        {
+            AZ_Warning("TerrainComponent", false, "Failed to split the heightfield into tiles, using a single heightfield.");
+            for (physx::PxHeightField* tile : tiles)
+            {
+                if (tile)
+                {
+                    tile->release();
+                }
+            }
+            tiles.clear();
+            return tiles;
+        }
+
+        m_tileRowCount = tileRowCount;
+        m_tileColumnCount = tileColumnCount;
+        return tiles;
+    }
+
     void TerrainComponent::LoadTerrain()
     {
-        // Add to all physics worlds
-        Physics::WorldRequestBus::EnumerateHandlers([this](Physics::World* world)
+        m_tileRowCount = 1;
+        m_tileColumnCount = 1;
+
+        AZStd::vector<physx::PxHeightField*> tileHeightFields;
+        if (m_configuration.m_tileSize > 0 && m_configuration.m_heightFieldAsset.IsReady())
         {
-            // Create terrain actor and add to the world
-            AZStd::unique_ptr<Physics::RigidBodyStatic> terrainTile = Utils::CreateTerrain(m_configuration, GetEntityId(), GetEntity()->GetName().c_str());
-            if (terrainTile)
+            if (physx::PxHeightField* heightField = m_configuration.m_heightFieldAsset.Get()->GetHeightField())
             {
-                world->AddBody(*terrainTile);
-                m_terrainTiles.push_back(AZStd::move(terrainTile));
+                tileHeightFields = CreateHeightFieldTiles(*heightField);
+            }
+        }
+
+        if (tileHeightFields.empty())
+        {
+            // Add to all physics worlds
+            Physics::WorldRequestBus::EnumerateHandlers([this](Physics::World* world)
+            {
+                // Create terrain actor and add to the world
+                AZStd::unique_ptr<Physics::RigidBodyStatic> terrainTile = Utils::CreateTerrain(m_configuration, GetEntityId(), GetEntity()->GetName().c_str());
+                if (terrainTile)
+                {
+                    world->AddBody(*terrainTile);
+                    m_terrainTiles.push_back(AZStd::move(terrainTile));
+                }
+                return true;
+            });
+            return;
+        }
+
+        const float tileWidth = m_configuration.m_scale.GetY() * m_configuration.m_tileSize;
+        const float tileLength = m_configuration.m_scale.GetX() * m_configuration.m_tileSize;
+
+        // Add all tiles to all physics worlds
+        Physics::WorldRequestBus::EnumerateHandlers([this, &tileHeightFields, tileWidth, tileLength](Physics::World* world)
+        {
+            for (AZ::u32 tileIndex = 0; tileIndex < tileHeightFields.size(); ++tileIndex)
+            {
+                // heightfield rows run along the world y axis and columns along x
+                const AZ::Vector3 tilePosition(
+                    tileWidth * static_cast<float>(tileIndex % m_tileColumnCount),
+                    tileLength * static_cast<float>(tileIndex / m_tileColumnCount),
+                    0.0f);
+
+                AZStd::unique_ptr<Physics::RigidBodyStatic> terrainTile = Utils::CreateTerrainTile(
+                    m_configuration, tileHeightFields[tileIndex], tilePosition, GetEntityId(), GetEntity()->GetName().c_str());
+                if (terrainTile)
+                {
+                    world->AddBody(*terrainTile);
+                    m_terrainTiles.push_back(AZStd::move(terrainTile));
+                }
             }
             return true;
         });
+
+        // the tile shapes hold their own references to the heightfields
+        for (physx::PxHeightField* tileHeightField : tileHeightFields)
+        {
+            tileHeightField->release();
+        }
     }
-}
\ No newline at end of file
+}
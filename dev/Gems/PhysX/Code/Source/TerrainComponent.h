@@ -19,6 +19,11 @@
 #include <PhysX/ComponentTypeIds.h>
 #include <PhysX/HeightFieldAsset.h>
 
+namespace physx
+{
+    class PxHeightField;
+}
+
 namespace PhysX
 {
     class Shape;
@@ -37,6 +42,7 @@ namespace PhysX
         AZ::Data::Asset<Pipeline::HeightFieldAsset> m_heightFieldAsset;
         Physics::TerrainMaterialSurfaceIdMap m_terrainMaterialsToSurfaceIds; ///< Lookup table mapping from
                                                                              ///< surface ids to terrain materials.
+        AZ::u32 m_tileSize = 0; ///< Heightfield cells along each side of a collision tile, 0 to use a single heightfield.
     };
 
     class TerrainComponent
@@ -67,8 +73,14 @@ namespace PhysX
 
     private:
         void LoadTerrain();
+        /// Splits the heightfield into tiles of m_tileSize cells, returns an empty list if the heightfield fits in one tile.
+        AZStd::vector<physx::PxHeightField*> CreateHeightFieldTiles(const physx::PxHeightField& heightField);
+        /// Returns the index of the tile containing the given heightfield sample coordinates.
+        AZ::u32 GetTileIndex(float row, float column) const;
 
-        AZStd::vector<AZStd::unique_ptr<Physics::RigidBodyStatic>> m_terrainTiles; ///< Terrain tile bodies.
+        AZStd::vector<AZStd::unique_ptr<Physics::RigidBodyStatic>> m_terrainTiles; ///< Terrain tile bodies, row major per world.
         TerrainConfiguration m_configuration; ///< Terrain configuration.
+        AZ::u32 m_tileRowCount = 1; ///< Number of tiles along the heightfield rows.
+        AZ::u32 m_tileColumnCount = 1; ///< Number of tiles along the heightfield columns.
     };
 }
\ No newline at end of file
@@ -354,6 +354,15 @@ namespace PhysX
                 return nullptr;
             }
 
+            return CreateTerrainTile(configuration, heightField, AZ::Vector3::CreateZero(), entityId, name);
+        }
+
+        AZStd::unique_ptr<Physics::RigidBodyStatic> CreateTerrainTile(
+            const PhysX::TerrainConfiguration& configuration, physx::PxHeightField* heightField, const AZ::Vector3& position,
+            const AZ::EntityId& entityId, const AZStd::string_view& name)
+        {
+            using namespace physx;
+
             // Get terrain materials
             AZStd::vector<physx::PxMaterial*> materialList;
             GetMaterialList(materialList, configuration.m_terrainSurfaceIdIndexMapping, configuration.m_terrainMaterialsToSurfaceIds);
@@ -389,7 +398,7 @@ namespace PhysX
             heightFieldShape->SetName(name.data());
 
             Physics::WorldBodyConfiguration staticRigidBodyConfiguration;
-            staticRigidBodyConfiguration.m_position = AZ::Vector3::CreateZero();
+            staticRigidBodyConfiguration.m_position = position;
             staticRigidBodyConfiguration.m_entityId = entityId;
             staticRigidBodyConfiguration.m_debugName = name;
 
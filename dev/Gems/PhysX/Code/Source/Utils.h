@@ -72,6 +72,11 @@ namespace PhysX
         AZStd::unique_ptr<Physics::RigidBodyStatic> CreateTerrain(
             const PhysX::TerrainConfiguration& terrainConfiguration, const AZ::EntityId& entityId, const AZStd::string_view& name);
 
+        /// Creates a terrain body for a heightfield covering part of the terrain, placed at the given position.
+        AZStd::unique_ptr<Physics::RigidBodyStatic> CreateTerrainTile(
+            const PhysX::TerrainConfiguration& terrainConfiguration, physx::PxHeightField* heightField, const AZ::Vector3& position,
+            const AZ::EntityId& entityId, const AZStd::string_view& name);
+
         
         void GetMaterialList(
             AZStd::vector<physx::PxMaterial*>& pxMaterials, const AZStd::vector<int>& materialIndexMapping,
@@ -80,6 +80,7 @@ namespace PhysX
         : m_worldId(id)
         , m_maxDeltaTime(settings.m_maxTimeStep)
         , m_fixedDeltaTime(settings.m_fixedTimeStep)
+        , m_asyncSimulation(settings.m_asyncSimulation)
     {
         m_raycastBuffer.resize(static_cast<size_t>(settings.m_raycastBufferSize));
         m_sweepBuffer.resize(static_cast<size_t>(settings.m_sweepBufferSize));
@@ -144,6 +145,11 @@ namespace PhysX
         Physics::SystemNotificationBus::Broadcast(&Physics::SystemNotificationBus::Events::OnPreWorldDestroy, this);
         if (m_world)
         {
+            if (m_simulationInFlight)
+            {
+                m_world->fetchResults(true);
+                m_simulationInFlight = false;
+            }
             m_world->release();
             m_world = nullptr;
         }
@@ -354,6 +360,149 @@ namespace PhysX
         return hits;
     }
 
+    void World::RayCastBatch(const Physics::RayCastRequest* requests, AZ::u32 numRequests, Physics::RayCastHit* outHits)
+    {
+        const physx::PxHitFlags outputFlags = physx::PxHitFlag::eDEFAULT | physx::PxHitFlag::eMESH_BOTH_SIDES;
+
+        // Only the closest hit is needed per ray, so a single stack result is reused for every request and no
+        // hit containers are allocated for the batch.
+        physx::PxRaycastBuffer castResult;
+        for (AZ::u32 i = 0; i < numRequests; ++i)
+        {
+            const Physics::RayCastRequest& request = requests[i];
+            const physx::PxQueryFilterData queryData(GetPxQueryFlags(request.m_queryType));
+            PhysXQueryFilterCallback queryFilterCallback(request.m_collisionGroup, request.m_customFilterCallback, physx::PxQueryHitType::eBLOCK);
+
+            const bool status = m_world->raycast(PxMathConvert(request.m_start), PxMathConvert(request.m_direction), request.m_distance,
+                castResult, outputFlags, queryData, &queryFilterCallback);
+            outHits[i] = status ? GetHitFromPxHit(castResult.block) : Physics::RayCastHit();
+        }
+    }
+
+    AZ::u32 World::OverlapBatch(const Physics::OverlapRequest* requests, AZ::u32 numRequests, Physics::OverlapHit* outHits,
+        AZ::u32 maxHits, AZ::u32* outHitCounts)
+    {
+        AZ::u32 numHits = 0;
+        physx::PxOverlapBuffer queryHits(m_overlapBuffer.begin(), (physx::PxU32)m_overlapBuffer.size());
+        for (AZ::u32 i = 0; i < numRequests; ++i)
+        {
+            const Physics::OverlapRequest& request = requests[i];
+            outHitCounts[i] = 0;
+
+            const physx::PxTransform pose = PxMathConvert(request.m_pose);
+            physx::PxGeometryHolder pxGeometry;
+            Utils::CreatePxGeometryFromConfig(*request.m_shapeConfiguration, pxGeometry);
+
+            const physx::PxQueryFilterData defaultFilterData(GetPxQueryFlags(request.m_queryType));
+            PhysXQueryFilterCallback filterCallback(request.m_collisionGroup, request.m_customFilterCallback, physx::PxQueryHitType::eTOUCH);
+
+            if (!m_world->overlap(pxGeometry.any(), pose, queryHits, defaultFilterData, &filterCallback))
+            {
+                continue;
+            }
+
+            // Convert the results straight into the caller's buffer
+            const AZ::u32 hitNum = queryHits.getNbAnyHits();
+            for (AZ::u32 hitIndex = 0; hitIndex < hitNum && numHits < maxHits; ++hitIndex)
+            {
+                const physx::PxOverlapHit& hit = queryHits.getAnyHit(hitIndex);
+                if (auto userData = Utils::GetUserData(hit.actor))
+                {
+                    Physics::OverlapHit& resultHit = outHits[numHits++];
+                    resultHit.m_body = userData->GetWorldBody();
+                    resultHit.m_shape = static_cast<PhysX::Shape*>(hit.shape->userData);
+                    outHitCounts[i]++;
+                }
+            }
+        }
+        return numHits;
+    }
+
+    void World::SetActiveRegions(const AZStd::vector<AZ::Aabb>& regions)
+    {
+        m_activeRegions = regions;
+        m_activeRegionsChanged = true;
+    }
+
+    AZ::u32 World::GetNumHibernatingBodies() const
+    {
+        return static_cast<AZ::u32>(m_hibernatingActors.size());
+    }
+
+    void World::UpdateHibernation()
+    {
+        if (!m_activeRegionsChanged)
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+        m_activeRegionsChanged = false;
+
+        const physx::PxActorTypeFlags actorTypes = physx::PxActorTypeFlag::eRIGID_STATIC | physx::PxActorTypeFlag::eRIGID_DYNAMIC;
+        const physx::PxU32 numActors = m_world->getNbActors(actorTypes);
+        m_hibernationActorBuffer.resize(numActors);
+        m_world->getActors(actorTypes, m_hibernationActorBuffer.data(), numActors);
+
+        // Only actors still in the scene are carried over, so actors released while hibernating drop out of the set.
+        AZStd::unordered_set<physx::PxActor*> hibernatingActors;
+        for (physx::PxActor* actor : m_hibernationActorBuffer)
+        {
+            bool isInActiveRegion = m_activeRegions.empty();
+            if (!isInActiveRegion)
+            {
+                const AZ::Aabb bounds = PxMathConvert(actor->getWorldBounds());
+                for (const AZ::Aabb& region : m_activeRegions)
+                {
+                    if (region.Overlaps(bounds))
+                    {
+                        isInActiveRegion = true;
+                        break;
+                    }
+                }
+            }
+
+            const bool isHibernating = m_hibernatingActors.find(actor) != m_hibernatingActors.end();
+            if (isHibernating)
+            {
+                if (isInActiveRegion)
+                {
+                    actor->setActorFlag(physx::PxActorFlag::eDISABLE_SIMULATION, false);
+
+                    // Dynamic actors only hibernate while sleeping, wake them up in the same state.
+                    if (physx::PxRigidDynamic* rigidDynamic = actor->is<physx::PxRigidDynamic>())
+                    {
+                        rigidDynamic->putToSleep();
+                    }
+                }
+                else
+                {
+                    hibernatingActors.insert(actor);
+                }
+                continue;
+            }
+
+            // Actors with simulation disabled by their owner are left alone.
+            if (isInActiveRegion || (actor->getActorFlags() & physx::PxActorFlag::eDISABLE_SIMULATION))
+            {
+                continue;
+            }
+
+            if (physx::PxRigidDynamic* rigidDynamic = actor->is<physx::PxRigidDynamic>())
+            {
+                if (!rigidDynamic->isSleeping() || (rigidDynamic->getRigidBodyFlags() & physx::PxRigidBodyFlag::eKINEMATIC))
+                {
+                    continue;
+                }
+            }
+
+            actor->setActorFlag(physx::PxActorFlag::eDISABLE_SIMULATION, true);
+            hibernatingActors.insert(actor);
+        }
+
+        m_hibernatingActors.swap(hibernatingActors);
+    }
+
     physx::PxActor* GetPxActor(const Physics::WorldBody& worldBody)
     {
         if (worldBody.GetNativeType() != NativeTypeIdentifiers::RigidBody &&
@@ -425,13 +574,8 @@ namespace PhysX
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
 
-        auto simulateFetch = [this](float simDeltaTime, std::function<void(void * activeAct)> activeActorsLambda)
+        auto fetchResults = [this](std::function<void(void * activeAct)> activeActorsLambda)
         {
-            {
-                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "World::SimulateFetchResults");
-                m_world->simulate(simDeltaTime);
-                m_world->fetchResults(true);
-            }
             AzFramework::PhysicsComponentNotificationBus::ExecuteQueuedEvents();
 
             if (m_world->getFlags() & physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS)
@@ -449,6 +593,43 @@ namespace PhysX
             }
         };
 
+        auto simulateFetch = [this, &fetchResults](float simDeltaTime, std::function<void(void * activeAct)> activeActorsLambda)
+        {
+            {
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "World::SimulateFetchResults");
+                m_world->simulate(simDeltaTime);
+                m_world->fetchResults(true);
+            }
+            fetchResults(activeActorsLambda);
+        };
+
+        auto simulateAsync = [this](float simDeltaTime)
+        {
+            AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "World::Simulate");
+            m_world->simulate(simDeltaTime);
+            m_simulationInFlight = true;
+            m_inFlightDeltaTime = simDeltaTime;
+        };
+
+        // Complete the step left running by the previous update before anything else is simulated.
+        if (m_simulationInFlight)
+        {
+            {
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "World::FetchResults");
+                m_world->fetchResults(true);
+            }
+            m_simulationInFlight = false;
+            fetchResults(m_simFunc);
+
+            if (m_fixedDeltaTime != 0.0f)
+            {
+                Physics::SystemNotificationBus::Broadcast(&Physics::SystemNotificationBus::Events::OnPostPhysicsUpdate, m_inFlightDeltaTime, this);
+            }
+            m_deferredDeletions.clear();
+        }
+
+        UpdateHibernation();
+
         deltaTime = AZ::GetClamp(deltaTime, 0.0f, m_maxDeltaTime);
 
         if (m_fixedDeltaTime != 0.0f)
@@ -459,18 +640,34 @@ namespace PhysX
             {
                 Physics::SystemNotificationBus::Broadcast(&Physics::SystemNotificationBus::Events::OnPrePhysicsUpdate, m_fixedDeltaTime, this);
 
-                simulateFetch(m_fixedDeltaTime, m_simFunc);
                 m_accumulatedTime -= m_fixedDeltaTime;
 
+                // Only the last step of this update can overlap the frame, earlier steps have to complete in place.
+                if (m_asyncSimulation && m_accumulatedTime < m_fixedDeltaTime)
+                {
+                    simulateAsync(m_fixedDeltaTime);
+                    break;
+                }
+
+                simulateFetch(m_fixedDeltaTime, m_simFunc);
+
                 Physics::SystemNotificationBus::Broadcast(&Physics::SystemNotificationBus::Events::OnPostPhysicsUpdate, m_fixedDeltaTime, this);
             }
         }
+        else if (m_asyncSimulation)
+        {
+            simulateAsync(deltaTime);
+        }
         else
         {
             simulateFetch(deltaTime, m_simFunc);
         }
 
-        m_deferredDeletions.clear();
+        // Bodies may still be referenced by a running simulation, they are released once its results are fetched.
+        if (!m_simulationInFlight)
+        {
+            m_deferredDeletions.clear();
+        }
     }
 
     AZ::Crc32 World::GetNativeType() const
@@ -43,6 +43,9 @@ namespace PhysX
         AZStd::vector<Physics::RayCastHit> RayCastMultiple(const Physics::RayCastRequest& request);
         AZStd::vector<Physics::RayCastHit> ShapeCastMultiple(const Physics::ShapeCastRequest& request) override;
         AZStd::vector<Physics::OverlapHit> Overlap(const Physics::OverlapRequest& request) override;
+        void RayCastBatch(const Physics::RayCastRequest* requests, AZ::u32 numRequests, Physics::RayCastHit* outHits) override;
+        AZ::u32 OverlapBatch(const Physics::OverlapRequest* requests, AZ::u32 numRequests, Physics::OverlapHit* outHits,
+            AZ::u32 maxHits, AZ::u32* outHitCounts) override;
         void RegisterSuppressedCollision(const Physics::WorldBody& body0,
             const Physics::WorldBody& body1) override;
         void UnregisterSuppressedCollision(const Physics::WorldBody& body0,
@@ -53,6 +56,8 @@ namespace PhysX
         AZ::Crc32 GetNativeType() const override;
         void* GetNativePointer() const override;
         void SetEventHandler(Physics::WorldEventHandler* eventHandler) override;
+        void SetActiveRegions(const AZStd::vector<AZ::Aabb>& regions) override;
+        AZ::u32 GetNumHibernatingBodies() const override;
 
         // physx::PxSimulationFilterCallback
         physx::PxFilterFlags pairFound(physx::PxU32 pairId, physx::PxFilterObjectAttributes attributes0,
@@ -82,6 +87,7 @@ namespace PhysX
     private:
         using ActorPair = AZStd::pair<const physx::PxActor*, const physx::PxActor*>;
         AZStd::unordered_set<ActorPair>::iterator FindSuppressedPair(const physx::PxActor* actor0, const physx::PxActor* actor1);
+        void UpdateHibernation();
 
         physx::PxScene* m_world = nullptr;
         AZ::Crc32 m_worldId;
@@ -92,9 +98,17 @@ namespace PhysX
 
         AZStd::unordered_set<ActorPair> m_suppressedCollisionPairs; ///< Actor pairs with collision suppressed.
 
+        AZStd::vector<AZ::Aabb> m_activeRegions; ///< Regions outside of which static and sleeping actors hibernate.
+        AZStd::unordered_set<physx::PxActor*> m_hibernatingActors; ///< Actors whose simulation was disabled by hibernation.
+        AZStd::vector<physx::PxActor*> m_hibernationActorBuffer; ///< Scratch buffer for the scene actors visited by a hibernation pass.
+        bool m_activeRegionsChanged = false;
+
         float m_maxDeltaTime = 0.0f;
         float m_fixedDeltaTime = 0.0f;
         float m_accumulatedTime = 0.0f;
+        float m_inFlightDeltaTime = 0.0f; ///< Time step of the simulation left running by the previous update.
+        bool m_asyncSimulation = false; ///< Leave the last step of each update running until the next update.
+        bool m_simulationInFlight = false;
 
         //function pointer for simulating
         std::function<void(void *)> m_simFunc = nullptr;
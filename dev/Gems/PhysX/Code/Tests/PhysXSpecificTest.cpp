@@ -943,6 +943,31 @@ namespace PhysX
         EXPECT_EQ(hit.m_shape, terrainBody->GetShape(0).get());
     }
 
+    TEST_F(PhysXSpecificTest, Terrain_RaycastBatch_ReturnsHitPerRequest)
+    {
+        // Create terrain
+        auto terrain = CreateFlatTestTerrain();
+        Physics::RigidBodyStatic* terrainBody;
+        Physics::TerrainRequestBus::BroadcastResult(terrainBody, &Physics::TerrainRequests::GetTerrainTile, 0.0f, 0.0f);
+
+        // The first ray points down onto the terrain, the second one points away from it
+        Physics::RayCastRequest requests[2];
+        requests[0].m_start = AZ::Vector3(0, 0, 1);
+        requests[0].m_direction = AZ::Vector3(0, 0, -1);
+        requests[0].m_distance = 2;
+        requests[1].m_start = AZ::Vector3(0, 0, 1);
+        requests[1].m_direction = AZ::Vector3(0, 0, 1);
+        requests[1].m_distance = 2;
+
+        Physics::RayCastHit hits[2];
+        Physics::WorldRequestBus::Broadcast(&Physics::WorldRequests::RayCastBatch, requests, 2, hits);
+
+        ASSERT_EQ(hits[0], true);
+        EXPECT_EQ(hits[0].m_body, terrainBody);
+        EXPECT_EQ(hits[0].m_shape, terrainBody->GetShape(0).get());
+        EXPECT_EQ(hits[1], false);
+    }
+
     TEST_F(PhysXSpecificTest, CollisionFiltering_CollisionLayers_CombineLayersIntoGroup)
     {
         // Start with empty group
@@ -58,6 +58,13 @@ namespace PhysXCharacters
         /// Sets the half forward extent of the controller (for box controllers only).
         /// @param halfForwardExtent The new half forward extent for the controller.
         virtual void SetHalfForwardExtent(float halfForwardExtent) = 0;
+
+        /// Queues a movement relative to the current position, to be applied together with the queued movements of
+        /// all other controllers before the physics update.
+        /// Queued movements accumulate until applied, and the entity translation is updated when they are.
+        /// @param deltaPosition Desired movement relative to the current position.
+        /// @param deltaTime Duration of the movement.
+        virtual void QueueRelativeMove(const AZ::Vector3& deltaPosition, float deltaTime) = 0;
     };
     using CharacterControllerRequestBus = AZ::EBus<CharacterControllerRequests>;
 } // namespace PhysXCharacters
@@ -22,6 +22,8 @@ namespace physx
 
 namespace PhysXCharacters
 {
+    class CharacterController;
+
     class SystemRequests
         : public AZ::EBusTraits
     {
@@ -32,6 +34,12 @@ namespace PhysXCharacters
 
         /// Gets a pointer to the per-scene singleton responsible for character controller creation, destruction etc.
         virtual physx::PxControllerManager* GetControllerManager(const Physics::World& world) = 0;
+
+        /// Adds a controller with a queued movement to the batch applied before the next physics update.
+        virtual void AddPendingMove(CharacterController& controller) = 0;
+
+        /// Removes a controller from the batch of pending movements, for example when it is destroyed.
+        virtual void RemovePendingMove(CharacterController& controller) = 0;
     };
     using SystemRequestBus = AZ::EBus<SystemRequests>;
 } // namespace PhysXCharacters
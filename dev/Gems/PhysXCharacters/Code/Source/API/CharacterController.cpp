@@ -136,6 +136,11 @@ namespace PhysXCharacters
 
     CharacterController::~CharacterController()
     {
+        if (m_hasQueuedMove)
+        {
+            SystemRequestBus::Broadcast(&SystemRequests::RemovePendingMove, *this);
+        }
+
         if (m_pxController)
         {
             m_pxController->release();
@@ -301,6 +306,35 @@ namespace PhysXCharacters
         return oldPosition;
     }
 
+    void CharacterController::QueueRelativeMove(const AZ::Vector3& deltaPosition, float deltaTime)
+    {
+        if (!m_pxController)
+        {
+            AZ_Error("PhysX Character Controller", false, "Invalid character controller.");
+            return;
+        }
+
+        m_queuedDeltaPosition += deltaPosition;
+        m_queuedDeltaTime += deltaTime;
+
+        if (!m_hasQueuedMove)
+        {
+            m_hasQueuedMove = true;
+            SystemRequestBus::Broadcast(&SystemRequests::AddPendingMove, *this);
+        }
+    }
+
+    AZ::Vector3 CharacterController::ApplyQueuedMove()
+    {
+        const AZ::Vector3 deltaPosition = m_queuedDeltaPosition;
+        const float deltaTime = m_queuedDeltaTime;
+        m_queuedDeltaPosition = AZ::Vector3::CreateZero();
+        m_queuedDeltaTime = 0.0f;
+        m_hasQueuedMove = false;
+
+        return TryRelativeMove(deltaPosition, deltaTime);
+    }
+
     void CharacterController::SetRotation(const AZ::Quaternion& rotation)
     {
         if (m_shadowBody)
@@ -104,6 +104,12 @@ namespace PhysXCharacters
         float GetHalfForwardExtent() const;
         void SetHalfForwardExtent(float halfForwardExtent);
 
+        /// Accumulates a movement to be applied by the system component together with the other queued movements.
+        void QueueRelativeMove(const AZ::Vector3& deltaPosition, float deltaTime);
+        /// Applies the accumulated queued movement, returns the new base position.
+        AZ::Vector3 ApplyQueuedMove();
+        bool HasQueuedMove() const { return m_hasQueuedMove; }
+
     private:
         /// Update the velocity based on the outcome of the controller's movement in the simulation.  This can differ
         /// from the desired velocity, for example if the character is stuck in a corner its observed velocity may be
@@ -120,5 +126,8 @@ namespace PhysXCharacters
         AZStd::shared_ptr<Physics::Shape> m_shape; ///< The generic physics API shape associated with the controller.
         AZStd::unique_ptr<Physics::RigidBody> m_shadowBody; ///< A kinematic-synchronised rigid body used to store additional colliders.
         AZStd::string m_name = "Character Controller"; ///< Name to set on the PhysX actor associated with the controller.
+        AZ::Vector3 m_queuedDeltaPosition = AZ::Vector3::CreateZero(); ///< Movement accumulated by QueueRelativeMove.
+        float m_queuedDeltaTime = 0.0f; ///< Duration accumulated by QueueRelativeMove.
+        bool m_hasQueuedMove = false; ///< Whether the controller is waiting in the system component's batch.
     };
 } // namespace PhysXCharacters
\ No newline at end of file
@@ -79,6 +79,11 @@ namespace PhysXCharacters
                 ->Event("Get Half Forward Extent", &CharacterControllerRequests::GetHalfForwardExtent)
                 ->Event("Set Half Forward Extent", &CharacterControllerRequests::SetHalfForwardExtent,
                     { { { "Half Forward Extent", "The new half forward extent (for box controllers only)" } } })
+                ->Event("Queue Relative Move", &CharacterControllerRequests::QueueRelativeMove,
+                    { { { "Delta Position", "Desired movement relative to current position" },
+                        { "Delta Time", "Duration of the movement" } } })
+                ->Attribute(AZ::Script::Attributes::ToolTip,
+                    "Queues a relative movement to be applied together with all other characters before the physics update")
                 ;
         }
     }
@@ -356,6 +361,17 @@ namespace PhysXCharacters
         AZ_Error("PhysX Character Controller Component", false, "Invalid character controller.");
     }
 
+    void CharacterControllerComponent::QueueRelativeMove(const AZ::Vector3& deltaPosition, float deltaTime)
+    {
+        if (!ValidateDirectlyControlled())
+        {
+            return;
+        }
+
+        // the entity translation is updated by the system component when the batch of queued moves is applied
+        static_cast<CharacterController*>(m_controller.get())->QueueRelativeMove(deltaPosition, deltaTime);
+    }
+
     // TransformNotificationBus
     void CharacterControllerComponent::OnTransformChanged(const AZ::Transform& /*local*/, const AZ::Transform& world)
     {
@@ -96,6 +96,7 @@ namespace PhysXCharacters
         void SetHalfSideExtent(float halfSideExtent) override;
         float GetHalfForwardExtent() override;
         void SetHalfForwardExtent(float halfForwardExtent) override;
+        void QueueRelativeMove(const AZ::Vector3& deltaPosition, float deltaTime) override;
 
         // TransformNotificationBus
         void OnTransformChanged(const AZ::Transform& local, const AZ::Transform& world) override;
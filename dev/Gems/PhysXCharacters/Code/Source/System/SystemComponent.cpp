@@ -12,6 +12,8 @@
 
 #include <PhysXCharacters_precompiled.h>
 
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzFramework/Physics/SystemBus.h>
@@ -72,6 +74,7 @@ namespace PhysXCharacters
         SystemRequestBus::Handler::BusConnect();
         Physics::SystemNotificationBus::Handler::BusConnect();
         Physics::CharacterSystemRequestBus::Handler::BusConnect();
+        AZ::TickBus::Handler::BusConnect();
 #ifdef PHYSX_CHARACTERS_EDITOR
         AzToolsFramework::EditorEntityContextNotificationBus::Handler::BusConnect();
 #endif // ifdef PHYSX_CHARACTERS_EDITOR
@@ -82,6 +85,7 @@ namespace PhysXCharacters
 #ifdef PHYSX_CHARACTERS_EDITOR
         AzToolsFramework::EditorEntityContextNotificationBus::Handler::BusDisconnect();
 #endif // ifdef PHYSX_CHARACTERS_EDITOR
+        AZ::TickBus::Handler::BusDisconnect();
         Physics::CharacterSystemRequestBus::Handler::BusDisconnect();
         Physics::SystemNotificationBus::Handler::BusDisconnect();
         SystemRequestBus::Handler::BusDisconnect();
@@ -91,6 +95,7 @@ namespace PhysXCharacters
             worldManagerPair.second->release();
         }
         m_controllerManagers.clear();
+        m_pendingMoves.clear();
     }
 
 #ifdef PHYSX_CHARACTERS_EDITOR
@@ -129,6 +134,21 @@ namespace PhysXCharacters
         return manager;
     }
 
+    void SystemComponent::AddPendingMove(CharacterController& controller)
+    {
+        m_pendingMoves.push_back(&controller);
+    }
+
+    void SystemComponent::RemovePendingMove(CharacterController& controller)
+    {
+        auto it = AZStd::find(m_pendingMoves.begin(), m_pendingMoves.end(), &controller);
+        if (it != m_pendingMoves.end())
+        {
+            *it = m_pendingMoves.back();
+            m_pendingMoves.pop_back();
+        }
+    }
+
     // Physics::SystemNotificationBus
     void SystemComponent::OnPreWorldDestroy(Physics::World* world)
     {
@@ -165,4 +185,76 @@ namespace PhysXCharacters
             manager->computeInteractions(deltaTime);
         }
     }
+
+    // AZ::TickBus
+    void SystemComponent::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
+    {
+        ApplyPendingMoves();
+    }
+
+    int SystemComponent::GetTickOrder()
+    {
+        // after animation has queued its movements, before the physics worlds are updated
+        return AZ::ComponentTickBus::TICK_PHYSICS;
+    }
+
+    void SystemComponent::ApplyPendingMoves()
+    {
+        if (m_pendingMoves.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        // group the controllers by scene so that each scene is locked once for all of its moves
+        AZStd::sort(m_pendingMoves.begin(), m_pendingMoves.end(),
+            [](const CharacterController* lhs, const CharacterController* rhs)
+        {
+            return lhs->GetWorld() < rhs->GetWorld();
+        });
+
+        // moving a controller can queue further moves through transform notifications, those are applied next tick
+        AZStd::vector<CharacterController*> pendingMoves;
+        pendingMoves.swap(m_pendingMoves);
+
+        size_t batchBegin = 0;
+        while (batchBegin < pendingMoves.size())
+        {
+            Physics::World* world = pendingMoves[batchBegin]->GetWorld();
+            size_t batchEnd = batchBegin + 1;
+            while (batchEnd < pendingMoves.size() && pendingMoves[batchEnd]->GetWorld() == world)
+            {
+                ++batchEnd;
+            }
+
+            AZStd::vector<AZStd::pair<AZ::EntityId, AZ::Vector3>> newPositions;
+            newPositions.reserve(batchEnd - batchBegin);
+
+            physx::PxScene* pxScene = world ? static_cast<physx::PxScene*>(world->GetNativePointer()) : nullptr;
+            if (pxScene)
+            {
+                pxScene->lockWrite();
+            }
+
+            for (size_t moveIndex = batchBegin; moveIndex < batchEnd; ++moveIndex)
+            {
+                CharacterController* controller = pendingMoves[moveIndex];
+                newPositions.emplace_back(controller->GetEntityId(), controller->ApplyQueuedMove());
+            }
+
+            if (pxScene)
+            {
+                pxScene->unlockWrite();
+            }
+
+            // notify the entities once the scene is unlocked, handlers are free to query the scene again
+            for (const auto& entityPosition : newPositions)
+            {
+                AZ::TransformBus::Event(entityPosition.first, &AZ::TransformBus::Events::SetWorldTranslation, entityPosition.second);
+            }
+
+            batchBegin = batchEnd;
+        }
+    }
 } // namespace PhysXCharacters
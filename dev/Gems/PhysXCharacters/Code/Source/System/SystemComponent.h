@@ -13,6 +13,7 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
 #include <PhysXCharacters/SystemBus.h>
 #ifdef PHYSX_CHARACTERS_EDITOR
 #include <AzToolsFramework/Entity/EditorEntityContextBus.h>
@@ -27,6 +28,7 @@ namespace PhysXCharacters
         , public SystemRequestBus::Handler
         , public Physics::SystemNotificationBus::Handler
         , public Physics::CharacterSystemRequestBus::Handler
+        , public AZ::TickBus::Handler
 #ifdef PHYSX_CHARACTERS_EDITOR
         , public AzToolsFramework::EditorEntityContextNotificationBus::Handler
 #endif // ifdef PHYSX_CHARACTERS_EDITOR
@@ -49,6 +51,8 @@ namespace PhysXCharacters
 
         // SystemRequestBus
         physx::PxControllerManager* GetControllerManager(const Physics::World& world) override;
+        void AddPendingMove(CharacterController& controller) override;
+        void RemovePendingMove(CharacterController& controller) override;
 
         // Physics::SystemNotificationBus
         virtual void OnPreWorldDestroy(Physics::World* world) override;
@@ -58,12 +62,20 @@ namespace PhysXCharacters
             const Physics::ShapeConfiguration& shapeConfig, Physics::World& world) override;
         virtual void UpdateCharacters(const Physics::World& world, float deltaTime) override;
 
+        // AZ::TickBus
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
 #ifdef PHYSX_CHARACTERS_EDITOR
         // AzToolsFramework::EditorEntityContextNotificationBus
         void OnStopPlayInEditor() override;
 #endif // ifdef PHYSX_CHARACTERS_EDITOR
 
     private:
+        /// Applies all queued controller movements in one pass, grouped by the scene they belong to.
+        void ApplyPendingMoves();
+
         AZStd::vector<AZStd::pair<const Physics::World*, physx::PxControllerManager*>> m_controllerManagers;
+        AZStd::vector<CharacterController*> m_pendingMoves; ///< Controllers with a queued movement.
     };
 } // namespace PhysXCharacters
@@ -15,6 +15,7 @@
 #include <API/CharacterController.h>
 #include <AzCore/Asset/AssetManagerComponent.h>
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Jobs/JobManagerComponent.h>
 #include <AzCore/Memory/MemoryComponent.h>
 #include <AzCore/UnitTest/UnitTest.h>
@@ -236,6 +237,34 @@ namespace PhysXCharacters
         }
     }
 
+    TEST_F(PhysXCharactersTest, CharacterController_QueuedMoves_AppliedTogetherOnTick)
+    {
+        ControllerTestBasis basis;
+        auto controller = static_cast<CharacterController*>(basis.m_controller.get());
+        const AZ::Vector3 movementDelta = AZ::Vector3::CreateAxisX(0.1f);
+
+        controller->QueueRelativeMove(movementDelta, basis.m_timeStep);
+        controller->QueueRelativeMove(movementDelta, basis.m_timeStep);
+        EXPECT_TRUE(controller->HasQueuedMove());
+        EXPECT_TRUE(controller->GetBasePosition().IsClose(AZ::Vector3::CreateZero()));
+
+        AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, basis.m_timeStep, AZ::ScriptTimePoint());
+
+        EXPECT_FALSE(controller->HasQueuedMove());
+        EXPECT_TRUE(controller->GetBasePosition().IsClose(AZ::Vector3::CreateAxisX(0.2f)));
+        EXPECT_TRUE(controller->GetVelocity().IsClose(movementDelta / basis.m_timeStep));
+    }
+
+    TEST_F(PhysXCharactersTest, CharacterController_DeletedWithQueuedMove_RemovedFromBatch)
+    {
+        ControllerTestBasis basis;
+        static_cast<CharacterController*>(basis.m_controller.get())->QueueRelativeMove(AZ::Vector3::CreateAxisX(0.1f), basis.m_timeStep);
+        basis.m_controller = nullptr;
+
+        // should not touch the deleted controller
+        AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, basis.m_timeStep, AZ::ScriptTimePoint());
+    }
+
     TEST_F(PhysXCharactersTest, CharacterController_MovingDirectlyTowardsStaticBox_StoppedByBox)
     {
         ControllerTestBasis basis;
@@ -333,6 +333,11 @@ namespace PhysXDebug
             }
 
             ImGui::SliderFloat("PhysX Scale", &m_settings.m_scale, 1.0f, 10.0f);
+
+            if (Physics::World* world = GetCurrentPhysicsWorld())
+            {
+                ImGui::Text("Hibernating bodies: %u", world->GetNumHibernatingBodies());
+            }
             ImGui::EndMenu();
         }
     }
@@ -36,6 +36,17 @@ namespace RoadsAndRivers
         return *this;
     }
     
+    bool Road::RenderNodeInput::operator==(const RenderNodeInput& rhs) const
+    {
+        return m_vertices == rhs.m_vertices
+            && m_t0 == rhs.m_t0
+            && m_t1 == rhs.m_t1
+            && m_tStart == rhs.m_tStart
+            && m_tEnd == rhs.m_tEnd
+            && m_addOverlapBetweenSectors == rhs.m_addOverlapBetweenSectors
+            && m_alphaBlendRoadEnds == rhs.m_alphaBlendRoadEnds;
+    }
+
     bool Road::VersionConverter(AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement)
     {
         // conversion from version 1 to version 2:
@@ -171,6 +182,7 @@ namespace RoadsAndRivers
     {
         SplineGeometry::Clear();
         m_roadRenderNodes.clear();
+        m_renderNodeInputs.clear();
     }
 
     void Road::GeneralPropertyModified()
@@ -200,7 +212,11 @@ namespace RoadsAndRivers
 
     void Road::GenerateRenderNodes()
     {
+        // Keep the previous nodes around so unchanged chunks can be reused instead of being compiled again
+        AZStd::vector<RoadRenderNode> previousRenderNodes = AZStd::move(m_roadRenderNodes);
+        AZStd::vector<RenderNodeInput> previousRenderNodeInputs = AZStd::move(m_renderNodeInputs);
         m_roadRenderNodes.clear();
+        m_renderNodeInputs.clear();
 
         auto& geometrySectors = GetGeometrySectors();
         if (geometrySectors.empty())
@@ -222,6 +238,10 @@ namespace RoadsAndRivers
             return;
         }
 
+        // Nodes are compiled in world space, so none of them can be reused once the road moved
+        const bool canReuseRenderNodes = transform == m_renderNodeTransform;
+        m_renderNodeTransform = transform;
+
         const int MAX_TRAPEZOIDS_IN_CHUNK = 16;
         int chunksCount = geometrySectors.size() / MAX_TRAPEZOIDS_IN_CHUNK + 1;
 
@@ -237,11 +257,8 @@ namespace RoadsAndRivers
 
             auto& firstSector = geometrySectors[startSecId];
 
-            RoadRenderNode newRenderNode;
-            newRenderNode.SetRenderNode(static_cast<IRoadRenderNode*>(gEnv->p3DEngine->CreateRenderNode(eERType_Road)));
-            newRenderNode.GetRenderNode()->m_hasToBeSerialised = false;
-
-            AZStd::vector<AZ::Vector3> vertices;
+            RenderNodeInput input;
+            AZStd::vector<AZ::Vector3>& vertices = input.m_vertices;
             vertices.reserve(sectorsNum * 2 + 2);
 
             for (int i = 0; i < sectorsNum; ++i)
@@ -254,8 +271,6 @@ namespace RoadsAndRivers
 
             if (m_addOverlapBetweenSectors)
             {
-                newRenderNode.GetRenderNode()->m_addOverlapBetweenSectors = true;
-
                 // Extend final boundary to cover holes in roads caused by f16 meshes.
                 // Overlapping the roads slightly seems to be the nicest way to fix the issue
                 auto sectorLastOffset2 = lastSector.points[2] - lastSector.points[0];
@@ -272,22 +287,39 @@ namespace RoadsAndRivers
             }
             else 
             {
-                newRenderNode.GetRenderNode()->m_addOverlapBetweenSectors = false;
-
                 vertices.push_back(lastSector.points[2]);
                 vertices.push_back(lastSector.points[3]);
             }
 
             AZ_Assert((vertices.size() % 2) == 0, "Road mesh generation failed; Wrong vertices number");
 
-            newRenderNode.GetRenderNode()->SetVertices(vertices, transform,
-                fabs(firstSector.t0), fabs(lastSector.t1), fabs(geometrySectors.front().t0), fabs(geometrySectors.back().t1));
+            input.m_t0 = fabs(firstSector.t0);
+            input.m_t1 = fabs(lastSector.t1);
+            input.m_tStart = fabs(geometrySectors.front().t0);
+            input.m_tEnd = fabs(geometrySectors.back().t1);
+            input.m_addOverlapBetweenSectors = m_addOverlapBetweenSectors;
+            input.m_alphaBlendRoadEnds = !spline->IsClosed();
+
+            if (canReuseRenderNodes && chunkId < static_cast<int>(previousRenderNodes.size()) && previousRenderNodeInputs[chunkId] == input)
+            {
+                m_roadRenderNodes.push_back(previousRenderNodes[chunkId]);
+                m_renderNodeInputs.push_back(AZStd::move(input));
+                continue;
+            }
+
+            RoadRenderNode newRenderNode;
+            newRenderNode.SetRenderNode(static_cast<IRoadRenderNode*>(gEnv->p3DEngine->CreateRenderNode(eERType_Road)));
+            newRenderNode.GetRenderNode()->m_hasToBeSerialised = false;
+            newRenderNode.GetRenderNode()->m_addOverlapBetweenSectors = input.m_addOverlapBetweenSectors;
+
+            newRenderNode.GetRenderNode()->SetVertices(vertices, transform, input.m_t0, input.m_t1, input.m_tStart, input.m_tEnd);
 
             newRenderNode.GetRenderNode()->SetIgnoreTerrainHoles(false);
             newRenderNode.GetRenderNode()->SetPhysicalize(false);
-            newRenderNode.GetRenderNode()->m_bAlphaBlendRoadEnds = !spline->IsClosed();
+            newRenderNode.GetRenderNode()->m_bAlphaBlendRoadEnds = input.m_alphaBlendRoadEnds;
 
             m_roadRenderNodes.push_back(newRenderNode);
+            m_renderNodeInputs.push_back(AZStd::move(input));
         }
 
         SetRenderProperties();
@@ -74,8 +74,27 @@ namespace RoadsAndRivers
         void Clear() override;
 
     private:
+        /**
+         * Everything a road render node is compiled from. Compiling conforms the mesh to the terrain, which is
+         * expensive, so chunks whose input didn't change keep their render node when the road is regenerated.
+         */
+        struct RenderNodeInput
+        {
+            AZStd::vector<AZ::Vector3> m_vertices;
+            float m_t0 = 0.0f;
+            float m_t1 = 0.0f;
+            float m_tStart = 0.0f;
+            float m_tEnd = 0.0f;
+            bool m_addOverlapBetweenSectors = false;
+            bool m_alphaBlendRoadEnds = false;
+
+            bool operator==(const RenderNodeInput& rhs) const;
+        };
+
         AzFramework::SimpleAssetReference<LmbrCentral::MaterialAsset> m_material;
         AZStd::vector<RoadRenderNode> m_roadRenderNodes;
+        AZStd::vector<RenderNodeInput> m_renderNodeInputs; ///< Parallel to m_roadRenderNodes
+        AZ::Transform m_renderNodeTransform = AZ::Transform::CreateIdentity(); ///< World transform m_roadRenderNodes were compiled with
         bool m_ignoreTerrainHoles = false;
         bool m_addOverlapBetweenSectors = false;
 
@@ -15,6 +15,7 @@
 
 #include <AzFramework/Input/User/LocalUserId.h>
 
+#include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -100,6 +101,12 @@ namespace SaveData
             ////////////////////////////////////////////////////////////////////////////////////////
             //! Callback function to invoke on the main thread once the object has saved or loaded.
             OnObjectSavedOrLoaded callback = nullptr;
+
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! When saving, serialize the object on the save thread instead of the calling thread.
+            //! This keeps large saves from stalling the main thread, but the serializable object
+            //! must not be modified until the callback has been invoked. Ignored when loading.
+            bool serializeOnSaveThread = false;
         };
 
         ////////////////////////////////////////////////////////////////////////////////////////////
@@ -109,6 +116,20 @@ namespace SaveData
         template<typename SerializableType>
         static void SaveObject(const SaveOrLoadObjectParams<SerializableType>& saveObjectParams);
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Serialize an object into a newly allocated data buffer (deleted using azfree).
+        //! \param[in] serializableObject The object to serialize.
+        //! \param[in] serializeContext The serialize context to use, nullptr for the global one.
+        //! \param[out] dataBuffer The data buffer the object was serialized to.
+        //! \param[out] dataBufferSize The size of the data buffer the object was serialized to.
+        //! 
+eturn True if the object was serialized, false otherwise.
+        template<typename SerializableType>
+        static bool SerializeObjectToDataBuffer(const SerializableType* serializableObject,
+                                                AZ::SerializeContext* serializeContext,
+                                                DataBuffer& dataBuffer,
+                                                AZ::u64& dataBufferSize);
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         //! Load a serializable object from persistent storage.
         //! \tparam SerializableType The type of serializable object to load.
@@ -142,6 +163,12 @@ namespace SaveData
             ////////////////////////////////////////////////////////////////////////////////////////
             //! Callback function to invoke on the main thread once the data buffer has been saved.
             OnDataBufferSaved callback = nullptr;
+
+            ////////////////////////////////////////////////////////////////////////////////////////
+            //! Optional function invoked on the save thread to produce the data buffer, in which
+            //! case dataBuffer and dataBufferSize are ignored. It should return false on failure.
+            using ProduceDataBuffer = AZStd::function<bool(DataBuffer& dataBuffer, AZ::u64& dataBufferSize)>;
+            ProduceDataBuffer produceDataBuffer = nullptr;
         };
 
         ////////////////////////////////////////////////////////////////////////////////////////////
@@ -193,19 +220,59 @@ namespace SaveData
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     template<class SerializableType>
-    inline void SaveDataRequests::SaveObject(const SaveOrLoadObjectParams<SerializableType>& saveObjectParams)
+    inline bool SaveDataRequests::SerializeObjectToDataBuffer(const SerializableType* serializableObject,
+                                                              AZ::SerializeContext* serializeContext,
+                                                              DataBuffer& dataBuffer,
+                                                              AZ::u64& dataBufferSize)
     {
         // Save the serializable object to a data buffer.
-        AZStd::vector<AZ::u8> dataBuffer;
-        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> dataStream(&dataBuffer);
+        AZStd::vector<AZ::u8> serializedBuffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> dataStream(&serializedBuffer);
         const bool saved = AZ::Utils::SaveObjectToStream(dataStream,
                                                          AZ::ObjectStream::ST_BINARY,
-                                                         saveObjectParams.serializableObject.get(),
-                                                         saveObjectParams.serializeContext);
+                                                         serializableObject,
+                                                         serializeContext);
         if (!saved)
         {
             AZ_Error("SaveDataRequests::SaveObject", false,
                      "Failed to save serializable object to data stream.");
+            return false;
+        }
+
+        dataBufferSize = serializedBuffer.size();
+        if (dataBufferSize)
+        {
+            dataBuffer = DataBuffer(azmalloc(dataBufferSize), DataBufferDeleterAzFree);
+            memcpy(dataBuffer.get(), serializedBuffer.data(), dataBufferSize);
+        }
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    template<class SerializableType>
+    inline void SaveDataRequests::SaveObject(const SaveOrLoadObjectParams<SerializableType>& saveObjectParams)
+    {
+        SaveDataBufferParams saveDataBufferParams;
+        if (saveObjectParams.serializeOnSaveThread)
+        {
+            // Resolve the global serialize context here so the save thread doesn't need to.
+            AZ::SerializeContext* serializeContext = saveObjectParams.serializeContext;
+            if (!serializeContext)
+            {
+                AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationRequests::GetSerializeContext);
+            }
+
+            saveDataBufferParams.produceDataBuffer = [serializableObject = saveObjectParams.serializableObject, serializeContext]
+                (DataBuffer& dataBuffer, AZ::u64& dataBufferSize)
+            {
+                return SerializeObjectToDataBuffer(serializableObject.get(), serializeContext, dataBuffer, dataBufferSize);
+            };
+        }
+        else if (!SerializeObjectToDataBuffer(saveObjectParams.serializableObject.get(),
+                                              saveObjectParams.serializeContext,
+                                              saveDataBufferParams.dataBuffer,
+                                              saveDataBufferParams.dataBufferSize))
+        {
             if (saveObjectParams.callback)
             {
                 saveObjectParams.callback(saveObjectParams, SaveDataNotifications::Result::ErrorCorrupt);
@@ -214,14 +281,6 @@ namespace SaveData
         }
 
         // Save the data buffer to persistent storage.
-        const AZ::u64 dataBufferSize = dataBuffer.size();
-        SaveDataBufferParams saveDataBufferParams;
-        if (dataBufferSize)
-        {
-            saveDataBufferParams.dataBuffer = DataBuffer(azmalloc(dataBufferSize), DataBufferDeleterAzFree);
-            memcpy(saveDataBufferParams.dataBuffer.get(), dataBuffer.data(), dataBufferSize);
-        }
-        saveDataBufferParams.dataBufferSize = dataBufferSize;
         saveDataBufferParams.dataBufferName = saveObjectParams.dataBufferName;
         saveDataBufferParams.localUserId = saveObjectParams.localUserId;
         saveDataBufferParams.callback = [saveObjectParams](const SaveDataNotifications::DataBufferSavedParams& dataBufferSavedParams)
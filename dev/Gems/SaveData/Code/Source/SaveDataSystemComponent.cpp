@@ -146,12 +146,14 @@ namespace SaveData
                                                                              const AZStd::string& absoluteFilePath,
                                                                              bool waitForCompletion)
     {
-        // Perform parameter error checking but handle gracefully
-        AZ_Assert(saveDataBufferParams.dataBuffer, "Invalid param: dataBuffer");
-        AZ_Assert(saveDataBufferParams.dataBufferSize, "Invalid param: dataBufferSize");
+        // Perform parameter error checking but handle gracefully, the data buffer
+        // is only checked here if it isn't going to be produced on the save thread.
+        const bool hasDataBuffer = saveDataBufferParams.produceDataBuffer ||
+                                   (saveDataBufferParams.dataBuffer && saveDataBufferParams.dataBufferSize);
+        AZ_Assert(saveDataBufferParams.produceDataBuffer || saveDataBufferParams.dataBuffer, "Invalid param: dataBuffer");
+        AZ_Assert(saveDataBufferParams.produceDataBuffer || saveDataBufferParams.dataBufferSize, "Invalid param: dataBufferSize");
         AZ_Assert(!saveDataBufferParams.dataBufferName.empty(), "Invalid param: dataBufferName");
-        if (!saveDataBufferParams.dataBuffer ||
-            !saveDataBufferParams.dataBufferSize ||
+        if (!hasDataBuffer ||
             saveDataBufferParams.dataBufferName.empty())
         {
             OnSaveDataBufferComplete(saveDataBufferParams.dataBufferName,
@@ -181,10 +183,22 @@ namespace SaveData
                                                                             dataBufferName = saveDataBufferParams.dataBufferName,
                                                                             onSavedCallback = saveDataBufferParams.callback,
                                                                             localUserId = saveDataBufferParams.localUserId,
-                                                                            absoluteFilePath]()
+                                                                            produceDataBuffer = saveDataBufferParams.produceDataBuffer,
+                                                                            absoluteFilePath]() mutable
         {
             SaveDataNotifications::Result result = SaveDataNotifications::Result::ErrorUnspecified;
 
+            // Produce the data buffer here if the caller deferred it to the save thread.
+            if (produceDataBuffer)
+            {
+                if (!produceDataBuffer(dataBuffer, dataBufferSize) || !dataBuffer || !dataBufferSize)
+                {
+                    OnSaveDataBufferComplete(dataBufferName, localUserId, onSavedCallback, SaveDataNotifications::Result::ErrorCorrupt);
+                    threadCompleteFlag = true;
+                    return;
+                }
+            }
+
             // Append '.tmp' so we don't overwrite existing save data until we're sure of success.
             const AZStd::string tempSaveDataFilePath = absoluteFilePath + TempSaveDataFileExtension;
 
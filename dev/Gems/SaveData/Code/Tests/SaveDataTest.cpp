@@ -306,7 +306,8 @@ public:
     bool testBool = false;
 };
 
-void SaveTestObject(const AzFramework::LocalUserId& localUserId = AzFramework::LocalUserIdNone)
+void SaveTestObject(const AzFramework::LocalUserId& localUserId = AzFramework::LocalUserIdNone,
+                    bool serializeOnSaveThread = false)
 {
     // Reflect the test object.
     AZ::SerializeContext serializeContext;
@@ -325,6 +326,7 @@ void SaveTestObject(const AzFramework::LocalUserId& localUserId = AzFramework::L
     params.serializeContext = &serializeContext;
     params.dataBufferName = TestObject::DataBufferName;
     params.localUserId = localUserId;
+    params.serializeOnSaveThread = serializeOnSaveThread;
     params.callback = [params](const SaveData::SaveDataRequests::SaveOrLoadObjectParams<TestObject>& callbackParams,
                                SaveData::SaveDataNotifications::Result callbackResult)
     {
@@ -411,6 +413,12 @@ TEST_F(SaveDataTest, LoadObject)
     LoadTestObject();
 }
 
+TEST_F(SaveDataTest, SaveObjectOnSaveThread)
+{
+    SaveTestObject(AzFramework::LocalUserIdNone, true);
+    LoadTestObject();
+}
+
 TEST_F(SaveDataTest, SaveObjectForUser)
 {
     SaveTestObject(testSaveDataUser);
@@ -27,6 +27,64 @@ namespace
 {
     using namespace ScriptCanvas;
     
+    template<typename t_Value>
+    AZ_FORCE_INLINE bool CopyValueInPlace(AZStd::any& destination, const AZStd::any& source)
+    {
+        t_Value* destinationValue = AZStd::any_cast<t_Value>(&destination);
+        const t_Value* sourceValue = AZStd::any_cast<const t_Value>(&source);
+
+        if (destinationValue && sourceValue)
+        {
+            *destinationValue = *sourceValue;
+            return true;
+        }
+
+        return false;
+    }
+
+    // Assigns the value of source over the value already held by destination when both hold the same value type.
+    // This keeps the existing storage, so types too large for the any small buffer and strings don't reallocate on every write.
+    bool CopyValueInPlace(Data::eType type, AZStd::any& destination, const AZStd::any& source)
+    {
+        switch (type)
+        {
+        case Data::eType::AABB:
+            return CopyValueInPlace<Data::AABBType>(destination, source);
+        case Data::eType::Boolean:
+            return CopyValueInPlace<Data::BooleanType>(destination, source);
+        case Data::eType::Color:
+            return CopyValueInPlace<Data::ColorType>(destination, source);
+        case Data::eType::CRC:
+            return CopyValueInPlace<Data::CRCType>(destination, source);
+        case Data::eType::EntityID:
+            return CopyValueInPlace<Data::EntityIDType>(destination, source);
+        case Data::eType::Matrix3x3:
+            return CopyValueInPlace<Data::Matrix3x3Type>(destination, source);
+        case Data::eType::Matrix4x4:
+            return CopyValueInPlace<Data::Matrix4x4Type>(destination, source);
+        case Data::eType::Number:
+            return CopyValueInPlace<Data::NumberType>(destination, source);
+        case Data::eType::OBB:
+            return CopyValueInPlace<Data::OBBType>(destination, source);
+        case Data::eType::Plane:
+            return CopyValueInPlace<Data::PlaneType>(destination, source);
+        case Data::eType::Quaternion:
+            return CopyValueInPlace<Data::QuaternionType>(destination, source);
+        case Data::eType::String:
+            return CopyValueInPlace<Data::StringType>(destination, source);
+        case Data::eType::Transform:
+            return CopyValueInPlace<Data::TransformType>(destination, source);
+        case Data::eType::Vector2:
+            return CopyValueInPlace<Data::Vector2Type>(destination, source);
+        case Data::eType::Vector3:
+            return CopyValueInPlace<Data::Vector3Type>(destination, source);
+        case Data::eType::Vector4:
+            return CopyValueInPlace<Data::Vector4Type>(destination, source);
+        default:
+            return false;
+        }
+    }
+
     template<typename t_Value>
     struct ImplicitConversionHelp
     {
@@ -1922,7 +1980,13 @@ namespace ScriptCanvas
     {
         if (this != &source)
         {
-            if (m_isOverloadedStorage || source.IS_A(m_type))
+            if (m_type.IS_EXACTLY_A(source.m_type) && CopyValueInPlace(m_type.GetType(), m_storage, source.m_storage))
+            {
+                m_originality = eOriginality::Copy;
+                m_class = source.m_class;
+                OnDatumChanged();
+            }
+            else if (m_isOverloadedStorage || source.IS_A(m_type))
             {
                 m_originality = eOriginality::Copy;
                 InitializeOverloadedStorage(source.m_type, m_originality);
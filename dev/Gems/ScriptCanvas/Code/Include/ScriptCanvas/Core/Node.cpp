@@ -32,6 +32,7 @@
 #include <ScriptCanvas/Libraries/Core/EBusEventHandler.h>
 #include <ScriptCanvas/Variable/VariableBus.h>
 #include <ScriptCanvas/Debugger/API.h>
+#include <ScriptCanvas/Profiler/Aggregator.h>
 #include <ScriptCanvas/Utils/NodeUtils.h>
 
 namespace ScriptCanvas
@@ -684,6 +685,7 @@ namespace ScriptCanvas
         
         {
             AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::ScriptCanvas, "ScriptCanvas::%s::SignalInput", GetNodeName().c_str());
+            Profiler::NodeScope profilerScope(*this);
             OnInputSignal(slotId);
         }
         
@@ -1742,6 +1744,15 @@ namespace ScriptCanvas
 
         for (const Endpoint& endpoint : connectedEndpoints)
         {
+            Node* foundNode{};
+            RuntimeRequestBus::EventResult(foundNode, m_executionUniqueId, &RuntimeRequests::FindNode, endpoint.GetNodeId());
+            if (foundNode)
+            {
+                connectedNodes.emplace_back(foundNode, endpoint.GetSlotId());
+                continue;
+            }
+
+            // the node could not be found, search the graph data directly to report why
             const GraphData* graphData{};
             RuntimeRequestBus::EventResult(graphData, m_executionUniqueId, &RuntimeRequests::GetGraphDataConst);
             if (!graphData)
@@ -1792,6 +1803,15 @@ namespace ScriptCanvas
 
         for (const Endpoint& endpoint : connectedEndpoints)
         {
+            Node* foundNode{};
+            RuntimeRequestBus::EventResult(foundNode, m_executionUniqueId, &RuntimeRequests::FindNode, endpoint.GetNodeId());
+            if (foundNode)
+            {
+                connectedNodes.emplace_back(foundNode, endpoint.GetSlotId());
+                continue;
+            }
+
+            // the node could not be found, search the graph data directly to report why
             const GraphData* graphData{};
             RuntimeRequestBus::EventResult(graphData, m_executionUniqueId, &RuntimeRequests::GetGraphDataConst);
             if (!graphData)
@@ -105,29 +105,24 @@ namespace ScriptCanvas
 
     void RuntimeComponent::ActivateNodes()
     {
-        m_runtimeData.m_graphData.BuildEndpointMap();
-        for (auto& nodeEntity : m_runtimeData.m_graphData.m_nodes)
+        m_nodeLookup.clear();
+        for (AZ::Entity* nodeEntity : m_runtimeData.m_graphData.m_nodes)
         {
-            if (nodeEntity->GetState() == AZ::Entity::ES_CONSTRUCTED)
-            {
-                nodeEntity->Init();
-            }
-            if (nodeEntity->GetState() == AZ::Entity::ES_INIT)
+            if (auto node = AZ::EntityUtils::FindFirstDerivedComponent<Node>(nodeEntity))
             {
-                nodeEntity->Activate();
+                m_nodeLookup[nodeEntity->GetId()] = node;
             }
         }
 
-        for (auto& connectionEntity : m_runtimeData.m_graphData.m_connections)
+        for (auto& nodeEntity : m_runtimeData.m_graphData.m_nodes)
         {
-            if (connectionEntity->GetState() == AZ::Entity::ES_CONSTRUCTED)
+            if (nodeEntity->GetState() == AZ::Entity::ES_CONSTRUCTED)
             {
-                connectionEntity->Init();
+                nodeEntity->Init();
             }
-
-            if (connectionEntity->GetState() == AZ::Entity::ES_INIT)
+            if (nodeEntity->GetState() == AZ::Entity::ES_INIT)
             {
-                connectionEntity->Activate();
+                nodeEntity->Activate();
             }
         }
     }
@@ -227,16 +222,7 @@ namespace ScriptCanvas
             }
         }
 
-        for (auto& connectionEntity : m_runtimeData.m_graphData.m_connections)
-        {
-            if (connectionEntity)
-            {
-                if (connectionEntity->GetState() == AZ::Entity::ES_ACTIVE)
-                {
-                    connectionEntity->Deactivate();
-                }
-            }
-        }
+        m_nodeLookup.clear();
 
         // Defer graph deletion to next frame as an executing graph in a dynamic slice can be deleted from a node
         auto oldRuntimeData(AZStd::move(m_runtimeData));
@@ -262,8 +248,9 @@ namespace ScriptCanvas
         m_runtimeData.m_variableData.Clear();
 
         auto& assetRuntimeData = m_runtimeAsset.Get()->GetData();
-        // Clone GraphData
-        serializeContext->CloneObjectInplace(m_runtimeData.m_graphData, &assetRuntimeData.m_graphData);
+        // Only the nodes hold per instance state, they are the only part of the GraphData cloned.
+        // The connections are immutable and stay owned by the asset, the instance only keeps a remapped endpoint map.
+        serializeContext->CloneObjectInplace(m_runtimeData.m_graphData.m_nodes, &assetRuntimeData.m_graphData.m_nodes);
 
         for (AZ::Entity* nodeEntity : m_runtimeData.m_graphData.m_nodes)
         {
@@ -277,14 +264,16 @@ namespace ScriptCanvas
             }
         }
 
-        for (AZ::Entity* connectionEntity : m_runtimeData.m_graphData.m_connections)
+        for (const AZ::Entity* connectionEntity : assetRuntimeData.m_graphData.m_connections)
         {
             AZ::EntityId runtimeConnectionId = AZ::Entity::MakeId();
             m_assetIdToRuntimeId.emplace(connectionEntity->GetId(), runtimeConnectionId);
             m_runtimeIdToAssetId.emplace(runtimeConnectionId, connectionEntity->GetId());
         }
 
-        m_runtimeData.m_graphData.LoadDependentAssets();
+        BuildRuntimeEndpointMap(assetRuntimeData.m_graphData);
+
+        assetRuntimeData.m_graphData.LoadDependentAssets();
 
         // Clone Variable Data
         serializeContext->CloneObjectInplace(m_runtimeData.m_variableData, &assetRuntimeData.m_variableData);
@@ -335,6 +324,31 @@ namespace ScriptCanvas
         ApplyVariableOverrides();
     }
 
+    void RuntimeComponent::BuildRuntimeEndpointMap(GraphData& assetGraphData)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::ScriptCanvas);
+
+        // The asset endpoint map is built when the asset is loaded, it only needs to be built here if that was skipped
+        if (assetGraphData.m_endpointMap.empty() && !assetGraphData.m_connections.empty())
+        {
+            assetGraphData.BuildEndpointMap();
+        }
+
+        auto remapEndpoint = [this](const Endpoint& assetEndpoint)
+        {
+            auto runtimeIdIt = m_assetIdToRuntimeId.find(assetEndpoint.GetNodeId());
+            return runtimeIdIt != m_assetIdToRuntimeId.end() ? Endpoint(runtimeIdIt->second, assetEndpoint.GetSlotId()) : assetEndpoint;
+        };
+
+        auto& runtimeEndpointMap = m_runtimeData.m_graphData.m_endpointMap;
+        runtimeEndpointMap.clear();
+        runtimeEndpointMap.reserve(assetGraphData.m_endpointMap.size());
+        for (const auto& endpointPair : assetGraphData.m_endpointMap)
+        {
+            runtimeEndpointMap.emplace(remapEndpoint(endpointPair.first), remapEndpoint(endpointPair.second));
+        }
+    }
+
     ActivationInfo RuntimeComponent::CreateActivationInfo() const
     {
         return ActivationInfo(CreateGraphInfo(GetUniqueId(), GetGraphIdentifier()), CreateVariableValues());
@@ -467,6 +481,13 @@ namespace ScriptCanvas
     
     Node* RuntimeComponent::FindNode(AZ::EntityId nodeId) const
     {
+        // once the nodes are activated their ids are final and the lookup is used, signal propagation relies on this being fast
+        if (!m_nodeLookup.empty())
+        {
+            auto nodeIt = m_nodeLookup.find(nodeId);
+            return nodeIt != m_nodeLookup.end() ? nodeIt->second : nullptr;
+        }
+
         auto entry = AZStd::find_if(m_runtimeData.m_graphData.m_nodes.begin(), m_runtimeData.m_graphData.m_nodes.end(), [nodeId](const AZ::Entity* node) { return node->GetId() == nodeId; });
         return entry != m_runtimeData.m_graphData.m_nodes.end() ? AZ::EntityUtils::FindFirstDerivedComponent<Node>(*entry) : nullptr;
     }
@@ -522,10 +543,14 @@ namespace ScriptCanvas
 
     AZStd::vector<AZ::EntityId> RuntimeComponent::GetConnections() const
     {
+        // connections are not instantiated at runtime, report the runtime ids generated for the asset connections
         AZStd::vector<AZ::EntityId> entityIds;
-        for (auto& connectionRef : m_runtimeData.m_graphData.m_connections)
+        if (m_runtimeAsset.IsReady())
         {
-            entityIds.push_back(connectionRef->GetId());
+            for (const AZ::Entity* connectionRef : m_runtimeAsset.Get()->GetData().m_graphData.m_connections)
+            {
+                entityIds.push_back(FindRuntimeNodeIdByAssetNodeId(connectionRef->GetId()));
+            }
         }
 
         return entityIds;
@@ -146,6 +146,8 @@ namespace ScriptCanvas
         void ActivateGraph();
         void DeactivateGraph();
         void CreateAssetInstance();
+        //! Builds the instance endpoint map from the asset owned connections, using the instance node ids
+        void BuildRuntimeEndpointMap(GraphData& assetGraphData);
         ////
 
     private:
@@ -171,5 +173,7 @@ namespace ScriptCanvas
         AZStd::unordered_map<AZ::EntityId, AZ::EntityId> m_runtimeIdToAssetId;
         // used to map asset sources to runtime graphs, for use in debugging and logging against human written content in the editor
         AZStd::unordered_map<AZ::EntityId, AZ::EntityId> m_assetIdToRuntimeId;
+        // runtime node id to node component lookup, built when the nodes are activated
+        AZStd::unordered_map<AZ::EntityId, Node*> m_nodeLookup;
     };
 }
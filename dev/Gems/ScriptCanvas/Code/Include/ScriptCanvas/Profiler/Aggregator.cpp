@@ -10,10 +10,170 @@
 *
 */
 
+#include "precompiled.h"
+
+#include <ScriptCanvas/Profiler/Aggregator.h>
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/sort.h>
+#include <ScriptCanvas/Core/Node.h>
+#include <ScriptCanvas/Execution/RuntimeBus.h>
+
 namespace ScriptCanvas
 {
     namespace Profiler
     {
+        Aggregator* Aggregator::s_activeAggregator = nullptr;
+
+        void Aggregator::Reflect(AZ::ReflectContext* context)
+        {
+            if (AZ::BehaviorContext* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
+            {
+                behaviorContext->EBus<ProfilerRequestBus>("ScriptCanvasProfilerRequestBus")
+                    ->Attribute(AZ::Script::Attributes::Category, "Script Canvas")
+                    ->Event("SetProfilingEnabled", &ProfilerRequests::SetProfilingEnabled)
+                    ->Event("IsProfilingEnabled", &ProfilerRequests::IsProfilingEnabled)
+                    ->Event("ResetProfilingData", &ProfilerRequests::ResetProfilingData)
+                    ->Event("WriteProfilingDataToCsv", &ProfilerRequests::WriteProfilingDataToCsv)
+                    ;
+            }
+        }
+
+        Aggregator::Aggregator()
+        {
+            ProfilerRequestBus::Handler::BusConnect();
+        }
+
+        Aggregator::~Aggregator()
+        {
+            ProfilerRequestBus::Handler::BusDisconnect();
+            SetProfilingEnabled(false);
+        }
+
+        void Aggregator::BeginNode()
+        {
+            ActiveScope scope;
+            scope.m_startTime = AZStd::GetTimeNowTicks();
+            m_scopeStack.push_back(scope);
+        }
+
+        void Aggregator::EndNode(const Node& node)
+        {
+            // the scope stack is cleared when profiling gets disabled while nodes are executing
+            if (m_scopeStack.empty())
+            {
+                return;
+            }
+
+            const ActiveScope scope = m_scopeStack.back();
+            m_scopeStack.pop_back();
+
+            const AZStd::sys_time_t inclusiveTime = AZStd::GetTimeNowTicks() - scope.m_startTime;
+            if (!m_scopeStack.empty())
+            {
+                m_scopeStack.back().m_childTime += inclusiveTime;
+            }
+
+            // key the timing by asset and asset node id, so all instances of a graph accumulate into the same entry
+            AZ::Data::AssetId assetId;
+            RuntimeRequestBus::EventResult(assetId, node.GetGraphId(), &RuntimeRequests::GetAssetId);
+            AZ::EntityId assetNodeId;
+            RuntimeRequestBus::EventResult(assetNodeId, node.GetGraphId(), &RuntimeRequests::FindAssetNodeIdByRuntimeNodeId, node.GetEntityId());
+            if (!assetNodeId.IsValid())
+            {
+                assetNodeId = node.GetEntityId();
+            }
+
+            NodeTiming& timing = m_timings[assetId][assetNodeId];
+            if (timing.m_callCount == 0)
+            {
+                timing.m_nodeName = node.GetNodeName();
+            }
+            ++timing.m_callCount;
+            timing.m_inclusiveTime += inclusiveTime;
+            timing.m_exclusiveTime += inclusiveTime - scope.m_childTime;
+        }
+
+        void Aggregator::SetProfilingEnabled(bool enabled)
+        {
+            if (!enabled)
+            {
+                m_scopeStack.clear();
+            }
+
+            s_activeAggregator = enabled ? this : nullptr;
+        }
+
+        bool Aggregator::IsProfilingEnabled()
+        {
+            return s_activeAggregator == this;
+        }
+
+        void Aggregator::ResetProfilingData()
+        {
+            m_timings.clear();
+        }
+
+        bool Aggregator::WriteProfilingDataToCsv(const AZStd::string& filePath)
+        {
+            AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+            if (!fileIO)
+            {
+                AZ_Error("ScriptCanvas", false, "FileIOBase unavailable, profiling data can't be written to %s.", filePath.c_str());
+                return false;
+            }
+
+            AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
+            if (!fileIO->Open(filePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeText, fileHandle))
+            {
+                AZ_Error("ScriptCanvas", false, "Failed to open %s to write profiling data.", filePath.c_str());
+                return false;
+            }
+
+            struct Row
+            {
+                const AZ::Data::AssetId* m_assetId;
+                const AZ::EntityId* m_nodeId;
+                const NodeTiming* m_timing;
+            };
+
+            AZStd::vector<Row> rows;
+            for (const auto& assetTimings : m_timings)
+            {
+                for (const auto& nodeTiming : assetTimings.second)
+                {
+                    rows.push_back({ &assetTimings.first, &nodeTiming.first, &nodeTiming.second });
+                }
+            }
+
+            AZStd::sort(rows.begin(), rows.end(), [](const Row& lhs, const Row& rhs)
+            {
+                return lhs.m_timing->m_exclusiveTime > rhs.m_timing->m_exclusiveTime;
+            });
+
+            const double ticksToMs = 1000.0 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+
+            AZStd::string text = "Asset,Node,Name,Calls,InclusiveMs,ExclusiveMs,AverageExclusiveMs\n";
+            for (const Row& row : rows)
+            {
+                const NodeTiming& timing = *row.m_timing;
+                const double exclusiveMs = static_cast<double>(timing.m_exclusiveTime) * ticksToMs;
+                text += AZStd::string::format("%s,%s,\"%s\",%llu,%.4f,%.4f,%.6f\n",
+                    row.m_assetId->ToString<AZStd::string>().c_str(),
+                    row.m_nodeId->ToString().c_str(),
+                    timing.m_nodeName.c_str(),
+                    static_cast<unsigned long long>(timing.m_callCount),
+                    static_cast<double>(timing.m_inclusiveTime) * ticksToMs,
+                    exclusiveMs,
+                    exclusiveMs / static_cast<double>(timing.m_callCount));
+            }
+
+            const bool written = fileIO->Write(fileHandle, text.c_str(), text.size());
+            fileIO->Close(fileHandle);
 
+            AZ_Error("ScriptCanvas", written, "Failed to write profiling data to %s.", filePath.c_str());
+            return written;
+        }
     }
-}
\ No newline at end of file
+}
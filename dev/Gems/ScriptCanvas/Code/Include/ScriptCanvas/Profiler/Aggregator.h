@@ -10,10 +10,125 @@
 *
 */
 #pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/time.h>
+
+namespace AZ
+{
+    class ReflectContext;
+}
+
 namespace ScriptCanvas
 {
+    class Node;
+
     namespace Profiler
     {
+        //! Execution statistics of a single node of a graph asset, accumulated over all instances of that graph.
+        //! Times are in AZStd::GetTimeNowTicks() units.
+        struct NodeTiming
+        {
+            AZStd::string m_nodeName;
+            AZ::u64 m_callCount = 0;
+            AZStd::sys_time_t m_inclusiveTime = 0; ///< Time spent in the node and in everything it executed synchronously.
+            AZStd::sys_time_t m_exclusiveTime = 0; ///< Time spent in the node itself.
+        };
+
+        using NodeTimingMap = AZStd::unordered_map<AZ::EntityId, NodeTiming>;
+        using AssetTimingMap = AZStd::unordered_map<AZ::Data::AssetId, NodeTimingMap>;
+
+        class ProfilerRequests
+            : public AZ::EBusTraits
+        {
+        public:
+            static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+            static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+            //! Starts or stops gathering per node execution timings.
+            virtual void SetProfilingEnabled(bool enabled) = 0;
+            virtual bool IsProfilingEnabled() = 0;
+
+            //! Discards all timings gathered so far.
+            virtual void ResetProfilingData() = 0;
+
+            //! Writes the gathered timings as CSV, one row per node of each graph asset, sorted by exclusive time.
+            virtual bool WriteProfilingDataToCsv(const AZStd::string& filePath) = 0;
+        };
+
+        using ProfilerRequestBus = AZ::EBus<ProfilerRequests>;
+
+        //! Aggregates node execution timings per graph asset while profiling is enabled.
+        //! Graph execution happens on the main thread, the aggregator is not thread safe.
+        class Aggregator
+            : public ProfilerRequestBus::Handler
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(Aggregator, AZ::SystemAllocator, 0);
+
+            static void Reflect(AZ::ReflectContext* context);
+
+            //! Returns the aggregator while profiling is enabled, nullptr otherwise.
+            static Aggregator* GetActive() { return s_activeAggregator; }
+
+            Aggregator();
+            ~Aggregator() override;
+
+            void BeginNode();
+            void EndNode(const Node& node);
+
+            const AssetTimingMap& GetTimings() const { return m_timings; }
+
+            // ProfilerRequestBus
+            void SetProfilingEnabled(bool enabled) override;
+            bool IsProfilingEnabled() override;
+            void ResetProfilingData() override;
+            bool WriteProfilingDataToCsv(const AZStd::string& filePath) override;
+
+        private:
+            struct ActiveScope
+            {
+                AZStd::sys_time_t m_startTime = 0;
+                AZStd::sys_time_t m_childTime = 0;
+            };
+
+            static Aggregator* s_activeAggregator;
+
+            AZStd::vector<ActiveScope> m_scopeStack;
+            AssetTimingMap m_timings;
+        };
+
+        //! Times the execution of a node for the active aggregator, does nothing while profiling is disabled.
+        class NodeScope
+        {
+        public:
+            explicit NodeScope(const Node& node)
+                : m_node(node)
+                , m_aggregator(Aggregator::GetActive())
+            {
+                if (m_aggregator)
+                {
+                    m_aggregator->BeginNode();
+                }
+            }
+
+            ~NodeScope()
+            {
+                if (m_aggregator)
+                {
+                    m_aggregator->EndNode(m_node);
+                }
+            }
 
+        private:
+            const Node& m_node;
+            Aggregator* m_aggregator;
+        };
     }
-}
\ No newline at end of file
+}
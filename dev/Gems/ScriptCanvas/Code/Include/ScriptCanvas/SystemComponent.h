@@ -13,6 +13,7 @@
 #pragma once
 
 #include <ScriptCanvas/Core/ScriptCanvasBus.h>
+#include <ScriptCanvas/Profiler/Aggregator.h>
 #include <ScriptCanvas/Variable/VariableCore.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -83,5 +84,7 @@ namespace ScriptCanvas
         using LockType = AZStd::lock_guard<MutexType>;
         AZStd::unordered_map<const void*, BehaviorContextObject*> m_ownedObjectsByAddress;
         MutexType m_ownedObjectsByAddressMutex;
+
+        AZStd::unique_ptr<Profiler::Aggregator> m_profilerAggregator;
     };
 }
@@ -22,6 +22,7 @@
 #include <ScriptCanvas/Core/Graph.h>
 #include <ScriptCanvas/Data/DataRegistry.h>
 #include <ScriptCanvas/Execution/RuntimeComponent.h>
+#include <ScriptCanvas/Profiler/Aggregator.h>
 #include <ScriptCanvas/Variable/GraphVariableManagerComponent.h>
 #include <ScriptCanvas/SystemComponent.h>
 
@@ -75,6 +76,8 @@ namespace ScriptCanvas
         ExecutionLogAsset::Reflect(context);
 #endif//defined(SC_EXECUTION_TRACE_ENABLED)
 
+        Profiler::Aggregator::Reflect(context);
+
     }
 
     void SystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
@@ -109,10 +112,13 @@ namespace ScriptCanvas
         {
             AZ::BehaviorContextBus::Handler::BusConnect(behaviorContext);
         }
+
+        m_profilerAggregator = AZStd::make_unique<Profiler::Aggregator>();
     }
 
     void SystemComponent::Deactivate()
     {
+        m_profilerAggregator.reset();
         AZ::BehaviorContextBus::Handler::BusDisconnect();
         SystemRequestBus::Handler::BusDisconnect();
     }
@@ -11,8 +11,6 @@
 */
 #include <CSVStaticData.h>
 
-#include <AzCore/std/smart_ptr/make_shared.h>
-
 #include <sstream>
 
 namespace CloudCanvas
@@ -25,6 +23,8 @@ namespace CloudCanvas
 
         bool CSVStaticData::LoadData(const char* initBuffer)
         {
+            m_rowIndex.clear();
+            m_attributeIndex.clear();
             m_dataVec.clear();
             m_attributes.clear();
 
@@ -68,25 +68,56 @@ namespace CloudCanvas
 
                 std::stringstream entryStream(attributeStr);
 
-                AttributeMapPtr newMap = AZStd::make_shared<AttributeMap>();
+                AttributeRow newRow;
+                newRow.reserve(m_attributes.size());
 
-                size_t thisAttrSlot = 0;
                 do
                 {
                     thisAttribute = ParseFromStream(entryStream);
 
-                    if (thisAttrSlot < m_attributes.size())
+                    if (newRow.size() < m_attributes.size())
                     {
-                        newMap->insert({ m_attributes[thisAttrSlot], thisAttribute.c_str() });
+                        AttributeValue newValue;
+                        newValue.m_strValue = AZStd::move(thisAttribute);
+
+                        std::stringstream intStream(newValue.m_strValue.c_str());
+                        intStream >> newValue.m_intValue;
+
+                        std::stringstream doubleStream(newValue.m_strValue.c_str());
+                        doubleStream >> newValue.m_doubleValue;
+
+                        newRow.push_back(AZStd::move(newValue));
                     }
-                    ++thisAttrSlot;
                 } while (entryStream.tellg() >= 0);
 
-                m_dataVec.push_back(newMap);
+                m_dataVec.push_back(AZStd::move(newRow));
             }
+
+            BuildIndices();
             return true;
         }
 
+        void CSVStaticData::BuildIndices()
+        {
+            // The first column of a repeated attribute or key wins, as it did when rows were searched in order
+            m_attributeIndex.reserve(m_attributes.size());
+            for (size_t attributeSlot = 0; attributeSlot < m_attributes.size(); ++attributeSlot)
+            {
+                m_attributeIndex.emplace(AZStd::string_view(m_attributes[attributeSlot]), attributeSlot);
+            }
+
+            m_rowIndex.reserve(m_dataVec.size());
+            for (size_t rowSlot = 0; rowSlot < m_dataVec.size(); ++rowSlot)
+            {
+                const AttributeRow& thisRow = m_dataVec[rowSlot];
+                if (thisRow.size())
+                {
+                    // We'll just assume that our first column is our key column
+                    m_rowIndex.emplace(AZStd::string_view(thisRow[0].m_strValue), rowSlot);
+                }
+            }
+        }
+
         AttributeValueType CSVStaticData::ParseFromStream(std::stringstream& inStream)
         {
             std::string returnString;
@@ -127,47 +158,37 @@ namespace CloudCanvas
             }
             return returnString.c_str();
         }
-        AttributeMapPtr CSVStaticData::GetAttributeMap(const char* keyName) const
+
+        // Find the attribute value for the given key and attribute combination
+        const AttributeValue* CSVStaticData::GetAttributeValue(const char* keyName, const char* attributeName) const
         {
-            for (auto thisMap : m_dataVec)
+            auto thisRow = m_rowIndex.find(AZStd::string_view(keyName));
+            if (thisRow == m_rowIndex.end())
             {
-                auto thisElement = thisMap->find(m_keyName);
-                if (thisElement != thisMap->end())
-                {
-                    if (thisElement->second == keyName)
-                    {
-                        return thisMap;
-                    }
-                }
+                return nullptr;
             }
-            return AttributeMapPtr {};
-        }
 
-        // Find the attribute value for the given key and attribute combination
-        AttributeReturnType CSVStaticData::GetAttributeValue(const char* keyName, const char* attributeName) const
-        {
-            AttributeMapPtr mapPtr = GetAttributeMap(keyName);
-            if (mapPtr)
+            auto thisField = m_attributeIndex.find(AZStd::string_view(attributeName));
+            if (thisField == m_attributeIndex.end())
             {
-                auto thisField = mapPtr->find(attributeName);
-                if (thisField != mapPtr->end())
-                {
-                    return AZStd::make_pair(true, thisField->second);
-                }
+                return nullptr;
+            }
+
+            const AttributeRow& rowData = m_dataVec[thisRow->second];
+            if (thisField->second >= rowData.size())
+            {
+                return nullptr;
             }
-            return AZStd::make_pair(false, "");
+            return &rowData[thisField->second];
         }
 
         ReturnInt CSVStaticData::GetIntValue(const char* structName, const char* fieldName, bool& wasSuccess) const
         {
-            AttributeReturnType searchValue = GetAttributeValue(structName, fieldName);
-            if (searchValue.first)
+            const AttributeValue* searchValue = GetAttributeValue(structName, fieldName);
+            if (searchValue)
             {
-                std::stringstream numStream(searchValue.second.c_str());
-                int returnValue;
                 wasSuccess = true;
-                numStream >> returnValue;
-                return returnValue;
+                return searchValue->m_intValue;
             }
             wasSuccess = false;
             return 0;
@@ -175,14 +196,11 @@ namespace CloudCanvas
 
         ReturnDouble CSVStaticData::GetDoubleValue(const char* structName, const char* fieldName, bool& wasSuccess) const
         {
-            AttributeReturnType searchValue = GetAttributeValue(structName, fieldName);
-            if (searchValue.first)
+            const AttributeValue* searchValue = GetAttributeValue(structName, fieldName);
+            if (searchValue)
             {
-                std::stringstream numStream(searchValue.second.c_str());
-                double returnValue;
-                numStream >> returnValue;
                 wasSuccess = true;
-                return returnValue;
+                return searchValue->m_doubleValue;
             }
             wasSuccess = false;
             return 0.0;
@@ -190,13 +208,11 @@ namespace CloudCanvas
 
         ReturnStr CSVStaticData::GetStrValue(const char* structName, const char* fieldName, bool& wasSuccess) const
         {
-            AttributeReturnType searchValue = GetAttributeValue(structName, fieldName);
-            if (searchValue.first)
+            const AttributeValue* searchValue = GetAttributeValue(structName, fieldName);
+            if (searchValue)
             {
-                AZStd::string returnStr;
-                returnStr = searchValue.second;
                 wasSuccess = true;
-                return returnStr;
+                return searchValue->m_strValue;
             }
             wasSuccess = false;
             return "";
@@ -12,9 +12,9 @@
 #pragma once
 #include <StaticDataInterface.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/unordered_map.h>
-#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 namespace CloudCanvas
 {
@@ -22,18 +22,30 @@ namespace CloudCanvas
     {
         using AttributeKeyType = AZStd::string;
         using AttributeValueType = AZStd::string;
-        using AttributeMap = AZStd::unordered_map<AttributeKeyType, AttributeValueType>;
-        using AttributeMapPtr = AZStd::shared_ptr<AttributeMap>;
-        using DataVec = AZStd::vector<AttributeMapPtr>;
-        using AttributeReturnType = AZStd::pair<bool, AttributeValueType>;
         using AttributeVec = AZStd::vector<AttributeValueType>;
 
+        // A single field, numeric conversions are done once when the table is loaded
+        struct AttributeValue
+        {
+            AttributeValueType m_strValue;
+            ReturnInt m_intValue{ 0 };
+            ReturnDouble m_doubleValue{ 0.0 };
+        };
+        // Fields of one row in column order, rows shorter than the header are missing their trailing fields
+        using AttributeRow = AZStd::vector<AttributeValue>;
+        using DataVec = AZStd::vector<AttributeRow>;
+        // Views into m_attributes and m_dataVec, which are not modified after the indices are built
+        using IndexMap = AZStd::unordered_map<AZStd::string_view, size_t>;
+
         class CSVStaticData
             : public StaticDataInterface
         {
         public:
             CSVStaticData();
             virtual ~CSVStaticData() = default;
+            // The lookup indices point into this instance's strings
+            CSVStaticData(const CSVStaticData&) = delete;
+            CSVStaticData& operator=(const CSVStaticData&) = delete;
 
             virtual ReturnInt GetIntValue(const char* structName, const char* fieldName, bool& wasSuccess) const override;
             virtual ReturnStr GetStrValue(const char* structName, const char* fieldName, bool& wasSuccess) const override;
@@ -47,15 +59,17 @@ namespace CloudCanvas
         private:
             // Helpers to get attribute value data
 
-            // Find the attribute map for the given key
-            AttributeMapPtr GetAttributeMap(const char* keyName) const;
+            // Find the attribute value for the given key and attribute combination, nullptr if there is none
+            const AttributeValue* GetAttributeValue(const char* keyName, const char* attributeName) const;
 
-            // Find the attribute value for the given key and attribute combination
-            AttributeReturnType GetAttributeValue(const char* keyName, const char* attributeName) const;
+            // Index rows by key and attributes by name after a load so lookups don't scan the table
+            void BuildIndices();
 
             AttributeKeyType m_keyName;
             AttributeVec m_attributes;
             DataVec m_dataVec;
+            IndexMap m_attributeIndex;
+            IndexMap m_rowIndex;
         };
     }
 }
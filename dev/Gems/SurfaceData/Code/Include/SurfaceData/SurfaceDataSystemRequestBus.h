@@ -15,6 +15,7 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector2.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 
 namespace SurfaceData
@@ -37,6 +38,11 @@ namespace SurfaceData
 
         virtual void GetSurfacePoints(const AZ::Vector3& inPosition, const SurfaceTagVector& masks, SurfacePointList& surfacePointList) const = 0;
 
+        //! Samples a grid of positions covering the XY extents of inRegion, starting at the region min and advancing by stepSize.
+        //! Providers and modifiers are culled against the region once instead of once per point, and results are cached
+        //! until a provider or modifier reports a change that overlaps the region.
+        virtual void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags, SurfacePointGrid& surfacePointGrid) const = 0;
+
         virtual SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) = 0;
         virtual void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) = 0;
         virtual void UpdateSurfaceDataProvider(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry, const AZ::Aabb& dirtyBoundsOverride) = 0;
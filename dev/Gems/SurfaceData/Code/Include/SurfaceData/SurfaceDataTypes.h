@@ -26,6 +26,14 @@ namespace SurfaceData
     using SurfaceTagNameSet = AZStd::unordered_set<AZStd::string>;
     using SurfaceTagVector = AZStd::vector<SurfaceTag>;
 
+    //! Fixed width bit set of surface tags, each tag owns the bit returned by SurfaceTag::GetMaskBit()
+    struct SurfaceTagMask final
+    {
+        AZ::u64 m_bits = 0;
+        //! false when some of the tags didn't get a bit, such a mask can't prove that two tag sets have nothing in common
+        bool m_complete = true;
+    };
+
     struct SurfacePoint final
     {
         AZ_CLASS_ALLOCATOR(SurfacePoint, AZ::SystemAllocator, 0);
@@ -39,6 +47,30 @@ namespace SurfaceData
 
     using SurfacePointList = AZStd::vector<SurfacePoint>;
 
+    //! Results of a region query, stored as parallel arrays with one entry per sampled position in row-major (x then y) order
+    struct SurfacePointGrid final
+    {
+        AZ_CLASS_ALLOCATOR(SurfacePointGrid, AZ::SystemAllocator, 0);
+
+        void Clear()
+        {
+            m_columns = 0;
+            m_rows = 0;
+            m_samplePositions.clear();
+            m_surfacePointLists.clear();
+        }
+
+        size_t GetIndex(size_t column, size_t row) const
+        {
+            return (row * m_columns) + column;
+        }
+
+        size_t m_columns = 0;
+        size_t m_rows = 0;
+        AZStd::vector<AZ::Vector3> m_samplePositions;
+        AZStd::vector<SurfacePointList> m_surfacePointLists;
+    };
+
     struct SurfaceDataRegistryEntry
     {
         AZ::EntityId m_entityId;
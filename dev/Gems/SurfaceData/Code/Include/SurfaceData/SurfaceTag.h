@@ -53,6 +53,10 @@ namespace SurfaceData
 
         static AZStd::vector<AZStd::pair<AZ::u32, AZStd::string>> GetRegisteredTags();
 
+        //! Returns the bit that stands for this tag in a SurfaceTagMask.
+        //! Bits are handed out process wide in the order tags are first used, once all of them are taken 0 is returned.
+        AZ::u64 GetMaskBit() const;
+
     private:
         bool FindDisplayName(const AZStd::vector<AZStd::pair<AZ::u32, AZStd::string>>& selectableTags, AZStd::string& name) const;
 
@@ -182,6 +182,36 @@ namespace SurfaceData
         return false;
     }
 
+    template<typename SourceContainer>
+    AZ_INLINE SurfaceTagMask GetSurfaceTagMask(const SourceContainer& sourceTags)
+    {
+        SurfaceTagMask mask;
+        for (const auto& sourceTag : sourceTags)
+        {
+            const AZ::u64 bit = SurfaceTag(AZ::Crc32(static_cast<AZ::u32>(sourceTag))).GetMaskBit();
+            mask.m_bits |= bit;
+            mask.m_complete = mask.m_complete && bit != 0;
+        }
+        return mask;
+    }
+
+    //! Same result as HasMatchingTags(sourceTags, sampleTags), the tags are only compared when the masks don't overlap and one of them is incomplete
+    template<typename SourceContainer, typename SampleContainer>
+    AZ_INLINE bool HasMatchingTags(const SourceContainer& sourceTags, const SurfaceTagMask& sourceMask, const SampleContainer& sampleTags, const SurfaceTagMask& sampleMask)
+    {
+        if ((sourceMask.m_bits & sampleMask.m_bits) != 0)
+        {
+            return true;
+        }
+
+        if (sourceMask.m_complete && sampleMask.m_complete)
+        {
+            return false;
+        }
+
+        return HasMatchingTags(sourceTags, sampleTags);
+    }
+
     AZ_INLINE bool HasMatchingTag(const SurfaceTagWeightMap& sourceTags, const AZ::Crc32& sampleTag, float valueMin, float valueMax)
     {
         auto maskItr = sourceTags.find(sampleTag);
@@ -28,6 +28,23 @@
 
 namespace SurfaceData
 {
+    namespace
+    {
+        //! upper bound on the number of region query results kept around, the oldest results are evicted first
+        static const size_t s_maxCachedRegions = 256;
+
+        //! Surface queries are projections along Z, so regions only need to be compared in XY
+        AZ_INLINE bool RegionsOverlap2D(const AZ::Aabb& a, const AZ::Aabb& b)
+        {
+            const AZ::Vector3 aMin = a.GetMin();
+            const AZ::Vector3 aMax = a.GetMax();
+            const AZ::Vector3 bMin = b.GetMin();
+            const AZ::Vector3 bMax = b.GetMax();
+            return static_cast<float>(aMin.GetX()) <= static_cast<float>(bMax.GetX()) && static_cast<float>(aMax.GetX()) >= static_cast<float>(bMin.GetX()) &&
+                static_cast<float>(aMin.GetY()) <= static_cast<float>(bMax.GetY()) && static_cast<float>(aMax.GetY()) >= static_cast<float>(bMin.GetY());
+        }
+    }
+
     void SurfaceDataSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         SurfaceTag::Reflect(context);
@@ -102,6 +119,9 @@ namespace SurfaceData
     void SurfaceDataSystemComponent::Deactivate()
     {
         SurfaceDataSystemRequestBus::Handler::BusDisconnect();
+
+        AZStd::lock_guard<decltype(m_regionCacheMutex)> cacheLock(m_regionCacheMutex);
+        m_regionCache.clear();
     }
 
     SurfaceDataRegistryHandle SurfaceDataSystemComponent::RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry)
@@ -109,6 +129,7 @@ namespace SurfaceData
         const SurfaceDataRegistryHandle handle = RegisterSurfaceDataProviderInternal(entry);
         if (handle != InvalidSurfaceDataRegistryHandle)
         {
+            InvalidateRegionCache(entry.m_bounds);
             SurfaceDataSystemNotificationBus::Broadcast(&SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, entry.m_bounds);
         }
         return handle;
@@ -119,15 +140,19 @@ namespace SurfaceData
         const SurfaceDataRegistryEntry entry = UnregisterSurfaceDataProviderInternal(handle);
         if (entry.m_entityId.IsValid())
         {
+            InvalidateRegionCache(entry.m_bounds);
             SurfaceDataSystemNotificationBus::Broadcast(&SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, entry.m_bounds);
         }
     }
 
     void SurfaceDataSystemComponent::UpdateSurfaceDataProvider(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry, const AZ::Aabb& dirtyBoundsOverride)
     {
-        if (UpdateSurfaceDataProviderInternal(handle, entry))
+        AZ::Aabb oldBounds = AZ::Aabb::CreateNull();
+        if (UpdateSurfaceDataProviderInternal(handle, entry, oldBounds))
         {
             const auto& bounds = dirtyBoundsOverride.IsValid() ? dirtyBoundsOverride : entry.m_bounds;
+            InvalidateRegionCache(oldBounds);
+            InvalidateRegionCache(bounds);
             SurfaceDataSystemNotificationBus::Broadcast(&SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, bounds);
         }
     }
@@ -137,6 +162,7 @@ namespace SurfaceData
         const SurfaceDataRegistryHandle handle = RegisterSurfaceDataModifierInternal(entry);
         if (handle != InvalidSurfaceDataRegistryHandle)
         {
+            InvalidateRegionCache(entry.m_bounds);
             SurfaceDataSystemNotificationBus::Broadcast(&SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, entry.m_bounds);
         }
         return handle;
@@ -147,15 +173,19 @@ namespace SurfaceData
         const SurfaceDataRegistryEntry entry = UnregisterSurfaceDataModifierInternal(handle);
         if (entry.m_entityId.IsValid())
         {
+            InvalidateRegionCache(entry.m_bounds);
             SurfaceDataSystemNotificationBus::Broadcast(&SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, entry.m_bounds);
         }
     }
 
     void SurfaceDataSystemComponent::UpdateSurfaceDataModifier(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry, const AZ::Aabb& dirtyBoundsOverride)
     {
-        if (UpdateSurfaceDataModifierInternal(handle, entry))
+        AZ::Aabb oldBounds = AZ::Aabb::CreateNull();
+        if (UpdateSurfaceDataModifierInternal(handle, entry, oldBounds))
         {
             const auto& bounds = dirtyBoundsOverride.IsValid() ? dirtyBoundsOverride : entry.m_bounds;
+            InvalidateRegionCache(oldBounds);
+            InvalidateRegionCache(bounds);
             SurfaceDataSystemNotificationBus::Broadcast(&SurfaceDataSystemNotificationBus::Events::OnSurfaceChanged, entry.m_entityId, bounds);
         }
     }
@@ -165,10 +195,12 @@ namespace SurfaceData
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
         const bool hasDesiredTags = HasValidTags(desiredTags);
-        const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
+        const SurfaceTagMask desiredTagMask = hasDesiredTags ? GetSurfaceTagMask(desiredTags) : SurfaceTagMask();
 
         AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
 
+        const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, desiredTagMask, m_registeredModifierTags, m_registeredModifierTagMask);
+
         surfacePointList.clear();
         surfacePointList.reserve(m_registeredSurfaceDataProviders.size());
 
@@ -176,11 +208,11 @@ namespace SurfaceData
         for (const auto& entryPair : m_registeredSurfaceDataProviders)
         {
             const AZ::u32 entryAddress = entryPair.first;
-            const SurfaceDataRegistryEntry& entry = entryPair.second;
+            const SurfaceDataRegistryEntry& entry = entryPair.second.m_entry;
             AZ::Vector3 point2d(inPosition.GetX(), inPosition.GetY(), entry.m_bounds.GetMax().GetZ());
             if (!entry.m_bounds.IsValid() || entry.m_bounds.Contains(point2d))
             {
-                if (!hasDesiredTags || hasModifierTags || HasMatchingTags(desiredTags, entry.m_tags))
+                if (!hasDesiredTags || hasModifierTags || HasMatchingTags(desiredTags, desiredTagMask, entry.m_tags, entryPair.second.m_tagMask))
                 {
                     SurfaceDataProviderRequestBus::Event(entryAddress, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point2d, surfacePointList);
                 }
@@ -191,7 +223,7 @@ namespace SurfaceData
         for (const auto& entryPair : m_registeredSurfaceDataModifiers)
         {
             const AZ::u32 entryAddress = entryPair.first;
-            const SurfaceDataRegistryEntry& entry = entryPair.second;
+            const SurfaceDataRegistryEntry& entry = entryPair.second.m_entry;
             AZ::Vector3 point2d(inPosition.GetX(), inPosition.GetY(), entry.m_bounds.GetMax().GetZ());
             if (!entry.m_bounds.IsValid() || entry.m_bounds.Contains(point2d))
             {
@@ -213,6 +245,183 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataSystemComponent::GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags, SurfacePointGrid& surfacePointGrid) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        surfacePointGrid.Clear();
+
+        if (!inRegion.IsValid() || stepSize.GetX() <= 0.0f || stepSize.GetY() <= 0.0f)
+        {
+            AZ_Assert(inRegion.IsValid(), "An invalid region was passed to GetSurfacePointsFromRegion");
+            AZ_Assert(stepSize.GetX() > 0.0f && stepSize.GetY() > 0.0f, "The step size passed to GetSurfacePointsFromRegion must be positive");
+            return;
+        }
+
+        if (FindCachedRegion(inRegion, stepSize, desiredTags, surfacePointGrid))
+        {
+            return;
+        }
+
+        AZ::u64 generation = 0;
+        {
+            AZStd::lock_guard<decltype(m_regionCacheMutex)> cacheLock(m_regionCacheMutex);
+            generation = m_regionCacheGeneration;
+        }
+
+        GetSurfacePointsFromRegionInternal(inRegion, stepSize, desiredTags, surfacePointGrid);
+
+        AZStd::lock_guard<decltype(m_regionCacheMutex)> cacheLock(m_regionCacheMutex);
+        // Only keep the results if nothing changed while they were being generated
+        if (generation == m_regionCacheGeneration)
+        {
+            if (m_regionCache.size() >= s_maxCachedRegions)
+            {
+                m_regionCache.erase(m_regionCache.begin());
+            }
+
+            RegionCacheEntry cacheEntry;
+            cacheEntry.m_region = inRegion;
+            cacheEntry.m_stepSize = stepSize;
+            cacheEntry.m_desiredTags = desiredTags;
+            cacheEntry.m_grid = surfacePointGrid;
+            m_regionCache.emplace_back(AZStd::move(cacheEntry));
+        }
+    }
+
+    void SurfaceDataSystemComponent::GetSurfacePointsFromRegionInternal(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags, SurfacePointGrid& surfacePointGrid) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        const AZ::Vector3 regionMin = inRegion.GetMin();
+        const AZ::Vector3 regionExtents = inRegion.GetExtents();
+        surfacePointGrid.m_columns = AZStd::max(static_cast<size_t>(ceilf(static_cast<float>(regionExtents.GetX()) / stepSize.GetX())), static_cast<size_t>(1));
+        surfacePointGrid.m_rows = AZStd::max(static_cast<size_t>(ceilf(static_cast<float>(regionExtents.GetY()) / stepSize.GetY())), static_cast<size_t>(1));
+
+        const size_t totalPoints = surfacePointGrid.m_columns * surfacePointGrid.m_rows;
+        surfacePointGrid.m_samplePositions.reserve(totalPoints);
+        surfacePointGrid.m_surfacePointLists.resize(totalPoints);
+
+        for (size_t row = 0; row < surfacePointGrid.m_rows; ++row)
+        {
+            const float y = static_cast<float>(regionMin.GetY()) + (stepSize.GetY() * static_cast<float>(row));
+            for (size_t column = 0; column < surfacePointGrid.m_columns; ++column)
+            {
+                const float x = static_cast<float>(regionMin.GetX()) + (stepSize.GetX() * static_cast<float>(column));
+                surfacePointGrid.m_samplePositions.emplace_back(x, y, regionMin.GetZ());
+            }
+        }
+
+        const bool hasDesiredTags = HasValidTags(desiredTags);
+        const SurfaceTagMask desiredTagMask = hasDesiredTags ? GetSurfaceTagMask(desiredTags) : SurfaceTagMask();
+
+        AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+
+        const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, desiredTagMask, m_registeredModifierTags, m_registeredModifierTagMask);
+
+        // Cull the providers and modifiers once against the whole region rather than once per point
+        AZStd::vector<const RegistryEntryMap::value_type*> regionProviders;
+        regionProviders.reserve(m_registeredSurfaceDataProviders.size());
+        for (const auto& entryPair : m_registeredSurfaceDataProviders)
+        {
+            const SurfaceDataRegistryEntry& entry = entryPair.second.m_entry;
+            if (!entry.m_bounds.IsValid() || RegionsOverlap2D(entry.m_bounds, inRegion))
+            {
+                if (!hasDesiredTags || hasModifierTags || HasMatchingTags(desiredTags, desiredTagMask, entry.m_tags, entryPair.second.m_tagMask))
+                {
+                    regionProviders.push_back(&entryPair);
+                }
+            }
+        }
+
+        AZStd::vector<const RegistryEntryMap::value_type*> regionModifiers;
+        regionModifiers.reserve(m_registeredSurfaceDataModifiers.size());
+        for (const auto& entryPair : m_registeredSurfaceDataModifiers)
+        {
+            const SurfaceDataRegistryEntry& entry = entryPair.second.m_entry;
+            if (!entry.m_bounds.IsValid() || RegionsOverlap2D(entry.m_bounds, inRegion))
+            {
+                regionModifiers.push_back(&entryPair);
+            }
+        }
+
+        for (size_t index = 0; index < totalPoints; ++index)
+        {
+            const AZ::Vector3& inPosition = surfacePointGrid.m_samplePositions[index];
+            SurfacePointList& surfacePointList = surfacePointGrid.m_surfacePointLists[index];
+            surfacePointList.reserve(regionProviders.size());
+
+            //gather all intersecting points, the remaining per-point bounds checks handle providers that only partially overlap the region
+            for (const auto* entryPair : regionProviders)
+            {
+                const SurfaceDataRegistryEntry& entry = entryPair->second.m_entry;
+                AZ::Vector3 point2d(inPosition.GetX(), inPosition.GetY(), entry.m_bounds.GetMax().GetZ());
+                if (!entry.m_bounds.IsValid() || entry.m_bounds.Contains(point2d))
+                {
+                    SurfaceDataProviderRequestBus::Event(entryPair->first, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point2d, surfacePointList);
+                }
+            }
+
+            //modify or annotate reported points
+            for (const auto* entryPair : regionModifiers)
+            {
+                const SurfaceDataRegistryEntry& entry = entryPair->second.m_entry;
+                AZ::Vector3 point2d(inPosition.GetX(), inPosition.GetY(), entry.m_bounds.GetMax().GetZ());
+                if (!entry.m_bounds.IsValid() || entry.m_bounds.Contains(point2d))
+                {
+                    SurfaceDataModifierRequestBus::Event(entryPair->first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, surfacePointList);
+                }
+            }
+
+            CombineSortedNeighboringPoints(surfacePointList);
+
+            //remove unwanted points
+            if (hasDesiredTags)
+            {
+                surfacePointList.erase(
+                    AZStd::remove_if(
+                        surfacePointList.begin(),
+                        surfacePointList.end(),
+                        [&desiredTags](const SurfacePoint& a) { return !HasMatchingTags(a.m_masks, desiredTags); }),
+                    surfacePointList.end());
+            }
+        }
+    }
+
+    bool SurfaceDataSystemComponent::FindCachedRegion(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags, SurfacePointGrid& surfacePointGrid) const
+    {
+        AZStd::lock_guard<decltype(m_regionCacheMutex)> cacheLock(m_regionCacheMutex);
+        for (const RegionCacheEntry& cacheEntry : m_regionCache)
+        {
+            if (cacheEntry.m_region == inRegion && cacheEntry.m_stepSize == stepSize && cacheEntry.m_desiredTags == desiredTags)
+            {
+                surfacePointGrid = cacheEntry.m_grid;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void SurfaceDataSystemComponent::InvalidateRegionCache(const AZ::Aabb& dirtyBounds)
+    {
+        AZStd::lock_guard<decltype(m_regionCacheMutex)> cacheLock(m_regionCacheMutex);
+        ++m_regionCacheGeneration;
+
+        // Providers and modifiers without valid bounds affect everything
+        if (!dirtyBounds.IsValid())
+        {
+            m_regionCache.clear();
+            return;
+        }
+
+        m_regionCache.erase(
+            AZStd::remove_if(
+                m_regionCache.begin(),
+                m_regionCache.end(),
+                [&dirtyBounds](const RegionCacheEntry& cacheEntry) { return RegionsOverlap2D(cacheEntry.m_region, dirtyBounds); }),
+            m_regionCache.end());
+    }
+
     void SurfaceDataSystemComponent::CombineSortedNeighboringPoints(SurfacePointList& sourcePointList) const
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
@@ -267,7 +476,7 @@ namespace SurfaceData
     {
         AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
         SurfaceDataRegistryHandle handle = ++m_registeredSurfaceDataProviderHandleCounter;
-        m_registeredSurfaceDataProviders[handle] = entry;
+        m_registeredSurfaceDataProviders[handle] = { entry, GetSurfaceTagMask(entry.m_tags) };
         return handle;
     }
 
@@ -278,19 +487,20 @@ namespace SurfaceData
         auto entryItr = m_registeredSurfaceDataProviders.find(handle);
         if (entryItr != m_registeredSurfaceDataProviders.end())
         {
-            entry = entryItr->second;
+            entry = entryItr->second.m_entry;
             m_registeredSurfaceDataProviders.erase(entryItr);
         }
         return entry;
     }
 
-    bool SurfaceDataSystemComponent::UpdateSurfaceDataProviderInternal(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry)
+    bool SurfaceDataSystemComponent::UpdateSurfaceDataProviderInternal(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry, AZ::Aabb& oldBounds)
     {
         AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
         auto entryItr = m_registeredSurfaceDataProviders.find(handle);
         if (entryItr != m_registeredSurfaceDataProviders.end())
         {
-            entryItr->second = entry;
+            oldBounds = entryItr->second.m_entry.m_bounds;
+            entryItr->second = { entry, GetSurfaceTagMask(entry.m_tags) };
             return true;
         }
         return false;
@@ -300,8 +510,9 @@ namespace SurfaceData
     {
         AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
         SurfaceDataRegistryHandle handle = ++m_registeredSurfaceDataModifierHandleCounter;
-        m_registeredSurfaceDataModifiers[handle] = entry;
+        m_registeredSurfaceDataModifiers[handle] = { entry, GetSurfaceTagMask(entry.m_tags) };
         m_registeredModifierTags.insert(entry.m_tags.begin(), entry.m_tags.end());
+        m_registeredModifierTagMask = GetSurfaceTagMask(m_registeredModifierTags);
         return handle;
     }
 
@@ -312,20 +523,22 @@ namespace SurfaceData
         auto entryItr = m_registeredSurfaceDataModifiers.find(handle);
         if (entryItr != m_registeredSurfaceDataModifiers.end())
         {
-            entry = entryItr->second;
+            entry = entryItr->second.m_entry;
             m_registeredSurfaceDataModifiers.erase(entryItr);
         }
         return entry;
     }
 
-    bool SurfaceDataSystemComponent::UpdateSurfaceDataModifierInternal(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry)
+    bool SurfaceDataSystemComponent::UpdateSurfaceDataModifierInternal(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry, AZ::Aabb& oldBounds)
     {
         AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
         auto entryItr = m_registeredSurfaceDataModifiers.find(handle);
         if (entryItr != m_registeredSurfaceDataModifiers.end())
         {
-            entryItr->second = entry;
+            oldBounds = entryItr->second.m_entry.m_bounds;
+            entryItr->second = { entry, GetSurfaceTagMask(entry.m_tags) };
             m_registeredModifierTags.insert(entry.m_tags.begin(), entry.m_tags.end());
+            m_registeredModifierTagMask = GetSurfaceTagMask(m_registeredModifierTags);
             return true;
         }
         return false;
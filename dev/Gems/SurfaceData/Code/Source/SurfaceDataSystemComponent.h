@@ -14,6 +14,7 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 
 namespace SurfaceData
@@ -43,6 +44,7 @@ namespace SurfaceData
         ////////////////////////////////////////////////////////////////////////
         // SurfaceDataSystemRequestBus implementation
         virtual void GetSurfacePoints(const AZ::Vector3& inPosition, const SurfaceTagVector& masks, SurfacePointList& surfacePointList) const override;
+        virtual void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags, SurfacePointGrid& surfacePointGrid) const override;
 
         virtual SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) override;
         virtual void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) override;
@@ -53,24 +55,53 @@ namespace SurfaceData
         virtual void UpdateSurfaceDataModifier(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry, const AZ::Aabb& dirtyBoundsOverride) override;
 
     private:
+        //! Registered provider or modifier along with the mask of its tags, so queries can match it against the desired tags with a single AND
+        struct RegisteredEntry
+        {
+            SurfaceDataRegistryEntry m_entry;
+            SurfaceTagMask m_tagMask;
+        };
+
+        using RegistryEntryMap = AZStd::unordered_map<SurfaceDataRegistryHandle, RegisteredEntry>;
+
+        //! Cached results of a previous region query
+        struct RegionCacheEntry
+        {
+            AZ::Aabb m_region = AZ::Aabb::CreateNull();
+            AZ::Vector2 m_stepSize = AZ::Vector2::CreateZero();
+            SurfaceTagVector m_desiredTags;
+            SurfacePointGrid m_grid;
+        };
+
         void CombineSortedNeighboringPoints(SurfacePointList& sourcePointList) const;
 
+        void GetSurfacePointsFromRegionInternal(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags, SurfacePointGrid& surfacePointGrid) const;
+        bool FindCachedRegion(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceTagVector& desiredTags, SurfacePointGrid& surfacePointGrid) const;
+        void InvalidateRegionCache(const AZ::Aabb& dirtyBounds);
+
         SurfaceDataRegistryHandle RegisterSurfaceDataProviderInternal(const SurfaceDataRegistryEntry& entry);
         SurfaceDataRegistryEntry UnregisterSurfaceDataProviderInternal(const SurfaceDataRegistryHandle& handle);
-        bool UpdateSurfaceDataProviderInternal(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry);
+        bool UpdateSurfaceDataProviderInternal(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry, AZ::Aabb& oldBounds);
 
         SurfaceDataRegistryHandle RegisterSurfaceDataModifierInternal(const SurfaceDataRegistryEntry& entry);
         SurfaceDataRegistryEntry UnregisterSurfaceDataModifierInternal(const SurfaceDataRegistryHandle& handle);
-        bool UpdateSurfaceDataModifierInternal(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry);
+        bool UpdateSurfaceDataModifierInternal(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry, AZ::Aabb& oldBounds);
 
         mutable AZStd::recursive_mutex m_registrationMutex;
-        AZStd::unordered_map<SurfaceDataRegistryHandle, SurfaceDataRegistryEntry> m_registeredSurfaceDataProviders;
-        AZStd::unordered_map<SurfaceDataRegistryHandle, SurfaceDataRegistryEntry> m_registeredSurfaceDataModifiers;
+        RegistryEntryMap m_registeredSurfaceDataProviders;
+        RegistryEntryMap m_registeredSurfaceDataModifiers;
         SurfaceDataRegistryHandle m_registeredSurfaceDataProviderHandleCounter = InvalidSurfaceDataRegistryHandle;
         SurfaceDataRegistryHandle m_registeredSurfaceDataModifierHandleCounter = InvalidSurfaceDataRegistryHandle;
         AZStd::unordered_set<AZ::u32> m_registeredModifierTags;
+        SurfaceTagMask m_registeredModifierTagMask;
 
         //point vector reserved for reuse
         mutable SurfacePointList m_targetPointList;
+
+        //region query results, oldest first, invalidated through the provider and modifier dirty bounds
+        mutable AZStd::mutex m_regionCacheMutex;
+        mutable AZStd::vector<RegionCacheEntry> m_regionCache;
+        //incremented on every invalidation so that queries started before a change don't cache stale results
+        AZ::u64 m_regionCacheGeneration = 0;
     };
 }
@@ -18,6 +18,10 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <SurfaceData/SurfaceDataTagProviderRequestBus.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/sort.h>
 
 namespace SurfaceData
@@ -49,6 +53,70 @@ namespace SurfaceData
             }
             return true;
         }
+
+        //! Tags that own a bit of SurfaceTagMask, shared by all modules through the environment so every module agrees on the bits.
+        //! Slots are filled in order and never change once set, so lookups don't need the lock that claiming a slot takes.
+        class MaskBitTable
+        {
+        public:
+            static const size_t s_bitCount = 64;
+
+            MaskBitTable()
+            {
+                for (AZStd::atomic<AZ::u64>& slot : m_slots)
+                {
+                    slot.store(0, AZStd::memory_order_relaxed);
+                }
+            }
+
+            AZ::u64 FindOrAdd(AZ::u32 tagCrc)
+            {
+                // the flag above the crc marks a used slot, since any crc value including 0 is a valid tag
+                const AZ::u64 slotValue = s_usedSlotFlag | tagCrc;
+
+                size_t index = Find(slotValue);
+                if (index == s_bitCount || m_slots[index].load(AZStd::memory_order_acquire) != slotValue)
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_addMutex);
+                    index = Find(slotValue);
+                    if (index == s_bitCount)
+                    {
+                        return 0;
+                    }
+                    if (m_slots[index].load(AZStd::memory_order_acquire) != slotValue)
+                    {
+                        m_slots[index].store(slotValue, AZStd::memory_order_release);
+                    }
+                }
+                return AZ::u64(1) << index;
+            }
+
+        private:
+            //! Returns the slot of the value or the first free slot, s_bitCount when the value isn't there and all slots are taken
+            size_t Find(AZ::u64 slotValue) const
+            {
+                for (size_t index = 0; index < s_bitCount; ++index)
+                {
+                    const AZ::u64 value = m_slots[index].load(AZStd::memory_order_acquire);
+                    if (value == slotValue || value == 0)
+                    {
+                        return index;
+                    }
+                }
+                return s_bitCount;
+            }
+
+            static const AZ::u64 s_usedSlotFlag = AZ::u64(1) << 32;
+
+            AZStd::atomic<AZ::u64> m_slots[s_bitCount];
+            AZStd::mutex m_addMutex;
+        };
+
+        static MaskBitTable& GetMaskBitTable()
+        {
+            static AZ::EnvironmentVariable<MaskBitTable> s_maskBitTable = AZ::Environment::CreateVariable<MaskBitTable>(AZ_CRC("SurfaceData::SurfaceTagMaskBits", 0xf979bb28));
+            return *s_maskBitTable;
+        }
     }
 
     void SurfaceTag::Reflect(AZ::ReflectContext* context)
@@ -151,6 +219,11 @@ namespace SurfaceData
         return selectableTags;
     }
 
+    AZ::u64 SurfaceTag::GetMaskBit() const
+    {
+        return SurfaceTagUtil::GetMaskBitTable().FindOrAdd(m_surfaceTagCrc);
+    }
+
     AZStd::string SurfaceTag::GetDisplayName() const
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
@@ -28,6 +28,7 @@
 #include <SurfaceDataSystemComponent.h>
 #include <SurfaceDataModule.h>
 #include <SurfaceData/SurfaceDataProviderRequestBus.h>
+#include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/SurfaceTag.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 
@@ -78,6 +79,56 @@ TEST(SurfaceDataTest, ComponentsWithComponentApplication)
     ASSERT_TRUE(true);
 }
 
+// Flat surface at a configurable height that reports the points it is asked about
+class MockSurfaceProvider
+    : public SurfaceData::SurfaceDataProviderRequestBus::Handler
+{
+public:
+    MockSurfaceProvider(const AZ::Aabb& bounds, const SurfaceData::SurfaceTag& tag)
+        : m_tag(tag)
+    {
+        m_entry.m_entityId = AZ::EntityId(0x1234);
+        m_entry.m_bounds = bounds;
+        m_entry.m_tags.push_back(tag);
+        SurfaceData::SurfaceDataSystemRequestBus::BroadcastResult(m_handle, &SurfaceData::SurfaceDataSystemRequestBus::Events::RegisterSurfaceDataProvider, m_entry);
+        BusConnect(m_handle);
+    }
+
+    ~MockSurfaceProvider()
+    {
+        BusDisconnect();
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::UnregisterSurfaceDataProvider, m_handle);
+    }
+
+    void SetHeight(float height, bool notify)
+    {
+        m_height = height;
+        if (notify)
+        {
+            SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::UpdateSurfaceDataProvider, m_handle, m_entry, AZ::Aabb::CreateNull());
+        }
+    }
+
+    void GetSurfacePoints(const AZ::Vector3& inPosition, SurfaceData::SurfacePointList& surfacePointList) const override
+    {
+        ++m_queryCount;
+        SurfaceData::SurfacePoint point;
+        point.m_entityId = m_entry.m_entityId;
+        point.m_position = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), m_height);
+        point.m_normal = AZ::Vector3::CreateAxisZ();
+        point.m_masks[m_tag] = 1.0f;
+        surfacePointList.push_back(point);
+    }
+
+    mutable int m_queryCount = 0;
+
+private:
+    SurfaceData::SurfaceTag m_tag;
+    SurfaceData::SurfaceDataRegistryEntry m_entry;
+    SurfaceData::SurfaceDataRegistryHandle m_handle = SurfaceData::InvalidSurfaceDataRegistryHandle;
+    float m_height = 0.0f;
+};
+
 class SurfaceDataTestApp
     : public ::testing::Test
 {
@@ -130,6 +181,36 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestRegisteredTags)
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TestTagMaskMatching)
+{
+    const SurfaceData::SurfaceTag tagA(AZStd::string("mask_test_a"));
+    const SurfaceData::SurfaceTag tagB(AZStd::string("mask_test_b"));
+
+    // a tag always gets the same bit and different tags get different bits
+    EXPECT_NE(0u, tagA.GetMaskBit());
+    EXPECT_EQ(tagA.GetMaskBit(), SurfaceData::SurfaceTag(AZStd::string("mask_test_a")).GetMaskBit());
+    EXPECT_EQ(0u, tagA.GetMaskBit() & tagB.GetMaskBit());
+
+    // use up all the bits, the masks of tags without a bit are incomplete but matching must give the same results
+    SurfaceData::SurfaceTagVector manyTags;
+    for (int i = 0; i < 80; ++i)
+    {
+        manyTags.push_back(SurfaceData::SurfaceTag(AZStd::string::format("mask_test_%d", i)));
+    }
+    const SurfaceData::SurfaceTagMask manyTagsMask = SurfaceData::GetSurfaceTagMask(manyTags);
+    EXPECT_FALSE(manyTagsMask.m_complete);
+
+    const SurfaceData::SurfaceTagVector lastTag = { manyTags.back() };
+    const SurfaceData::SurfaceTagVector otherTags = { tagA, tagB };
+    const SurfaceData::SurfaceTagMask lastTagMask = SurfaceData::GetSurfaceTagMask(lastTag);
+    const SurfaceData::SurfaceTagMask otherTagsMask = SurfaceData::GetSurfaceTagMask(otherTags);
+    EXPECT_TRUE(otherTagsMask.m_complete);
+
+    EXPECT_TRUE(SurfaceData::HasMatchingTags(manyTags, manyTagsMask, lastTag, lastTagMask));
+    EXPECT_FALSE(SurfaceData::HasMatchingTags(manyTags, manyTagsMask, otherTags, otherTagsMask));
+    EXPECT_FALSE(SurfaceData::HasMatchingTags(lastTag, lastTagMask, otherTags, otherTagsMask));
+    EXPECT_TRUE(SurfaceData::HasMatchingTags(otherTags, otherTagsMask, SurfaceData::SurfaceTagVector{ tagB }, SurfaceData::GetSurfaceTagMask(SurfaceData::SurfaceTagVector{ tagB })));
+}
 
 TEST_F(SurfaceDataTestApp, SurfaceData_TestGetQuadListRayIntersection)
 {
@@ -216,5 +297,60 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestGetQuadListRayIntersection)
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TestGetSurfacePointsFromRegion)
+{
+    const SurfaceData::SurfaceTag testTag(AZStd::string("test_surface"));
+    const SurfaceData::SurfaceTagVector desiredTags = { testTag };
+
+    // The provider only covers part of the query region, so points outside of it shouldn't get any surface points
+    MockSurfaceProvider provider(AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f, 0.0f, -10.0f), AZ::Vector3(2.0f, 4.0f, 10.0f)), testTag);
+    provider.SetHeight(5.0f, true);
+
+    const AZ::Aabb region = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f, 0.0f, 0.0f), AZ::Vector3(4.0f, 4.0f, 0.0f));
+    const AZ::Vector2 stepSize(1.0f, 1.0f);
+
+    SurfaceData::SurfacePointGrid grid;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion, region, stepSize, desiredTags, grid);
+
+    ASSERT_EQ(grid.m_columns, 4u);
+    ASSERT_EQ(grid.m_rows, 4u);
+    ASSERT_EQ(grid.m_samplePositions.size(), 16u);
+    ASSERT_EQ(grid.m_surfacePointLists.size(), 16u);
+
+    for (size_t row = 0; row < grid.m_rows; ++row)
+    {
+        for (size_t column = 0; column < grid.m_columns; ++column)
+        {
+            const size_t index = grid.GetIndex(column, row);
+            const AZ::Vector3& samplePosition = grid.m_samplePositions[index];
+            EXPECT_TRUE(samplePosition.IsClose(AZ::Vector3(static_cast<float>(column), static_cast<float>(row), 0.0f)));
+
+            // Provider bounds are inclusive, so columns 0 through 2 are inside of it
+            const SurfaceData::SurfacePointList& points = grid.m_surfacePointLists[index];
+            if (column <= 2)
+            {
+                ASSERT_EQ(points.size(), 1u);
+                EXPECT_FLOAT_EQ(points[0].m_position.GetZ(), 5.0f);
+            }
+            else
+            {
+                EXPECT_TRUE(points.empty());
+            }
+        }
+    }
+
+    // A repeated query should come from the cache without touching the provider
+    const int queryCount = provider.m_queryCount;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion, region, stepSize, desiredTags, grid);
+    EXPECT_EQ(provider.m_queryCount, queryCount);
+    EXPECT_FLOAT_EQ(grid.m_surfacePointLists[0][0].m_position.GetZ(), 5.0f);
+
+    // Updating the provider should invalidate the cached results
+    provider.SetHeight(7.0f, true);
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion, region, stepSize, desiredTags, grid);
+    EXPECT_GT(provider.m_queryCount, queryCount);
+    ASSERT_EQ(grid.m_surfacePointLists[0].size(), 1u);
+    EXPECT_FLOAT_EQ(grid.m_surfacePointLists[0][0].m_position.GetZ(), 7.0f);
+}
 
 AZ_UNIT_TEST_HOOK();
\ No newline at end of file
@@ -21,6 +21,7 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Module/ModuleManager.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/conversions.h>
 
 namespace TickBusOrderViewer
@@ -152,6 +153,51 @@ namespace TickBusOrderViewer
         PrintTickbusHandlers(&entityId);
     }
 
+    /**
+    * Console command to print the time spent ticking each type of tickbus handler.
+    * The first call starts collecting the times, the following calls print what was collected.
+    * Passing "off" stops the collection.
+    */
+    void PrintTickbusHandlerCosts(IConsoleCmdArgs* args)
+    {
+        if (args != nullptr && args->GetArgCount() > 1 && azstricmp(args->GetArg(1), "off") == 0)
+        {
+            AZ::TickRequestBus::Broadcast(&AZ::TickRequestBus::Events::SetTickHandlerStatsEnabled, false);
+            AZ_Printf("TickBusOrderViewer", "Stopped collecting tickbus handler costs.");
+            return;
+        }
+
+        bool isEnabled = false;
+        AZ::TickRequestBus::BroadcastResult(isEnabled, &AZ::TickRequestBus::Events::IsTickHandlerStatsEnabled);
+        if (!isEnabled)
+        {
+            AZ::TickRequestBus::Broadcast(&AZ::TickRequestBus::Events::SetTickHandlerStatsEnabled, true);
+            AZ_Printf("TickBusOrderViewer", "Started collecting tickbus handler costs, run print_tickbus_handler_costs again to print them.");
+            return;
+        }
+
+        AZStd::vector<AZ::TickHandlerTypeStats> stats;
+        AZ::TickRequestBus::Broadcast(&AZ::TickRequestBus::Events::GetTickHandlerStats, stats);
+
+        // The most expensive types are the interesting ones, so print them first.
+        AZStd::sort(stats.begin(), stats.end(), [](const AZ::TickHandlerTypeStats& left, const AZ::TickHandlerTypeStats& right)
+        {
+            return left.m_lastTickTime > right.m_lastTickTime;
+        });
+
+        AZ_Printf("TickBusOrderViewer", "TickBus handler costs by type, last tick and average per tick");
+        for (const AZ::TickHandlerTypeStats& typeStats : stats)
+        {
+            const AZ::u64 averageTime = typeStats.m_tickCount > 0 ? typeStats.m_totalTickTime.count() / typeStats.m_tickCount : 0;
+            AZ_Printf("TickBusOrderViewer", "\t%s %s - %u handlers, %lld us, average %llu us",
+                typeStats.m_typeName,
+                typeStats.m_typeId.ToString<AZStd::string>().c_str(),
+                typeStats.m_handlerCount,
+                static_cast<long long>(typeStats.m_lastTickTime.count()),
+                averageTime);
+        }
+    }
+
     class TickBusOrderViewerModule
         : public CryHooksModule
     {
@@ -188,6 +234,10 @@ namespace TickBusOrderViewer
             // Register the command to print the tickbus handlers out.
             REGISTER_COMMAND("print_tickbus_handlers", &PrintTickbusHandlerOrder, 0, "Prints out the handlers for the tickbus in tick order. "
             "With zero parameters, prints all handlers. With one parameter, it converts that to an entity ID and only prints components for that entity.");
+
+            // Register the command to print the time spent ticking each handler type.
+            REGISTER_COMMAND("print_tickbus_handler_costs", &PrintTickbusHandlerCosts, 0, "Prints out the time spent ticking each type of tickbus handler. "
+            "The first call starts collecting the times, the following calls print them. With the parameter off, stops collecting the times.");
         }
     };
 }
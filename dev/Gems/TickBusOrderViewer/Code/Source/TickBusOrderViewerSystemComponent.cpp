@@ -29,7 +29,7 @@ namespace TickBusOrderViewer
             {
                 ec->Class<TickBusOrderViewerSystemComponent>(
                     "TickBusOrderViewer", 
-                    "Provides a console command for viewing tick bus order, print_tickbus_handlers.")
+                    "Provides console commands for viewing tick bus order and cost, print_tickbus_handlers and print_tickbus_handler_costs.")
                     ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
                         ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System"))
                         ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
@@ -40,14 +40,14 @@ namespace TouchBending
         //*********************************************************************
         // Helper classes & Functions START *********************************************
 
-        /** @brief
+        /** @brief Fills the geometry of one bone. The geometry is held by value, PhysX copies it into the shape.
          *
-         *  @param newGeometryOut
+         *  @param geometryOut
          *  @param segment
          *  @param segmentShapeType
-         *  @returns The volume of the geometry.
+         *  @returns The volume of the geometry, 0 if segmentShapeType is unsupported (geometryOut is left untouched).
          */
-        static float CreateBoneGeometry(PxGeometry** newGeometryOut,
+        static float CreateBoneGeometry(PxGeometryHolder& geometryOut,
             const float boneLength, const float boneThickness,
             const SegmentShapeType segmentShapeType,
             const float scale)
@@ -60,9 +60,8 @@ namespace TouchBending
             {
             case SegmentShapeType::BOX:
             {
-                PxBoxGeometry* boxGeometry = new PxBoxGeometry(thickness, thickness, halfLength);
+                geometryOut.storeAny(PxBoxGeometry(thickness, thickness, halfLength));
                 volume = (thickness * thickness * halfLength) * 8.0f;
-                *newGeometryOut = boxGeometry;
             }
                 break;
             case SegmentShapeType::CAPSULE:
@@ -75,20 +74,18 @@ namespace TouchBending
                 // than the requested segment length.
                 const float minimumHalfCylinderLength = 0.001f;
                 const float halfCylinderLength = AZ::GetMax(minimumHalfCylinderLength, halfLength - radius);
-                PxCapsuleGeometry* capsuleGeometry = new PxCapsuleGeometry(radius, halfCylinderLength);
+                geometryOut.storeAny(PxCapsuleGeometry(radius, halfCylinderLength));
                 const float cylinderVolume = (AZ::Constants::Pi * radius * radius) * (halfCylinderLength * 2.0f);
                 const float sphereVolume = (4.0f / 3.0f) * (AZ::Constants::Pi * radius * radius * radius);
                 volume = cylinderVolume + sphereVolume;
-                *newGeometryOut = capsuleGeometry;
             }
                 break;
             case SegmentShapeType::SPHERE:
             {
                 const float radius = halfLength;
-                PxSphereGeometry* sphereGeometry = new PxSphereGeometry(radius);
+                geometryOut.storeAny(PxSphereGeometry(radius));
                 const float sphereVolume = (4.0f / 3.0f) * (AZ::Constants::Pi * radius * radius * radius);
                 volume = sphereVolume;
-                *newGeometryOut = sphereGeometry;
             }
             break;
             default:
@@ -203,9 +200,9 @@ namespace TouchBending
                     const float boneVectorLength = boneVector.GetLength();
                     const AZ::Vector3 boneVectorNormalized = boneVector * (1.0f / boneVectorLength);
 
-                    PxGeometry* boneGeometry = nullptr;
-                    const float boneVolume = CreateBoneGeometry(&boneGeometry, boneVectorLength, boneBottomPoint->m_thickness, segmentShapeType, 1.0f);
-                    if (!boneGeometry || boneVolume <= 0.0f)
+                    PxGeometryHolder boneGeometry;
+                    const float boneVolume = CreateBoneGeometry(boneGeometry, boneVectorLength, boneBottomPoint->m_thickness, segmentShapeType, 1.0f);
+                    if (boneVolume <= 0.0f)
                     {
                         AZ_Error(TRACE_WINDOW_NAME, false, "Failed to create geometry for Spine Index=%zu, at Segment Index=%u", spineIndex, pointIndex);
                         return false;
@@ -226,11 +223,10 @@ namespace TouchBending
 #else
                     const PxShapeFlags shapeFlags = PxShapeFlag::eSIMULATION_SHAPE;
 #endif
-                    PxShape* pxShape = PxRigidActorExt::createExclusiveShape(*pxRigidDynamicBone, *boneGeometry, pxMaterial, shapeFlags);
+                    PxShape* pxShape = PxRigidActorExt::createExclusiveShape(*pxRigidDynamicBone, boneGeometry.any(), pxMaterial, shapeFlags);
                     if (!pxShape)
                     {
                         AZ_Error(TRACE_WINDOW_NAME, false, "Failed to create shape for spine Index=%zu, at bone Index=%u", spineIndex, boneIndex);
-                        delete boneGeometry;
                         return false;
                     }
                     if (segmentShapeType == SegmentShapeType::CAPSULE)
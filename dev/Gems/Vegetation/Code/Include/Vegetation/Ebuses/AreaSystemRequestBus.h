@@ -14,6 +14,8 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace Vegetation
 {
@@ -26,6 +28,8 @@ namespace Vegetation
         KeepEnumerating,
     };
     using AreaSystemEnumerateCallback = AZStd::function<AreaSystemEnumerateCallbackResult(const InstanceData&)>;
+    //receives the index of the probe point an instance was found near
+    using AreaSystemEnumerateBatchCallback = AZStd::function<AreaSystemEnumerateCallbackResult(size_t, const InstanceData&)>;
 
     /**
     * A bus to signal the life times of vegetation areas
@@ -58,6 +62,15 @@ namespace Vegetation
 
         // visit all instances contained within bounds until callback decides otherwise
         virtual void EnumerateInstancesInAabb(const AZ::Aabb& bounds, AreaSystemEnumerateCallback callback) const = 0;
+
+        // visit only instances positioned inside bounds, using the per sector spatial index
+        virtual void EnumerateInstancesWithPositionInAabb(const AZ::Aabb& bounds, AreaSystemEnumerateCallback callback) const = 0;
+
+        // visit instances positioned within radius of the segment from start to end
+        virtual void EnumerateInstancesAlongRay(const AZ::Vector3& start, const AZ::Vector3& end, float radius, AreaSystemEnumerateCallback callback) const = 0;
+
+        // visit instances positioned within radius of each probe point, stopping all probes if the callback decides otherwise
+        virtual void EnumerateInstancesNearPoints(const AZStd::vector<AZ::Vector3>& points, float radius, AreaSystemEnumerateBatchCallback callback) const = 0;
     };
 
     using AreaSystemRequestBus = AZ::EBus<AreaSystemRequests>;
@@ -26,6 +26,7 @@ namespace Vegetation
         AZStd::atomic_int m_areaTaskActiveCount{ 0 };
         AZStd::atomic_int m_instanceRegisterCount{ 0 };
         AZStd::atomic_int m_instanceUnregisterCount{ 0 };
+        AZStd::atomic_int m_instancePooledCount{ 0 };
     };
 
     class DebugSystemData
@@ -26,8 +26,12 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/utils.h>
 
@@ -45,6 +49,55 @@ namespace Vegetation
             seed ^= hasher(v) + 0x9e3779b97f4a7c13LL + (seed << 12) + (seed >> 4);
         }
 
+        //2d slab test of the segment against a rect
+        static bool SegmentOverlapsRect(const AZ::Vector2& start, const AZ::Vector2& end, const AZ::Vector2& rectMin, const AZ::Vector2& rectMax)
+        {
+            float tMin = 0.0f;
+            float tMax = 1.0f;
+            for (int axis = 0; axis < 2; ++axis)
+            {
+                const float origin = axis == 0 ? start.GetX() : start.GetY();
+                const float delta = (axis == 0 ? end.GetX() : end.GetY()) - origin;
+                const float slabMin = axis == 0 ? rectMin.GetX() : rectMin.GetY();
+                const float slabMax = axis == 0 ? rectMax.GetX() : rectMax.GetY();
+                if (fabsf(delta) < AZ_FLT_EPSILON)
+                {
+                    if (origin < slabMin || origin > slabMax)
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+
+                float t0 = (slabMin - origin) / delta;
+                float t1 = (slabMax - origin) / delta;
+                if (t0 > t1)
+                {
+                    AZStd::swap(t0, t1);
+                }
+                tMin = AZ::GetMax(tMin, t0);
+                tMax = AZ::GetMin(tMax, t1);
+                if (tMin > tMax)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static float GetDistanceSqToSegment(const AZ::Vector3& point, const AZ::Vector3& start, const AZ::Vector3& end)
+        {
+            const AZ::Vector3 segment = end - start;
+            const float lengthSq = static_cast<float>(segment.GetLengthSq());
+            if (lengthSq <= 0.0f)
+            {
+                return static_cast<float>(point.GetDistanceSq(start));
+            }
+
+            const float t = AZ::GetClamp(static_cast<float>((point - start).Dot(segment)) / lengthSq, 0.0f, 1.0f);
+            return static_cast<float>(point.GetDistanceSq(start + segment * t));
+        }
+
         static bool UpdateVersion(AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement)
         {
             if (classElement.GetVersion() < 4)
@@ -93,6 +146,7 @@ namespace Vegetation
     const int AreaSystemConfig::s_maxViewRectangleSize = 128;
     const int AreaSystemConfig::s_maxSectorDensity = 64;
     const int AreaSystemConfig::s_maxSectorSizeInMeters = 1024;
+    const int AreaSystemConfig::s_maxInFlightSectors = 64;
     const int64_t AreaSystemConfig::s_maxVegetationInstances = 2 * 1024 * 1024;
     const int AreaSystemConfig::s_maxInstancesPerMeter = 16;
 
@@ -109,6 +163,7 @@ namespace Vegetation
                 ->Field("ThreadProcessingIntervalMs", &AreaSystemConfig::m_threadProcessingIntervalMs)
                 ->Field("SectorSearchPadding", &AreaSystemConfig::m_sectorSearchPadding)
                 ->Field("SectorPointSnapMode", &AreaSystemConfig::m_sectorPointSnapMode)
+                ->Field("MaxInFlightSectors", &AreaSystemConfig::m_maxInFlightSectors)
                 ;
 
             AZ::EditContext* edit = serialize->GetEditContext();
@@ -139,6 +194,9 @@ namespace Vegetation
                     ->DataElement(AZ::Edit::UIHandlers::ComboBox, &AreaSystemConfig::m_sectorPointSnapMode, "Sector Point Snap Mode", "Controls whether vegetation placement points are located at the corner or the center of the cell.")
                     ->EnumAttribute(SnapMode::Corner, "Corner")
                     ->EnumAttribute(SnapMode::Center, "Center")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &AreaSystemConfig::m_maxInFlightSectors, "Max In-Flight Sectors", "The maximum number of sectors gathering surface points concurrently on the job system.  A value of 1 processes sectors serially on the vegetation thread.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->Attribute(AZ::Edit::Attributes::Max, s_maxInFlightSectors)
                     ;
             }
         }
@@ -156,6 +214,7 @@ namespace Vegetation
                 ->Property("sectorPointSnapMode",
                     [](AreaSystemConfig* config) { return static_cast<AZ::u8>(config->m_sectorPointSnapMode); },
                     [](AreaSystemConfig* config, const AZ::u8& i) { config->m_sectorPointSnapMode = static_cast<SnapMode>(i); })
+                ->Property("maxInFlightSectors", BehaviorValueProperty(&AreaSystemConfig::m_maxInFlightSectors))
                 ;
         }
     }
@@ -487,6 +546,134 @@ namespace Vegetation
         }
     }
 
+    template <typename TVisitor>
+    bool AreaSystemComponent::VisitSectorsInAabb(const AZ::Aabb& bounds, const TVisitor& visitor) const
+    {
+        const SectorId minSector = GetSectorId(bounds.GetMin());
+        const int minX = minSector.first - m_configuration.m_sectorSearchPadding;
+        const int minY = minSector.second - m_configuration.m_sectorSearchPadding;
+        const SectorId maxSector = GetSectorId(bounds.GetMax());
+        const int maxX = maxSector.first + m_configuration.m_sectorSearchPadding;
+        const int maxY = maxSector.second + m_configuration.m_sectorSearchPadding;
+
+        AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
+        for (int currX = minX; currX <= maxX; ++currX)
+        {
+            for (int currY = minY; currY <= maxY; ++currY)
+            {
+                const SectorInfo* sectorInfo = GetSector(SectorId(currX, currY));
+                if (sectorInfo && !visitor(*sectorInfo)) // manual sector id's can be outside the active area
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    void AreaSystemComponent::EnumerateInstancesWithPositionInAabb(const AZ::Aabb& bounds, AreaSystemEnumerateCallback callback) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        if (!bounds.IsValid())
+        {
+            return;
+        }
+
+        const AZ::Vector2 boundsMin(static_cast<float>(bounds.GetMin().GetX()), static_cast<float>(bounds.GetMin().GetY()));
+        const AZ::Vector2 boundsMax(static_cast<float>(bounds.GetMax().GetX()), static_cast<float>(bounds.GetMax().GetY()));
+
+        VisitSectorsInAabb(bounds, [&](const SectorInfo& sectorInfo)
+        {
+            return sectorInfo.m_claimIndex.Visit(
+                [&boundsMin, &boundsMax](const AZ::Vector2& nodeMin, const AZ::Vector2& nodeMax)
+                {
+                    return nodeMin.GetX() <= boundsMax.GetX() && nodeMax.GetX() >= boundsMin.GetX() && nodeMin.GetY() <= boundsMax.GetY() && nodeMax.GetY() >= boundsMin.GetY();
+                },
+                [&](ClaimHandle handle, const AZ::Vector3& position)
+                {
+                    if (!bounds.Contains(position))
+                    {
+                        return true;
+                    }
+                    auto claimItr = sectorInfo.m_claimedWorldPoints.find(handle);
+                    return claimItr == sectorInfo.m_claimedWorldPoints.end() || callback(claimItr->second) == AreaSystemEnumerateCallbackResult::KeepEnumerating;
+                });
+        });
+    }
+
+    void AreaSystemComponent::EnumerateInstancesAlongRay(const AZ::Vector3& start, const AZ::Vector3& end, float radius, AreaSystemEnumerateCallback callback) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        const float clampedRadius = AZ::GetMax(radius, 0.0f);
+        const float radiusSq = clampedRadius * clampedRadius;
+        const AZ::Vector3 radiusExtents(clampedRadius, clampedRadius, clampedRadius);
+        const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(start.GetMin(end) - radiusExtents, start.GetMax(end) + radiusExtents);
+
+        const AZ::Vector2 start2d(static_cast<float>(start.GetX()), static_cast<float>(start.GetY()));
+        const AZ::Vector2 end2d(static_cast<float>(end.GetX()), static_cast<float>(end.GetY()));
+        const AZ::Vector2 radius2d(clampedRadius, clampedRadius);
+
+        VisitSectorsInAabb(bounds, [&](const SectorInfo& sectorInfo)
+        {
+            return sectorInfo.m_claimIndex.Visit(
+                [&](const AZ::Vector2& nodeMin, const AZ::Vector2& nodeMax)
+                {
+                    return AreaSystemUtil::SegmentOverlapsRect(start2d, end2d, nodeMin - radius2d, nodeMax + radius2d);
+                },
+                [&](ClaimHandle handle, const AZ::Vector3& position)
+                {
+                    if (AreaSystemUtil::GetDistanceSqToSegment(position, start, end) > radiusSq)
+                    {
+                        return true;
+                    }
+                    auto claimItr = sectorInfo.m_claimedWorldPoints.find(handle);
+                    return claimItr == sectorInfo.m_claimedWorldPoints.end() || callback(claimItr->second) == AreaSystemEnumerateCallbackResult::KeepEnumerating;
+                });
+        });
+    }
+
+    void AreaSystemComponent::EnumerateInstancesNearPoints(const AZStd::vector<AZ::Vector3>& points, float radius, AreaSystemEnumerateBatchCallback callback) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        const float clampedRadius = AZ::GetMax(radius, 0.0f);
+        const float radiusSq = clampedRadius * clampedRadius;
+
+        //hold the sector lock once for the whole batch rather than per probe
+        AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
+        for (size_t pointIndex = 0; pointIndex < points.size(); ++pointIndex)
+        {
+            const AZ::Vector3& point = points[pointIndex];
+            const AZ::Vector2 boundsMin(static_cast<float>(point.GetX()) - clampedRadius, static_cast<float>(point.GetY()) - clampedRadius);
+            const AZ::Vector2 boundsMax(static_cast<float>(point.GetX()) + clampedRadius, static_cast<float>(point.GetY()) + clampedRadius);
+
+            const bool keepEnumerating = VisitSectorsInAabb(AZ::Aabb::CreateCenterRadius(point, clampedRadius), [&](const SectorInfo& sectorInfo)
+            {
+                return sectorInfo.m_claimIndex.Visit(
+                    [&boundsMin, &boundsMax](const AZ::Vector2& nodeMin, const AZ::Vector2& nodeMax)
+                    {
+                        return nodeMin.GetX() <= boundsMax.GetX() && nodeMax.GetX() >= boundsMin.GetX() && nodeMin.GetY() <= boundsMax.GetY() && nodeMax.GetY() >= boundsMin.GetY();
+                    },
+                    [&](ClaimHandle handle, const AZ::Vector3& position)
+                    {
+                        if (static_cast<float>(position.GetDistanceSq(point)) > radiusSq)
+                        {
+                            return true;
+                        }
+                        auto claimItr = sectorInfo.m_claimedWorldPoints.find(handle);
+                        return claimItr == sectorInfo.m_claimedWorldPoints.end() || callback(pointIndex, claimItr->second) == AreaSystemEnumerateCallbackResult::KeepEnumerating;
+                    });
+            });
+
+            if (!keepEnumerating)
+            {
+                return;
+            }
+        }
+    }
+
     void AreaSystemComponent::GetPointsPerMeter(float& value) const
     {
         if (m_configuration.m_sectorDensity <= 0 || m_configuration.m_sectorSizeInMeters <= 0.0f)
@@ -746,11 +933,6 @@ namespace Vegetation
         m_dirtyAreaBoundsSet.clear();
         m_dirtySectorBoundsSet.clear();
 
-        for (auto sectorInfo : sectorsToRebuildSurfaceCache)
-        {
-            UpdateSectorPoints(*sectorInfo);
-        }
-
         //(re)create any sectors that are in the current view
         for (int y = m_currViewRect.m_y; y < m_currViewRect.m_y + m_currViewRect.m_height; ++y)
         {
@@ -759,11 +941,16 @@ namespace Vegetation
                 SectorId sectorId(x, y);
                 if (!GetSector(sectorId))
                 {
-                    sectorsToFill.insert(CreateSector(sectorId));
+                    SectorInfo* sectorInfo = CreateSector(sectorId);
+                    sectorsToRebuildSurfaceCache.insert(sectorInfo);
+                    sectorsToFill.insert(sectorInfo);
                 }
             }
         }
 
+        //gathering surface points only touches each sector's own base context, so it can be spread across the job system
+        UpdateSectorPointsInParallel(AZStd::vector<SectorInfo*>(sectorsToRebuildSurfaceCache.begin(), sectorsToRebuildSurfaceCache.end()));
+
         //sort sectors to fill based on distance from the center of the bubble
         AZ::Aabb bubbleBounds = GetBubbleBounds();
 
@@ -777,6 +964,7 @@ namespace Vegetation
             });
         }
 
+        //claims are resolved serially in sorted order so that area claim state and instance creation match the single threaded path
         for (auto sectorInfo : sectorsToFillSorted)
         {
             FillSector(*sectorInfo);
@@ -822,7 +1010,6 @@ namespace Vegetation
         sectorInfo.m_worldX = sectorId.first;
         sectorInfo.m_worldY = sectorId.second;
         UpdateSectorBounds(sectorInfo);
-        UpdateSectorPoints(sectorInfo);
 
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = sectorInfo;
@@ -841,6 +1028,10 @@ namespace Vegetation
                 static_cast<float>((sectorInfo.m_worldX + 1) * m_configuration.m_sectorSizeInMeters),
                 static_cast<float>((sectorInfo.m_worldY + 1) * m_configuration.m_sectorSizeInMeters),
                 AZ_FLT_MAX));
+
+        sectorInfo.m_claimIndex.Reset(
+            AZ::Vector2(static_cast<float>(sectorInfo.m_bounds.GetMin().GetX()), static_cast<float>(sectorInfo.m_bounds.GetMin().GetY())),
+            AZ::Vector2(static_cast<float>(sectorInfo.m_bounds.GetMax().GetX()), static_cast<float>(sectorInfo.m_bounds.GetMax().GetY())));
     }
 
     void AreaSystemComponent::UpdateSectorPoints(SectorInfo& sectorInfo)
@@ -888,6 +1079,43 @@ namespace Vegetation
         }
     }
 
+    void AreaSystemComponent::UpdateSectorPointsInParallel(const AZStd::vector<SectorInfo*>& sectors)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        const size_t workerCount = jobContext ? jobContext->GetJobManager().GetNumWorkerThreads() : 0;
+        const size_t jobCount = AZStd::min(AZStd::min(static_cast<size_t>(AZStd::max(m_configuration.m_maxInFlightSectors, 1)), workerCount), sectors.size());
+        if (jobCount <= 1)
+        {
+            for (auto sectorInfo : sectors)
+            {
+                UpdateSectorPoints(*sectorInfo);
+            }
+            return;
+        }
+
+        //each job pulls the next unprocessed sector so no more than jobCount sectors are ever in flight
+        AZStd::atomic<size_t> nextSectorIndex(0);
+        AZ::JobCompletion jobCompletion;
+        for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+        {
+            AZ::Job* job = AZ::CreateJobFunction([this, &sectors, &nextSectorIndex]()
+            {
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Entity, "AreaSystemComponent::UpdateSectorPointsInParallel::SectorJob");
+                for (size_t sectorIndex = nextSectorIndex.fetch_add(1); sectorIndex < sectors.size(); sectorIndex = nextSectorIndex.fetch_add(1))
+                {
+                    UpdateSectorPoints(*sectors[sectorIndex]);
+                }
+            }, true, jobContext);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
     void AreaSystemComponent::UpdateSectorCallbacks(SectorInfo& sectorInfo)
     {
         //setup callback to test if matching point is already claimed
@@ -979,6 +1207,7 @@ namespace Vegetation
                     const auto& claimPair = *claimItr;
                     if (claimPair.second.m_id == areaPair.first)
                     {
+                        sectorInfo.m_claimIndex.Remove(claimPair.first, claimPair.second.m_position);
                         claimItr = sectorInfo.m_claimedWorldPoints.erase(claimItr);
                         continue;
                     }
@@ -1036,7 +1265,7 @@ namespace Vegetation
 
         // Clear out the list of claimed world points before we begin
         m_claimedWorldPointsBeforeFill = sectorInfo.m_claimedWorldPoints;
-        sectorInfo.m_claimedWorldPoints.clear();
+        ClearClaims(sectorInfo);
 
         //for all active areas attempt to spawn vegetation on sector grid positions
         for (const auto& area : m_activeAreasInBubble)
@@ -1085,7 +1314,7 @@ namespace Vegetation
             const auto& areaId = instanceData.m_id;
             claimsToRelease[areaId].insert(handle);
         }
-        sectorInfo.m_claimedWorldPoints.clear();
+        ClearClaims(sectorInfo);
 
         // iterate over the claims by area id and release them
         for (const auto& claimPair : claimsToRelease)
@@ -1132,7 +1361,24 @@ namespace Vegetation
     void AreaSystemComponent::CreateClaim(SectorInfo& sectorInfo, const ClaimHandle handle, const InstanceData& instanceData)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
-        sectorInfo.m_claimedWorldPoints[handle] = instanceData;
+
+        auto claimItr = sectorInfo.m_claimedWorldPoints.find(handle);
+        if (claimItr != sectorInfo.m_claimedWorldPoints.end())
+        {
+            sectorInfo.m_claimIndex.Remove(handle, claimItr->second.m_position);
+            claimItr->second = instanceData;
+        }
+        else
+        {
+            sectorInfo.m_claimedWorldPoints[handle] = instanceData;
+        }
+        sectorInfo.m_claimIndex.Insert(handle, instanceData.m_position);
+    }
+
+    void AreaSystemComponent::ClearClaims(SectorInfo& sectorInfo)
+    {
+        sectorInfo.m_claimedWorldPoints.clear();
+        sectorInfo.m_claimIndex.Clear();
     }
 
     ClaimHandle AreaSystemComponent::CreateClaimHandle(const SectorInfo& sectorInfo, uint32_t index) const
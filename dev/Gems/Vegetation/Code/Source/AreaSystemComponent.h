@@ -24,6 +24,7 @@
 #include <CrySystemBus.h>
 #include <StatObjBus.h>
 #include <ISystem.h>
+#include "Util/SectorQuadTree.h"
 
 namespace Vegetation
 {
@@ -53,7 +54,8 @@ namespace Vegetation
                 && m_sectorSizeInMeters == other.m_sectorSizeInMeters
                 && m_threadProcessingIntervalMs == other.m_threadProcessingIntervalMs
                 && m_sectorSearchPadding == other.m_sectorSearchPadding
-                && m_sectorPointSnapMode == other.m_sectorPointSnapMode;
+                && m_sectorPointSnapMode == other.m_sectorPointSnapMode
+                && m_maxInFlightSectors == other.m_maxInFlightSectors;
         }
 
         int m_viewRectangleSize = 13;
@@ -62,10 +64,12 @@ namespace Vegetation
         int m_threadProcessingIntervalMs = 500;
         int m_sectorSearchPadding = 0;
         SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+        int m_maxInFlightSectors = 8;
     private:
         static const int s_maxViewRectangleSize;
         static const int s_maxSectorDensity;
         static const int s_maxSectorSizeInMeters;
+        static const int s_maxInFlightSectors;
 
         static const int s_maxInstancesPerMeter;
         static const int64_t s_maxVegetationInstances;
@@ -119,6 +123,9 @@ namespace Vegetation
         void MuteArea(AZ::EntityId areaId) override;
         void UnmuteArea(AZ::EntityId areaId) override;
         void EnumerateInstancesInAabb(const AZ::Aabb& bounds, AreaSystemEnumerateCallback callback) const override;
+        void EnumerateInstancesWithPositionInAabb(const AZ::Aabb& bounds, AreaSystemEnumerateCallback callback) const override;
+        void EnumerateInstancesAlongRay(const AZ::Vector3& start, const AZ::Vector3& end, float radius, AreaSystemEnumerateCallback callback) const override;
+        void EnumerateInstancesNearPoints(const AZStd::vector<AZ::Vector3>& points, float radius, AreaSystemEnumerateBatchCallback callback) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // GradientSignal::SectorDataRequestBus
@@ -180,6 +187,8 @@ namespace Vegetation
             int m_worldY = {};
             //! Keeps track of points that have been claimed.  This is not cleared at the start of an update pass
             ClaimContainer m_claimedWorldPoints;
+            //! Spatial index of m_claimedWorldPoints by instance position
+            SectorQuadTree<ClaimHandle> m_claimIndex;
             ClaimContext m_baseContext;
         };
 
@@ -202,12 +211,17 @@ namespace Vegetation
         SectorInfo* CreateSector(const SectorId& sectorId);
         void UpdateSectorBounds(SectorInfo& sectorInfo);
         void UpdateSectorPoints(SectorInfo& sectorInfo);
+        void UpdateSectorPointsInParallel(const AZStd::vector<SectorInfo*>& sectors);
         void UpdateSectorCallbacks(SectorInfo& sectorInfo);
 
         //! Get sector by 2d veg map coordinates.
         const SectorInfo* GetSector(const SectorId& sectorId) const;
         SectorInfo* GetSector(const SectorId& sectorId);
 
+        //! Visits the sectors overlapping bounds (including search padding), returning false if the visitor stopped early
+        template <typename TVisitor>
+        bool VisitSectorsInAabb(const AZ::Aabb& bounds, const TVisitor& visitor) const;
+
         void ReleaseUnregisteredClaims(SectorInfo& sectorInfo);
         void ReleaseUnusedClaims(SectorInfo& sectorInfo);
         void FillSector(SectorInfo& sectorInfo);
@@ -219,6 +233,7 @@ namespace Vegetation
 
         // claiming logic
         void CreateClaim(SectorInfo& sectorInfo, const ClaimHandle handle, const InstanceData& instanceData);
+        void ClearClaims(SectorInfo& sectorInfo);
         ClaimHandle CreateClaimHandle(const SectorInfo& sectorInfo, uint32_t index) const;
 
         mutable AZStd::recursive_mutex m_vegetationThreadMutex;
@@ -274,14 +274,48 @@ namespace Vegetation
         GradientSignal::GetObbParamsFromShape(GetEntityId(), m_shapeBounds, m_shapeTransformInverse);
     }
 
-    bool SpawnerComponent::EvaluateFilters(EntityIdStack& processedIds, InstanceData& instanceData, const FilterStage intendedStage) const
+    void SpawnerComponent::ClaimPipeline::Build(const EntityIdStack& processedIds)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
-        bool accepted = true;
+        m_shapes.clear();
+        m_descriptorSelectors.clear();
+        m_filters.clear();
+        m_modifiers.clear();
+
         for (const auto& id : processedIds)
         {
-            FilterRequestBus::EnumerateHandlersId(id, [this, &instanceData, &accepted, intendedStage](FilterRequestBus::Events* handler) {
+            if (LmbrCentral::ShapeComponentRequestsBus::FindFirstHandler(id))
+            {
+                m_shapes.emplace_back();
+                LmbrCentral::ShapeComponentRequestsBus::Bind(m_shapes.back(), id);
+            }
+            if (DescriptorSelectorRequestBus::FindFirstHandler(id))
+            {
+                m_descriptorSelectors.emplace_back();
+                DescriptorSelectorRequestBus::Bind(m_descriptorSelectors.back(), id);
+            }
+            if (FilterRequestBus::FindFirstHandler(id))
+            {
+                m_filters.emplace_back();
+                FilterRequestBus::Bind(m_filters.back(), id);
+            }
+            if (ModifierRequestBus::FindFirstHandler(id))
+            {
+                m_modifiers.emplace_back();
+                ModifierRequestBus::Bind(m_modifiers.back(), id);
+            }
+        }
+    }
+
+    bool SpawnerComponent::EvaluateFilters(const ClaimPipeline& pipeline, InstanceData& instanceData, const FilterStage intendedStage) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        bool accepted = true;
+        for (const auto& filterPtr : pipeline.m_filters)
+        {
+            FilterRequestBus::EnumerateHandlersPtr(filterPtr, [this, &instanceData, &accepted, intendedStage](FilterRequestBus::Events* handler) {
                 const FilterStage stage = handler->GetFilterStage();
                 if (stage == intendedStage || (stage == FilterStage::Default && m_configuration.m_filterStage == intendedStage))
                 {
@@ -297,7 +331,7 @@ namespace Vegetation
         return accepted;
     }
 
-    bool SpawnerComponent::ProcessInstance(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData, DescriptorPtr descriptorPtr)
+    bool SpawnerComponent::ProcessInstance(const ClaimPipeline& pipeline, const ClaimPoint& point, InstanceData& instanceData, DescriptorPtr descriptorPtr)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
@@ -325,20 +359,20 @@ namespace Vegetation
         instanceData.m_scale = 1.0f;
 
         // run pre-process filters on unmodified instance data
-        if (!EvaluateFilters(processedIds, instanceData, FilterStage::PreProcess))
+        if (!EvaluateFilters(pipeline, instanceData, FilterStage::PreProcess))
         {
             // Once a filter rejects the instance, no point in running the rest.
             return false;
         }
 
         // If all of the pre-process filters have allowed this instance to be placed, run the modifiers and post-process filters.
-        for (const auto& id : processedIds)
+        for (const auto& modifierPtr : pipeline.m_modifiers)
         {
-            ModifierRequestBus::Event(id, &ModifierRequestBus::Events::Execute, instanceData);
+            ModifierRequestBus::Event(modifierPtr, &ModifierRequestBus::Events::Execute, instanceData);
         }
 
         // run post-process filters on modified instance data
-        if (!EvaluateFilters(processedIds, instanceData, FilterStage::PostProcess))
+        if (!EvaluateFilters(pipeline, instanceData, FilterStage::PostProcess))
         {
             // Once a filter rejects the instance, no point in running the rest.
             return false;
@@ -348,7 +382,7 @@ namespace Vegetation
         return true;
     }
 
-    bool SpawnerComponent::ClaimPosition(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData)
+    bool SpawnerComponent::ClaimPosition(const ClaimPipeline& pipeline, const ClaimPoint& point, InstanceData& instanceData)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
@@ -373,10 +407,10 @@ namespace Vegetation
 #endif
 
         // test shape bus as first pass to claim the point
-        for (const auto& id : processedIds)
+        for (const auto& shapePtr : pipeline.m_shapes)
         {
             bool accepted = true;
-            LmbrCentral::ShapeComponentRequestsBus::EventResult(accepted, id, &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, point.m_position);
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(accepted, shapePtr, &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, point.m_position);
             if (!accepted)
             {
                 VEG_PROFILE_METHOD(DebugNotificationBus::QueueBroadcast(&DebugNotificationBus::Events::FilterInstance, instanceData.m_id, AZStd::string_view("ShapeFilter")));
@@ -391,14 +425,14 @@ namespace Vegetation
         //copy the set of all selectable descriptors then remove any that don't pass the selection filter
         AZStd::lock_guard<decltype(m_selectableDescriptorMutex)> selectableDescriptorLock(m_selectableDescriptorMutex);
         m_selectedDescriptors = m_selectableDescriptorCache;
-        for (const auto& id : processedIds)
+        for (const auto& descriptorSelectorPtr : pipeline.m_descriptorSelectors)
         {
-            DescriptorSelectorRequestBus::Event(id, &DescriptorSelectorRequestBus::Events::SelectDescriptors, selectorParams, m_selectedDescriptors);
+            DescriptorSelectorRequestBus::Event(descriptorSelectorPtr, &DescriptorSelectorRequestBus::Events::SelectDescriptors, selectorParams, m_selectedDescriptors);
         }
 
         for (DescriptorPtr descriptorPtr : m_selectedDescriptors)
         {
-            if (ProcessInstance(processedIds, point, instanceData, descriptorPtr))
+            if (ProcessInstance(pipeline, point, instanceData, descriptorPtr))
             {
                 return true;
             }
@@ -426,6 +460,9 @@ namespace Vegetation
         EntityIdStack& processedIds = m_configuration.m_inheritBehavior ? stackIds : emptyIds;
         EntityIdStackPusher stackPusher(processedIds, GetEntityId());
 
+        ClaimPipeline pipeline;
+        pipeline.Build(processedIds);
+
         InstanceData instanceData;
         instanceData.m_id = GetEntityId();
         instanceData.m_changeIndex = GetChangeIndex();
@@ -436,7 +473,7 @@ namespace Vegetation
             ClaimPoint& point = context.m_availablePoints[pointIndex];
 
             bool accepted = false;
-            if (ClaimPosition(processedIds, point, instanceData))
+            if (ClaimPosition(pipeline, point, instanceData))
             {
                 // Check if an identical instance already exists for reuse
                 if (context.m_existedCallback(point, instanceData))
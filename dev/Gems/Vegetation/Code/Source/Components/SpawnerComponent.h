@@ -114,12 +114,24 @@ namespace Vegetation
         void SetFilterStage(FilterStage filterStage) override;
 
     private:
+        //! Bus addresses of the processed entities that have shape, selector, filter or modifier handlers, in stack order.
+        //! Built once per ClaimPositions call so that the points of a sector skip the address lookups and the entities without handlers.
+        struct ClaimPipeline
+        {
+            void Build(const EntityIdStack& processedIds);
+
+            AZStd::vector<LmbrCentral::ShapeComponentRequestsBus::BusPtr> m_shapes;
+            AZStd::vector<DescriptorSelectorRequestBus::BusPtr> m_descriptorSelectors;
+            AZStd::vector<FilterRequestBus::BusPtr> m_filters;
+            AZStd::vector<ModifierRequestBus::BusPtr> m_modifiers;
+        };
+
         void ClearSelectableDescriptors();
         void UpdateShapeParams();
         bool CreateInstance(const ClaimPoint &point, InstanceData& instanceData);
-        bool EvaluateFilters(EntityIdStack& processedIds, InstanceData& instanceData, const FilterStage intendedStage) const;
-        bool ProcessInstance(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData, DescriptorPtr descriptorPtr);
-        bool ClaimPosition(EntityIdStack& processedIds, const ClaimPoint& point, InstanceData& instanceData);
+        bool EvaluateFilters(const ClaimPipeline& pipeline, InstanceData& instanceData, const FilterStage intendedStage) const;
+        bool ProcessInstance(const ClaimPipeline& pipeline, const ClaimPoint& point, InstanceData& instanceData, DescriptorPtr descriptorPtr);
+        bool ClaimPosition(const ClaimPipeline& pipeline, const ClaimPoint& point, InstanceData& instanceData);
         void DestroyAllInstances();
         void CalcInstanceDebugColor(EntityIdStack& stackIds);
 
@@ -1026,12 +1026,13 @@ void DebugComponent::DrawDebugStats()
         return;
     }
 
-    renderAuxGeom->Draw2dLabel(4, 16, 1.5f, ColorF(1, 1, 1), false, AZStd::string::format("VegetationSystemStats:\nActive Instances Count: %d\nThread Queue Count: %d\nThread Processing Count: %d\nInstance Register Queue: %d\nInstance Unregister Queue: %d", 
+    renderAuxGeom->Draw2dLabel(4, 16, 1.5f, ColorF(1, 1, 1), false, AZStd::string::format("VegetationSystemStats:\nActive Instances Count: %d\nThread Queue Count: %d\nThread Processing Count: %d\nInstance Register Queue: %d\nInstance Unregister Queue: %d\nPooled Render Nodes: %d", 
         m_debugData->m_instanceActiveCount.load(AZStd::memory_order_relaxed),
         m_debugData->m_areaTaskQueueCount.load(AZStd::memory_order_relaxed),
         m_debugData->m_areaTaskActiveCount.load(AZStd::memory_order_relaxed),
         m_debugData->m_instanceRegisterCount.load(AZStd::memory_order_relaxed),
-        m_debugData->m_instanceUnregisterCount.load(AZStd::memory_order_relaxed)
+        m_debugData->m_instanceUnregisterCount.load(AZStd::memory_order_relaxed),
+        m_debugData->m_instancePooledCount.load(AZStd::memory_order_relaxed)
         ).c_str());
 }
 
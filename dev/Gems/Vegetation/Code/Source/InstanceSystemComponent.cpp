@@ -13,7 +13,6 @@
 #include "InstanceSystemComponent.h"
 
 #include <AzCore/Debug/Profiler.h> 
-#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -31,6 +30,8 @@ namespace Vegetation
 {
     namespace InstanceSystemUtil
     {
+        // upper bound on the number of executed task batches retained for reuse
+        static const size_t s_maxPooledTaskBatches = 64;
 
         void ApplyConfigurationToConsoleVars(ISystem* system, const InstanceSystemConfig& config)
         {
@@ -71,6 +72,7 @@ namespace Vegetation
                 ->Version(2)
                 ->Field("MaxInstanceProcessTimeMicroseconds", &InstanceSystemConfig::m_maxInstanceProcessTimeMicroseconds)
                 ->Field("MaxInstanceTaskBatchSize", &InstanceSystemConfig::m_maxInstanceTaskBatchSize)
+                ->Field("MaxPooledRenderNodes", &InstanceSystemConfig::m_maxPooledRenderNodes)
                 ->Field("MergedMeshesLodRatio", &InstanceSystemConfig::m_mergedMeshesLodRatio)
                 ->Field("MergedMeshesViewDistanceRatio", &InstanceSystemConfig::m_mergedMeshesViewDistanceRatio)
                 ->Field("MergedMeshesInstanceDistance", &InstanceSystemConfig::m_mergedMeshesInstanceDistance)
@@ -84,6 +86,8 @@ namespace Vegetation
                     ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
                     ->DataElement(0, &InstanceSystemConfig::m_maxInstanceProcessTimeMicroseconds, "Max Instance Process Time Microseconds", "Maximum number of microseconds allowed for processing instance management tasks each tick")
                     ->DataElement(0, &InstanceSystemConfig::m_maxInstanceTaskBatchSize, "Max Instance Task Batch Size", "Maximum number of instance management tasks that can be batch processed together")
+                    ->DataElement(0, &InstanceSystemConfig::m_maxPooledRenderNodes, "Max Pooled Render Nodes", "Maximum number of released vegetation render nodes kept for reuse instead of being freed")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0)
                     ->ClassElement(AZ::Edit::ClassElements::Group, "Merged Meshes")
                         ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
                         ->DataElement(0, &InstanceSystemConfig::m_mergedMeshesLodRatio, "LOD Distance Ratio", "Controls the distance where the merged mesh vegetation use less detailed models")
@@ -107,6 +111,7 @@ namespace Vegetation
                 ->Constructor()
                 ->Property("maxInstanceProcessTimeMicroseconds", BehaviorValueProperty(&InstanceSystemConfig::m_maxInstanceProcessTimeMicroseconds))
                 ->Property("maxInstanceTaskBatchSize", BehaviorValueProperty(&InstanceSystemConfig::m_maxInstanceTaskBatchSize))
+                ->Property("maxPooledRenderNodes", BehaviorValueProperty(&InstanceSystemConfig::m_maxPooledRenderNodes))
                 ;
         }
     }
@@ -313,35 +318,20 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugNotificationBus::QueueBroadcast(&DebugNotificationBus::Events::CreateInstance, instanceData.m_instanceId, instanceData.m_position, instanceData.m_id));
 
 
-        if (instanceData.m_descriptorPtr->m_autoMerge)
-        {
-            //queue render node related tasks to process on the main thread
-            AddTask([this, instanceData]() {
-                CreateMergedMeshInstanceNode(instanceData);
-                if (m_debugData)
-                {
-                    m_debugData->m_instanceRegisterCount.fetch_sub(1, AZStd::memory_order_relaxed);
-                    m_debugData->m_instanceActiveCount.fetch_add(1, AZStd::memory_order_relaxed);
-                }
-            });
-        }
-        else
-        {
-            //queue render node related tasks to process on the main thread
-            AddTask([this, instanceData]() {
-                CreateCVegetationInstanceNode(instanceData);
-                if (m_debugData)
-                {
-                    m_debugData->m_instanceRegisterCount.fetch_sub(1, AZStd::memory_order_relaxed);
-                    m_debugData->m_instanceActiveCount.fetch_add(1, AZStd::memory_order_relaxed);
-                }
-            });
-        }
-
         if (m_debugData)
         {
             m_debugData->m_instanceRegisterCount.fetch_add(1, AZStd::memory_order_relaxed);
         }
+
+        //queue render node related tasks to process on the main thread
+        InstanceTask task;
+        task.m_type = instanceData.m_descriptorPtr->m_autoMerge ? InstanceTaskType::CreateMergedMeshNode : InstanceTaskType::CreateVegetationNode;
+        task.m_instanceId = instanceData.m_instanceId;
+        task.m_position = instanceData.m_position;
+        task.m_rotation = instanceData.m_alignment * instanceData.m_rotation;
+        task.m_scale = instanceData.m_scale;
+        task.m_descriptorPtr = instanceData.m_descriptorPtr;
+        AddTask(AZStd::move(task));
     }
 
     void InstanceSystemComponent::DestroyInstance(InstanceId instanceId)
@@ -362,18 +352,10 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugNotificationBus::QueueBroadcast(&DebugNotificationBus::Events::DeleteInstance, instanceId));
 
         //queue render node related tasks to process on the main thread
-        AddTask([this, instanceId]() {
-            if (m_debugData)
-            {
-                m_debugData->m_instanceUnregisterCount.fetch_sub(1, AZStd::memory_order_relaxed);
-                m_debugData->m_instanceActiveCount.fetch_sub(1, AZStd::memory_order_relaxed);
-            }
-
-            ReleaseInstanceNode(instanceId);
-
-            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-            m_instanceDeletionSet.erase(instanceId);
-        });
+        InstanceTask task;
+        task.m_type = InstanceTaskType::DestroyNode;
+        task.m_instanceId = instanceId;
+        AddTask(AZStd::move(task));
 
         AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
         m_instanceDeletionSet.insert(instanceId);
@@ -389,17 +371,29 @@ namespace Vegetation
         // clear all instances
         {
             AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            for (auto instancePair : m_instanceMap)
+            for (auto& transformsPair : m_instanceTransforms)
             {
-                InstanceId instanceId = instancePair.first;
-                IRenderNode* instanceNode = instancePair.second;
-                if (instanceNode)
+                InstanceTransformArrays& transforms = transformsPair.second;
+                for (size_t index = 0; index < transforms.m_instanceIds.size(); ++index)
                 {
-                    instanceNode->ReleaseNode();
+                    IRenderNode* instanceNode = transforms.m_nodes[index];
+                    if (instanceNode)
+                    {
+                        instanceNode->ReleaseNode();
+                    }
+                    ReleaseInstanceId(transforms.m_instanceIds[index]);
                 }
-                ReleaseInstanceId(instanceId);
             }
+            m_instanceTransforms.clear();
             m_instanceMap.clear();
+
+            // pooled nodes belong to the current level so they are not kept across a full clear
+            ReleaseVegetationNodePool();
+        }
+
+        if (m_debugData)
+        {
+            m_debugData->m_instanceActiveCount.store(0, AZStd::memory_order_relaxed);
         }
 
         {
@@ -501,16 +495,55 @@ namespace Vegetation
         m_instanceIdPool.insert(instanceId);
     }
 
-    bool InstanceSystemComponent::IsInstanceSkippable(const InstanceData& instanceData) const
+    size_t InstanceSystemComponent::InstanceTransformArrays::Add(const InstanceTask& task, IRenderNode* node)
+    {
+        m_instanceIds.push_back(task.m_instanceId);
+        m_positions.push_back(task.m_position);
+        m_rotations.push_back(task.m_rotation);
+        m_scales.push_back(task.m_scale);
+        m_nodes.push_back(node);
+        return m_instanceIds.size() - 1;
+    }
+
+    void InstanceSystemComponent::InstanceTransformArrays::RemoveAt(size_t index)
+    {
+        //swap the last entry into the vacated slot to keep the arrays dense
+        const size_t lastIndex = m_instanceIds.size() - 1;
+        if (index != lastIndex)
+        {
+            m_instanceIds[index] = m_instanceIds[lastIndex];
+            m_positions[index] = m_positions[lastIndex];
+            m_rotations[index] = m_rotations[lastIndex];
+            m_scales[index] = m_scales[lastIndex];
+            m_nodes[index] = m_nodes[lastIndex];
+        }
+        m_instanceIds.pop_back();
+        m_positions.pop_back();
+        m_rotations.pop_back();
+        m_scales.pop_back();
+        m_nodes.pop_back();
+    }
+
+    bool InstanceSystemComponent::IsInstanceSkippable(InstanceId instanceId) const
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
         //if the instance was queued for deletion before its creation task executed then skip it
         AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-        return instanceData.m_instanceId == InvalidInstanceId || m_instanceDeletionSet.find(instanceData.m_instanceId) != m_instanceDeletionSet.end();
+        return instanceId == InvalidInstanceId || m_instanceDeletionSet.find(instanceId) != m_instanceDeletionSet.end();
+    }
+
+    void InstanceSystemComponent::AddInstanceRecord(const InstanceTask& task, StatInstGroupId groupId, IRenderNode* instanceNode)
+    {
+        AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
+        AZ_Assert(m_instanceMap.find(task.m_instanceId) == m_instanceMap.end(), "InstanceId %llu is already in use!", task.m_instanceId);
+
+        InstanceRecord& record = m_instanceMap[task.m_instanceId];
+        record.m_groupId = groupId;
+        record.m_index = m_instanceTransforms[groupId].Add(task, instanceNode);
     }
 
-    void InstanceSystemComponent::CreateCVegetationInstanceNode(const InstanceData& instanceData)
+    void InstanceSystemComponent::CreateCVegetationInstanceNode(const InstanceTask& task)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
@@ -520,12 +553,12 @@ namespace Vegetation
             return;
         }
 
-        if (IsInstanceSkippable(instanceData))
+        if (IsInstanceSkippable(task.m_instanceId))
         {
             return;
         }
 
-        DescriptorRenderGroupPtr groupPtr = RegisterRenderGroup(instanceData.m_descriptorPtr);
+        DescriptorRenderGroupPtr groupPtr = RegisterRenderGroup(task.m_descriptorPtr);
         if (!groupPtr || !groupPtr->IsReady())
         {
             //could not locate registered vegetation render group but it's not an error
@@ -535,24 +568,22 @@ namespace Vegetation
             return;
         }
 
-        IVegetation* instanceNode = (IVegetation*)m_engine->CreateRenderNode(eERType_Vegetation);
+        IVegetation* instanceNode = AcquireVegetationNode();
         AZ_Assert(instanceNode, "Could not CreateRenderNode(eERType_Vegetation)!");
 
         instanceNode->SetStatObjGroupIndex(groupPtr->GetId());
-        instanceNode->SetUniformScale(instanceData.m_scale);
-        instanceNode->SetPosition(AZVec3ToLYVec3(instanceData.m_position));
-        instanceNode->SetRotation(Ang3(AZQuaternionToLYQuaternion(instanceData.m_alignment * instanceData.m_rotation)));
+        instanceNode->SetUniformScale(task.m_scale);
+        instanceNode->SetPosition(AZVec3ToLYVec3(task.m_position));
+        instanceNode->SetRotation(Ang3(AZQuaternionToLYQuaternion(task.m_rotation)));
         instanceNode->PrepareBBox();
         instanceNode->Physicalize();
         m_engine->RegisterEntity(instanceNode);
         m_instanceNodeToMergedMeshNodeRegistrationMap[instanceNode] = nullptr;
 
-        AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-        AZ_Assert(m_instanceMap.find(instanceData.m_instanceId) == m_instanceMap.end(), "InstanceId %llu is already in use!", instanceData.m_instanceId);
-        m_instanceMap[instanceData.m_instanceId] = instanceNode;
+        AddInstanceRecord(task, groupPtr->GetId(), instanceNode);
     }
 
-    void InstanceSystemComponent::CreateMergedMeshInstanceNode(const InstanceData& instanceData)
+    void InstanceSystemComponent::CreateMergedMeshInstanceNode(const InstanceTask& task)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
@@ -562,12 +593,12 @@ namespace Vegetation
             return;
         }
 
-        if (IsInstanceSkippable(instanceData))
+        if (IsInstanceSkippable(task.m_instanceId))
         {
             return;
         }
 
-        DescriptorRenderGroupPtr groupPtr = RegisterRenderGroup(instanceData.m_descriptorPtr);
+        DescriptorRenderGroupPtr groupPtr = RegisterRenderGroup(task.m_descriptorPtr);
         if (!groupPtr || !groupPtr->IsReady())
         {
             //could not locate registered vegetation render group but it's not an error
@@ -579,9 +610,9 @@ namespace Vegetation
 
         IMergedMeshesManager::SInstanceSample sample;
         sample.instGroupId = groupPtr->GetId();
-        sample.pos = AZVec3ToLYVec3(instanceData.m_position);
-        sample.scale = (uint8)SATURATEB(instanceData.m_scale * 64.0f); // [LY-90912] Need to expose VEGETATION_CONV_FACTOR from CryEngine\Cry3DEngine\Vegetation.h for use here
-        sample.q = AZQuaternionToLYQuaternion(instanceData.m_alignment * instanceData.m_rotation);
+        sample.pos = AZVec3ToLYVec3(task.m_position);
+        sample.scale = (uint8)SATURATEB(task.m_scale * 64.0f); // [LY-90912] Need to expose VEGETATION_CONV_FACTOR from CryEngine\Cry3DEngine\Vegetation.h for use here
+        sample.q = AZQuaternionToLYQuaternion(task.m_rotation);
         sample.q.NormalizeSafe();
 
         const bool bRegister = false;
@@ -595,9 +626,7 @@ namespace Vegetation
             m_instanceNodeToMergedMeshNodeRegistrationMap[instanceNode] = mergedMeshNode;
         }
 
-        AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-        AZ_Assert(m_instanceMap.find(instanceData.m_instanceId) == m_instanceMap.end(), "InstanceId %llu is already in use!", instanceData.m_instanceId);
-        m_instanceMap[instanceData.m_instanceId] = instanceNode;
+        AddInstanceRecord(task, groupPtr->GetId(), instanceNode);
     }
 
     void InstanceSystemComponent::CreateInstanceNodeBegin()
@@ -653,38 +682,117 @@ namespace Vegetation
             auto instanceItr = m_instanceMap.find(instanceId);
             if (instanceItr != m_instanceMap.end())
             {
-                instanceNode = instanceItr->second;
+                const InstanceRecord record = instanceItr->second;
                 m_instanceMap.erase(instanceItr);
+
+                InstanceTransformArrays& transforms = m_instanceTransforms[record.m_groupId];
+                instanceNode = transforms.m_nodes[record.m_index];
+                transforms.RemoveAt(record.m_index);
+
+                //the entry swapped into the vacated slot must point at its new index
+                if (record.m_index < transforms.m_instanceIds.size())
+                {
+                    m_instanceMap[transforms.m_instanceIds[record.m_index]].m_index = record.m_index;
+                }
             }
         }
 
         if (instanceNode)
         {
-            instanceNode->ReleaseNode();
-
             //stop tracking this node for registration
             m_instanceNodeToMergedMeshNodeRegistrationMap.erase(instanceNode);
+
+            if (instanceNode->GetRenderNodeType() == eERType_Vegetation)
+            {
+                ReleaseVegetationNode(instanceNode);
+            }
+            else
+            {
+                instanceNode->ReleaseNode();
+            }
         }
         ReleaseInstanceId(instanceId);
     }
 
+    IVegetation* InstanceSystemComponent::AcquireVegetationNode()
+    {
+        {
+            AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
+            if (!m_vegetationNodePool.empty())
+            {
+                IVegetation* instanceNode = m_vegetationNodePool.back();
+                m_vegetationNodePool.pop_back();
+                if (m_debugData)
+                {
+                    m_debugData->m_instancePooledCount.store(static_cast<int>(m_vegetationNodePool.size()), AZStd::memory_order_relaxed);
+                }
+                return instanceNode;
+            }
+        }
+
+        return static_cast<IVegetation*>(m_engine->CreateRenderNode(eERType_Vegetation));
+    }
+
+    void InstanceSystemComponent::ReleaseVegetationNode(IRenderNode* instanceNode)
+    {
+        AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
+        if (!m_engine || m_vegetationNodePool.size() >= static_cast<size_t>(AZStd::max(m_configuration.m_maxPooledRenderNodes, 0)))
+        {
+            instanceNode->ReleaseNode();
+            return;
+        }
+
+        //reset the node to the same state as a newly created one (no physics, unregistered from the octree, no temp data)
+        instanceNode->Dephysicalize();
+        m_engine->FreeRenderNodeState(instanceNode);
+        m_vegetationNodePool.push_back(static_cast<IVegetation*>(instanceNode));
+
+        if (m_debugData)
+        {
+            m_debugData->m_instancePooledCount.store(static_cast<int>(m_vegetationNodePool.size()), AZStd::memory_order_relaxed);
+        }
+    }
+
+    void InstanceSystemComponent::ReleaseVegetationNodePool()
+    {
+        AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
+        for (IVegetation* instanceNode : m_vegetationNodePool)
+        {
+            instanceNode->ReleaseNode();
+        }
+        m_vegetationNodePool.clear();
+
+        if (m_debugData)
+        {
+            m_debugData->m_instancePooledCount.store(0, AZStd::memory_order_relaxed);
+        }
+    }
+
     bool InstanceSystemComponent::HasTasks() const
     {
         AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
         return !m_mainThreadTaskQueue.empty();
     }
 
-    void InstanceSystemComponent::AddTask(const Task& task)
+    void InstanceSystemComponent::AddTask(InstanceTask&& task)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
         AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
         if (m_mainThreadTaskQueue.empty() || m_mainThreadTaskQueue.back().size() >= m_configuration.m_maxInstanceTaskBatchSize)
         {
-            m_mainThreadTaskQueue.push_back();
-            m_mainThreadTaskQueue.back().reserve(m_configuration.m_maxInstanceTaskBatchSize);
+            //reuse a previously executed batch so its storage doesn't need to be reallocated
+            if (!m_taskBatchPool.empty())
+            {
+                m_mainThreadTaskQueue.splice(m_mainThreadTaskQueue.end(), m_taskBatchPool, m_taskBatchPool.begin());
+            }
+            else
+            {
+                m_mainThreadTaskQueue.push_back();
+                m_mainThreadTaskQueue.back().reserve(m_configuration.m_maxInstanceTaskBatchSize);
+            }
         }
-        m_mainThreadTaskQueue.back().emplace_back(task);
+        m_mainThreadTaskQueue.back().emplace_back(AZStd::move(task));
     }
 
     void InstanceSystemComponent::ClearTasks()
@@ -694,6 +802,7 @@ namespace Vegetation
         AZStd::lock_guard<decltype(m_mainThreadTaskInProgressMutex)> mainThreadTaskInProgressLock(m_mainThreadTaskInProgressMutex);
         AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
         m_mainThreadTaskQueue.clear();
+        m_taskBatchPool.clear();
 
         if (m_debugData)
         {
@@ -715,6 +824,64 @@ namespace Vegetation
         return false;
     }
 
+    void InstanceSystemComponent::RecycleTasks(TaskList& removedTasks)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        //executed batches keep their capacity and are returned to the pool for the next AddTask calls
+        for (auto& batch : removedTasks)
+        {
+            batch.clear();
+        }
+
+        AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
+        m_taskBatchPool.splice(m_taskBatchPool.end(), removedTasks);
+        while (m_taskBatchPool.size() > InstanceSystemUtil::s_maxPooledTaskBatches)
+        {
+            m_taskBatchPool.pop_back();
+        }
+    }
+
+    void InstanceSystemComponent::ExecuteTask(const InstanceTask& task)
+    {
+        switch (task.m_type)
+        {
+        case InstanceTaskType::CreateVegetationNode:
+        case InstanceTaskType::CreateMergedMeshNode:
+        {
+            if (task.m_type == InstanceTaskType::CreateMergedMeshNode)
+            {
+                CreateMergedMeshInstanceNode(task);
+            }
+            else
+            {
+                CreateCVegetationInstanceNode(task);
+            }
+
+            if (m_debugData)
+            {
+                m_debugData->m_instanceRegisterCount.fetch_sub(1, AZStd::memory_order_relaxed);
+                m_debugData->m_instanceActiveCount.fetch_add(1, AZStd::memory_order_relaxed);
+            }
+            break;
+        }
+        case InstanceTaskType::DestroyNode:
+        {
+            if (m_debugData)
+            {
+                m_debugData->m_instanceUnregisterCount.fetch_sub(1, AZStd::memory_order_relaxed);
+                m_debugData->m_instanceActiveCount.fetch_sub(1, AZStd::memory_order_relaxed);
+            }
+
+            ReleaseInstanceNode(task.m_instanceId);
+
+            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
+            m_instanceDeletionSet.erase(task.m_instanceId);
+            break;
+        }
+        }
+    }
+
     void InstanceSystemComponent::ExecuteTasks()
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
@@ -724,12 +891,12 @@ namespace Vegetation
         AZStd::chrono::system_clock::time_point initialTime = AZStd::chrono::system_clock::now();
         AZStd::chrono::system_clock::time_point currentTime = initialTime;
 
-        auto removedTasksPtr = AZStd::make_shared<TaskList>();
-        while (GetTasks(*removedTasksPtr))
+        TaskList removedTasks;
+        while (GetTasks(removedTasks))
         {
-            for (const auto& task : (*removedTasksPtr).back())
+            for (const auto& task : removedTasks.back())
             {
-                task();
+                ExecuteTask(task);
             }
 
             currentTime = AZStd::chrono::system_clock::now();
@@ -739,9 +906,7 @@ namespace Vegetation
             }
         }
 
-        //offloading garbage collection to job to save time deallocating tasks on main thread
-        auto garbageCollectionJob = AZ::CreateJobFunction([removedTasksPtr]() mutable {}, true);
-        garbageCollectionJob->Start();
+        RecycleTasks(removedTasks);
     }
 
     void InstanceSystemComponent::ProcessMainThreadTasks()
@@ -19,6 +19,8 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
 #include <AzCore/std/containers/vector.h>
 
 #include "DescriptorRenderGroup.h"
@@ -38,6 +40,7 @@ namespace AZ
     class EntityId;
 }
 struct IRenderNode;
+struct IVegetation;
 
 //////////////////////////////////////////////////////////////////////////
 
@@ -61,6 +64,9 @@ namespace Vegetation
         // maximum number of instance management tasks that can be batch processed together
         int m_maxInstanceTaskBatchSize = 100;
 
+        // maximum number of released vegetation render nodes kept for reuse by later instances
+        int m_maxPooledRenderNodes = 1024;
+
         // merged mesh visual features
         float m_mergedMeshesViewDistanceRatio = 100.0f;
         float m_mergedMeshesLodRatio = 3.0f;
@@ -139,17 +145,64 @@ namespace Vegetation
 
         ////////////////////////////////////////////////////////////////
         // vegetation instance management
-        bool IsInstanceSkippable(const InstanceData& instanceData) const;
-        void CreateCVegetationInstanceNode(const InstanceData& instanceData);
-        void CreateMergedMeshInstanceNode(const InstanceData& instanceData);
+        enum class InstanceTaskType : AZ::u8
+        {
+            CreateVegetationNode,
+            CreateMergedMeshNode,
+            DestroyNode,
+        };
+
+        // compact record of a queued instance operation, only holding the data needed to build or release a render node
+        struct InstanceTask
+        {
+            InstanceTaskType m_type = InstanceTaskType::DestroyNode;
+            InstanceId m_instanceId = InvalidInstanceId;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            AZ::Quaternion m_rotation = AZ::Quaternion::CreateIdentity();
+            float m_scale = 1.0f;
+            DescriptorPtr m_descriptorPtr;
+        };
+
+        // live instances stored as parallel arrays per render group so transforms can be walked in bulk
+        struct InstanceTransformArrays
+        {
+            AZStd::vector<InstanceId> m_instanceIds;
+            AZStd::vector<AZ::Vector3> m_positions;
+            AZStd::vector<AZ::Quaternion> m_rotations;
+            AZStd::vector<float> m_scales;
+            AZStd::vector<IRenderNode*> m_nodes;
+
+            size_t Add(const InstanceTask& task, IRenderNode* node);
+            void RemoveAt(size_t index);
+        };
+
+        struct InstanceRecord
+        {
+            StatInstGroupId m_groupId = StatInstGroupEvents::s_InvalidStatInstGroupId;
+            size_t m_index = 0;
+        };
+
+        bool IsInstanceSkippable(InstanceId instanceId) const;
+        void CreateCVegetationInstanceNode(const InstanceTask& task);
+        void CreateMergedMeshInstanceNode(const InstanceTask& task);
+        void AddInstanceRecord(const InstanceTask& task, StatInstGroupId groupId, IRenderNode* instanceNode);
 
         void CreateInstanceNodeBegin();
         void CreateInstanceNodeEnd();
 
         void ReleaseInstanceNode(InstanceId instanceId);
 
+        IVegetation* AcquireVegetationNode();
+        void ReleaseVegetationNode(IRenderNode* instanceNode);
+        void ReleaseVegetationNodePool();
+
         AZStd::recursive_mutex m_instanceMapMutex;
-        AZStd::unordered_map<InstanceId, IRenderNode*> m_instanceMap;
+        AZStd::unordered_map<InstanceId, InstanceRecord> m_instanceMap;
+        AZStd::unordered_map<StatInstGroupId, InstanceTransformArrays> m_instanceTransforms;
+
+        //released vegetation nodes are reset and kept for reuse to avoid engine allocations while the view scrolls
+        //guarded by m_instanceMapMutex
+        AZStd::vector<IVegetation*> m_vegetationNodePool;
 
         mutable AZStd::recursive_mutex m_instanceDeletionSetMutex;
         AZStd::unordered_set<InstanceId> m_instanceDeletionSet;
@@ -162,17 +215,19 @@ namespace Vegetation
 
         ////////////////////////////////////////////////////////////////
         // Task management
-        using Task = AZStd::function<void(void)>;
-        using TaskBatch = AZStd::vector<Task>;
+        using TaskBatch = AZStd::vector<InstanceTask>;
         using TaskList = AZStd::list<TaskBatch>;
         TaskList m_mainThreadTaskQueue;
+        TaskList m_taskBatchPool;
         mutable AZStd::recursive_mutex m_mainThreadTaskMutex;
         mutable AZStd::recursive_mutex m_mainThreadTaskInProgressMutex;
 
         bool HasTasks() const;
-        void AddTask(const Task& task);
+        void AddTask(InstanceTask&& task);
         void ClearTasks();
         bool GetTasks(TaskList& removedTasks);
+        void RecycleTasks(TaskList& removedTasks);
+        void ExecuteTask(const InstanceTask& task);
         void ExecuteTasks();
         void ProcessMainThreadTasks();
 
@@ -0,0 +1,219 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Vegetation
+{
+    /**
+    * Fixed depth quadtree over the 2D extents of a sector, used to accelerate spatial queries of claimed instances.
+    * Items are stored by position in leaf cells and every node tracks how many items are beneath it so that empty
+    * branches are skipped.  Items positioned outside of the extents are kept in a separate list that is always visited.
+    */
+    template <typename TKey>
+    class SectorQuadTree final
+    {
+    public:
+        static const int s_depth = 4;
+        static const int s_cellsPerSide = 1 << s_depth;
+
+        //! Removes all items and sets the extents covered by the tree
+        AZ_INLINE void Reset(const AZ::Vector2& extentsMin, const AZ::Vector2& extentsMax)
+        {
+            m_extentsMin = extentsMin;
+            m_extentsMax = extentsMax;
+            const AZ::Vector2 extentsSize = m_extentsMax - m_extentsMin;
+            m_cellSize = AZ::Vector2(extentsSize.GetX() / s_cellsPerSide, extentsSize.GetY() / s_cellsPerSide);
+            Clear();
+        }
+
+        AZ_INLINE void Clear()
+        {
+            m_cells.resize(s_cellsPerSide * s_cellsPerSide);
+            for (auto& cell : m_cells)
+            {
+                cell.clear();
+            }
+
+            for (int level = 0; level <= s_depth; ++level)
+            {
+                const int nodesPerSide = 1 << level;
+                m_nodeCounts[level].assign(nodesPerSide * nodesPerSide, 0);
+            }
+
+            m_outliers.clear();
+            m_count = 0;
+        }
+
+        AZ_INLINE size_t GetCount() const
+        {
+            return m_count;
+        }
+
+        AZ_INLINE void Insert(const TKey& key, const AZ::Vector3& position)
+        {
+            Entry entry;
+            entry.m_key = key;
+            entry.m_position = position;
+
+            int cellX = 0;
+            int cellY = 0;
+            if (!GetCell(position, cellX, cellY))
+            {
+                m_outliers.push_back(entry);
+                ++m_count;
+                return;
+            }
+
+            m_cells[cellY * s_cellsPerSide + cellX].push_back(entry);
+            AdjustNodeCounts(cellX, cellY, 1);
+            ++m_count;
+        }
+
+        //! Removes the item with a matching key; position must be the one used when inserting
+        AZ_INLINE bool Remove(const TKey& key, const AZ::Vector3& position)
+        {
+            int cellX = 0;
+            int cellY = 0;
+            const bool inside = GetCell(position, cellX, cellY);
+
+            auto& entries = inside ? m_cells[cellY * s_cellsPerSide + cellX] : m_outliers;
+            for (size_t index = 0; index < entries.size(); ++index)
+            {
+                if (entries[index].m_key == key)
+                {
+                    entries[index] = entries.back();
+                    entries.pop_back();
+                    if (inside)
+                    {
+                        AdjustNodeCounts(cellX, cellY, -1);
+                    }
+                    --m_count;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        //! Visits all items in nodes accepted by nodeTest(nodeMin, nodeMax), calling visitor(key, position) for each.
+        //! Visitor returns false to stop.  Returns false if the visit was stopped early.
+        template <typename TNodeTest, typename TVisitor>
+        AZ_INLINE bool Visit(const TNodeTest& nodeTest, const TVisitor& visitor) const
+        {
+            if (m_count == 0)
+            {
+                return true;
+            }
+
+            for (const auto& entry : m_outliers)
+            {
+                if (!visitor(entry.m_key, entry.m_position))
+                {
+                    return false;
+                }
+            }
+
+            return m_cells.empty() || VisitNode(0, 0, 0, nodeTest, visitor);
+        }
+
+    private:
+        struct Entry
+        {
+            TKey m_key = {};
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        };
+
+        AZ_INLINE bool GetCell(const AZ::Vector3& position, int& cellX, int& cellY) const
+        {
+            if (m_cells.empty() || m_cellSize.GetX() <= 0.0f || m_cellSize.GetY() <= 0.0f)
+            {
+                return false;
+            }
+
+            const float x = static_cast<float>(position.GetX());
+            const float y = static_cast<float>(position.GetY());
+            if (x < m_extentsMin.GetX() || y < m_extentsMin.GetY() || x > m_extentsMax.GetX() || y > m_extentsMax.GetY())
+            {
+                return false;
+            }
+
+            //points on the max edge belong to the last cell
+            cellX = AZ::GetMin(static_cast<int>((x - m_extentsMin.GetX()) / m_cellSize.GetX()), s_cellsPerSide - 1);
+            cellY = AZ::GetMin(static_cast<int>((y - m_extentsMin.GetY()) / m_cellSize.GetY()), s_cellsPerSide - 1);
+            return true;
+        }
+
+        AZ_INLINE void AdjustNodeCounts(int cellX, int cellY, int delta)
+        {
+            for (int level = 0; level <= s_depth; ++level)
+            {
+                const int shift = s_depth - level;
+                const int nodesPerSide = 1 << level;
+                m_nodeCounts[level][(cellY >> shift) * nodesPerSide + (cellX >> shift)] += delta;
+            }
+        }
+
+        template <typename TNodeTest, typename TVisitor>
+        bool VisitNode(int level, int nodeX, int nodeY, const TNodeTest& nodeTest, const TVisitor& visitor) const
+        {
+            const int nodesPerSide = 1 << level;
+            if (m_nodeCounts[level][nodeY * nodesPerSide + nodeX] <= 0)
+            {
+                return true;
+            }
+
+            const int cellsPerNode = 1 << (s_depth - level);
+            const AZ::Vector2 nodeMin(
+                m_extentsMin.GetX() + m_cellSize.GetX() * (nodeX * cellsPerNode),
+                m_extentsMin.GetY() + m_cellSize.GetY() * (nodeY * cellsPerNode));
+            const AZ::Vector2 nodeMax(
+                nodeMin.GetX() + m_cellSize.GetX() * cellsPerNode,
+                nodeMin.GetY() + m_cellSize.GetY() * cellsPerNode);
+            if (!nodeTest(nodeMin, nodeMax))
+            {
+                return true;
+            }
+
+            if (level == s_depth)
+            {
+                for (const auto& entry : m_cells[nodeY * s_cellsPerSide + nodeX])
+                {
+                    if (!visitor(entry.m_key, entry.m_position))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            const int childX = nodeX << 1;
+            const int childY = nodeY << 1;
+            return
+                VisitNode(level + 1, childX, childY, nodeTest, visitor) &&
+                VisitNode(level + 1, childX + 1, childY, nodeTest, visitor) &&
+                VisitNode(level + 1, childX, childY + 1, nodeTest, visitor) &&
+                VisitNode(level + 1, childX + 1, childY + 1, nodeTest, visitor);
+        }
+
+        AZ::Vector2 m_extentsMin = AZ::Vector2::CreateZero();
+        AZ::Vector2 m_extentsMax = AZ::Vector2::CreateZero();
+        AZ::Vector2 m_cellSize = AZ::Vector2::CreateZero();
+        AZStd::vector<AZStd::vector<Entry>> m_cells;
+        AZStd::vector<int> m_nodeCounts[s_depth + 1];
+        AZStd::vector<Entry> m_outliers;
+        size_t m_count = 0;
+    };
+} // namespace Vegetation
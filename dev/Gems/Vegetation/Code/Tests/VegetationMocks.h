@@ -105,6 +105,28 @@ namespace UnitTest
                 }
             }
         }
+
+        void EnumerateInstancesWithPositionInAabb(const AZ::Aabb& bounds, Vegetation::AreaSystemEnumerateCallback callback) const override
+        {
+            ++m_count;
+            for (const auto& instanceData : m_existingInstances)
+            {
+                if (bounds.Contains(instanceData.m_position) && callback(instanceData) != Vegetation::AreaSystemEnumerateCallbackResult::KeepEnumerating)
+                {
+                    return;
+                }
+            }
+        }
+
+        void EnumerateInstancesAlongRay(const AZ::Vector3& start, const AZ::Vector3& end, float radius, Vegetation::AreaSystemEnumerateCallback callback) const override
+        {
+            ++m_count;
+        }
+
+        void EnumerateInstancesNearPoints(const AZStd::vector<AZ::Vector3>& points, float radius, Vegetation::AreaSystemEnumerateBatchCallback callback) const override
+        {
+            ++m_count;
+        }
     };
 
     struct MockInstanceSystemRequestBus
@@ -447,6 +469,11 @@ namespace UnitTest
             surfacePointList.push_back(outPoint);
         }
 
+        void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, const SurfaceData::SurfaceTagVector& desiredTags, SurfaceData::SurfacePointGrid& surfacePointGrid) const override
+        {
+            ++m_count;
+        }
+
         SurfaceData::SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceData::SurfaceDataRegistryEntry& entry) override
         {
             ++m_count;
@@ -42,6 +42,7 @@
 #include <Source/Components/SurfaceMaskDepthFilterComponent.h>
 #include <Source/Components/SurfaceMaskFilterComponent.h>
 #include <Source/Components/SurfaceSlopeFilterComponent.h>
+#include <Source/Util/SectorQuadTree.h>
 
 namespace UnitTest
 {
@@ -191,6 +192,91 @@ namespace UnitTest
         LmbrCentral::ShapeComponentRequestsBus::EventResult(resultIntersectRay, entity->GetId(), &LmbrCentral::ShapeComponentRequestsBus::Events::IntersectRay, AZ::Vector3::CreateZero(), AZ::Vector3::CreateZero(), AZ::VectorFloat() );
         EXPECT_TRUE(testShape.m_intersectRay == resultIntersectRay);
     }
+
+    TEST_F(VegetationComponentTestsBasics, SectorQuadTreeMatchesLinearSearch)
+    {
+        Vegetation::SectorQuadTree<AZ::u64> quadTree;
+        quadTree.Reset(AZ::Vector2(0.0f, 0.0f), AZ::Vector2(16.0f, 16.0f));
+
+        // a regular grid of points plus one point outside of the tree extents
+        AZStd::vector<AZ::Vector3> positions;
+        for (int y = 0; y < 16; ++y)
+        {
+            for (int x = 0; x < 16; ++x)
+            {
+                positions.push_back(AZ::Vector3(x + 0.5f, y + 0.5f, 0.0f));
+            }
+        }
+        positions.push_back(AZ::Vector3(20.0f, 3.0f, 0.0f));
+
+        for (AZ::u64 key = 0; key < positions.size(); ++key)
+        {
+            quadTree.Insert(key, positions[key]);
+        }
+        EXPECT_EQ(positions.size(), quadTree.GetCount());
+
+        // remove every other point
+        for (AZ::u64 key = 0; key < positions.size(); key += 2)
+        {
+            EXPECT_TRUE(quadTree.Remove(key, positions[key]));
+        }
+        EXPECT_FALSE(quadTree.Remove(0, positions[0]));
+
+        auto countInRect = [&quadTree](const AZ::Vector2& rectMin, const AZ::Vector2& rectMax)
+        {
+            size_t count = 0;
+            quadTree.Visit(
+                [&rectMin, &rectMax](const AZ::Vector2& nodeMin, const AZ::Vector2& nodeMax)
+                {
+                    return nodeMin.GetX() <= rectMax.GetX() && nodeMax.GetX() >= rectMin.GetX() && nodeMin.GetY() <= rectMax.GetY() && nodeMax.GetY() >= rectMin.GetY();
+                },
+                [&rectMin, &rectMax, &count](AZ::u64, const AZ::Vector3& position)
+                {
+                    const float x = static_cast<float>(position.GetX());
+                    const float y = static_cast<float>(position.GetY());
+                    if (x >= rectMin.GetX() && x <= rectMax.GetX() && y >= rectMin.GetY() && y <= rectMax.GetY())
+                    {
+                        ++count;
+                    }
+                    return true;
+                });
+            return count;
+        };
+
+        auto countLinear = [&positions](const AZ::Vector2& rectMin, const AZ::Vector2& rectMax)
+        {
+            size_t count = 0;
+            for (size_t key = 1; key < positions.size(); key += 2)
+            {
+                const float x = static_cast<float>(positions[key].GetX());
+                const float y = static_cast<float>(positions[key].GetY());
+                if (x >= rectMin.GetX() && x <= rectMax.GetX() && y >= rectMin.GetY() && y <= rectMax.GetY())
+                {
+                    ++count;
+                }
+            }
+            return count;
+        };
+
+        const AZ::Vector2 queries[][2] = {
+            { AZ::Vector2(0.0f, 0.0f), AZ::Vector2(16.0f, 16.0f) },
+            { AZ::Vector2(2.0f, 3.0f), AZ::Vector2(5.0f, 9.0f) },
+            { AZ::Vector2(15.0f, 0.0f), AZ::Vector2(25.0f, 4.0f) },
+            { AZ::Vector2(-5.0f, -5.0f), AZ::Vector2(-1.0f, -1.0f) },
+        };
+        for (const auto& query : queries)
+        {
+            EXPECT_EQ(countLinear(query[0], query[1]), countInRect(query[0], query[1]));
+        }
+
+        // stopping the visit early reports it to the caller
+        size_t visited = 0;
+        const bool completed = quadTree.Visit(
+            [](const AZ::Vector2&, const AZ::Vector2&) { return true; },
+            [&visited](AZ::u64, const AZ::Vector3&) { return ++visited < 3; });
+        EXPECT_FALSE(completed);
+        EXPECT_EQ(3u, visited);
+    }
 }
 
 //////////////////////////////////////////////////////////////////////////